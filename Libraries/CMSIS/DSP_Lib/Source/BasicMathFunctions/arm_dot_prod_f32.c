@@ -54,7 +54,7 @@
  *     sum = pSrcA[0]*pSrcB[0] + pSrcA[1]*pSrcB[1] + ... + pSrcA[blockSize-1]*pSrcB[blockSize-1]
  * </pre>     
  *
- * There are separate functions for floating-point, Q7, Q15, and Q31 data types.    
+ * There are separate functions for double-precision floating-point, floating-point, Q7, Q15, and Q31 data types.    
  */
 
 /**    
@@ -69,8 +69,66 @@
  * @param[in]       blockSize number of samples in each vector    
  * @param[out]      *result output result returned here    
  * @return none.    
+ *
+ * <b>Host build:</b>    
+ * \par    
+ * With ARM_MATH_HOST the products are summed in the lanes of the vector unit, then the lanes are added.    
+ * The summation order differs from the Cortex-M code, so the result is not bit-exact: it is within    
+ * <code>blockSize * FLT_EPSILON * (|pSrcA[0]*pSrcB[0]| + ... + |pSrcA[blockSize-1]*pSrcB[blockSize-1]|)</code>    
+ * of the exact dot product, the same bound as the sequential sum.    
  */
 
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+__HOST_SIMD_TARGET
+static float32_t arm_dot_prod_f32_host(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t blockSize)
+{
+  __host_vf acc0 = { 0.0f }, acc1 = { 0.0f };    /* Lane accumulators */
+  float32_t sum = 0.0f;                          /* Temporary result storage */
+  uint32_t blkCnt, i;                            /* loop counters */
+
+  /* Two independent accumulators hide the latency of the vector additions */
+  blkCnt = blockSize / (2u * __HOST_VLEN);
+
+  while(blkCnt > 0u)
+  {
+    acc0 += __HOST_LD(pSrcA) * __HOST_LD(pSrcB);
+    acc1 += __HOST_LD(pSrcA + __HOST_VLEN) * __HOST_LD(pSrcB + __HOST_VLEN);
+    pSrcA += 2u * __HOST_VLEN;
+    pSrcB += 2u * __HOST_VLEN;
+
+    blkCnt--;
+  }
+
+  if((blockSize & __HOST_VLEN) != 0u)
+  {
+    acc0 += __HOST_LD(pSrcA) * __HOST_LD(pSrcB);
+    pSrcA += __HOST_VLEN;
+    pSrcB += __HOST_VLEN;
+  }
+
+  acc0 += acc1;
+  for (i = 0u; i < __HOST_VLEN; i++)
+  {
+    sum += acc0[i];
+  }
+
+  /* Remaining samples */
+  blkCnt = blockSize % __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    sum += (*pSrcA++) * (*pSrcB++);
+    blkCnt--;
+  }
+
+  return (sum);
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
 
 void arm_dot_prod_f32(
   float32_t * pSrcA,
@@ -81,6 +139,16 @@ void arm_dot_prod_f32(
   float32_t sum = 0.0f;                          /* Temporary result storage */
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+  /* Host build: vector unit */
+  if(__HOST_SIMD_READY())
+  {
+    *result = arm_dot_prod_f32_host(pSrcA, pSrcB, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
 
 #ifndef ARM_MATH_CM0_FAMILY
 
@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:		arm_dot_prod_f64.c    
+*    
+* Description:	Double-precision floating-point dot product.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* ---------------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMath
+ */
+
+/**    
+ * @addtogroup dot_prod    
+ * @{    
+ */
+
+/**    
+ * @brief Dot product of double-precision floating-point vectors.    
+ * @param[in]       *pSrcA points to the first input vector    
+ * @param[in]       *pSrcB points to the second input vector    
+ * @param[in]       blockSize number of samples in each vector    
+ * @param[out]      *result output result returned here    
+ * @return none.    
+ *
+ * <b>Host build:</b>    
+ * \par    
+ * With ARM_MATH_HOST the products are summed in the lanes of the vector unit, then the lanes are added.    
+ * The summation order differs from the Cortex-M code, so the result is not bit-exact: it is within    
+ * <code>blockSize * DBL_EPSILON * (|pSrcA[0]*pSrcB[0]| + ... + |pSrcA[blockSize-1]*pSrcB[blockSize-1]|)</code>    
+ * of the exact dot product, the same bound as the sequential sum.    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+__HOST_SIMD_TARGET
+static float64_t arm_dot_prod_f64_host(
+  float64_t * pSrcA,
+  float64_t * pSrcB,
+  uint32_t blockSize)
+{
+  __host_vd acc0 = { 0.0 }, acc1 = { 0.0 };      /* Lane accumulators */
+  float64_t sum = 0.0;                           /* Temporary result storage */
+  uint32_t blkCnt, i;                            /* loop counters */
+
+  /* Two independent accumulators hide the latency of the vector additions */
+  blkCnt = blockSize / (2u * __HOST_VDLEN);
+
+  while(blkCnt > 0u)
+  {
+    acc0 += __HOST_LDD(pSrcA) * __HOST_LDD(pSrcB);
+    acc1 += __HOST_LDD(pSrcA + __HOST_VDLEN) * __HOST_LDD(pSrcB + __HOST_VDLEN);
+    pSrcA += 2u * __HOST_VDLEN;
+    pSrcB += 2u * __HOST_VDLEN;
+
+    blkCnt--;
+  }
+
+  if((blockSize & __HOST_VDLEN) != 0u)
+  {
+    acc0 += __HOST_LDD(pSrcA) * __HOST_LDD(pSrcB);
+    pSrcA += __HOST_VDLEN;
+    pSrcB += __HOST_VDLEN;
+  }
+
+  acc0 += acc1;
+  for (i = 0u; i < __HOST_VDLEN; i++)
+  {
+    sum += acc0[i];
+  }
+
+  /* Remaining samples */
+  blkCnt = blockSize % __HOST_VDLEN;
+
+  while(blkCnt > 0u)
+  {
+    sum += (*pSrcA++) * (*pSrcB++);
+    blkCnt--;
+  }
+
+  return (sum);
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+void arm_dot_prod_f64(
+  float64_t * pSrcA,
+  float64_t * pSrcB,
+  uint32_t blockSize,
+  float64_t * result)
+{
+  float64_t sum = 0.0;                           /* Temporary result storage */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+  /* Host build: vector unit */
+  if(__HOST_SIMD_READY())
+  {
+    *result = arm_dot_prod_f64_host(pSrcA, pSrcB, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+/* Run the below code for Cortex-M4 and Cortex-M3 */
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    /* Calculate dot product and then store the result in a temporary buffer */
+    sum += (*pSrcA++) * (*pSrcB++);
+    sum += (*pSrcA++) * (*pSrcB++);
+    sum += (*pSrcA++) * (*pSrcB++);
+    sum += (*pSrcA++) * (*pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+
+  while(blkCnt > 0u)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    /* Calculate dot product and then store the result in a temporary buffer. */
+    sum += (*pSrcA++) * (*pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+  /* Store the result back in the destination buffer */
+  *result = sum;
+}
+
+/**    
+ * @} end of dot_prod group    
+ */
@@ -0,0 +1,421 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_batch_pool.c    
+*    
+* Description:  Thread pool of the batch processing functions.    
+*    
+* Target Processor: Host (ARM_MATH_HOST)
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+#if defined (ARM_MATH_HOST)
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/**    
+ * @ingroup groupBatch    
+ */
+
+/**    
+ * @defgroup BatchPool Batch Thread Pool    
+ *    
+ * Runs the jobs of a batch on a pool of host threads.    
+ *    
+ * A job is a function called with the context of the batch and the index of the job,    
+ * from 0 to <code>numJobs-1</code>.  The jobs of one batch must be independent: they run    
+ * concurrently and in any order.    
+ *    
+ * \par    
+ * The calling thread is the first worker of the pool, so a pool of <code>numThreads</code>    
+ * threads creates <code>numThreads-1</code> host threads.  Each worker owns a queue, which    
+ * <code>arm_batch_run()</code> fills with a contiguous range of the jobs.  A worker takes its    
+ * jobs from the front of its queue and, when the queue is empty, steals the back half of the    
+ * largest queue left, so the load stays balanced when the jobs do not all take the same time.    
+ *    
+ * \par    
+ * <code>arm_batch_run()</code> returns when all the jobs are complete.  It must not be called    
+ * from a job, nor from two threads at the same time on the same pool.    
+ */
+
+/**    
+ * @addtogroup BatchPool    
+ * @{    
+ */
+
+/* Job queue of a worker, on its own cache line */
+typedef struct arm_batch_queue
+{
+  pthread_mutex_t lock;                          /* Protects next and end */
+  uint32_t next;                                 /* Next job to run */
+  uint32_t end;                                  /* One past the last job of the queue */
+  struct arm_batch_pool *pPool;                  /* Pool of the queue */
+} __attribute__((aligned(64))) arm_batch_queue;
+
+typedef struct arm_batch_pool
+{
+  pthread_mutex_t lock;                          /* Protects the fields below */
+  pthread_cond_t start;                          /* Signalled when a batch starts or the pool stops */
+  pthread_cond_t done;                           /* Signalled when the last worker thread completes a batch */
+  uint32_t generation;                           /* Number of the current batch */
+  uint16_t numBusy;                              /* Worker threads still running the current batch */
+  uint8_t stop;                                  /* Set to terminate the worker threads */
+  arm_batch_job pJob;                            /* Job function of the current batch */
+  void *pCtx;                                    /* Context of the current batch */
+  uint16_t numThreads;                           /* Number of workers, including the calling thread */
+  pthread_t *pThreads;                           /* numThreads-1 worker threads */
+  arm_batch_queue *pQueues;                      /* numThreads queues, pQueues[0] is the calling thread's */
+} arm_batch_pool;
+
+/*    
+ * Takes the next job of queue self, stealing from another queue when it is empty.    
+ * Returns 0 when no job is left in any queue.    
+ */
+
+static uint32_t arm_batch_next(
+  arm_batch_pool * P,
+  uint16_t self,
+  uint32_t * pJobIdx)
+{
+  arm_batch_queue *pQ = &P->pQueues[self];
+  arm_batch_queue *pV;
+  uint32_t rem, maxRem, cnt, end;
+  uint16_t i, victim;
+
+  for (;;)
+  {
+    pthread_mutex_lock(&pQ->lock);
+
+    if(pQ->next < pQ->end)
+    {
+      *pJobIdx = pQ->next++;
+      pthread_mutex_unlock(&pQ->lock);
+      return 1u;
+    }
+
+    pthread_mutex_unlock(&pQ->lock);
+
+    /* Own queue is empty: look for the queue with the most jobs left */
+    maxRem = 0u;
+    victim = self;
+
+    for (i = 0u; i < P->numThreads; i++)
+    {
+      if(i != self)
+      {
+        pV = &P->pQueues[i];
+        pthread_mutex_lock(&pV->lock);
+        rem = pV->end - pV->next;
+        pthread_mutex_unlock(&pV->lock);
+
+        if(rem > maxRem)
+        {
+          maxRem = rem;
+          victim = i;
+        }
+      }
+    }
+
+    if(maxRem == 0u)
+    {
+      return 0u;
+    }
+
+    /* Steal the back half of the victim's range.    
+     ** The victim may have run jobs in between, so the range is read again. */
+    pV = &P->pQueues[victim];
+    pthread_mutex_lock(&pV->lock);
+    rem = pV->end - pV->next;
+    cnt = (rem + 1u) / 2u;
+    end = pV->end;
+    pV->end -= cnt;
+    pthread_mutex_unlock(&pV->lock);
+
+    if(cnt > 0u)
+    {
+      /* Run the first stolen job now, queue the others */
+      pthread_mutex_lock(&pQ->lock);
+      pQ->next = end - cnt + 1u;
+      pQ->end = end;
+      pthread_mutex_unlock(&pQ->lock);
+
+      *pJobIdx = end - cnt;
+      return 1u;
+    }
+  }
+}
+
+static void arm_batch_work(
+  arm_batch_pool * P,
+  uint16_t self)
+{
+  uint32_t job;
+
+  while(arm_batch_next(P, self, &job))
+  {
+    P->pJob(P->pCtx, job);
+  }
+}
+
+static void *arm_batch_thread(
+  void *pArg)
+{
+  arm_batch_queue *pQ = (arm_batch_queue *) pArg;
+  arm_batch_pool *P = pQ->pPool;
+  uint16_t self = (uint16_t) (pQ - P->pQueues);
+  uint32_t generation = 0u;
+
+  pthread_mutex_lock(&P->lock);
+
+  for (;;)
+  {
+    while(!P->stop && (P->generation == generation))
+    {
+      pthread_cond_wait(&P->start, &P->lock);
+    }
+
+    if(P->stop)
+    {
+      break;
+    }
+
+    generation = P->generation;
+    pthread_mutex_unlock(&P->lock);
+
+    arm_batch_work(P, self);
+
+    pthread_mutex_lock(&P->lock);
+
+    if(--P->numBusy == 0u)
+    {
+      pthread_cond_signal(&P->done);
+    }
+  }
+
+  pthread_mutex_unlock(&P->lock);
+
+  return NULL;
+}
+
+static void arm_batch_free(
+  arm_batch_pool * P,
+  uint16_t numStarted)
+{
+  uint16_t i;
+
+  pthread_mutex_lock(&P->lock);
+  P->stop = 1u;
+  pthread_cond_broadcast(&P->start);
+  pthread_mutex_unlock(&P->lock);
+
+  for (i = 0u; i < numStarted; i++)
+  {
+    pthread_join(P->pThreads[i], NULL);
+  }
+
+  for (i = 0u; i < P->numThreads; i++)
+  {
+    pthread_mutex_destroy(&P->pQueues[i].lock);
+  }
+
+  pthread_cond_destroy(&P->done);
+  pthread_cond_destroy(&P->start);
+  pthread_mutex_destroy(&P->lock);
+
+  free(P->pThreads);
+  free(P->pQueues);
+  free(P);
+}
+
+/**    
+ * @brief  Initialization function for the batch thread pool.    
+ * @param[out] *S points to an instance of the batch structure.    
+ * @param[in]  numThreads number of threads that run the jobs, including the calling thread.    
+ *             0 uses one thread per online CPU.    
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the threads    
+ * could not be created.    
+ */
+
+arm_status arm_batch_init(
+  arm_batch_instance * S,
+  uint16_t numThreads)
+{
+  arm_batch_pool *P;
+  void *pQueues;
+  long numCpus;
+  uint16_t i;
+
+  if(numThreads == 0u)
+  {
+    numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    numThreads = (numCpus < 1) ? 1u : (numCpus > 0xFFFF) ? 0xFFFFu : (uint16_t) numCpus;
+  }
+
+  S->numThreads = numThreads;
+  S->pPool = NULL;
+
+  /* A single thread runs the jobs in the calling thread, without a pool */
+  if(numThreads == 1u)
+  {
+    return (ARM_MATH_SUCCESS);
+  }
+
+  P = (arm_batch_pool *) calloc(1u, sizeof(arm_batch_pool));
+
+  if(P == NULL)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  P->numThreads = numThreads;
+  P->pThreads = (pthread_t *) calloc(numThreads - 1u, sizeof(pthread_t));
+
+  if((P->pThreads == NULL) ||
+     (posix_memalign(&pQueues, 64u, numThreads * sizeof(arm_batch_queue)) != 0))
+  {
+    free(P->pThreads);
+    free(P);
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  P->pQueues = (arm_batch_queue *) pQueues;
+  pthread_mutex_init(&P->lock, NULL);
+  pthread_cond_init(&P->start, NULL);
+  pthread_cond_init(&P->done, NULL);
+
+  for (i = 0u; i < numThreads; i++)
+  {
+    pthread_mutex_init(&P->pQueues[i].lock, NULL);
+    P->pQueues[i].next = 0u;
+    P->pQueues[i].end = 0u;
+    P->pQueues[i].pPool = P;
+  }
+
+  for (i = 1u; i < numThreads; i++)
+  {
+    if(pthread_create(&P->pThreads[i - 1u], NULL, arm_batch_thread, &P->pQueues[i]) != 0)
+    {
+      arm_batch_free(P, i - 1u);
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  S->pPool = P;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @brief  Stops the threads of the batch thread pool and frees it.    
+ * @param[in,out] *S points to an instance of the batch structure.    
+ * @return none.    
+ */
+
+void arm_batch_deinit(
+  arm_batch_instance * S)
+{
+  arm_batch_pool *P = (arm_batch_pool *) S->pPool;
+
+  if(P != NULL)
+  {
+    arm_batch_free(P, P->numThreads - 1u);
+    S->pPool = NULL;
+  }
+}
+
+/**    
+ * @brief  Runs a batch of jobs on the thread pool.    
+ * @param[in]  *S points to an instance of the batch structure.    
+ * @param[in]  pJob job function, called once for each job index.    
+ * @param[in]  *pCtx context passed to each call of <code>pJob</code>.    
+ * @param[in]  numJobs number of jobs.    
+ * @return none.    
+ */
+
+void arm_batch_run(
+  const arm_batch_instance * S,
+  arm_batch_job pJob,
+  void *pCtx,
+  uint32_t numJobs)
+{
+  arm_batch_pool *P = (arm_batch_pool *) S->pPool;
+  uint32_t job;
+  uint16_t i;
+
+  if((P == NULL) || (numJobs == 1u))
+  {
+    for (job = 0u; job < numJobs; job++)
+    {
+      pJob(pCtx, job);
+    }
+
+    return;
+  }
+
+  /* Split the jobs into one contiguous range per worker.    
+   ** The workers read the queues after taking P->lock, which orders these writes. */
+  for (i = 0u; i < P->numThreads; i++)
+  {
+    P->pQueues[i].next = (uint32_t) (((uint64_t) numJobs * i) / P->numThreads);
+    P->pQueues[i].end = (uint32_t) (((uint64_t) numJobs * (i + 1u)) / P->numThreads);
+  }
+
+  pthread_mutex_lock(&P->lock);
+  P->pJob = pJob;
+  P->pCtx = pCtx;
+  P->numBusy = P->numThreads - 1u;
+  P->generation++;
+  pthread_cond_broadcast(&P->start);
+  pthread_mutex_unlock(&P->lock);
+
+  /* The calling thread is worker 0 */
+  arm_batch_work(P, 0u);
+
+  pthread_mutex_lock(&P->lock);
+
+  while(P->numBusy > 0u)
+  {
+    pthread_cond_wait(&P->done, &P->lock);
+  }
+
+  pthread_mutex_unlock(&P->lock);
+}
+
+/**    
+ * @} end of BatchPool group    
+ */
+
+#endif /* #if defined (ARM_MATH_HOST) */
@@ -0,0 +1,106 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_biquad_cascade_df1_batch_q31.c    
+*    
+* Description:  Q31 Biquad cascade filter over a batch of channels.    
+*    
+* Target Processor: Host (ARM_MATH_HOST)
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+#if defined (ARM_MATH_HOST)
+
+/**    
+ * @ingroup groupBatch    
+ */
+
+/**    
+ * @addtogroup BatchPool    
+ * @{    
+ */
+
+typedef struct
+{
+  const arm_biquad_casd_df1_inst_q31 *S;
+  q31_t **ppSrc;
+  q31_t **ppDst;
+  uint32_t blockSize;
+} arm_biquad_cascade_df1_batch_ctx_q31;
+
+static void arm_biquad_cascade_df1_batch_job_q31(
+  void *pCtx,
+  uint32_t job)
+{
+  arm_biquad_cascade_df1_batch_ctx_q31 *C = (arm_biquad_cascade_df1_batch_ctx_q31 *) pCtx;
+
+  arm_biquad_cascade_df1_q31(&C->S[job], C->ppSrc[job], C->ppDst[job], C->blockSize);
+}
+
+/**    
+ * @brief Processes a block of each of several channels with the Q31 Biquad cascade filter.    
+ * @param[in]  *B points to an instance of the batch structure.    
+ * @param[in]  *S points to an array of <code>numChans</code> Q31 Biquad cascade filter instances, one per channel.    
+ * @param[in]  **ppSrc points to an array of <code>numChans</code> pointers to the input blocks.    
+ * @param[out] **ppDst points to an array of <code>numChans</code> pointers to the output blocks.    
+ * @param[in]  numChans number of channels.    
+ * @param[in]  blockSize number of samples to process per channel.    
+ * @return     none.    
+ *    
+ * The results are those of <code>arm_biquad_cascade_df1_q31(&S[i], ppSrc[i], ppDst[i], blockSize)</code> for each channel.    
+ */
+
+void arm_biquad_cascade_df1_batch_q31(
+  const arm_batch_instance * B,
+  const arm_biquad_casd_df1_inst_q31 * S,
+  q31_t ** ppSrc,
+  q31_t ** ppDst,
+  uint32_t numChans,
+  uint32_t blockSize)
+{
+  arm_biquad_cascade_df1_batch_ctx_q31 C;
+
+  C.S = S;
+  C.ppSrc = ppSrc;
+  C.ppDst = ppDst;
+  C.blockSize = blockSize;
+
+  arm_batch_run(B, arm_biquad_cascade_df1_batch_job_q31, &C, numChans);
+}
+
+/**    
+ * @} end of BatchPool group    
+ */
+
+#endif /* #if defined (ARM_MATH_HOST) */
@@ -0,0 +1,119 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_interleaved_batch_f32.c    
+*    
+* Description:  Floating-point interleaved FIR filter on the thread pool.    
+*    
+* Target Processor: Host (ARM_MATH_HOST)
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+#if defined (ARM_MATH_HOST)
+
+/**    
+ * @ingroup groupBatch    
+ */
+
+/**    
+ * @addtogroup BatchPool    
+ * @{    
+ */
+
+/* Channels per job: 16 float32 channels fill a 64-byte cache line of each frame,    
+ * so two jobs never write to the same line */
+#define ARM_FIR_INTERLEAVED_BATCH_CHANS  16u
+
+typedef struct
+{
+  const arm_fir_interleaved_instance_f32 *S;
+  float32_t *pSrc;
+  float32_t *pDst;
+  uint32_t blockSize;
+} arm_fir_interleaved_batch_ctx_f32;
+
+static void arm_fir_interleaved_batch_job_f32(
+  void *pCtx,
+  uint32_t job)
+{
+  arm_fir_interleaved_batch_ctx_f32 *C = (arm_fir_interleaved_batch_ctx_f32 *) pCtx;
+  uint32_t firstChan = job * ARM_FIR_INTERLEAVED_BATCH_CHANS;
+  uint32_t numChans = C->S->numChans - firstChan;
+
+  if(numChans > ARM_FIR_INTERLEAVED_BATCH_CHANS)
+  {
+    numChans = ARM_FIR_INTERLEAVED_BATCH_CHANS;
+  }
+
+  arm_fir_interleaved_range_f32(C->S, C->pSrc, C->pDst, C->blockSize,
+                                (uint16_t) firstChan, (uint16_t) numChans);
+}
+
+/**    
+ * @brief Processes a block of frames with the floating-point interleaved FIR filter on the thread pool.    
+ * @param[in]  *B points to an instance of the batch structure.    
+ * @param[in]  *S points to an instance of the floating-point interleaved FIR filter structure.    
+ * @param[in]  *pSrc points to the block of input frames.    
+ * @param[out] *pDst points to the block of output frames.    
+ * @param[in]  blockSize number of frames to process.    
+ * @return     none.    
+ *    
+ * The channels are split into groups of 16, one job each, and each job computes its channels    
+ * in the lanes of the vector unit.  The results are those of <code>arm_fir_interleaved_f32()</code>.    
+ * The buffers should be aligned on 64 bytes.    
+ */
+
+void arm_fir_interleaved_batch_f32(
+  const arm_batch_instance * B,
+  const arm_fir_interleaved_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  arm_fir_interleaved_batch_ctx_f32 C;
+
+  C.S = S;
+  C.pSrc = pSrc;
+  C.pDst = pDst;
+  C.blockSize = blockSize;
+
+  arm_batch_run(B, arm_fir_interleaved_batch_job_f32, &C,
+                (S->numChans + ARM_FIR_INTERLEAVED_BATCH_CHANS - 1u) / ARM_FIR_INTERLEAVED_BATCH_CHANS);
+}
+
+/**    
+ * @} end of BatchPool group    
+ */
+
+#endif /* #if defined (ARM_MATH_HOST) */
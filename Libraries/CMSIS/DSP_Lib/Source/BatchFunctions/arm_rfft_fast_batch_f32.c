@@ -0,0 +1,107 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_rfft_fast_batch_f32.c    
+*    
+* Description:  Floating-point real FFT over a batch of channels.    
+*    
+* Target Processor: Host (ARM_MATH_HOST)
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+#if defined (ARM_MATH_HOST)
+
+/**    
+ * @ingroup groupBatch    
+ */
+
+/**    
+ * @addtogroup BatchPool    
+ * @{    
+ */
+
+typedef struct
+{
+  arm_rfft_fast_instance_f32 *S;
+  float32_t **ppIn;
+  float32_t **ppOut;
+  uint8_t ifftFlag;
+} arm_rfft_fast_batch_ctx_f32;
+
+static void arm_rfft_fast_batch_job_f32(
+  void *pCtx,
+  uint32_t job)
+{
+  arm_rfft_fast_batch_ctx_f32 *C = (arm_rfft_fast_batch_ctx_f32 *) pCtx;
+
+  arm_rfft_fast_f32(&C->S[job], C->ppIn[job], C->ppOut[job], C->ifftFlag);
+}
+
+/**    
+ * @brief Computes the real FFT or inverse real FFT of each of several channels.    
+ * @param[in]     *B points to an instance of the batch structure.    
+ * @param[in]     *S points to an array of <code>numChans</code> real FFT instances, one per channel.    
+ * @param[in,out] **ppIn points to an array of <code>numChans</code> pointers to the input buffers, which are modified.    
+ * @param[out]    **ppOut points to an array of <code>numChans</code> pointers to the output buffers.    
+ * @param[in]     ifftFlag 0 for the forward transforms, 1 for the inverse transforms.    
+ * @param[in]     numChans number of channels.    
+ * @return        none.    
+ *    
+ * Each channel needs its own instance, even with the same length: <code>arm_rfft_fast_f32()</code>    
+ * writes to the instance.    
+ */
+
+void arm_rfft_fast_batch_f32(
+  const arm_batch_instance * B,
+  arm_rfft_fast_instance_f32 * S,
+  float32_t ** ppIn,
+  float32_t ** ppOut,
+  uint8_t ifftFlag,
+  uint32_t numChans)
+{
+  arm_rfft_fast_batch_ctx_f32 C;
+
+  C.S = S;
+  C.ppIn = ppIn;
+  C.ppOut = ppOut;
+  C.ifftFlag = ifftFlag;
+
+  arm_batch_run(B, arm_rfft_fast_batch_job_f32, &C, numChans);
+}
+
+/**    
+ * @} end of BatchPool group    
+ */
+
+#endif /* #if defined (ARM_MATH_HOST) */
@@ -16063,3 +16063,9662 @@ const float32_t twiddleCoef_rfft_4096[4096] = {
     0.003067957f, -0.999995294f,
     0.001533980f, -0.999998823f
 };
+
+/* 32 KB, only built for the 8192-point real FFT (see ARM_MATH_RFFT_8192 in arm_math.h) */
+#if defined (ARM_MATH_RFFT_8192)
+const float32_t twiddleCoef_rfft_8192[8192] = {
+    0.000000000f,  1.000000000f,
+    0.000766990f,  0.999999706f,
+    0.001533980f,  0.999998823f,
+    0.002300969f,  0.999997353f,
+    0.003067957f,  0.999995294f,
+    0.003834943f,  0.999992647f,
+    0.004601926f,  0.999989411f,
+    0.005368907f,  0.999985587f,
+    0.006135885f,  0.999981175f,
+    0.006902859f,  0.999976175f,
+    0.007669829f,  0.999970586f,
+    0.008436794f,  0.999964410f,
+    0.009203755f,  0.999957645f,
+    0.009970710f,  0.999950291f,
+    0.010737659f,  0.999942350f,
+    0.011504602f,  0.999933820f,
+    0.012271538f,  0.999924702f,
+    0.013038467f,  0.999914996f,
+    0.013805389f,  0.999904701f,
+    0.014572302f,  0.999893818f,
+    0.015339206f,  0.999882347f,
+    0.016106102f,  0.999870288f,
+    0.016872988f,  0.999857641f,
+    0.017639864f,  0.999844405f,
+    0.018406730f,  0.999830582f,
+    0.019173585f,  0.999816170f,
+    0.019940429f,  0.999801170f,
+    0.020707261f,  0.999785582f,
+    0.021474080f,  0.999769405f,
+    0.022240887f,  0.999752641f,
+    0.023007681f,  0.999735288f,
+    0.023774462f,  0.999717348f,
+    0.024541229f,  0.999698819f,
+    0.025307981f,  0.999679702f,
+    0.026074718f,  0.999659997f,
+    0.026841440f,  0.999639704f,
+    0.027608146f,  0.999618822f,
+    0.028374836f,  0.999597353f,
+    0.029141509f,  0.999575296f,
+    0.029908165f,  0.999552651f,
+    0.030674803f,  0.999529418f,
+    0.031441424f,  0.999505596f,
+    0.032208025f,  0.999481187f,
+    0.032974608f,  0.999456190f,
+    0.033741172f,  0.999430605f,
+    0.034507716f,  0.999404431f,
+    0.035274239f,  0.999377670f,
+    0.036040742f,  0.999350321f,
+    0.036807223f,  0.999322385f,
+    0.037573683f,  0.999293860f,
+    0.038340120f,  0.999264747f,
+    0.039106535f,  0.999235047f,
+    0.039872928f,  0.999204759f,
+    0.040639296f,  0.999173883f,
+    0.041405641f,  0.999142419f,
+    0.042171961f,  0.999110367f,
+    0.042938257f,  0.999077728f,
+    0.043704527f,  0.999044501f,
+    0.044470772f,  0.999010686f,
+    0.045236990f,  0.998976283f,
+    0.046003182f,  0.998941293f,
+    0.046769347f,  0.998905715f,
+    0.047535484f,  0.998869550f,
+    0.048301593f,  0.998832797f,
+    0.049067674f,  0.998795456f,
+    0.049833726f,  0.998757528f,
+    0.050599749f,  0.998719012f,
+    0.051365742f,  0.998679909f,
+    0.052131705f,  0.998640218f,
+    0.052897637f,  0.998599940f,
+    0.053663538f,  0.998559074f,
+    0.054429407f,  0.998517621f,
+    0.055195244f,  0.998475581f,
+    0.055961049f,  0.998432953f,
+    0.056726821f,  0.998389737f,
+    0.057492560f,  0.998345935f,
+    0.058258265f,  0.998301545f,
+    0.059023935f,  0.998256568f,
+    0.059789571f,  0.998211003f,
+    0.060555171f,  0.998164852f,
+    0.061320736f,  0.998118113f,
+    0.062086265f,  0.998070787f,
+    0.062851758f,  0.998022874f,
+    0.063617213f,  0.997974374f,
+    0.064382631f,  0.997925286f,
+    0.065148011f,  0.997875612f,
+    0.065913353f,  0.997825350f,
+    0.066678656f,  0.997774502f,
+    0.067443920f,  0.997723067f,
+    0.068209144f,  0.997671044f,
+    0.068974328f,  0.997618435f,
+    0.069739471f,  0.997565239f,
+    0.070504573f,  0.997511456f,
+    0.071269634f,  0.997457086f,
+    0.072034653f,  0.997402130f,
+    0.072799630f,  0.997346587f,
+    0.073564564f,  0.997290457f,
+    0.074329454f,  0.997233740f,
+    0.075094301f,  0.997176437f,
+    0.075859103f,  0.997118547f,
+    0.076623861f,  0.997060070f,
+    0.077388574f,  0.997001007f,
+    0.078153242f,  0.996941358f,
+    0.078917863f,  0.996881122f,
+    0.079682438f,  0.996820299f,
+    0.080446966f,  0.996758890f,
+    0.081211447f,  0.996696895f,
+    0.081975880f,  0.996634314f,
+    0.082740265f,  0.996571146f,
+    0.083504601f,  0.996507392f,
+    0.084268888f,  0.996443051f,
+    0.085033125f,  0.996378125f,
+    0.085797312f,  0.996312612f,
+    0.086561449f,  0.996246513f,
+    0.087325535f,  0.996179829f,
+    0.088089570f,  0.996112558f,
+    0.088853553f,  0.996044701f,
+    0.089617483f,  0.995976258f,
+    0.090381361f,  0.995907229f,
+    0.091145185f,  0.995837615f,
+    0.091908956f,  0.995767414f,
+    0.092672673f,  0.995696628f,
+    0.093436336f,  0.995625256f,
+    0.094199943f,  0.995553299f,
+    0.094963495f,  0.995480755f,
+    0.095726991f,  0.995407627f,
+    0.096490431f,  0.995333912f,
+    0.097253814f,  0.995259612f,
+    0.098017140f,  0.995184727f,
+    0.098780409f,  0.995109256f,
+    0.099543619f,  0.995033199f,
+    0.100306770f,  0.994956558f,
+    0.101069863f,  0.994879331f,
+    0.101832896f,  0.994801519f,
+    0.102595869f,  0.994723121f,
+    0.103358782f,  0.994644138f,
+    0.104121634f,  0.994564571f,
+    0.104884425f,  0.994484418f,
+    0.105647154f,  0.994403680f,
+    0.106409821f,  0.994322357f,
+    0.107172425f,  0.994240449f,
+    0.107934966f,  0.994157957f,
+    0.108697444f,  0.994074879f,
+    0.109459858f,  0.993991217f,
+    0.110222207f,  0.993906970f,
+    0.110984492f,  0.993822138f,
+    0.111746711f,  0.993736722f,
+    0.112508865f,  0.993650721f,
+    0.113270952f,  0.993564136f,
+    0.114032973f,  0.993476966f,
+    0.114794927f,  0.993389211f,
+    0.115556813f,  0.993300872f,
+    0.116318631f,  0.993211949f,
+    0.117080381f,  0.993122442f,
+    0.117842062f,  0.993032350f,
+    0.118603673f,  0.992941674f,
+    0.119365215f,  0.992850414f,
+    0.120126686f,  0.992758570f,
+    0.120888087f,  0.992666142f,
+    0.121649417f,  0.992573130f,
+    0.122410675f,  0.992479535f,
+    0.123171861f,  0.992385355f,
+    0.123932975f,  0.992290591f,
+    0.124694016f,  0.992195244f,
+    0.125454983f,  0.992099313f,
+    0.126215877f,  0.992002799f,
+    0.126976696f,  0.991905700f,
+    0.127737441f,  0.991808019f,
+    0.128498111f,  0.991709754f,
+    0.129258705f,  0.991610905f,
+    0.130019223f,  0.991511473f,
+    0.130779664f,  0.991411458f,
+    0.131540029f,  0.991310860f,
+    0.132300316f,  0.991209678f,
+    0.133060525f,  0.991107914f,
+    0.133820656f,  0.991005566f,
+    0.134580709f,  0.990902635f,
+    0.135340682f,  0.990799122f,
+    0.136100575f,  0.990695025f,
+    0.136860389f,  0.990590346f,
+    0.137620122f,  0.990485084f,
+    0.138379774f,  0.990379240f,
+    0.139139344f,  0.990272812f,
+    0.139898833f,  0.990165803f,
+    0.140658239f,  0.990058210f,
+    0.141417563f,  0.989950036f,
+    0.142176804f,  0.989841278f,
+    0.142935960f,  0.989731939f,
+    0.143695033f,  0.989622017f,
+    0.144454021f,  0.989511514f,
+    0.145212925f,  0.989400428f,
+    0.145971742f,  0.989288760f,
+    0.146730474f,  0.989176510f,
+    0.147489120f,  0.989063678f,
+    0.148247679f,  0.988950265f,
+    0.149006151f,  0.988836269f,
+    0.149764535f,  0.988721692f,
+    0.150522831f,  0.988606533f,
+    0.151281038f,  0.988490793f,
+    0.152039156f,  0.988374471f,
+    0.152797185f,  0.988257568f,
+    0.153555124f,  0.988140083f,
+    0.154312973f,  0.988022017f,
+    0.155070731f,  0.987903370f,
+    0.155828398f,  0.987784142f,
+    0.156585973f,  0.987664332f,
+    0.157343456f,  0.987543942f,
+    0.158100846f,  0.987422970f,
+    0.158858143f,  0.987301418f,
+    0.159615347f,  0.987179285f,
+    0.160372457f,  0.987056571f,
+    0.161129473f,  0.986933277f,
+    0.161886394f,  0.986809402f,
+    0.162643219f,  0.986684946f,
+    0.163399949f,  0.986559910f,
+    0.164156583f,  0.986434294f,
+    0.164913120f,  0.986308097f,
+    0.165669561f,  0.986181320f,
+    0.166425904f,  0.986053963f,
+    0.167182148f,  0.985926026f,
+    0.167938295f,  0.985797509f,
+    0.168694343f,  0.985668412f,
+    0.169450291f,  0.985538735f,
+    0.170206140f,  0.985408479f,
+    0.170961889f,  0.985277642f,
+    0.171717537f,  0.985146226f,
+    0.172473084f,  0.985014231f,
+    0.173228530f,  0.984881656f,
+    0.173983873f,  0.984748502f,
+    0.174739115f,  0.984614768f,
+    0.175494253f,  0.984480455f,
+    0.176249289f,  0.984345563f,
+    0.177004220f,  0.984210092f,
+    0.177759048f,  0.984074042f,
+    0.178513771f,  0.983937413f,
+    0.179268389f,  0.983800206f,
+    0.180022901f,  0.983662419f,
+    0.180777308f,  0.983524054f,
+    0.181531608f,  0.983385110f,
+    0.182285802f,  0.983245588f,
+    0.183039888f,  0.983105487f,
+    0.183793867f,  0.982964808f,
+    0.184547737f,  0.982823551f,
+    0.185301499f,  0.982681716f,
+    0.186055152f,  0.982539302f,
+    0.186808695f,  0.982396311f,
+    0.187562129f,  0.982252741f,
+    0.188315452f,  0.982108594f,
+    0.189068664f,  0.981963869f,
+    0.189821765f,  0.981818566f,
+    0.190574755f,  0.981672686f,
+    0.191327632f,  0.981526228f,
+    0.192080397f,  0.981379193f,
+    0.192833049f,  0.981231581f,
+    0.193585587f,  0.981083391f,
+    0.194338012f,  0.980934624f,
+    0.195090322f,  0.980785280f,
+    0.195842517f,  0.980635360f,
+    0.196594598f,  0.980484862f,
+    0.197346562f,  0.980333787f,
+    0.198098411f,  0.980182136f,
+    0.198850143f,  0.980029908f,
+    0.199601758f,  0.979877104f,
+    0.200353255f,  0.979723723f,
+    0.201104635f,  0.979569766f,
+    0.201855896f,  0.979415232f,
+    0.202607039f,  0.979260123f,
+    0.203358062f,  0.979104437f,
+    0.204108966f,  0.978948175f,
+    0.204859750f,  0.978791338f,
+    0.205610413f,  0.978633924f,
+    0.206360955f,  0.978475935f,
+    0.207111376f,  0.978317371f,
+    0.207861675f,  0.978158231f,
+    0.208611852f,  0.977998515f,
+    0.209361906f,  0.977838224f,
+    0.210111837f,  0.977677358f,
+    0.210861644f,  0.977515917f,
+    0.211611327f,  0.977353900f,
+    0.212360886f,  0.977191309f,
+    0.213110320f,  0.977028143f,
+    0.213859628f,  0.976864402f,
+    0.214608811f,  0.976700086f,
+    0.215357867f,  0.976535196f,
+    0.216106797f,  0.976369731f,
+    0.216855600f,  0.976203692f,
+    0.217604275f,  0.976037079f,
+    0.218352822f,  0.975869892f,
+    0.219101240f,  0.975702130f,
+    0.219849530f,  0.975533795f,
+    0.220597690f,  0.975364885f,
+    0.221345721f,  0.975195402f,
+    0.222093621f,  0.975025345f,
+    0.222841391f,  0.974854715f,
+    0.223589029f,  0.974683511f,
+    0.224336536f,  0.974511733f,
+    0.225083911f,  0.974339383f,
+    0.225831154f,  0.974166459f,
+    0.226578264f,  0.973992962f,
+    0.227325240f,  0.973818892f,
+    0.228072083f,  0.973644250f,
+    0.228818792f,  0.973469034f,
+    0.229565366f,  0.973293246f,
+    0.230311805f,  0.973116885f,
+    0.231058108f,  0.972939952f,
+    0.231804276f,  0.972762447f,
+    0.232550307f,  0.972584369f,
+    0.233296201f,  0.972405719f,
+    0.234041959f,  0.972226497f,
+    0.234787578f,  0.972046703f,
+    0.235533059f,  0.971866337f,
+    0.236278402f,  0.971685400f,
+    0.237023606f,  0.971503891f,
+    0.237768670f,  0.971321810f,
+    0.238513595f,  0.971139158f,
+    0.239258379f,  0.970955935f,
+    0.240003022f,  0.970772141f,
+    0.240747525f,  0.970587775f,
+    0.241491885f,  0.970402839f,
+    0.242236104f,  0.970217331f,
+    0.242980180f,  0.970031253f,
+    0.243724113f,  0.969844604f,
+    0.244467903f,  0.969657385f,
+    0.245211549f,  0.969469595f,
+    0.245955050f,  0.969281235f,
+    0.246698407f,  0.969092305f,
+    0.247441619f,  0.968902805f,
+    0.248184685f,  0.968712734f,
+    0.248927606f,  0.968522094f,
+    0.249670380f,  0.968330884f,
+    0.250413007f,  0.968139105f,
+    0.251155486f,  0.967946756f,
+    0.251897818f,  0.967753837f,
+    0.252640002f,  0.967560349f,
+    0.253382037f,  0.967366292f,
+    0.254123923f,  0.967171666f,
+    0.254865660f,  0.966976471f,
+    0.255607246f,  0.966780707f,
+    0.256348682f,  0.966584374f,
+    0.257089968f,  0.966387473f,
+    0.257831102f,  0.966190003f,
+    0.258572085f,  0.965991965f,
+    0.259312915f,  0.965793359f,
+    0.260053593f,  0.965594184f,
+    0.260794118f,  0.965394442f,
+    0.261534489f,  0.965194131f,
+    0.262274707f,  0.964993253f,
+    0.263014770f,  0.964791807f,
+    0.263754679f,  0.964589793f,
+    0.264494432f,  0.964387212f,
+    0.265234030f,  0.964184064f,
+    0.265973472f,  0.963980348f,
+    0.266712757f,  0.963776066f,
+    0.267451886f,  0.963571216f,
+    0.268190857f,  0.963365800f,
+    0.268929670f,  0.963159817f,
+    0.269668326f,  0.962953267f,
+    0.270406822f,  0.962746151f,
+    0.271145160f,  0.962538468f,
+    0.271883337f,  0.962330219f,
+    0.272621355f,  0.962121404f,
+    0.273359213f,  0.961912023f,
+    0.274096910f,  0.961702077f,
+    0.274834445f,  0.961491564f,
+    0.275571819f,  0.961280486f,
+    0.276309031f,  0.961068842f,
+    0.277046080f,  0.960856633f,
+    0.277782967f,  0.960643859f,
+    0.278519689f,  0.960430519f,
+    0.279256248f,  0.960216615f,
+    0.279992643f,  0.960002146f,
+    0.280728873f,  0.959787112f,
+    0.281464938f,  0.959571513f,
+    0.282200837f,  0.959355350f,
+    0.282936570f,  0.959138622f,
+    0.283672137f,  0.958921331f,
+    0.284407537f,  0.958703475f,
+    0.285142770f,  0.958485055f,
+    0.285877835f,  0.958266071f,
+    0.286612731f,  0.958046524f,
+    0.287347460f,  0.957826413f,
+    0.288082019f,  0.957605739f,
+    0.288816408f,  0.957384501f,
+    0.289550628f,  0.957162700f,
+    0.290284677f,  0.956940336f,
+    0.291018556f,  0.956717409f,
+    0.291752263f,  0.956493919f,
+    0.292485799f,  0.956269866f,
+    0.293219163f,  0.956045251f,
+    0.293952354f,  0.955820074f,
+    0.294685372f,  0.955594334f,
+    0.295418217f,  0.955368032f,
+    0.296150888f,  0.955141168f,
+    0.296883385f,  0.954913742f,
+    0.297615707f,  0.954685755f,
+    0.298347855f,  0.954457206f,
+    0.299079826f,  0.954228095f,
+    0.299811622f,  0.953998423f,
+    0.300543241f,  0.953768190f,
+    0.301274684f,  0.953537396f,
+    0.302005949f,  0.953306040f,
+    0.302737037f,  0.953074124f,
+    0.303467947f,  0.952841648f,
+    0.304198678f,  0.952608610f,
+    0.304929230f,  0.952375013f,
+    0.305659602f,  0.952140855f,
+    0.306389795f,  0.951906137f,
+    0.307119808f,  0.951670859f,
+    0.307849640f,  0.951435021f,
+    0.308579291f,  0.951198623f,
+    0.309308760f,  0.950961666f,
+    0.310038048f,  0.950724150f,
+    0.310767153f,  0.950486074f,
+    0.311496075f,  0.950247439f,
+    0.312224814f,  0.950008245f,
+    0.312953369f,  0.949768492f,
+    0.313681740f,  0.949528181f,
+    0.314409927f,  0.949287310f,
+    0.315137929f,  0.949045882f,
+    0.315865745f,  0.948803895f,
+    0.316593376f,  0.948561350f,
+    0.317320820f,  0.948318247f,
+    0.318048077f,  0.948074586f,
+    0.318775148f,  0.947830367f,
+    0.319502031f,  0.947585591f,
+    0.320228726f,  0.947340257f,
+    0.320955232f,  0.947094366f,
+    0.321681550f,  0.946847918f,
+    0.322407679f,  0.946600913f,
+    0.323133618f,  0.946353351f,
+    0.323859367f,  0.946105232f,
+    0.324584925f,  0.945856557f,
+    0.325310292f,  0.945607325f,
+    0.326035468f,  0.945357537f,
+    0.326760452f,  0.945107193f,
+    0.327485244f,  0.944856293f,
+    0.328209844f,  0.944604837f,
+    0.328934250f,  0.944352826f,
+    0.329658463f,  0.944100258f,
+    0.330382481f,  0.943847136f,
+    0.331106306f,  0.943593458f,
+    0.331829935f,  0.943339225f,
+    0.332553370f,  0.943084437f,
+    0.333276609f,  0.942829095f,
+    0.333999651f,  0.942573198f,
+    0.334722498f,  0.942316746f,
+    0.335445147f,  0.942059740f,
+    0.336167599f,  0.941802179f,
+    0.336889853f,  0.941544065f,
+    0.337611909f,  0.941285397f,
+    0.338333767f,  0.941026175f,
+    0.339055425f,  0.940766400f,
+    0.339776884f,  0.940506071f,
+    0.340498144f,  0.940245188f,
+    0.341219202f,  0.939983753f,
+    0.341940060f,  0.939721765f,
+    0.342660717f,  0.939459224f,
+    0.343381173f,  0.939196130f,
+    0.344101426f,  0.938932484f,
+    0.344821477f,  0.938668285f,
+    0.345541325f,  0.938403534f,
+    0.346260970f,  0.938138231f,
+    0.346980411f,  0.937872376f,
+    0.347699648f,  0.937605970f,
+    0.348418680f,  0.937339012f,
+    0.349137508f,  0.937071502f,
+    0.349856130f,  0.936803442f,
+    0.350574546f,  0.936534830f,
+    0.351292756f,  0.936265667f,
+    0.352010759f,  0.935995954f,
+    0.352728556f,  0.935725689f,
+    0.353446145f,  0.935454875f,
+    0.354163525f,  0.935183510f,
+    0.354880698f,  0.934911595f,
+    0.355597662f,  0.934639130f,
+    0.356314416f,  0.934366115f,
+    0.357030961f,  0.934092550f,
+    0.357747296f,  0.933818436f,
+    0.358463421f,  0.933543773f,
+    0.359179334f,  0.933268560f,
+    0.359895037f,  0.932992799f,
+    0.360610527f,  0.932716488f,
+    0.361325806f,  0.932439629f,
+    0.362040871f,  0.932162222f,
+    0.362755724f,  0.931884266f,
+    0.363470364f,  0.931605761f,
+    0.364184790f,  0.931326709f,
+    0.364899001f,  0.931047109f,
+    0.365612998f,  0.930766961f,
+    0.366326780f,  0.930486266f,
+    0.367040346f,  0.930205023f,
+    0.367753696f,  0.929923233f,
+    0.368466830f,  0.929640896f,
+    0.369179747f,  0.929358012f,
+    0.369892447f,  0.929074581f,
+    0.370604930f,  0.928790604f,
+    0.371317194f,  0.928506080f,
+    0.372029240f,  0.928221011f,
+    0.372741067f,  0.927935395f,
+    0.373452675f,  0.927649233f,
+    0.374164063f,  0.927362526f,
+    0.374875231f,  0.927075273f,
+    0.375586178f,  0.926787474f,
+    0.376296905f,  0.926499131f,
+    0.377007410f,  0.926210242f,
+    0.377717694f,  0.925920809f,
+    0.378427755f,  0.925630831f,
+    0.379137593f,  0.925340308f,
+    0.379847209f,  0.925049241f,
+    0.380556601f,  0.924757630f,
+    0.381265769f,  0.924465474f,
+    0.381974713f,  0.924172775f,
+    0.382683432f,  0.923879533f,
+    0.383391926f,  0.923585746f,
+    0.384100195f,  0.923291417f,
+    0.384808238f,  0.922996544f,
+    0.385516054f,  0.922701128f,
+    0.386223643f,  0.922405170f,
+    0.386931006f,  0.922108669f,
+    0.387638140f,  0.921811625f,
+    0.388345047f,  0.921514039f,
+    0.389051725f,  0.921215911f,
+    0.389758174f,  0.920917242f,
+    0.390464394f,  0.920618030f,
+    0.391170384f,  0.920318277f,
+    0.391876144f,  0.920017982f,
+    0.392581674f,  0.919717146f,
+    0.393286973f,  0.919415769f,
+    0.393992040f,  0.919113852f,
+    0.394696876f,  0.918811393f,
+    0.395401479f,  0.918508394f,
+    0.396105850f,  0.918204855f,
+    0.396809987f,  0.917900776f,
+    0.397513892f,  0.917596156f,
+    0.398217562f,  0.917290997f,
+    0.398920998f,  0.916985298f,
+    0.399624200f,  0.916679060f,
+    0.400327166f,  0.916372282f,
+    0.401029897f,  0.916064966f,
+    0.401732392f,  0.915757110f,
+    0.402434651f,  0.915448716f,
+    0.403136673f,  0.915139783f,
+    0.403838458f,  0.914830312f,
+    0.404540005f,  0.914520303f,
+    0.405241314f,  0.914209756f,
+    0.405942385f,  0.913898671f,
+    0.406643217f,  0.913587048f,
+    0.407343810f,  0.913274888f,
+    0.408044163f,  0.912962190f,
+    0.408744276f,  0.912648956f,
+    0.409444149f,  0.912335185f,
+    0.410143781f,  0.912020877f,
+    0.410843171f,  0.911706032f,
+    0.411542320f,  0.911390651f,
+    0.412241227f,  0.911074734f,
+    0.412939891f,  0.910758281f,
+    0.413638312f,  0.910441292f,
+    0.414336490f,  0.910123768f,
+    0.415034424f,  0.909805708f,
+    0.415732115f,  0.909487113f,
+    0.416429560f,  0.909167983f,
+    0.417126761f,  0.908848318f,
+    0.417823716f,  0.908528119f,
+    0.418520425f,  0.908207385f,
+    0.419216888f,  0.907886116f,
+    0.419913105f,  0.907564314f,
+    0.420609074f,  0.907241978f,
+    0.421304797f,  0.906919108f,
+    0.422000271f,  0.906595705f,
+    0.422695497f,  0.906271768f,
+    0.423390474f,  0.905947298f,
+    0.424085202f,  0.905622295f,
+    0.424779681f,  0.905296759f,
+    0.425473910f,  0.904970691f,
+    0.426167889f,  0.904644091f,
+    0.426861617f,  0.904316958f,
+    0.427555093f,  0.903989293f,
+    0.428248319f,  0.903661097f,
+    0.428941292f,  0.903332368f,
+    0.429634013f,  0.903003109f,
+    0.430326481f,  0.902673318f,
+    0.431018696f,  0.902342996f,
+    0.431710658f,  0.902012144f,
+    0.432402366f,  0.901680761f,
+    0.433093819f,  0.901348847f,
+    0.433785017f,  0.901016403f,
+    0.434475961f,  0.900683429f,
+    0.435166648f,  0.900349925f,
+    0.435857080f,  0.900015892f,
+    0.436547255f,  0.899681329f,
+    0.437237174f,  0.899346237f,
+    0.437926835f,  0.899010616f,
+    0.438616239f,  0.898674466f,
+    0.439305384f,  0.898337787f,
+    0.439994271f,  0.898000580f,
+    0.440682900f,  0.897662844f,
+    0.441371269f,  0.897324581f,
+    0.442059378f,  0.896985789f,
+    0.442747228f,  0.896646470f,
+    0.443434816f,  0.896306624f,
+    0.444122145f,  0.895966250f,
+    0.444809211f,  0.895625349f,
+    0.445496017f,  0.895283921f,
+    0.446182560f,  0.894941967f,
+    0.446868840f,  0.894599486f,
+    0.447554858f,  0.894256478f,
+    0.448240612f,  0.893912945f,
+    0.448926103f,  0.893568886f,
+    0.449611330f,  0.893224301f,
+    0.450296292f,  0.892879191f,
+    0.450980989f,  0.892533555f,
+    0.451665421f,  0.892187395f,
+    0.452349587f,  0.891840709f,
+    0.453033487f,  0.891493499f,
+    0.453717121f,  0.891145765f,
+    0.454400488f,  0.890797506f,
+    0.455083587f,  0.890448723f,
+    0.455766419f,  0.890099417f,
+    0.456448982f,  0.889749586f,
+    0.457131277f,  0.889399233f,
+    0.457813304f,  0.889048356f,
+    0.458495060f,  0.888696956f,
+    0.459176548f,  0.888345033f,
+    0.459857765f,  0.887992588f,
+    0.460538711f,  0.887639620f,
+    0.461219386f,  0.887286131f,
+    0.461899791f,  0.886932119f,
+    0.462579923f,  0.886577585f,
+    0.463259784f,  0.886222530f,
+    0.463939371f,  0.885866954f,
+    0.464618686f,  0.885510856f,
+    0.465297728f,  0.885154238f,
+    0.465976496f,  0.884797098f,
+    0.466654990f,  0.884439439f,
+    0.467333209f,  0.884081259f,
+    0.468011153f,  0.883722559f,
+    0.468688822f,  0.883363339f,
+    0.469366215f,  0.883003599f,
+    0.470043332f,  0.882643340f,
+    0.470720173f,  0.882282562f,
+    0.471396737f,  0.881921264f,
+    0.472073023f,  0.881559448f,
+    0.472749032f,  0.881197113f,
+    0.473424763f,  0.880834260f,
+    0.474100215f,  0.880470889f,
+    0.474775388f,  0.880107000f,
+    0.475450282f,  0.879742593f,
+    0.476124896f,  0.879377668f,
+    0.476799230f,  0.879012226f,
+    0.477473284f,  0.878646267f,
+    0.478147056f,  0.878279792f,
+    0.478820548f,  0.877912799f,
+    0.479493758f,  0.877545290f,
+    0.480166685f,  0.877177265f,
+    0.480839331f,  0.876808724f,
+    0.481511693f,  0.876439667f,
+    0.482183772f,  0.876070094f,
+    0.482855568f,  0.875700006f,
+    0.483527079f,  0.875329403f,
+    0.484198306f,  0.874958285f,
+    0.484869248f,  0.874586652f,
+    0.485539905f,  0.874214505f,
+    0.486210276f,  0.873841843f,
+    0.486880361f,  0.873468668f,
+    0.487550160f,  0.873094978f,
+    0.488219672f,  0.872720775f,
+    0.488888897f,  0.872346059f,
+    0.489557834f,  0.871970829f,
+    0.490226483f,  0.871595087f,
+    0.490894844f,  0.871218831f,
+    0.491562916f,  0.870842063f,
+    0.492230699f,  0.870464783f,
+    0.492898192f,  0.870086991f,
+    0.493565396f,  0.869708687f,
+    0.494232309f,  0.869329871f,
+    0.494898931f,  0.868950544f,
+    0.495565262f,  0.868570706f,
+    0.496231301f,  0.868190357f,
+    0.496897049f,  0.867809497f,
+    0.497562504f,  0.867428126f,
+    0.498227667f,  0.867046246f,
+    0.498892537f,  0.866663855f,
+    0.499557113f,  0.866280954f,
+    0.500221395f,  0.865897544f,
+    0.500885383f,  0.865513624f,
+    0.501549076f,  0.865129195f,
+    0.502212474f,  0.864744258f,
+    0.502875577f,  0.864358811f,
+    0.503538384f,  0.863972856f,
+    0.504200894f,  0.863586393f,
+    0.504863109f,  0.863199422f,
+    0.505525026f,  0.862811943f,
+    0.506186645f,  0.862423956f,
+    0.506847967f,  0.862035462f,
+    0.507508991f,  0.861646461f,
+    0.508169716f,  0.861256953f,
+    0.508830143f,  0.860866939f,
+    0.509490269f,  0.860476418f,
+    0.510150097f,  0.860085390f,
+    0.510809624f,  0.859693857f,
+    0.511468850f,  0.859301818f,
+    0.512127776f,  0.858909274f,
+    0.512786401f,  0.858516224f,
+    0.513444723f,  0.858122670f,
+    0.514102744f,  0.857728610f,
+    0.514760463f,  0.857334046f,
+    0.515417878f,  0.856938977f,
+    0.516074990f,  0.856543405f,
+    0.516731799f,  0.856147328f,
+    0.517388304f,  0.855750748f,
+    0.518044504f,  0.855353665f,
+    0.518700400f,  0.854956078f,
+    0.519355990f,  0.854557988f,
+    0.520011275f,  0.854159396f,
+    0.520666254f,  0.853760301f,
+    0.521320927f,  0.853360704f,
+    0.521975293f,  0.852960605f,
+    0.522629352f,  0.852560004f,
+    0.523283103f,  0.852158902f,
+    0.523936547f,  0.851757298f,
+    0.524589683f,  0.851355193f,
+    0.525242510f,  0.850952587f,
+    0.525895027f,  0.850549481f,
+    0.526547236f,  0.850145875f,
+    0.527199135f,  0.849741768f,
+    0.527850723f,  0.849337161f,
+    0.528502002f,  0.848932055f,
+    0.529152969f,  0.848526450f,
+    0.529803625f,  0.848120345f,
+    0.530453969f,  0.847713741f,
+    0.531104001f,  0.847306639f,
+    0.531753721f,  0.846899038f,
+    0.532403128f,  0.846490939f,
+    0.533052222f,  0.846082342f,
+    0.533701002f,  0.845673247f,
+    0.534349468f,  0.845263655f,
+    0.534997620f,  0.844853565f,
+    0.535645457f,  0.844442979f,
+    0.536292979f,  0.844031895f,
+    0.536940186f,  0.843620316f,
+    0.537587076f,  0.843208240f,
+    0.538233651f,  0.842795668f,
+    0.538879909f,  0.842382600f,
+    0.539525849f,  0.841969036f,
+    0.540171473f,  0.841554977f,
+    0.540816778f,  0.841140424f,
+    0.541461766f,  0.840725375f,
+    0.542106435f,  0.840309832f,
+    0.542750785f,  0.839893794f,
+    0.543394816f,  0.839477263f,
+    0.544038527f,  0.839060237f,
+    0.544681918f,  0.838642718f,
+    0.545324988f,  0.838224706f,
+    0.545967738f,  0.837806200f,
+    0.546610167f,  0.837387202f,
+    0.547252274f,  0.836967711f,
+    0.547894059f,  0.836547727f,
+    0.548535522f,  0.836127252f,
+    0.549176662f,  0.835706284f,
+    0.549817479f,  0.835284825f,
+    0.550457973f,  0.834862875f,
+    0.551098143f,  0.834440433f,
+    0.551737988f,  0.834017501f,
+    0.552377509f,  0.833594078f,
+    0.553016706f,  0.833170165f,
+    0.553655576f,  0.832745761f,
+    0.554294121f,  0.832320868f,
+    0.554932340f,  0.831895485f,
+    0.555570233f,  0.831469612f,
+    0.556207799f,  0.831043251f,
+    0.556845037f,  0.830616400f,
+    0.557481948f,  0.830189061f,
+    0.558118531f,  0.829761234f,
+    0.558754786f,  0.829332918f,
+    0.559390712f,  0.828904115f,
+    0.560026309f,  0.828474824f,
+    0.560661576f,  0.828045045f,
+    0.561296514f,  0.827614780f,
+    0.561931121f,  0.827184027f,
+    0.562565398f,  0.826752788f,
+    0.563199344f,  0.826321063f,
+    0.563832959f,  0.825888851f,
+    0.564466242f,  0.825456154f,
+    0.565099192f,  0.825022971f,
+    0.565731811f,  0.824589303f,
+    0.566364096f,  0.824155149f,
+    0.566996049f,  0.823720511f,
+    0.567627668f,  0.823285388f,
+    0.568258953f,  0.822849781f,
+    0.568889903f,  0.822413690f,
+    0.569520519f,  0.821977115f,
+    0.570150800f,  0.821540057f,
+    0.570780746f,  0.821102515f,
+    0.571410356f,  0.820664490f,
+    0.572039629f,  0.820225983f,
+    0.572668566f,  0.819786992f,
+    0.573297167f,  0.819347520f,
+    0.573925430f,  0.818907566f,
+    0.574553355f,  0.818467130f,
+    0.575180942f,  0.818026212f,
+    0.575808191f,  0.817584813f,
+    0.576435102f,  0.817142933f,
+    0.577061673f,  0.816700573f,
+    0.577687905f,  0.816257732f,
+    0.578313796f,  0.815814411f,
+    0.578939348f,  0.815370610f,
+    0.579564559f,  0.814926329f,
+    0.580189429f,  0.814481569f,
+    0.580813958f,  0.814036330f,
+    0.581438145f,  0.813590612f,
+    0.582061990f,  0.813144415f,
+    0.582685493f,  0.812697740f,
+    0.583308653f,  0.812250587f,
+    0.583931470f,  0.811802956f,
+    0.584553943f,  0.811354847f,
+    0.585176072f,  0.810906261f,
+    0.585797857f,  0.810457198f,
+    0.586419298f,  0.810007659f,
+    0.587040394f,  0.809557642f,
+    0.587661144f,  0.809107150f,
+    0.588281548f,  0.808656182f,
+    0.588901607f,  0.808204737f,
+    0.589521319f,  0.807752818f,
+    0.590140684f,  0.807300423f,
+    0.590759702f,  0.806847554f,
+    0.591378372f,  0.806394209f,
+    0.591996695f,  0.805940391f,
+    0.592614669f,  0.805486098f,
+    0.593232295f,  0.805031331f,
+    0.593849572f,  0.804576091f,
+    0.594466499f,  0.804120377f,
+    0.595083077f,  0.803664191f,
+    0.595699304f,  0.803207531f,
+    0.596315182f,  0.802750400f,
+    0.596930708f,  0.802292796f,
+    0.597545883f,  0.801834719f,
+    0.598160707f,  0.801376172f,
+    0.598775179f,  0.800917153f,
+    0.599389298f,  0.800457662f,
+    0.600003065f,  0.799997701f,
+    0.600616479f,  0.799537269f,
+    0.601229540f,  0.799076367f,
+    0.601842247f,  0.798614995f,
+    0.602454600f,  0.798153153f,
+    0.603066599f,  0.797690841f,
+    0.603678242f,  0.797228060f,
+    0.604289531f,  0.796764810f,
+    0.604900464f,  0.796301092f,
+    0.605511041f,  0.795836905f,
+    0.606121263f,  0.795372249f,
+    0.606731127f,  0.794907126f,
+    0.607340635f,  0.794441536f,
+    0.607949785f,  0.793975478f,
+    0.608558578f,  0.793508952f,
+    0.609167012f,  0.793041960f,
+    0.609775089f,  0.792574502f,
+    0.610382806f,  0.792106577f,
+    0.610990165f,  0.791638187f,
+    0.611597164f,  0.791169330f,
+    0.612203803f,  0.790700008f,
+    0.612810082f,  0.790230221f,
+    0.613416001f,  0.789759970f,
+    0.614021559f,  0.789289253f,
+    0.614626756f,  0.788818072f,
+    0.615231591f,  0.788346428f,
+    0.615836064f,  0.787874319f,
+    0.616440175f,  0.787401747f,
+    0.617043923f,  0.786928712f,
+    0.617647308f,  0.786455214f,
+    0.618250330f,  0.785981253f,
+    0.618852988f,  0.785506830f,
+    0.619455282f,  0.785031944f,
+    0.620057212f,  0.784556597f,
+    0.620658777f,  0.784080789f,
+    0.621259977f,  0.783604519f,
+    0.621860811f,  0.783127788f,
+    0.622461279f,  0.782650596f,
+    0.623061382f,  0.782172944f,
+    0.623661118f,  0.781694832f,
+    0.624260486f,  0.781216260f,
+    0.624859488f,  0.780737229f,
+    0.625458122f,  0.780257738f,
+    0.626056388f,  0.779777788f,
+    0.626654286f,  0.779297379f,
+    0.627251815f,  0.778816512f,
+    0.627848976f,  0.778335187f,
+    0.628445767f,  0.777853404f,
+    0.629042188f,  0.777371164f,
+    0.629638239f,  0.776888466f,
+    0.630233920f,  0.776405311f,
+    0.630829230f,  0.775921699f,
+    0.631424169f,  0.775437631f,
+    0.632018736f,  0.774953107f,
+    0.632612932f,  0.774468126f,
+    0.633206755f,  0.773982691f,
+    0.633800206f,  0.773496799f,
+    0.634393284f,  0.773010453f,
+    0.634985989f,  0.772523652f,
+    0.635578320f,  0.772036397f,
+    0.636170278f,  0.771548688f,
+    0.636761861f,  0.771060524f,
+    0.637353070f,  0.770571907f,
+    0.637943904f,  0.770082837f,
+    0.638534362f,  0.769593314f,
+    0.639124445f,  0.769103338f,
+    0.639714152f,  0.768612909f,
+    0.640303482f,  0.768122029f,
+    0.640892436f,  0.767630696f,
+    0.641481013f,  0.767138912f,
+    0.642069212f,  0.766646677f,
+    0.642657034f,  0.766153990f,
+    0.643244478f,  0.765660853f,
+    0.643831543f,  0.765167266f,
+    0.644418229f,  0.764673228f,
+    0.645004537f,  0.764178741f,
+    0.645590465f,  0.763683804f,
+    0.646176013f,  0.763188417f,
+    0.646761181f,  0.762692582f,
+    0.647345969f,  0.762196298f,
+    0.647930375f,  0.761699566f,
+    0.648514401f,  0.761202385f,
+    0.649098045f,  0.760704757f,
+    0.649681307f,  0.760206682f,
+    0.650264187f,  0.759708159f,
+    0.650846685f,  0.759209189f,
+    0.651428800f,  0.758709773f,
+    0.652010531f,  0.758209910f,
+    0.652591879f,  0.757709601f,
+    0.653172843f,  0.757208847f,
+    0.653753423f,  0.756707647f,
+    0.654333618f,  0.756206001f,
+    0.654913428f,  0.755703911f,
+    0.655492853f,  0.755201377f,
+    0.656071892f,  0.754698398f,
+    0.656650546f,  0.754194975f,
+    0.657228813f,  0.753691109f,
+    0.657806693f,  0.753186799f,
+    0.658384187f,  0.752682046f,
+    0.658961293f,  0.752176850f,
+    0.659538012f,  0.751671212f,
+    0.660114342f,  0.751165132f,
+    0.660690284f,  0.750658610f,
+    0.661265838f,  0.750151646f,
+    0.661841002f,  0.749644241f,
+    0.662415778f,  0.749136395f,
+    0.662990163f,  0.748628108f,
+    0.663564159f,  0.748119380f,
+    0.664137764f,  0.747610213f,
+    0.664710978f,  0.747100606f,
+    0.665283802f,  0.746590559f,
+    0.665856234f,  0.746080074f,
+    0.666428274f,  0.745569149f,
+    0.666999922f,  0.745057785f,
+    0.667571178f,  0.744545984f,
+    0.668142041f,  0.744033744f,
+    0.668712512f,  0.743521067f,
+    0.669282588f,  0.743007952f,
+    0.669852271f,  0.742494400f,
+    0.670421560f,  0.741980412f,
+    0.670990455f,  0.741465987f,
+    0.671558955f,  0.740951125f,
+    0.672127060f,  0.740435828f,
+    0.672694769f,  0.739920095f,
+    0.673262083f,  0.739403927f,
+    0.673829000f,  0.738887324f,
+    0.674395522f,  0.738370287f,
+    0.674961646f,  0.737852815f,
+    0.675527374f,  0.737334909f,
+    0.676092704f,  0.736816569f,
+    0.676657636f,  0.736297796f,
+    0.677222170f,  0.735778589f,
+    0.677786306f,  0.735258950f,
+    0.678350043f,  0.734738878f,
+    0.678913381f,  0.734218374f,
+    0.679476320f,  0.733697438f,
+    0.680038859f,  0.733176071f,
+    0.680600998f,  0.732654272f,
+    0.681162736f,  0.732132042f,
+    0.681724074f,  0.731609381f,
+    0.682285011f,  0.731086290f,
+    0.682845546f,  0.730562769f,
+    0.683405680f,  0.730038818f,
+    0.683965412f,  0.729514438f,
+    0.684524741f,  0.728989629f,
+    0.685083668f,  0.728464390f,
+    0.685642191f,  0.727938724f,
+    0.686200312f,  0.727412629f,
+    0.686758028f,  0.726886106f,
+    0.687315341f,  0.726359155f,
+    0.687872249f,  0.725831777f,
+    0.688428753f,  0.725303972f,
+    0.688984851f,  0.724775741f,
+    0.689540545f,  0.724247083f,
+    0.690095832f,  0.723717999f,
+    0.690650714f,  0.723188489f,
+    0.691205190f,  0.722658554f,
+    0.691759258f,  0.722128194f,
+    0.692312920f,  0.721597409f,
+    0.692866175f,  0.721066199f,
+    0.693419022f,  0.720534566f,
+    0.693971461f,  0.720002508f,
+    0.694523492f,  0.719470027f,
+    0.695075114f,  0.718937122f,
+    0.695626327f,  0.718403795f,
+    0.696177131f,  0.717870045f,
+    0.696727526f,  0.717335873f,
+    0.697277511f,  0.716801279f,
+    0.697827085f,  0.716266263f,
+    0.698376249f,  0.715730825f,
+    0.698925003f,  0.715194967f,
+    0.699473345f,  0.714658688f,
+    0.700021275f,  0.714121988f,
+    0.700568794f,  0.713584869f,
+    0.701115901f,  0.713047329f,
+    0.701662595f,  0.712509371f,
+    0.702208876f,  0.711970993f,
+    0.702754744f,  0.711432196f,
+    0.703300199f,  0.710892980f,
+    0.703845241f,  0.710353347f,
+    0.704389868f,  0.709813295f,
+    0.704934080f,  0.709272826f,
+    0.705477878f,  0.708731940f,
+    0.706021261f,  0.708190637f,
+    0.706564229f,  0.707648917f,
+    0.707106781f,  0.707106781f,
+    0.707648917f,  0.706564229f,
+    0.708190637f,  0.706021261f,
+    0.708731940f,  0.705477878f,
+    0.709272826f,  0.704934080f,
+    0.709813295f,  0.704389868f,
+    0.710353347f,  0.703845241f,
+    0.710892980f,  0.703300199f,
+    0.711432196f,  0.702754744f,
+    0.711970993f,  0.702208876f,
+    0.712509371f,  0.701662595f,
+    0.713047329f,  0.701115901f,
+    0.713584869f,  0.700568794f,
+    0.714121988f,  0.700021275f,
+    0.714658688f,  0.699473345f,
+    0.715194967f,  0.698925003f,
+    0.715730825f,  0.698376249f,
+    0.716266263f,  0.697827085f,
+    0.716801279f,  0.697277511f,
+    0.717335873f,  0.696727526f,
+    0.717870045f,  0.696177131f,
+    0.718403795f,  0.695626327f,
+    0.718937122f,  0.695075114f,
+    0.719470027f,  0.694523492f,
+    0.720002508f,  0.693971461f,
+    0.720534566f,  0.693419022f,
+    0.721066199f,  0.692866175f,
+    0.721597409f,  0.692312920f,
+    0.722128194f,  0.691759258f,
+    0.722658554f,  0.691205190f,
+    0.723188489f,  0.690650714f,
+    0.723717999f,  0.690095832f,
+    0.724247083f,  0.689540545f,
+    0.724775741f,  0.688984851f,
+    0.725303972f,  0.688428753f,
+    0.725831777f,  0.687872249f,
+    0.726359155f,  0.687315341f,
+    0.726886106f,  0.686758028f,
+    0.727412629f,  0.686200312f,
+    0.727938724f,  0.685642191f,
+    0.728464390f,  0.685083668f,
+    0.728989629f,  0.684524741f,
+    0.729514438f,  0.683965412f,
+    0.730038818f,  0.683405680f,
+    0.730562769f,  0.682845546f,
+    0.731086290f,  0.682285011f,
+    0.731609381f,  0.681724074f,
+    0.732132042f,  0.681162736f,
+    0.732654272f,  0.680600998f,
+    0.733176071f,  0.680038859f,
+    0.733697438f,  0.679476320f,
+    0.734218374f,  0.678913381f,
+    0.734738878f,  0.678350043f,
+    0.735258950f,  0.677786306f,
+    0.735778589f,  0.677222170f,
+    0.736297796f,  0.676657636f,
+    0.736816569f,  0.676092704f,
+    0.737334909f,  0.675527374f,
+    0.737852815f,  0.674961646f,
+    0.738370287f,  0.674395522f,
+    0.738887324f,  0.673829000f,
+    0.739403927f,  0.673262083f,
+    0.739920095f,  0.672694769f,
+    0.740435828f,  0.672127060f,
+    0.740951125f,  0.671558955f,
+    0.741465987f,  0.670990455f,
+    0.741980412f,  0.670421560f,
+    0.742494400f,  0.669852271f,
+    0.743007952f,  0.669282588f,
+    0.743521067f,  0.668712512f,
+    0.744033744f,  0.668142041f,
+    0.744545984f,  0.667571178f,
+    0.745057785f,  0.666999922f,
+    0.745569149f,  0.666428274f,
+    0.746080074f,  0.665856234f,
+    0.746590559f,  0.665283802f,
+    0.747100606f,  0.664710978f,
+    0.747610213f,  0.664137764f,
+    0.748119380f,  0.663564159f,
+    0.748628108f,  0.662990163f,
+    0.749136395f,  0.662415778f,
+    0.749644241f,  0.661841002f,
+    0.750151646f,  0.661265838f,
+    0.750658610f,  0.660690284f,
+    0.751165132f,  0.660114342f,
+    0.751671212f,  0.659538012f,
+    0.752176850f,  0.658961293f,
+    0.752682046f,  0.658384187f,
+    0.753186799f,  0.657806693f,
+    0.753691109f,  0.657228813f,
+    0.754194975f,  0.656650546f,
+    0.754698398f,  0.656071892f,
+    0.755201377f,  0.655492853f,
+    0.755703911f,  0.654913428f,
+    0.756206001f,  0.654333618f,
+    0.756707647f,  0.653753423f,
+    0.757208847f,  0.653172843f,
+    0.757709601f,  0.652591879f,
+    0.758209910f,  0.652010531f,
+    0.758709773f,  0.651428800f,
+    0.759209189f,  0.650846685f,
+    0.759708159f,  0.650264187f,
+    0.760206682f,  0.649681307f,
+    0.760704757f,  0.649098045f,
+    0.761202385f,  0.648514401f,
+    0.761699566f,  0.647930375f,
+    0.762196298f,  0.647345969f,
+    0.762692582f,  0.646761181f,
+    0.763188417f,  0.646176013f,
+    0.763683804f,  0.645590465f,
+    0.764178741f,  0.645004537f,
+    0.764673228f,  0.644418229f,
+    0.765167266f,  0.643831543f,
+    0.765660853f,  0.643244478f,
+    0.766153990f,  0.642657034f,
+    0.766646677f,  0.642069212f,
+    0.767138912f,  0.641481013f,
+    0.767630696f,  0.640892436f,
+    0.768122029f,  0.640303482f,
+    0.768612909f,  0.639714152f,
+    0.769103338f,  0.639124445f,
+    0.769593314f,  0.638534362f,
+    0.770082837f,  0.637943904f,
+    0.770571907f,  0.637353070f,
+    0.771060524f,  0.636761861f,
+    0.771548688f,  0.636170278f,
+    0.772036397f,  0.635578320f,
+    0.772523652f,  0.634985989f,
+    0.773010453f,  0.634393284f,
+    0.773496799f,  0.633800206f,
+    0.773982691f,  0.633206755f,
+    0.774468126f,  0.632612932f,
+    0.774953107f,  0.632018736f,
+    0.775437631f,  0.631424169f,
+    0.775921699f,  0.630829230f,
+    0.776405311f,  0.630233920f,
+    0.776888466f,  0.629638239f,
+    0.777371164f,  0.629042188f,
+    0.777853404f,  0.628445767f,
+    0.778335187f,  0.627848976f,
+    0.778816512f,  0.627251815f,
+    0.779297379f,  0.626654286f,
+    0.779777788f,  0.626056388f,
+    0.780257738f,  0.625458122f,
+    0.780737229f,  0.624859488f,
+    0.781216260f,  0.624260486f,
+    0.781694832f,  0.623661118f,
+    0.782172944f,  0.623061382f,
+    0.782650596f,  0.622461279f,
+    0.783127788f,  0.621860811f,
+    0.783604519f,  0.621259977f,
+    0.784080789f,  0.620658777f,
+    0.784556597f,  0.620057212f,
+    0.785031944f,  0.619455282f,
+    0.785506830f,  0.618852988f,
+    0.785981253f,  0.618250330f,
+    0.786455214f,  0.617647308f,
+    0.786928712f,  0.617043923f,
+    0.787401747f,  0.616440175f,
+    0.787874319f,  0.615836064f,
+    0.788346428f,  0.615231591f,
+    0.788818072f,  0.614626756f,
+    0.789289253f,  0.614021559f,
+    0.789759970f,  0.613416001f,
+    0.790230221f,  0.612810082f,
+    0.790700008f,  0.612203803f,
+    0.791169330f,  0.611597164f,
+    0.791638187f,  0.610990165f,
+    0.792106577f,  0.610382806f,
+    0.792574502f,  0.609775089f,
+    0.793041960f,  0.609167012f,
+    0.793508952f,  0.608558578f,
+    0.793975478f,  0.607949785f,
+    0.794441536f,  0.607340635f,
+    0.794907126f,  0.606731127f,
+    0.795372249f,  0.606121263f,
+    0.795836905f,  0.605511041f,
+    0.796301092f,  0.604900464f,
+    0.796764810f,  0.604289531f,
+    0.797228060f,  0.603678242f,
+    0.797690841f,  0.603066599f,
+    0.798153153f,  0.602454600f,
+    0.798614995f,  0.601842247f,
+    0.799076367f,  0.601229540f,
+    0.799537269f,  0.600616479f,
+    0.799997701f,  0.600003065f,
+    0.800457662f,  0.599389298f,
+    0.800917153f,  0.598775179f,
+    0.801376172f,  0.598160707f,
+    0.801834719f,  0.597545883f,
+    0.802292796f,  0.596930708f,
+    0.802750400f,  0.596315182f,
+    0.803207531f,  0.595699304f,
+    0.803664191f,  0.595083077f,
+    0.804120377f,  0.594466499f,
+    0.804576091f,  0.593849572f,
+    0.805031331f,  0.593232295f,
+    0.805486098f,  0.592614669f,
+    0.805940391f,  0.591996695f,
+    0.806394209f,  0.591378372f,
+    0.806847554f,  0.590759702f,
+    0.807300423f,  0.590140684f,
+    0.807752818f,  0.589521319f,
+    0.808204737f,  0.588901607f,
+    0.808656182f,  0.588281548f,
+    0.809107150f,  0.587661144f,
+    0.809557642f,  0.587040394f,
+    0.810007659f,  0.586419298f,
+    0.810457198f,  0.585797857f,
+    0.810906261f,  0.585176072f,
+    0.811354847f,  0.584553943f,
+    0.811802956f,  0.583931470f,
+    0.812250587f,  0.583308653f,
+    0.812697740f,  0.582685493f,
+    0.813144415f,  0.582061990f,
+    0.813590612f,  0.581438145f,
+    0.814036330f,  0.580813958f,
+    0.814481569f,  0.580189429f,
+    0.814926329f,  0.579564559f,
+    0.815370610f,  0.578939348f,
+    0.815814411f,  0.578313796f,
+    0.816257732f,  0.577687905f,
+    0.816700573f,  0.577061673f,
+    0.817142933f,  0.576435102f,
+    0.817584813f,  0.575808191f,
+    0.818026212f,  0.575180942f,
+    0.818467130f,  0.574553355f,
+    0.818907566f,  0.573925430f,
+    0.819347520f,  0.573297167f,
+    0.819786992f,  0.572668566f,
+    0.820225983f,  0.572039629f,
+    0.820664490f,  0.571410356f,
+    0.821102515f,  0.570780746f,
+    0.821540057f,  0.570150800f,
+    0.821977115f,  0.569520519f,
+    0.822413690f,  0.568889903f,
+    0.822849781f,  0.568258953f,
+    0.823285388f,  0.567627668f,
+    0.823720511f,  0.566996049f,
+    0.824155149f,  0.566364096f,
+    0.824589303f,  0.565731811f,
+    0.825022971f,  0.565099192f,
+    0.825456154f,  0.564466242f,
+    0.825888851f,  0.563832959f,
+    0.826321063f,  0.563199344f,
+    0.826752788f,  0.562565398f,
+    0.827184027f,  0.561931121f,
+    0.827614780f,  0.561296514f,
+    0.828045045f,  0.560661576f,
+    0.828474824f,  0.560026309f,
+    0.828904115f,  0.559390712f,
+    0.829332918f,  0.558754786f,
+    0.829761234f,  0.558118531f,
+    0.830189061f,  0.557481948f,
+    0.830616400f,  0.556845037f,
+    0.831043251f,  0.556207799f,
+    0.831469612f,  0.555570233f,
+    0.831895485f,  0.554932340f,
+    0.832320868f,  0.554294121f,
+    0.832745761f,  0.553655576f,
+    0.833170165f,  0.553016706f,
+    0.833594078f,  0.552377509f,
+    0.834017501f,  0.551737988f,
+    0.834440433f,  0.551098143f,
+    0.834862875f,  0.550457973f,
+    0.835284825f,  0.549817479f,
+    0.835706284f,  0.549176662f,
+    0.836127252f,  0.548535522f,
+    0.836547727f,  0.547894059f,
+    0.836967711f,  0.547252274f,
+    0.837387202f,  0.546610167f,
+    0.837806200f,  0.545967738f,
+    0.838224706f,  0.545324988f,
+    0.838642718f,  0.544681918f,
+    0.839060237f,  0.544038527f,
+    0.839477263f,  0.543394816f,
+    0.839893794f,  0.542750785f,
+    0.840309832f,  0.542106435f,
+    0.840725375f,  0.541461766f,
+    0.841140424f,  0.540816778f,
+    0.841554977f,  0.540171473f,
+    0.841969036f,  0.539525849f,
+    0.842382600f,  0.538879909f,
+    0.842795668f,  0.538233651f,
+    0.843208240f,  0.537587076f,
+    0.843620316f,  0.536940186f,
+    0.844031895f,  0.536292979f,
+    0.844442979f,  0.535645457f,
+    0.844853565f,  0.534997620f,
+    0.845263655f,  0.534349468f,
+    0.845673247f,  0.533701002f,
+    0.846082342f,  0.533052222f,
+    0.846490939f,  0.532403128f,
+    0.846899038f,  0.531753721f,
+    0.847306639f,  0.531104001f,
+    0.847713741f,  0.530453969f,
+    0.848120345f,  0.529803625f,
+    0.848526450f,  0.529152969f,
+    0.848932055f,  0.528502002f,
+    0.849337161f,  0.527850723f,
+    0.849741768f,  0.527199135f,
+    0.850145875f,  0.526547236f,
+    0.850549481f,  0.525895027f,
+    0.850952587f,  0.525242510f,
+    0.851355193f,  0.524589683f,
+    0.851757298f,  0.523936547f,
+    0.852158902f,  0.523283103f,
+    0.852560004f,  0.522629352f,
+    0.852960605f,  0.521975293f,
+    0.853360704f,  0.521320927f,
+    0.853760301f,  0.520666254f,
+    0.854159396f,  0.520011275f,
+    0.854557988f,  0.519355990f,
+    0.854956078f,  0.518700400f,
+    0.855353665f,  0.518044504f,
+    0.855750748f,  0.517388304f,
+    0.856147328f,  0.516731799f,
+    0.856543405f,  0.516074990f,
+    0.856938977f,  0.515417878f,
+    0.857334046f,  0.514760463f,
+    0.857728610f,  0.514102744f,
+    0.858122670f,  0.513444723f,
+    0.858516224f,  0.512786401f,
+    0.858909274f,  0.512127776f,
+    0.859301818f,  0.511468850f,
+    0.859693857f,  0.510809624f,
+    0.860085390f,  0.510150097f,
+    0.860476418f,  0.509490269f,
+    0.860866939f,  0.508830143f,
+    0.861256953f,  0.508169716f,
+    0.861646461f,  0.507508991f,
+    0.862035462f,  0.506847967f,
+    0.862423956f,  0.506186645f,
+    0.862811943f,  0.505525026f,
+    0.863199422f,  0.504863109f,
+    0.863586393f,  0.504200894f,
+    0.863972856f,  0.503538384f,
+    0.864358811f,  0.502875577f,
+    0.864744258f,  0.502212474f,
+    0.865129195f,  0.501549076f,
+    0.865513624f,  0.500885383f,
+    0.865897544f,  0.500221395f,
+    0.866280954f,  0.499557113f,
+    0.866663855f,  0.498892537f,
+    0.867046246f,  0.498227667f,
+    0.867428126f,  0.497562504f,
+    0.867809497f,  0.496897049f,
+    0.868190357f,  0.496231301f,
+    0.868570706f,  0.495565262f,
+    0.868950544f,  0.494898931f,
+    0.869329871f,  0.494232309f,
+    0.869708687f,  0.493565396f,
+    0.870086991f,  0.492898192f,
+    0.870464783f,  0.492230699f,
+    0.870842063f,  0.491562916f,
+    0.871218831f,  0.490894844f,
+    0.871595087f,  0.490226483f,
+    0.871970829f,  0.489557834f,
+    0.872346059f,  0.488888897f,
+    0.872720775f,  0.488219672f,
+    0.873094978f,  0.487550160f,
+    0.873468668f,  0.486880361f,
+    0.873841843f,  0.486210276f,
+    0.874214505f,  0.485539905f,
+    0.874586652f,  0.484869248f,
+    0.874958285f,  0.484198306f,
+    0.875329403f,  0.483527079f,
+    0.875700006f,  0.482855568f,
+    0.876070094f,  0.482183772f,
+    0.876439667f,  0.481511693f,
+    0.876808724f,  0.480839331f,
+    0.877177265f,  0.480166685f,
+    0.877545290f,  0.479493758f,
+    0.877912799f,  0.478820548f,
+    0.878279792f,  0.478147056f,
+    0.878646267f,  0.477473284f,
+    0.879012226f,  0.476799230f,
+    0.879377668f,  0.476124896f,
+    0.879742593f,  0.475450282f,
+    0.880107000f,  0.474775388f,
+    0.880470889f,  0.474100215f,
+    0.880834260f,  0.473424763f,
+    0.881197113f,  0.472749032f,
+    0.881559448f,  0.472073023f,
+    0.881921264f,  0.471396737f,
+    0.882282562f,  0.470720173f,
+    0.882643340f,  0.470043332f,
+    0.883003599f,  0.469366215f,
+    0.883363339f,  0.468688822f,
+    0.883722559f,  0.468011153f,
+    0.884081259f,  0.467333209f,
+    0.884439439f,  0.466654990f,
+    0.884797098f,  0.465976496f,
+    0.885154238f,  0.465297728f,
+    0.885510856f,  0.464618686f,
+    0.885866954f,  0.463939371f,
+    0.886222530f,  0.463259784f,
+    0.886577585f,  0.462579923f,
+    0.886932119f,  0.461899791f,
+    0.887286131f,  0.461219386f,
+    0.887639620f,  0.460538711f,
+    0.887992588f,  0.459857765f,
+    0.888345033f,  0.459176548f,
+    0.888696956f,  0.458495060f,
+    0.889048356f,  0.457813304f,
+    0.889399233f,  0.457131277f,
+    0.889749586f,  0.456448982f,
+    0.890099417f,  0.455766419f,
+    0.890448723f,  0.455083587f,
+    0.890797506f,  0.454400488f,
+    0.891145765f,  0.453717121f,
+    0.891493499f,  0.453033487f,
+    0.891840709f,  0.452349587f,
+    0.892187395f,  0.451665421f,
+    0.892533555f,  0.450980989f,
+    0.892879191f,  0.450296292f,
+    0.893224301f,  0.449611330f,
+    0.893568886f,  0.448926103f,
+    0.893912945f,  0.448240612f,
+    0.894256478f,  0.447554858f,
+    0.894599486f,  0.446868840f,
+    0.894941967f,  0.446182560f,
+    0.895283921f,  0.445496017f,
+    0.895625349f,  0.444809211f,
+    0.895966250f,  0.444122145f,
+    0.896306624f,  0.443434816f,
+    0.896646470f,  0.442747228f,
+    0.896985789f,  0.442059378f,
+    0.897324581f,  0.441371269f,
+    0.897662844f,  0.440682900f,
+    0.898000580f,  0.439994271f,
+    0.898337787f,  0.439305384f,
+    0.898674466f,  0.438616239f,
+    0.899010616f,  0.437926835f,
+    0.899346237f,  0.437237174f,
+    0.899681329f,  0.436547255f,
+    0.900015892f,  0.435857080f,
+    0.900349925f,  0.435166648f,
+    0.900683429f,  0.434475961f,
+    0.901016403f,  0.433785017f,
+    0.901348847f,  0.433093819f,
+    0.901680761f,  0.432402366f,
+    0.902012144f,  0.431710658f,
+    0.902342996f,  0.431018696f,
+    0.902673318f,  0.430326481f,
+    0.903003109f,  0.429634013f,
+    0.903332368f,  0.428941292f,
+    0.903661097f,  0.428248319f,
+    0.903989293f,  0.427555093f,
+    0.904316958f,  0.426861617f,
+    0.904644091f,  0.426167889f,
+    0.904970691f,  0.425473910f,
+    0.905296759f,  0.424779681f,
+    0.905622295f,  0.424085202f,
+    0.905947298f,  0.423390474f,
+    0.906271768f,  0.422695497f,
+    0.906595705f,  0.422000271f,
+    0.906919108f,  0.421304797f,
+    0.907241978f,  0.420609074f,
+    0.907564314f,  0.419913105f,
+    0.907886116f,  0.419216888f,
+    0.908207385f,  0.418520425f,
+    0.908528119f,  0.417823716f,
+    0.908848318f,  0.417126761f,
+    0.909167983f,  0.416429560f,
+    0.909487113f,  0.415732115f,
+    0.909805708f,  0.415034424f,
+    0.910123768f,  0.414336490f,
+    0.910441292f,  0.413638312f,
+    0.910758281f,  0.412939891f,
+    0.911074734f,  0.412241227f,
+    0.911390651f,  0.411542320f,
+    0.911706032f,  0.410843171f,
+    0.912020877f,  0.410143781f,
+    0.912335185f,  0.409444149f,
+    0.912648956f,  0.408744276f,
+    0.912962190f,  0.408044163f,
+    0.913274888f,  0.407343810f,
+    0.913587048f,  0.406643217f,
+    0.913898671f,  0.405942385f,
+    0.914209756f,  0.405241314f,
+    0.914520303f,  0.404540005f,
+    0.914830312f,  0.403838458f,
+    0.915139783f,  0.403136673f,
+    0.915448716f,  0.402434651f,
+    0.915757110f,  0.401732392f,
+    0.916064966f,  0.401029897f,
+    0.916372282f,  0.400327166f,
+    0.916679060f,  0.399624200f,
+    0.916985298f,  0.398920998f,
+    0.917290997f,  0.398217562f,
+    0.917596156f,  0.397513892f,
+    0.917900776f,  0.396809987f,
+    0.918204855f,  0.396105850f,
+    0.918508394f,  0.395401479f,
+    0.918811393f,  0.394696876f,
+    0.919113852f,  0.393992040f,
+    0.919415769f,  0.393286973f,
+    0.919717146f,  0.392581674f,
+    0.920017982f,  0.391876144f,
+    0.920318277f,  0.391170384f,
+    0.920618030f,  0.390464394f,
+    0.920917242f,  0.389758174f,
+    0.921215911f,  0.389051725f,
+    0.921514039f,  0.388345047f,
+    0.921811625f,  0.387638140f,
+    0.922108669f,  0.386931006f,
+    0.922405170f,  0.386223643f,
+    0.922701128f,  0.385516054f,
+    0.922996544f,  0.384808238f,
+    0.923291417f,  0.384100195f,
+    0.923585746f,  0.383391926f,
+    0.923879533f,  0.382683432f,
+    0.924172775f,  0.381974713f,
+    0.924465474f,  0.381265769f,
+    0.924757630f,  0.380556601f,
+    0.925049241f,  0.379847209f,
+    0.925340308f,  0.379137593f,
+    0.925630831f,  0.378427755f,
+    0.925920809f,  0.377717694f,
+    0.926210242f,  0.377007410f,
+    0.926499131f,  0.376296905f,
+    0.926787474f,  0.375586178f,
+    0.927075273f,  0.374875231f,
+    0.927362526f,  0.374164063f,
+    0.927649233f,  0.373452675f,
+    0.927935395f,  0.372741067f,
+    0.928221011f,  0.372029240f,
+    0.928506080f,  0.371317194f,
+    0.928790604f,  0.370604930f,
+    0.929074581f,  0.369892447f,
+    0.929358012f,  0.369179747f,
+    0.929640896f,  0.368466830f,
+    0.929923233f,  0.367753696f,
+    0.930205023f,  0.367040346f,
+    0.930486266f,  0.366326780f,
+    0.930766961f,  0.365612998f,
+    0.931047109f,  0.364899001f,
+    0.931326709f,  0.364184790f,
+    0.931605761f,  0.363470364f,
+    0.931884266f,  0.362755724f,
+    0.932162222f,  0.362040871f,
+    0.932439629f,  0.361325806f,
+    0.932716488f,  0.360610527f,
+    0.932992799f,  0.359895037f,
+    0.933268560f,  0.359179334f,
+    0.933543773f,  0.358463421f,
+    0.933818436f,  0.357747296f,
+    0.934092550f,  0.357030961f,
+    0.934366115f,  0.356314416f,
+    0.934639130f,  0.355597662f,
+    0.934911595f,  0.354880698f,
+    0.935183510f,  0.354163525f,
+    0.935454875f,  0.353446145f,
+    0.935725689f,  0.352728556f,
+    0.935995954f,  0.352010759f,
+    0.936265667f,  0.351292756f,
+    0.936534830f,  0.350574546f,
+    0.936803442f,  0.349856130f,
+    0.937071502f,  0.349137508f,
+    0.937339012f,  0.348418680f,
+    0.937605970f,  0.347699648f,
+    0.937872376f,  0.346980411f,
+    0.938138231f,  0.346260970f,
+    0.938403534f,  0.345541325f,
+    0.938668285f,  0.344821477f,
+    0.938932484f,  0.344101426f,
+    0.939196130f,  0.343381173f,
+    0.939459224f,  0.342660717f,
+    0.939721765f,  0.341940060f,
+    0.939983753f,  0.341219202f,
+    0.940245188f,  0.340498144f,
+    0.940506071f,  0.339776884f,
+    0.940766400f,  0.339055425f,
+    0.941026175f,  0.338333767f,
+    0.941285397f,  0.337611909f,
+    0.941544065f,  0.336889853f,
+    0.941802179f,  0.336167599f,
+    0.942059740f,  0.335445147f,
+    0.942316746f,  0.334722498f,
+    0.942573198f,  0.333999651f,
+    0.942829095f,  0.333276609f,
+    0.943084437f,  0.332553370f,
+    0.943339225f,  0.331829935f,
+    0.943593458f,  0.331106306f,
+    0.943847136f,  0.330382481f,
+    0.944100258f,  0.329658463f,
+    0.944352826f,  0.328934250f,
+    0.944604837f,  0.328209844f,
+    0.944856293f,  0.327485244f,
+    0.945107193f,  0.326760452f,
+    0.945357537f,  0.326035468f,
+    0.945607325f,  0.325310292f,
+    0.945856557f,  0.324584925f,
+    0.946105232f,  0.323859367f,
+    0.946353351f,  0.323133618f,
+    0.946600913f,  0.322407679f,
+    0.946847918f,  0.321681550f,
+    0.947094366f,  0.320955232f,
+    0.947340257f,  0.320228726f,
+    0.947585591f,  0.319502031f,
+    0.947830367f,  0.318775148f,
+    0.948074586f,  0.318048077f,
+    0.948318247f,  0.317320820f,
+    0.948561350f,  0.316593376f,
+    0.948803895f,  0.315865745f,
+    0.949045882f,  0.315137929f,
+    0.949287310f,  0.314409927f,
+    0.949528181f,  0.313681740f,
+    0.949768492f,  0.312953369f,
+    0.950008245f,  0.312224814f,
+    0.950247439f,  0.311496075f,
+    0.950486074f,  0.310767153f,
+    0.950724150f,  0.310038048f,
+    0.950961666f,  0.309308760f,
+    0.951198623f,  0.308579291f,
+    0.951435021f,  0.307849640f,
+    0.951670859f,  0.307119808f,
+    0.951906137f,  0.306389795f,
+    0.952140855f,  0.305659602f,
+    0.952375013f,  0.304929230f,
+    0.952608610f,  0.304198678f,
+    0.952841648f,  0.303467947f,
+    0.953074124f,  0.302737037f,
+    0.953306040f,  0.302005949f,
+    0.953537396f,  0.301274684f,
+    0.953768190f,  0.300543241f,
+    0.953998423f,  0.299811622f,
+    0.954228095f,  0.299079826f,
+    0.954457206f,  0.298347855f,
+    0.954685755f,  0.297615707f,
+    0.954913742f,  0.296883385f,
+    0.955141168f,  0.296150888f,
+    0.955368032f,  0.295418217f,
+    0.955594334f,  0.294685372f,
+    0.955820074f,  0.293952354f,
+    0.956045251f,  0.293219163f,
+    0.956269866f,  0.292485799f,
+    0.956493919f,  0.291752263f,
+    0.956717409f,  0.291018556f,
+    0.956940336f,  0.290284677f,
+    0.957162700f,  0.289550628f,
+    0.957384501f,  0.288816408f,
+    0.957605739f,  0.288082019f,
+    0.957826413f,  0.287347460f,
+    0.958046524f,  0.286612731f,
+    0.958266071f,  0.285877835f,
+    0.958485055f,  0.285142770f,
+    0.958703475f,  0.284407537f,
+    0.958921331f,  0.283672137f,
+    0.959138622f,  0.282936570f,
+    0.959355350f,  0.282200837f,
+    0.959571513f,  0.281464938f,
+    0.959787112f,  0.280728873f,
+    0.960002146f,  0.279992643f,
+    0.960216615f,  0.279256248f,
+    0.960430519f,  0.278519689f,
+    0.960643859f,  0.277782967f,
+    0.960856633f,  0.277046080f,
+    0.961068842f,  0.276309031f,
+    0.961280486f,  0.275571819f,
+    0.961491564f,  0.274834445f,
+    0.961702077f,  0.274096910f,
+    0.961912023f,  0.273359213f,
+    0.962121404f,  0.272621355f,
+    0.962330219f,  0.271883337f,
+    0.962538468f,  0.271145160f,
+    0.962746151f,  0.270406822f,
+    0.962953267f,  0.269668326f,
+    0.963159817f,  0.268929670f,
+    0.963365800f,  0.268190857f,
+    0.963571216f,  0.267451886f,
+    0.963776066f,  0.266712757f,
+    0.963980348f,  0.265973472f,
+    0.964184064f,  0.265234030f,
+    0.964387212f,  0.264494432f,
+    0.964589793f,  0.263754679f,
+    0.964791807f,  0.263014770f,
+    0.964993253f,  0.262274707f,
+    0.965194131f,  0.261534489f,
+    0.965394442f,  0.260794118f,
+    0.965594184f,  0.260053593f,
+    0.965793359f,  0.259312915f,
+    0.965991965f,  0.258572085f,
+    0.966190003f,  0.257831102f,
+    0.966387473f,  0.257089968f,
+    0.966584374f,  0.256348682f,
+    0.966780707f,  0.255607246f,
+    0.966976471f,  0.254865660f,
+    0.967171666f,  0.254123923f,
+    0.967366292f,  0.253382037f,
+    0.967560349f,  0.252640002f,
+    0.967753837f,  0.251897818f,
+    0.967946756f,  0.251155486f,
+    0.968139105f,  0.250413007f,
+    0.968330884f,  0.249670380f,
+    0.968522094f,  0.248927606f,
+    0.968712734f,  0.248184685f,
+    0.968902805f,  0.247441619f,
+    0.969092305f,  0.246698407f,
+    0.969281235f,  0.245955050f,
+    0.969469595f,  0.245211549f,
+    0.969657385f,  0.244467903f,
+    0.969844604f,  0.243724113f,
+    0.970031253f,  0.242980180f,
+    0.970217331f,  0.242236104f,
+    0.970402839f,  0.241491885f,
+    0.970587775f,  0.240747525f,
+    0.970772141f,  0.240003022f,
+    0.970955935f,  0.239258379f,
+    0.971139158f,  0.238513595f,
+    0.971321810f,  0.237768670f,
+    0.971503891f,  0.237023606f,
+    0.971685400f,  0.236278402f,
+    0.971866337f,  0.235533059f,
+    0.972046703f,  0.234787578f,
+    0.972226497f,  0.234041959f,
+    0.972405719f,  0.233296201f,
+    0.972584369f,  0.232550307f,
+    0.972762447f,  0.231804276f,
+    0.972939952f,  0.231058108f,
+    0.973116885f,  0.230311805f,
+    0.973293246f,  0.229565366f,
+    0.973469034f,  0.228818792f,
+    0.973644250f,  0.228072083f,
+    0.973818892f,  0.227325240f,
+    0.973992962f,  0.226578264f,
+    0.974166459f,  0.225831154f,
+    0.974339383f,  0.225083911f,
+    0.974511733f,  0.224336536f,
+    0.974683511f,  0.223589029f,
+    0.974854715f,  0.222841391f,
+    0.975025345f,  0.222093621f,
+    0.975195402f,  0.221345721f,
+    0.975364885f,  0.220597690f,
+    0.975533795f,  0.219849530f,
+    0.975702130f,  0.219101240f,
+    0.975869892f,  0.218352822f,
+    0.976037079f,  0.217604275f,
+    0.976203692f,  0.216855600f,
+    0.976369731f,  0.216106797f,
+    0.976535196f,  0.215357867f,
+    0.976700086f,  0.214608811f,
+    0.976864402f,  0.213859628f,
+    0.977028143f,  0.213110320f,
+    0.977191309f,  0.212360886f,
+    0.977353900f,  0.211611327f,
+    0.977515917f,  0.210861644f,
+    0.977677358f,  0.210111837f,
+    0.977838224f,  0.209361906f,
+    0.977998515f,  0.208611852f,
+    0.978158231f,  0.207861675f,
+    0.978317371f,  0.207111376f,
+    0.978475935f,  0.206360955f,
+    0.978633924f,  0.205610413f,
+    0.978791338f,  0.204859750f,
+    0.978948175f,  0.204108966f,
+    0.979104437f,  0.203358062f,
+    0.979260123f,  0.202607039f,
+    0.979415232f,  0.201855896f,
+    0.979569766f,  0.201104635f,
+    0.979723723f,  0.200353255f,
+    0.979877104f,  0.199601758f,
+    0.980029908f,  0.198850143f,
+    0.980182136f,  0.198098411f,
+    0.980333787f,  0.197346562f,
+    0.980484862f,  0.196594598f,
+    0.980635360f,  0.195842517f,
+    0.980785280f,  0.195090322f,
+    0.980934624f,  0.194338012f,
+    0.981083391f,  0.193585587f,
+    0.981231581f,  0.192833049f,
+    0.981379193f,  0.192080397f,
+    0.981526228f,  0.191327632f,
+    0.981672686f,  0.190574755f,
+    0.981818566f,  0.189821765f,
+    0.981963869f,  0.189068664f,
+    0.982108594f,  0.188315452f,
+    0.982252741f,  0.187562129f,
+    0.982396311f,  0.186808695f,
+    0.982539302f,  0.186055152f,
+    0.982681716f,  0.185301499f,
+    0.982823551f,  0.184547737f,
+    0.982964808f,  0.183793867f,
+    0.983105487f,  0.183039888f,
+    0.983245588f,  0.182285802f,
+    0.983385110f,  0.181531608f,
+    0.983524054f,  0.180777308f,
+    0.983662419f,  0.180022901f,
+    0.983800206f,  0.179268389f,
+    0.983937413f,  0.178513771f,
+    0.984074042f,  0.177759048f,
+    0.984210092f,  0.177004220f,
+    0.984345563f,  0.176249289f,
+    0.984480455f,  0.175494253f,
+    0.984614768f,  0.174739115f,
+    0.984748502f,  0.173983873f,
+    0.984881656f,  0.173228530f,
+    0.985014231f,  0.172473084f,
+    0.985146226f,  0.171717537f,
+    0.985277642f,  0.170961889f,
+    0.985408479f,  0.170206140f,
+    0.985538735f,  0.169450291f,
+    0.985668412f,  0.168694343f,
+    0.985797509f,  0.167938295f,
+    0.985926026f,  0.167182148f,
+    0.986053963f,  0.166425904f,
+    0.986181320f,  0.165669561f,
+    0.986308097f,  0.164913120f,
+    0.986434294f,  0.164156583f,
+    0.986559910f,  0.163399949f,
+    0.986684946f,  0.162643219f,
+    0.986809402f,  0.161886394f,
+    0.986933277f,  0.161129473f,
+    0.987056571f,  0.160372457f,
+    0.987179285f,  0.159615347f,
+    0.987301418f,  0.158858143f,
+    0.987422970f,  0.158100846f,
+    0.987543942f,  0.157343456f,
+    0.987664332f,  0.156585973f,
+    0.987784142f,  0.155828398f,
+    0.987903370f,  0.155070731f,
+    0.988022017f,  0.154312973f,
+    0.988140083f,  0.153555124f,
+    0.988257568f,  0.152797185f,
+    0.988374471f,  0.152039156f,
+    0.988490793f,  0.151281038f,
+    0.988606533f,  0.150522831f,
+    0.988721692f,  0.149764535f,
+    0.988836269f,  0.149006151f,
+    0.988950265f,  0.148247679f,
+    0.989063678f,  0.147489120f,
+    0.989176510f,  0.146730474f,
+    0.989288760f,  0.145971742f,
+    0.989400428f,  0.145212925f,
+    0.989511514f,  0.144454021f,
+    0.989622017f,  0.143695033f,
+    0.989731939f,  0.142935960f,
+    0.989841278f,  0.142176804f,
+    0.989950036f,  0.141417563f,
+    0.990058210f,  0.140658239f,
+    0.990165803f,  0.139898833f,
+    0.990272812f,  0.139139344f,
+    0.990379240f,  0.138379774f,
+    0.990485084f,  0.137620122f,
+    0.990590346f,  0.136860389f,
+    0.990695025f,  0.136100575f,
+    0.990799122f,  0.135340682f,
+    0.990902635f,  0.134580709f,
+    0.991005566f,  0.133820656f,
+    0.991107914f,  0.133060525f,
+    0.991209678f,  0.132300316f,
+    0.991310860f,  0.131540029f,
+    0.991411458f,  0.130779664f,
+    0.991511473f,  0.130019223f,
+    0.991610905f,  0.129258705f,
+    0.991709754f,  0.128498111f,
+    0.991808019f,  0.127737441f,
+    0.991905700f,  0.126976696f,
+    0.992002799f,  0.126215877f,
+    0.992099313f,  0.125454983f,
+    0.992195244f,  0.124694016f,
+    0.992290591f,  0.123932975f,
+    0.992385355f,  0.123171861f,
+    0.992479535f,  0.122410675f,
+    0.992573130f,  0.121649417f,
+    0.992666142f,  0.120888087f,
+    0.992758570f,  0.120126686f,
+    0.992850414f,  0.119365215f,
+    0.992941674f,  0.118603673f,
+    0.993032350f,  0.117842062f,
+    0.993122442f,  0.117080381f,
+    0.993211949f,  0.116318631f,
+    0.993300872f,  0.115556813f,
+    0.993389211f,  0.114794927f,
+    0.993476966f,  0.114032973f,
+    0.993564136f,  0.113270952f,
+    0.993650721f,  0.112508865f,
+    0.993736722f,  0.111746711f,
+    0.993822138f,  0.110984492f,
+    0.993906970f,  0.110222207f,
+    0.993991217f,  0.109459858f,
+    0.994074879f,  0.108697444f,
+    0.994157957f,  0.107934966f,
+    0.994240449f,  0.107172425f,
+    0.994322357f,  0.106409821f,
+    0.994403680f,  0.105647154f,
+    0.994484418f,  0.104884425f,
+    0.994564571f,  0.104121634f,
+    0.994644138f,  0.103358782f,
+    0.994723121f,  0.102595869f,
+    0.994801519f,  0.101832896f,
+    0.994879331f,  0.101069863f,
+    0.994956558f,  0.100306770f,
+    0.995033199f,  0.099543619f,
+    0.995109256f,  0.098780409f,
+    0.995184727f,  0.098017140f,
+    0.995259612f,  0.097253814f,
+    0.995333912f,  0.096490431f,
+    0.995407627f,  0.095726991f,
+    0.995480755f,  0.094963495f,
+    0.995553299f,  0.094199943f,
+    0.995625256f,  0.093436336f,
+    0.995696628f,  0.092672673f,
+    0.995767414f,  0.091908956f,
+    0.995837615f,  0.091145185f,
+    0.995907229f,  0.090381361f,
+    0.995976258f,  0.089617483f,
+    0.996044701f,  0.088853553f,
+    0.996112558f,  0.088089570f,
+    0.996179829f,  0.087325535f,
+    0.996246513f,  0.086561449f,
+    0.996312612f,  0.085797312f,
+    0.996378125f,  0.085033125f,
+    0.996443051f,  0.084268888f,
+    0.996507392f,  0.083504601f,
+    0.996571146f,  0.082740265f,
+    0.996634314f,  0.081975880f,
+    0.996696895f,  0.081211447f,
+    0.996758890f,  0.080446966f,
+    0.996820299f,  0.079682438f,
+    0.996881122f,  0.078917863f,
+    0.996941358f,  0.078153242f,
+    0.997001007f,  0.077388574f,
+    0.997060070f,  0.076623861f,
+    0.997118547f,  0.075859103f,
+    0.997176437f,  0.075094301f,
+    0.997233740f,  0.074329454f,
+    0.997290457f,  0.073564564f,
+    0.997346587f,  0.072799630f,
+    0.997402130f,  0.072034653f,
+    0.997457086f,  0.071269634f,
+    0.997511456f,  0.070504573f,
+    0.997565239f,  0.069739471f,
+    0.997618435f,  0.068974328f,
+    0.997671044f,  0.068209144f,
+    0.997723067f,  0.067443920f,
+    0.997774502f,  0.066678656f,
+    0.997825350f,  0.065913353f,
+    0.997875612f,  0.065148011f,
+    0.997925286f,  0.064382631f,
+    0.997974374f,  0.063617213f,
+    0.998022874f,  0.062851758f,
+    0.998070787f,  0.062086265f,
+    0.998118113f,  0.061320736f,
+    0.998164852f,  0.060555171f,
+    0.998211003f,  0.059789571f,
+    0.998256568f,  0.059023935f,
+    0.998301545f,  0.058258265f,
+    0.998345935f,  0.057492560f,
+    0.998389737f,  0.056726821f,
+    0.998432953f,  0.055961049f,
+    0.998475581f,  0.055195244f,
+    0.998517621f,  0.054429407f,
+    0.998559074f,  0.053663538f,
+    0.998599940f,  0.052897637f,
+    0.998640218f,  0.052131705f,
+    0.998679909f,  0.051365742f,
+    0.998719012f,  0.050599749f,
+    0.998757528f,  0.049833726f,
+    0.998795456f,  0.049067674f,
+    0.998832797f,  0.048301593f,
+    0.998869550f,  0.047535484f,
+    0.998905715f,  0.046769347f,
+    0.998941293f,  0.046003182f,
+    0.998976283f,  0.045236990f,
+    0.999010686f,  0.044470772f,
+    0.999044501f,  0.043704527f,
+    0.999077728f,  0.042938257f,
+    0.999110367f,  0.042171961f,
+    0.999142419f,  0.041405641f,
+    0.999173883f,  0.040639296f,
+    0.999204759f,  0.039872928f,
+    0.999235047f,  0.039106535f,
+    0.999264747f,  0.038340120f,
+    0.999293860f,  0.037573683f,
+    0.999322385f,  0.036807223f,
+    0.999350321f,  0.036040742f,
+    0.999377670f,  0.035274239f,
+    0.999404431f,  0.034507716f,
+    0.999430605f,  0.033741172f,
+    0.999456190f,  0.032974608f,
+    0.999481187f,  0.032208025f,
+    0.999505596f,  0.031441424f,
+    0.999529418f,  0.030674803f,
+    0.999552651f,  0.029908165f,
+    0.999575296f,  0.029141509f,
+    0.999597353f,  0.028374836f,
+    0.999618822f,  0.027608146f,
+    0.999639704f,  0.026841440f,
+    0.999659997f,  0.026074718f,
+    0.999679702f,  0.025307981f,
+    0.999698819f,  0.024541229f,
+    0.999717348f,  0.023774462f,
+    0.999735288f,  0.023007681f,
+    0.999752641f,  0.022240887f,
+    0.999769405f,  0.021474080f,
+    0.999785582f,  0.020707261f,
+    0.999801170f,  0.019940429f,
+    0.999816170f,  0.019173585f,
+    0.999830582f,  0.018406730f,
+    0.999844405f,  0.017639864f,
+    0.999857641f,  0.016872988f,
+    0.999870288f,  0.016106102f,
+    0.999882347f,  0.015339206f,
+    0.999893818f,  0.014572302f,
+    0.999904701f,  0.013805389f,
+    0.999914996f,  0.013038467f,
+    0.999924702f,  0.012271538f,
+    0.999933820f,  0.011504602f,
+    0.999942350f,  0.010737659f,
+    0.999950291f,  0.009970710f,
+    0.999957645f,  0.009203755f,
+    0.999964410f,  0.008436794f,
+    0.999970586f,  0.007669829f,
+    0.999976175f,  0.006902859f,
+    0.999981175f,  0.006135885f,
+    0.999985587f,  0.005368907f,
+    0.999989411f,  0.004601926f,
+    0.999992647f,  0.003834943f,
+    0.999995294f,  0.003067957f,
+    0.999997353f,  0.002300969f,
+    0.999998823f,  0.001533980f,
+    0.999999706f,  0.000766990f,
+    1.000000000f,  0.000000000f,
+    0.999999706f, -0.000766990f,
+    0.999998823f, -0.001533980f,
+    0.999997353f, -0.002300969f,
+    0.999995294f, -0.003067957f,
+    0.999992647f, -0.003834943f,
+    0.999989411f, -0.004601926f,
+    0.999985587f, -0.005368907f,
+    0.999981175f, -0.006135885f,
+    0.999976175f, -0.006902859f,
+    0.999970586f, -0.007669829f,
+    0.999964410f, -0.008436794f,
+    0.999957645f, -0.009203755f,
+    0.999950291f, -0.009970710f,
+    0.999942350f, -0.010737659f,
+    0.999933820f, -0.011504602f,
+    0.999924702f, -0.012271538f,
+    0.999914996f, -0.013038467f,
+    0.999904701f, -0.013805389f,
+    0.999893818f, -0.014572302f,
+    0.999882347f, -0.015339206f,
+    0.999870288f, -0.016106102f,
+    0.999857641f, -0.016872988f,
+    0.999844405f, -0.017639864f,
+    0.999830582f, -0.018406730f,
+    0.999816170f, -0.019173585f,
+    0.999801170f, -0.019940429f,
+    0.999785582f, -0.020707261f,
+    0.999769405f, -0.021474080f,
+    0.999752641f, -0.022240887f,
+    0.999735288f, -0.023007681f,
+    0.999717348f, -0.023774462f,
+    0.999698819f, -0.024541229f,
+    0.999679702f, -0.025307981f,
+    0.999659997f, -0.026074718f,
+    0.999639704f, -0.026841440f,
+    0.999618822f, -0.027608146f,
+    0.999597353f, -0.028374836f,
+    0.999575296f, -0.029141509f,
+    0.999552651f, -0.029908165f,
+    0.999529418f, -0.030674803f,
+    0.999505596f, -0.031441424f,
+    0.999481187f, -0.032208025f,
+    0.999456190f, -0.032974608f,
+    0.999430605f, -0.033741172f,
+    0.999404431f, -0.034507716f,
+    0.999377670f, -0.035274239f,
+    0.999350321f, -0.036040742f,
+    0.999322385f, -0.036807223f,
+    0.999293860f, -0.037573683f,
+    0.999264747f, -0.038340120f,
+    0.999235047f, -0.039106535f,
+    0.999204759f, -0.039872928f,
+    0.999173883f, -0.040639296f,
+    0.999142419f, -0.041405641f,
+    0.999110367f, -0.042171961f,
+    0.999077728f, -0.042938257f,
+    0.999044501f, -0.043704527f,
+    0.999010686f, -0.044470772f,
+    0.998976283f, -0.045236990f,
+    0.998941293f, -0.046003182f,
+    0.998905715f, -0.046769347f,
+    0.998869550f, -0.047535484f,
+    0.998832797f, -0.048301593f,
+    0.998795456f, -0.049067674f,
+    0.998757528f, -0.049833726f,
+    0.998719012f, -0.050599749f,
+    0.998679909f, -0.051365742f,
+    0.998640218f, -0.052131705f,
+    0.998599940f, -0.052897637f,
+    0.998559074f, -0.053663538f,
+    0.998517621f, -0.054429407f,
+    0.998475581f, -0.055195244f,
+    0.998432953f, -0.055961049f,
+    0.998389737f, -0.056726821f,
+    0.998345935f, -0.057492560f,
+    0.998301545f, -0.058258265f,
+    0.998256568f, -0.059023935f,
+    0.998211003f, -0.059789571f,
+    0.998164852f, -0.060555171f,
+    0.998118113f, -0.061320736f,
+    0.998070787f, -0.062086265f,
+    0.998022874f, -0.062851758f,
+    0.997974374f, -0.063617213f,
+    0.997925286f, -0.064382631f,
+    0.997875612f, -0.065148011f,
+    0.997825350f, -0.065913353f,
+    0.997774502f, -0.066678656f,
+    0.997723067f, -0.067443920f,
+    0.997671044f, -0.068209144f,
+    0.997618435f, -0.068974328f,
+    0.997565239f, -0.069739471f,
+    0.997511456f, -0.070504573f,
+    0.997457086f, -0.071269634f,
+    0.997402130f, -0.072034653f,
+    0.997346587f, -0.072799630f,
+    0.997290457f, -0.073564564f,
+    0.997233740f, -0.074329454f,
+    0.997176437f, -0.075094301f,
+    0.997118547f, -0.075859103f,
+    0.997060070f, -0.076623861f,
+    0.997001007f, -0.077388574f,
+    0.996941358f, -0.078153242f,
+    0.996881122f, -0.078917863f,
+    0.996820299f, -0.079682438f,
+    0.996758890f, -0.080446966f,
+    0.996696895f, -0.081211447f,
+    0.996634314f, -0.081975880f,
+    0.996571146f, -0.082740265f,
+    0.996507392f, -0.083504601f,
+    0.996443051f, -0.084268888f,
+    0.996378125f, -0.085033125f,
+    0.996312612f, -0.085797312f,
+    0.996246513f, -0.086561449f,
+    0.996179829f, -0.087325535f,
+    0.996112558f, -0.088089570f,
+    0.996044701f, -0.088853553f,
+    0.995976258f, -0.089617483f,
+    0.995907229f, -0.090381361f,
+    0.995837615f, -0.091145185f,
+    0.995767414f, -0.091908956f,
+    0.995696628f, -0.092672673f,
+    0.995625256f, -0.093436336f,
+    0.995553299f, -0.094199943f,
+    0.995480755f, -0.094963495f,
+    0.995407627f, -0.095726991f,
+    0.995333912f, -0.096490431f,
+    0.995259612f, -0.097253814f,
+    0.995184727f, -0.098017140f,
+    0.995109256f, -0.098780409f,
+    0.995033199f, -0.099543619f,
+    0.994956558f, -0.100306770f,
+    0.994879331f, -0.101069863f,
+    0.994801519f, -0.101832896f,
+    0.994723121f, -0.102595869f,
+    0.994644138f, -0.103358782f,
+    0.994564571f, -0.104121634f,
+    0.994484418f, -0.104884425f,
+    0.994403680f, -0.105647154f,
+    0.994322357f, -0.106409821f,
+    0.994240449f, -0.107172425f,
+    0.994157957f, -0.107934966f,
+    0.994074879f, -0.108697444f,
+    0.993991217f, -0.109459858f,
+    0.993906970f, -0.110222207f,
+    0.993822138f, -0.110984492f,
+    0.993736722f, -0.111746711f,
+    0.993650721f, -0.112508865f,
+    0.993564136f, -0.113270952f,
+    0.993476966f, -0.114032973f,
+    0.993389211f, -0.114794927f,
+    0.993300872f, -0.115556813f,
+    0.993211949f, -0.116318631f,
+    0.993122442f, -0.117080381f,
+    0.993032350f, -0.117842062f,
+    0.992941674f, -0.118603673f,
+    0.992850414f, -0.119365215f,
+    0.992758570f, -0.120126686f,
+    0.992666142f, -0.120888087f,
+    0.992573130f, -0.121649417f,
+    0.992479535f, -0.122410675f,
+    0.992385355f, -0.123171861f,
+    0.992290591f, -0.123932975f,
+    0.992195244f, -0.124694016f,
+    0.992099313f, -0.125454983f,
+    0.992002799f, -0.126215877f,
+    0.991905700f, -0.126976696f,
+    0.991808019f, -0.127737441f,
+    0.991709754f, -0.128498111f,
+    0.991610905f, -0.129258705f,
+    0.991511473f, -0.130019223f,
+    0.991411458f, -0.130779664f,
+    0.991310860f, -0.131540029f,
+    0.991209678f, -0.132300316f,
+    0.991107914f, -0.133060525f,
+    0.991005566f, -0.133820656f,
+    0.990902635f, -0.134580709f,
+    0.990799122f, -0.135340682f,
+    0.990695025f, -0.136100575f,
+    0.990590346f, -0.136860389f,
+    0.990485084f, -0.137620122f,
+    0.990379240f, -0.138379774f,
+    0.990272812f, -0.139139344f,
+    0.990165803f, -0.139898833f,
+    0.990058210f, -0.140658239f,
+    0.989950036f, -0.141417563f,
+    0.989841278f, -0.142176804f,
+    0.989731939f, -0.142935960f,
+    0.989622017f, -0.143695033f,
+    0.989511514f, -0.144454021f,
+    0.989400428f, -0.145212925f,
+    0.989288760f, -0.145971742f,
+    0.989176510f, -0.146730474f,
+    0.989063678f, -0.147489120f,
+    0.988950265f, -0.148247679f,
+    0.988836269f, -0.149006151f,
+    0.988721692f, -0.149764535f,
+    0.988606533f, -0.150522831f,
+    0.988490793f, -0.151281038f,
+    0.988374471f, -0.152039156f,
+    0.988257568f, -0.152797185f,
+    0.988140083f, -0.153555124f,
+    0.988022017f, -0.154312973f,
+    0.987903370f, -0.155070731f,
+    0.987784142f, -0.155828398f,
+    0.987664332f, -0.156585973f,
+    0.987543942f, -0.157343456f,
+    0.987422970f, -0.158100846f,
+    0.987301418f, -0.158858143f,
+    0.987179285f, -0.159615347f,
+    0.987056571f, -0.160372457f,
+    0.986933277f, -0.161129473f,
+    0.986809402f, -0.161886394f,
+    0.986684946f, -0.162643219f,
+    0.986559910f, -0.163399949f,
+    0.986434294f, -0.164156583f,
+    0.986308097f, -0.164913120f,
+    0.986181320f, -0.165669561f,
+    0.986053963f, -0.166425904f,
+    0.985926026f, -0.167182148f,
+    0.985797509f, -0.167938295f,
+    0.985668412f, -0.168694343f,
+    0.985538735f, -0.169450291f,
+    0.985408479f, -0.170206140f,
+    0.985277642f, -0.170961889f,
+    0.985146226f, -0.171717537f,
+    0.985014231f, -0.172473084f,
+    0.984881656f, -0.173228530f,
+    0.984748502f, -0.173983873f,
+    0.984614768f, -0.174739115f,
+    0.984480455f, -0.175494253f,
+    0.984345563f, -0.176249289f,
+    0.984210092f, -0.177004220f,
+    0.984074042f, -0.177759048f,
+    0.983937413f, -0.178513771f,
+    0.983800206f, -0.179268389f,
+    0.983662419f, -0.180022901f,
+    0.983524054f, -0.180777308f,
+    0.983385110f, -0.181531608f,
+    0.983245588f, -0.182285802f,
+    0.983105487f, -0.183039888f,
+    0.982964808f, -0.183793867f,
+    0.982823551f, -0.184547737f,
+    0.982681716f, -0.185301499f,
+    0.982539302f, -0.186055152f,
+    0.982396311f, -0.186808695f,
+    0.982252741f, -0.187562129f,
+    0.982108594f, -0.188315452f,
+    0.981963869f, -0.189068664f,
+    0.981818566f, -0.189821765f,
+    0.981672686f, -0.190574755f,
+    0.981526228f, -0.191327632f,
+    0.981379193f, -0.192080397f,
+    0.981231581f, -0.192833049f,
+    0.981083391f, -0.193585587f,
+    0.980934624f, -0.194338012f,
+    0.980785280f, -0.195090322f,
+    0.980635360f, -0.195842517f,
+    0.980484862f, -0.196594598f,
+    0.980333787f, -0.197346562f,
+    0.980182136f, -0.198098411f,
+    0.980029908f, -0.198850143f,
+    0.979877104f, -0.199601758f,
+    0.979723723f, -0.200353255f,
+    0.979569766f, -0.201104635f,
+    0.979415232f, -0.201855896f,
+    0.979260123f, -0.202607039f,
+    0.979104437f, -0.203358062f,
+    0.978948175f, -0.204108966f,
+    0.978791338f, -0.204859750f,
+    0.978633924f, -0.205610413f,
+    0.978475935f, -0.206360955f,
+    0.978317371f, -0.207111376f,
+    0.978158231f, -0.207861675f,
+    0.977998515f, -0.208611852f,
+    0.977838224f, -0.209361906f,
+    0.977677358f, -0.210111837f,
+    0.977515917f, -0.210861644f,
+    0.977353900f, -0.211611327f,
+    0.977191309f, -0.212360886f,
+    0.977028143f, -0.213110320f,
+    0.976864402f, -0.213859628f,
+    0.976700086f, -0.214608811f,
+    0.976535196f, -0.215357867f,
+    0.976369731f, -0.216106797f,
+    0.976203692f, -0.216855600f,
+    0.976037079f, -0.217604275f,
+    0.975869892f, -0.218352822f,
+    0.975702130f, -0.219101240f,
+    0.975533795f, -0.219849530f,
+    0.975364885f, -0.220597690f,
+    0.975195402f, -0.221345721f,
+    0.975025345f, -0.222093621f,
+    0.974854715f, -0.222841391f,
+    0.974683511f, -0.223589029f,
+    0.974511733f, -0.224336536f,
+    0.974339383f, -0.225083911f,
+    0.974166459f, -0.225831154f,
+    0.973992962f, -0.226578264f,
+    0.973818892f, -0.227325240f,
+    0.973644250f, -0.228072083f,
+    0.973469034f, -0.228818792f,
+    0.973293246f, -0.229565366f,
+    0.973116885f, -0.230311805f,
+    0.972939952f, -0.231058108f,
+    0.972762447f, -0.231804276f,
+    0.972584369f, -0.232550307f,
+    0.972405719f, -0.233296201f,
+    0.972226497f, -0.234041959f,
+    0.972046703f, -0.234787578f,
+    0.971866337f, -0.235533059f,
+    0.971685400f, -0.236278402f,
+    0.971503891f, -0.237023606f,
+    0.971321810f, -0.237768670f,
+    0.971139158f, -0.238513595f,
+    0.970955935f, -0.239258379f,
+    0.970772141f, -0.240003022f,
+    0.970587775f, -0.240747525f,
+    0.970402839f, -0.241491885f,
+    0.970217331f, -0.242236104f,
+    0.970031253f, -0.242980180f,
+    0.969844604f, -0.243724113f,
+    0.969657385f, -0.244467903f,
+    0.969469595f, -0.245211549f,
+    0.969281235f, -0.245955050f,
+    0.969092305f, -0.246698407f,
+    0.968902805f, -0.247441619f,
+    0.968712734f, -0.248184685f,
+    0.968522094f, -0.248927606f,
+    0.968330884f, -0.249670380f,
+    0.968139105f, -0.250413007f,
+    0.967946756f, -0.251155486f,
+    0.967753837f, -0.251897818f,
+    0.967560349f, -0.252640002f,
+    0.967366292f, -0.253382037f,
+    0.967171666f, -0.254123923f,
+    0.966976471f, -0.254865660f,
+    0.966780707f, -0.255607246f,
+    0.966584374f, -0.256348682f,
+    0.966387473f, -0.257089968f,
+    0.966190003f, -0.257831102f,
+    0.965991965f, -0.258572085f,
+    0.965793359f, -0.259312915f,
+    0.965594184f, -0.260053593f,
+    0.965394442f, -0.260794118f,
+    0.965194131f, -0.261534489f,
+    0.964993253f, -0.262274707f,
+    0.964791807f, -0.263014770f,
+    0.964589793f, -0.263754679f,
+    0.964387212f, -0.264494432f,
+    0.964184064f, -0.265234030f,
+    0.963980348f, -0.265973472f,
+    0.963776066f, -0.266712757f,
+    0.963571216f, -0.267451886f,
+    0.963365800f, -0.268190857f,
+    0.963159817f, -0.268929670f,
+    0.962953267f, -0.269668326f,
+    0.962746151f, -0.270406822f,
+    0.962538468f, -0.271145160f,
+    0.962330219f, -0.271883337f,
+    0.962121404f, -0.272621355f,
+    0.961912023f, -0.273359213f,
+    0.961702077f, -0.274096910f,
+    0.961491564f, -0.274834445f,
+    0.961280486f, -0.275571819f,
+    0.961068842f, -0.276309031f,
+    0.960856633f, -0.277046080f,
+    0.960643859f, -0.277782967f,
+    0.960430519f, -0.278519689f,
+    0.960216615f, -0.279256248f,
+    0.960002146f, -0.279992643f,
+    0.959787112f, -0.280728873f,
+    0.959571513f, -0.281464938f,
+    0.959355350f, -0.282200837f,
+    0.959138622f, -0.282936570f,
+    0.958921331f, -0.283672137f,
+    0.958703475f, -0.284407537f,
+    0.958485055f, -0.285142770f,
+    0.958266071f, -0.285877835f,
+    0.958046524f, -0.286612731f,
+    0.957826413f, -0.287347460f,
+    0.957605739f, -0.288082019f,
+    0.957384501f, -0.288816408f,
+    0.957162700f, -0.289550628f,
+    0.956940336f, -0.290284677f,
+    0.956717409f, -0.291018556f,
+    0.956493919f, -0.291752263f,
+    0.956269866f, -0.292485799f,
+    0.956045251f, -0.293219163f,
+    0.955820074f, -0.293952354f,
+    0.955594334f, -0.294685372f,
+    0.955368032f, -0.295418217f,
+    0.955141168f, -0.296150888f,
+    0.954913742f, -0.296883385f,
+    0.954685755f, -0.297615707f,
+    0.954457206f, -0.298347855f,
+    0.954228095f, -0.299079826f,
+    0.953998423f, -0.299811622f,
+    0.953768190f, -0.300543241f,
+    0.953537396f, -0.301274684f,
+    0.953306040f, -0.302005949f,
+    0.953074124f, -0.302737037f,
+    0.952841648f, -0.303467947f,
+    0.952608610f, -0.304198678f,
+    0.952375013f, -0.304929230f,
+    0.952140855f, -0.305659602f,
+    0.951906137f, -0.306389795f,
+    0.951670859f, -0.307119808f,
+    0.951435021f, -0.307849640f,
+    0.951198623f, -0.308579291f,
+    0.950961666f, -0.309308760f,
+    0.950724150f, -0.310038048f,
+    0.950486074f, -0.310767153f,
+    0.950247439f, -0.311496075f,
+    0.950008245f, -0.312224814f,
+    0.949768492f, -0.312953369f,
+    0.949528181f, -0.313681740f,
+    0.949287310f, -0.314409927f,
+    0.949045882f, -0.315137929f,
+    0.948803895f, -0.315865745f,
+    0.948561350f, -0.316593376f,
+    0.948318247f, -0.317320820f,
+    0.948074586f, -0.318048077f,
+    0.947830367f, -0.318775148f,
+    0.947585591f, -0.319502031f,
+    0.947340257f, -0.320228726f,
+    0.947094366f, -0.320955232f,
+    0.946847918f, -0.321681550f,
+    0.946600913f, -0.322407679f,
+    0.946353351f, -0.323133618f,
+    0.946105232f, -0.323859367f,
+    0.945856557f, -0.324584925f,
+    0.945607325f, -0.325310292f,
+    0.945357537f, -0.326035468f,
+    0.945107193f, -0.326760452f,
+    0.944856293f, -0.327485244f,
+    0.944604837f, -0.328209844f,
+    0.944352826f, -0.328934250f,
+    0.944100258f, -0.329658463f,
+    0.943847136f, -0.330382481f,
+    0.943593458f, -0.331106306f,
+    0.943339225f, -0.331829935f,
+    0.943084437f, -0.332553370f,
+    0.942829095f, -0.333276609f,
+    0.942573198f, -0.333999651f,
+    0.942316746f, -0.334722498f,
+    0.942059740f, -0.335445147f,
+    0.941802179f, -0.336167599f,
+    0.941544065f, -0.336889853f,
+    0.941285397f, -0.337611909f,
+    0.941026175f, -0.338333767f,
+    0.940766400f, -0.339055425f,
+    0.940506071f, -0.339776884f,
+    0.940245188f, -0.340498144f,
+    0.939983753f, -0.341219202f,
+    0.939721765f, -0.341940060f,
+    0.939459224f, -0.342660717f,
+    0.939196130f, -0.343381173f,
+    0.938932484f, -0.344101426f,
+    0.938668285f, -0.344821477f,
+    0.938403534f, -0.345541325f,
+    0.938138231f, -0.346260970f,
+    0.937872376f, -0.346980411f,
+    0.937605970f, -0.347699648f,
+    0.937339012f, -0.348418680f,
+    0.937071502f, -0.349137508f,
+    0.936803442f, -0.349856130f,
+    0.936534830f, -0.350574546f,
+    0.936265667f, -0.351292756f,
+    0.935995954f, -0.352010759f,
+    0.935725689f, -0.352728556f,
+    0.935454875f, -0.353446145f,
+    0.935183510f, -0.354163525f,
+    0.934911595f, -0.354880698f,
+    0.934639130f, -0.355597662f,
+    0.934366115f, -0.356314416f,
+    0.934092550f, -0.357030961f,
+    0.933818436f, -0.357747296f,
+    0.933543773f, -0.358463421f,
+    0.933268560f, -0.359179334f,
+    0.932992799f, -0.359895037f,
+    0.932716488f, -0.360610527f,
+    0.932439629f, -0.361325806f,
+    0.932162222f, -0.362040871f,
+    0.931884266f, -0.362755724f,
+    0.931605761f, -0.363470364f,
+    0.931326709f, -0.364184790f,
+    0.931047109f, -0.364899001f,
+    0.930766961f, -0.365612998f,
+    0.930486266f, -0.366326780f,
+    0.930205023f, -0.367040346f,
+    0.929923233f, -0.367753696f,
+    0.929640896f, -0.368466830f,
+    0.929358012f, -0.369179747f,
+    0.929074581f, -0.369892447f,
+    0.928790604f, -0.370604930f,
+    0.928506080f, -0.371317194f,
+    0.928221011f, -0.372029240f,
+    0.927935395f, -0.372741067f,
+    0.927649233f, -0.373452675f,
+    0.927362526f, -0.374164063f,
+    0.927075273f, -0.374875231f,
+    0.926787474f, -0.375586178f,
+    0.926499131f, -0.376296905f,
+    0.926210242f, -0.377007410f,
+    0.925920809f, -0.377717694f,
+    0.925630831f, -0.378427755f,
+    0.925340308f, -0.379137593f,
+    0.925049241f, -0.379847209f,
+    0.924757630f, -0.380556601f,
+    0.924465474f, -0.381265769f,
+    0.924172775f, -0.381974713f,
+    0.923879533f, -0.382683432f,
+    0.923585746f, -0.383391926f,
+    0.923291417f, -0.384100195f,
+    0.922996544f, -0.384808238f,
+    0.922701128f, -0.385516054f,
+    0.922405170f, -0.386223643f,
+    0.922108669f, -0.386931006f,
+    0.921811625f, -0.387638140f,
+    0.921514039f, -0.388345047f,
+    0.921215911f, -0.389051725f,
+    0.920917242f, -0.389758174f,
+    0.920618030f, -0.390464394f,
+    0.920318277f, -0.391170384f,
+    0.920017982f, -0.391876144f,
+    0.919717146f, -0.392581674f,
+    0.919415769f, -0.393286973f,
+    0.919113852f, -0.393992040f,
+    0.918811393f, -0.394696876f,
+    0.918508394f, -0.395401479f,
+    0.918204855f, -0.396105850f,
+    0.917900776f, -0.396809987f,
+    0.917596156f, -0.397513892f,
+    0.917290997f, -0.398217562f,
+    0.916985298f, -0.398920998f,
+    0.916679060f, -0.399624200f,
+    0.916372282f, -0.400327166f,
+    0.916064966f, -0.401029897f,
+    0.915757110f, -0.401732392f,
+    0.915448716f, -0.402434651f,
+    0.915139783f, -0.403136673f,
+    0.914830312f, -0.403838458f,
+    0.914520303f, -0.404540005f,
+    0.914209756f, -0.405241314f,
+    0.913898671f, -0.405942385f,
+    0.913587048f, -0.406643217f,
+    0.913274888f, -0.407343810f,
+    0.912962190f, -0.408044163f,
+    0.912648956f, -0.408744276f,
+    0.912335185f, -0.409444149f,
+    0.912020877f, -0.410143781f,
+    0.911706032f, -0.410843171f,
+    0.911390651f, -0.411542320f,
+    0.911074734f, -0.412241227f,
+    0.910758281f, -0.412939891f,
+    0.910441292f, -0.413638312f,
+    0.910123768f, -0.414336490f,
+    0.909805708f, -0.415034424f,
+    0.909487113f, -0.415732115f,
+    0.909167983f, -0.416429560f,
+    0.908848318f, -0.417126761f,
+    0.908528119f, -0.417823716f,
+    0.908207385f, -0.418520425f,
+    0.907886116f, -0.419216888f,
+    0.907564314f, -0.419913105f,
+    0.907241978f, -0.420609074f,
+    0.906919108f, -0.421304797f,
+    0.906595705f, -0.422000271f,
+    0.906271768f, -0.422695497f,
+    0.905947298f, -0.423390474f,
+    0.905622295f, -0.424085202f,
+    0.905296759f, -0.424779681f,
+    0.904970691f, -0.425473910f,
+    0.904644091f, -0.426167889f,
+    0.904316958f, -0.426861617f,
+    0.903989293f, -0.427555093f,
+    0.903661097f, -0.428248319f,
+    0.903332368f, -0.428941292f,
+    0.903003109f, -0.429634013f,
+    0.902673318f, -0.430326481f,
+    0.902342996f, -0.431018696f,
+    0.902012144f, -0.431710658f,
+    0.901680761f, -0.432402366f,
+    0.901348847f, -0.433093819f,
+    0.901016403f, -0.433785017f,
+    0.900683429f, -0.434475961f,
+    0.900349925f, -0.435166648f,
+    0.900015892f, -0.435857080f,
+    0.899681329f, -0.436547255f,
+    0.899346237f, -0.437237174f,
+    0.899010616f, -0.437926835f,
+    0.898674466f, -0.438616239f,
+    0.898337787f, -0.439305384f,
+    0.898000580f, -0.439994271f,
+    0.897662844f, -0.440682900f,
+    0.897324581f, -0.441371269f,
+    0.896985789f, -0.442059378f,
+    0.896646470f, -0.442747228f,
+    0.896306624f, -0.443434816f,
+    0.895966250f, -0.444122145f,
+    0.895625349f, -0.444809211f,
+    0.895283921f, -0.445496017f,
+    0.894941967f, -0.446182560f,
+    0.894599486f, -0.446868840f,
+    0.894256478f, -0.447554858f,
+    0.893912945f, -0.448240612f,
+    0.893568886f, -0.448926103f,
+    0.893224301f, -0.449611330f,
+    0.892879191f, -0.450296292f,
+    0.892533555f, -0.450980989f,
+    0.892187395f, -0.451665421f,
+    0.891840709f, -0.452349587f,
+    0.891493499f, -0.453033487f,
+    0.891145765f, -0.453717121f,
+    0.890797506f, -0.454400488f,
+    0.890448723f, -0.455083587f,
+    0.890099417f, -0.455766419f,
+    0.889749586f, -0.456448982f,
+    0.889399233f, -0.457131277f,
+    0.889048356f, -0.457813304f,
+    0.888696956f, -0.458495060f,
+    0.888345033f, -0.459176548f,
+    0.887992588f, -0.459857765f,
+    0.887639620f, -0.460538711f,
+    0.887286131f, -0.461219386f,
+    0.886932119f, -0.461899791f,
+    0.886577585f, -0.462579923f,
+    0.886222530f, -0.463259784f,
+    0.885866954f, -0.463939371f,
+    0.885510856f, -0.464618686f,
+    0.885154238f, -0.465297728f,
+    0.884797098f, -0.465976496f,
+    0.884439439f, -0.466654990f,
+    0.884081259f, -0.467333209f,
+    0.883722559f, -0.468011153f,
+    0.883363339f, -0.468688822f,
+    0.883003599f, -0.469366215f,
+    0.882643340f, -0.470043332f,
+    0.882282562f, -0.470720173f,
+    0.881921264f, -0.471396737f,
+    0.881559448f, -0.472073023f,
+    0.881197113f, -0.472749032f,
+    0.880834260f, -0.473424763f,
+    0.880470889f, -0.474100215f,
+    0.880107000f, -0.474775388f,
+    0.879742593f, -0.475450282f,
+    0.879377668f, -0.476124896f,
+    0.879012226f, -0.476799230f,
+    0.878646267f, -0.477473284f,
+    0.878279792f, -0.478147056f,
+    0.877912799f, -0.478820548f,
+    0.877545290f, -0.479493758f,
+    0.877177265f, -0.480166685f,
+    0.876808724f, -0.480839331f,
+    0.876439667f, -0.481511693f,
+    0.876070094f, -0.482183772f,
+    0.875700006f, -0.482855568f,
+    0.875329403f, -0.483527079f,
+    0.874958285f, -0.484198306f,
+    0.874586652f, -0.484869248f,
+    0.874214505f, -0.485539905f,
+    0.873841843f, -0.486210276f,
+    0.873468668f, -0.486880361f,
+    0.873094978f, -0.487550160f,
+    0.872720775f, -0.488219672f,
+    0.872346059f, -0.488888897f,
+    0.871970829f, -0.489557834f,
+    0.871595087f, -0.490226483f,
+    0.871218831f, -0.490894844f,
+    0.870842063f, -0.491562916f,
+    0.870464783f, -0.492230699f,
+    0.870086991f, -0.492898192f,
+    0.869708687f, -0.493565396f,
+    0.869329871f, -0.494232309f,
+    0.868950544f, -0.494898931f,
+    0.868570706f, -0.495565262f,
+    0.868190357f, -0.496231301f,
+    0.867809497f, -0.496897049f,
+    0.867428126f, -0.497562504f,
+    0.867046246f, -0.498227667f,
+    0.866663855f, -0.498892537f,
+    0.866280954f, -0.499557113f,
+    0.865897544f, -0.500221395f,
+    0.865513624f, -0.500885383f,
+    0.865129195f, -0.501549076f,
+    0.864744258f, -0.502212474f,
+    0.864358811f, -0.502875577f,
+    0.863972856f, -0.503538384f,
+    0.863586393f, -0.504200894f,
+    0.863199422f, -0.504863109f,
+    0.862811943f, -0.505525026f,
+    0.862423956f, -0.506186645f,
+    0.862035462f, -0.506847967f,
+    0.861646461f, -0.507508991f,
+    0.861256953f, -0.508169716f,
+    0.860866939f, -0.508830143f,
+    0.860476418f, -0.509490269f,
+    0.860085390f, -0.510150097f,
+    0.859693857f, -0.510809624f,
+    0.859301818f, -0.511468850f,
+    0.858909274f, -0.512127776f,
+    0.858516224f, -0.512786401f,
+    0.858122670f, -0.513444723f,
+    0.857728610f, -0.514102744f,
+    0.857334046f, -0.514760463f,
+    0.856938977f, -0.515417878f,
+    0.856543405f, -0.516074990f,
+    0.856147328f, -0.516731799f,
+    0.855750748f, -0.517388304f,
+    0.855353665f, -0.518044504f,
+    0.854956078f, -0.518700400f,
+    0.854557988f, -0.519355990f,
+    0.854159396f, -0.520011275f,
+    0.853760301f, -0.520666254f,
+    0.853360704f, -0.521320927f,
+    0.852960605f, -0.521975293f,
+    0.852560004f, -0.522629352f,
+    0.852158902f, -0.523283103f,
+    0.851757298f, -0.523936547f,
+    0.851355193f, -0.524589683f,
+    0.850952587f, -0.525242510f,
+    0.850549481f, -0.525895027f,
+    0.850145875f, -0.526547236f,
+    0.849741768f, -0.527199135f,
+    0.849337161f, -0.527850723f,
+    0.848932055f, -0.528502002f,
+    0.848526450f, -0.529152969f,
+    0.848120345f, -0.529803625f,
+    0.847713741f, -0.530453969f,
+    0.847306639f, -0.531104001f,
+    0.846899038f, -0.531753721f,
+    0.846490939f, -0.532403128f,
+    0.846082342f, -0.533052222f,
+    0.845673247f, -0.533701002f,
+    0.845263655f, -0.534349468f,
+    0.844853565f, -0.534997620f,
+    0.844442979f, -0.535645457f,
+    0.844031895f, -0.536292979f,
+    0.843620316f, -0.536940186f,
+    0.843208240f, -0.537587076f,
+    0.842795668f, -0.538233651f,
+    0.842382600f, -0.538879909f,
+    0.841969036f, -0.539525849f,
+    0.841554977f, -0.540171473f,
+    0.841140424f, -0.540816778f,
+    0.840725375f, -0.541461766f,
+    0.840309832f, -0.542106435f,
+    0.839893794f, -0.542750785f,
+    0.839477263f, -0.543394816f,
+    0.839060237f, -0.544038527f,
+    0.838642718f, -0.544681918f,
+    0.838224706f, -0.545324988f,
+    0.837806200f, -0.545967738f,
+    0.837387202f, -0.546610167f,
+    0.836967711f, -0.547252274f,
+    0.836547727f, -0.547894059f,
+    0.836127252f, -0.548535522f,
+    0.835706284f, -0.549176662f,
+    0.835284825f, -0.549817479f,
+    0.834862875f, -0.550457973f,
+    0.834440433f, -0.551098143f,
+    0.834017501f, -0.551737988f,
+    0.833594078f, -0.552377509f,
+    0.833170165f, -0.553016706f,
+    0.832745761f, -0.553655576f,
+    0.832320868f, -0.554294121f,
+    0.831895485f, -0.554932340f,
+    0.831469612f, -0.555570233f,
+    0.831043251f, -0.556207799f,
+    0.830616400f, -0.556845037f,
+    0.830189061f, -0.557481948f,
+    0.829761234f, -0.558118531f,
+    0.829332918f, -0.558754786f,
+    0.828904115f, -0.559390712f,
+    0.828474824f, -0.560026309f,
+    0.828045045f, -0.560661576f,
+    0.827614780f, -0.561296514f,
+    0.827184027f, -0.561931121f,
+    0.826752788f, -0.562565398f,
+    0.826321063f, -0.563199344f,
+    0.825888851f, -0.563832959f,
+    0.825456154f, -0.564466242f,
+    0.825022971f, -0.565099192f,
+    0.824589303f, -0.565731811f,
+    0.824155149f, -0.566364096f,
+    0.823720511f, -0.566996049f,
+    0.823285388f, -0.567627668f,
+    0.822849781f, -0.568258953f,
+    0.822413690f, -0.568889903f,
+    0.821977115f, -0.569520519f,
+    0.821540057f, -0.570150800f,
+    0.821102515f, -0.570780746f,
+    0.820664490f, -0.571410356f,
+    0.820225983f, -0.572039629f,
+    0.819786992f, -0.572668566f,
+    0.819347520f, -0.573297167f,
+    0.818907566f, -0.573925430f,
+    0.818467130f, -0.574553355f,
+    0.818026212f, -0.575180942f,
+    0.817584813f, -0.575808191f,
+    0.817142933f, -0.576435102f,
+    0.816700573f, -0.577061673f,
+    0.816257732f, -0.577687905f,
+    0.815814411f, -0.578313796f,
+    0.815370610f, -0.578939348f,
+    0.814926329f, -0.579564559f,
+    0.814481569f, -0.580189429f,
+    0.814036330f, -0.580813958f,
+    0.813590612f, -0.581438145f,
+    0.813144415f, -0.582061990f,
+    0.812697740f, -0.582685493f,
+    0.812250587f, -0.583308653f,
+    0.811802956f, -0.583931470f,
+    0.811354847f, -0.584553943f,
+    0.810906261f, -0.585176072f,
+    0.810457198f, -0.585797857f,
+    0.810007659f, -0.586419298f,
+    0.809557642f, -0.587040394f,
+    0.809107150f, -0.587661144f,
+    0.808656182f, -0.588281548f,
+    0.808204737f, -0.588901607f,
+    0.807752818f, -0.589521319f,
+    0.807300423f, -0.590140684f,
+    0.806847554f, -0.590759702f,
+    0.806394209f, -0.591378372f,
+    0.805940391f, -0.591996695f,
+    0.805486098f, -0.592614669f,
+    0.805031331f, -0.593232295f,
+    0.804576091f, -0.593849572f,
+    0.804120377f, -0.594466499f,
+    0.803664191f, -0.595083077f,
+    0.803207531f, -0.595699304f,
+    0.802750400f, -0.596315182f,
+    0.802292796f, -0.596930708f,
+    0.801834719f, -0.597545883f,
+    0.801376172f, -0.598160707f,
+    0.800917153f, -0.598775179f,
+    0.800457662f, -0.599389298f,
+    0.799997701f, -0.600003065f,
+    0.799537269f, -0.600616479f,
+    0.799076367f, -0.601229540f,
+    0.798614995f, -0.601842247f,
+    0.798153153f, -0.602454600f,
+    0.797690841f, -0.603066599f,
+    0.797228060f, -0.603678242f,
+    0.796764810f, -0.604289531f,
+    0.796301092f, -0.604900464f,
+    0.795836905f, -0.605511041f,
+    0.795372249f, -0.606121263f,
+    0.794907126f, -0.606731127f,
+    0.794441536f, -0.607340635f,
+    0.793975478f, -0.607949785f,
+    0.793508952f, -0.608558578f,
+    0.793041960f, -0.609167012f,
+    0.792574502f, -0.609775089f,
+    0.792106577f, -0.610382806f,
+    0.791638187f, -0.610990165f,
+    0.791169330f, -0.611597164f,
+    0.790700008f, -0.612203803f,
+    0.790230221f, -0.612810082f,
+    0.789759970f, -0.613416001f,
+    0.789289253f, -0.614021559f,
+    0.788818072f, -0.614626756f,
+    0.788346428f, -0.615231591f,
+    0.787874319f, -0.615836064f,
+    0.787401747f, -0.616440175f,
+    0.786928712f, -0.617043923f,
+    0.786455214f, -0.617647308f,
+    0.785981253f, -0.618250330f,
+    0.785506830f, -0.618852988f,
+    0.785031944f, -0.619455282f,
+    0.784556597f, -0.620057212f,
+    0.784080789f, -0.620658777f,
+    0.783604519f, -0.621259977f,
+    0.783127788f, -0.621860811f,
+    0.782650596f, -0.622461279f,
+    0.782172944f, -0.623061382f,
+    0.781694832f, -0.623661118f,
+    0.781216260f, -0.624260486f,
+    0.780737229f, -0.624859488f,
+    0.780257738f, -0.625458122f,
+    0.779777788f, -0.626056388f,
+    0.779297379f, -0.626654286f,
+    0.778816512f, -0.627251815f,
+    0.778335187f, -0.627848976f,
+    0.777853404f, -0.628445767f,
+    0.777371164f, -0.629042188f,
+    0.776888466f, -0.629638239f,
+    0.776405311f, -0.630233920f,
+    0.775921699f, -0.630829230f,
+    0.775437631f, -0.631424169f,
+    0.774953107f, -0.632018736f,
+    0.774468126f, -0.632612932f,
+    0.773982691f, -0.633206755f,
+    0.773496799f, -0.633800206f,
+    0.773010453f, -0.634393284f,
+    0.772523652f, -0.634985989f,
+    0.772036397f, -0.635578320f,
+    0.771548688f, -0.636170278f,
+    0.771060524f, -0.636761861f,
+    0.770571907f, -0.637353070f,
+    0.770082837f, -0.637943904f,
+    0.769593314f, -0.638534362f,
+    0.769103338f, -0.639124445f,
+    0.768612909f, -0.639714152f,
+    0.768122029f, -0.640303482f,
+    0.767630696f, -0.640892436f,
+    0.767138912f, -0.641481013f,
+    0.766646677f, -0.642069212f,
+    0.766153990f, -0.642657034f,
+    0.765660853f, -0.643244478f,
+    0.765167266f, -0.643831543f,
+    0.764673228f, -0.644418229f,
+    0.764178741f, -0.645004537f,
+    0.763683804f, -0.645590465f,
+    0.763188417f, -0.646176013f,
+    0.762692582f, -0.646761181f,
+    0.762196298f, -0.647345969f,
+    0.761699566f, -0.647930375f,
+    0.761202385f, -0.648514401f,
+    0.760704757f, -0.649098045f,
+    0.760206682f, -0.649681307f,
+    0.759708159f, -0.650264187f,
+    0.759209189f, -0.650846685f,
+    0.758709773f, -0.651428800f,
+    0.758209910f, -0.652010531f,
+    0.757709601f, -0.652591879f,
+    0.757208847f, -0.653172843f,
+    0.756707647f, -0.653753423f,
+    0.756206001f, -0.654333618f,
+    0.755703911f, -0.654913428f,
+    0.755201377f, -0.655492853f,
+    0.754698398f, -0.656071892f,
+    0.754194975f, -0.656650546f,
+    0.753691109f, -0.657228813f,
+    0.753186799f, -0.657806693f,
+    0.752682046f, -0.658384187f,
+    0.752176850f, -0.658961293f,
+    0.751671212f, -0.659538012f,
+    0.751165132f, -0.660114342f,
+    0.750658610f, -0.660690284f,
+    0.750151646f, -0.661265838f,
+    0.749644241f, -0.661841002f,
+    0.749136395f, -0.662415778f,
+    0.748628108f, -0.662990163f,
+    0.748119380f, -0.663564159f,
+    0.747610213f, -0.664137764f,
+    0.747100606f, -0.664710978f,
+    0.746590559f, -0.665283802f,
+    0.746080074f, -0.665856234f,
+    0.745569149f, -0.666428274f,
+    0.745057785f, -0.666999922f,
+    0.744545984f, -0.667571178f,
+    0.744033744f, -0.668142041f,
+    0.743521067f, -0.668712512f,
+    0.743007952f, -0.669282588f,
+    0.742494400f, -0.669852271f,
+    0.741980412f, -0.670421560f,
+    0.741465987f, -0.670990455f,
+    0.740951125f, -0.671558955f,
+    0.740435828f, -0.672127060f,
+    0.739920095f, -0.672694769f,
+    0.739403927f, -0.673262083f,
+    0.738887324f, -0.673829000f,
+    0.738370287f, -0.674395522f,
+    0.737852815f, -0.674961646f,
+    0.737334909f, -0.675527374f,
+    0.736816569f, -0.676092704f,
+    0.736297796f, -0.676657636f,
+    0.735778589f, -0.677222170f,
+    0.735258950f, -0.677786306f,
+    0.734738878f, -0.678350043f,
+    0.734218374f, -0.678913381f,
+    0.733697438f, -0.679476320f,
+    0.733176071f, -0.680038859f,
+    0.732654272f, -0.680600998f,
+    0.732132042f, -0.681162736f,
+    0.731609381f, -0.681724074f,
+    0.731086290f, -0.682285011f,
+    0.730562769f, -0.682845546f,
+    0.730038818f, -0.683405680f,
+    0.729514438f, -0.683965412f,
+    0.728989629f, -0.684524741f,
+    0.728464390f, -0.685083668f,
+    0.727938724f, -0.685642191f,
+    0.727412629f, -0.686200312f,
+    0.726886106f, -0.686758028f,
+    0.726359155f, -0.687315341f,
+    0.725831777f, -0.687872249f,
+    0.725303972f, -0.688428753f,
+    0.724775741f, -0.688984851f,
+    0.724247083f, -0.689540545f,
+    0.723717999f, -0.690095832f,
+    0.723188489f, -0.690650714f,
+    0.722658554f, -0.691205190f,
+    0.722128194f, -0.691759258f,
+    0.721597409f, -0.692312920f,
+    0.721066199f, -0.692866175f,
+    0.720534566f, -0.693419022f,
+    0.720002508f, -0.693971461f,
+    0.719470027f, -0.694523492f,
+    0.718937122f, -0.695075114f,
+    0.718403795f, -0.695626327f,
+    0.717870045f, -0.696177131f,
+    0.717335873f, -0.696727526f,
+    0.716801279f, -0.697277511f,
+    0.716266263f, -0.697827085f,
+    0.715730825f, -0.698376249f,
+    0.715194967f, -0.698925003f,
+    0.714658688f, -0.699473345f,
+    0.714121988f, -0.700021275f,
+    0.713584869f, -0.700568794f,
+    0.713047329f, -0.701115901f,
+    0.712509371f, -0.701662595f,
+    0.711970993f, -0.702208876f,
+    0.711432196f, -0.702754744f,
+    0.710892980f, -0.703300199f,
+    0.710353347f, -0.703845241f,
+    0.709813295f, -0.704389868f,
+    0.709272826f, -0.704934080f,
+    0.708731940f, -0.705477878f,
+    0.708190637f, -0.706021261f,
+    0.707648917f, -0.706564229f,
+    0.707106781f, -0.707106781f,
+    0.706564229f, -0.707648917f,
+    0.706021261f, -0.708190637f,
+    0.705477878f, -0.708731940f,
+    0.704934080f, -0.709272826f,
+    0.704389868f, -0.709813295f,
+    0.703845241f, -0.710353347f,
+    0.703300199f, -0.710892980f,
+    0.702754744f, -0.711432196f,
+    0.702208876f, -0.711970993f,
+    0.701662595f, -0.712509371f,
+    0.701115901f, -0.713047329f,
+    0.700568794f, -0.713584869f,
+    0.700021275f, -0.714121988f,
+    0.699473345f, -0.714658688f,
+    0.698925003f, -0.715194967f,
+    0.698376249f, -0.715730825f,
+    0.697827085f, -0.716266263f,
+    0.697277511f, -0.716801279f,
+    0.696727526f, -0.717335873f,
+    0.696177131f, -0.717870045f,
+    0.695626327f, -0.718403795f,
+    0.695075114f, -0.718937122f,
+    0.694523492f, -0.719470027f,
+    0.693971461f, -0.720002508f,
+    0.693419022f, -0.720534566f,
+    0.692866175f, -0.721066199f,
+    0.692312920f, -0.721597409f,
+    0.691759258f, -0.722128194f,
+    0.691205190f, -0.722658554f,
+    0.690650714f, -0.723188489f,
+    0.690095832f, -0.723717999f,
+    0.689540545f, -0.724247083f,
+    0.688984851f, -0.724775741f,
+    0.688428753f, -0.725303972f,
+    0.687872249f, -0.725831777f,
+    0.687315341f, -0.726359155f,
+    0.686758028f, -0.726886106f,
+    0.686200312f, -0.727412629f,
+    0.685642191f, -0.727938724f,
+    0.685083668f, -0.728464390f,
+    0.684524741f, -0.728989629f,
+    0.683965412f, -0.729514438f,
+    0.683405680f, -0.730038818f,
+    0.682845546f, -0.730562769f,
+    0.682285011f, -0.731086290f,
+    0.681724074f, -0.731609381f,
+    0.681162736f, -0.732132042f,
+    0.680600998f, -0.732654272f,
+    0.680038859f, -0.733176071f,
+    0.679476320f, -0.733697438f,
+    0.678913381f, -0.734218374f,
+    0.678350043f, -0.734738878f,
+    0.677786306f, -0.735258950f,
+    0.677222170f, -0.735778589f,
+    0.676657636f, -0.736297796f,
+    0.676092704f, -0.736816569f,
+    0.675527374f, -0.737334909f,
+    0.674961646f, -0.737852815f,
+    0.674395522f, -0.738370287f,
+    0.673829000f, -0.738887324f,
+    0.673262083f, -0.739403927f,
+    0.672694769f, -0.739920095f,
+    0.672127060f, -0.740435828f,
+    0.671558955f, -0.740951125f,
+    0.670990455f, -0.741465987f,
+    0.670421560f, -0.741980412f,
+    0.669852271f, -0.742494400f,
+    0.669282588f, -0.743007952f,
+    0.668712512f, -0.743521067f,
+    0.668142041f, -0.744033744f,
+    0.667571178f, -0.744545984f,
+    0.666999922f, -0.745057785f,
+    0.666428274f, -0.745569149f,
+    0.665856234f, -0.746080074f,
+    0.665283802f, -0.746590559f,
+    0.664710978f, -0.747100606f,
+    0.664137764f, -0.747610213f,
+    0.663564159f, -0.748119380f,
+    0.662990163f, -0.748628108f,
+    0.662415778f, -0.749136395f,
+    0.661841002f, -0.749644241f,
+    0.661265838f, -0.750151646f,
+    0.660690284f, -0.750658610f,
+    0.660114342f, -0.751165132f,
+    0.659538012f, -0.751671212f,
+    0.658961293f, -0.752176850f,
+    0.658384187f, -0.752682046f,
+    0.657806693f, -0.753186799f,
+    0.657228813f, -0.753691109f,
+    0.656650546f, -0.754194975f,
+    0.656071892f, -0.754698398f,
+    0.655492853f, -0.755201377f,
+    0.654913428f, -0.755703911f,
+    0.654333618f, -0.756206001f,
+    0.653753423f, -0.756707647f,
+    0.653172843f, -0.757208847f,
+    0.652591879f, -0.757709601f,
+    0.652010531f, -0.758209910f,
+    0.651428800f, -0.758709773f,
+    0.650846685f, -0.759209189f,
+    0.650264187f, -0.759708159f,
+    0.649681307f, -0.760206682f,
+    0.649098045f, -0.760704757f,
+    0.648514401f, -0.761202385f,
+    0.647930375f, -0.761699566f,
+    0.647345969f, -0.762196298f,
+    0.646761181f, -0.762692582f,
+    0.646176013f, -0.763188417f,
+    0.645590465f, -0.763683804f,
+    0.645004537f, -0.764178741f,
+    0.644418229f, -0.764673228f,
+    0.643831543f, -0.765167266f,
+    0.643244478f, -0.765660853f,
+    0.642657034f, -0.766153990f,
+    0.642069212f, -0.766646677f,
+    0.641481013f, -0.767138912f,
+    0.640892436f, -0.767630696f,
+    0.640303482f, -0.768122029f,
+    0.639714152f, -0.768612909f,
+    0.639124445f, -0.769103338f,
+    0.638534362f, -0.769593314f,
+    0.637943904f, -0.770082837f,
+    0.637353070f, -0.770571907f,
+    0.636761861f, -0.771060524f,
+    0.636170278f, -0.771548688f,
+    0.635578320f, -0.772036397f,
+    0.634985989f, -0.772523652f,
+    0.634393284f, -0.773010453f,
+    0.633800206f, -0.773496799f,
+    0.633206755f, -0.773982691f,
+    0.632612932f, -0.774468126f,
+    0.632018736f, -0.774953107f,
+    0.631424169f, -0.775437631f,
+    0.630829230f, -0.775921699f,
+    0.630233920f, -0.776405311f,
+    0.629638239f, -0.776888466f,
+    0.629042188f, -0.777371164f,
+    0.628445767f, -0.777853404f,
+    0.627848976f, -0.778335187f,
+    0.627251815f, -0.778816512f,
+    0.626654286f, -0.779297379f,
+    0.626056388f, -0.779777788f,
+    0.625458122f, -0.780257738f,
+    0.624859488f, -0.780737229f,
+    0.624260486f, -0.781216260f,
+    0.623661118f, -0.781694832f,
+    0.623061382f, -0.782172944f,
+    0.622461279f, -0.782650596f,
+    0.621860811f, -0.783127788f,
+    0.621259977f, -0.783604519f,
+    0.620658777f, -0.784080789f,
+    0.620057212f, -0.784556597f,
+    0.619455282f, -0.785031944f,
+    0.618852988f, -0.785506830f,
+    0.618250330f, -0.785981253f,
+    0.617647308f, -0.786455214f,
+    0.617043923f, -0.786928712f,
+    0.616440175f, -0.787401747f,
+    0.615836064f, -0.787874319f,
+    0.615231591f, -0.788346428f,
+    0.614626756f, -0.788818072f,
+    0.614021559f, -0.789289253f,
+    0.613416001f, -0.789759970f,
+    0.612810082f, -0.790230221f,
+    0.612203803f, -0.790700008f,
+    0.611597164f, -0.791169330f,
+    0.610990165f, -0.791638187f,
+    0.610382806f, -0.792106577f,
+    0.609775089f, -0.792574502f,
+    0.609167012f, -0.793041960f,
+    0.608558578f, -0.793508952f,
+    0.607949785f, -0.793975478f,
+    0.607340635f, -0.794441536f,
+    0.606731127f, -0.794907126f,
+    0.606121263f, -0.795372249f,
+    0.605511041f, -0.795836905f,
+    0.604900464f, -0.796301092f,
+    0.604289531f, -0.796764810f,
+    0.603678242f, -0.797228060f,
+    0.603066599f, -0.797690841f,
+    0.602454600f, -0.798153153f,
+    0.601842247f, -0.798614995f,
+    0.601229540f, -0.799076367f,
+    0.600616479f, -0.799537269f,
+    0.600003065f, -0.799997701f,
+    0.599389298f, -0.800457662f,
+    0.598775179f, -0.800917153f,
+    0.598160707f, -0.801376172f,
+    0.597545883f, -0.801834719f,
+    0.596930708f, -0.802292796f,
+    0.596315182f, -0.802750400f,
+    0.595699304f, -0.803207531f,
+    0.595083077f, -0.803664191f,
+    0.594466499f, -0.804120377f,
+    0.593849572f, -0.804576091f,
+    0.593232295f, -0.805031331f,
+    0.592614669f, -0.805486098f,
+    0.591996695f, -0.805940391f,
+    0.591378372f, -0.806394209f,
+    0.590759702f, -0.806847554f,
+    0.590140684f, -0.807300423f,
+    0.589521319f, -0.807752818f,
+    0.588901607f, -0.808204737f,
+    0.588281548f, -0.808656182f,
+    0.587661144f, -0.809107150f,
+    0.587040394f, -0.809557642f,
+    0.586419298f, -0.810007659f,
+    0.585797857f, -0.810457198f,
+    0.585176072f, -0.810906261f,
+    0.584553943f, -0.811354847f,
+    0.583931470f, -0.811802956f,
+    0.583308653f, -0.812250587f,
+    0.582685493f, -0.812697740f,
+    0.582061990f, -0.813144415f,
+    0.581438145f, -0.813590612f,
+    0.580813958f, -0.814036330f,
+    0.580189429f, -0.814481569f,
+    0.579564559f, -0.814926329f,
+    0.578939348f, -0.815370610f,
+    0.578313796f, -0.815814411f,
+    0.577687905f, -0.816257732f,
+    0.577061673f, -0.816700573f,
+    0.576435102f, -0.817142933f,
+    0.575808191f, -0.817584813f,
+    0.575180942f, -0.818026212f,
+    0.574553355f, -0.818467130f,
+    0.573925430f, -0.818907566f,
+    0.573297167f, -0.819347520f,
+    0.572668566f, -0.819786992f,
+    0.572039629f, -0.820225983f,
+    0.571410356f, -0.820664490f,
+    0.570780746f, -0.821102515f,
+    0.570150800f, -0.821540057f,
+    0.569520519f, -0.821977115f,
+    0.568889903f, -0.822413690f,
+    0.568258953f, -0.822849781f,
+    0.567627668f, -0.823285388f,
+    0.566996049f, -0.823720511f,
+    0.566364096f, -0.824155149f,
+    0.565731811f, -0.824589303f,
+    0.565099192f, -0.825022971f,
+    0.564466242f, -0.825456154f,
+    0.563832959f, -0.825888851f,
+    0.563199344f, -0.826321063f,
+    0.562565398f, -0.826752788f,
+    0.561931121f, -0.827184027f,
+    0.561296514f, -0.827614780f,
+    0.560661576f, -0.828045045f,
+    0.560026309f, -0.828474824f,
+    0.559390712f, -0.828904115f,
+    0.558754786f, -0.829332918f,
+    0.558118531f, -0.829761234f,
+    0.557481948f, -0.830189061f,
+    0.556845037f, -0.830616400f,
+    0.556207799f, -0.831043251f,
+    0.555570233f, -0.831469612f,
+    0.554932340f, -0.831895485f,
+    0.554294121f, -0.832320868f,
+    0.553655576f, -0.832745761f,
+    0.553016706f, -0.833170165f,
+    0.552377509f, -0.833594078f,
+    0.551737988f, -0.834017501f,
+    0.551098143f, -0.834440433f,
+    0.550457973f, -0.834862875f,
+    0.549817479f, -0.835284825f,
+    0.549176662f, -0.835706284f,
+    0.548535522f, -0.836127252f,
+    0.547894059f, -0.836547727f,
+    0.547252274f, -0.836967711f,
+    0.546610167f, -0.837387202f,
+    0.545967738f, -0.837806200f,
+    0.545324988f, -0.838224706f,
+    0.544681918f, -0.838642718f,
+    0.544038527f, -0.839060237f,
+    0.543394816f, -0.839477263f,
+    0.542750785f, -0.839893794f,
+    0.542106435f, -0.840309832f,
+    0.541461766f, -0.840725375f,
+    0.540816778f, -0.841140424f,
+    0.540171473f, -0.841554977f,
+    0.539525849f, -0.841969036f,
+    0.538879909f, -0.842382600f,
+    0.538233651f, -0.842795668f,
+    0.537587076f, -0.843208240f,
+    0.536940186f, -0.843620316f,
+    0.536292979f, -0.844031895f,
+    0.535645457f, -0.844442979f,
+    0.534997620f, -0.844853565f,
+    0.534349468f, -0.845263655f,
+    0.533701002f, -0.845673247f,
+    0.533052222f, -0.846082342f,
+    0.532403128f, -0.846490939f,
+    0.531753721f, -0.846899038f,
+    0.531104001f, -0.847306639f,
+    0.530453969f, -0.847713741f,
+    0.529803625f, -0.848120345f,
+    0.529152969f, -0.848526450f,
+    0.528502002f, -0.848932055f,
+    0.527850723f, -0.849337161f,
+    0.527199135f, -0.849741768f,
+    0.526547236f, -0.850145875f,
+    0.525895027f, -0.850549481f,
+    0.525242510f, -0.850952587f,
+    0.524589683f, -0.851355193f,
+    0.523936547f, -0.851757298f,
+    0.523283103f, -0.852158902f,
+    0.522629352f, -0.852560004f,
+    0.521975293f, -0.852960605f,
+    0.521320927f, -0.853360704f,
+    0.520666254f, -0.853760301f,
+    0.520011275f, -0.854159396f,
+    0.519355990f, -0.854557988f,
+    0.518700400f, -0.854956078f,
+    0.518044504f, -0.855353665f,
+    0.517388304f, -0.855750748f,
+    0.516731799f, -0.856147328f,
+    0.516074990f, -0.856543405f,
+    0.515417878f, -0.856938977f,
+    0.514760463f, -0.857334046f,
+    0.514102744f, -0.857728610f,
+    0.513444723f, -0.858122670f,
+    0.512786401f, -0.858516224f,
+    0.512127776f, -0.858909274f,
+    0.511468850f, -0.859301818f,
+    0.510809624f, -0.859693857f,
+    0.510150097f, -0.860085390f,
+    0.509490269f, -0.860476418f,
+    0.508830143f, -0.860866939f,
+    0.508169716f, -0.861256953f,
+    0.507508991f, -0.861646461f,
+    0.506847967f, -0.862035462f,
+    0.506186645f, -0.862423956f,
+    0.505525026f, -0.862811943f,
+    0.504863109f, -0.863199422f,
+    0.504200894f, -0.863586393f,
+    0.503538384f, -0.863972856f,
+    0.502875577f, -0.864358811f,
+    0.502212474f, -0.864744258f,
+    0.501549076f, -0.865129195f,
+    0.500885383f, -0.865513624f,
+    0.500221395f, -0.865897544f,
+    0.499557113f, -0.866280954f,
+    0.498892537f, -0.866663855f,
+    0.498227667f, -0.867046246f,
+    0.497562504f, -0.867428126f,
+    0.496897049f, -0.867809497f,
+    0.496231301f, -0.868190357f,
+    0.495565262f, -0.868570706f,
+    0.494898931f, -0.868950544f,
+    0.494232309f, -0.869329871f,
+    0.493565396f, -0.869708687f,
+    0.492898192f, -0.870086991f,
+    0.492230699f, -0.870464783f,
+    0.491562916f, -0.870842063f,
+    0.490894844f, -0.871218831f,
+    0.490226483f, -0.871595087f,
+    0.489557834f, -0.871970829f,
+    0.488888897f, -0.872346059f,
+    0.488219672f, -0.872720775f,
+    0.487550160f, -0.873094978f,
+    0.486880361f, -0.873468668f,
+    0.486210276f, -0.873841843f,
+    0.485539905f, -0.874214505f,
+    0.484869248f, -0.874586652f,
+    0.484198306f, -0.874958285f,
+    0.483527079f, -0.875329403f,
+    0.482855568f, -0.875700006f,
+    0.482183772f, -0.876070094f,
+    0.481511693f, -0.876439667f,
+    0.480839331f, -0.876808724f,
+    0.480166685f, -0.877177265f,
+    0.479493758f, -0.877545290f,
+    0.478820548f, -0.877912799f,
+    0.478147056f, -0.878279792f,
+    0.477473284f, -0.878646267f,
+    0.476799230f, -0.879012226f,
+    0.476124896f, -0.879377668f,
+    0.475450282f, -0.879742593f,
+    0.474775388f, -0.880107000f,
+    0.474100215f, -0.880470889f,
+    0.473424763f, -0.880834260f,
+    0.472749032f, -0.881197113f,
+    0.472073023f, -0.881559448f,
+    0.471396737f, -0.881921264f,
+    0.470720173f, -0.882282562f,
+    0.470043332f, -0.882643340f,
+    0.469366215f, -0.883003599f,
+    0.468688822f, -0.883363339f,
+    0.468011153f, -0.883722559f,
+    0.467333209f, -0.884081259f,
+    0.466654990f, -0.884439439f,
+    0.465976496f, -0.884797098f,
+    0.465297728f, -0.885154238f,
+    0.464618686f, -0.885510856f,
+    0.463939371f, -0.885866954f,
+    0.463259784f, -0.886222530f,
+    0.462579923f, -0.886577585f,
+    0.461899791f, -0.886932119f,
+    0.461219386f, -0.887286131f,
+    0.460538711f, -0.887639620f,
+    0.459857765f, -0.887992588f,
+    0.459176548f, -0.888345033f,
+    0.458495060f, -0.888696956f,
+    0.457813304f, -0.889048356f,
+    0.457131277f, -0.889399233f,
+    0.456448982f, -0.889749586f,
+    0.455766419f, -0.890099417f,
+    0.455083587f, -0.890448723f,
+    0.454400488f, -0.890797506f,
+    0.453717121f, -0.891145765f,
+    0.453033487f, -0.891493499f,
+    0.452349587f, -0.891840709f,
+    0.451665421f, -0.892187395f,
+    0.450980989f, -0.892533555f,
+    0.450296292f, -0.892879191f,
+    0.449611330f, -0.893224301f,
+    0.448926103f, -0.893568886f,
+    0.448240612f, -0.893912945f,
+    0.447554858f, -0.894256478f,
+    0.446868840f, -0.894599486f,
+    0.446182560f, -0.894941967f,
+    0.445496017f, -0.895283921f,
+    0.444809211f, -0.895625349f,
+    0.444122145f, -0.895966250f,
+    0.443434816f, -0.896306624f,
+    0.442747228f, -0.896646470f,
+    0.442059378f, -0.896985789f,
+    0.441371269f, -0.897324581f,
+    0.440682900f, -0.897662844f,
+    0.439994271f, -0.898000580f,
+    0.439305384f, -0.898337787f,
+    0.438616239f, -0.898674466f,
+    0.437926835f, -0.899010616f,
+    0.437237174f, -0.899346237f,
+    0.436547255f, -0.899681329f,
+    0.435857080f, -0.900015892f,
+    0.435166648f, -0.900349925f,
+    0.434475961f, -0.900683429f,
+    0.433785017f, -0.901016403f,
+    0.433093819f, -0.901348847f,
+    0.432402366f, -0.901680761f,
+    0.431710658f, -0.902012144f,
+    0.431018696f, -0.902342996f,
+    0.430326481f, -0.902673318f,
+    0.429634013f, -0.903003109f,
+    0.428941292f, -0.903332368f,
+    0.428248319f, -0.903661097f,
+    0.427555093f, -0.903989293f,
+    0.426861617f, -0.904316958f,
+    0.426167889f, -0.904644091f,
+    0.425473910f, -0.904970691f,
+    0.424779681f, -0.905296759f,
+    0.424085202f, -0.905622295f,
+    0.423390474f, -0.905947298f,
+    0.422695497f, -0.906271768f,
+    0.422000271f, -0.906595705f,
+    0.421304797f, -0.906919108f,
+    0.420609074f, -0.907241978f,
+    0.419913105f, -0.907564314f,
+    0.419216888f, -0.907886116f,
+    0.418520425f, -0.908207385f,
+    0.417823716f, -0.908528119f,
+    0.417126761f, -0.908848318f,
+    0.416429560f, -0.909167983f,
+    0.415732115f, -0.909487113f,
+    0.415034424f, -0.909805708f,
+    0.414336490f, -0.910123768f,
+    0.413638312f, -0.910441292f,
+    0.412939891f, -0.910758281f,
+    0.412241227f, -0.911074734f,
+    0.411542320f, -0.911390651f,
+    0.410843171f, -0.911706032f,
+    0.410143781f, -0.912020877f,
+    0.409444149f, -0.912335185f,
+    0.408744276f, -0.912648956f,
+    0.408044163f, -0.912962190f,
+    0.407343810f, -0.913274888f,
+    0.406643217f, -0.913587048f,
+    0.405942385f, -0.913898671f,
+    0.405241314f, -0.914209756f,
+    0.404540005f, -0.914520303f,
+    0.403838458f, -0.914830312f,
+    0.403136673f, -0.915139783f,
+    0.402434651f, -0.915448716f,
+    0.401732392f, -0.915757110f,
+    0.401029897f, -0.916064966f,
+    0.400327166f, -0.916372282f,
+    0.399624200f, -0.916679060f,
+    0.398920998f, -0.916985298f,
+    0.398217562f, -0.917290997f,
+    0.397513892f, -0.917596156f,
+    0.396809987f, -0.917900776f,
+    0.396105850f, -0.918204855f,
+    0.395401479f, -0.918508394f,
+    0.394696876f, -0.918811393f,
+    0.393992040f, -0.919113852f,
+    0.393286973f, -0.919415769f,
+    0.392581674f, -0.919717146f,
+    0.391876144f, -0.920017982f,
+    0.391170384f, -0.920318277f,
+    0.390464394f, -0.920618030f,
+    0.389758174f, -0.920917242f,
+    0.389051725f, -0.921215911f,
+    0.388345047f, -0.921514039f,
+    0.387638140f, -0.921811625f,
+    0.386931006f, -0.922108669f,
+    0.386223643f, -0.922405170f,
+    0.385516054f, -0.922701128f,
+    0.384808238f, -0.922996544f,
+    0.384100195f, -0.923291417f,
+    0.383391926f, -0.923585746f,
+    0.382683432f, -0.923879533f,
+    0.381974713f, -0.924172775f,
+    0.381265769f, -0.924465474f,
+    0.380556601f, -0.924757630f,
+    0.379847209f, -0.925049241f,
+    0.379137593f, -0.925340308f,
+    0.378427755f, -0.925630831f,
+    0.377717694f, -0.925920809f,
+    0.377007410f, -0.926210242f,
+    0.376296905f, -0.926499131f,
+    0.375586178f, -0.926787474f,
+    0.374875231f, -0.927075273f,
+    0.374164063f, -0.927362526f,
+    0.373452675f, -0.927649233f,
+    0.372741067f, -0.927935395f,
+    0.372029240f, -0.928221011f,
+    0.371317194f, -0.928506080f,
+    0.370604930f, -0.928790604f,
+    0.369892447f, -0.929074581f,
+    0.369179747f, -0.929358012f,
+    0.368466830f, -0.929640896f,
+    0.367753696f, -0.929923233f,
+    0.367040346f, -0.930205023f,
+    0.366326780f, -0.930486266f,
+    0.365612998f, -0.930766961f,
+    0.364899001f, -0.931047109f,
+    0.364184790f, -0.931326709f,
+    0.363470364f, -0.931605761f,
+    0.362755724f, -0.931884266f,
+    0.362040871f, -0.932162222f,
+    0.361325806f, -0.932439629f,
+    0.360610527f, -0.932716488f,
+    0.359895037f, -0.932992799f,
+    0.359179334f, -0.933268560f,
+    0.358463421f, -0.933543773f,
+    0.357747296f, -0.933818436f,
+    0.357030961f, -0.934092550f,
+    0.356314416f, -0.934366115f,
+    0.355597662f, -0.934639130f,
+    0.354880698f, -0.934911595f,
+    0.354163525f, -0.935183510f,
+    0.353446145f, -0.935454875f,
+    0.352728556f, -0.935725689f,
+    0.352010759f, -0.935995954f,
+    0.351292756f, -0.936265667f,
+    0.350574546f, -0.936534830f,
+    0.349856130f, -0.936803442f,
+    0.349137508f, -0.937071502f,
+    0.348418680f, -0.937339012f,
+    0.347699648f, -0.937605970f,
+    0.346980411f, -0.937872376f,
+    0.346260970f, -0.938138231f,
+    0.345541325f, -0.938403534f,
+    0.344821477f, -0.938668285f,
+    0.344101426f, -0.938932484f,
+    0.343381173f, -0.939196130f,
+    0.342660717f, -0.939459224f,
+    0.341940060f, -0.939721765f,
+    0.341219202f, -0.939983753f,
+    0.340498144f, -0.940245188f,
+    0.339776884f, -0.940506071f,
+    0.339055425f, -0.940766400f,
+    0.338333767f, -0.941026175f,
+    0.337611909f, -0.941285397f,
+    0.336889853f, -0.941544065f,
+    0.336167599f, -0.941802179f,
+    0.335445147f, -0.942059740f,
+    0.334722498f, -0.942316746f,
+    0.333999651f, -0.942573198f,
+    0.333276609f, -0.942829095f,
+    0.332553370f, -0.943084437f,
+    0.331829935f, -0.943339225f,
+    0.331106306f, -0.943593458f,
+    0.330382481f, -0.943847136f,
+    0.329658463f, -0.944100258f,
+    0.328934250f, -0.944352826f,
+    0.328209844f, -0.944604837f,
+    0.327485244f, -0.944856293f,
+    0.326760452f, -0.945107193f,
+    0.326035468f, -0.945357537f,
+    0.325310292f, -0.945607325f,
+    0.324584925f, -0.945856557f,
+    0.323859367f, -0.946105232f,
+    0.323133618f, -0.946353351f,
+    0.322407679f, -0.946600913f,
+    0.321681550f, -0.946847918f,
+    0.320955232f, -0.947094366f,
+    0.320228726f, -0.947340257f,
+    0.319502031f, -0.947585591f,
+    0.318775148f, -0.947830367f,
+    0.318048077f, -0.948074586f,
+    0.317320820f, -0.948318247f,
+    0.316593376f, -0.948561350f,
+    0.315865745f, -0.948803895f,
+    0.315137929f, -0.949045882f,
+    0.314409927f, -0.949287310f,
+    0.313681740f, -0.949528181f,
+    0.312953369f, -0.949768492f,
+    0.312224814f, -0.950008245f,
+    0.311496075f, -0.950247439f,
+    0.310767153f, -0.950486074f,
+    0.310038048f, -0.950724150f,
+    0.309308760f, -0.950961666f,
+    0.308579291f, -0.951198623f,
+    0.307849640f, -0.951435021f,
+    0.307119808f, -0.951670859f,
+    0.306389795f, -0.951906137f,
+    0.305659602f, -0.952140855f,
+    0.304929230f, -0.952375013f,
+    0.304198678f, -0.952608610f,
+    0.303467947f, -0.952841648f,
+    0.302737037f, -0.953074124f,
+    0.302005949f, -0.953306040f,
+    0.301274684f, -0.953537396f,
+    0.300543241f, -0.953768190f,
+    0.299811622f, -0.953998423f,
+    0.299079826f, -0.954228095f,
+    0.298347855f, -0.954457206f,
+    0.297615707f, -0.954685755f,
+    0.296883385f, -0.954913742f,
+    0.296150888f, -0.955141168f,
+    0.295418217f, -0.955368032f,
+    0.294685372f, -0.955594334f,
+    0.293952354f, -0.955820074f,
+    0.293219163f, -0.956045251f,
+    0.292485799f, -0.956269866f,
+    0.291752263f, -0.956493919f,
+    0.291018556f, -0.956717409f,
+    0.290284677f, -0.956940336f,
+    0.289550628f, -0.957162700f,
+    0.288816408f, -0.957384501f,
+    0.288082019f, -0.957605739f,
+    0.287347460f, -0.957826413f,
+    0.286612731f, -0.958046524f,
+    0.285877835f, -0.958266071f,
+    0.285142770f, -0.958485055f,
+    0.284407537f, -0.958703475f,
+    0.283672137f, -0.958921331f,
+    0.282936570f, -0.959138622f,
+    0.282200837f, -0.959355350f,
+    0.281464938f, -0.959571513f,
+    0.280728873f, -0.959787112f,
+    0.279992643f, -0.960002146f,
+    0.279256248f, -0.960216615f,
+    0.278519689f, -0.960430519f,
+    0.277782967f, -0.960643859f,
+    0.277046080f, -0.960856633f,
+    0.276309031f, -0.961068842f,
+    0.275571819f, -0.961280486f,
+    0.274834445f, -0.961491564f,
+    0.274096910f, -0.961702077f,
+    0.273359213f, -0.961912023f,
+    0.272621355f, -0.962121404f,
+    0.271883337f, -0.962330219f,
+    0.271145160f, -0.962538468f,
+    0.270406822f, -0.962746151f,
+    0.269668326f, -0.962953267f,
+    0.268929670f, -0.963159817f,
+    0.268190857f, -0.963365800f,
+    0.267451886f, -0.963571216f,
+    0.266712757f, -0.963776066f,
+    0.265973472f, -0.963980348f,
+    0.265234030f, -0.964184064f,
+    0.264494432f, -0.964387212f,
+    0.263754679f, -0.964589793f,
+    0.263014770f, -0.964791807f,
+    0.262274707f, -0.964993253f,
+    0.261534489f, -0.965194131f,
+    0.260794118f, -0.965394442f,
+    0.260053593f, -0.965594184f,
+    0.259312915f, -0.965793359f,
+    0.258572085f, -0.965991965f,
+    0.257831102f, -0.966190003f,
+    0.257089968f, -0.966387473f,
+    0.256348682f, -0.966584374f,
+    0.255607246f, -0.966780707f,
+    0.254865660f, -0.966976471f,
+    0.254123923f, -0.967171666f,
+    0.253382037f, -0.967366292f,
+    0.252640002f, -0.967560349f,
+    0.251897818f, -0.967753837f,
+    0.251155486f, -0.967946756f,
+    0.250413007f, -0.968139105f,
+    0.249670380f, -0.968330884f,
+    0.248927606f, -0.968522094f,
+    0.248184685f, -0.968712734f,
+    0.247441619f, -0.968902805f,
+    0.246698407f, -0.969092305f,
+    0.245955050f, -0.969281235f,
+    0.245211549f, -0.969469595f,
+    0.244467903f, -0.969657385f,
+    0.243724113f, -0.969844604f,
+    0.242980180f, -0.970031253f,
+    0.242236104f, -0.970217331f,
+    0.241491885f, -0.970402839f,
+    0.240747525f, -0.970587775f,
+    0.240003022f, -0.970772141f,
+    0.239258379f, -0.970955935f,
+    0.238513595f, -0.971139158f,
+    0.237768670f, -0.971321810f,
+    0.237023606f, -0.971503891f,
+    0.236278402f, -0.971685400f,
+    0.235533059f, -0.971866337f,
+    0.234787578f, -0.972046703f,
+    0.234041959f, -0.972226497f,
+    0.233296201f, -0.972405719f,
+    0.232550307f, -0.972584369f,
+    0.231804276f, -0.972762447f,
+    0.231058108f, -0.972939952f,
+    0.230311805f, -0.973116885f,
+    0.229565366f, -0.973293246f,
+    0.228818792f, -0.973469034f,
+    0.228072083f, -0.973644250f,
+    0.227325240f, -0.973818892f,
+    0.226578264f, -0.973992962f,
+    0.225831154f, -0.974166459f,
+    0.225083911f, -0.974339383f,
+    0.224336536f, -0.974511733f,
+    0.223589029f, -0.974683511f,
+    0.222841391f, -0.974854715f,
+    0.222093621f, -0.975025345f,
+    0.221345721f, -0.975195402f,
+    0.220597690f, -0.975364885f,
+    0.219849530f, -0.975533795f,
+    0.219101240f, -0.975702130f,
+    0.218352822f, -0.975869892f,
+    0.217604275f, -0.976037079f,
+    0.216855600f, -0.976203692f,
+    0.216106797f, -0.976369731f,
+    0.215357867f, -0.976535196f,
+    0.214608811f, -0.976700086f,
+    0.213859628f, -0.976864402f,
+    0.213110320f, -0.977028143f,
+    0.212360886f, -0.977191309f,
+    0.211611327f, -0.977353900f,
+    0.210861644f, -0.977515917f,
+    0.210111837f, -0.977677358f,
+    0.209361906f, -0.977838224f,
+    0.208611852f, -0.977998515f,
+    0.207861675f, -0.978158231f,
+    0.207111376f, -0.978317371f,
+    0.206360955f, -0.978475935f,
+    0.205610413f, -0.978633924f,
+    0.204859750f, -0.978791338f,
+    0.204108966f, -0.978948175f,
+    0.203358062f, -0.979104437f,
+    0.202607039f, -0.979260123f,
+    0.201855896f, -0.979415232f,
+    0.201104635f, -0.979569766f,
+    0.200353255f, -0.979723723f,
+    0.199601758f, -0.979877104f,
+    0.198850143f, -0.980029908f,
+    0.198098411f, -0.980182136f,
+    0.197346562f, -0.980333787f,
+    0.196594598f, -0.980484862f,
+    0.195842517f, -0.980635360f,
+    0.195090322f, -0.980785280f,
+    0.194338012f, -0.980934624f,
+    0.193585587f, -0.981083391f,
+    0.192833049f, -0.981231581f,
+    0.192080397f, -0.981379193f,
+    0.191327632f, -0.981526228f,
+    0.190574755f, -0.981672686f,
+    0.189821765f, -0.981818566f,
+    0.189068664f, -0.981963869f,
+    0.188315452f, -0.982108594f,
+    0.187562129f, -0.982252741f,
+    0.186808695f, -0.982396311f,
+    0.186055152f, -0.982539302f,
+    0.185301499f, -0.982681716f,
+    0.184547737f, -0.982823551f,
+    0.183793867f, -0.982964808f,
+    0.183039888f, -0.983105487f,
+    0.182285802f, -0.983245588f,
+    0.181531608f, -0.983385110f,
+    0.180777308f, -0.983524054f,
+    0.180022901f, -0.983662419f,
+    0.179268389f, -0.983800206f,
+    0.178513771f, -0.983937413f,
+    0.177759048f, -0.984074042f,
+    0.177004220f, -0.984210092f,
+    0.176249289f, -0.984345563f,
+    0.175494253f, -0.984480455f,
+    0.174739115f, -0.984614768f,
+    0.173983873f, -0.984748502f,
+    0.173228530f, -0.984881656f,
+    0.172473084f, -0.985014231f,
+    0.171717537f, -0.985146226f,
+    0.170961889f, -0.985277642f,
+    0.170206140f, -0.985408479f,
+    0.169450291f, -0.985538735f,
+    0.168694343f, -0.985668412f,
+    0.167938295f, -0.985797509f,
+    0.167182148f, -0.985926026f,
+    0.166425904f, -0.986053963f,
+    0.165669561f, -0.986181320f,
+    0.164913120f, -0.986308097f,
+    0.164156583f, -0.986434294f,
+    0.163399949f, -0.986559910f,
+    0.162643219f, -0.986684946f,
+    0.161886394f, -0.986809402f,
+    0.161129473f, -0.986933277f,
+    0.160372457f, -0.987056571f,
+    0.159615347f, -0.987179285f,
+    0.158858143f, -0.987301418f,
+    0.158100846f, -0.987422970f,
+    0.157343456f, -0.987543942f,
+    0.156585973f, -0.987664332f,
+    0.155828398f, -0.987784142f,
+    0.155070731f, -0.987903370f,
+    0.154312973f, -0.988022017f,
+    0.153555124f, -0.988140083f,
+    0.152797185f, -0.988257568f,
+    0.152039156f, -0.988374471f,
+    0.151281038f, -0.988490793f,
+    0.150522831f, -0.988606533f,
+    0.149764535f, -0.988721692f,
+    0.149006151f, -0.988836269f,
+    0.148247679f, -0.988950265f,
+    0.147489120f, -0.989063678f,
+    0.146730474f, -0.989176510f,
+    0.145971742f, -0.989288760f,
+    0.145212925f, -0.989400428f,
+    0.144454021f, -0.989511514f,
+    0.143695033f, -0.989622017f,
+    0.142935960f, -0.989731939f,
+    0.142176804f, -0.989841278f,
+    0.141417563f, -0.989950036f,
+    0.140658239f, -0.990058210f,
+    0.139898833f, -0.990165803f,
+    0.139139344f, -0.990272812f,
+    0.138379774f, -0.990379240f,
+    0.137620122f, -0.990485084f,
+    0.136860389f, -0.990590346f,
+    0.136100575f, -0.990695025f,
+    0.135340682f, -0.990799122f,
+    0.134580709f, -0.990902635f,
+    0.133820656f, -0.991005566f,
+    0.133060525f, -0.991107914f,
+    0.132300316f, -0.991209678f,
+    0.131540029f, -0.991310860f,
+    0.130779664f, -0.991411458f,
+    0.130019223f, -0.991511473f,
+    0.129258705f, -0.991610905f,
+    0.128498111f, -0.991709754f,
+    0.127737441f, -0.991808019f,
+    0.126976696f, -0.991905700f,
+    0.126215877f, -0.992002799f,
+    0.125454983f, -0.992099313f,
+    0.124694016f, -0.992195244f,
+    0.123932975f, -0.992290591f,
+    0.123171861f, -0.992385355f,
+    0.122410675f, -0.992479535f,
+    0.121649417f, -0.992573130f,
+    0.120888087f, -0.992666142f,
+    0.120126686f, -0.992758570f,
+    0.119365215f, -0.992850414f,
+    0.118603673f, -0.992941674f,
+    0.117842062f, -0.993032350f,
+    0.117080381f, -0.993122442f,
+    0.116318631f, -0.993211949f,
+    0.115556813f, -0.993300872f,
+    0.114794927f, -0.993389211f,
+    0.114032973f, -0.993476966f,
+    0.113270952f, -0.993564136f,
+    0.112508865f, -0.993650721f,
+    0.111746711f, -0.993736722f,
+    0.110984492f, -0.993822138f,
+    0.110222207f, -0.993906970f,
+    0.109459858f, -0.993991217f,
+    0.108697444f, -0.994074879f,
+    0.107934966f, -0.994157957f,
+    0.107172425f, -0.994240449f,
+    0.106409821f, -0.994322357f,
+    0.105647154f, -0.994403680f,
+    0.104884425f, -0.994484418f,
+    0.104121634f, -0.994564571f,
+    0.103358782f, -0.994644138f,
+    0.102595869f, -0.994723121f,
+    0.101832896f, -0.994801519f,
+    0.101069863f, -0.994879331f,
+    0.100306770f, -0.994956558f,
+    0.099543619f, -0.995033199f,
+    0.098780409f, -0.995109256f,
+    0.098017140f, -0.995184727f,
+    0.097253814f, -0.995259612f,
+    0.096490431f, -0.995333912f,
+    0.095726991f, -0.995407627f,
+    0.094963495f, -0.995480755f,
+    0.094199943f, -0.995553299f,
+    0.093436336f, -0.995625256f,
+    0.092672673f, -0.995696628f,
+    0.091908956f, -0.995767414f,
+    0.091145185f, -0.995837615f,
+    0.090381361f, -0.995907229f,
+    0.089617483f, -0.995976258f,
+    0.088853553f, -0.996044701f,
+    0.088089570f, -0.996112558f,
+    0.087325535f, -0.996179829f,
+    0.086561449f, -0.996246513f,
+    0.085797312f, -0.996312612f,
+    0.085033125f, -0.996378125f,
+    0.084268888f, -0.996443051f,
+    0.083504601f, -0.996507392f,
+    0.082740265f, -0.996571146f,
+    0.081975880f, -0.996634314f,
+    0.081211447f, -0.996696895f,
+    0.080446966f, -0.996758890f,
+    0.079682438f, -0.996820299f,
+    0.078917863f, -0.996881122f,
+    0.078153242f, -0.996941358f,
+    0.077388574f, -0.997001007f,
+    0.076623861f, -0.997060070f,
+    0.075859103f, -0.997118547f,
+    0.075094301f, -0.997176437f,
+    0.074329454f, -0.997233740f,
+    0.073564564f, -0.997290457f,
+    0.072799630f, -0.997346587f,
+    0.072034653f, -0.997402130f,
+    0.071269634f, -0.997457086f,
+    0.070504573f, -0.997511456f,
+    0.069739471f, -0.997565239f,
+    0.068974328f, -0.997618435f,
+    0.068209144f, -0.997671044f,
+    0.067443920f, -0.997723067f,
+    0.066678656f, -0.997774502f,
+    0.065913353f, -0.997825350f,
+    0.065148011f, -0.997875612f,
+    0.064382631f, -0.997925286f,
+    0.063617213f, -0.997974374f,
+    0.062851758f, -0.998022874f,
+    0.062086265f, -0.998070787f,
+    0.061320736f, -0.998118113f,
+    0.060555171f, -0.998164852f,
+    0.059789571f, -0.998211003f,
+    0.059023935f, -0.998256568f,
+    0.058258265f, -0.998301545f,
+    0.057492560f, -0.998345935f,
+    0.056726821f, -0.998389737f,
+    0.055961049f, -0.998432953f,
+    0.055195244f, -0.998475581f,
+    0.054429407f, -0.998517621f,
+    0.053663538f, -0.998559074f,
+    0.052897637f, -0.998599940f,
+    0.052131705f, -0.998640218f,
+    0.051365742f, -0.998679909f,
+    0.050599749f, -0.998719012f,
+    0.049833726f, -0.998757528f,
+    0.049067674f, -0.998795456f,
+    0.048301593f, -0.998832797f,
+    0.047535484f, -0.998869550f,
+    0.046769347f, -0.998905715f,
+    0.046003182f, -0.998941293f,
+    0.045236990f, -0.998976283f,
+    0.044470772f, -0.999010686f,
+    0.043704527f, -0.999044501f,
+    0.042938257f, -0.999077728f,
+    0.042171961f, -0.999110367f,
+    0.041405641f, -0.999142419f,
+    0.040639296f, -0.999173883f,
+    0.039872928f, -0.999204759f,
+    0.039106535f, -0.999235047f,
+    0.038340120f, -0.999264747f,
+    0.037573683f, -0.999293860f,
+    0.036807223f, -0.999322385f,
+    0.036040742f, -0.999350321f,
+    0.035274239f, -0.999377670f,
+    0.034507716f, -0.999404431f,
+    0.033741172f, -0.999430605f,
+    0.032974608f, -0.999456190f,
+    0.032208025f, -0.999481187f,
+    0.031441424f, -0.999505596f,
+    0.030674803f, -0.999529418f,
+    0.029908165f, -0.999552651f,
+    0.029141509f, -0.999575296f,
+    0.028374836f, -0.999597353f,
+    0.027608146f, -0.999618822f,
+    0.026841440f, -0.999639704f,
+    0.026074718f, -0.999659997f,
+    0.025307981f, -0.999679702f,
+    0.024541229f, -0.999698819f,
+    0.023774462f, -0.999717348f,
+    0.023007681f, -0.999735288f,
+    0.022240887f, -0.999752641f,
+    0.021474080f, -0.999769405f,
+    0.020707261f, -0.999785582f,
+    0.019940429f, -0.999801170f,
+    0.019173585f, -0.999816170f,
+    0.018406730f, -0.999830582f,
+    0.017639864f, -0.999844405f,
+    0.016872988f, -0.999857641f,
+    0.016106102f, -0.999870288f,
+    0.015339206f, -0.999882347f,
+    0.014572302f, -0.999893818f,
+    0.013805389f, -0.999904701f,
+    0.013038467f, -0.999914996f,
+    0.012271538f, -0.999924702f,
+    0.011504602f, -0.999933820f,
+    0.010737659f, -0.999942350f,
+    0.009970710f, -0.999950291f,
+    0.009203755f, -0.999957645f,
+    0.008436794f, -0.999964410f,
+    0.007669829f, -0.999970586f,
+    0.006902859f, -0.999976175f,
+    0.006135885f, -0.999981175f,
+    0.005368907f, -0.999985587f,
+    0.004601926f, -0.999989411f,
+    0.003834943f, -0.999992647f,
+    0.003067957f, -0.999995294f,
+    0.002300969f, -0.999997353f,
+    0.001533980f, -0.999998823f,
+    0.000766990f, -0.999999706f
+};
+#endif /* #if defined (ARM_MATH_RFFT_8192) */
+
+
+/**    
+* \par    
+* Example code for the Floating-point Twiddle factors of the mixed-radix CFFT:    
+* \par    
+* <pre>for(i = 0; i< N; i++)    
+* {    
+*	twiddleCoef[2*i]= cos(i * 2*PI/(float)N);    
+*	twiddleCoef[2*i+1]= sin(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 3840	and PI = 3.14159265358979    
+* \par    
+* Cos and Sin values are in interleaved fashion.  The transforms of length L,    
+* a divisor of 3840, read every (3840/L)th pair.    
+*     
+*/
+const float32_t twiddleCoef_3840[7680] = {
+    1.000000000f,  0.000000000f,
+    0.999998661f,  0.001636245f,
+    0.999994645f,  0.003272487f,
+    0.999987952f,  0.004908719f,
+    0.999978582f,  0.006544938f,
+    0.999966534f,  0.008181140f,
+    0.999951809f,  0.009817319f,
+    0.999934407f,  0.011453473f,
+    0.999914328f,  0.013089596f,
+    0.999891571f,  0.014725683f,
+    0.999866138f,  0.016361732f,
+    0.999838028f,  0.017997736f,
+    0.999807240f,  0.019633692f,
+    0.999773777f,  0.021269596f,
+    0.999737636f,  0.022905443f,
+    0.999698819f,  0.024541229f,
+    0.999657325f,  0.026176948f,
+    0.999613155f,  0.027812598f,
+    0.999566309f,  0.029448173f,
+    0.999516786f,  0.031083670f,
+    0.999464587f,  0.032719083f,
+    0.999409713f,  0.034354408f,
+    0.999352163f,  0.035989642f,
+    0.999291937f,  0.037624779f,
+    0.999229036f,  0.039259816f,
+    0.999163460f,  0.040894747f,
+    0.999095209f,  0.042529569f,
+    0.999024282f,  0.044164277f,
+    0.998950681f,  0.045798867f,
+    0.998874406f,  0.047433334f,
+    0.998795456f,  0.049067674f,
+    0.998713832f,  0.050701883f,
+    0.998629535f,  0.052335956f,
+    0.998542563f,  0.053969889f,
+    0.998452919f,  0.055603678f,
+    0.998360601f,  0.057237317f,
+    0.998265610f,  0.058870804f,
+    0.998167947f,  0.060504132f,
+    0.998067611f,  0.062137299f,
+    0.997964603f,  0.063770300f,
+    0.997858923f,  0.065403129f,
+    0.997750572f,  0.067035784f,
+    0.997639549f,  0.068668259f,
+    0.997525856f,  0.070300550f,
+    0.997409491f,  0.071932653f,
+    0.997290457f,  0.073564564f,
+    0.997168752f,  0.075196277f,
+    0.997044378f,  0.076827789f,
+    0.996917334f,  0.078459096f,
+    0.996787621f,  0.080090192f,
+    0.996655239f,  0.081721074f,
+    0.996520189f,  0.083351737f,
+    0.996382472f,  0.084982177f,
+    0.996242086f,  0.086612390f,
+    0.996099033f,  0.088242371f,
+    0.995953314f,  0.089872115f,
+    0.995804928f,  0.091501619f,
+    0.995653875f,  0.093130877f,
+    0.995500158f,  0.094759887f,
+    0.995343775f,  0.096388643f,
+    0.995184727f,  0.098017140f,
+    0.995023014f,  0.099645376f,
+    0.994858638f,  0.101273344f,
+    0.994691598f,  0.102901041f,
+    0.994521895f,  0.104528463f,
+    0.994349530f,  0.106155605f,
+    0.994174502f,  0.107782463f,
+    0.993996813f,  0.109409032f,
+    0.993816462f,  0.111035309f,
+    0.993633451f,  0.112661288f,
+    0.993447779f,  0.114286965f,
+    0.993259448f,  0.115912336f,
+    0.993068457f,  0.117537397f,
+    0.992874808f,  0.119162144f,
+    0.992678500f,  0.120786571f,
+    0.992479535f,  0.122410675f,
+    0.992277912f,  0.124034451f,
+    0.992073633f,  0.125657896f,
+    0.991866698f,  0.127281003f,
+    0.991657107f,  0.128903770f,
+    0.991444861f,  0.130526192f,
+    0.991229961f,  0.132148265f,
+    0.991012407f,  0.133769983f,
+    0.990792200f,  0.135391344f,
+    0.990569340f,  0.137012342f,
+    0.990343829f,  0.138632973f,
+    0.990115665f,  0.140253233f,
+    0.989884851f,  0.141873117f,
+    0.989651387f,  0.143492622f,
+    0.989415273f,  0.145111742f,
+    0.989176510f,  0.146730474f,
+    0.988935099f,  0.148348814f,
+    0.988691040f,  0.149966756f,
+    0.988444334f,  0.151584296f,
+    0.988194982f,  0.153201431f,
+    0.987942984f,  0.154818155f,
+    0.987688341f,  0.156434465f,
+    0.987431053f,  0.158050356f,
+    0.987171122f,  0.159665824f,
+    0.986908548f,  0.161280865f,
+    0.986643332f,  0.162895473f,
+    0.986375474f,  0.164509646f,
+    0.986104976f,  0.166123378f,
+    0.985831837f,  0.167736666f,
+    0.985556059f,  0.169349504f,
+    0.985277642f,  0.170961889f,
+    0.984996588f,  0.172573816f,
+    0.984712896f,  0.174185281f,
+    0.984426568f,  0.175796280f,
+    0.984137604f,  0.177406808f,
+    0.983846006f,  0.179016861f,
+    0.983551773f,  0.180626435f,
+    0.983254908f,  0.182235525f,
+    0.982955409f,  0.183844128f,
+    0.982653279f,  0.185452238f,
+    0.982348519f,  0.187059852f,
+    0.982041128f,  0.188666965f,
+    0.981731108f,  0.190273572f,
+    0.981418459f,  0.191879671f,
+    0.981103183f,  0.193485255f,
+    0.980785280f,  0.195090322f,
+    0.980464752f,  0.196694866f,
+    0.980141598f,  0.198298884f,
+    0.979815821f,  0.199902371f,
+    0.979487420f,  0.201505322f,
+    0.979156396f,  0.203107734f,
+    0.978822751f,  0.204709603f,
+    0.978486486f,  0.206310923f,
+    0.978147601f,  0.207911691f,
+    0.977806097f,  0.209511902f,
+    0.977461975f,  0.211111552f,
+    0.977115236f,  0.212710637f,
+    0.976765881f,  0.214309153f,
+    0.976413911f,  0.215907095f,
+    0.976059327f,  0.217504459f,
+    0.975702130f,  0.219101240f,
+    0.975342321f,  0.220697435f,
+    0.974979900f,  0.222293039f,
+    0.974614869f,  0.223888048f,
+    0.974247228f,  0.225482457f,
+    0.973876979f,  0.227076263f,
+    0.973504123f,  0.228669461f,
+    0.973128661f,  0.230262046f,
+    0.972750593f,  0.231854016f,
+    0.972369920f,  0.233445364f,
+    0.971986645f,  0.235036087f,
+    0.971600767f,  0.236626181f,
+    0.971212288f,  0.238215642f,
+    0.970821208f,  0.239804465f,
+    0.970427530f,  0.241392645f,
+    0.970031253f,  0.242980180f,
+    0.969632379f,  0.244567064f,
+    0.969230910f,  0.246153293f,
+    0.968826845f,  0.247738863f,
+    0.968420187f,  0.249323770f,
+    0.968010935f,  0.250908009f,
+    0.967599092f,  0.252491577f,
+    0.967184659f,  0.254074469f,
+    0.966767636f,  0.255656680f,
+    0.966348025f,  0.257238207f,
+    0.965925826f,  0.258819045f,
+    0.965501042f,  0.260399190f,
+    0.965073672f,  0.261978638f,
+    0.964643719f,  0.263557385f,
+    0.964211183f,  0.265135426f,
+    0.963776066f,  0.266712757f,
+    0.963338368f,  0.268289375f,
+    0.962898091f,  0.269865274f,
+    0.962455236f,  0.271440450f,
+    0.962009805f,  0.273014899f,
+    0.961561798f,  0.274588618f,
+    0.961111216f,  0.276161602f,
+    0.960658061f,  0.277733846f,
+    0.960202335f,  0.279305346f,
+    0.959744037f,  0.280876099f,
+    0.959283170f,  0.282446100f,
+    0.958819735f,  0.284015345f,
+    0.958353733f,  0.285583829f,
+    0.957885164f,  0.287151549f,
+    0.957414032f,  0.288718499f,
+    0.956940336f,  0.290284677f,
+    0.956464078f,  0.291850078f,
+    0.955985259f,  0.293414697f,
+    0.955503881f,  0.294978531f,
+    0.955019944f,  0.296541575f,
+    0.954533451f,  0.298103825f,
+    0.954044402f,  0.299665277f,
+    0.953552799f,  0.301225927f,
+    0.953058643f,  0.302785770f,
+    0.952561936f,  0.304344802f,
+    0.952062678f,  0.305903020f,
+    0.951560871f,  0.307460419f,
+    0.951056516f,  0.309016994f,
+    0.950549616f,  0.310572743f,
+    0.950040170f,  0.312127659f,
+    0.949528181f,  0.313681740f,
+    0.949013649f,  0.315234982f,
+    0.948496577f,  0.316787379f,
+    0.947976965f,  0.318338928f,
+    0.947454816f,  0.319889625f,
+    0.946930129f,  0.321439465f,
+    0.946402908f,  0.322988445f,
+    0.945873153f,  0.324536560f,
+    0.945340865f,  0.326083806f,
+    0.944806046f,  0.327630180f,
+    0.944268698f,  0.329175676f,
+    0.943728822f,  0.330720290f,
+    0.943186419f,  0.332264020f,
+    0.942641491f,  0.333806859f,
+    0.942094039f,  0.335348805f,
+    0.941544065f,  0.336889853f,
+    0.940991570f,  0.338430000f,
+    0.940436556f,  0.339969240f,
+    0.939879024f,  0.341507570f,
+    0.939318976f,  0.343044985f,
+    0.938756412f,  0.344581482f,
+    0.938191336f,  0.346117057f,
+    0.937623748f,  0.347651705f,
+    0.937053649f,  0.349185422f,
+    0.936481041f,  0.350718205f,
+    0.935905927f,  0.352250048f,
+    0.935328306f,  0.353780948f,
+    0.934748182f,  0.355310901f,
+    0.934165555f,  0.356839903f,
+    0.933580426f,  0.358367950f,
+    0.932992799f,  0.359895037f,
+    0.932402673f,  0.361421160f,
+    0.931810051f,  0.362946316f,
+    0.931214935f,  0.364470500f,
+    0.930617325f,  0.365993708f,
+    0.930017224f,  0.367515937f,
+    0.929414632f,  0.369037181f,
+    0.928809553f,  0.370557438f,
+    0.928201987f,  0.372076702f,
+    0.927591935f,  0.373594970f,
+    0.926979400f,  0.375112238f,
+    0.926364384f,  0.376628502f,
+    0.925746887f,  0.378143757f,
+    0.925126912f,  0.379658000f,
+    0.924504460f,  0.381171226f,
+    0.923879533f,  0.382683432f,
+    0.923252132f,  0.384194614f,
+    0.922622259f,  0.385704767f,
+    0.921989916f,  0.387213887f,
+    0.921355105f,  0.388721970f,
+    0.920717827f,  0.390229013f,
+    0.920078084f,  0.391735011f,
+    0.919435878f,  0.393239960f,
+    0.918791210f,  0.394743856f,
+    0.918144082f,  0.396246696f,
+    0.917494496f,  0.397748475f,
+    0.916842454f,  0.399249188f,
+    0.916187957f,  0.400748833f,
+    0.915531007f,  0.402247405f,
+    0.914871606f,  0.403744900f,
+    0.914209756f,  0.405241314f,
+    0.913545458f,  0.406736643f,
+    0.912878714f,  0.408230883f,
+    0.912209526f,  0.409724030f,
+    0.911537896f,  0.411216081f,
+    0.910863825f,  0.412707030f,
+    0.910187316f,  0.414196874f,
+    0.909508369f,  0.415685610f,
+    0.908826988f,  0.417173232f,
+    0.908143174f,  0.418659738f,
+    0.907456928f,  0.420145122f,
+    0.906768253f,  0.421629382f,
+    0.906077150f,  0.423112513f,
+    0.905383621f,  0.424594511f,
+    0.904687668f,  0.426075373f,
+    0.903989293f,  0.427555093f,
+    0.903288498f,  0.429033669f,
+    0.902585284f,  0.430511097f,
+    0.901879654f,  0.431987372f,
+    0.901171610f,  0.433462490f,
+    0.900461152f,  0.434936447f,
+    0.899748284f,  0.436409241f,
+    0.899033007f,  0.437880866f,
+    0.898315323f,  0.439351318f,
+    0.897595234f,  0.440820594f,
+    0.896872742f,  0.442288690f,
+    0.896147848f,  0.443755602f,
+    0.895420555f,  0.445221326f,
+    0.894690865f,  0.446685858f,
+    0.893958780f,  0.448149194f,
+    0.893224301f,  0.449611330f,
+    0.892487431f,  0.451072262f,
+    0.891748171f,  0.452531987f,
+    0.891006524f,  0.453990500f,
+    0.890262492f,  0.455447797f,
+    0.889516075f,  0.456903876f,
+    0.888767278f,  0.458358731f,
+    0.888016101f,  0.459812358f,
+    0.887262546f,  0.461264755f,
+    0.886506616f,  0.462715917f,
+    0.885748312f,  0.464165840f,
+    0.884987637f,  0.465614520f,
+    0.884224593f,  0.467061954f,
+    0.883459181f,  0.468508137f,
+    0.882691405f,  0.469953066f,
+    0.881921264f,  0.471396737f,
+    0.881148763f,  0.472839145f,
+    0.880373903f,  0.474280288f,
+    0.879596685f,  0.475720161f,
+    0.878817113f,  0.477158760f,
+    0.878035187f,  0.478596082f,
+    0.877250911f,  0.480032122f,
+    0.876464287f,  0.481466878f,
+    0.875675315f,  0.482900344f,
+    0.874884000f,  0.484332517f,
+    0.874090342f,  0.485763394f,
+    0.873294343f,  0.487192970f,
+    0.872496007f,  0.488621241f,
+    0.871695335f,  0.490048205f,
+    0.870892329f,  0.491473857f,
+    0.870086991f,  0.492898192f,
+    0.869279324f,  0.494321208f,
+    0.868469329f,  0.495742901f,
+    0.867657010f,  0.497163266f,
+    0.866842367f,  0.498582301f,
+    0.866025404f,  0.500000000f,
+    0.865206122f,  0.501416361f,
+    0.864384523f,  0.502831379f,
+    0.863560611f,  0.504245051f,
+    0.862734386f,  0.505657373f,
+    0.861905852f,  0.507068342f,
+    0.861075009f,  0.508477952f,
+    0.860241862f,  0.509886202f,
+    0.859406412f,  0.511293086f,
+    0.858568660f,  0.512698601f,
+    0.857728610f,  0.514102744f,
+    0.856886264f,  0.515505511f,
+    0.856041623f,  0.516906897f,
+    0.855194690f,  0.518306899f,
+    0.854345468f,  0.519705514f,
+    0.853493959f,  0.521102737f,
+    0.852640164f,  0.522498565f,
+    0.851784087f,  0.523892994f,
+    0.850925729f,  0.525286020f,
+    0.850065093f,  0.526677641f,
+    0.849202182f,  0.528067851f,
+    0.848336996f,  0.529456647f,
+    0.847469539f,  0.530844026f,
+    0.846599814f,  0.532229983f,
+    0.845727822f,  0.533614516f,
+    0.844853565f,  0.534997620f,
+    0.843977047f,  0.536379292f,
+    0.843098269f,  0.537759527f,
+    0.842217234f,  0.539138323f,
+    0.841333944f,  0.540515675f,
+    0.840448401f,  0.541891581f,
+    0.839560608f,  0.543266035f,
+    0.838670568f,  0.544639035f,
+    0.837778282f,  0.546010577f,
+    0.836883753f,  0.547380657f,
+    0.835986984f,  0.548749271f,
+    0.835087976f,  0.550116417f,
+    0.834186733f,  0.551482089f,
+    0.833283256f,  0.552846285f,
+    0.832377549f,  0.554209001f,
+    0.831469612f,  0.555570233f,
+    0.830559450f,  0.556929978f,
+    0.829647064f,  0.558288231f,
+    0.828732457f,  0.559644990f,
+    0.827815631f,  0.561000251f,
+    0.826896589f,  0.562354009f,
+    0.825975333f,  0.563706262f,
+    0.825051865f,  0.565057006f,
+    0.824126189f,  0.566406237f,
+    0.823198306f,  0.567753951f,
+    0.822268219f,  0.569100146f,
+    0.821335931f,  0.570444817f,
+    0.820401444f,  0.571787960f,
+    0.819464760f,  0.573129573f,
+    0.818525882f,  0.574469651f,
+    0.817584813f,  0.575808191f,
+    0.816641555f,  0.577145190f,
+    0.815696111f,  0.578480643f,
+    0.814748483f,  0.579814548f,
+    0.813798673f,  0.581146900f,
+    0.812846685f,  0.582477697f,
+    0.811892520f,  0.583806934f,
+    0.810936182f,  0.585134608f,
+    0.809977672f,  0.586460715f,
+    0.809016994f,  0.587785252f,
+    0.808054150f,  0.589108216f,
+    0.807089143f,  0.590429602f,
+    0.806121975f,  0.591749408f,
+    0.805152649f,  0.593067629f,
+    0.804181167f,  0.594384262f,
+    0.803207531f,  0.595699304f,
+    0.802231746f,  0.597012752f,
+    0.801253813f,  0.598324601f,
+    0.800273734f,  0.599634848f,
+    0.799291513f,  0.600943489f,
+    0.798307152f,  0.602250522f,
+    0.797320654f,  0.603555942f,
+    0.796332021f,  0.604859746f,
+    0.795341256f,  0.606161931f,
+    0.794348361f,  0.607462493f,
+    0.793353340f,  0.608761429f,
+    0.792356195f,  0.610058735f,
+    0.791356929f,  0.611354407f,
+    0.790355543f,  0.612648443f,
+    0.789352042f,  0.613940839f,
+    0.788346428f,  0.615231591f,
+    0.787338702f,  0.616520695f,
+    0.786328869f,  0.617808149f,
+    0.785316931f,  0.619093949f,
+    0.784302890f,  0.620378092f,
+    0.783286749f,  0.621660573f,
+    0.782268511f,  0.622941391f,
+    0.781248179f,  0.624220540f,
+    0.780225755f,  0.625498018f,
+    0.779201243f,  0.626773822f,
+    0.778174644f,  0.628047947f,
+    0.777145961f,  0.629320391f,
+    0.776115199f,  0.630591150f,
+    0.775082358f,  0.631860221f,
+    0.774047442f,  0.633127600f,
+    0.773010453f,  0.634393284f,
+    0.771971395f,  0.635657270f,
+    0.770930271f,  0.636919554f,
+    0.769887082f,  0.638180132f,
+    0.768841832f,  0.639439002f,
+    0.767794524f,  0.640696160f,
+    0.766745160f,  0.641951603f,
+    0.765693743f,  0.643205326f,
+    0.764640276f,  0.644457328f,
+    0.763584762f,  0.645707605f,
+    0.762527204f,  0.646956153f,
+    0.761467604f,  0.648202968f,
+    0.760405966f,  0.649448048f,
+    0.759342291f,  0.650691390f,
+    0.758276584f,  0.651932989f,
+    0.757208847f,  0.653172843f,
+    0.756139082f,  0.654410948f,
+    0.755067293f,  0.655647301f,
+    0.753993482f,  0.656881899f,
+    0.752917653f,  0.658114738f,
+    0.751839807f,  0.659345815f,
+    0.750759949f,  0.660575127f,
+    0.749678081f,  0.661802670f,
+    0.748594206f,  0.663028442f,
+    0.747508327f,  0.664252438f,
+    0.746420446f,  0.665474656f,
+    0.745330567f,  0.666695092f,
+    0.744238693f,  0.667913743f,
+    0.743144825f,  0.669130606f,
+    0.742048969f,  0.670345678f,
+    0.740951125f,  0.671558955f,
+    0.739851298f,  0.672770434f,
+    0.738749490f,  0.673980111f,
+    0.737645704f,  0.675187985f,
+    0.736539944f,  0.676394050f,
+    0.735432211f,  0.677598305f,
+    0.734322509f,  0.678800746f,
+    0.733210842f,  0.680001369f,
+    0.732097211f,  0.681200171f,
+    0.730981620f,  0.682397150f,
+    0.729864073f,  0.683592302f,
+    0.728744571f,  0.684785624f,
+    0.727623118f,  0.685977112f,
+    0.726499717f,  0.687166764f,
+    0.725374371f,  0.688354576f,
+    0.724247083f,  0.689540545f,
+    0.723117856f,  0.690724668f,
+    0.721986693f,  0.691906941f,
+    0.720853597f,  0.693087363f,
+    0.719718571f,  0.694265928f,
+    0.718581618f,  0.695442635f,
+    0.717442741f,  0.696617480f,
+    0.716301943f,  0.697790460f,
+    0.715159228f,  0.698961572f,
+    0.714014598f,  0.700130812f,
+    0.712868056f,  0.701298178f,
+    0.711719606f,  0.702463666f,
+    0.710569250f,  0.703627274f,
+    0.709416992f,  0.704788998f,
+    0.708262835f,  0.705948834f,
+    0.707106781f,  0.707106781f,
+    0.705948834f,  0.708262835f,
+    0.704788998f,  0.709416992f,
+    0.703627274f,  0.710569250f,
+    0.702463666f,  0.711719606f,
+    0.701298178f,  0.712868056f,
+    0.700130812f,  0.714014598f,
+    0.698961572f,  0.715159228f,
+    0.697790460f,  0.716301943f,
+    0.696617480f,  0.717442741f,
+    0.695442635f,  0.718581618f,
+    0.694265928f,  0.719718571f,
+    0.693087363f,  0.720853597f,
+    0.691906941f,  0.721986693f,
+    0.690724668f,  0.723117856f,
+    0.689540545f,  0.724247083f,
+    0.688354576f,  0.725374371f,
+    0.687166764f,  0.726499717f,
+    0.685977112f,  0.727623118f,
+    0.684785624f,  0.728744571f,
+    0.683592302f,  0.729864073f,
+    0.682397150f,  0.730981620f,
+    0.681200171f,  0.732097211f,
+    0.680001369f,  0.733210842f,
+    0.678800746f,  0.734322509f,
+    0.677598305f,  0.735432211f,
+    0.676394050f,  0.736539944f,
+    0.675187985f,  0.737645704f,
+    0.673980111f,  0.738749490f,
+    0.672770434f,  0.739851298f,
+    0.671558955f,  0.740951125f,
+    0.670345678f,  0.742048969f,
+    0.669130606f,  0.743144825f,
+    0.667913743f,  0.744238693f,
+    0.666695092f,  0.745330567f,
+    0.665474656f,  0.746420446f,
+    0.664252438f,  0.747508327f,
+    0.663028442f,  0.748594206f,
+    0.661802670f,  0.749678081f,
+    0.660575127f,  0.750759949f,
+    0.659345815f,  0.751839807f,
+    0.658114738f,  0.752917653f,
+    0.656881899f,  0.753993482f,
+    0.655647301f,  0.755067293f,
+    0.654410948f,  0.756139082f,
+    0.653172843f,  0.757208847f,
+    0.651932989f,  0.758276584f,
+    0.650691390f,  0.759342291f,
+    0.649448048f,  0.760405966f,
+    0.648202968f,  0.761467604f,
+    0.646956153f,  0.762527204f,
+    0.645707605f,  0.763584762f,
+    0.644457328f,  0.764640276f,
+    0.643205326f,  0.765693743f,
+    0.641951603f,  0.766745160f,
+    0.640696160f,  0.767794524f,
+    0.639439002f,  0.768841832f,
+    0.638180132f,  0.769887082f,
+    0.636919554f,  0.770930271f,
+    0.635657270f,  0.771971395f,
+    0.634393284f,  0.773010453f,
+    0.633127600f,  0.774047442f,
+    0.631860221f,  0.775082358f,
+    0.630591150f,  0.776115199f,
+    0.629320391f,  0.777145961f,
+    0.628047947f,  0.778174644f,
+    0.626773822f,  0.779201243f,
+    0.625498018f,  0.780225755f,
+    0.624220540f,  0.781248179f,
+    0.622941391f,  0.782268511f,
+    0.621660573f,  0.783286749f,
+    0.620378092f,  0.784302890f,
+    0.619093949f,  0.785316931f,
+    0.617808149f,  0.786328869f,
+    0.616520695f,  0.787338702f,
+    0.615231591f,  0.788346428f,
+    0.613940839f,  0.789352042f,
+    0.612648443f,  0.790355543f,
+    0.611354407f,  0.791356929f,
+    0.610058735f,  0.792356195f,
+    0.608761429f,  0.793353340f,
+    0.607462493f,  0.794348361f,
+    0.606161931f,  0.795341256f,
+    0.604859746f,  0.796332021f,
+    0.603555942f,  0.797320654f,
+    0.602250522f,  0.798307152f,
+    0.600943489f,  0.799291513f,
+    0.599634848f,  0.800273734f,
+    0.598324601f,  0.801253813f,
+    0.597012752f,  0.802231746f,
+    0.595699304f,  0.803207531f,
+    0.594384262f,  0.804181167f,
+    0.593067629f,  0.805152649f,
+    0.591749408f,  0.806121975f,
+    0.590429602f,  0.807089143f,
+    0.589108216f,  0.808054150f,
+    0.587785252f,  0.809016994f,
+    0.586460715f,  0.809977672f,
+    0.585134608f,  0.810936182f,
+    0.583806934f,  0.811892520f,
+    0.582477697f,  0.812846685f,
+    0.581146900f,  0.813798673f,
+    0.579814548f,  0.814748483f,
+    0.578480643f,  0.815696111f,
+    0.577145190f,  0.816641555f,
+    0.575808191f,  0.817584813f,
+    0.574469651f,  0.818525882f,
+    0.573129573f,  0.819464760f,
+    0.571787960f,  0.820401444f,
+    0.570444817f,  0.821335931f,
+    0.569100146f,  0.822268219f,
+    0.567753951f,  0.823198306f,
+    0.566406237f,  0.824126189f,
+    0.565057006f,  0.825051865f,
+    0.563706262f,  0.825975333f,
+    0.562354009f,  0.826896589f,
+    0.561000251f,  0.827815631f,
+    0.559644990f,  0.828732457f,
+    0.558288231f,  0.829647064f,
+    0.556929978f,  0.830559450f,
+    0.555570233f,  0.831469612f,
+    0.554209001f,  0.832377549f,
+    0.552846285f,  0.833283256f,
+    0.551482089f,  0.834186733f,
+    0.550116417f,  0.835087976f,
+    0.548749271f,  0.835986984f,
+    0.547380657f,  0.836883753f,
+    0.546010577f,  0.837778282f,
+    0.544639035f,  0.838670568f,
+    0.543266035f,  0.839560608f,
+    0.541891581f,  0.840448401f,
+    0.540515675f,  0.841333944f,
+    0.539138323f,  0.842217234f,
+    0.537759527f,  0.843098269f,
+    0.536379292f,  0.843977047f,
+    0.534997620f,  0.844853565f,
+    0.533614516f,  0.845727822f,
+    0.532229983f,  0.846599814f,
+    0.530844026f,  0.847469539f,
+    0.529456647f,  0.848336996f,
+    0.528067851f,  0.849202182f,
+    0.526677641f,  0.850065093f,
+    0.525286020f,  0.850925729f,
+    0.523892994f,  0.851784087f,
+    0.522498565f,  0.852640164f,
+    0.521102737f,  0.853493959f,
+    0.519705514f,  0.854345468f,
+    0.518306899f,  0.855194690f,
+    0.516906897f,  0.856041623f,
+    0.515505511f,  0.856886264f,
+    0.514102744f,  0.857728610f,
+    0.512698601f,  0.858568660f,
+    0.511293086f,  0.859406412f,
+    0.509886202f,  0.860241862f,
+    0.508477952f,  0.861075009f,
+    0.507068342f,  0.861905852f,
+    0.505657373f,  0.862734386f,
+    0.504245051f,  0.863560611f,
+    0.502831379f,  0.864384523f,
+    0.501416361f,  0.865206122f,
+    0.500000000f,  0.866025404f,
+    0.498582301f,  0.866842367f,
+    0.497163266f,  0.867657010f,
+    0.495742901f,  0.868469329f,
+    0.494321208f,  0.869279324f,
+    0.492898192f,  0.870086991f,
+    0.491473857f,  0.870892329f,
+    0.490048205f,  0.871695335f,
+    0.488621241f,  0.872496007f,
+    0.487192970f,  0.873294343f,
+    0.485763394f,  0.874090342f,
+    0.484332517f,  0.874884000f,
+    0.482900344f,  0.875675315f,
+    0.481466878f,  0.876464287f,
+    0.480032122f,  0.877250911f,
+    0.478596082f,  0.878035187f,
+    0.477158760f,  0.878817113f,
+    0.475720161f,  0.879596685f,
+    0.474280288f,  0.880373903f,
+    0.472839145f,  0.881148763f,
+    0.471396737f,  0.881921264f,
+    0.469953066f,  0.882691405f,
+    0.468508137f,  0.883459181f,
+    0.467061954f,  0.884224593f,
+    0.465614520f,  0.884987637f,
+    0.464165840f,  0.885748312f,
+    0.462715917f,  0.886506616f,
+    0.461264755f,  0.887262546f,
+    0.459812358f,  0.888016101f,
+    0.458358731f,  0.888767278f,
+    0.456903876f,  0.889516075f,
+    0.455447797f,  0.890262492f,
+    0.453990500f,  0.891006524f,
+    0.452531987f,  0.891748171f,
+    0.451072262f,  0.892487431f,
+    0.449611330f,  0.893224301f,
+    0.448149194f,  0.893958780f,
+    0.446685858f,  0.894690865f,
+    0.445221326f,  0.895420555f,
+    0.443755602f,  0.896147848f,
+    0.442288690f,  0.896872742f,
+    0.440820594f,  0.897595234f,
+    0.439351318f,  0.898315323f,
+    0.437880866f,  0.899033007f,
+    0.436409241f,  0.899748284f,
+    0.434936447f,  0.900461152f,
+    0.433462490f,  0.901171610f,
+    0.431987372f,  0.901879654f,
+    0.430511097f,  0.902585284f,
+    0.429033669f,  0.903288498f,
+    0.427555093f,  0.903989293f,
+    0.426075373f,  0.904687668f,
+    0.424594511f,  0.905383621f,
+    0.423112513f,  0.906077150f,
+    0.421629382f,  0.906768253f,
+    0.420145122f,  0.907456928f,
+    0.418659738f,  0.908143174f,
+    0.417173232f,  0.908826988f,
+    0.415685610f,  0.909508369f,
+    0.414196874f,  0.910187316f,
+    0.412707030f,  0.910863825f,
+    0.411216081f,  0.911537896f,
+    0.409724030f,  0.912209526f,
+    0.408230883f,  0.912878714f,
+    0.406736643f,  0.913545458f,
+    0.405241314f,  0.914209756f,
+    0.403744900f,  0.914871606f,
+    0.402247405f,  0.915531007f,
+    0.400748833f,  0.916187957f,
+    0.399249188f,  0.916842454f,
+    0.397748475f,  0.917494496f,
+    0.396246696f,  0.918144082f,
+    0.394743856f,  0.918791210f,
+    0.393239960f,  0.919435878f,
+    0.391735011f,  0.920078084f,
+    0.390229013f,  0.920717827f,
+    0.388721970f,  0.921355105f,
+    0.387213887f,  0.921989916f,
+    0.385704767f,  0.922622259f,
+    0.384194614f,  0.923252132f,
+    0.382683432f,  0.923879533f,
+    0.381171226f,  0.924504460f,
+    0.379658000f,  0.925126912f,
+    0.378143757f,  0.925746887f,
+    0.376628502f,  0.926364384f,
+    0.375112238f,  0.926979400f,
+    0.373594970f,  0.927591935f,
+    0.372076702f,  0.928201987f,
+    0.370557438f,  0.928809553f,
+    0.369037181f,  0.929414632f,
+    0.367515937f,  0.930017224f,
+    0.365993708f,  0.930617325f,
+    0.364470500f,  0.931214935f,
+    0.362946316f,  0.931810051f,
+    0.361421160f,  0.932402673f,
+    0.359895037f,  0.932992799f,
+    0.358367950f,  0.933580426f,
+    0.356839903f,  0.934165555f,
+    0.355310901f,  0.934748182f,
+    0.353780948f,  0.935328306f,
+    0.352250048f,  0.935905927f,
+    0.350718205f,  0.936481041f,
+    0.349185422f,  0.937053649f,
+    0.347651705f,  0.937623748f,
+    0.346117057f,  0.938191336f,
+    0.344581482f,  0.938756412f,
+    0.343044985f,  0.939318976f,
+    0.341507570f,  0.939879024f,
+    0.339969240f,  0.940436556f,
+    0.338430000f,  0.940991570f,
+    0.336889853f,  0.941544065f,
+    0.335348805f,  0.942094039f,
+    0.333806859f,  0.942641491f,
+    0.332264020f,  0.943186419f,
+    0.330720290f,  0.943728822f,
+    0.329175676f,  0.944268698f,
+    0.327630180f,  0.944806046f,
+    0.326083806f,  0.945340865f,
+    0.324536560f,  0.945873153f,
+    0.322988445f,  0.946402908f,
+    0.321439465f,  0.946930129f,
+    0.319889625f,  0.947454816f,
+    0.318338928f,  0.947976965f,
+    0.316787379f,  0.948496577f,
+    0.315234982f,  0.949013649f,
+    0.313681740f,  0.949528181f,
+    0.312127659f,  0.950040170f,
+    0.310572743f,  0.950549616f,
+    0.309016994f,  0.951056516f,
+    0.307460419f,  0.951560871f,
+    0.305903020f,  0.952062678f,
+    0.304344802f,  0.952561936f,
+    0.302785770f,  0.953058643f,
+    0.301225927f,  0.953552799f,
+    0.299665277f,  0.954044402f,
+    0.298103825f,  0.954533451f,
+    0.296541575f,  0.955019944f,
+    0.294978531f,  0.955503881f,
+    0.293414697f,  0.955985259f,
+    0.291850078f,  0.956464078f,
+    0.290284677f,  0.956940336f,
+    0.288718499f,  0.957414032f,
+    0.287151549f,  0.957885164f,
+    0.285583829f,  0.958353733f,
+    0.284015345f,  0.958819735f,
+    0.282446100f,  0.959283170f,
+    0.280876099f,  0.959744037f,
+    0.279305346f,  0.960202335f,
+    0.277733846f,  0.960658061f,
+    0.276161602f,  0.961111216f,
+    0.274588618f,  0.961561798f,
+    0.273014899f,  0.962009805f,
+    0.271440450f,  0.962455236f,
+    0.269865274f,  0.962898091f,
+    0.268289375f,  0.963338368f,
+    0.266712757f,  0.963776066f,
+    0.265135426f,  0.964211183f,
+    0.263557385f,  0.964643719f,
+    0.261978638f,  0.965073672f,
+    0.260399190f,  0.965501042f,
+    0.258819045f,  0.965925826f,
+    0.257238207f,  0.966348025f,
+    0.255656680f,  0.966767636f,
+    0.254074469f,  0.967184659f,
+    0.252491577f,  0.967599092f,
+    0.250908009f,  0.968010935f,
+    0.249323770f,  0.968420187f,
+    0.247738863f,  0.968826845f,
+    0.246153293f,  0.969230910f,
+    0.244567064f,  0.969632379f,
+    0.242980180f,  0.970031253f,
+    0.241392645f,  0.970427530f,
+    0.239804465f,  0.970821208f,
+    0.238215642f,  0.971212288f,
+    0.236626181f,  0.971600767f,
+    0.235036087f,  0.971986645f,
+    0.233445364f,  0.972369920f,
+    0.231854016f,  0.972750593f,
+    0.230262046f,  0.973128661f,
+    0.228669461f,  0.973504123f,
+    0.227076263f,  0.973876979f,
+    0.225482457f,  0.974247228f,
+    0.223888048f,  0.974614869f,
+    0.222293039f,  0.974979900f,
+    0.220697435f,  0.975342321f,
+    0.219101240f,  0.975702130f,
+    0.217504459f,  0.976059327f,
+    0.215907095f,  0.976413911f,
+    0.214309153f,  0.976765881f,
+    0.212710637f,  0.977115236f,
+    0.211111552f,  0.977461975f,
+    0.209511902f,  0.977806097f,
+    0.207911691f,  0.978147601f,
+    0.206310923f,  0.978486486f,
+    0.204709603f,  0.978822751f,
+    0.203107734f,  0.979156396f,
+    0.201505322f,  0.979487420f,
+    0.199902371f,  0.979815821f,
+    0.198298884f,  0.980141598f,
+    0.196694866f,  0.980464752f,
+    0.195090322f,  0.980785280f,
+    0.193485255f,  0.981103183f,
+    0.191879671f,  0.981418459f,
+    0.190273572f,  0.981731108f,
+    0.188666965f,  0.982041128f,
+    0.187059852f,  0.982348519f,
+    0.185452238f,  0.982653279f,
+    0.183844128f,  0.982955409f,
+    0.182235525f,  0.983254908f,
+    0.180626435f,  0.983551773f,
+    0.179016861f,  0.983846006f,
+    0.177406808f,  0.984137604f,
+    0.175796280f,  0.984426568f,
+    0.174185281f,  0.984712896f,
+    0.172573816f,  0.984996588f,
+    0.170961889f,  0.985277642f,
+    0.169349504f,  0.985556059f,
+    0.167736666f,  0.985831837f,
+    0.166123378f,  0.986104976f,
+    0.164509646f,  0.986375474f,
+    0.162895473f,  0.986643332f,
+    0.161280865f,  0.986908548f,
+    0.159665824f,  0.987171122f,
+    0.158050356f,  0.987431053f,
+    0.156434465f,  0.987688341f,
+    0.154818155f,  0.987942984f,
+    0.153201431f,  0.988194982f,
+    0.151584296f,  0.988444334f,
+    0.149966756f,  0.988691040f,
+    0.148348814f,  0.988935099f,
+    0.146730474f,  0.989176510f,
+    0.145111742f,  0.989415273f,
+    0.143492622f,  0.989651387f,
+    0.141873117f,  0.989884851f,
+    0.140253233f,  0.990115665f,
+    0.138632973f,  0.990343829f,
+    0.137012342f,  0.990569340f,
+    0.135391344f,  0.990792200f,
+    0.133769983f,  0.991012407f,
+    0.132148265f,  0.991229961f,
+    0.130526192f,  0.991444861f,
+    0.128903770f,  0.991657107f,
+    0.127281003f,  0.991866698f,
+    0.125657896f,  0.992073633f,
+    0.124034451f,  0.992277912f,
+    0.122410675f,  0.992479535f,
+    0.120786571f,  0.992678500f,
+    0.119162144f,  0.992874808f,
+    0.117537397f,  0.993068457f,
+    0.115912336f,  0.993259448f,
+    0.114286965f,  0.993447779f,
+    0.112661288f,  0.993633451f,
+    0.111035309f,  0.993816462f,
+    0.109409032f,  0.993996813f,
+    0.107782463f,  0.994174502f,
+    0.106155605f,  0.994349530f,
+    0.104528463f,  0.994521895f,
+    0.102901041f,  0.994691598f,
+    0.101273344f,  0.994858638f,
+    0.099645376f,  0.995023014f,
+    0.098017140f,  0.995184727f,
+    0.096388643f,  0.995343775f,
+    0.094759887f,  0.995500158f,
+    0.093130877f,  0.995653875f,
+    0.091501619f,  0.995804928f,
+    0.089872115f,  0.995953314f,
+    0.088242371f,  0.996099033f,
+    0.086612390f,  0.996242086f,
+    0.084982177f,  0.996382472f,
+    0.083351737f,  0.996520189f,
+    0.081721074f,  0.996655239f,
+    0.080090192f,  0.996787621f,
+    0.078459096f,  0.996917334f,
+    0.076827789f,  0.997044378f,
+    0.075196277f,  0.997168752f,
+    0.073564564f,  0.997290457f,
+    0.071932653f,  0.997409491f,
+    0.070300550f,  0.997525856f,
+    0.068668259f,  0.997639549f,
+    0.067035784f,  0.997750572f,
+    0.065403129f,  0.997858923f,
+    0.063770300f,  0.997964603f,
+    0.062137299f,  0.998067611f,
+    0.060504132f,  0.998167947f,
+    0.058870804f,  0.998265610f,
+    0.057237317f,  0.998360601f,
+    0.055603678f,  0.998452919f,
+    0.053969889f,  0.998542563f,
+    0.052335956f,  0.998629535f,
+    0.050701883f,  0.998713832f,
+    0.049067674f,  0.998795456f,
+    0.047433334f,  0.998874406f,
+    0.045798867f,  0.998950681f,
+    0.044164277f,  0.999024282f,
+    0.042529569f,  0.999095209f,
+    0.040894747f,  0.999163460f,
+    0.039259816f,  0.999229036f,
+    0.037624779f,  0.999291937f,
+    0.035989642f,  0.999352163f,
+    0.034354408f,  0.999409713f,
+    0.032719083f,  0.999464587f,
+    0.031083670f,  0.999516786f,
+    0.029448173f,  0.999566309f,
+    0.027812598f,  0.999613155f,
+    0.026176948f,  0.999657325f,
+    0.024541229f,  0.999698819f,
+    0.022905443f,  0.999737636f,
+    0.021269596f,  0.999773777f,
+    0.019633692f,  0.999807240f,
+    0.017997736f,  0.999838028f,
+    0.016361732f,  0.999866138f,
+    0.014725683f,  0.999891571f,
+    0.013089596f,  0.999914328f,
+    0.011453473f,  0.999934407f,
+    0.009817319f,  0.999951809f,
+    0.008181140f,  0.999966534f,
+    0.006544938f,  0.999978582f,
+    0.004908719f,  0.999987952f,
+    0.003272487f,  0.999994645f,
+    0.001636245f,  0.999998661f,
+    0.000000000f,  1.000000000f,
+   -0.001636245f,  0.999998661f,
+   -0.003272487f,  0.999994645f,
+   -0.004908719f,  0.999987952f,
+   -0.006544938f,  0.999978582f,
+   -0.008181140f,  0.999966534f,
+   -0.009817319f,  0.999951809f,
+   -0.011453473f,  0.999934407f,
+   -0.013089596f,  0.999914328f,
+   -0.014725683f,  0.999891571f,
+   -0.016361732f,  0.999866138f,
+   -0.017997736f,  0.999838028f,
+   -0.019633692f,  0.999807240f,
+   -0.021269596f,  0.999773777f,
+   -0.022905443f,  0.999737636f,
+   -0.024541229f,  0.999698819f,
+   -0.026176948f,  0.999657325f,
+   -0.027812598f,  0.999613155f,
+   -0.029448173f,  0.999566309f,
+   -0.031083670f,  0.999516786f,
+   -0.032719083f,  0.999464587f,
+   -0.034354408f,  0.999409713f,
+   -0.035989642f,  0.999352163f,
+   -0.037624779f,  0.999291937f,
+   -0.039259816f,  0.999229036f,
+   -0.040894747f,  0.999163460f,
+   -0.042529569f,  0.999095209f,
+   -0.044164277f,  0.999024282f,
+   -0.045798867f,  0.998950681f,
+   -0.047433334f,  0.998874406f,
+   -0.049067674f,  0.998795456f,
+   -0.050701883f,  0.998713832f,
+   -0.052335956f,  0.998629535f,
+   -0.053969889f,  0.998542563f,
+   -0.055603678f,  0.998452919f,
+   -0.057237317f,  0.998360601f,
+   -0.058870804f,  0.998265610f,
+   -0.060504132f,  0.998167947f,
+   -0.062137299f,  0.998067611f,
+   -0.063770300f,  0.997964603f,
+   -0.065403129f,  0.997858923f,
+   -0.067035784f,  0.997750572f,
+   -0.068668259f,  0.997639549f,
+   -0.070300550f,  0.997525856f,
+   -0.071932653f,  0.997409491f,
+   -0.073564564f,  0.997290457f,
+   -0.075196277f,  0.997168752f,
+   -0.076827789f,  0.997044378f,
+   -0.078459096f,  0.996917334f,
+   -0.080090192f,  0.996787621f,
+   -0.081721074f,  0.996655239f,
+   -0.083351737f,  0.996520189f,
+   -0.084982177f,  0.996382472f,
+   -0.086612390f,  0.996242086f,
+   -0.088242371f,  0.996099033f,
+   -0.089872115f,  0.995953314f,
+   -0.091501619f,  0.995804928f,
+   -0.093130877f,  0.995653875f,
+   -0.094759887f,  0.995500158f,
+   -0.096388643f,  0.995343775f,
+   -0.098017140f,  0.995184727f,
+   -0.099645376f,  0.995023014f,
+   -0.101273344f,  0.994858638f,
+   -0.102901041f,  0.994691598f,
+   -0.104528463f,  0.994521895f,
+   -0.106155605f,  0.994349530f,
+   -0.107782463f,  0.994174502f,
+   -0.109409032f,  0.993996813f,
+   -0.111035309f,  0.993816462f,
+   -0.112661288f,  0.993633451f,
+   -0.114286965f,  0.993447779f,
+   -0.115912336f,  0.993259448f,
+   -0.117537397f,  0.993068457f,
+   -0.119162144f,  0.992874808f,
+   -0.120786571f,  0.992678500f,
+   -0.122410675f,  0.992479535f,
+   -0.124034451f,  0.992277912f,
+   -0.125657896f,  0.992073633f,
+   -0.127281003f,  0.991866698f,
+   -0.128903770f,  0.991657107f,
+   -0.130526192f,  0.991444861f,
+   -0.132148265f,  0.991229961f,
+   -0.133769983f,  0.991012407f,
+   -0.135391344f,  0.990792200f,
+   -0.137012342f,  0.990569340f,
+   -0.138632973f,  0.990343829f,
+   -0.140253233f,  0.990115665f,
+   -0.141873117f,  0.989884851f,
+   -0.143492622f,  0.989651387f,
+   -0.145111742f,  0.989415273f,
+   -0.146730474f,  0.989176510f,
+   -0.148348814f,  0.988935099f,
+   -0.149966756f,  0.988691040f,
+   -0.151584296f,  0.988444334f,
+   -0.153201431f,  0.988194982f,
+   -0.154818155f,  0.987942984f,
+   -0.156434465f,  0.987688341f,
+   -0.158050356f,  0.987431053f,
+   -0.159665824f,  0.987171122f,
+   -0.161280865f,  0.986908548f,
+   -0.162895473f,  0.986643332f,
+   -0.164509646f,  0.986375474f,
+   -0.166123378f,  0.986104976f,
+   -0.167736666f,  0.985831837f,
+   -0.169349504f,  0.985556059f,
+   -0.170961889f,  0.985277642f,
+   -0.172573816f,  0.984996588f,
+   -0.174185281f,  0.984712896f,
+   -0.175796280f,  0.984426568f,
+   -0.177406808f,  0.984137604f,
+   -0.179016861f,  0.983846006f,
+   -0.180626435f,  0.983551773f,
+   -0.182235525f,  0.983254908f,
+   -0.183844128f,  0.982955409f,
+   -0.185452238f,  0.982653279f,
+   -0.187059852f,  0.982348519f,
+   -0.188666965f,  0.982041128f,
+   -0.190273572f,  0.981731108f,
+   -0.191879671f,  0.981418459f,
+   -0.193485255f,  0.981103183f,
+   -0.195090322f,  0.980785280f,
+   -0.196694866f,  0.980464752f,
+   -0.198298884f,  0.980141598f,
+   -0.199902371f,  0.979815821f,
+   -0.201505322f,  0.979487420f,
+   -0.203107734f,  0.979156396f,
+   -0.204709603f,  0.978822751f,
+   -0.206310923f,  0.978486486f,
+   -0.207911691f,  0.978147601f,
+   -0.209511902f,  0.977806097f,
+   -0.211111552f,  0.977461975f,
+   -0.212710637f,  0.977115236f,
+   -0.214309153f,  0.976765881f,
+   -0.215907095f,  0.976413911f,
+   -0.217504459f,  0.976059327f,
+   -0.219101240f,  0.975702130f,
+   -0.220697435f,  0.975342321f,
+   -0.222293039f,  0.974979900f,
+   -0.223888048f,  0.974614869f,
+   -0.225482457f,  0.974247228f,
+   -0.227076263f,  0.973876979f,
+   -0.228669461f,  0.973504123f,
+   -0.230262046f,  0.973128661f,
+   -0.231854016f,  0.972750593f,
+   -0.233445364f,  0.972369920f,
+   -0.235036087f,  0.971986645f,
+   -0.236626181f,  0.971600767f,
+   -0.238215642f,  0.971212288f,
+   -0.239804465f,  0.970821208f,
+   -0.241392645f,  0.970427530f,
+   -0.242980180f,  0.970031253f,
+   -0.244567064f,  0.969632379f,
+   -0.246153293f,  0.969230910f,
+   -0.247738863f,  0.968826845f,
+   -0.249323770f,  0.968420187f,
+   -0.250908009f,  0.968010935f,
+   -0.252491577f,  0.967599092f,
+   -0.254074469f,  0.967184659f,
+   -0.255656680f,  0.966767636f,
+   -0.257238207f,  0.966348025f,
+   -0.258819045f,  0.965925826f,
+   -0.260399190f,  0.965501042f,
+   -0.261978638f,  0.965073672f,
+   -0.263557385f,  0.964643719f,
+   -0.265135426f,  0.964211183f,
+   -0.266712757f,  0.963776066f,
+   -0.268289375f,  0.963338368f,
+   -0.269865274f,  0.962898091f,
+   -0.271440450f,  0.962455236f,
+   -0.273014899f,  0.962009805f,
+   -0.274588618f,  0.961561798f,
+   -0.276161602f,  0.961111216f,
+   -0.277733846f,  0.960658061f,
+   -0.279305346f,  0.960202335f,
+   -0.280876099f,  0.959744037f,
+   -0.282446100f,  0.959283170f,
+   -0.284015345f,  0.958819735f,
+   -0.285583829f,  0.958353733f,
+   -0.287151549f,  0.957885164f,
+   -0.288718499f,  0.957414032f,
+   -0.290284677f,  0.956940336f,
+   -0.291850078f,  0.956464078f,
+   -0.293414697f,  0.955985259f,
+   -0.294978531f,  0.955503881f,
+   -0.296541575f,  0.955019944f,
+   -0.298103825f,  0.954533451f,
+   -0.299665277f,  0.954044402f,
+   -0.301225927f,  0.953552799f,
+   -0.302785770f,  0.953058643f,
+   -0.304344802f,  0.952561936f,
+   -0.305903020f,  0.952062678f,
+   -0.307460419f,  0.951560871f,
+   -0.309016994f,  0.951056516f,
+   -0.310572743f,  0.950549616f,
+   -0.312127659f,  0.950040170f,
+   -0.313681740f,  0.949528181f,
+   -0.315234982f,  0.949013649f,
+   -0.316787379f,  0.948496577f,
+   -0.318338928f,  0.947976965f,
+   -0.319889625f,  0.947454816f,
+   -0.321439465f,  0.946930129f,
+   -0.322988445f,  0.946402908f,
+   -0.324536560f,  0.945873153f,
+   -0.326083806f,  0.945340865f,
+   -0.327630180f,  0.944806046f,
+   -0.329175676f,  0.944268698f,
+   -0.330720290f,  0.943728822f,
+   -0.332264020f,  0.943186419f,
+   -0.333806859f,  0.942641491f,
+   -0.335348805f,  0.942094039f,
+   -0.336889853f,  0.941544065f,
+   -0.338430000f,  0.940991570f,
+   -0.339969240f,  0.940436556f,
+   -0.341507570f,  0.939879024f,
+   -0.343044985f,  0.939318976f,
+   -0.344581482f,  0.938756412f,
+   -0.346117057f,  0.938191336f,
+   -0.347651705f,  0.937623748f,
+   -0.349185422f,  0.937053649f,
+   -0.350718205f,  0.936481041f,
+   -0.352250048f,  0.935905927f,
+   -0.353780948f,  0.935328306f,
+   -0.355310901f,  0.934748182f,
+   -0.356839903f,  0.934165555f,
+   -0.358367950f,  0.933580426f,
+   -0.359895037f,  0.932992799f,
+   -0.361421160f,  0.932402673f,
+   -0.362946316f,  0.931810051f,
+   -0.364470500f,  0.931214935f,
+   -0.365993708f,  0.930617325f,
+   -0.367515937f,  0.930017224f,
+   -0.369037181f,  0.929414632f,
+   -0.370557438f,  0.928809553f,
+   -0.372076702f,  0.928201987f,
+   -0.373594970f,  0.927591935f,
+   -0.375112238f,  0.926979400f,
+   -0.376628502f,  0.926364384f,
+   -0.378143757f,  0.925746887f,
+   -0.379658000f,  0.925126912f,
+   -0.381171226f,  0.924504460f,
+   -0.382683432f,  0.923879533f,
+   -0.384194614f,  0.923252132f,
+   -0.385704767f,  0.922622259f,
+   -0.387213887f,  0.921989916f,
+   -0.388721970f,  0.921355105f,
+   -0.390229013f,  0.920717827f,
+   -0.391735011f,  0.920078084f,
+   -0.393239960f,  0.919435878f,
+   -0.394743856f,  0.918791210f,
+   -0.396246696f,  0.918144082f,
+   -0.397748475f,  0.917494496f,
+   -0.399249188f,  0.916842454f,
+   -0.400748833f,  0.916187957f,
+   -0.402247405f,  0.915531007f,
+   -0.403744900f,  0.914871606f,
+   -0.405241314f,  0.914209756f,
+   -0.406736643f,  0.913545458f,
+   -0.408230883f,  0.912878714f,
+   -0.409724030f,  0.912209526f,
+   -0.411216081f,  0.911537896f,
+   -0.412707030f,  0.910863825f,
+   -0.414196874f,  0.910187316f,
+   -0.415685610f,  0.909508369f,
+   -0.417173232f,  0.908826988f,
+   -0.418659738f,  0.908143174f,
+   -0.420145122f,  0.907456928f,
+   -0.421629382f,  0.906768253f,
+   -0.423112513f,  0.906077150f,
+   -0.424594511f,  0.905383621f,
+   -0.426075373f,  0.904687668f,
+   -0.427555093f,  0.903989293f,
+   -0.429033669f,  0.903288498f,
+   -0.430511097f,  0.902585284f,
+   -0.431987372f,  0.901879654f,
+   -0.433462490f,  0.901171610f,
+   -0.434936447f,  0.900461152f,
+   -0.436409241f,  0.899748284f,
+   -0.437880866f,  0.899033007f,
+   -0.439351318f,  0.898315323f,
+   -0.440820594f,  0.897595234f,
+   -0.442288690f,  0.896872742f,
+   -0.443755602f,  0.896147848f,
+   -0.445221326f,  0.895420555f,
+   -0.446685858f,  0.894690865f,
+   -0.448149194f,  0.893958780f,
+   -0.449611330f,  0.893224301f,
+   -0.451072262f,  0.892487431f,
+   -0.452531987f,  0.891748171f,
+   -0.453990500f,  0.891006524f,
+   -0.455447797f,  0.890262492f,
+   -0.456903876f,  0.889516075f,
+   -0.458358731f,  0.888767278f,
+   -0.459812358f,  0.888016101f,
+   -0.461264755f,  0.887262546f,
+   -0.462715917f,  0.886506616f,
+   -0.464165840f,  0.885748312f,
+   -0.465614520f,  0.884987637f,
+   -0.467061954f,  0.884224593f,
+   -0.468508137f,  0.883459181f,
+   -0.469953066f,  0.882691405f,
+   -0.471396737f,  0.881921264f,
+   -0.472839145f,  0.881148763f,
+   -0.474280288f,  0.880373903f,
+   -0.475720161f,  0.879596685f,
+   -0.477158760f,  0.878817113f,
+   -0.478596082f,  0.878035187f,
+   -0.480032122f,  0.877250911f,
+   -0.481466878f,  0.876464287f,
+   -0.482900344f,  0.875675315f,
+   -0.484332517f,  0.874884000f,
+   -0.485763394f,  0.874090342f,
+   -0.487192970f,  0.873294343f,
+   -0.488621241f,  0.872496007f,
+   -0.490048205f,  0.871695335f,
+   -0.491473857f,  0.870892329f,
+   -0.492898192f,  0.870086991f,
+   -0.494321208f,  0.869279324f,
+   -0.495742901f,  0.868469329f,
+   -0.497163266f,  0.867657010f,
+   -0.498582301f,  0.866842367f,
+   -0.500000000f,  0.866025404f,
+   -0.501416361f,  0.865206122f,
+   -0.502831379f,  0.864384523f,
+   -0.504245051f,  0.863560611f,
+   -0.505657373f,  0.862734386f,
+   -0.507068342f,  0.861905852f,
+   -0.508477952f,  0.861075009f,
+   -0.509886202f,  0.860241862f,
+   -0.511293086f,  0.859406412f,
+   -0.512698601f,  0.858568660f,
+   -0.514102744f,  0.857728610f,
+   -0.515505511f,  0.856886264f,
+   -0.516906897f,  0.856041623f,
+   -0.518306899f,  0.855194690f,
+   -0.519705514f,  0.854345468f,
+   -0.521102737f,  0.853493959f,
+   -0.522498565f,  0.852640164f,
+   -0.523892994f,  0.851784087f,
+   -0.525286020f,  0.850925729f,
+   -0.526677641f,  0.850065093f,
+   -0.528067851f,  0.849202182f,
+   -0.529456647f,  0.848336996f,
+   -0.530844026f,  0.847469539f,
+   -0.532229983f,  0.846599814f,
+   -0.533614516f,  0.845727822f,
+   -0.534997620f,  0.844853565f,
+   -0.536379292f,  0.843977047f,
+   -0.537759527f,  0.843098269f,
+   -0.539138323f,  0.842217234f,
+   -0.540515675f,  0.841333944f,
+   -0.541891581f,  0.840448401f,
+   -0.543266035f,  0.839560608f,
+   -0.544639035f,  0.838670568f,
+   -0.546010577f,  0.837778282f,
+   -0.547380657f,  0.836883753f,
+   -0.548749271f,  0.835986984f,
+   -0.550116417f,  0.835087976f,
+   -0.551482089f,  0.834186733f,
+   -0.552846285f,  0.833283256f,
+   -0.554209001f,  0.832377549f,
+   -0.555570233f,  0.831469612f,
+   -0.556929978f,  0.830559450f,
+   -0.558288231f,  0.829647064f,
+   -0.559644990f,  0.828732457f,
+   -0.561000251f,  0.827815631f,
+   -0.562354009f,  0.826896589f,
+   -0.563706262f,  0.825975333f,
+   -0.565057006f,  0.825051865f,
+   -0.566406237f,  0.824126189f,
+   -0.567753951f,  0.823198306f,
+   -0.569100146f,  0.822268219f,
+   -0.570444817f,  0.821335931f,
+   -0.571787960f,  0.820401444f,
+   -0.573129573f,  0.819464760f,
+   -0.574469651f,  0.818525882f,
+   -0.575808191f,  0.817584813f,
+   -0.577145190f,  0.816641555f,
+   -0.578480643f,  0.815696111f,
+   -0.579814548f,  0.814748483f,
+   -0.581146900f,  0.813798673f,
+   -0.582477697f,  0.812846685f,
+   -0.583806934f,  0.811892520f,
+   -0.585134608f,  0.810936182f,
+   -0.586460715f,  0.809977672f,
+   -0.587785252f,  0.809016994f,
+   -0.589108216f,  0.808054150f,
+   -0.590429602f,  0.807089143f,
+   -0.591749408f,  0.806121975f,
+   -0.593067629f,  0.805152649f,
+   -0.594384262f,  0.804181167f,
+   -0.595699304f,  0.803207531f,
+   -0.597012752f,  0.802231746f,
+   -0.598324601f,  0.801253813f,
+   -0.599634848f,  0.800273734f,
+   -0.600943489f,  0.799291513f,
+   -0.602250522f,  0.798307152f,
+   -0.603555942f,  0.797320654f,
+   -0.604859746f,  0.796332021f,
+   -0.606161931f,  0.795341256f,
+   -0.607462493f,  0.794348361f,
+   -0.608761429f,  0.793353340f,
+   -0.610058735f,  0.792356195f,
+   -0.611354407f,  0.791356929f,
+   -0.612648443f,  0.790355543f,
+   -0.613940839f,  0.789352042f,
+   -0.615231591f,  0.788346428f,
+   -0.616520695f,  0.787338702f,
+   -0.617808149f,  0.786328869f,
+   -0.619093949f,  0.785316931f,
+   -0.620378092f,  0.784302890f,
+   -0.621660573f,  0.783286749f,
+   -0.622941391f,  0.782268511f,
+   -0.624220540f,  0.781248179f,
+   -0.625498018f,  0.780225755f,
+   -0.626773822f,  0.779201243f,
+   -0.628047947f,  0.778174644f,
+   -0.629320391f,  0.777145961f,
+   -0.630591150f,  0.776115199f,
+   -0.631860221f,  0.775082358f,
+   -0.633127600f,  0.774047442f,
+   -0.634393284f,  0.773010453f,
+   -0.635657270f,  0.771971395f,
+   -0.636919554f,  0.770930271f,
+   -0.638180132f,  0.769887082f,
+   -0.639439002f,  0.768841832f,
+   -0.640696160f,  0.767794524f,
+   -0.641951603f,  0.766745160f,
+   -0.643205326f,  0.765693743f,
+   -0.644457328f,  0.764640276f,
+   -0.645707605f,  0.763584762f,
+   -0.646956153f,  0.762527204f,
+   -0.648202968f,  0.761467604f,
+   -0.649448048f,  0.760405966f,
+   -0.650691390f,  0.759342291f,
+   -0.651932989f,  0.758276584f,
+   -0.653172843f,  0.757208847f,
+   -0.654410948f,  0.756139082f,
+   -0.655647301f,  0.755067293f,
+   -0.656881899f,  0.753993482f,
+   -0.658114738f,  0.752917653f,
+   -0.659345815f,  0.751839807f,
+   -0.660575127f,  0.750759949f,
+   -0.661802670f,  0.749678081f,
+   -0.663028442f,  0.748594206f,
+   -0.664252438f,  0.747508327f,
+   -0.665474656f,  0.746420446f,
+   -0.666695092f,  0.745330567f,
+   -0.667913743f,  0.744238693f,
+   -0.669130606f,  0.743144825f,
+   -0.670345678f,  0.742048969f,
+   -0.671558955f,  0.740951125f,
+   -0.672770434f,  0.739851298f,
+   -0.673980111f,  0.738749490f,
+   -0.675187985f,  0.737645704f,
+   -0.676394050f,  0.736539944f,
+   -0.677598305f,  0.735432211f,
+   -0.678800746f,  0.734322509f,
+   -0.680001369f,  0.733210842f,
+   -0.681200171f,  0.732097211f,
+   -0.682397150f,  0.730981620f,
+   -0.683592302f,  0.729864073f,
+   -0.684785624f,  0.728744571f,
+   -0.685977112f,  0.727623118f,
+   -0.687166764f,  0.726499717f,
+   -0.688354576f,  0.725374371f,
+   -0.689540545f,  0.724247083f,
+   -0.690724668f,  0.723117856f,
+   -0.691906941f,  0.721986693f,
+   -0.693087363f,  0.720853597f,
+   -0.694265928f,  0.719718571f,
+   -0.695442635f,  0.718581618f,
+   -0.696617480f,  0.717442741f,
+   -0.697790460f,  0.716301943f,
+   -0.698961572f,  0.715159228f,
+   -0.700130812f,  0.714014598f,
+   -0.701298178f,  0.712868056f,
+   -0.702463666f,  0.711719606f,
+   -0.703627274f,  0.710569250f,
+   -0.704788998f,  0.709416992f,
+   -0.705948834f,  0.708262835f,
+   -0.707106781f,  0.707106781f,
+   -0.708262835f,  0.705948834f,
+   -0.709416992f,  0.704788998f,
+   -0.710569250f,  0.703627274f,
+   -0.711719606f,  0.702463666f,
+   -0.712868056f,  0.701298178f,
+   -0.714014598f,  0.700130812f,
+   -0.715159228f,  0.698961572f,
+   -0.716301943f,  0.697790460f,
+   -0.717442741f,  0.696617480f,
+   -0.718581618f,  0.695442635f,
+   -0.719718571f,  0.694265928f,
+   -0.720853597f,  0.693087363f,
+   -0.721986693f,  0.691906941f,
+   -0.723117856f,  0.690724668f,
+   -0.724247083f,  0.689540545f,
+   -0.725374371f,  0.688354576f,
+   -0.726499717f,  0.687166764f,
+   -0.727623118f,  0.685977112f,
+   -0.728744571f,  0.684785624f,
+   -0.729864073f,  0.683592302f,
+   -0.730981620f,  0.682397150f,
+   -0.732097211f,  0.681200171f,
+   -0.733210842f,  0.680001369f,
+   -0.734322509f,  0.678800746f,
+   -0.735432211f,  0.677598305f,
+   -0.736539944f,  0.676394050f,
+   -0.737645704f,  0.675187985f,
+   -0.738749490f,  0.673980111f,
+   -0.739851298f,  0.672770434f,
+   -0.740951125f,  0.671558955f,
+   -0.742048969f,  0.670345678f,
+   -0.743144825f,  0.669130606f,
+   -0.744238693f,  0.667913743f,
+   -0.745330567f,  0.666695092f,
+   -0.746420446f,  0.665474656f,
+   -0.747508327f,  0.664252438f,
+   -0.748594206f,  0.663028442f,
+   -0.749678081f,  0.661802670f,
+   -0.750759949f,  0.660575127f,
+   -0.751839807f,  0.659345815f,
+   -0.752917653f,  0.658114738f,
+   -0.753993482f,  0.656881899f,
+   -0.755067293f,  0.655647301f,
+   -0.756139082f,  0.654410948f,
+   -0.757208847f,  0.653172843f,
+   -0.758276584f,  0.651932989f,
+   -0.759342291f,  0.650691390f,
+   -0.760405966f,  0.649448048f,
+   -0.761467604f,  0.648202968f,
+   -0.762527204f,  0.646956153f,
+   -0.763584762f,  0.645707605f,
+   -0.764640276f,  0.644457328f,
+   -0.765693743f,  0.643205326f,
+   -0.766745160f,  0.641951603f,
+   -0.767794524f,  0.640696160f,
+   -0.768841832f,  0.639439002f,
+   -0.769887082f,  0.638180132f,
+   -0.770930271f,  0.636919554f,
+   -0.771971395f,  0.635657270f,
+   -0.773010453f,  0.634393284f,
+   -0.774047442f,  0.633127600f,
+   -0.775082358f,  0.631860221f,
+   -0.776115199f,  0.630591150f,
+   -0.777145961f,  0.629320391f,
+   -0.778174644f,  0.628047947f,
+   -0.779201243f,  0.626773822f,
+   -0.780225755f,  0.625498018f,
+   -0.781248179f,  0.624220540f,
+   -0.782268511f,  0.622941391f,
+   -0.783286749f,  0.621660573f,
+   -0.784302890f,  0.620378092f,
+   -0.785316931f,  0.619093949f,
+   -0.786328869f,  0.617808149f,
+   -0.787338702f,  0.616520695f,
+   -0.788346428f,  0.615231591f,
+   -0.789352042f,  0.613940839f,
+   -0.790355543f,  0.612648443f,
+   -0.791356929f,  0.611354407f,
+   -0.792356195f,  0.610058735f,
+   -0.793353340f,  0.608761429f,
+   -0.794348361f,  0.607462493f,
+   -0.795341256f,  0.606161931f,
+   -0.796332021f,  0.604859746f,
+   -0.797320654f,  0.603555942f,
+   -0.798307152f,  0.602250522f,
+   -0.799291513f,  0.600943489f,
+   -0.800273734f,  0.599634848f,
+   -0.801253813f,  0.598324601f,
+   -0.802231746f,  0.597012752f,
+   -0.803207531f,  0.595699304f,
+   -0.804181167f,  0.594384262f,
+   -0.805152649f,  0.593067629f,
+   -0.806121975f,  0.591749408f,
+   -0.807089143f,  0.590429602f,
+   -0.808054150f,  0.589108216f,
+   -0.809016994f,  0.587785252f,
+   -0.809977672f,  0.586460715f,
+   -0.810936182f,  0.585134608f,
+   -0.811892520f,  0.583806934f,
+   -0.812846685f,  0.582477697f,
+   -0.813798673f,  0.581146900f,
+   -0.814748483f,  0.579814548f,
+   -0.815696111f,  0.578480643f,
+   -0.816641555f,  0.577145190f,
+   -0.817584813f,  0.575808191f,
+   -0.818525882f,  0.574469651f,
+   -0.819464760f,  0.573129573f,
+   -0.820401444f,  0.571787960f,
+   -0.821335931f,  0.570444817f,
+   -0.822268219f,  0.569100146f,
+   -0.823198306f,  0.567753951f,
+   -0.824126189f,  0.566406237f,
+   -0.825051865f,  0.565057006f,
+   -0.825975333f,  0.563706262f,
+   -0.826896589f,  0.562354009f,
+   -0.827815631f,  0.561000251f,
+   -0.828732457f,  0.559644990f,
+   -0.829647064f,  0.558288231f,
+   -0.830559450f,  0.556929978f,
+   -0.831469612f,  0.555570233f,
+   -0.832377549f,  0.554209001f,
+   -0.833283256f,  0.552846285f,
+   -0.834186733f,  0.551482089f,
+   -0.835087976f,  0.550116417f,
+   -0.835986984f,  0.548749271f,
+   -0.836883753f,  0.547380657f,
+   -0.837778282f,  0.546010577f,
+   -0.838670568f,  0.544639035f,
+   -0.839560608f,  0.543266035f,
+   -0.840448401f,  0.541891581f,
+   -0.841333944f,  0.540515675f,
+   -0.842217234f,  0.539138323f,
+   -0.843098269f,  0.537759527f,
+   -0.843977047f,  0.536379292f,
+   -0.844853565f,  0.534997620f,
+   -0.845727822f,  0.533614516f,
+   -0.846599814f,  0.532229983f,
+   -0.847469539f,  0.530844026f,
+   -0.848336996f,  0.529456647f,
+   -0.849202182f,  0.528067851f,
+   -0.850065093f,  0.526677641f,
+   -0.850925729f,  0.525286020f,
+   -0.851784087f,  0.523892994f,
+   -0.852640164f,  0.522498565f,
+   -0.853493959f,  0.521102737f,
+   -0.854345468f,  0.519705514f,
+   -0.855194690f,  0.518306899f,
+   -0.856041623f,  0.516906897f,
+   -0.856886264f,  0.515505511f,
+   -0.857728610f,  0.514102744f,
+   -0.858568660f,  0.512698601f,
+   -0.859406412f,  0.511293086f,
+   -0.860241862f,  0.509886202f,
+   -0.861075009f,  0.508477952f,
+   -0.861905852f,  0.507068342f,
+   -0.862734386f,  0.505657373f,
+   -0.863560611f,  0.504245051f,
+   -0.864384523f,  0.502831379f,
+   -0.865206122f,  0.501416361f,
+   -0.866025404f,  0.500000000f,
+   -0.866842367f,  0.498582301f,
+   -0.867657010f,  0.497163266f,
+   -0.868469329f,  0.495742901f,
+   -0.869279324f,  0.494321208f,
+   -0.870086991f,  0.492898192f,
+   -0.870892329f,  0.491473857f,
+   -0.871695335f,  0.490048205f,
+   -0.872496007f,  0.488621241f,
+   -0.873294343f,  0.487192970f,
+   -0.874090342f,  0.485763394f,
+   -0.874884000f,  0.484332517f,
+   -0.875675315f,  0.482900344f,
+   -0.876464287f,  0.481466878f,
+   -0.877250911f,  0.480032122f,
+   -0.878035187f,  0.478596082f,
+   -0.878817113f,  0.477158760f,
+   -0.879596685f,  0.475720161f,
+   -0.880373903f,  0.474280288f,
+   -0.881148763f,  0.472839145f,
+   -0.881921264f,  0.471396737f,
+   -0.882691405f,  0.469953066f,
+   -0.883459181f,  0.468508137f,
+   -0.884224593f,  0.467061954f,
+   -0.884987637f,  0.465614520f,
+   -0.885748312f,  0.464165840f,
+   -0.886506616f,  0.462715917f,
+   -0.887262546f,  0.461264755f,
+   -0.888016101f,  0.459812358f,
+   -0.888767278f,  0.458358731f,
+   -0.889516075f,  0.456903876f,
+   -0.890262492f,  0.455447797f,
+   -0.891006524f,  0.453990500f,
+   -0.891748171f,  0.452531987f,
+   -0.892487431f,  0.451072262f,
+   -0.893224301f,  0.449611330f,
+   -0.893958780f,  0.448149194f,
+   -0.894690865f,  0.446685858f,
+   -0.895420555f,  0.445221326f,
+   -0.896147848f,  0.443755602f,
+   -0.896872742f,  0.442288690f,
+   -0.897595234f,  0.440820594f,
+   -0.898315323f,  0.439351318f,
+   -0.899033007f,  0.437880866f,
+   -0.899748284f,  0.436409241f,
+   -0.900461152f,  0.434936447f,
+   -0.901171610f,  0.433462490f,
+   -0.901879654f,  0.431987372f,
+   -0.902585284f,  0.430511097f,
+   -0.903288498f,  0.429033669f,
+   -0.903989293f,  0.427555093f,
+   -0.904687668f,  0.426075373f,
+   -0.905383621f,  0.424594511f,
+   -0.906077150f,  0.423112513f,
+   -0.906768253f,  0.421629382f,
+   -0.907456928f,  0.420145122f,
+   -0.908143174f,  0.418659738f,
+   -0.908826988f,  0.417173232f,
+   -0.909508369f,  0.415685610f,
+   -0.910187316f,  0.414196874f,
+   -0.910863825f,  0.412707030f,
+   -0.911537896f,  0.411216081f,
+   -0.912209526f,  0.409724030f,
+   -0.912878714f,  0.408230883f,
+   -0.913545458f,  0.406736643f,
+   -0.914209756f,  0.405241314f,
+   -0.914871606f,  0.403744900f,
+   -0.915531007f,  0.402247405f,
+   -0.916187957f,  0.400748833f,
+   -0.916842454f,  0.399249188f,
+   -0.917494496f,  0.397748475f,
+   -0.918144082f,  0.396246696f,
+   -0.918791210f,  0.394743856f,
+   -0.919435878f,  0.393239960f,
+   -0.920078084f,  0.391735011f,
+   -0.920717827f,  0.390229013f,
+   -0.921355105f,  0.388721970f,
+   -0.921989916f,  0.387213887f,
+   -0.922622259f,  0.385704767f,
+   -0.923252132f,  0.384194614f,
+   -0.923879533f,  0.382683432f,
+   -0.924504460f,  0.381171226f,
+   -0.925126912f,  0.379658000f,
+   -0.925746887f,  0.378143757f,
+   -0.926364384f,  0.376628502f,
+   -0.926979400f,  0.375112238f,
+   -0.927591935f,  0.373594970f,
+   -0.928201987f,  0.372076702f,
+   -0.928809553f,  0.370557438f,
+   -0.929414632f,  0.369037181f,
+   -0.930017224f,  0.367515937f,
+   -0.930617325f,  0.365993708f,
+   -0.931214935f,  0.364470500f,
+   -0.931810051f,  0.362946316f,
+   -0.932402673f,  0.361421160f,
+   -0.932992799f,  0.359895037f,
+   -0.933580426f,  0.358367950f,
+   -0.934165555f,  0.356839903f,
+   -0.934748182f,  0.355310901f,
+   -0.935328306f,  0.353780948f,
+   -0.935905927f,  0.352250048f,
+   -0.936481041f,  0.350718205f,
+   -0.937053649f,  0.349185422f,
+   -0.937623748f,  0.347651705f,
+   -0.938191336f,  0.346117057f,
+   -0.938756412f,  0.344581482f,
+   -0.939318976f,  0.343044985f,
+   -0.939879024f,  0.341507570f,
+   -0.940436556f,  0.339969240f,
+   -0.940991570f,  0.338430000f,
+   -0.941544065f,  0.336889853f,
+   -0.942094039f,  0.335348805f,
+   -0.942641491f,  0.333806859f,
+   -0.943186419f,  0.332264020f,
+   -0.943728822f,  0.330720290f,
+   -0.944268698f,  0.329175676f,
+   -0.944806046f,  0.327630180f,
+   -0.945340865f,  0.326083806f,
+   -0.945873153f,  0.324536560f,
+   -0.946402908f,  0.322988445f,
+   -0.946930129f,  0.321439465f,
+   -0.947454816f,  0.319889625f,
+   -0.947976965f,  0.318338928f,
+   -0.948496577f,  0.316787379f,
+   -0.949013649f,  0.315234982f,
+   -0.949528181f,  0.313681740f,
+   -0.950040170f,  0.312127659f,
+   -0.950549616f,  0.310572743f,
+   -0.951056516f,  0.309016994f,
+   -0.951560871f,  0.307460419f,
+   -0.952062678f,  0.305903020f,
+   -0.952561936f,  0.304344802f,
+   -0.953058643f,  0.302785770f,
+   -0.953552799f,  0.301225927f,
+   -0.954044402f,  0.299665277f,
+   -0.954533451f,  0.298103825f,
+   -0.955019944f,  0.296541575f,
+   -0.955503881f,  0.294978531f,
+   -0.955985259f,  0.293414697f,
+   -0.956464078f,  0.291850078f,
+   -0.956940336f,  0.290284677f,
+   -0.957414032f,  0.288718499f,
+   -0.957885164f,  0.287151549f,
+   -0.958353733f,  0.285583829f,
+   -0.958819735f,  0.284015345f,
+   -0.959283170f,  0.282446100f,
+   -0.959744037f,  0.280876099f,
+   -0.960202335f,  0.279305346f,
+   -0.960658061f,  0.277733846f,
+   -0.961111216f,  0.276161602f,
+   -0.961561798f,  0.274588618f,
+   -0.962009805f,  0.273014899f,
+   -0.962455236f,  0.271440450f,
+   -0.962898091f,  0.269865274f,
+   -0.963338368f,  0.268289375f,
+   -0.963776066f,  0.266712757f,
+   -0.964211183f,  0.265135426f,
+   -0.964643719f,  0.263557385f,
+   -0.965073672f,  0.261978638f,
+   -0.965501042f,  0.260399190f,
+   -0.965925826f,  0.258819045f,
+   -0.966348025f,  0.257238207f,
+   -0.966767636f,  0.255656680f,
+   -0.967184659f,  0.254074469f,
+   -0.967599092f,  0.252491577f,
+   -0.968010935f,  0.250908009f,
+   -0.968420187f,  0.249323770f,
+   -0.968826845f,  0.247738863f,
+   -0.969230910f,  0.246153293f,
+   -0.969632379f,  0.244567064f,
+   -0.970031253f,  0.242980180f,
+   -0.970427530f,  0.241392645f,
+   -0.970821208f,  0.239804465f,
+   -0.971212288f,  0.238215642f,
+   -0.971600767f,  0.236626181f,
+   -0.971986645f,  0.235036087f,
+   -0.972369920f,  0.233445364f,
+   -0.972750593f,  0.231854016f,
+   -0.973128661f,  0.230262046f,
+   -0.973504123f,  0.228669461f,
+   -0.973876979f,  0.227076263f,
+   -0.974247228f,  0.225482457f,
+   -0.974614869f,  0.223888048f,
+   -0.974979900f,  0.222293039f,
+   -0.975342321f,  0.220697435f,
+   -0.975702130f,  0.219101240f,
+   -0.976059327f,  0.217504459f,
+   -0.976413911f,  0.215907095f,
+   -0.976765881f,  0.214309153f,
+   -0.977115236f,  0.212710637f,
+   -0.977461975f,  0.211111552f,
+   -0.977806097f,  0.209511902f,
+   -0.978147601f,  0.207911691f,
+   -0.978486486f,  0.206310923f,
+   -0.978822751f,  0.204709603f,
+   -0.979156396f,  0.203107734f,
+   -0.979487420f,  0.201505322f,
+   -0.979815821f,  0.199902371f,
+   -0.980141598f,  0.198298884f,
+   -0.980464752f,  0.196694866f,
+   -0.980785280f,  0.195090322f,
+   -0.981103183f,  0.193485255f,
+   -0.981418459f,  0.191879671f,
+   -0.981731108f,  0.190273572f,
+   -0.982041128f,  0.188666965f,
+   -0.982348519f,  0.187059852f,
+   -0.982653279f,  0.185452238f,
+   -0.982955409f,  0.183844128f,
+   -0.983254908f,  0.182235525f,
+   -0.983551773f,  0.180626435f,
+   -0.983846006f,  0.179016861f,
+   -0.984137604f,  0.177406808f,
+   -0.984426568f,  0.175796280f,
+   -0.984712896f,  0.174185281f,
+   -0.984996588f,  0.172573816f,
+   -0.985277642f,  0.170961889f,
+   -0.985556059f,  0.169349504f,
+   -0.985831837f,  0.167736666f,
+   -0.986104976f,  0.166123378f,
+   -0.986375474f,  0.164509646f,
+   -0.986643332f,  0.162895473f,
+   -0.986908548f,  0.161280865f,
+   -0.987171122f,  0.159665824f,
+   -0.987431053f,  0.158050356f,
+   -0.987688341f,  0.156434465f,
+   -0.987942984f,  0.154818155f,
+   -0.988194982f,  0.153201431f,
+   -0.988444334f,  0.151584296f,
+   -0.988691040f,  0.149966756f,
+   -0.988935099f,  0.148348814f,
+   -0.989176510f,  0.146730474f,
+   -0.989415273f,  0.145111742f,
+   -0.989651387f,  0.143492622f,
+   -0.989884851f,  0.141873117f,
+   -0.990115665f,  0.140253233f,
+   -0.990343829f,  0.138632973f,
+   -0.990569340f,  0.137012342f,
+   -0.990792200f,  0.135391344f,
+   -0.991012407f,  0.133769983f,
+   -0.991229961f,  0.132148265f,
+   -0.991444861f,  0.130526192f,
+   -0.991657107f,  0.128903770f,
+   -0.991866698f,  0.127281003f,
+   -0.992073633f,  0.125657896f,
+   -0.992277912f,  0.124034451f,
+   -0.992479535f,  0.122410675f,
+   -0.992678500f,  0.120786571f,
+   -0.992874808f,  0.119162144f,
+   -0.993068457f,  0.117537397f,
+   -0.993259448f,  0.115912336f,
+   -0.993447779f,  0.114286965f,
+   -0.993633451f,  0.112661288f,
+   -0.993816462f,  0.111035309f,
+   -0.993996813f,  0.109409032f,
+   -0.994174502f,  0.107782463f,
+   -0.994349530f,  0.106155605f,
+   -0.994521895f,  0.104528463f,
+   -0.994691598f,  0.102901041f,
+   -0.994858638f,  0.101273344f,
+   -0.995023014f,  0.099645376f,
+   -0.995184727f,  0.098017140f,
+   -0.995343775f,  0.096388643f,
+   -0.995500158f,  0.094759887f,
+   -0.995653875f,  0.093130877f,
+   -0.995804928f,  0.091501619f,
+   -0.995953314f,  0.089872115f,
+   -0.996099033f,  0.088242371f,
+   -0.996242086f,  0.086612390f,
+   -0.996382472f,  0.084982177f,
+   -0.996520189f,  0.083351737f,
+   -0.996655239f,  0.081721074f,
+   -0.996787621f,  0.080090192f,
+   -0.996917334f,  0.078459096f,
+   -0.997044378f,  0.076827789f,
+   -0.997168752f,  0.075196277f,
+   -0.997290457f,  0.073564564f,
+   -0.997409491f,  0.071932653f,
+   -0.997525856f,  0.070300550f,
+   -0.997639549f,  0.068668259f,
+   -0.997750572f,  0.067035784f,
+   -0.997858923f,  0.065403129f,
+   -0.997964603f,  0.063770300f,
+   -0.998067611f,  0.062137299f,
+   -0.998167947f,  0.060504132f,
+   -0.998265610f,  0.058870804f,
+   -0.998360601f,  0.057237317f,
+   -0.998452919f,  0.055603678f,
+   -0.998542563f,  0.053969889f,
+   -0.998629535f,  0.052335956f,
+   -0.998713832f,  0.050701883f,
+   -0.998795456f,  0.049067674f,
+   -0.998874406f,  0.047433334f,
+   -0.998950681f,  0.045798867f,
+   -0.999024282f,  0.044164277f,
+   -0.999095209f,  0.042529569f,
+   -0.999163460f,  0.040894747f,
+   -0.999229036f,  0.039259816f,
+   -0.999291937f,  0.037624779f,
+   -0.999352163f,  0.035989642f,
+   -0.999409713f,  0.034354408f,
+   -0.999464587f,  0.032719083f,
+   -0.999516786f,  0.031083670f,
+   -0.999566309f,  0.029448173f,
+   -0.999613155f,  0.027812598f,
+   -0.999657325f,  0.026176948f,
+   -0.999698819f,  0.024541229f,
+   -0.999737636f,  0.022905443f,
+   -0.999773777f,  0.021269596f,
+   -0.999807240f,  0.019633692f,
+   -0.999838028f,  0.017997736f,
+   -0.999866138f,  0.016361732f,
+   -0.999891571f,  0.014725683f,
+   -0.999914328f,  0.013089596f,
+   -0.999934407f,  0.011453473f,
+   -0.999951809f,  0.009817319f,
+   -0.999966534f,  0.008181140f,
+   -0.999978582f,  0.006544938f,
+   -0.999987952f,  0.004908719f,
+   -0.999994645f,  0.003272487f,
+   -0.999998661f,  0.001636245f,
+   -1.000000000f,  0.000000000f,
+   -0.999998661f, -0.001636245f,
+   -0.999994645f, -0.003272487f,
+   -0.999987952f, -0.004908719f,
+   -0.999978582f, -0.006544938f,
+   -0.999966534f, -0.008181140f,
+   -0.999951809f, -0.009817319f,
+   -0.999934407f, -0.011453473f,
+   -0.999914328f, -0.013089596f,
+   -0.999891571f, -0.014725683f,
+   -0.999866138f, -0.016361732f,
+   -0.999838028f, -0.017997736f,
+   -0.999807240f, -0.019633692f,
+   -0.999773777f, -0.021269596f,
+   -0.999737636f, -0.022905443f,
+   -0.999698819f, -0.024541229f,
+   -0.999657325f, -0.026176948f,
+   -0.999613155f, -0.027812598f,
+   -0.999566309f, -0.029448173f,
+   -0.999516786f, -0.031083670f,
+   -0.999464587f, -0.032719083f,
+   -0.999409713f, -0.034354408f,
+   -0.999352163f, -0.035989642f,
+   -0.999291937f, -0.037624779f,
+   -0.999229036f, -0.039259816f,
+   -0.999163460f, -0.040894747f,
+   -0.999095209f, -0.042529569f,
+   -0.999024282f, -0.044164277f,
+   -0.998950681f, -0.045798867f,
+   -0.998874406f, -0.047433334f,
+   -0.998795456f, -0.049067674f,
+   -0.998713832f, -0.050701883f,
+   -0.998629535f, -0.052335956f,
+   -0.998542563f, -0.053969889f,
+   -0.998452919f, -0.055603678f,
+   -0.998360601f, -0.057237317f,
+   -0.998265610f, -0.058870804f,
+   -0.998167947f, -0.060504132f,
+   -0.998067611f, -0.062137299f,
+   -0.997964603f, -0.063770300f,
+   -0.997858923f, -0.065403129f,
+   -0.997750572f, -0.067035784f,
+   -0.997639549f, -0.068668259f,
+   -0.997525856f, -0.070300550f,
+   -0.997409491f, -0.071932653f,
+   -0.997290457f, -0.073564564f,
+   -0.997168752f, -0.075196277f,
+   -0.997044378f, -0.076827789f,
+   -0.996917334f, -0.078459096f,
+   -0.996787621f, -0.080090192f,
+   -0.996655239f, -0.081721074f,
+   -0.996520189f, -0.083351737f,
+   -0.996382472f, -0.084982177f,
+   -0.996242086f, -0.086612390f,
+   -0.996099033f, -0.088242371f,
+   -0.995953314f, -0.089872115f,
+   -0.995804928f, -0.091501619f,
+   -0.995653875f, -0.093130877f,
+   -0.995500158f, -0.094759887f,
+   -0.995343775f, -0.096388643f,
+   -0.995184727f, -0.098017140f,
+   -0.995023014f, -0.099645376f,
+   -0.994858638f, -0.101273344f,
+   -0.994691598f, -0.102901041f,
+   -0.994521895f, -0.104528463f,
+   -0.994349530f, -0.106155605f,
+   -0.994174502f, -0.107782463f,
+   -0.993996813f, -0.109409032f,
+   -0.993816462f, -0.111035309f,
+   -0.993633451f, -0.112661288f,
+   -0.993447779f, -0.114286965f,
+   -0.993259448f, -0.115912336f,
+   -0.993068457f, -0.117537397f,
+   -0.992874808f, -0.119162144f,
+   -0.992678500f, -0.120786571f,
+   -0.992479535f, -0.122410675f,
+   -0.992277912f, -0.124034451f,
+   -0.992073633f, -0.125657896f,
+   -0.991866698f, -0.127281003f,
+   -0.991657107f, -0.128903770f,
+   -0.991444861f, -0.130526192f,
+   -0.991229961f, -0.132148265f,
+   -0.991012407f, -0.133769983f,
+   -0.990792200f, -0.135391344f,
+   -0.990569340f, -0.137012342f,
+   -0.990343829f, -0.138632973f,
+   -0.990115665f, -0.140253233f,
+   -0.989884851f, -0.141873117f,
+   -0.989651387f, -0.143492622f,
+   -0.989415273f, -0.145111742f,
+   -0.989176510f, -0.146730474f,
+   -0.988935099f, -0.148348814f,
+   -0.988691040f, -0.149966756f,
+   -0.988444334f, -0.151584296f,
+   -0.988194982f, -0.153201431f,
+   -0.987942984f, -0.154818155f,
+   -0.987688341f, -0.156434465f,
+   -0.987431053f, -0.158050356f,
+   -0.987171122f, -0.159665824f,
+   -0.986908548f, -0.161280865f,
+   -0.986643332f, -0.162895473f,
+   -0.986375474f, -0.164509646f,
+   -0.986104976f, -0.166123378f,
+   -0.985831837f, -0.167736666f,
+   -0.985556059f, -0.169349504f,
+   -0.985277642f, -0.170961889f,
+   -0.984996588f, -0.172573816f,
+   -0.984712896f, -0.174185281f,
+   -0.984426568f, -0.175796280f,
+   -0.984137604f, -0.177406808f,
+   -0.983846006f, -0.179016861f,
+   -0.983551773f, -0.180626435f,
+   -0.983254908f, -0.182235525f,
+   -0.982955409f, -0.183844128f,
+   -0.982653279f, -0.185452238f,
+   -0.982348519f, -0.187059852f,
+   -0.982041128f, -0.188666965f,
+   -0.981731108f, -0.190273572f,
+   -0.981418459f, -0.191879671f,
+   -0.981103183f, -0.193485255f,
+   -0.980785280f, -0.195090322f,
+   -0.980464752f, -0.196694866f,
+   -0.980141598f, -0.198298884f,
+   -0.979815821f, -0.199902371f,
+   -0.979487420f, -0.201505322f,
+   -0.979156396f, -0.203107734f,
+   -0.978822751f, -0.204709603f,
+   -0.978486486f, -0.206310923f,
+   -0.978147601f, -0.207911691f,
+   -0.977806097f, -0.209511902f,
+   -0.977461975f, -0.211111552f,
+   -0.977115236f, -0.212710637f,
+   -0.976765881f, -0.214309153f,
+   -0.976413911f, -0.215907095f,
+   -0.976059327f, -0.217504459f,
+   -0.975702130f, -0.219101240f,
+   -0.975342321f, -0.220697435f,
+   -0.974979900f, -0.222293039f,
+   -0.974614869f, -0.223888048f,
+   -0.974247228f, -0.225482457f,
+   -0.973876979f, -0.227076263f,
+   -0.973504123f, -0.228669461f,
+   -0.973128661f, -0.230262046f,
+   -0.972750593f, -0.231854016f,
+   -0.972369920f, -0.233445364f,
+   -0.971986645f, -0.235036087f,
+   -0.971600767f, -0.236626181f,
+   -0.971212288f, -0.238215642f,
+   -0.970821208f, -0.239804465f,
+   -0.970427530f, -0.241392645f,
+   -0.970031253f, -0.242980180f,
+   -0.969632379f, -0.244567064f,
+   -0.969230910f, -0.246153293f,
+   -0.968826845f, -0.247738863f,
+   -0.968420187f, -0.249323770f,
+   -0.968010935f, -0.250908009f,
+   -0.967599092f, -0.252491577f,
+   -0.967184659f, -0.254074469f,
+   -0.966767636f, -0.255656680f,
+   -0.966348025f, -0.257238207f,
+   -0.965925826f, -0.258819045f,
+   -0.965501042f, -0.260399190f,
+   -0.965073672f, -0.261978638f,
+   -0.964643719f, -0.263557385f,
+   -0.964211183f, -0.265135426f,
+   -0.963776066f, -0.266712757f,
+   -0.963338368f, -0.268289375f,
+   -0.962898091f, -0.269865274f,
+   -0.962455236f, -0.271440450f,
+   -0.962009805f, -0.273014899f,
+   -0.961561798f, -0.274588618f,
+   -0.961111216f, -0.276161602f,
+   -0.960658061f, -0.277733846f,
+   -0.960202335f, -0.279305346f,
+   -0.959744037f, -0.280876099f,
+   -0.959283170f, -0.282446100f,
+   -0.958819735f, -0.284015345f,
+   -0.958353733f, -0.285583829f,
+   -0.957885164f, -0.287151549f,
+   -0.957414032f, -0.288718499f,
+   -0.956940336f, -0.290284677f,
+   -0.956464078f, -0.291850078f,
+   -0.955985259f, -0.293414697f,
+   -0.955503881f, -0.294978531f,
+   -0.955019944f, -0.296541575f,
+   -0.954533451f, -0.298103825f,
+   -0.954044402f, -0.299665277f,
+   -0.953552799f, -0.301225927f,
+   -0.953058643f, -0.302785770f,
+   -0.952561936f, -0.304344802f,
+   -0.952062678f, -0.305903020f,
+   -0.951560871f, -0.307460419f,
+   -0.951056516f, -0.309016994f,
+   -0.950549616f, -0.310572743f,
+   -0.950040170f, -0.312127659f,
+   -0.949528181f, -0.313681740f,
+   -0.949013649f, -0.315234982f,
+   -0.948496577f, -0.316787379f,
+   -0.947976965f, -0.318338928f,
+   -0.947454816f, -0.319889625f,
+   -0.946930129f, -0.321439465f,
+   -0.946402908f, -0.322988445f,
+   -0.945873153f, -0.324536560f,
+   -0.945340865f, -0.326083806f,
+   -0.944806046f, -0.327630180f,
+   -0.944268698f, -0.329175676f,
+   -0.943728822f, -0.330720290f,
+   -0.943186419f, -0.332264020f,
+   -0.942641491f, -0.333806859f,
+   -0.942094039f, -0.335348805f,
+   -0.941544065f, -0.336889853f,
+   -0.940991570f, -0.338430000f,
+   -0.940436556f, -0.339969240f,
+   -0.939879024f, -0.341507570f,
+   -0.939318976f, -0.343044985f,
+   -0.938756412f, -0.344581482f,
+   -0.938191336f, -0.346117057f,
+   -0.937623748f, -0.347651705f,
+   -0.937053649f, -0.349185422f,
+   -0.936481041f, -0.350718205f,
+   -0.935905927f, -0.352250048f,
+   -0.935328306f, -0.353780948f,
+   -0.934748182f, -0.355310901f,
+   -0.934165555f, -0.356839903f,
+   -0.933580426f, -0.358367950f,
+   -0.932992799f, -0.359895037f,
+   -0.932402673f, -0.361421160f,
+   -0.931810051f, -0.362946316f,
+   -0.931214935f, -0.364470500f,
+   -0.930617325f, -0.365993708f,
+   -0.930017224f, -0.367515937f,
+   -0.929414632f, -0.369037181f,
+   -0.928809553f, -0.370557438f,
+   -0.928201987f, -0.372076702f,
+   -0.927591935f, -0.373594970f,
+   -0.926979400f, -0.375112238f,
+   -0.926364384f, -0.376628502f,
+   -0.925746887f, -0.378143757f,
+   -0.925126912f, -0.379658000f,
+   -0.924504460f, -0.381171226f,
+   -0.923879533f, -0.382683432f,
+   -0.923252132f, -0.384194614f,
+   -0.922622259f, -0.385704767f,
+   -0.921989916f, -0.387213887f,
+   -0.921355105f, -0.388721970f,
+   -0.920717827f, -0.390229013f,
+   -0.920078084f, -0.391735011f,
+   -0.919435878f, -0.393239960f,
+   -0.918791210f, -0.394743856f,
+   -0.918144082f, -0.396246696f,
+   -0.917494496f, -0.397748475f,
+   -0.916842454f, -0.399249188f,
+   -0.916187957f, -0.400748833f,
+   -0.915531007f, -0.402247405f,
+   -0.914871606f, -0.403744900f,
+   -0.914209756f, -0.405241314f,
+   -0.913545458f, -0.406736643f,
+   -0.912878714f, -0.408230883f,
+   -0.912209526f, -0.409724030f,
+   -0.911537896f, -0.411216081f,
+   -0.910863825f, -0.412707030f,
+   -0.910187316f, -0.414196874f,
+   -0.909508369f, -0.415685610f,
+   -0.908826988f, -0.417173232f,
+   -0.908143174f, -0.418659738f,
+   -0.907456928f, -0.420145122f,
+   -0.906768253f, -0.421629382f,
+   -0.906077150f, -0.423112513f,
+   -0.905383621f, -0.424594511f,
+   -0.904687668f, -0.426075373f,
+   -0.903989293f, -0.427555093f,
+   -0.903288498f, -0.429033669f,
+   -0.902585284f, -0.430511097f,
+   -0.901879654f, -0.431987372f,
+   -0.901171610f, -0.433462490f,
+   -0.900461152f, -0.434936447f,
+   -0.899748284f, -0.436409241f,
+   -0.899033007f, -0.437880866f,
+   -0.898315323f, -0.439351318f,
+   -0.897595234f, -0.440820594f,
+   -0.896872742f, -0.442288690f,
+   -0.896147848f, -0.443755602f,
+   -0.895420555f, -0.445221326f,
+   -0.894690865f, -0.446685858f,
+   -0.893958780f, -0.448149194f,
+   -0.893224301f, -0.449611330f,
+   -0.892487431f, -0.451072262f,
+   -0.891748171f, -0.452531987f,
+   -0.891006524f, -0.453990500f,
+   -0.890262492f, -0.455447797f,
+   -0.889516075f, -0.456903876f,
+   -0.888767278f, -0.458358731f,
+   -0.888016101f, -0.459812358f,
+   -0.887262546f, -0.461264755f,
+   -0.886506616f, -0.462715917f,
+   -0.885748312f, -0.464165840f,
+   -0.884987637f, -0.465614520f,
+   -0.884224593f, -0.467061954f,
+   -0.883459181f, -0.468508137f,
+   -0.882691405f, -0.469953066f,
+   -0.881921264f, -0.471396737f,
+   -0.881148763f, -0.472839145f,
+   -0.880373903f, -0.474280288f,
+   -0.879596685f, -0.475720161f,
+   -0.878817113f, -0.477158760f,
+   -0.878035187f, -0.478596082f,
+   -0.877250911f, -0.480032122f,
+   -0.876464287f, -0.481466878f,
+   -0.875675315f, -0.482900344f,
+   -0.874884000f, -0.484332517f,
+   -0.874090342f, -0.485763394f,
+   -0.873294343f, -0.487192970f,
+   -0.872496007f, -0.488621241f,
+   -0.871695335f, -0.490048205f,
+   -0.870892329f, -0.491473857f,
+   -0.870086991f, -0.492898192f,
+   -0.869279324f, -0.494321208f,
+   -0.868469329f, -0.495742901f,
+   -0.867657010f, -0.497163266f,
+   -0.866842367f, -0.498582301f,
+   -0.866025404f, -0.500000000f,
+   -0.865206122f, -0.501416361f,
+   -0.864384523f, -0.502831379f,
+   -0.863560611f, -0.504245051f,
+   -0.862734386f, -0.505657373f,
+   -0.861905852f, -0.507068342f,
+   -0.861075009f, -0.508477952f,
+   -0.860241862f, -0.509886202f,
+   -0.859406412f, -0.511293086f,
+   -0.858568660f, -0.512698601f,
+   -0.857728610f, -0.514102744f,
+   -0.856886264f, -0.515505511f,
+   -0.856041623f, -0.516906897f,
+   -0.855194690f, -0.518306899f,
+   -0.854345468f, -0.519705514f,
+   -0.853493959f, -0.521102737f,
+   -0.852640164f, -0.522498565f,
+   -0.851784087f, -0.523892994f,
+   -0.850925729f, -0.525286020f,
+   -0.850065093f, -0.526677641f,
+   -0.849202182f, -0.528067851f,
+   -0.848336996f, -0.529456647f,
+   -0.847469539f, -0.530844026f,
+   -0.846599814f, -0.532229983f,
+   -0.845727822f, -0.533614516f,
+   -0.844853565f, -0.534997620f,
+   -0.843977047f, -0.536379292f,
+   -0.843098269f, -0.537759527f,
+   -0.842217234f, -0.539138323f,
+   -0.841333944f, -0.540515675f,
+   -0.840448401f, -0.541891581f,
+   -0.839560608f, -0.543266035f,
+   -0.838670568f, -0.544639035f,
+   -0.837778282f, -0.546010577f,
+   -0.836883753f, -0.547380657f,
+   -0.835986984f, -0.548749271f,
+   -0.835087976f, -0.550116417f,
+   -0.834186733f, -0.551482089f,
+   -0.833283256f, -0.552846285f,
+   -0.832377549f, -0.554209001f,
+   -0.831469612f, -0.555570233f,
+   -0.830559450f, -0.556929978f,
+   -0.829647064f, -0.558288231f,
+   -0.828732457f, -0.559644990f,
+   -0.827815631f, -0.561000251f,
+   -0.826896589f, -0.562354009f,
+   -0.825975333f, -0.563706262f,
+   -0.825051865f, -0.565057006f,
+   -0.824126189f, -0.566406237f,
+   -0.823198306f, -0.567753951f,
+   -0.822268219f, -0.569100146f,
+   -0.821335931f, -0.570444817f,
+   -0.820401444f, -0.571787960f,
+   -0.819464760f, -0.573129573f,
+   -0.818525882f, -0.574469651f,
+   -0.817584813f, -0.575808191f,
+   -0.816641555f, -0.577145190f,
+   -0.815696111f, -0.578480643f,
+   -0.814748483f, -0.579814548f,
+   -0.813798673f, -0.581146900f,
+   -0.812846685f, -0.582477697f,
+   -0.811892520f, -0.583806934f,
+   -0.810936182f, -0.585134608f,
+   -0.809977672f, -0.586460715f,
+   -0.809016994f, -0.587785252f,
+   -0.808054150f, -0.589108216f,
+   -0.807089143f, -0.590429602f,
+   -0.806121975f, -0.591749408f,
+   -0.805152649f, -0.593067629f,
+   -0.804181167f, -0.594384262f,
+   -0.803207531f, -0.595699304f,
+   -0.802231746f, -0.597012752f,
+   -0.801253813f, -0.598324601f,
+   -0.800273734f, -0.599634848f,
+   -0.799291513f, -0.600943489f,
+   -0.798307152f, -0.602250522f,
+   -0.797320654f, -0.603555942f,
+   -0.796332021f, -0.604859746f,
+   -0.795341256f, -0.606161931f,
+   -0.794348361f, -0.607462493f,
+   -0.793353340f, -0.608761429f,
+   -0.792356195f, -0.610058735f,
+   -0.791356929f, -0.611354407f,
+   -0.790355543f, -0.612648443f,
+   -0.789352042f, -0.613940839f,
+   -0.788346428f, -0.615231591f,
+   -0.787338702f, -0.616520695f,
+   -0.786328869f, -0.617808149f,
+   -0.785316931f, -0.619093949f,
+   -0.784302890f, -0.620378092f,
+   -0.783286749f, -0.621660573f,
+   -0.782268511f, -0.622941391f,
+   -0.781248179f, -0.624220540f,
+   -0.780225755f, -0.625498018f,
+   -0.779201243f, -0.626773822f,
+   -0.778174644f, -0.628047947f,
+   -0.777145961f, -0.629320391f,
+   -0.776115199f, -0.630591150f,
+   -0.775082358f, -0.631860221f,
+   -0.774047442f, -0.633127600f,
+   -0.773010453f, -0.634393284f,
+   -0.771971395f, -0.635657270f,
+   -0.770930271f, -0.636919554f,
+   -0.769887082f, -0.638180132f,
+   -0.768841832f, -0.639439002f,
+   -0.767794524f, -0.640696160f,
+   -0.766745160f, -0.641951603f,
+   -0.765693743f, -0.643205326f,
+   -0.764640276f, -0.644457328f,
+   -0.763584762f, -0.645707605f,
+   -0.762527204f, -0.646956153f,
+   -0.761467604f, -0.648202968f,
+   -0.760405966f, -0.649448048f,
+   -0.759342291f, -0.650691390f,
+   -0.758276584f, -0.651932989f,
+   -0.757208847f, -0.653172843f,
+   -0.756139082f, -0.654410948f,
+   -0.755067293f, -0.655647301f,
+   -0.753993482f, -0.656881899f,
+   -0.752917653f, -0.658114738f,
+   -0.751839807f, -0.659345815f,
+   -0.750759949f, -0.660575127f,
+   -0.749678081f, -0.661802670f,
+   -0.748594206f, -0.663028442f,
+   -0.747508327f, -0.664252438f,
+   -0.746420446f, -0.665474656f,
+   -0.745330567f, -0.666695092f,
+   -0.744238693f, -0.667913743f,
+   -0.743144825f, -0.669130606f,
+   -0.742048969f, -0.670345678f,
+   -0.740951125f, -0.671558955f,
+   -0.739851298f, -0.672770434f,
+   -0.738749490f, -0.673980111f,
+   -0.737645704f, -0.675187985f,
+   -0.736539944f, -0.676394050f,
+   -0.735432211f, -0.677598305f,
+   -0.734322509f, -0.678800746f,
+   -0.733210842f, -0.680001369f,
+   -0.732097211f, -0.681200171f,
+   -0.730981620f, -0.682397150f,
+   -0.729864073f, -0.683592302f,
+   -0.728744571f, -0.684785624f,
+   -0.727623118f, -0.685977112f,
+   -0.726499717f, -0.687166764f,
+   -0.725374371f, -0.688354576f,
+   -0.724247083f, -0.689540545f,
+   -0.723117856f, -0.690724668f,
+   -0.721986693f, -0.691906941f,
+   -0.720853597f, -0.693087363f,
+   -0.719718571f, -0.694265928f,
+   -0.718581618f, -0.695442635f,
+   -0.717442741f, -0.696617480f,
+   -0.716301943f, -0.697790460f,
+   -0.715159228f, -0.698961572f,
+   -0.714014598f, -0.700130812f,
+   -0.712868056f, -0.701298178f,
+   -0.711719606f, -0.702463666f,
+   -0.710569250f, -0.703627274f,
+   -0.709416992f, -0.704788998f,
+   -0.708262835f, -0.705948834f,
+   -0.707106781f, -0.707106781f,
+   -0.705948834f, -0.708262835f,
+   -0.704788998f, -0.709416992f,
+   -0.703627274f, -0.710569250f,
+   -0.702463666f, -0.711719606f,
+   -0.701298178f, -0.712868056f,
+   -0.700130812f, -0.714014598f,
+   -0.698961572f, -0.715159228f,
+   -0.697790460f, -0.716301943f,
+   -0.696617480f, -0.717442741f,
+   -0.695442635f, -0.718581618f,
+   -0.694265928f, -0.719718571f,
+   -0.693087363f, -0.720853597f,
+   -0.691906941f, -0.721986693f,
+   -0.690724668f, -0.723117856f,
+   -0.689540545f, -0.724247083f,
+   -0.688354576f, -0.725374371f,
+   -0.687166764f, -0.726499717f,
+   -0.685977112f, -0.727623118f,
+   -0.684785624f, -0.728744571f,
+   -0.683592302f, -0.729864073f,
+   -0.682397150f, -0.730981620f,
+   -0.681200171f, -0.732097211f,
+   -0.680001369f, -0.733210842f,
+   -0.678800746f, -0.734322509f,
+   -0.677598305f, -0.735432211f,
+   -0.676394050f, -0.736539944f,
+   -0.675187985f, -0.737645704f,
+   -0.673980111f, -0.738749490f,
+   -0.672770434f, -0.739851298f,
+   -0.671558955f, -0.740951125f,
+   -0.670345678f, -0.742048969f,
+   -0.669130606f, -0.743144825f,
+   -0.667913743f, -0.744238693f,
+   -0.666695092f, -0.745330567f,
+   -0.665474656f, -0.746420446f,
+   -0.664252438f, -0.747508327f,
+   -0.663028442f, -0.748594206f,
+   -0.661802670f, -0.749678081f,
+   -0.660575127f, -0.750759949f,
+   -0.659345815f, -0.751839807f,
+   -0.658114738f, -0.752917653f,
+   -0.656881899f, -0.753993482f,
+   -0.655647301f, -0.755067293f,
+   -0.654410948f, -0.756139082f,
+   -0.653172843f, -0.757208847f,
+   -0.651932989f, -0.758276584f,
+   -0.650691390f, -0.759342291f,
+   -0.649448048f, -0.760405966f,
+   -0.648202968f, -0.761467604f,
+   -0.646956153f, -0.762527204f,
+   -0.645707605f, -0.763584762f,
+   -0.644457328f, -0.764640276f,
+   -0.643205326f, -0.765693743f,
+   -0.641951603f, -0.766745160f,
+   -0.640696160f, -0.767794524f,
+   -0.639439002f, -0.768841832f,
+   -0.638180132f, -0.769887082f,
+   -0.636919554f, -0.770930271f,
+   -0.635657270f, -0.771971395f,
+   -0.634393284f, -0.773010453f,
+   -0.633127600f, -0.774047442f,
+   -0.631860221f, -0.775082358f,
+   -0.630591150f, -0.776115199f,
+   -0.629320391f, -0.777145961f,
+   -0.628047947f, -0.778174644f,
+   -0.626773822f, -0.779201243f,
+   -0.625498018f, -0.780225755f,
+   -0.624220540f, -0.781248179f,
+   -0.622941391f, -0.782268511f,
+   -0.621660573f, -0.783286749f,
+   -0.620378092f, -0.784302890f,
+   -0.619093949f, -0.785316931f,
+   -0.617808149f, -0.786328869f,
+   -0.616520695f, -0.787338702f,
+   -0.615231591f, -0.788346428f,
+   -0.613940839f, -0.789352042f,
+   -0.612648443f, -0.790355543f,
+   -0.611354407f, -0.791356929f,
+   -0.610058735f, -0.792356195f,
+   -0.608761429f, -0.793353340f,
+   -0.607462493f, -0.794348361f,
+   -0.606161931f, -0.795341256f,
+   -0.604859746f, -0.796332021f,
+   -0.603555942f, -0.797320654f,
+   -0.602250522f, -0.798307152f,
+   -0.600943489f, -0.799291513f,
+   -0.599634848f, -0.800273734f,
+   -0.598324601f, -0.801253813f,
+   -0.597012752f, -0.802231746f,
+   -0.595699304f, -0.803207531f,
+   -0.594384262f, -0.804181167f,
+   -0.593067629f, -0.805152649f,
+   -0.591749408f, -0.806121975f,
+   -0.590429602f, -0.807089143f,
+   -0.589108216f, -0.808054150f,
+   -0.587785252f, -0.809016994f,
+   -0.586460715f, -0.809977672f,
+   -0.585134608f, -0.810936182f,
+   -0.583806934f, -0.811892520f,
+   -0.582477697f, -0.812846685f,
+   -0.581146900f, -0.813798673f,
+   -0.579814548f, -0.814748483f,
+   -0.578480643f, -0.815696111f,
+   -0.577145190f, -0.816641555f,
+   -0.575808191f, -0.817584813f,
+   -0.574469651f, -0.818525882f,
+   -0.573129573f, -0.819464760f,
+   -0.571787960f, -0.820401444f,
+   -0.570444817f, -0.821335931f,
+   -0.569100146f, -0.822268219f,
+   -0.567753951f, -0.823198306f,
+   -0.566406237f, -0.824126189f,
+   -0.565057006f, -0.825051865f,
+   -0.563706262f, -0.825975333f,
+   -0.562354009f, -0.826896589f,
+   -0.561000251f, -0.827815631f,
+   -0.559644990f, -0.828732457f,
+   -0.558288231f, -0.829647064f,
+   -0.556929978f, -0.830559450f,
+   -0.555570233f, -0.831469612f,
+   -0.554209001f, -0.832377549f,
+   -0.552846285f, -0.833283256f,
+   -0.551482089f, -0.834186733f,
+   -0.550116417f, -0.835087976f,
+   -0.548749271f, -0.835986984f,
+   -0.547380657f, -0.836883753f,
+   -0.546010577f, -0.837778282f,
+   -0.544639035f, -0.838670568f,
+   -0.543266035f, -0.839560608f,
+   -0.541891581f, -0.840448401f,
+   -0.540515675f, -0.841333944f,
+   -0.539138323f, -0.842217234f,
+   -0.537759527f, -0.843098269f,
+   -0.536379292f, -0.843977047f,
+   -0.534997620f, -0.844853565f,
+   -0.533614516f, -0.845727822f,
+   -0.532229983f, -0.846599814f,
+   -0.530844026f, -0.847469539f,
+   -0.529456647f, -0.848336996f,
+   -0.528067851f, -0.849202182f,
+   -0.526677641f, -0.850065093f,
+   -0.525286020f, -0.850925729f,
+   -0.523892994f, -0.851784087f,
+   -0.522498565f, -0.852640164f,
+   -0.521102737f, -0.853493959f,
+   -0.519705514f, -0.854345468f,
+   -0.518306899f, -0.855194690f,
+   -0.516906897f, -0.856041623f,
+   -0.515505511f, -0.856886264f,
+   -0.514102744f, -0.857728610f,
+   -0.512698601f, -0.858568660f,
+   -0.511293086f, -0.859406412f,
+   -0.509886202f, -0.860241862f,
+   -0.508477952f, -0.861075009f,
+   -0.507068342f, -0.861905852f,
+   -0.505657373f, -0.862734386f,
+   -0.504245051f, -0.863560611f,
+   -0.502831379f, -0.864384523f,
+   -0.501416361f, -0.865206122f,
+   -0.500000000f, -0.866025404f,
+   -0.498582301f, -0.866842367f,
+   -0.497163266f, -0.867657010f,
+   -0.495742901f, -0.868469329f,
+   -0.494321208f, -0.869279324f,
+   -0.492898192f, -0.870086991f,
+   -0.491473857f, -0.870892329f,
+   -0.490048205f, -0.871695335f,
+   -0.488621241f, -0.872496007f,
+   -0.487192970f, -0.873294343f,
+   -0.485763394f, -0.874090342f,
+   -0.484332517f, -0.874884000f,
+   -0.482900344f, -0.875675315f,
+   -0.481466878f, -0.876464287f,
+   -0.480032122f, -0.877250911f,
+   -0.478596082f, -0.878035187f,
+   -0.477158760f, -0.878817113f,
+   -0.475720161f, -0.879596685f,
+   -0.474280288f, -0.880373903f,
+   -0.472839145f, -0.881148763f,
+   -0.471396737f, -0.881921264f,
+   -0.469953066f, -0.882691405f,
+   -0.468508137f, -0.883459181f,
+   -0.467061954f, -0.884224593f,
+   -0.465614520f, -0.884987637f,
+   -0.464165840f, -0.885748312f,
+   -0.462715917f, -0.886506616f,
+   -0.461264755f, -0.887262546f,
+   -0.459812358f, -0.888016101f,
+   -0.458358731f, -0.888767278f,
+   -0.456903876f, -0.889516075f,
+   -0.455447797f, -0.890262492f,
+   -0.453990500f, -0.891006524f,
+   -0.452531987f, -0.891748171f,
+   -0.451072262f, -0.892487431f,
+   -0.449611330f, -0.893224301f,
+   -0.448149194f, -0.893958780f,
+   -0.446685858f, -0.894690865f,
+   -0.445221326f, -0.895420555f,
+   -0.443755602f, -0.896147848f,
+   -0.442288690f, -0.896872742f,
+   -0.440820594f, -0.897595234f,
+   -0.439351318f, -0.898315323f,
+   -0.437880866f, -0.899033007f,
+   -0.436409241f, -0.899748284f,
+   -0.434936447f, -0.900461152f,
+   -0.433462490f, -0.901171610f,
+   -0.431987372f, -0.901879654f,
+   -0.430511097f, -0.902585284f,
+   -0.429033669f, -0.903288498f,
+   -0.427555093f, -0.903989293f,
+   -0.426075373f, -0.904687668f,
+   -0.424594511f, -0.905383621f,
+   -0.423112513f, -0.906077150f,
+   -0.421629382f, -0.906768253f,
+   -0.420145122f, -0.907456928f,
+   -0.418659738f, -0.908143174f,
+   -0.417173232f, -0.908826988f,
+   -0.415685610f, -0.909508369f,
+   -0.414196874f, -0.910187316f,
+   -0.412707030f, -0.910863825f,
+   -0.411216081f, -0.911537896f,
+   -0.409724030f, -0.912209526f,
+   -0.408230883f, -0.912878714f,
+   -0.406736643f, -0.913545458f,
+   -0.405241314f, -0.914209756f,
+   -0.403744900f, -0.914871606f,
+   -0.402247405f, -0.915531007f,
+   -0.400748833f, -0.916187957f,
+   -0.399249188f, -0.916842454f,
+   -0.397748475f, -0.917494496f,
+   -0.396246696f, -0.918144082f,
+   -0.394743856f, -0.918791210f,
+   -0.393239960f, -0.919435878f,
+   -0.391735011f, -0.920078084f,
+   -0.390229013f, -0.920717827f,
+   -0.388721970f, -0.921355105f,
+   -0.387213887f, -0.921989916f,
+   -0.385704767f, -0.922622259f,
+   -0.384194614f, -0.923252132f,
+   -0.382683432f, -0.923879533f,
+   -0.381171226f, -0.924504460f,
+   -0.379658000f, -0.925126912f,
+   -0.378143757f, -0.925746887f,
+   -0.376628502f, -0.926364384f,
+   -0.375112238f, -0.926979400f,
+   -0.373594970f, -0.927591935f,
+   -0.372076702f, -0.928201987f,
+   -0.370557438f, -0.928809553f,
+   -0.369037181f, -0.929414632f,
+   -0.367515937f, -0.930017224f,
+   -0.365993708f, -0.930617325f,
+   -0.364470500f, -0.931214935f,
+   -0.362946316f, -0.931810051f,
+   -0.361421160f, -0.932402673f,
+   -0.359895037f, -0.932992799f,
+   -0.358367950f, -0.933580426f,
+   -0.356839903f, -0.934165555f,
+   -0.355310901f, -0.934748182f,
+   -0.353780948f, -0.935328306f,
+   -0.352250048f, -0.935905927f,
+   -0.350718205f, -0.936481041f,
+   -0.349185422f, -0.937053649f,
+   -0.347651705f, -0.937623748f,
+   -0.346117057f, -0.938191336f,
+   -0.344581482f, -0.938756412f,
+   -0.343044985f, -0.939318976f,
+   -0.341507570f, -0.939879024f,
+   -0.339969240f, -0.940436556f,
+   -0.338430000f, -0.940991570f,
+   -0.336889853f, -0.941544065f,
+   -0.335348805f, -0.942094039f,
+   -0.333806859f, -0.942641491f,
+   -0.332264020f, -0.943186419f,
+   -0.330720290f, -0.943728822f,
+   -0.329175676f, -0.944268698f,
+   -0.327630180f, -0.944806046f,
+   -0.326083806f, -0.945340865f,
+   -0.324536560f, -0.945873153f,
+   -0.322988445f, -0.946402908f,
+   -0.321439465f, -0.946930129f,
+   -0.319889625f, -0.947454816f,
+   -0.318338928f, -0.947976965f,
+   -0.316787379f, -0.948496577f,
+   -0.315234982f, -0.949013649f,
+   -0.313681740f, -0.949528181f,
+   -0.312127659f, -0.950040170f,
+   -0.310572743f, -0.950549616f,
+   -0.309016994f, -0.951056516f,
+   -0.307460419f, -0.951560871f,
+   -0.305903020f, -0.952062678f,
+   -0.304344802f, -0.952561936f,
+   -0.302785770f, -0.953058643f,
+   -0.301225927f, -0.953552799f,
+   -0.299665277f, -0.954044402f,
+   -0.298103825f, -0.954533451f,
+   -0.296541575f, -0.955019944f,
+   -0.294978531f, -0.955503881f,
+   -0.293414697f, -0.955985259f,
+   -0.291850078f, -0.956464078f,
+   -0.290284677f, -0.956940336f,
+   -0.288718499f, -0.957414032f,
+   -0.287151549f, -0.957885164f,
+   -0.285583829f, -0.958353733f,
+   -0.284015345f, -0.958819735f,
+   -0.282446100f, -0.959283170f,
+   -0.280876099f, -0.959744037f,
+   -0.279305346f, -0.960202335f,
+   -0.277733846f, -0.960658061f,
+   -0.276161602f, -0.961111216f,
+   -0.274588618f, -0.961561798f,
+   -0.273014899f, -0.962009805f,
+   -0.271440450f, -0.962455236f,
+   -0.269865274f, -0.962898091f,
+   -0.268289375f, -0.963338368f,
+   -0.266712757f, -0.963776066f,
+   -0.265135426f, -0.964211183f,
+   -0.263557385f, -0.964643719f,
+   -0.261978638f, -0.965073672f,
+   -0.260399190f, -0.965501042f,
+   -0.258819045f, -0.965925826f,
+   -0.257238207f, -0.966348025f,
+   -0.255656680f, -0.966767636f,
+   -0.254074469f, -0.967184659f,
+   -0.252491577f, -0.967599092f,
+   -0.250908009f, -0.968010935f,
+   -0.249323770f, -0.968420187f,
+   -0.247738863f, -0.968826845f,
+   -0.246153293f, -0.969230910f,
+   -0.244567064f, -0.969632379f,
+   -0.242980180f, -0.970031253f,
+   -0.241392645f, -0.970427530f,
+   -0.239804465f, -0.970821208f,
+   -0.238215642f, -0.971212288f,
+   -0.236626181f, -0.971600767f,
+   -0.235036087f, -0.971986645f,
+   -0.233445364f, -0.972369920f,
+   -0.231854016f, -0.972750593f,
+   -0.230262046f, -0.973128661f,
+   -0.228669461f, -0.973504123f,
+   -0.227076263f, -0.973876979f,
+   -0.225482457f, -0.974247228f,
+   -0.223888048f, -0.974614869f,
+   -0.222293039f, -0.974979900f,
+   -0.220697435f, -0.975342321f,
+   -0.219101240f, -0.975702130f,
+   -0.217504459f, -0.976059327f,
+   -0.215907095f, -0.976413911f,
+   -0.214309153f, -0.976765881f,
+   -0.212710637f, -0.977115236f,
+   -0.211111552f, -0.977461975f,
+   -0.209511902f, -0.977806097f,
+   -0.207911691f, -0.978147601f,
+   -0.206310923f, -0.978486486f,
+   -0.204709603f, -0.978822751f,
+   -0.203107734f, -0.979156396f,
+   -0.201505322f, -0.979487420f,
+   -0.199902371f, -0.979815821f,
+   -0.198298884f, -0.980141598f,
+   -0.196694866f, -0.980464752f,
+   -0.195090322f, -0.980785280f,
+   -0.193485255f, -0.981103183f,
+   -0.191879671f, -0.981418459f,
+   -0.190273572f, -0.981731108f,
+   -0.188666965f, -0.982041128f,
+   -0.187059852f, -0.982348519f,
+   -0.185452238f, -0.982653279f,
+   -0.183844128f, -0.982955409f,
+   -0.182235525f, -0.983254908f,
+   -0.180626435f, -0.983551773f,
+   -0.179016861f, -0.983846006f,
+   -0.177406808f, -0.984137604f,
+   -0.175796280f, -0.984426568f,
+   -0.174185281f, -0.984712896f,
+   -0.172573816f, -0.984996588f,
+   -0.170961889f, -0.985277642f,
+   -0.169349504f, -0.985556059f,
+   -0.167736666f, -0.985831837f,
+   -0.166123378f, -0.986104976f,
+   -0.164509646f, -0.986375474f,
+   -0.162895473f, -0.986643332f,
+   -0.161280865f, -0.986908548f,
+   -0.159665824f, -0.987171122f,
+   -0.158050356f, -0.987431053f,
+   -0.156434465f, -0.987688341f,
+   -0.154818155f, -0.987942984f,
+   -0.153201431f, -0.988194982f,
+   -0.151584296f, -0.988444334f,
+   -0.149966756f, -0.988691040f,
+   -0.148348814f, -0.988935099f,
+   -0.146730474f, -0.989176510f,
+   -0.145111742f, -0.989415273f,
+   -0.143492622f, -0.989651387f,
+   -0.141873117f, -0.989884851f,
+   -0.140253233f, -0.990115665f,
+   -0.138632973f, -0.990343829f,
+   -0.137012342f, -0.990569340f,
+   -0.135391344f, -0.990792200f,
+   -0.133769983f, -0.991012407f,
+   -0.132148265f, -0.991229961f,
+   -0.130526192f, -0.991444861f,
+   -0.128903770f, -0.991657107f,
+   -0.127281003f, -0.991866698f,
+   -0.125657896f, -0.992073633f,
+   -0.124034451f, -0.992277912f,
+   -0.122410675f, -0.992479535f,
+   -0.120786571f, -0.992678500f,
+   -0.119162144f, -0.992874808f,
+   -0.117537397f, -0.993068457f,
+   -0.115912336f, -0.993259448f,
+   -0.114286965f, -0.993447779f,
+   -0.112661288f, -0.993633451f,
+   -0.111035309f, -0.993816462f,
+   -0.109409032f, -0.993996813f,
+   -0.107782463f, -0.994174502f,
+   -0.106155605f, -0.994349530f,
+   -0.104528463f, -0.994521895f,
+   -0.102901041f, -0.994691598f,
+   -0.101273344f, -0.994858638f,
+   -0.099645376f, -0.995023014f,
+   -0.098017140f, -0.995184727f,
+   -0.096388643f, -0.995343775f,
+   -0.094759887f, -0.995500158f,
+   -0.093130877f, -0.995653875f,
+   -0.091501619f, -0.995804928f,
+   -0.089872115f, -0.995953314f,
+   -0.088242371f, -0.996099033f,
+   -0.086612390f, -0.996242086f,
+   -0.084982177f, -0.996382472f,
+   -0.083351737f, -0.996520189f,
+   -0.081721074f, -0.996655239f,
+   -0.080090192f, -0.996787621f,
+   -0.078459096f, -0.996917334f,
+   -0.076827789f, -0.997044378f,
+   -0.075196277f, -0.997168752f,
+   -0.073564564f, -0.997290457f,
+   -0.071932653f, -0.997409491f,
+   -0.070300550f, -0.997525856f,
+   -0.068668259f, -0.997639549f,
+   -0.067035784f, -0.997750572f,
+   -0.065403129f, -0.997858923f,
+   -0.063770300f, -0.997964603f,
+   -0.062137299f, -0.998067611f,
+   -0.060504132f, -0.998167947f,
+   -0.058870804f, -0.998265610f,
+   -0.057237317f, -0.998360601f,
+   -0.055603678f, -0.998452919f,
+   -0.053969889f, -0.998542563f,
+   -0.052335956f, -0.998629535f,
+   -0.050701883f, -0.998713832f,
+   -0.049067674f, -0.998795456f,
+   -0.047433334f, -0.998874406f,
+   -0.045798867f, -0.998950681f,
+   -0.044164277f, -0.999024282f,
+   -0.042529569f, -0.999095209f,
+   -0.040894747f, -0.999163460f,
+   -0.039259816f, -0.999229036f,
+   -0.037624779f, -0.999291937f,
+   -0.035989642f, -0.999352163f,
+   -0.034354408f, -0.999409713f,
+   -0.032719083f, -0.999464587f,
+   -0.031083670f, -0.999516786f,
+   -0.029448173f, -0.999566309f,
+   -0.027812598f, -0.999613155f,
+   -0.026176948f, -0.999657325f,
+   -0.024541229f, -0.999698819f,
+   -0.022905443f, -0.999737636f,
+   -0.021269596f, -0.999773777f,
+   -0.019633692f, -0.999807240f,
+   -0.017997736f, -0.999838028f,
+   -0.016361732f, -0.999866138f,
+   -0.014725683f, -0.999891571f,
+   -0.013089596f, -0.999914328f,
+   -0.011453473f, -0.999934407f,
+   -0.009817319f, -0.999951809f,
+   -0.008181140f, -0.999966534f,
+   -0.006544938f, -0.999978582f,
+   -0.004908719f, -0.999987952f,
+   -0.003272487f, -0.999994645f,
+   -0.001636245f, -0.999998661f,
+   -0.000000000f, -1.000000000f,
+    0.001636245f, -0.999998661f,
+    0.003272487f, -0.999994645f,
+    0.004908719f, -0.999987952f,
+    0.006544938f, -0.999978582f,
+    0.008181140f, -0.999966534f,
+    0.009817319f, -0.999951809f,
+    0.011453473f, -0.999934407f,
+    0.013089596f, -0.999914328f,
+    0.014725683f, -0.999891571f,
+    0.016361732f, -0.999866138f,
+    0.017997736f, -0.999838028f,
+    0.019633692f, -0.999807240f,
+    0.021269596f, -0.999773777f,
+    0.022905443f, -0.999737636f,
+    0.024541229f, -0.999698819f,
+    0.026176948f, -0.999657325f,
+    0.027812598f, -0.999613155f,
+    0.029448173f, -0.999566309f,
+    0.031083670f, -0.999516786f,
+    0.032719083f, -0.999464587f,
+    0.034354408f, -0.999409713f,
+    0.035989642f, -0.999352163f,
+    0.037624779f, -0.999291937f,
+    0.039259816f, -0.999229036f,
+    0.040894747f, -0.999163460f,
+    0.042529569f, -0.999095209f,
+    0.044164277f, -0.999024282f,
+    0.045798867f, -0.998950681f,
+    0.047433334f, -0.998874406f,
+    0.049067674f, -0.998795456f,
+    0.050701883f, -0.998713832f,
+    0.052335956f, -0.998629535f,
+    0.053969889f, -0.998542563f,
+    0.055603678f, -0.998452919f,
+    0.057237317f, -0.998360601f,
+    0.058870804f, -0.998265610f,
+    0.060504132f, -0.998167947f,
+    0.062137299f, -0.998067611f,
+    0.063770300f, -0.997964603f,
+    0.065403129f, -0.997858923f,
+    0.067035784f, -0.997750572f,
+    0.068668259f, -0.997639549f,
+    0.070300550f, -0.997525856f,
+    0.071932653f, -0.997409491f,
+    0.073564564f, -0.997290457f,
+    0.075196277f, -0.997168752f,
+    0.076827789f, -0.997044378f,
+    0.078459096f, -0.996917334f,
+    0.080090192f, -0.996787621f,
+    0.081721074f, -0.996655239f,
+    0.083351737f, -0.996520189f,
+    0.084982177f, -0.996382472f,
+    0.086612390f, -0.996242086f,
+    0.088242371f, -0.996099033f,
+    0.089872115f, -0.995953314f,
+    0.091501619f, -0.995804928f,
+    0.093130877f, -0.995653875f,
+    0.094759887f, -0.995500158f,
+    0.096388643f, -0.995343775f,
+    0.098017140f, -0.995184727f,
+    0.099645376f, -0.995023014f,
+    0.101273344f, -0.994858638f,
+    0.102901041f, -0.994691598f,
+    0.104528463f, -0.994521895f,
+    0.106155605f, -0.994349530f,
+    0.107782463f, -0.994174502f,
+    0.109409032f, -0.993996813f,
+    0.111035309f, -0.993816462f,
+    0.112661288f, -0.993633451f,
+    0.114286965f, -0.993447779f,
+    0.115912336f, -0.993259448f,
+    0.117537397f, -0.993068457f,
+    0.119162144f, -0.992874808f,
+    0.120786571f, -0.992678500f,
+    0.122410675f, -0.992479535f,
+    0.124034451f, -0.992277912f,
+    0.125657896f, -0.992073633f,
+    0.127281003f, -0.991866698f,
+    0.128903770f, -0.991657107f,
+    0.130526192f, -0.991444861f,
+    0.132148265f, -0.991229961f,
+    0.133769983f, -0.991012407f,
+    0.135391344f, -0.990792200f,
+    0.137012342f, -0.990569340f,
+    0.138632973f, -0.990343829f,
+    0.140253233f, -0.990115665f,
+    0.141873117f, -0.989884851f,
+    0.143492622f, -0.989651387f,
+    0.145111742f, -0.989415273f,
+    0.146730474f, -0.989176510f,
+    0.148348814f, -0.988935099f,
+    0.149966756f, -0.988691040f,
+    0.151584296f, -0.988444334f,
+    0.153201431f, -0.988194982f,
+    0.154818155f, -0.987942984f,
+    0.156434465f, -0.987688341f,
+    0.158050356f, -0.987431053f,
+    0.159665824f, -0.987171122f,
+    0.161280865f, -0.986908548f,
+    0.162895473f, -0.986643332f,
+    0.164509646f, -0.986375474f,
+    0.166123378f, -0.986104976f,
+    0.167736666f, -0.985831837f,
+    0.169349504f, -0.985556059f,
+    0.170961889f, -0.985277642f,
+    0.172573816f, -0.984996588f,
+    0.174185281f, -0.984712896f,
+    0.175796280f, -0.984426568f,
+    0.177406808f, -0.984137604f,
+    0.179016861f, -0.983846006f,
+    0.180626435f, -0.983551773f,
+    0.182235525f, -0.983254908f,
+    0.183844128f, -0.982955409f,
+    0.185452238f, -0.982653279f,
+    0.187059852f, -0.982348519f,
+    0.188666965f, -0.982041128f,
+    0.190273572f, -0.981731108f,
+    0.191879671f, -0.981418459f,
+    0.193485255f, -0.981103183f,
+    0.195090322f, -0.980785280f,
+    0.196694866f, -0.980464752f,
+    0.198298884f, -0.980141598f,
+    0.199902371f, -0.979815821f,
+    0.201505322f, -0.979487420f,
+    0.203107734f, -0.979156396f,
+    0.204709603f, -0.978822751f,
+    0.206310923f, -0.978486486f,
+    0.207911691f, -0.978147601f,
+    0.209511902f, -0.977806097f,
+    0.211111552f, -0.977461975f,
+    0.212710637f, -0.977115236f,
+    0.214309153f, -0.976765881f,
+    0.215907095f, -0.976413911f,
+    0.217504459f, -0.976059327f,
+    0.219101240f, -0.975702130f,
+    0.220697435f, -0.975342321f,
+    0.222293039f, -0.974979900f,
+    0.223888048f, -0.974614869f,
+    0.225482457f, -0.974247228f,
+    0.227076263f, -0.973876979f,
+    0.228669461f, -0.973504123f,
+    0.230262046f, -0.973128661f,
+    0.231854016f, -0.972750593f,
+    0.233445364f, -0.972369920f,
+    0.235036087f, -0.971986645f,
+    0.236626181f, -0.971600767f,
+    0.238215642f, -0.971212288f,
+    0.239804465f, -0.970821208f,
+    0.241392645f, -0.970427530f,
+    0.242980180f, -0.970031253f,
+    0.244567064f, -0.969632379f,
+    0.246153293f, -0.969230910f,
+    0.247738863f, -0.968826845f,
+    0.249323770f, -0.968420187f,
+    0.250908009f, -0.968010935f,
+    0.252491577f, -0.967599092f,
+    0.254074469f, -0.967184659f,
+    0.255656680f, -0.966767636f,
+    0.257238207f, -0.966348025f,
+    0.258819045f, -0.965925826f,
+    0.260399190f, -0.965501042f,
+    0.261978638f, -0.965073672f,
+    0.263557385f, -0.964643719f,
+    0.265135426f, -0.964211183f,
+    0.266712757f, -0.963776066f,
+    0.268289375f, -0.963338368f,
+    0.269865274f, -0.962898091f,
+    0.271440450f, -0.962455236f,
+    0.273014899f, -0.962009805f,
+    0.274588618f, -0.961561798f,
+    0.276161602f, -0.961111216f,
+    0.277733846f, -0.960658061f,
+    0.279305346f, -0.960202335f,
+    0.280876099f, -0.959744037f,
+    0.282446100f, -0.959283170f,
+    0.284015345f, -0.958819735f,
+    0.285583829f, -0.958353733f,
+    0.287151549f, -0.957885164f,
+    0.288718499f, -0.957414032f,
+    0.290284677f, -0.956940336f,
+    0.291850078f, -0.956464078f,
+    0.293414697f, -0.955985259f,
+    0.294978531f, -0.955503881f,
+    0.296541575f, -0.955019944f,
+    0.298103825f, -0.954533451f,
+    0.299665277f, -0.954044402f,
+    0.301225927f, -0.953552799f,
+    0.302785770f, -0.953058643f,
+    0.304344802f, -0.952561936f,
+    0.305903020f, -0.952062678f,
+    0.307460419f, -0.951560871f,
+    0.309016994f, -0.951056516f,
+    0.310572743f, -0.950549616f,
+    0.312127659f, -0.950040170f,
+    0.313681740f, -0.949528181f,
+    0.315234982f, -0.949013649f,
+    0.316787379f, -0.948496577f,
+    0.318338928f, -0.947976965f,
+    0.319889625f, -0.947454816f,
+    0.321439465f, -0.946930129f,
+    0.322988445f, -0.946402908f,
+    0.324536560f, -0.945873153f,
+    0.326083806f, -0.945340865f,
+    0.327630180f, -0.944806046f,
+    0.329175676f, -0.944268698f,
+    0.330720290f, -0.943728822f,
+    0.332264020f, -0.943186419f,
+    0.333806859f, -0.942641491f,
+    0.335348805f, -0.942094039f,
+    0.336889853f, -0.941544065f,
+    0.338430000f, -0.940991570f,
+    0.339969240f, -0.940436556f,
+    0.341507570f, -0.939879024f,
+    0.343044985f, -0.939318976f,
+    0.344581482f, -0.938756412f,
+    0.346117057f, -0.938191336f,
+    0.347651705f, -0.937623748f,
+    0.349185422f, -0.937053649f,
+    0.350718205f, -0.936481041f,
+    0.352250048f, -0.935905927f,
+    0.353780948f, -0.935328306f,
+    0.355310901f, -0.934748182f,
+    0.356839903f, -0.934165555f,
+    0.358367950f, -0.933580426f,
+    0.359895037f, -0.932992799f,
+    0.361421160f, -0.932402673f,
+    0.362946316f, -0.931810051f,
+    0.364470500f, -0.931214935f,
+    0.365993708f, -0.930617325f,
+    0.367515937f, -0.930017224f,
+    0.369037181f, -0.929414632f,
+    0.370557438f, -0.928809553f,
+    0.372076702f, -0.928201987f,
+    0.373594970f, -0.927591935f,
+    0.375112238f, -0.926979400f,
+    0.376628502f, -0.926364384f,
+    0.378143757f, -0.925746887f,
+    0.379658000f, -0.925126912f,
+    0.381171226f, -0.924504460f,
+    0.382683432f, -0.923879533f,
+    0.384194614f, -0.923252132f,
+    0.385704767f, -0.922622259f,
+    0.387213887f, -0.921989916f,
+    0.388721970f, -0.921355105f,
+    0.390229013f, -0.920717827f,
+    0.391735011f, -0.920078084f,
+    0.393239960f, -0.919435878f,
+    0.394743856f, -0.918791210f,
+    0.396246696f, -0.918144082f,
+    0.397748475f, -0.917494496f,
+    0.399249188f, -0.916842454f,
+    0.400748833f, -0.916187957f,
+    0.402247405f, -0.915531007f,
+    0.403744900f, -0.914871606f,
+    0.405241314f, -0.914209756f,
+    0.406736643f, -0.913545458f,
+    0.408230883f, -0.912878714f,
+    0.409724030f, -0.912209526f,
+    0.411216081f, -0.911537896f,
+    0.412707030f, -0.910863825f,
+    0.414196874f, -0.910187316f,
+    0.415685610f, -0.909508369f,
+    0.417173232f, -0.908826988f,
+    0.418659738f, -0.908143174f,
+    0.420145122f, -0.907456928f,
+    0.421629382f, -0.906768253f,
+    0.423112513f, -0.906077150f,
+    0.424594511f, -0.905383621f,
+    0.426075373f, -0.904687668f,
+    0.427555093f, -0.903989293f,
+    0.429033669f, -0.903288498f,
+    0.430511097f, -0.902585284f,
+    0.431987372f, -0.901879654f,
+    0.433462490f, -0.901171610f,
+    0.434936447f, -0.900461152f,
+    0.436409241f, -0.899748284f,
+    0.437880866f, -0.899033007f,
+    0.439351318f, -0.898315323f,
+    0.440820594f, -0.897595234f,
+    0.442288690f, -0.896872742f,
+    0.443755602f, -0.896147848f,
+    0.445221326f, -0.895420555f,
+    0.446685858f, -0.894690865f,
+    0.448149194f, -0.893958780f,
+    0.449611330f, -0.893224301f,
+    0.451072262f, -0.892487431f,
+    0.452531987f, -0.891748171f,
+    0.453990500f, -0.891006524f,
+    0.455447797f, -0.890262492f,
+    0.456903876f, -0.889516075f,
+    0.458358731f, -0.888767278f,
+    0.459812358f, -0.888016101f,
+    0.461264755f, -0.887262546f,
+    0.462715917f, -0.886506616f,
+    0.464165840f, -0.885748312f,
+    0.465614520f, -0.884987637f,
+    0.467061954f, -0.884224593f,
+    0.468508137f, -0.883459181f,
+    0.469953066f, -0.882691405f,
+    0.471396737f, -0.881921264f,
+    0.472839145f, -0.881148763f,
+    0.474280288f, -0.880373903f,
+    0.475720161f, -0.879596685f,
+    0.477158760f, -0.878817113f,
+    0.478596082f, -0.878035187f,
+    0.480032122f, -0.877250911f,
+    0.481466878f, -0.876464287f,
+    0.482900344f, -0.875675315f,
+    0.484332517f, -0.874884000f,
+    0.485763394f, -0.874090342f,
+    0.487192970f, -0.873294343f,
+    0.488621241f, -0.872496007f,
+    0.490048205f, -0.871695335f,
+    0.491473857f, -0.870892329f,
+    0.492898192f, -0.870086991f,
+    0.494321208f, -0.869279324f,
+    0.495742901f, -0.868469329f,
+    0.497163266f, -0.867657010f,
+    0.498582301f, -0.866842367f,
+    0.500000000f, -0.866025404f,
+    0.501416361f, -0.865206122f,
+    0.502831379f, -0.864384523f,
+    0.504245051f, -0.863560611f,
+    0.505657373f, -0.862734386f,
+    0.507068342f, -0.861905852f,
+    0.508477952f, -0.861075009f,
+    0.509886202f, -0.860241862f,
+    0.511293086f, -0.859406412f,
+    0.512698601f, -0.858568660f,
+    0.514102744f, -0.857728610f,
+    0.515505511f, -0.856886264f,
+    0.516906897f, -0.856041623f,
+    0.518306899f, -0.855194690f,
+    0.519705514f, -0.854345468f,
+    0.521102737f, -0.853493959f,
+    0.522498565f, -0.852640164f,
+    0.523892994f, -0.851784087f,
+    0.525286020f, -0.850925729f,
+    0.526677641f, -0.850065093f,
+    0.528067851f, -0.849202182f,
+    0.529456647f, -0.848336996f,
+    0.530844026f, -0.847469539f,
+    0.532229983f, -0.846599814f,
+    0.533614516f, -0.845727822f,
+    0.534997620f, -0.844853565f,
+    0.536379292f, -0.843977047f,
+    0.537759527f, -0.843098269f,
+    0.539138323f, -0.842217234f,
+    0.540515675f, -0.841333944f,
+    0.541891581f, -0.840448401f,
+    0.543266035f, -0.839560608f,
+    0.544639035f, -0.838670568f,
+    0.546010577f, -0.837778282f,
+    0.547380657f, -0.836883753f,
+    0.548749271f, -0.835986984f,
+    0.550116417f, -0.835087976f,
+    0.551482089f, -0.834186733f,
+    0.552846285f, -0.833283256f,
+    0.554209001f, -0.832377549f,
+    0.555570233f, -0.831469612f,
+    0.556929978f, -0.830559450f,
+    0.558288231f, -0.829647064f,
+    0.559644990f, -0.828732457f,
+    0.561000251f, -0.827815631f,
+    0.562354009f, -0.826896589f,
+    0.563706262f, -0.825975333f,
+    0.565057006f, -0.825051865f,
+    0.566406237f, -0.824126189f,
+    0.567753951f, -0.823198306f,
+    0.569100146f, -0.822268219f,
+    0.570444817f, -0.821335931f,
+    0.571787960f, -0.820401444f,
+    0.573129573f, -0.819464760f,
+    0.574469651f, -0.818525882f,
+    0.575808191f, -0.817584813f,
+    0.577145190f, -0.816641555f,
+    0.578480643f, -0.815696111f,
+    0.579814548f, -0.814748483f,
+    0.581146900f, -0.813798673f,
+    0.582477697f, -0.812846685f,
+    0.583806934f, -0.811892520f,
+    0.585134608f, -0.810936182f,
+    0.586460715f, -0.809977672f,
+    0.587785252f, -0.809016994f,
+    0.589108216f, -0.808054150f,
+    0.590429602f, -0.807089143f,
+    0.591749408f, -0.806121975f,
+    0.593067629f, -0.805152649f,
+    0.594384262f, -0.804181167f,
+    0.595699304f, -0.803207531f,
+    0.597012752f, -0.802231746f,
+    0.598324601f, -0.801253813f,
+    0.599634848f, -0.800273734f,
+    0.600943489f, -0.799291513f,
+    0.602250522f, -0.798307152f,
+    0.603555942f, -0.797320654f,
+    0.604859746f, -0.796332021f,
+    0.606161931f, -0.795341256f,
+    0.607462493f, -0.794348361f,
+    0.608761429f, -0.793353340f,
+    0.610058735f, -0.792356195f,
+    0.611354407f, -0.791356929f,
+    0.612648443f, -0.790355543f,
+    0.613940839f, -0.789352042f,
+    0.615231591f, -0.788346428f,
+    0.616520695f, -0.787338702f,
+    0.617808149f, -0.786328869f,
+    0.619093949f, -0.785316931f,
+    0.620378092f, -0.784302890f,
+    0.621660573f, -0.783286749f,
+    0.622941391f, -0.782268511f,
+    0.624220540f, -0.781248179f,
+    0.625498018f, -0.780225755f,
+    0.626773822f, -0.779201243f,
+    0.628047947f, -0.778174644f,
+    0.629320391f, -0.777145961f,
+    0.630591150f, -0.776115199f,
+    0.631860221f, -0.775082358f,
+    0.633127600f, -0.774047442f,
+    0.634393284f, -0.773010453f,
+    0.635657270f, -0.771971395f,
+    0.636919554f, -0.770930271f,
+    0.638180132f, -0.769887082f,
+    0.639439002f, -0.768841832f,
+    0.640696160f, -0.767794524f,
+    0.641951603f, -0.766745160f,
+    0.643205326f, -0.765693743f,
+    0.644457328f, -0.764640276f,
+    0.645707605f, -0.763584762f,
+    0.646956153f, -0.762527204f,
+    0.648202968f, -0.761467604f,
+    0.649448048f, -0.760405966f,
+    0.650691390f, -0.759342291f,
+    0.651932989f, -0.758276584f,
+    0.653172843f, -0.757208847f,
+    0.654410948f, -0.756139082f,
+    0.655647301f, -0.755067293f,
+    0.656881899f, -0.753993482f,
+    0.658114738f, -0.752917653f,
+    0.659345815f, -0.751839807f,
+    0.660575127f, -0.750759949f,
+    0.661802670f, -0.749678081f,
+    0.663028442f, -0.748594206f,
+    0.664252438f, -0.747508327f,
+    0.665474656f, -0.746420446f,
+    0.666695092f, -0.745330567f,
+    0.667913743f, -0.744238693f,
+    0.669130606f, -0.743144825f,
+    0.670345678f, -0.742048969f,
+    0.671558955f, -0.740951125f,
+    0.672770434f, -0.739851298f,
+    0.673980111f, -0.738749490f,
+    0.675187985f, -0.737645704f,
+    0.676394050f, -0.736539944f,
+    0.677598305f, -0.735432211f,
+    0.678800746f, -0.734322509f,
+    0.680001369f, -0.733210842f,
+    0.681200171f, -0.732097211f,
+    0.682397150f, -0.730981620f,
+    0.683592302f, -0.729864073f,
+    0.684785624f, -0.728744571f,
+    0.685977112f, -0.727623118f,
+    0.687166764f, -0.726499717f,
+    0.688354576f, -0.725374371f,
+    0.689540545f, -0.724247083f,
+    0.690724668f, -0.723117856f,
+    0.691906941f, -0.721986693f,
+    0.693087363f, -0.720853597f,
+    0.694265928f, -0.719718571f,
+    0.695442635f, -0.718581618f,
+    0.696617480f, -0.717442741f,
+    0.697790460f, -0.716301943f,
+    0.698961572f, -0.715159228f,
+    0.700130812f, -0.714014598f,
+    0.701298178f, -0.712868056f,
+    0.702463666f, -0.711719606f,
+    0.703627274f, -0.710569250f,
+    0.704788998f, -0.709416992f,
+    0.705948834f, -0.708262835f,
+    0.707106781f, -0.707106781f,
+    0.708262835f, -0.705948834f,
+    0.709416992f, -0.704788998f,
+    0.710569250f, -0.703627274f,
+    0.711719606f, -0.702463666f,
+    0.712868056f, -0.701298178f,
+    0.714014598f, -0.700130812f,
+    0.715159228f, -0.698961572f,
+    0.716301943f, -0.697790460f,
+    0.717442741f, -0.696617480f,
+    0.718581618f, -0.695442635f,
+    0.719718571f, -0.694265928f,
+    0.720853597f, -0.693087363f,
+    0.721986693f, -0.691906941f,
+    0.723117856f, -0.690724668f,
+    0.724247083f, -0.689540545f,
+    0.725374371f, -0.688354576f,
+    0.726499717f, -0.687166764f,
+    0.727623118f, -0.685977112f,
+    0.728744571f, -0.684785624f,
+    0.729864073f, -0.683592302f,
+    0.730981620f, -0.682397150f,
+    0.732097211f, -0.681200171f,
+    0.733210842f, -0.680001369f,
+    0.734322509f, -0.678800746f,
+    0.735432211f, -0.677598305f,
+    0.736539944f, -0.676394050f,
+    0.737645704f, -0.675187985f,
+    0.738749490f, -0.673980111f,
+    0.739851298f, -0.672770434f,
+    0.740951125f, -0.671558955f,
+    0.742048969f, -0.670345678f,
+    0.743144825f, -0.669130606f,
+    0.744238693f, -0.667913743f,
+    0.745330567f, -0.666695092f,
+    0.746420446f, -0.665474656f,
+    0.747508327f, -0.664252438f,
+    0.748594206f, -0.663028442f,
+    0.749678081f, -0.661802670f,
+    0.750759949f, -0.660575127f,
+    0.751839807f, -0.659345815f,
+    0.752917653f, -0.658114738f,
+    0.753993482f, -0.656881899f,
+    0.755067293f, -0.655647301f,
+    0.756139082f, -0.654410948f,
+    0.757208847f, -0.653172843f,
+    0.758276584f, -0.651932989f,
+    0.759342291f, -0.650691390f,
+    0.760405966f, -0.649448048f,
+    0.761467604f, -0.648202968f,
+    0.762527204f, -0.646956153f,
+    0.763584762f, -0.645707605f,
+    0.764640276f, -0.644457328f,
+    0.765693743f, -0.643205326f,
+    0.766745160f, -0.641951603f,
+    0.767794524f, -0.640696160f,
+    0.768841832f, -0.639439002f,
+    0.769887082f, -0.638180132f,
+    0.770930271f, -0.636919554f,
+    0.771971395f, -0.635657270f,
+    0.773010453f, -0.634393284f,
+    0.774047442f, -0.633127600f,
+    0.775082358f, -0.631860221f,
+    0.776115199f, -0.630591150f,
+    0.777145961f, -0.629320391f,
+    0.778174644f, -0.628047947f,
+    0.779201243f, -0.626773822f,
+    0.780225755f, -0.625498018f,
+    0.781248179f, -0.624220540f,
+    0.782268511f, -0.622941391f,
+    0.783286749f, -0.621660573f,
+    0.784302890f, -0.620378092f,
+    0.785316931f, -0.619093949f,
+    0.786328869f, -0.617808149f,
+    0.787338702f, -0.616520695f,
+    0.788346428f, -0.615231591f,
+    0.789352042f, -0.613940839f,
+    0.790355543f, -0.612648443f,
+    0.791356929f, -0.611354407f,
+    0.792356195f, -0.610058735f,
+    0.793353340f, -0.608761429f,
+    0.794348361f, -0.607462493f,
+    0.795341256f, -0.606161931f,
+    0.796332021f, -0.604859746f,
+    0.797320654f, -0.603555942f,
+    0.798307152f, -0.602250522f,
+    0.799291513f, -0.600943489f,
+    0.800273734f, -0.599634848f,
+    0.801253813f, -0.598324601f,
+    0.802231746f, -0.597012752f,
+    0.803207531f, -0.595699304f,
+    0.804181167f, -0.594384262f,
+    0.805152649f, -0.593067629f,
+    0.806121975f, -0.591749408f,
+    0.807089143f, -0.590429602f,
+    0.808054150f, -0.589108216f,
+    0.809016994f, -0.587785252f,
+    0.809977672f, -0.586460715f,
+    0.810936182f, -0.585134608f,
+    0.811892520f, -0.583806934f,
+    0.812846685f, -0.582477697f,
+    0.813798673f, -0.581146900f,
+    0.814748483f, -0.579814548f,
+    0.815696111f, -0.578480643f,
+    0.816641555f, -0.577145190f,
+    0.817584813f, -0.575808191f,
+    0.818525882f, -0.574469651f,
+    0.819464760f, -0.573129573f,
+    0.820401444f, -0.571787960f,
+    0.821335931f, -0.570444817f,
+    0.822268219f, -0.569100146f,
+    0.823198306f, -0.567753951f,
+    0.824126189f, -0.566406237f,
+    0.825051865f, -0.565057006f,
+    0.825975333f, -0.563706262f,
+    0.826896589f, -0.562354009f,
+    0.827815631f, -0.561000251f,
+    0.828732457f, -0.559644990f,
+    0.829647064f, -0.558288231f,
+    0.830559450f, -0.556929978f,
+    0.831469612f, -0.555570233f,
+    0.832377549f, -0.554209001f,
+    0.833283256f, -0.552846285f,
+    0.834186733f, -0.551482089f,
+    0.835087976f, -0.550116417f,
+    0.835986984f, -0.548749271f,
+    0.836883753f, -0.547380657f,
+    0.837778282f, -0.546010577f,
+    0.838670568f, -0.544639035f,
+    0.839560608f, -0.543266035f,
+    0.840448401f, -0.541891581f,
+    0.841333944f, -0.540515675f,
+    0.842217234f, -0.539138323f,
+    0.843098269f, -0.537759527f,
+    0.843977047f, -0.536379292f,
+    0.844853565f, -0.534997620f,
+    0.845727822f, -0.533614516f,
+    0.846599814f, -0.532229983f,
+    0.847469539f, -0.530844026f,
+    0.848336996f, -0.529456647f,
+    0.849202182f, -0.528067851f,
+    0.850065093f, -0.526677641f,
+    0.850925729f, -0.525286020f,
+    0.851784087f, -0.523892994f,
+    0.852640164f, -0.522498565f,
+    0.853493959f, -0.521102737f,
+    0.854345468f, -0.519705514f,
+    0.855194690f, -0.518306899f,
+    0.856041623f, -0.516906897f,
+    0.856886264f, -0.515505511f,
+    0.857728610f, -0.514102744f,
+    0.858568660f, -0.512698601f,
+    0.859406412f, -0.511293086f,
+    0.860241862f, -0.509886202f,
+    0.861075009f, -0.508477952f,
+    0.861905852f, -0.507068342f,
+    0.862734386f, -0.505657373f,
+    0.863560611f, -0.504245051f,
+    0.864384523f, -0.502831379f,
+    0.865206122f, -0.501416361f,
+    0.866025404f, -0.500000000f,
+    0.866842367f, -0.498582301f,
+    0.867657010f, -0.497163266f,
+    0.868469329f, -0.495742901f,
+    0.869279324f, -0.494321208f,
+    0.870086991f, -0.492898192f,
+    0.870892329f, -0.491473857f,
+    0.871695335f, -0.490048205f,
+    0.872496007f, -0.488621241f,
+    0.873294343f, -0.487192970f,
+    0.874090342f, -0.485763394f,
+    0.874884000f, -0.484332517f,
+    0.875675315f, -0.482900344f,
+    0.876464287f, -0.481466878f,
+    0.877250911f, -0.480032122f,
+    0.878035187f, -0.478596082f,
+    0.878817113f, -0.477158760f,
+    0.879596685f, -0.475720161f,
+    0.880373903f, -0.474280288f,
+    0.881148763f, -0.472839145f,
+    0.881921264f, -0.471396737f,
+    0.882691405f, -0.469953066f,
+    0.883459181f, -0.468508137f,
+    0.884224593f, -0.467061954f,
+    0.884987637f, -0.465614520f,
+    0.885748312f, -0.464165840f,
+    0.886506616f, -0.462715917f,
+    0.887262546f, -0.461264755f,
+    0.888016101f, -0.459812358f,
+    0.888767278f, -0.458358731f,
+    0.889516075f, -0.456903876f,
+    0.890262492f, -0.455447797f,
+    0.891006524f, -0.453990500f,
+    0.891748171f, -0.452531987f,
+    0.892487431f, -0.451072262f,
+    0.893224301f, -0.449611330f,
+    0.893958780f, -0.448149194f,
+    0.894690865f, -0.446685858f,
+    0.895420555f, -0.445221326f,
+    0.896147848f, -0.443755602f,
+    0.896872742f, -0.442288690f,
+    0.897595234f, -0.440820594f,
+    0.898315323f, -0.439351318f,
+    0.899033007f, -0.437880866f,
+    0.899748284f, -0.436409241f,
+    0.900461152f, -0.434936447f,
+    0.901171610f, -0.433462490f,
+    0.901879654f, -0.431987372f,
+    0.902585284f, -0.430511097f,
+    0.903288498f, -0.429033669f,
+    0.903989293f, -0.427555093f,
+    0.904687668f, -0.426075373f,
+    0.905383621f, -0.424594511f,
+    0.906077150f, -0.423112513f,
+    0.906768253f, -0.421629382f,
+    0.907456928f, -0.420145122f,
+    0.908143174f, -0.418659738f,
+    0.908826988f, -0.417173232f,
+    0.909508369f, -0.415685610f,
+    0.910187316f, -0.414196874f,
+    0.910863825f, -0.412707030f,
+    0.911537896f, -0.411216081f,
+    0.912209526f, -0.409724030f,
+    0.912878714f, -0.408230883f,
+    0.913545458f, -0.406736643f,
+    0.914209756f, -0.405241314f,
+    0.914871606f, -0.403744900f,
+    0.915531007f, -0.402247405f,
+    0.916187957f, -0.400748833f,
+    0.916842454f, -0.399249188f,
+    0.917494496f, -0.397748475f,
+    0.918144082f, -0.396246696f,
+    0.918791210f, -0.394743856f,
+    0.919435878f, -0.393239960f,
+    0.920078084f, -0.391735011f,
+    0.920717827f, -0.390229013f,
+    0.921355105f, -0.388721970f,
+    0.921989916f, -0.387213887f,
+    0.922622259f, -0.385704767f,
+    0.923252132f, -0.384194614f,
+    0.923879533f, -0.382683432f,
+    0.924504460f, -0.381171226f,
+    0.925126912f, -0.379658000f,
+    0.925746887f, -0.378143757f,
+    0.926364384f, -0.376628502f,
+    0.926979400f, -0.375112238f,
+    0.927591935f, -0.373594970f,
+    0.928201987f, -0.372076702f,
+    0.928809553f, -0.370557438f,
+    0.929414632f, -0.369037181f,
+    0.930017224f, -0.367515937f,
+    0.930617325f, -0.365993708f,
+    0.931214935f, -0.364470500f,
+    0.931810051f, -0.362946316f,
+    0.932402673f, -0.361421160f,
+    0.932992799f, -0.359895037f,
+    0.933580426f, -0.358367950f,
+    0.934165555f, -0.356839903f,
+    0.934748182f, -0.355310901f,
+    0.935328306f, -0.353780948f,
+    0.935905927f, -0.352250048f,
+    0.936481041f, -0.350718205f,
+    0.937053649f, -0.349185422f,
+    0.937623748f, -0.347651705f,
+    0.938191336f, -0.346117057f,
+    0.938756412f, -0.344581482f,
+    0.939318976f, -0.343044985f,
+    0.939879024f, -0.341507570f,
+    0.940436556f, -0.339969240f,
+    0.940991570f, -0.338430000f,
+    0.941544065f, -0.336889853f,
+    0.942094039f, -0.335348805f,
+    0.942641491f, -0.333806859f,
+    0.943186419f, -0.332264020f,
+    0.943728822f, -0.330720290f,
+    0.944268698f, -0.329175676f,
+    0.944806046f, -0.327630180f,
+    0.945340865f, -0.326083806f,
+    0.945873153f, -0.324536560f,
+    0.946402908f, -0.322988445f,
+    0.946930129f, -0.321439465f,
+    0.947454816f, -0.319889625f,
+    0.947976965f, -0.318338928f,
+    0.948496577f, -0.316787379f,
+    0.949013649f, -0.315234982f,
+    0.949528181f, -0.313681740f,
+    0.950040170f, -0.312127659f,
+    0.950549616f, -0.310572743f,
+    0.951056516f, -0.309016994f,
+    0.951560871f, -0.307460419f,
+    0.952062678f, -0.305903020f,
+    0.952561936f, -0.304344802f,
+    0.953058643f, -0.302785770f,
+    0.953552799f, -0.301225927f,
+    0.954044402f, -0.299665277f,
+    0.954533451f, -0.298103825f,
+    0.955019944f, -0.296541575f,
+    0.955503881f, -0.294978531f,
+    0.955985259f, -0.293414697f,
+    0.956464078f, -0.291850078f,
+    0.956940336f, -0.290284677f,
+    0.957414032f, -0.288718499f,
+    0.957885164f, -0.287151549f,
+    0.958353733f, -0.285583829f,
+    0.958819735f, -0.284015345f,
+    0.959283170f, -0.282446100f,
+    0.959744037f, -0.280876099f,
+    0.960202335f, -0.279305346f,
+    0.960658061f, -0.277733846f,
+    0.961111216f, -0.276161602f,
+    0.961561798f, -0.274588618f,
+    0.962009805f, -0.273014899f,
+    0.962455236f, -0.271440450f,
+    0.962898091f, -0.269865274f,
+    0.963338368f, -0.268289375f,
+    0.963776066f, -0.266712757f,
+    0.964211183f, -0.265135426f,
+    0.964643719f, -0.263557385f,
+    0.965073672f, -0.261978638f,
+    0.965501042f, -0.260399190f,
+    0.965925826f, -0.258819045f,
+    0.966348025f, -0.257238207f,
+    0.966767636f, -0.255656680f,
+    0.967184659f, -0.254074469f,
+    0.967599092f, -0.252491577f,
+    0.968010935f, -0.250908009f,
+    0.968420187f, -0.249323770f,
+    0.968826845f, -0.247738863f,
+    0.969230910f, -0.246153293f,
+    0.969632379f, -0.244567064f,
+    0.970031253f, -0.242980180f,
+    0.970427530f, -0.241392645f,
+    0.970821208f, -0.239804465f,
+    0.971212288f, -0.238215642f,
+    0.971600767f, -0.236626181f,
+    0.971986645f, -0.235036087f,
+    0.972369920f, -0.233445364f,
+    0.972750593f, -0.231854016f,
+    0.973128661f, -0.230262046f,
+    0.973504123f, -0.228669461f,
+    0.973876979f, -0.227076263f,
+    0.974247228f, -0.225482457f,
+    0.974614869f, -0.223888048f,
+    0.974979900f, -0.222293039f,
+    0.975342321f, -0.220697435f,
+    0.975702130f, -0.219101240f,
+    0.976059327f, -0.217504459f,
+    0.976413911f, -0.215907095f,
+    0.976765881f, -0.214309153f,
+    0.977115236f, -0.212710637f,
+    0.977461975f, -0.211111552f,
+    0.977806097f, -0.209511902f,
+    0.978147601f, -0.207911691f,
+    0.978486486f, -0.206310923f,
+    0.978822751f, -0.204709603f,
+    0.979156396f, -0.203107734f,
+    0.979487420f, -0.201505322f,
+    0.979815821f, -0.199902371f,
+    0.980141598f, -0.198298884f,
+    0.980464752f, -0.196694866f,
+    0.980785280f, -0.195090322f,
+    0.981103183f, -0.193485255f,
+    0.981418459f, -0.191879671f,
+    0.981731108f, -0.190273572f,
+    0.982041128f, -0.188666965f,
+    0.982348519f, -0.187059852f,
+    0.982653279f, -0.185452238f,
+    0.982955409f, -0.183844128f,
+    0.983254908f, -0.182235525f,
+    0.983551773f, -0.180626435f,
+    0.983846006f, -0.179016861f,
+    0.984137604f, -0.177406808f,
+    0.984426568f, -0.175796280f,
+    0.984712896f, -0.174185281f,
+    0.984996588f, -0.172573816f,
+    0.985277642f, -0.170961889f,
+    0.985556059f, -0.169349504f,
+    0.985831837f, -0.167736666f,
+    0.986104976f, -0.166123378f,
+    0.986375474f, -0.164509646f,
+    0.986643332f, -0.162895473f,
+    0.986908548f, -0.161280865f,
+    0.987171122f, -0.159665824f,
+    0.987431053f, -0.158050356f,
+    0.987688341f, -0.156434465f,
+    0.987942984f, -0.154818155f,
+    0.988194982f, -0.153201431f,
+    0.988444334f, -0.151584296f,
+    0.988691040f, -0.149966756f,
+    0.988935099f, -0.148348814f,
+    0.989176510f, -0.146730474f,
+    0.989415273f, -0.145111742f,
+    0.989651387f, -0.143492622f,
+    0.989884851f, -0.141873117f,
+    0.990115665f, -0.140253233f,
+    0.990343829f, -0.138632973f,
+    0.990569340f, -0.137012342f,
+    0.990792200f, -0.135391344f,
+    0.991012407f, -0.133769983f,
+    0.991229961f, -0.132148265f,
+    0.991444861f, -0.130526192f,
+    0.991657107f, -0.128903770f,
+    0.991866698f, -0.127281003f,
+    0.992073633f, -0.125657896f,
+    0.992277912f, -0.124034451f,
+    0.992479535f, -0.122410675f,
+    0.992678500f, -0.120786571f,
+    0.992874808f, -0.119162144f,
+    0.993068457f, -0.117537397f,
+    0.993259448f, -0.115912336f,
+    0.993447779f, -0.114286965f,
+    0.993633451f, -0.112661288f,
+    0.993816462f, -0.111035309f,
+    0.993996813f, -0.109409032f,
+    0.994174502f, -0.107782463f,
+    0.994349530f, -0.106155605f,
+    0.994521895f, -0.104528463f,
+    0.994691598f, -0.102901041f,
+    0.994858638f, -0.101273344f,
+    0.995023014f, -0.099645376f,
+    0.995184727f, -0.098017140f,
+    0.995343775f, -0.096388643f,
+    0.995500158f, -0.094759887f,
+    0.995653875f, -0.093130877f,
+    0.995804928f, -0.091501619f,
+    0.995953314f, -0.089872115f,
+    0.996099033f, -0.088242371f,
+    0.996242086f, -0.086612390f,
+    0.996382472f, -0.084982177f,
+    0.996520189f, -0.083351737f,
+    0.996655239f, -0.081721074f,
+    0.996787621f, -0.080090192f,
+    0.996917334f, -0.078459096f,
+    0.997044378f, -0.076827789f,
+    0.997168752f, -0.075196277f,
+    0.997290457f, -0.073564564f,
+    0.997409491f, -0.071932653f,
+    0.997525856f, -0.070300550f,
+    0.997639549f, -0.068668259f,
+    0.997750572f, -0.067035784f,
+    0.997858923f, -0.065403129f,
+    0.997964603f, -0.063770300f,
+    0.998067611f, -0.062137299f,
+    0.998167947f, -0.060504132f,
+    0.998265610f, -0.058870804f,
+    0.998360601f, -0.057237317f,
+    0.998452919f, -0.055603678f,
+    0.998542563f, -0.053969889f,
+    0.998629535f, -0.052335956f,
+    0.998713832f, -0.050701883f,
+    0.998795456f, -0.049067674f,
+    0.998874406f, -0.047433334f,
+    0.998950681f, -0.045798867f,
+    0.999024282f, -0.044164277f,
+    0.999095209f, -0.042529569f,
+    0.999163460f, -0.040894747f,
+    0.999229036f, -0.039259816f,
+    0.999291937f, -0.037624779f,
+    0.999352163f, -0.035989642f,
+    0.999409713f, -0.034354408f,
+    0.999464587f, -0.032719083f,
+    0.999516786f, -0.031083670f,
+    0.999566309f, -0.029448173f,
+    0.999613155f, -0.027812598f,
+    0.999657325f, -0.026176948f,
+    0.999698819f, -0.024541229f,
+    0.999737636f, -0.022905443f,
+    0.999773777f, -0.021269596f,
+    0.999807240f, -0.019633692f,
+    0.999838028f, -0.017997736f,
+    0.999866138f, -0.016361732f,
+    0.999891571f, -0.014725683f,
+    0.999914328f, -0.013089596f,
+    0.999934407f, -0.011453473f,
+    0.999951809f, -0.009817319f,
+    0.999966534f, -0.008181140f,
+    0.999978582f, -0.006544938f,
+    0.999987952f, -0.004908719f,
+    0.999994645f, -0.003272487f,
+    0.999998661f, -0.001636245f
+};
+
+
+/**    
+* \par    
+* Digit reversal tables of the mixed-radix CFFT.  The radix-4, radix-2, radix-3 and radix-5    
+* stages leave X(k1 + r1*k2 + r1*r2*k3 + ...) at index k1*(N/r1) + k2*(N/(r1*r2)) + ...    
+* Each table lists the cycles of this permutation: the length of the cycle, then its    
+* indexes i(0), i(1), ..., where i(j) receives the element at i(j+1) and the last index    
+* receives the element at i(0).    
+*/
+
+const uint16_t armDigitRevIndexTable48[ARMDIGITREVINDEXTABLE__48_TABLE_LENGTH] = 
+{
+   //4x4x3, size 50
+   11, 1, 12, 9, 18, 25, 19, 37, 17, 13, 21, 16, 22, 2, 24, 7,
+   39, 41, 20, 4, 3, 36, 5, 15, 45, 23, 40, 8, 6, 27, 43, 44,
+   11, 42, 32, 11, 10, 30, 34, 26, 31, 46, 35, 38, 29, 22, 28, 2,
+   14, 33
+};
+
+const uint16_t armDigitRevIndexTable60[ARMDIGITREVINDEXTABLE__60_TABLE_LENGTH] = 
+{
+   //4x3x5, size 62
+   44, 1, 15, 46, 43, 53, 24, 2, 30, 37, 18, 36, 3, 45, 28, 7,
+   50, 34, 42, 38, 33, 27, 47, 58, 44, 13, 16, 6, 35, 57, 29, 22,
+   41, 23, 56, 14, 31, 52, 9, 25, 17, 21, 26, 32, 12, 8, 4, 5,
+   20, 11, 55, 54, 39, 48, 3, 8, 10, 40, 3, 19, 51, 49
+};
+
+const uint16_t armDigitRevIndexTable80[ARMDIGITREVINDEXTABLE__80_TABLE_LENGTH] = 
+{
+   //4x4x5, size 82
+   48, 1, 20, 6, 45, 37, 27, 71, 69, 29, 36, 7, 65, 24, 11, 70,
+   49, 23, 66, 44, 17, 21, 26, 51, 63, 78, 59, 73, 34, 42, 52, 8,
+   10, 50, 43, 72, 14, 55, 68, 9, 30, 56, 13, 35, 62, 58, 53, 28,
+   16, 13, 2, 40, 12, 15, 75, 74, 54, 48, 3, 60, 18, 41, 32, 13,
+   4, 5, 25, 31, 76, 19, 61, 38, 47, 77, 39, 67, 64, 4, 22, 46,
+   57, 33
+};
+
+const uint16_t armDigitRevIndexTable96[ARMDIGITREVINDEXTABLE__96_TABLE_LENGTH] = 
+{
+   //4x4x2x3, size 102
+   14, 1, 24, 15, 90, 65, 26, 63, 94, 71, 80, 5, 30, 69, 32, 7,
+   2, 48, 4, 6, 54, 58, 64, 21, 3, 72, 14, 66, 50, 52, 10, 60,
+   22, 57, 40, 13, 42, 61, 46, 67, 74, 62, 70, 56, 16, 11, 7, 78,
+   68, 8, 12, 18, 51, 76, 20, 9, 36, 2, 11, 84, 11, 17, 27, 87,
+   83, 77, 44, 19, 75, 86, 59, 88, 21, 21, 33, 25, 39, 79, 92, 23,
+   81, 29, 45, 43, 85, 35, 73, 38, 55, 82, 53, 34, 49, 28, 7, 31,
+   93, 47, 91, 89, 41, 37
+};
+
+const uint16_t armDigitRevIndexTable120[ARMDIGITREVINDEXTABLE_120_TABLE_LENGTH] = 
+{
+   //4x2x3x5, size 122
+   30, 1, 30, 76, 18, 70, 87, 113, 44, 26, 61, 52, 17, 40, 11, 95,
+   118, 89, 43, 101, 49, 32, 6, 75, 93, 58, 67, 102, 79, 108, 24, 58,
+   2, 60, 22, 85, 53, 47, 116, 29, 46, 86, 83, 98, 64, 12, 20, 25,
+   31, 106, 69, 57, 37, 51, 92, 28, 16, 10, 65, 42, 71, 117, 59, 97,
+   34, 66, 72, 3, 90, 73, 33, 36, 21, 55, 107, 99, 94, 88, 13, 50,
+   62, 82, 68, 27, 91, 103, 109, 54, 77, 48, 10, 4, 15, 110, 84, 23,
+   115, 104, 9, 35, 96, 14, 5, 45, 56, 7, 105, 39, 111, 114, 74, 63,
+   112, 14, 80, 8, 2, 19, 100, 2, 38, 81
+};
+
+const uint16_t armDigitRevIndexTable160[ARMDIGITREVINDEXTABLE_160_TABLE_LENGTH] = 
+{
+   //4x4x2x5, size 164
+   38, 1, 40, 21, 55, 136, 24, 25, 65, 42, 101, 53, 56, 26, 105, 63,
+   156, 39, 131, 124, 38, 91, 147, 129, 44, 31, 155, 149, 59, 146, 89, 67,
+   122, 108, 33, 41, 61, 76, 32, 30, 2, 80, 7, 130, 84, 17, 45, 71,
+   132, 14, 110, 113, 48, 6, 90, 107, 143, 154, 109, 73, 62, 116, 18, 85,
+   57, 66, 82, 87, 137, 64, 38, 3, 120, 28, 35, 121, 68, 12, 30, 115,
+   128, 4, 10, 100, 13, 70, 92, 37, 51, 126, 118, 98, 83, 127, 158, 119,
+   138, 104, 23, 135, 134, 94, 117, 58, 106, 103, 133, 54, 96, 30, 5, 50,
+   86, 97, 43, 141, 74, 102, 93, 77, 72, 22, 95, 157, 79, 152, 29, 75,
+   142, 114, 88, 27, 145, 49, 46, 111, 153, 69, 52, 16, 11, 8, 20, 15,
+   150, 99, 123, 148, 19, 125, 78, 112, 11, 9, 60, 36, 11, 140, 34, 81,
+   47, 151, 139, 144
+};
+
+const uint16_t armDigitRevIndexTable192[ARMDIGITREVINDEXTABLE_192_TABLE_LENGTH] = 
+{
+   //4x4x4x3, size 192
+   92, 1, 48, 9, 72, 25, 75, 169, 80, 4, 12, 36, 18, 99, 151, 161,
+   56, 33, 54, 117, 70, 109, 91, 172, 44, 42, 126, 142, 134, 110, 139, 170,
+   128, 2, 96, 7, 156, 41, 78, 133, 62, 141, 86, 112, 10, 120, 34, 102,
+   115, 154, 125, 94, 136, 26, 123, 178, 107, 175, 188, 47, 186, 131, 146, 101,
+   67, 145, 53, 69, 61, 93, 88, 28, 39, 162, 104, 31, 183, 167, 164, 20,
+   15, 180, 23, 159, 185, 83, 148, 17, 51, 153, 77, 85, 64, 92, 3, 144,
+   5, 60, 45, 90, 124, 46, 138, 122, 130, 98, 103, 163, 152, 29, 87, 160,
+   8, 24, 27, 171, 176, 11, 168, 32, 6, 108, 43, 174, 140, 38, 114, 106,
+   127, 190, 143, 182, 119, 166, 116, 22, 111, 187, 179, 155, 173, 92, 40, 30,
+   135, 158, 137, 74, 121, 82, 100, 19, 147, 149, 65, 49, 57, 81, 52, 21,
+   63, 189, 95, 184, 35, 150, 113, 58, 129, 50, 105, 79, 181, 71, 157, 89,
+   76, 37, 66, 97, 55, 165, 68, 13, 84, 16, 2, 14, 132, 2, 59, 177
+};
+
+const uint16_t armDigitRevIndexTable240[ARMDIGITREVINDEXTABLE_240_TABLE_LENGTH] = 
+{
+   //4x4x3x5, size 242
+   44, 1, 60, 46, 175, 233, 104, 32, 10, 150, 138, 162, 128, 12, 45, 115,
+   187, 223, 234, 164, 23, 200, 34, 130, 132, 27, 215, 204, 49, 61, 106, 152,
+   33, 70, 141, 117, 82, 131, 192, 4, 15, 225, 74, 156, 48, 58, 2, 120,
+   37, 85, 86, 146, 123, 217, 99, 182, 148, 18, 125, 112, 7, 195, 184, 43,
+   220, 54, 136, 42, 160, 8, 30, 170, 158, 168, 38, 145, 63, 226, 134, 147,
+   183, 208, 9, 90, 161, 68, 21, 80, 11, 210, 129, 72, 36, 25, 95, 236,
+   59, 211, 189, 118, 142, 177, 73, 96, 58, 3, 180, 28, 50, 121, 97, 62,
+   166, 143, 237, 119, 202, 154, 153, 93, 116, 22, 140, 57, 91, 221, 114, 127,
+   232, 44, 55, 196, 19, 185, 103, 197, 79, 231, 209, 69, 81, 71, 201, 94,
+   176, 13, 105, 92, 56, 31, 230, 149, 78, 171, 218, 159, 228, 29, 110, 167,
+   203, 214, 144, 44, 5, 75, 216, 39, 205, 109, 107, 212, 24, 35, 190, 178,
+   133, 87, 206, 169, 98, 122, 157, 108, 47, 235, 224, 14, 165, 83, 191, 238,
+   179, 193, 64, 6, 135, 207, 229, 89, 101, 77, 111, 227, 194, 124, 52, 16,
+   12, 17, 65, 66, 126, 172, 53, 76, 51, 181, 88, 41, 100, 4, 26, 155,
+   213, 84, 12, 58, 151, 198, 139, 222, 174, 173, 113, 67, 186, 163, 188, 2,
+   102, 137
+};
+
+const uint16_t armDigitRevIndexTable320[ARMDIGITREVINDEXTABLE_320_TABLE_LENGTH] = 
+{
+   //4x4x4x5, size 326
+   133, 1, 80, 6, 180, 37, 110, 231, 273, 89, 126, 236, 73, 121, 136, 42,
+   210, 168, 52, 35, 250, 218, 208, 8, 40, 50, 175, 312, 59, 295, 274, 169,
+   132, 22, 185, 137, 122, 216, 48, 15, 300, 74, 201, 123, 296, 54, 195, 243,
+   258, 164, 32, 10, 200, 43, 290, 174, 232, 53, 115, 256, 4, 20, 25, 125,
+   156, 67, 241, 98, 171, 292, 34, 170, 212, 28, 65, 81, 86, 186, 217, 128,
+   2, 160, 12, 60, 75, 281, 129, 82, 166, 192, 3, 240, 18, 165, 112, 16,
+   5, 100, 31, 305, 99, 251, 298, 214, 188, 77, 141, 142, 222, 228, 33, 90,
+   206, 223, 308, 39, 270, 224, 13, 140, 62, 235, 293, 114, 176, 17, 85, 106,
+   211, 248, 58, 215, 268, 64, 133, 7, 260, 24, 45, 150, 187, 297, 134, 182,
+   197, 103, 271, 304, 19, 245, 118, 196, 23, 265, 124, 76, 61, 155, 287, 309,
+   119, 276, 29, 145, 87, 266, 204, 63, 315, 299, 294, 194, 163, 252, 78, 221,
+   148, 27, 285, 149, 107, 291, 254, 238, 233, 133, 102, 191, 317, 159, 307, 259,
+   244, 38, 190, 237, 153, 127, 316, 79, 301, 154, 207, 303, 314, 219, 288, 14,
+   220, 68, 21, 105, 131, 242, 178, 177, 97, 91, 286, 229, 113, 96, 11, 280,
+   49, 95, 306, 179, 257, 84, 26, 205, 143, 302, 234, 213, 108, 71, 261, 104,
+   51, 255, 318, 239, 313, 139, 282, 209, 88, 46, 230, 193, 83, 246, 198, 183,
+   277, 109, 151, 267, 284, 69, 101, 111, 311, 279, 269, 144, 32, 9, 120, 56,
+   55, 275, 249, 138, 202, 203, 283, 289, 94, 226, 173, 152, 47, 310, 199, 263,
+   264, 44, 70, 181, 117, 116, 36, 30, 225, 93, 146, 167, 272, 5, 41, 130,
+   162, 172, 72, 4, 57, 135, 262, 184, 3, 66, 161, 92, 5, 147, 247, 278,
+   189, 157, 3, 158, 227, 253
+};
+
+const uint16_t armDigitRevIndexTable384[ARMDIGITREVINDEXTABLE_384_TABLE_LENGTH] = 
+{
+   //4x4x4x2x3, size 390
+   140, 1, 96, 15, 360, 65, 99, 303, 374, 239, 376, 71, 315, 356, 41, 156,
+   79, 363, 353, 113, 117, 141, 169, 157, 175, 373, 143, 361, 161, 109, 183, 331,
+   341, 131, 289, 110, 279, 320, 5, 120, 69, 123, 357, 137, 145, 103, 327, 317,
+   188, 91, 345, 155, 343, 323, 293, 134, 217, 154, 247, 334, 269, 170, 253, 190,
+   283, 344, 59, 354, 209, 106, 255, 382, 287, 368, 23, 318, 284, 80, 9, 144,
+   7, 312, 68, 27, 342, 227, 304, 20, 30, 270, 266, 242, 214, 226, 208, 10,
+   240, 22, 222, 274, 200, 52, 42, 252, 94, 273, 104, 63, 378, 263, 314, 260,
+   26, 246, 238, 280, 56, 66, 195, 292, 38, 228, 40, 60, 90, 249, 166, 229,
+   136, 49, 114, 213, 130, 193, 100, 39, 324, 29, 174, 277, 128, 7, 2, 192,
+   4, 24, 54, 234, 256, 107, 3, 288, 14, 264, 50, 210, 202, 244, 46, 276,
+   32, 12, 72, 51, 306, 212, 34, 204, 76, 75, 339, 299, 350, 275, 296, 62,
+   282, 248, 70, 219, 346, 251, 358, 233, 160, 13, 168, 61, 186, 259, 290, 206,
+   268, 74, 243, 310, 236, 88, 57, 162, 205, 172, 85, 129, 97, 111, 375, 335,
+   365, 185, 163, 301, 182, 235, 352, 17, 102, 231, 328, 53, 138, 241, 118, 237,
+   184, 67, 291, 302, 278, 224, 16, 6, 216, 58, 258, 194, 196, 28, 78, 267,
+   338, 203, 340, 35, 300, 86, 225, 112, 21, 126, 285, 176, 19, 294, 230, 232,
+   64, 107, 8, 48, 18, 198, 220, 82, 201, 148, 31, 366, 281, 152, 55, 330,
+   245, 142, 265, 146, 199, 316, 92, 81, 105, 159, 367, 377, 167, 325, 125, 189,
+   187, 355, 305, 116, 45, 180, 43, 348, 83, 297, 158, 271, 362, 257, 98, 207,
+   364, 89, 153, 151, 319, 380, 95, 369, 119, 333, 173, 181, 139, 337, 107, 351,
+   371, 311, 332, 77, 171, 349, 179, 307, 308, 44, 84, 33, 108, 87, 321, 101,
+   135, 313, 164, 37, 132, 25, 150, 223, 370, 215, 322, 197, 124, 93, 177, 115,
+   309, 140, 73, 147, 295, 326, 221, 178, 211, 298, 254, 286, 272, 2, 11, 336,
+   2, 47, 372, 3, 121, 165, 133, 2, 122, 261, 7, 127, 381, 191, 379, 359,
+   329, 149, 3, 218, 250, 262
+};
+
+const uint16_t armDigitRevIndexTable480[ARMDIGITREVINDEXTABLE_480_TABLE_LENGTH] = 
+{
+   //4x4x2x3x5, size 482
+   460, 1, 120, 76, 100, 31, 465, 149, 171, 431, 459, 434, 264, 72, 70, 280,
+   87, 415, 469, 179, 386, 244, 52, 50, 260, 42, 305, 138, 306, 258, 252, 112,
+   16, 15, 450, 254, 352, 13, 210, 257, 132, 36, 35, 365, 223, 467, 389, 154,
+   321, 128, 6, 270, 342, 293, 153, 201, 182, 296, 63, 470, 299, 423, 399, 454,
+   284, 117, 166, 281, 207, 452, 44, 95, 475, 449, 134, 276, 57, 200, 62, 350,
+   353, 133, 156, 111, 451, 374, 298, 303, 453, 164, 41, 185, 206, 332, 98, 241,
+   142, 336, 23, 405, 169, 191, 476, 119, 406, 289, 123, 436, 54, 290, 243, 382,
+   358, 283, 447, 474, 329, 188, 116, 46, 335, 458, 314, 318, 348, 113, 136, 66,
+   250, 322, 248, 82, 265, 192, 2, 240, 22, 285, 237, 217, 197, 152, 81, 145,
+   141, 216, 77, 220, 107, 421, 159, 471, 419, 369, 148, 51, 380, 118, 286, 357,
+   163, 371, 388, 34, 245, 172, 101, 151, 411, 439, 414, 349, 233, 187, 446, 354,
+   253, 232, 67, 370, 268, 102, 271, 462, 344, 83, 385, 124, 106, 301, 213, 167,
+   401, 139, 426, 309, 168, 71, 400, 19, 375, 418, 249, 202, 302, 333, 218, 317,
+   228, 37, 155, 441, 204, 92, 115, 376, 88, 85, 175, 461, 224, 7, 390, 274,
+   267, 432, 24, 75, 430, 339, 383, 478, 359, 403, 379, 448, 14, 330, 308, 48,
+   20, 45, 215, 407, 409, 199, 392, 64, 10, 300, 93, 235, 427, 429, 219, 437,
+   174, 341, 173, 221, 227, 367, 463, 464, 29, 225, 127, 466, 269, 222, 347, 443,
+   444, 114, 256, 12, 90, 325, 158, 351, 473, 209, 137, 186, 326, 278, 297, 183,
+   416, 9, 180, 56, 80, 25, 195, 362, 313, 198, 272, 27, 435, 384, 4, 30,
+   345, 203, 422, 279, 417, 129, 126, 346, 323, 368, 28, 105, 181, 176, 26, 315,
+   438, 294, 273, 147, 381, 238, 337, 143, 456, 74, 310, 288, 3, 360, 73, 190,
+   356, 43, 425, 189, 236, 97, 121, 196, 32, 5, 150, 291, 363, 433, 144, 21,
+   165, 161, 131, 366, 343, 413, 229, 157, 231, 397, 214, 287, 477, 239, 457, 194,
+   242, 262, 282, 327, 398, 334, 338, 263, 402, 259, 372, 58, 320, 8, 60, 110,
+   331, 428, 99, 361, 193, 122, 316, 108, 91, 445, 234, 307, 378, 328, 68, 40,
+   65, 130, 246, 292, 33, 125, 226, 247, 412, 109, 211, 377, 208, 17, 135, 396,
+   94, 355, 373, 178, 266, 312, 78, 340, 53, 170, 311, 408, 79, 460, 104, 61,
+   230, 277, 177, 146, 261, 162, 251, 442, 324, 38, 275, 387, 364, 103, 391, 394,
+   304, 18, 255, 472, 89, 205, 212, 47, 455, 404, 49, 140, 96, 7, 11, 420,
+   39, 395, 424, 69, 160, 7, 55, 410, 319, 468, 59, 440, 84, 4, 86, 295,
+   393, 184
+};
+
+const uint16_t armDigitRevIndexTable640[ARMDIGITREVINDEXTABLE_640_TABLE_LENGTH] = 
+{
+   //4x4x4x2x5, size 642
+   574, 1, 160, 21, 210, 336, 17, 170, 421, 223, 616, 109, 305, 192, 6, 360,
+   107, 585, 249, 276, 52, 70, 365, 307, 512, 4, 40, 100, 65, 165, 221, 296,
+   102, 385, 163, 501, 238, 466, 338, 337, 177, 191, 631, 559, 624, 39, 540, 134,
+   361, 267, 562, 354, 347, 577, 169, 261, 202, 406, 373, 237, 306, 352, 27, 570,
+   434, 353, 187, 591, 609, 189, 311, 552, 104, 105, 265, 242, 356, 67, 485, 228,
+   66, 325, 207, 606, 459, 568, 114, 355, 507, 598, 379, 597, 219, 576, 9, 240,
+   36, 60, 150, 371, 517, 204, 126, 475, 578, 329, 247, 556, 144, 11, 560, 34,
+   340, 57, 270, 442, 433, 193, 166, 381, 317, 312, 112, 35, 500, 78, 445, 313,
+   272, 12, 120, 115, 515, 484, 68, 45, 300, 142, 441, 273, 172, 141, 281, 252,
+   156, 131, 481, 188, 151, 531, 494, 468, 58, 430, 463, 608, 29, 290, 342, 377,
+   277, 212, 56, 110, 465, 178, 351, 617, 269, 282, 412, 133, 201, 246, 396, 123,
+   595, 499, 518, 364, 147, 491, 588, 129, 161, 181, 231, 546, 344, 97, 185, 271,
+   602, 419, 503, 558, 464, 18, 330, 407, 533, 214, 376, 117, 235, 586, 409, 253,
+   316, 152, 91, 575, 634, 439, 553, 264, 82, 335, 607, 619, 589, 289, 182, 391,
+   523, 564, 74, 405, 213, 216, 96, 25, 250, 436, 73, 245, 236, 146, 331, 567,
+   554, 424, 103, 545, 184, 111, 625, 199, 526, 444, 153, 251, 596, 59, 590, 449,
+   168, 101, 225, 186, 431, 623, 629, 239, 626, 359, 547, 504, 118, 395, 563, 514,
+   324, 47, 620, 149, 211, 496, 38, 380, 157, 291, 502, 398, 443, 593, 179, 511,
+   638, 479, 618, 429, 303, 622, 469, 218, 416, 23, 530, 334, 447, 633, 279, 532,
+   54, 390, 363, 587, 569, 274, 332, 127, 635, 599, 539, 574, 474, 418, 343, 537,
+   254, 476, 138, 401, 173, 301, 302, 462, 448, 8, 80, 15, 600, 99, 505, 278,
+   372, 77, 285, 292, 62, 470, 378, 437, 233, 266, 402, 333, 287, 612, 69, 205,
+   286, 452, 48, 30, 450, 328, 87, 535, 534, 374, 397, 283, 572, 154, 411, 573,
+   314, 432, 33, 180, 71, 525, 284, 132, 41, 260, 42, 420, 63, 630, 399, 603,
+   579, 489, 268, 122, 435, 513, 164, 61, 310, 392, 83, 495, 628, 79, 605, 299,
+   582, 369, 197, 206, 446, 473, 258, 322, 327, 527, 604, 139, 561, 194, 326, 367,
+   627, 519, 524, 124, 155, 571, 594, 339, 497, 198, 366, 467, 498, 358, 387, 483,
+   508, 158, 451, 488, 108, 145, 171, 581, 209, 176, 31, 610, 349, 297, 262, 362,
+   427, 583, 529, 174, 461, 288, 22, 370, 357, 227, 506, 438, 393, 243, 516, 44,
+   140, 121, 275, 492, 148, 51, 510, 478, 458, 408, 93, 295, 542, 454, 368, 37,
+   220, 136, 81, 175, 621, 309, 232, 106, 425, 263, 522, 404, 53, 230, 386, 323,
+   487, 548, 64, 5, 200, 86, 375, 557, 304, 32, 20, 50, 350, 457, 248, 116,
+   75, 565, 234, 426, 423, 543, 614, 389, 203, 566, 394, 403, 493, 308, 72, 85,
+   215, 536, 94, 455, 528, 14, 440, 113, 195, 486, 388, 43, 580, 49, 190, 471,
+   538, 414, 453, 208, 16, 10, 400, 13, 280, 92, 135, 521, 244, 76, 125, 315,
+   592, 19, 490, 428, 143, 601, 259, 482, 348, 137, 241, 196, 46, 460, 128, 42,
+   2, 320, 7, 520, 84, 55, 550, 384, 3, 480, 28, 130, 321, 167, 541, 294,
+   382, 477, 298, 422, 383, 637, 319, 632, 119, 555, 584, 89, 255, 636, 159, 611,
+   509, 318, 472, 98, 345, 257, 162, 341, 217, 256, 11, 24, 90, 415, 613, 229,
+   226, 346, 417, 183, 551, 544, 11, 26, 410, 413, 293, 222, 456, 88, 95, 615,
+   549, 224
+};
+
+const uint16_t armDigitRevIndexTable768[ARMDIGITREVINDEXTABLE_768_TABLE_LENGTH] = 
+{
+   //4x4x4x4x3, size 774
+   318, 1, 192, 9, 288, 25, 300, 169, 318, 565, 278, 445, 379, 712, 107, 699,
+   716, 155, 690, 428, 175, 750, 563, 614, 461, 346, 496, 46, 552, 122, 519, 626,
+   425, 319, 757, 287, 733, 359, 652, 152, 114, 423, 655, 728, 119, 663, 644, 56,
+   132, 54, 468, 70, 435, 619, 701, 380, 184, 138, 486, 466, 406, 451, 586, 485,
+   274, 397, 343, 640, 8, 96, 27, 684, 176, 42, 504, 142, 534, 446, 571, 710,
+   443, 715, 683, 704, 11, 672, 32, 24, 108, 171, 702, 572, 182, 474, 502, 478,
+   550, 458, 490, 514, 386, 391, 631, 665, 308, 85, 255, 765, 383, 760, 143, 726,
+   455, 634, 521, 290, 409, 307, 613, 269, 337, 208, 21, 252, 189, 378, 520, 98,
+   411, 691, 620, 173, 366, 556, 170, 510, 574, 566, 470, 454, 442, 523, 674, 416,
+   31, 732, 167, 654, 536, 110, 555, 698, 524, 146, 402, 403, 595, 593, 209, 213,
+   261, 241, 237, 369, 232, 129, 198, 441, 331, 676, 80, 15, 720, 23, 636, 185,
+   330, 484, 82, 399, 727, 647, 632, 137, 294, 457, 298, 505, 334, 532, 62, 564,
+   86, 447, 763, 719, 731, 695, 668, 164, 78, 531, 590, 533, 254, 573, 374, 472,
+   118, 471, 646, 440, 139, 678, 464, 22, 444, 187, 714, 491, 706, 395, 679, 656,
+   20, 60, 180, 90, 495, 754, 431, 751, 755, 623, 749, 371, 616, 125, 375, 664,
+   116, 87, 639, 761, 335, 724, 71, 627, 617, 317, 373, 280, 109, 363, 700, 188,
+   186, 522, 482, 418, 415, 739, 611, 605, 353, 220, 165, 270, 529, 206, 537, 302,
+   553, 314, 517, 242, 429, 367, 748, 179, 618, 509, 382, 568, 134, 438, 475, 694,
+   476, 166, 462, 538, 494, 562, 422, 463, 730, 503, 670, 548, 74, 483, 610, 413,
+   355, 604, 161, 222, 549, 266, 481, 226, 417, 223, 741, 275, 589, 341, 256, 318,
+   2, 384, 7, 624, 41, 312, 133, 246, 477, 358, 460, 154, 498, 430, 559, 746,
+   515, 578, 389, 247, 669, 356, 76, 147, 594, 401, 211, 597, 257, 193, 201, 297,
+   313, 325, 244, 93, 351, 736, 35, 600, 113, 231, 657, 212, 69, 243, 621, 365,
+   364, 172, 174, 558, 554, 506, 526, 530, 398, 535, 638, 569, 326, 436, 91, 687,
+   752, 47, 744, 131, 582, 437, 283, 685, 368, 40, 120, 135, 630, 473, 310, 469,
+   262, 433, 235, 705, 203, 681, 320, 4, 48, 36, 72, 99, 603, 689, 236, 177,
+   234, 513, 194, 393, 295, 649, 296, 121, 327, 628, 89, 303, 745, 323, 580, 53,
+   276, 61, 372, 88, 111, 747, 707, 587, 677, 272, 13, 336, 16, 12, 144, 18,
+   396, 151, 642, 392, 103, 651, 680, 128, 6, 432, 43, 696, 140, 150, 450, 394,
+   487, 658, 404, 67, 579, 581, 245, 285, 349, 352, 28, 156, 162, 414, 547, 602,
+   497, 238, 561, 230, 465, 214, 453, 250, 525, 338, 400, 19, 588, 149, 258, 385,
+   199, 633, 329, 292, 73, 291, 601, 305, 229, 273, 205, 345, 304, 37, 264, 97,
+   219, 693, 284, 157, 354, 412, 163, 606, 545, 218, 501, 286, 541, 350, 544, 26,
+   492, 178, 426, 511, 766, 575, 758, 479, 742, 467, 598, 449, 202, 489, 322, 388,
+   55, 660, 68, 51, 612, 77, 339, 592, 17, 204, 153, 306, 421, 271, 721, 215,
+   645, 248, 141, 342, 448, 10, 480, 34, 408, 115, 615, 653, 344, 112, 39, 648,
+   104, 123, 711, 635, 713, 299, 697, 332, 148, 66, 387, 583, 629, 281, 301, 361,
+   316, 181, 282, 493, 370, 424, 127, 759, 671, 740, 83, 591, 725, 263, 625, 233,
+   321, 196, 57, 324, 52, 84, 63, 756, 95, 735, 743, 659, 596, 65, 195, 585,
+   293, 265, 289, 217, 309, 277, 253, 381, 376, 136, 102, 459, 682, 512, 42, 3,
+   576, 5, 240, 45, 360, 124, 183, 666, 500, 94, 543, 734, 551, 650, 488, 130,
+   390, 439, 667, 692, 92, 159, 738, 419, 607, 737, 227, 609, 221, 357, 268, 145,
+   210, 405, 259, 577, 197, 249, 333, 340, 64, 2, 14, 528, 42, 29, 348, 160,
+   30, 540, 158, 546, 410, 499, 622, 557, 362, 508, 190, 570, 518, 434, 427, 703,
+   764, 191, 762, 527, 722, 407, 643, 584, 101, 267, 673, 224, 33, 216, 117, 279,
+   637, 377, 328, 100, 75, 675, 608, 8, 38, 456, 106, 507, 718, 539, 686, 560,
+   22, 44, 168, 126, 567, 662, 452, 58, 516, 50, 420, 79, 723, 599, 641, 200,
+   105, 315, 709, 251, 717, 347, 688, 8, 49, 228, 81, 207, 729, 311, 661, 260,
+   2, 59, 708, 2, 239, 753
+};
+
+const uint16_t armDigitRevIndexTable960[ARMDIGITREVINDEXTABLE_960_TABLE_LENGTH] = 
+{
+   //4x4x4x3x5, size 966
+   730, 1, 240, 46, 690, 533, 327, 791, 799, 919, 809, 394, 602, 618, 633, 408,
+   137, 370, 536, 147, 745, 403, 737, 283, 861, 444, 227, 751, 943, 944, 59, 885,
+   354, 521, 372, 116, 110, 695, 833, 249, 406, 557, 462, 667, 863, 924, 209, 256,
+   6, 540, 207, 901, 314, 651, 848, 24, 135, 790, 559, 942, 704, 13, 420, 92,
+   200, 121, 410, 617, 393, 362, 641, 248, 166, 580, 63, 945, 299, 876, 219, 856,
+   144, 25, 375, 836, 69, 305, 291, 756, 118, 590, 663, 803, 754, 538, 627, 768,
+   4, 60, 225, 271, 906, 614, 573, 477, 442, 647, 788, 79, 905, 374, 596, 78,
+   665, 383, 956, 239, 931, 764, 238, 691, 773, 304, 51, 765, 478, 682, 638, 708,
+   73, 365, 461, 427, 872, 159, 925, 449, 247, 826, 649, 368, 56, 165, 340, 86,
+   560, 57, 405, 317, 471, 802, 514, 492, 217, 376, 176, 55, 825, 409, 377, 416,
+   32, 30, 675, 758, 598, 558, 702, 713, 373, 356, 101, 335, 911, 914, 509, 472,
+   142, 670, 683, 878, 699, 893, 474, 622, 693, 353, 281, 381, 476, 202, 601, 378,
+   656, 23, 795, 859, 864, 39, 810, 634, 648, 128, 10, 600, 138, 610, 513, 252,
+   226, 511, 952, 179, 775, 784, 19, 735, 928, 44, 210, 496, 52, 105, 395, 842,
+   609, 273, 261, 306, 531, 747, 883, 774, 544, 42, 630, 588, 183, 835, 729, 388,
+   62, 705, 253, 466, 502, 592, 18, 495, 937, 404, 77, 425, 392, 122, 650, 608,
+   33, 270, 666, 623, 933, 344, 146, 505, 412, 197, 301, 456, 127, 950, 599, 798,
+   679, 818, 529, 267, 846, 669, 443, 887, 834, 489, 397, 422, 572, 237, 451, 727,
+   808, 154, 625, 288, 36, 90, 620, 213, 316, 231, 811, 874, 639, 948, 119, 830,
+   709, 313, 411, 857, 384, 2, 480, 37, 330, 611, 753, 298, 636, 228, 91, 860,
+   204, 181, 355, 761, 418, 512, 12, 180, 115, 770, 484, 97, 275, 741, 343, 806,
+   574, 717, 433, 287, 921, 389, 302, 696, 173, 460, 187, 895, 954, 659, 743, 823,
+   829, 469, 322, 491, 877, 459, 847, 909, 434, 527, 912, 29, 435, 767, 958, 719,
+   913, 269, 426, 632, 168, 160, 40, 150, 565, 357, 341, 326, 551, 822, 589, 423,
+   812, 214, 556, 222, 676, 98, 515, 732, 208, 16, 15, 900, 74, 605, 438, 587,
+   843, 849, 264, 126, 710, 553, 402, 497, 292, 96, 35, 750, 703, 953, 419, 752,
+   58, 645, 308, 111, 935, 824, 169, 400, 17, 255, 946, 539, 867, 759, 838, 549,
+   342, 566, 597, 318, 711, 793, 379, 896, 14, 660, 83, 740, 103, 815, 934, 584,
+   123, 890, 654, 668, 203, 841, 369, 296, 156, 205, 421, 332, 191, 955, 899, 734,
+   688, 53, 345, 386, 482, 517, 312, 171, 880, 54, 585, 363, 881, 294, 576, 3,
+   720, 28, 195, 721, 268, 186, 655, 908, 194, 481, 277, 321, 251, 886, 594, 498,
+   532, 87, 800, 34, 510, 712, 133, 310, 591, 903, 794, 619, 873, 399, 902, 554,
+   642, 488, 157, 445, 467, 742, 583, 783, 904, 134, 550, 582, 543, 927, 929, 284,
+   201, 361, 401, 257, 246, 586, 603, 858, 624, 48, 45, 450, 487, 817, 289, 276,
+   81, 260, 66, 485, 337, 266, 606, 678, 578, 483, 757, 358, 581, 303, 936, 164,
+   100, 95, 920, 149, 325, 311, 831, 949, 359, 821, 349, 446, 707, 733, 448, 7,
+   780, 184, 175, 940, 224, 31, 915, 749, 463, 907, 854, 564, 117, 350, 686, 698,
+   653, 428, 212, 76, 185, 415, 917, 329, 371, 776, 124, 230, 571, 897, 254, 706,
+   493, 457, 367, 941, 464, 22, 555, 882, 534, 567, 837, 309, 351, 926, 689, 293,
+   336, 26, 615, 813, 454, 547, 762, 658, 503, 832, 9, 360, 161, 280, 141, 430,
+   692, 113, 290, 516, 72, 125, 470, 562, 537, 387, 722, 508, 232, 151, 805, 334,
+   671, 923, 869, 339, 746, 643, 728, 148, 85, 320, 11, 840, 129, 250, 646, 548,
+   102, 575, 957, 479, 922, 629, 348, 206, 661, 323, 731, 868, 99, 755, 778, 604,
+   198, 541, 447, 947, 779, 844, 189, 475, 862, 684, 218, 616, 153, 385, 242, 526,
+   672, 38, 570, 657, 263, 786, 499, 772, 64, 5, 300, 216, 136, 130, 490, 637,
+   468, 82, 500, 112, 50, 525, 432, 47, 930, 524, 192, 4, 8, 120, 170, 640,
+   78, 20, 75, 845, 429, 452, 67, 725, 328, 131, 730, 628, 108, 215, 796, 199,
+   781, 424, 152, 145, 265, 366, 701, 473, 382, 716, 193, 241, 286, 681, 398, 662,
+   563, 777, 364, 221, 436, 107, 875, 879, 939, 884, 114, 530, 507, 892, 234, 631,
+   828, 229, 331, 851, 744, 163, 760, 178, 535, 807, 814, 694, 593, 258, 486, 577,
+   243, 766, 718, 673, 278, 561, 297, 396, 182, 595, 738, 523, 852, 84, 80, 42,
+   21, 315, 891, 894, 714, 613, 333, 431, 932, 104, 155, 865, 279, 801, 274, 501,
+   352, 41, 390, 542, 687, 938, 644, 68, 65, 245, 346, 626, 528, 27, 855, 804,
+   94, 680, 158, 685, 458, 607, 918, 569, 417, 272, 12, 43, 870, 579, 723, 748,
+   223, 916, 89, 380, 236, 211, 736, 58, 49, 285, 441, 407, 797, 439, 827, 889,
+   414, 677, 338, 506, 652, 188, 235, 871, 819, 769, 244, 106, 635, 888, 174, 700,
+   233, 391, 782, 664, 143, 910, 674, 518, 552, 162, 520, 132, 70, 545, 282, 621,
+   453, 307, 771, 724, 88, 140, 190, 715, 853, 324, 71, 785, 259, 726, 568, 177,
+   295, 816, 30, 61, 465, 262, 546, 522, 612, 93, 440, 167, 820, 109, 455, 787,
+   739, 763, 898, 494, 697, 413, 437, 347, 866, 519, 792, 139, 850, 504, 172, 220,
+   196, 4, 319, 951, 839, 789
+};
+
+const uint16_t armDigitRevIndexTable1280[ARMDIGITREVINDEXTABLE1280_TABLE_LENGTH] = 
+{
+   //4x4x4x4x5, size 1288
+   302, 1, 320, 6, 720, 37, 440, 231, 1095, 1049, 504, 236, 295, 1081, 544, 42,
+   840, 168, 210, 675, 1012, 158, 910, 893, 628, 147, 990, 918, 753, 397, 571, 1182,
+   914, 673, 372, 146, 670, 912, 33, 360, 206, 895, 1268, 159, 1230, 899, 973, 578,
+   647, 1052, 264, 161, 370, 706, 657, 352, 46, 920, 193, 335, 1206, 794, 823, 1103,
+   1209, 554, 842, 808, 203, 1135, 1249, 379, 1186, 694, 792, 183, 1110, 749, 617, 527,
+   1202, 714, 817, 383, 1266, 719, 1217, 339, 986, 838, 728, 197, 415, 1231, 1219, 979,
+   998, 778, 803, 1003, 1178, 834, 648, 172, 290, 681, 532, 102, 765, 637, 627, 1027,
+   964, 98, 685, 612, 127, 1265, 399, 1211, 1194, 854, 748, 297, 521, 482, 696, 232,
+   215, 1075, 1024, 4, 80, 25, 500, 156, 270, 881, 388, 91, 1145, 549, 442, 871,
+   1088, 9, 480, 56, 220, 275, 981, 438, 791, 1063, 1084, 304, 61, 620, 287, 1221,
+   419, 1011, 1038, 884, 148, 110, 925, 593, 347, 1146, 869, 448, 16, 20, 100, 125,
+   625, 387, 971, 1138, 709, 417, 371, 1026, 644, 92, 265, 481, 376, 226, 695, 1112,
+   189, 630, 787, 983, 1078, 784, 23, 1060, 124, 305, 381, 626, 707, 977, 358, 766,
+   957, 633, 547, 1002, 858, 828, 303, 1241, 519, 1042, 664, 192, 15, 1200, 74, 805,
+   443, 1191, 1094, 729, 517, 402, 671, 1232, 39, 1080, 224, 55, 1100, 249, 555, 1162,
+   814, 923, 1153, 334, 886, 788, 103, 1085, 624, 67, 965, 418, 691, 1032, 164, 130,
+   650, 812, 283, 1141, 469, 436, 151, 1070, 924, 273, 341, 426, 851, 988, 278, 741,
+   457, 496, 76, 245, 475, 1156, 94, 905, 493, 616, 207, 1215, 1274, 879, 1248, 59,
+   1180, 274, 661, 432, 71, 1045, 424, 211, 995, 1018, 878, 928, 53, 460, 256, 171,
+   2, 640, 12, 240, 75, 1125, 449, 336, 26, 820, 143, 1210, 874, 848, 28, 260,
+   81, 345, 506, 876, 288, 41, 520, 162, 690, 712, 177, 390, 731, 1157, 414, 911,
+   1213, 634, 867, 1008, 78, 885, 468, 116, 145, 350, 906, 813, 603, 1147, 1189, 454,
+   736, 57, 540, 262, 721, 357, 446, 951, 1113, 509, 636, 307, 1021, 638, 947, 1033,
+   484, 136, 170, 850, 668, 272, 21, 420, 131, 970, 818, 703, 1272, 239, 1255, 1099,
+   1129, 529, 342, 746, 857, 508, 316, 301, 601, 507, 1196, 294, 761, 557, 602, 827,
+   1183, 1234, 679, 1092, 89, 505, 556, 282, 821, 463, 1216, 19, 980, 118, 785, 343,
+   1066, 844, 248, 235, 1175, 1074, 704, 17, 340, 106, 845, 568, 222, 915, 993, 378,
+   866, 688, 72, 165, 450, 656, 32, 40, 200, 175, 1250, 699, 1192, 214, 755, 1037,
+   564, 142, 890, 868, 128, 10, 800, 43, 1160, 174, 930, 693, 472, 196, 95, 1225,
+   499, 1036, 244, 155, 1150, 949, 473, 516, 82, 665, 512, 117, 3, 960, 18, 660,
+   112, 65, 325, 406, 751, 1257, 539, 1142, 789, 423, 1091, 969, 498, 716, 257, 321,
+   326, 726, 757, 477, 596, 107, 1165, 574, 942, 933, 453, 416, 51, 1020, 318, 941,
+   613, 447, 1271, 1119, 1229, 579, 967, 1058, 684, 292, 121, 545, 362, 846, 888, 228,
+   135, 1050, 824, 223, 1235, 999, 1098, 809, 523, 1122, 689, 392, 171, 1170, 674, 692,
+   152, 190, 950, 793, 503, 1116, 269, 561, 382, 946, 713, 497, 396, 251, 1195, 1174,
+   754, 717, 577, 327, 1046, 744, 217, 515, 962, 658, 672, 52, 140, 250, 875, 1168,
+   34, 680, 212, 115, 1025, 324, 86, 745, 537, 502, 796, 263, 1041, 344, 186, 870,
+   768, 302, 5, 400, 31, 1220, 99, 1005, 618, 847, 1208, 234, 855, 1068, 284, 261,
+   401, 351, 1226, 819, 1023, 1278, 959, 1273, 559, 1242, 839, 1048, 184, 230, 775, 1043,
+   984, 198, 735, 1237, 439, 1111, 1069, 604, 267, 1121, 369, 386, 651, 1132, 289, 361,
+   526, 882, 708, 97, 365, 606, 907, 1133, 609, 367, 1246, 919, 1073, 384, 11, 1120,
+   49, 380, 306, 701, 632, 227, 1015, 1118, 909, 573, 622, 927, 1233, 359, 1086, 944,
+   73, 485, 456, 176, 70, 725, 437, 471, 1076, 144, 30, 900, 93, 585, 487, 1096,
+   169, 530, 662, 752, 77, 565, 462, 896, 13, 560, 62, 940, 293, 441, 551, 1082,
+   864, 48, 60, 300, 281, 501, 476, 276, 101, 445, 631, 1107, 989, 598, 747, 1177,
+   514, 642, 652, 252, 315, 1181, 594, 667, 1152, 14, 880, 68, 85, 425, 531, 982,
+   758, 797, 583, 1047, 1064, 204, 255, 1275, 1199, 1254, 779, 1123, 1009, 398, 891, 1188,
+   134, 730, 837, 408, 191, 1270, 799, 1223, 1059, 1004, 298, 841, 488, 216, 195, 975,
+   1218, 659, 992, 58, 860, 268, 241, 395, 1131, 1169, 354, 686, 932, 133, 410, 831,
+   1263, 1259, 1179, 1154, 654, 892, 308, 141, 570, 862, 908, 253, 635, 1187, 1014, 798,
+   903, 1053, 584, 167, 1090, 649, 492, 296, 201, 495, 1256, 219, 1155, 974, 898, 653,
+   572, 302, 921, 513, 322, 646, 732, 277, 421, 451, 976, 38, 760, 237, 615, 1087,
+   1264, 79, 1205, 474, 836, 88, 185, 550, 762, 877, 608, 47, 1240, 199, 1055, 1224,
+   179, 1030, 724, 117, 465, 356, 126, 945, 393, 491, 1176, 194, 655, 1212, 314, 861,
+   588, 247, 1115, 1149, 629, 467, 996, 138, 810, 843, 1128, 209, 355, 1006, 938, 853,
+   428, 291, 1001, 538, 822, 783, 1203, 1034, 804, 123, 1185, 374, 786, 663, 1072, 64,
+   171, 7, 1040, 24, 180, 150, 750, 937, 533, 422, 771, 963, 978, 678, 772, 83,
+   985, 518, 722, 677, 452, 96, 45, 600, 187, 1190, 774, 723, 997, 458, 816, 63,
+   1260, 299, 1161, 494, 936, 213, 435, 1031, 1044, 104, 205, 575, 1262, 939, 1173, 434,
+   711, 1057, 364, 286, 901, 413, 591, 1207, 1114, 829, 623, 1247, 1239, 1079, 1104, 29,
+   580, 87, 1065, 524, 242, 715, 1137, 389, 411, 1151, 1269, 479, 1236, 119, 1105, 349,
+   586, 807, 1083, 1184, 54, 780, 243, 1035, 1124, 129, 330, 806, 763, 1197, 614, 767,
+   1277, 639, 1267, 1039, 1204, 154, 830, 943, 1253, 459, 1136, 69, 405, 431, 1251, 1019,
+   1198, 934, 773, 403, 991, 1238, 759, 1117, 589, 567, 1102, 889, 548, 122, 865, 368,
+   66, 645, 412, 271, 1201, 394, 811, 1163, 1134, 929, 373, 466, 676, 132, 90, 825,
+   543, 1222, 739, 1017, 558, 922, 833, 328, 166, 770, 643, 972, 258, 641, 332, 246,
+   795, 1143, 1109, 429, 611, 1007, 1258, 859, 1148, 309, 461, 576, 117, 8, 160, 50,
+   700, 312, 221, 595, 987, 1158, 734, 917, 433, 391, 1051, 1144, 229, 455, 1056, 44,
+   280, 181, 470, 756, 157, 590, 887, 1108, 109, 605, 587, 1127, 1089, 329, 486, 776,
+   163, 1010, 718, 897, 333, 566, 782, 883, 1028, 84, 105, 525, 562, 702, 952, 233,
+   535, 1062, 764, 317, 621, 607, 1227, 1139, 1029, 404, 111, 1245, 599, 1067, 1164, 254,
+   955, 1193, 534, 742, 777, 483, 1016, 238, 935, 1093, 409, 511, 1276, 319, 1261, 619,
+   1167, 1214, 954, 873, 528, 22, 740, 137, 490, 856, 188, 310, 781, 563, 1022, 958,
+   953, 553, 522, 802, 683, 1172, 114, 705, 337, 346, 826, 863, 1228, 259, 961, 338,
+   666, 832, 54, 27, 1140, 149, 430, 931, 1013, 478, 916, 113, 385, 331, 1126, 769,
+   323, 966, 738, 697, 552, 202, 815, 1243, 1159, 1054, 904, 173, 610, 687, 1252, 139,
+   1130, 849, 348, 266, 801, 363, 1166, 894, 948, 153, 510, 956, 313, 541, 582, 727,
+   1077, 464, 36, 120, 225, 375, 1106, 669, 592, 34, 35, 1000, 218, 835, 968, 178,
+   710, 737, 377, 546, 682, 852, 108, 285, 581, 407, 1071, 1244, 279, 1061, 444, 311,
+   1101, 569, 542, 902, 733, 597, 427, 1171, 994, 698, 872, 208, 6, 182, 790, 743,
+   1097, 489, 536, 4, 353, 366, 926, 913
+};
+
+const uint16_t armDigitRevIndexTable1920[ARMDIGITREVINDEXTABLE1920_TABLE_LENGTH] = 
+{
+   //4x4x4x2x3x5, size 1924
+   925, 1, 480, 76, 375, 1675, 1689, 759, 1676, 369, 595, 1491, 1498, 1258, 1278, 1428,
+   163, 1505, 568, 336, 55, 1650, 1069, 912, 37, 660, 161, 545, 546, 1026, 972, 382,
+   1435, 1723, 1779, 1554, 994, 1042, 1002, 1282, 968, 262, 1090, 987, 1732, 144, 35, 1500,
+   418, 1021, 952, 337, 535, 1596, 454, 1096, 267, 1690, 1239, 1608, 259, 1450, 1273, 828,
+   452, 136, 245, 710, 1106, 1017, 832, 17, 510, 1426, 1003, 1762, 1044, 162, 1025, 492,
+   436, 211, 1490, 1018, 1312, 68, 135, 1565, 874, 1277, 948, 217, 770, 962, 982, 1132,
+   447, 1891, 1529, 838, 1097, 747, 1766, 1164, 363, 1765, 684, 431, 1861, 629, 711, 1586,
+   1054, 1362, 1013, 712, 266, 1210, 1293, 848, 47, 1860, 149, 635, 1791, 1914, 1319, 1628,
+   409, 751, 1886, 1379, 1523, 1558, 1114, 1257, 798, 1352, 263, 1570, 1024, 12, 360, 325,
+   625, 591, 1821, 884, 227, 1520, 118, 1185, 543, 1836, 434, 1051, 1722, 1299, 1478, 1108,
+   177, 575, 1896, 329, 745, 806, 1142, 1197, 903, 1567, 1834, 1274, 1308, 398, 1321, 788,
+   152, 275, 1480, 268, 370, 1075, 1542, 1084, 462, 1336, 338, 1015, 1672, 249, 830, 1412,
+   133, 605, 891, 1787, 1794, 974, 1342, 1418, 1213, 933, 667, 1721, 819, 1532, 478, 1366,
+   1133, 927, 1837, 914, 997, 682, 1271, 1668, 129, 485, 676, 191, 1895, 1649, 589, 861,
+   887, 1667, 1449, 793, 752, 116, 225, 560, 96, 75, 1695, 1839, 1874, 1019, 1792, 14,
+   1320, 308, 220, 410, 1231, 1818, 1244, 408, 271, 1810, 1004, 442, 1291, 1688, 279, 1600,
+   19, 1470, 1423, 1813, 644, 131, 1445, 673, 551, 1626, 1249, 558, 1386, 1283, 1448, 313,
+   820, 212, 170, 1265, 588, 381, 955, 1777, 594, 1011, 1552, 34, 1020, 472, 286, 1360,
+   53, 690, 1061, 672, 71, 1575, 1624, 289, 550, 1146, 1317, 668, 401, 511, 1906, 1079,
+   1662, 1429, 643, 1451, 1753, 774, 1082, 1302, 1118, 1377, 563, 1536, 4, 120, 345, 775,
+   1562, 1234, 1008, 112, 105, 795, 1712, 99, 1515, 1768, 324, 145, 515, 1446, 1153, 483,
+   1516, 448, 16, 30, 1350, 1103, 1827, 1514, 1288, 248, 350, 1375, 1853, 944, 97, 555,
+   1746, 1014, 1192, 303, 1870, 1349, 623, 1881, 779, 1682, 999, 1642, 1279, 1908, 239, 1880,
+   299, 1750, 1134, 1407, 1913, 839, 1577, 784, 32, 60, 450, 976, 52, 210, 1010, 1072,
+   102, 1155, 1443, 1513, 808, 302, 1390, 1403, 1793, 494, 1396, 233, 800, 62, 1410, 973,
+   862, 1367, 1613, 859, 1727, 1899, 1769, 804, 182, 1175, 1593, 814, 1382, 1163, 1683, 1479,
+   1588, 214, 1130, 1287, 1568, 64, 15, 1800, 254, 1430, 1123, 1527, 1678, 1329, 578, 981,
+   652, 371, 1555, 1474, 988, 412, 391, 1561, 754, 1076, 222, 1370, 1253, 678, 1151, 1917,
+   959, 1897, 809, 782, 1322, 1268, 228, 200, 260, 130, 965, 622, 1401, 833, 497, 586,
+   1221, 618, 1281, 488, 316, 460, 376, 355, 1525, 718, 1346, 983, 1612, 379, 1795, 1454,
+   1393, 593, 531, 1476, 148, 155, 1715, 1539, 1444, 193, 500, 226, 1040, 42, 1260, 438,
+   1171, 1473, 508, 466, 1006, 1402, 1313, 548, 186, 1295, 1808, 44, 420, 181, 695, 1661,
+   949, 697, 821, 692, 221, 890, 1307, 1718, 1179, 1713, 579, 1461, 703, 1901, 929, 547,
+   1506, 1048, 282, 1240, 288, 70, 1095, 1587, 1534, 1438, 1363, 1493, 658, 1001, 802, 1022,
+   1432, 283, 1720, 339, 1495, 1618, 1009, 592, 51, 1530, 1318, 1148, 477, 886, 1187, 1503,
+   1858, 989, 892, 467, 1486, 1348, 143, 1805, 854, 1127, 1647, 1879, 1619, 1489, 538, 1236,
+   168, 305, 580, 141, 845, 857, 767, 1916, 479, 1846, 1184, 63, 1890, 1049, 762, 1316,
+   188, 455, 1576, 304, 100, 195, 1460, 223, 1850, 1304, 278, 1120, 87, 1605, 619, 1761,
+   564, 216, 290, 1030, 1092, 147, 1475, 1468, 463, 1816, 284, 400, 31, 1830, 1154, 963,
+   1462, 1183, 1833, 794, 1232, 48, 90, 1245, 888, 347, 1735, 1584, 94, 1365, 653, 851,
+   1487, 1828, 194, 980, 172, 425, 781, 842, 1217, 498, 1066, 1272, 348, 415, 1831, 1634,
+   1039, 1812, 164, 185, 815, 1862, 1109, 657, 521, 726, 1136, 117, 705, 506, 1306, 1238,
+   1128, 327, 1585, 574, 1416, 253, 950, 1177, 753, 596, 171, 1745, 534, 1116, 417, 541,
+   876, 437, 691, 1541, 604, 411, 1711, 1869, 869, 677, 671, 1841, 584, 261, 610, 1041,
+   522, 1206, 1173, 633, 831, 1892, 209, 530, 996, 202, 1220, 138, 1205, 693, 701, 941,
+   907, 1687, 1599, 1894, 1169, 513, 486, 1156, 123, 1785, 834, 977, 532, 156, 395, 1681,
+   519, 1566, 1354, 1223, 1578, 1264, 108, 435, 1531, 1798, 1094, 1107, 1497, 778, 1202, 1053,
+   882, 1067, 1752, 294, 1150, 1437, 883, 1547, 1684, 159, 1835, 1754, 1254, 1158, 1083, 1782,
+   1194, 1263, 1878, 1139, 1557, 634, 1311, 1838, 1394, 1073, 582, 1101, 867, 1517, 928, 67,
+   1455, 1873, 539, 1716, 219, 1730, 984, 292, 190, 1415, 1573, 664, 281, 760, 356, 205,
+   860, 407, 1591, 1654, 1189, 663, 1601, 499, 1546, 1204, 213, 650, 1211, 1773, 924, 397,
+   841, 737, 566, 1176, 273, 520, 246, 1190, 1143, 1677, 849, 527, 1806, 1334, 1178, 1233,
+   528, 36, 180, 215, 1610, 1219, 1458, 1063, 1632, 79, 1815, 1604, 139, 1685, 639, 1911,
+   1679, 1809, 524, 366, 1405, 953, 817, 572, 456, 256, 10, 1200, 93, 885, 707, 1466,
+   1303, 1598, 1414, 1093, 627, 1551, 1804, 374, 1195, 1743, 1824, 74, 1215, 1893, 689, 581,
+   621, 921, 757, 716, 386, 961, 502, 1186, 1023, 1912, 359, 1645, 919, 1597, 934, 1147,
+   1797, 614, 1161, 723, 1496, 298, 1270, 1188, 183, 1655, 1669, 609, 561, 576, 21, 630,
+   1191, 1623, 1609, 739, 1526, 1198, 1383, 1643, 1759, 1854, 1424, 43, 1740, 384, 925, 2,
+   960, 22, 1110, 1137, 597, 651, 1691, 1719, 1659, 1789, 954, 1297, 518, 1086, 1422, 1333,
+   698, 1301, 638, 1431, 1603, 1459, 1543, 1564, 394, 1201, 573, 936, 307, 1540, 124, 465,
+   526, 1326, 1388, 443, 1771, 1764, 204, 380, 475, 1726, 1419, 1693, 879, 1877, 659, 1481,
+   748, 446, 1411, 1453, 913, 517, 606, 1371, 1733, 624, 111, 1875, 1499, 1738, 1224, 258,
+   970, 1222, 1098, 1227, 1698, 1029, 612, 201, 740, 206, 1340, 458, 1216, 18, 990, 1372,
+   413, 871, 1637, 679, 1631, 1849, 824, 332, 385, 481, 556, 426, 1261, 918, 1117, 897,
+   487, 1636, 199, 1580, 424, 301, 910, 1327, 1868, 389, 601, 771, 1442, 1033, 732, 416,
+   61, 930, 1027, 1452, 433, 571, 1776, 114, 1065, 792, 272, 40, 300, 430, 1381, 683,
+   1751, 1614, 1339, 1778, 1074, 1062, 1152, 3, 1440, 73, 735, 1856, 29, 870, 1157, 603,
+   1731, 1464, 343, 1615, 1819, 1724, 459, 1696, 69, 615, 1641, 799, 1832, 314, 1300, 158,
+   1355, 1703, 1629, 889, 827, 1772, 444, 451, 1456, 103, 1635, 1519, 1888, 89, 765, 956,
+   457, 736, 86, 1125, 687, 1871, 1829, 674, 1031, 1572, 184, 335, 1825, 554, 1266, 1068,
+   432, 91, 1725, 939, 1747, 1494, 1138, 1077, 702, 1421, 853, 647, 1571, 1504, 88, 285,
+   880, 107, 1755, 1734, 1104, 57, 810, 1262, 1398, 1193, 783, 1802, 1214, 1413, 613, 681,
+   791, 1592, 334, 1345, 503, 1666, 969, 742, 1166, 1323, 1748, 174, 1385, 803, 1502, 1378,
+   1043, 1482, 1228, 378, 1315, 1508, 208, 50, 1050, 1242, 1248, 78, 1335, 1658, 1309, 878,
+   1397, 713, 746, 1286, 1088, 27, 1710, 1389, 923, 1717, 699, 1781, 714, 1226, 1218, 978,
+   1012, 232, 320, 25, 750, 1406, 1433, 763, 1796, 134, 1085, 942, 1387, 1763, 1524, 238,
+   1400, 353, 565, 696, 341, 655, 1811, 1484, 388, 121, 825, 812, 422, 1141, 717, 866,
+   1037, 852, 167, 1625, 769, 482, 1036, 372, 235, 1760, 84, 165, 665, 761, 836, 137,
+   725, 656, 41, 780, 362, 1285, 608, 81, 525, 846, 1337, 818, 1052, 402, 991, 1852,
+   464, 46, 1380, 203, 1700, 189, 935, 1627, 1729, 504, 346, 1255, 1638, 1159, 1563, 1714,
+   1059, 1512, 328, 265, 730, 1256, 318, 1420, 373, 715, 1706, 1269, 708, 146, 995, 1522,
+   1078, 1182, 1353, 743, 1646, 1399, 1673, 729, 776, 242, 1070, 1392, 113, 585, 741, 686,
+   1391, 1883, 1739, 1704, 309, 700, 461, 856, 287, 1840, 104, 315, 1780, 234, 1280, 8,
+   240, 110, 1395, 1553, 514, 966, 1102, 1347, 1463, 1663, 1909, 719, 1826, 1034, 1212, 453,
+   616, 321, 505, 826, 1292, 368, 115, 1545, 724, 176, 95, 1845, 704, 26, 1230, 1338,
+   1298, 998, 1162, 1203, 1533, 958, 1417, 733, 896, 7, 1560, 274, 1000, 322, 985, 772,
+   122, 1305, 758, 1196, 423, 1621, 649, 731, 1736, 264, 250, 1310, 1358, 1343, 1898, 1289,
+   728, 296, 310, 1180, 393, 721, 536, 276, 160, 65, 495, 1876, 179, 1535, 1918, 1439,
+   1843, 1544, 244, 230, 1160, 243, 1550, 1324, 428, 421, 661, 641, 491, 1756, 414, 1351,
+   1583, 1864, 269, 850, 1007, 1882, 1259, 1758, 1374, 1373, 893, 947, 1537, 484, 196, 140,
+   365, 925, 877, 917, 637, 951, 1657, 829, 932, 187, 1775, 1884, 419, 1501, 898, 967,
+   1582, 1384, 323, 1465, 823, 1652, 229, 680, 311, 1660, 469, 646, 1091, 1467, 1783, 1674,
+   1209, 813, 902, 1087, 1902, 1409, 493, 916, 157, 875, 1757, 894, 1427, 1483, 1708, 429,
+   901, 607, 1851, 1784, 354, 1045, 642, 971, 1702, 1149, 957, 937, 787, 1472, 28, 390,
+   1081, 822, 1172, 153, 755, 1556, 154, 1235, 1488, 58, 1290, 1208, 333, 865, 557, 906,
+   1207, 1653, 709, 626, 1071, 1872, 59, 1770, 1284, 128, 5, 600, 291, 1510, 1168, 33,
+   540, 396, 361, 805, 662, 1121, 567, 1656, 349, 895, 1907, 1559, 1594, 1294, 1328, 98,
+   1035, 1692, 399, 1801, 734, 1376, 83, 1485, 868, 197, 620, 441, 811, 1742, 1344, 23,
+   1590, 1174, 1113, 777, 722, 1016, 352, 85, 645, 611, 1521, 598, 1131, 1767, 1644, 439,
+   1651, 1549, 844, 377, 835, 1457, 583, 1581, 904, 247, 1670, 1089, 507, 1786, 1314, 1028,
+   132, 125, 945, 577, 501, 706, 986, 1252, 198, 1100, 387, 1441, 553, 786, 992, 82,
+   1005, 922, 1237, 648, 251, 1790, 1434, 1243, 1728, 24, 270, 1330, 1058, 1032, 252, 470,
+   1126, 1167, 1803, 1694, 1359, 1823, 1844, 224, 80, 45, 900, 127, 1905, 599, 1611, 1699,
+   1509, 688, 101, 675, 1511, 1648, 109, 915, 1477, 628, 231, 1640, 319, 1900, 449, 496,
+   106, 1275, 1788, 474, 1246, 1368, 293, 670, 1361, 533, 636, 471, 1606, 1099, 1707, 1749,
+   654, 1331, 1538, 964, 142, 1325, 908, 367, 1885, 899, 1447, 1633, 559, 1866, 1229, 858,
+   1247, 1848, 344, 295, 1630, 1369, 773, 602, 1251, 1518, 1408, 13, 840, 257, 490, 1276,
+   468, 166, 1145, 837, 617, 801, 542, 1356, 383, 1915, 1799, 1574, 1144, 357, 685, 911,
+   1807, 1814, 1124, 207, 1820, 404, 151, 1595, 1774, 1404, 473, 766, 1436, 403, 1471, 1903,
+   1889, 569, 816, 92, 405, 631, 1671, 1569, 544, 66, 975, 1822, 1364, 173, 905, 727,
+   1616, 49, 570, 1296, 38, 1140, 237, 920, 277, 640, 11, 1680, 39, 1620, 169, 785,
+   512, 6, 1080, 342, 1135, 1887, 1859, 1469, 943, 1867, 1709, 909, 847, 1817, 764, 476,
+   406, 1111, 1617, 529, 516, 126, 1425, 523, 1686, 1119, 1857, 509, 946, 1057, 552, 306,
+   1060, 192, 20, 150, 1115, 1737, 744, 326, 1105, 537, 756, 236, 440, 331, 1705, 789,
+   632, 351, 1855, 1904, 119, 1665, 489, 796, 392, 241, 590, 1341, 938, 1267, 1548, 364,
+   445, 931, 1507, 1528, 358, 1165, 843, 1697, 549, 666, 1241, 768, 26, 9, 720, 56,
+   330, 1225, 738, 1046, 1122, 1047, 1602, 979, 1492, 178, 1055, 1842, 1064, 312, 340, 175,
+   1865, 749, 926, 1357, 863, 1847, 1664, 26, 54, 1170, 993, 562, 1056, 72, 255, 1910,
+   1199, 1863, 1589, 694, 1181, 873, 797, 872, 317, 940, 427, 1741, 864, 77, 855, 1607,
+   1579, 1744, 4, 218, 1250, 1038, 1332, 3, 297, 790, 1112, 4, 587, 1701, 669, 881,
+   3, 807, 1622, 1129
+};
+
+const uint16_t armDigitRevIndexTable3840[ARMDIGITREVINDEXTABLE3840_TABLE_LENGTH] = 
+{
+   //4x4x4x4x3x5, size 3852
+   415, 1, 960, 46, 2760, 533, 1270, 2391, 3198, 2839, 3193, 1639, 3257, 1654, 2357, 1383,
+   3266, 1969, 1177, 1536, 2, 1920, 37, 1320, 611, 3025, 1078, 2346, 2523, 3468, 759, 3355,
+   3429, 1344, 26, 2460, 813, 1801, 1447, 3281, 1069, 1806, 2647, 3203, 2914, 2068, 312, 665,
+   1540, 242, 2145, 1107, 2961, 1063, 3246, 2794, 2573, 1688, 572, 910, 2671, 3743, 3704, 689,
+   1180, 816, 181, 1410, 1961, 1597, 1862, 2182, 2202, 2502, 2208, 162, 2070, 2232, 702, 2860,
+   853, 1276, 951, 3331, 2889, 1468, 941, 1831, 3247, 3754, 2564, 248, 705, 1015, 3346, 1989,
+   1252, 411, 3455, 3804, 839, 3136, 19, 2940, 928, 151, 3210, 2434, 1953, 1117, 1761, 1127,
+   3261, 1894, 2302, 2877, 1873, 1042, 1986, 1972, 457, 1490, 2036, 472, 590, 2665, 1583, 3722,
+   2444, 753, 1195, 3516, 939, 3511, 3339, 3369, 1569, 1082, 2586, 2468, 393, 1475, 2936, 688,
+   220, 825, 1621, 1277, 1911, 3322, 2629, 1223, 3171, 3019, 3418, 2484, 453, 1250, 2091, 3492,
+   399, 3635, 3074, 1924, 277, 1265, 1191, 3276, 769, 961, 1006, 2806, 2393, 1518, 2816, 13,
+   1680, 92, 795, 3421, 1764, 407, 3215, 3634, 2114, 1947, 3457, 999, 3286, 2269, 1797, 1207,
+   3336, 489, 1610, 2417, 1158, 2196, 342, 2240, 57, 1620, 317, 1865, 1462, 2381, 1698, 2072,
+   552, 610, 2065, 1032, 486, 2330, 2463, 3693, 1829, 1327, 3731, 2984, 643, 2920, 628, 445,
+   1895, 3262, 2854, 2293, 1437, 1781, 1427, 2981, 1363, 2966, 2263, 3237, 1354, 2426, 2598, 2288,
+   237, 1845, 1387, 3506, 2139, 3447, 3324, 949, 1411, 2921, 1588, 422, 2315, 3363, 3009, 1018,
+   2626, 1943, 3217, 1054, 2706, 2018, 2092, 852, 316, 905, 1471, 3821, 1859, 2902, 2248, 537,
+   1510, 2336, 123, 3555, 3054, 2818, 1933, 1717, 1412, 281, 1505, 1136, 201, 1485, 1736, 527,
+   3610, 2474, 2553, 1668, 272, 65, 975, 3646, 2834, 1993, 1492, 356, 380, 920, 571, 3550,
+   2754, 1973, 1417, 1481, 1496, 596, 325, 1220, 291, 3005, 1903, 3742, 2744, 698, 2620, 908,
+   751, 3775, 3824, 239, 3765, 1424, 101, 1335, 3311, 3769, 1664, 32, 120, 675, 3040, 178,
+   2130, 2007, 3232, 154, 2490, 2613, 1388, 866, 2056, 492, 890, 2596, 368, 200, 525, 1690,
+   2492, 933, 1351, 3146, 2419, 3078, 2164, 447, 3815, 3299, 3049, 1618, 1997, 1732, 287, 3665,
+   1049, 1506, 2096, 192, 45, 1800, 487, 3290, 2509, 1728, 47, 3720, 524, 730, 2515, 2988,
+   883, 3076, 244, 465, 1070, 2766, 2693, 1238, 2271, 3717, 1244, 831, 3781, 1259, 3531, 3414,
+   2244, 297, 1565, 1742, 2687, 3803, 3479, 3219, 2974, 2743, 3338, 2409, 1578, 2522, 2508, 768,
+   188, 3, 2880, 28, 780, 721, 1075, 3066, 2638, 2663, 3263, 3814, 2339, 3003, 3583, 3834,
+   2639, 3623, 3254, 2374, 2178, 1962, 2557, 1908, 442, 2615, 3308, 889, 1636, 377, 1640, 617,
+   1585, 1142, 2361, 1623, 3197, 1879, 3202, 1954, 2077, 1752, 587, 3385, 1629, 1757, 1787, 3587,
+   2894, 2668, 863, 3676, 809, 1561, 1502, 2756, 293, 1325, 1811, 2947, 2923, 3508, 459, 3410,
+   2004, 352, 140, 750, 2815, 3833, 1679, 3632, 194, 1965, 1837, 1807, 3607, 3194, 2599, 3248,
+   214, 2265, 1557, 1262, 2811, 3593, 1454, 2801, 1193, 1596, 902, 2191, 3642, 2594, 2048, 12,
+   720, 115, 3075, 2884, 268, 725, 1315, 3011, 2938, 2608, 188, 930, 2071, 3192, 679, 3280,
+   109, 1815, 3187, 3079, 3124, 424, 635, 3565, 1854, 2827, 3373, 1809, 1027, 2886, 2188, 762,
+   2635, 3383, 3309, 1849, 1627, 3437, 1824, 127, 3795, 2999, 3343, 3609, 1514, 2576, 68, 255,
+   3825, 1199, 3756, 884, 436, 455, 3170, 2059, 3372, 849, 1036, 726, 2275, 3057, 1198, 2796,
+   893, 1876, 322, 1940, 337, 1040, 66, 1935, 3637, 1394, 2126, 2667, 3503, 3759, 3764, 464,
+   110, 2775, 3233, 1114, 2481, 1173, 1296, 71, 3135, 3784, 539, 3430, 2304, 1054, 4, 240,
+   225, 1125, 1341, 1871, 3622, 2294, 2397, 1758, 2747, 3578, 2634, 2423, 3318, 2389, 1278, 2871,
+   3313, 1189, 1356, 746, 2575, 3608, 554, 2530, 2088, 612, 385, 995, 3046, 2338, 2043, 3592,
+   494, 2810, 2633, 1463, 3341, 1689, 1532, 956, 931, 3031, 3238, 2314, 2403, 3018, 2458, 2493,
+   1893, 1342, 2831, 3613, 1754, 2507, 3408, 84, 315, 3545, 1554, 1982, 2857, 1573, 1322, 2531,
+   3048, 658, 2020, 412, 815, 3721, 1484, 776, 481, 1130, 2541, 1848, 667, 3460, 279, 3185,
+   1159, 3156, 319, 3785, 1499, 3476, 339, 2960, 103, 3255, 3334, 2169, 1647, 3737, 1544, 482,
+   2090, 2532, 408, 575, 3790, 2699, 3398, 2184, 522, 2410, 2538, 2568, 488, 650, 2440, 513,
+   970, 2446, 2673, 1163, 3396, 264, 485, 1370, 2486, 2373, 1218, 1971, 3097, 1504, 176, 210,
+   2025, 1612, 737, 1135, 3741, 1784, 707, 2935, 3328, 9, 1440, 161, 1110, 2241, 1017, 1666,
+   1952, 157, 1770, 2567, 3128, 664, 580, 265, 1445, 1361, 1046, 2226, 2142, 2727, 3278, 2689,
+   998, 2326, 2223, 3762, 2144, 147, 2970, 2503, 3168, 139, 3390, 2829, 1693, 1772, 887, 3316,
+   469, 1310, 2711, 3218, 2014, 2752, 53, 1380, 386, 1955, 3037, 1798, 2167, 3327, 3829, 1439,
+   3701, 1409, 1001, 1606, 2177, 1002, 2566, 2168, 687, 3760, 224, 165, 1350, 2186, 2442, 2433,
+   993, 1126, 2301, 1917, 1882, 2482, 2133, 1287, 3131, 3544, 594, 2005, 1312, 131, 2910, 2728,
+   638, 2845, 1753, 1547, 3362, 2049, 972, 766, 2875, 3553, 1134, 2781, 1793, 967, 3166, 2719,
+   3698, 2129, 1047, 3186, 2119, 3147, 3379, 3069, 1918, 2842, 2473, 1593, 1622, 2237, 1902, 2782,
+   2753, 1013, 1426, 2021, 1372, 806, 2281, 1617, 1037, 1686, 2252, 777, 1441, 1121, 1101, 1701,
+   1352, 506, 2630, 2183, 3162, 2479, 3753, 1604, 257, 965, 1246, 2751, 3818, 2579, 2948, 283,
+   3425, 1104, 81, 1035, 3366, 2289, 1197, 1836, 847, 3616, 134, 2190, 2682, 2603, 3488, 159,
+   3690, 2549, 1428, 341, 1280, 11, 3360, 129, 990, 2746, 2618, 2588, 788, 301, 1805, 1687,
+   3212, 754, 2155, 3507, 3099, 3424, 144, 90, 2475, 3513, 1659, 3557, 1374, 2726, 2318, 2643,
+   2963, 2983, 3283, 2989, 1843, 3067, 3598, 2654, 2723, 3038, 2758, 2213, 1362, 2006, 2272, 177,
+   1170, 2016, 172, 870, 2296, 717, 1735, 3167, 3679, 3689, 1589, 1382, 2306, 1923, 2917, 1348,
+   266, 2405, 1338, 2591, 3668, 329, 1460, 461, 1730, 1967, 3757, 1844, 427, 3515, 3579, 3594,
+   2414, 2778, 2513, 1068, 846, 2656, 143, 3630, 2774, 2273, 1137, 1161, 1476, 296, 605, 1765,
+   1367, 3206, 2194, 2022, 2332, 783, 3601, 1034, 2406, 2298, 2637, 1703, 3272, 529, 1030, 2166,
+   2367, 3783, 3179, 3499, 3519, 3819, 3539, 2994, 2143, 3687, 3269, 1249, 1131, 3501, 1839, 3727,
+   3644, 914, 2011, 3472, 99, 3015, 3178, 2539, 3528, 534, 2230, 2382, 2658, 2063, 3612, 794,
+   2461, 1773, 1847, 3307, 3529, 1494, 2276, 417, 1115, 3441, 1164, 756, 475, 3470, 2679, 3323,
+   3589, 1214, 2856, 613, 1345, 986, 2506, 2448, 93, 1755, 3467, 3399, 3144, 499, 3110, 2284,
+   897, 991, 3706, 2609, 1148, 921, 1531, 3596, 734, 2755, 2933, 1408, 41, 1560, 542, 2710,
+   2258, 2037, 1432, 581, 1225, 1491, 2996, 463, 3650, 1949, 1777, 1187, 3036, 838, 2176, 42,
+   2520, 588, 745, 1615, 3617, 1094, 2181, 1242, 2511, 3648, 29, 1740, 767, 3835, 3599, 3614,
+   2714, 2498, 1968, 217, 1545, 1442, 2081, 1092, 261, 1205, 1416, 521, 1450, 2561, 968, 526,
+   2650, 2483, 3093, 1264, 231, 3285, 1309, 1751, 3227, 3454, 2844, 793, 1501, 1796, 247, 3345,
+   1029, 1206, 2376, 498, 2150, 2307, 2883, 2908, 808, 601, 1525, 1436, 821, 1381, 1346, 1946,
+   2497, 1008, 226, 2085, 1332, 431, 3755, 3524, 294, 2285, 1857, 982, 2266, 2517, 1308, 791,
+   3181, 1819, 3427, 3024, 118, 2355, 3063, 3358, 2709, 1298, 1991, 3172, 379, 3560, 654, 2680,
+   683, 3520, 54, 2340, 363, 3500, 879, 3736, 584, 505, 1670, 2192, 102, 2295, 3357, 1749,
+   1307, 3431, 3264, 49, 1140, 441, 1655, 3317, 1429, 1301, 1271, 3351, 3189, 1399, 3326, 2869,
+   1393, 1166, 2676, 443, 3575, 3354, 2469, 1353, 1466, 2621, 1868, 742, 2335, 3663, 3629, 1814,
+   2227, 3102, 2704, 98, 2055, 3132, 904, 511, 3830, 2399, 3678, 2729, 1598, 2822, 2173, 1887,
+   3682, 2069, 1272, 711, 3175, 3259, 3574, 2394, 2478, 2793, 1613, 1697, 1112, 561, 1150, 2841,
+   1513, 1616, 77, 1695, 3692, 869, 1336, 671, 3700, 449, 1010, 2146, 2067, 2952, 523, 3370,
+   2529, 1128, 621, 1825, 1087, 3786, 2459, 3453, 1884, 802, 2041, 1672, 512, 10, 2400, 138,
+   2430, 2838, 2233, 1662, 2837, 1273, 1671, 3152, 79, 3615, 3674, 2489, 1653, 1397, 1406, 2846,
+   2713, 1538, 1922, 1957, 1357, 1706, 2552, 708, 295, 3245, 1834, 2527, 3708, 929, 1111, 3201,
+   994, 2086, 2292, 477, 1790, 2867, 3073, 964, 286, 2705, 1058, 2046, 2872, 673, 1120, 141,
+   1710, 2792, 653, 1720, 692, 460, 770, 1921, 997, 1366, 2246, 2217, 1602, 1937, 1057, 1086,
+   2826, 2413, 1818, 2467, 3033, 1558, 2222, 2802, 2153, 1587, 3062, 2398, 2718, 2738, 2138, 2487,
+   3333, 1209, 1656, 677, 1360, 86, 2235, 3582, 2874, 2593, 1088, 21, 1260, 891, 3556, 414,
+   2735, 3758, 2804, 473, 1550, 2642, 2003, 2992, 223, 3705, 1649, 1157, 1236, 351, 3680, 149,
+   1290, 2411, 3498, 2559, 3828, 479, 3710, 2849, 1093, 1221, 1251, 3051, 3538, 2034, 2152, 627,
+   3085, 1684, 332, 740, 415, 3695, 3749, 1364, 326, 2180, 282, 2465, 1113, 1521, 1196, 876,
+   856, 556, 850, 1996, 772, 241, 1185, 1116, 801, 1081, 1626, 2477, 1833, 1567, 3662, 2669,
+   1823, 3667, 2969, 1543, 3122, 2104, 672, 160, 150, 2250, 2457, 1533, 1916, 922, 2491, 3573,
+   1434, 2501, 1248, 171, 3510, 2379, 3378, 2109, 1872, 82, 1995, 3412, 324, 260, 245, 1425,
+   1061, 1326, 2771, 2993, 1183, 3696, 209, 1065, 1566, 2702, 2678, 2363, 3543, 3234, 2074, 2472,
+   633, 1645, 1817, 1507, 3056, 238, 2805, 1433, 1541, 1202, 2136, 567, 3310, 2809, 1673, 1472,
+   56, 660, 340, 320, 20, 300, 845, 1696, 152, 570, 2590, 2708, 338, 2000, 112, 195,
+   2925, 1828, 367, 3740, 824, 661, 1300, 311, 3305, 1609, 1457, 1181, 1776, 227, 3045, 1378,
+   2066, 1992, 532, 310, 2345, 1563, 3422, 2724, 398, 2675, 3083, 3364, 369, 1160, 516, 250,
+   2625, 983, 3226, 2494, 2853, 1333, 1391, 3746, 2084, 372, 440, 695, 3340, 729, 1555, 2942,
+   2848, 133, 1230, 2691, 2918, 2308, 243, 3105, 1084, 906, 2431, 3798, 2279, 3297, 1129, 1581,
+   1802, 2407, 3258, 2614, 2348, 843, 3376, 189, 1890, 2062, 2652, 803, 3001, 1663, 3797, 1319,
+   3251, 3094, 2224, 222, 2745, 1658, 2597, 1328, 191, 3810, 2099, 3072, 188, 5, 1200, 216,
+   585, 1465, 1661, 1877, 1282, 1931, 3397, 1224, 531, 2950, 2203, 3462, 2199, 3222, 2254, 2697,
+   1478, 2216, 642, 1960, 637, 1885, 1762, 2087, 3252, 454, 2210, 2082, 2052, 252, 945, 1171,
+   2976, 163, 3030, 2278, 2337, 1083, 3546, 2514, 2028, 892, 916, 331, 3380, 429, 1835, 3487,
+   3699, 3089, 1024, 6, 2160, 207, 3645, 1874, 2002, 2032, 232, 645, 1240, 591, 3625, 1574,
+   2282, 2577, 1028, 246, 2385, 1038, 2646, 2243, 2937, 1648, 197, 1245, 1791, 3827, 3119, 3724,
+   764, 955, 3571, 3114, 2524, 828, 901, 1231, 3651, 2909, 1768, 647, 3160, 559, 3730, 2024,
+   652, 760, 715, 3415, 3204, 274, 1985, 1012, 466, 2030, 2812, 953, 1651, 3077, 1204, 456,
+   530, 1990, 2212, 402, 2015, 3712, 44, 840, 496, 230, 2325, 1263, 3771, 3584, 14, 2640,
+   83, 2955, 3403, 3384, 669, 1780, 467, 2990, 2803, 3113, 1564, 782, 2641, 1043, 2946, 1963,
+   3517, 1899, 3502, 2799, 3773, 1904, 202, 2445, 1713, 1172, 336, 80, 75, 3375, 3729, 1064,
+   606, 2725, 1358, 2666, 2543, 3768, 704, 55, 3300, 409, 1535, 3836, 959, 3811, 3059, 3118,
+   2764, 773, 1201, 1176, 576, 25, 1500, 836, 256, 578, 7, 3120, 184, 690, 2140, 807,
+   3241, 1594, 2582, 2228, 462, 2690, 1958, 2317, 1683, 2972, 823, 3301, 1369, 1526, 2396, 798,
+   2701, 1718, 2372, 258, 1925, 1237, 1311, 3671, 3209, 1474, 1976, 697, 1660, 917, 1291, 3371,
+   3489, 1119, 3681, 1109, 1281, 971, 3406, 2664, 623, 3745, 1124, 381, 1880, 562, 2110, 2832,
+   73, 1455, 3761, 1184, 156, 810, 2521, 1548, 722, 2035, 3112, 604, 805, 1321, 1571, 3002,
+   2623, 3788, 779, 3361, 1089, 981, 1306, 2471, 3273, 1489, 1076, 426, 2555, 3588, 254, 2865,
+   1153, 996, 406, 2255, 3657, 1469, 1901, 1822, 2707, 2978, 2083, 3012, 298, 2525, 1788, 947,
+   3091, 2944, 43, 3480, 579, 2905, 1528, 716, 775, 3121, 1144, 681, 1600, 17, 1020, 946,
+   2131, 2967, 3223, 3214, 2674, 2123, 3387, 3549, 1794, 1927, 3157, 1279, 3831, 3359, 3669, 1289,
+   1451, 3521, 1014, 2386, 1998, 2692, 278, 2225, 1182, 2736, 218, 2505, 1488, 116, 435, 3095,
+   3184, 199, 3165, 1759, 3707, 3569, 1194, 2556, 948, 451, 2930, 2128, 87, 3195, 3559, 3294,
+   2749, 1898, 2542, 2808, 713, 1495, 3236, 394, 2435, 2913, 1108, 321, 980, 346, 2480, 213,
+   1305, 1511, 3296, 169, 1590, 2342, 2283, 3537, 1074, 2106, 2592, 128, 30, 2700, 758, 2395,
+   3438, 2784, 173, 1830, 2287, 3777, 1019, 3586, 1934, 2677, 1403, 3566, 2814, 2873, 1633, 1097,
+   1461, 1421, 1721, 1652, 437, 1415, 3161, 1519, 3776, 59, 3540, 354, 2060, 732, 835, 2896,
+   88, 555, 3490, 2079, 3672, 569, 1630, 2717, 1778, 2147, 3027, 2998, 2383, 3618, 2054, 2172,
+   927, 3691, 3509, 1419, 3401, 1464, 701, 1900, 862, 2716, 818, 2101, 1392, 206, 2685, 1883,
+   3442, 2124, 747, 3535, 3654, 2189, 1722, 2612, 428, 875, 3496, 639, 3805, 1799, 3127, 3304,
+   649, 1480, 536, 550, 2290, 2157, 1827, 3007, 3823, 3779, 2939, 3568, 234, 2565, 1208, 696,
+   700, 940, 871, 3256, 694, 2380, 738, 2095, 3732, 344, 560, 190, 2850, 2053, 1212, 936,
+   631, 3325, 1909, 1402, 2606, 2768, 113, 1155, 2916, 388, 275, 2945, 1003, 3526, 2214, 2322,
+   1983, 3817, 1619, 2957, 1723, 3572, 474, 2510, 2688, 38, 2280, 657, 1060, 366, 2780, 833,
+   976, 106, 2535, 3288, 589, 1705, 1592, 662, 2260, 357, 1340, 911, 3631, 3734, 2264, 597,
+   1285, 1211, 3576, 714, 2455, 3213, 1714, 2132, 327, 3140, 259, 2885, 1228, 771, 2881, 988,
+   826, 2581, 1268, 471, 3230, 2734, 2798, 2813, 1913, 1642, 2537, 1608, 497, 1190, 2316, 723,
+   2995, 3103, 3664, 89, 1515, 3536, 114, 2115, 2907, 3448, 684, 880, 196, 285, 1745, 1067,
+   3486, 2739, 3098, 2464, 153, 1530, 2636, 743, 3295, 3709, 1889, 1102, 2661, 1343, 3791, 3659,
+   3389, 1869, 1702, 2312, 483, 3050, 2578, 1988, 292, 365, 1820, 787, 2941, 1888, 142, 2670,
+   2783, 3713, 1004, 886, 2356, 423, 3275, 3409, 1044, 306, 2105, 1632, 137, 1470, 2861, 1813,
+   1267, 3111, 3244, 874, 2536, 648, 520, 490, 2570, 2408, 618, 2545, 1188, 396, 755, 3115,
+   3484, 819, 3061, 1438, 2741, 1418, 2441, 1473, 1016, 706, 1975, 3337, 1449, 1601, 977, 1066,
+   2526, 2748, 938, 2551, 3348, 309, 1385, 1586, 2102, 2352, 183, 3330, 1929, 1477, 1256, 651,
+   3400, 504, 710, 2215, 3282, 2029, 1852, 907, 3391, 3789, 1739, 3407, 3624, 614, 2305, 963,
+   2926, 2788, 413, 1775, 3767, 3344, 69, 1215, 3816, 659, 2980, 403, 2975, 3703, 3329, 969,
+   1486, 2696, 518, 2170, 2607, 3728, 104, 615, 3265, 1009, 1186, 2076, 792, 541, 1750, 2267,
+   3477, 1299, 2951, 3163, 3439, 3744, 164, 390, 2195, 2982, 2323, 2943, 3808, 179, 3090, 1984,
+   52, 420, 395, 3395, 2904, 568, 670, 2740, 458, 2450, 2013, 1792, 578, 8, 480, 170,
+   2550, 2388, 318, 2825, 1453, 1841, 1147, 3561, 1614, 2657, 1103, 3621, 1334, 2351, 3723, 3404,
+   744, 655, 3640, 674, 2080, 132, 270, 2645, 1283, 2891, 3388, 909, 1711, 3752, 644, 280,
+   545, 1090, 1941, 1297, 1031, 3126, 2344, 603, 3445, 1404, 926, 2731, 3518, 2859, 3493, 1359,
+   3626, 2534, 2328, 543, 3670, 2249, 1497, 1556, 302, 2765, 1733, 1247, 3711, 3809, 1139, 3081,
+   1444, 401, 1055, 3666, 2009, 1552, 62, 2820, 253, 1905, 1162, 2436, 273, 1025, 966, 2206,
+   2742, 2378, 2418, 2118, 2187, 3402, 2424, 678, 2320, 63, 3780, 299, 3485, 1779, 3107, 3004,
+   943, 3751, 3284, 349, 1760, 167, 3270, 2209, 1122, 2061, 1692, 812, 841, 1456, 221, 1785,
+   1667, 2912, 148, 330, 2420, 438, 2375, 3138, 1939, 2977, 1123, 3021, 1738, 2447, 3633, 1154,
+   1956, 397, 1715, 3092, 304, 185, 1650, 2117, 1227, 3411, 2964, 343, 3200, 34, 2040, 712,
+   535, 3190, 2359, 3303, 3289, 1549, 1682, 2012, 832, 16, 60, 900, 271, 3605, 1274, 2631,
+   3143, 3139, 2899, 2968, 583, 3145, 1459, 3101, 1744, 107, 3495, 3279, 3649, 989, 1786, 2627,
+   2903, 3208, 514, 1930, 2437, 1233, 1071, 3726, 2684, 923, 3451, 3564, 894, 2836, 313, 1625,
+   1517, 1856, 22, 2220, 882, 2116, 267, 3365, 1329, 1151, 3801, 1559, 3182, 2779, 3473, 1059,
+   3006, 2863, 3733, 1304, 551, 3250, 2134, 2247, 3177, 1579, 3482, 2499, 2928, 208, 105, 1575,
+   3242, 2554, 2628, 263, 3125, 1384, 626, 2125, 1707, 3512, 699, 3580, 954, 2611, 3068, 958,
+   2851, 3013, 1258, 2571, 3368, 609, 1105, 1041, 1026, 1926, 2197, 1302, 2231, 3342, 2649, 1523,
+   3116, 844, 736, 175, 3750, 2324, 303, 3725, 1724, 932, 391, 3155, 2959, 3643, 3554, 2094,
+   2772, 353, 1100, 741, 1375, 3686, 2309, 1203, 3096, 544, 130, 1950, 2737, 1178, 2496, 48,
+   180, 450, 1970, 2137, 1527, 3356, 789, 1261, 1851, 3547, 3474, 2019, 3052, 898, 1951, 3697,
+   1169, 1056, 126, 2835, 2953, 1483, 3416, 564, 430, 2795, 3533, 1734, 2207, 3702, 2369, 978,
+   2026, 2572, 728, 595, 2965, 1303, 3191, 3319, 3349, 1269, 1431, 3221, 1294, 2651, 3443, 3084,
+   724, 355, 3020, 778, 2401, 1098, 2421, 1398, 2366, 2823, 3133, 1864, 502, 2390, 2238, 2862,
+   2773, 1313, 1091, 2901, 1288, 491, 3530, 2454, 2253, 1737, 1487, 3656, 509, 1910, 2362, 2583,
+   3188, 439, 3335, 3129, 1624, 557, 1810, 1987, 2932, 448, 50, 2100, 432, 215, 3225, 1534,
+   2876, 913, 1051, 3426, 2064, 72, 495, 3770, 2624, 23, 3180, 859, 3436, 864, 136, 510,
+   2870, 2353, 1143, 3321, 1669, 1232, 111, 3735, 3224, 574, 2830, 2653, 1763, 3047, 3298, 2089,
+   1572, 362, 2540, 888, 676, 400, 95, 3675, 3449, 1644, 857, 1516, 896, 31, 3660, 749,
+   1855, 3787, 3419, 3444, 444, 935, 3271, 3169, 1099, 3381, 1389, 1826, 2047, 3832, 719, 3655,
+   3149, 1699, 3032, 598, 2245, 1257, 1611, 3377, 1149, 1881, 1522, 2156, 867, 3016, 538, 2470,
+   2313, 1443, 3041, 1138, 2121, 1467, 3581, 1914, 2602, 2528, 168, 630, 2365, 1863, 3142, 2179,
+   2922, 2548, 468, 350, 2720, 158, 2730, 2558, 2868, 433, 1175, 3216, 94, 2715, 3458, 1959,
+   3277, 1729, 1007, 3766, 2384, 78, 2655, 3683, 3029, 1318, 2291, 3117, 1804, 727, 3235, 3034,
+   2518, 2268, 837, 1216, 51, 3060, 478, 2750, 2858, 2533, 1368, 566, 2350, 2763, 3413, 1284,
+   251, 3585, 974, 2686, 2843, 3433, 1584, 182, 2370, 1938, 2017, 1132, 861, 1756, 827, 3541,
+   1314, 2051, 2892, 748, 895, 3796, 359, 3260, 934, 2311, 3123, 3064, 718, 2695, 3158, 2239,
+   3822, 2819, 2893, 1708, 872, 616, 625, 1165, 1716, 452, 290, 2045, 1912, 682, 2560, 415,
+   15, 3600, 74, 2415, 3738, 2504, 528, 70, 2175, 3807, 3719, 3164, 799, 3661, 1709, 1832,
+   607, 3685, 1349, 1226, 2451, 2973, 1783, 3347, 2949, 1243, 3471, 3639, 3314, 2149, 1347, 2906,
+   2488, 693, 1420, 761, 1675, 3392, 24, 540, 790, 2221, 1842, 2107, 3552, 174, 2790, 2333,
+   1743, 3647, 3794, 2039, 3352, 549, 1330, 2111, 3792, 119, 3315, 3109, 1324, 851, 2956, 763,
+   3595, 3374, 2769, 1073, 1146, 2601, 1568, 122, 2595, 3008, 58, 2580, 308, 425, 1595, 3542,
+   2274, 2097, 1152, 36, 360, 620, 865, 1096, 501, 1430, 2261, 1317, 1331, 3071, 3838, 2879,
+   3793, 1079, 3306, 2569, 1448, 641, 1000, 646, 2200, 582, 2185, 1482, 2456, 573, 1870, 2662,
+   2303, 3837, 1919, 3802, 2519, 3228, 814, 2761, 1493, 1316, 371, 3080, 484, 410, 2495, 3813,
+   1379, 3026, 2038, 2392, 558, 2770, 2033, 1192, 636, 925, 1771, 3527, 3174, 2299, 3597, 1694,
+   2732, 878, 2776, 593, 1045, 1266, 2151, 3267, 2929, 1168, 96, 135, 3150, 2659, 3023, 3658,
+   2429, 1878, 2242, 1977, 1657, 1637, 1337, 1631, 3677, 1769, 1607, 3137, 979, 2986, 2563, 2888,
+   508, 950, 2371, 2898, 2008, 592, 85, 1275, 3591, 3134, 2824, 493, 1850, 2587, 3428, 384,
+   35, 3000, 703, 3820, 899, 2911, 3688, 629, 1405, 1886, 2722, 2078, 2712, 578, 1945, 1537,
+   962, 1966, 2797, 1853, 1867, 3382, 2349, 1803, 3367, 3249, 1174, 2256, 117, 1395, 3086, 2644,
+   323, 2900, 328, 500, 470, 2270, 2757, 1253, 1371, 3446, 2364, 903, 3151, 3619, 3014, 2218,
+   2562, 1928, 517, 1210, 2616, 668, 820, 421, 1355, 3386, 2589, 1748, 347, 3440, 204, 765,
+   1915, 3562, 2574, 2648, 563, 3070, 2878, 2833, 1033, 1446, 2321, 1023, 3826, 2159, 3747, 3044,
+   418, 2075, 3432, 624, 205, 1725, 1892, 382, 2840, 553, 1570, 2042, 2632, 503, 3350, 2229,
+   1422, 2681, 1643, 3497, 1599, 3782, 2219, 3522, 1974, 2377, 1458, 2141, 1767, 3287, 3229, 1774,
+   2807, 3353, 1509, 1376, 146, 2010, 2512, 108, 855, 3196, 919, 3211, 3394, 1944, 577, 985,
+   1546, 2402, 2058, 2412, 858, 2476, 873, 1576, 602, 2485, 1413, 1241, 1551, 3602, 1994, 2452,
+   333, 1700, 392, 515, 2890, 2428, 918, 2251, 3417, 1524, 476, 830, 2821, 1213, 1896, 622,
+   2785, 1133, 1821, 1747, 2987, 3523, 2934, 2368, 18, 1980, 937, 1591, 3302, 2329, 1503, 3716,
+   284, 785, 1021, 1906, 2122, 2427, 3558, 2334, 2703, 3638, 2354, 2103, 3312, 229, 1365, 1286,
+   2171, 3567, 3774, 2864, 193, 1005, 1846, 2347, 3483, 3459, 2919, 3268, 289, 1085, 1866, 2422,
+   2358, 2343, 3243, 3514, 2619, 3548, 834, 1936, 97, 1095, 3141, 1219, 2931, 3088, 64, 186,
+   27, 3420, 804, 361, 1580, 842, 2416, 198, 2205, 1782, 2387, 2958, 2683, 3563, 3534, 2694,
+   2198, 2262, 2277, 1377, 1106, 2001, 1072, 186, 2610, 2108, 912, 91, 3435, 3504, 219, 3465,
+   1479, 3176, 619, 3505, 1179, 3456, 39, 3240, 634, 2605, 1808, 67, 2895, 3628, 854, 2236,
+   942, 2791, 3293, 1789, 1907, 3082, 2404, 378, 2600, 608, 145, 1050, 2466, 2073, 1512, 656,
+   100, 375, 3320, 709, 1255, 3291, 3469, 1719, 3332, 249, 1665, 992, 166, 2310, 2163, 3087,
+   3604, 314, 2585, 1508, 416, 155, 3450, 2604, 848, 76, 735, 3715, 2924, 868, 376, 680,
+   640, 40, 600, 565, 1390, 2786, 2093, 1812, 307, 3065, 1678, 2672, 203, 3405, 1704, 632,
+   685, 1840, 187, 3570, 2154, 2547, 3108, 364, 860, 796, 781, 1681, 1052, 786, 1981, 1897,
+   1582, 2762, 2453, 1293, 1691, 3452, 924, 811, 3481, 1539, 2882, 1948, 817, 1141, 1401, 1646,
+   2777, 1553, 1022, 2866, 2113, 987, 3466, 2439, 3153, 1039, 3606, 2234, 2622, 2828, 733, 1795,
+   2887, 3148, 739, 3055, 3778, 1979, 3577, 1674, 2432, 33, 1080, 666, 2500, 288, 125, 1875,
+   2962, 2023, 3292, 829, 1861, 1222, 2211, 3042, 2098, 2112, 186, 61, 1860, 262, 2165, 1407,
+   3806, 2759, 3173, 1339, 3551, 3714, 1964, 877, 1816, 547, 3010, 1978, 2617, 1628, 797, 1741,
+   1727, 3812, 419, 3035, 3478, 2259, 2997, 1423, 3641, 1634, 2057, 1452, 881, 1156, 276, 305,
+   1145, 1641, 1577, 1562, 2462, 2733, 1838, 2767, 3653, 1229, 1731, 2927, 3748, 404, 335, 3620,
+   374, 2360, 663, 3220, 334, 2660, 383, 3800, 599, 3205, 1234, 2031, 3772, 944, 211, 2985,
+   1603, 2897, 1048, 546, 2050, 1932, 757, 1435, 3461, 1239, 3231, 3694, 2789, 1373, 1766, 2327,
+   3183, 3739, 3464, 519, 3130, 2584, 548, 370, 2120, 507, 3590, 2174, 2847, 3673, 1529, 1676,
+   752, 235, 3525, 1254, 2331, 3423, 3684, 389, 1235, 2991, 3763, 3104, 124, 915, 2971, 3463,
+   3159, 3199, 3799, 3239, 3274, 2449, 1053, 1746, 2027, 3532, 774, 2161, 1167, 3636, 434, 2135,
+   3207, 3154, 1999, 3652, 269, 1685, 1292, 731, 3475, 2979, 3043, 3058, 2158, 2787, 3053, 1858,
+   1942, 2257, 1077, 1386, 2546, 2148, 387, 2915, 3028, 358, 2300, 957, 1891, 3022, 2698, 2438,
+   2193, 1062, 2286, 2817, 973, 1726, 2852, 373, 1400, 686, 2800, 233, 1605, 1217, 1011, 3106,
+   2044, 952, 691, 3100, 784, 7, 121, 1635, 3017, 1498, 2516, 348, 800, 28, 212, 345,
+   1520, 236, 885, 1396, 446, 2855, 3253, 1414, 2201, 1542, 2162, 2127, 3627, 3494, 2319, 3603,
+   2954, 2443, 3393, 984, 586, 2425, 1638, 2297, 1677, 1712, 6, 228, 405, 1295, 3611, 3434,
+   2544, 7, 822, 2341, 1323, 3491, 3039, 3718, 2204, 2, 1118, 2721
+};
+
+
+/**    
+* \par    
+* Bit reversal tables of the fixed-point arm_cfft_q15() and arm_cfft_q31(): pairs of byte    
+* offsets of the complex q31 values to swap, (8*i, 8*bitrev(i)) for i < bitrev(i).    
+* arm_bitreversal_16() halves them for the complex q15 values.    
+*/
+
+const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH] = 
+{
+   //radix 4, size 12
+   8,64, 16,32, 24,96, 40,80, 56,112, 88,104
+};
+
+const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH] = 
+{
+   //radix 4x2, size 24
+   8,128, 16,64, 24,192, 40,160, 48,96, 56,224, 72,144, 88,208,
+   104,176, 120,240, 152,200, 184,232
+};
+
+const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH] = 
+{
+   //radix 4, size 56
+   8,256, 16,128, 24,384, 32,64, 40,320, 48,192, 56,448, 72,288,
+   80,160, 88,416, 104,352, 112,224, 120,480, 136,272, 152,400, 168,336,
+   176,208, 184,464, 200,304, 216,432, 232,368, 248,496, 280,392, 296,328,
+   312,456, 344,424, 376,488, 440,472
+};
+
+const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH] = 
+{
+   //radix 4x2, size 112
+   8,512, 16,256, 24,768, 32,128, 40,640, 48,384, 56,896, 72,576,
+   80,320, 88,832, 96,192, 104,704, 112,448, 120,960, 136,544, 144,288,
+   152,800, 168,672, 176,416, 184,928, 200,608, 208,352, 216,864, 232,736,
+   240,480, 248,992, 264,528, 280,784, 296,656, 304,400, 312,912, 328,592,
+   344,848, 360,720, 368,464, 376,976, 392,560, 408,816, 424,688, 440,944,
+   456,624, 472,880, 488,752, 504,1008, 536,776, 552,648, 568,904, 600,840,
+   616,712, 632,968, 664,808, 696,936, 728,872, 760,1000, 824,920, 888,984
+};
+
+const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH] = 
+{
+   //radix 4, size 240
+   8,1024, 16,512, 24,1536, 32,256, 40,1280, 48,768, 56,1792, 64,128,
+   72,1152, 80,640, 88,1664, 96,384, 104,1408, 112,896, 120,1920, 136,1088,
+   144,576, 152,1600, 160,320, 168,1344, 176,832, 184,1856, 200,1216, 208,704,
+   216,1728, 224,448, 232,1472, 240,960, 248,1984, 264,1056, 272,544, 280,1568,
+   296,1312, 304,800, 312,1824, 328,1184, 336,672, 344,1696, 352,416, 360,1440,
+   368,928, 376,1952, 392,1120, 400,608, 408,1632, 424,1376, 432,864, 440,1888,
+   456,1248, 464,736, 472,1760, 488,1504, 496,992, 504,2016, 520,1040, 536,1552,
+   552,1296, 560,784, 568,1808, 584,1168, 592,656, 600,1680, 616,1424, 624,912,
+   632,1936, 648,1104, 664,1616, 680,1360, 688,848, 696,1872, 712,1232, 728,1744,
+   744,1488, 752,976, 760,2000, 776,1072, 792,1584, 808,1328, 824,1840, 840,1200,
+   856,1712, 872,1456, 880,944, 888,1968, 904,1136, 920,1648, 936,1392, 952,1904,
+   968,1264, 984,1776, 1000,1520, 1016,2032, 1048,1544, 1064,1288, 1080,1800, 1096,1160,
+   1112,1672, 1128,1416, 1144,1928, 1176,1608, 1192,1352, 1208,1864, 1240,1736, 1256,1480,
+   1272,1992, 1304,1576, 1336,1832, 1368,1704, 1384,1448, 1400,1960, 1432,1640, 1464,1896,
+   1496,1768, 1528,2024, 1592,1816, 1624,1688, 1656,1944, 1720,1880, 1784,2008, 1912,1976
+};
+
+const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH] = 
+{
+   //radix 4x2, size 480
+   8,2048, 16,1024, 24,3072, 32,512, 40,2560, 48,1536, 56,3584, 64,256,
+   72,2304, 80,1280, 88,3328, 96,768, 104,2816, 112,1792, 120,3840, 136,2176,
+   144,1152, 152,3200, 160,640, 168,2688, 176,1664, 184,3712, 192,384, 200,2432,
+   208,1408, 216,3456, 224,896, 232,2944, 240,1920, 248,3968, 264,2112, 272,1088,
+   280,3136, 288,576, 296,2624, 304,1600, 312,3648, 328,2368, 336,1344, 344,3392,
+   352,832, 360,2880, 368,1856, 376,3904, 392,2240, 400,1216, 408,3264, 416,704,
+   424,2752, 432,1728, 440,3776, 456,2496, 464,1472, 472,3520, 480,960, 488,3008,
+   496,1984, 504,4032, 520,2080, 528,1056, 536,3104, 552,2592, 560,1568, 568,3616,
+   584,2336, 592,1312, 600,3360, 608,800, 616,2848, 624,1824, 632,3872, 648,2208,
+   656,1184, 664,3232, 680,2720, 688,1696, 696,3744, 712,2464, 720,1440, 728,3488,
+   736,928, 744,2976, 752,1952, 760,4000, 776,2144, 784,1120, 792,3168, 808,2656,
+   816,1632, 824,3680, 840,2400, 848,1376, 856,3424, 872,2912, 880,1888, 888,3936,
+   904,2272, 912,1248, 920,3296, 936,2784, 944,1760, 952,3808, 968,2528, 976,1504,
+   984,3552, 1000,3040, 1008,2016, 1016,4064, 1032,2064, 1048,3088, 1064,2576, 1072,1552,
+   1080,3600, 1096,2320, 1104,1296, 1112,3344, 1128,2832, 1136,1808, 1144,3856, 1160,2192,
+   1176,3216, 1192,2704, 1200,1680, 1208,3728, 1224,2448, 1232,1424, 1240,3472, 1256,2960,
+   1264,1936, 1272,3984, 1288,2128, 1304,3152, 1320,2640, 1328,1616, 1336,3664, 1352,2384,
+   1368,3408, 1384,2896, 1392,1872, 1400,3920, 1416,2256, 1432,3280, 1448,2768, 1456,1744,
+   1464,3792, 1480,2512, 1496,3536, 1512,3024, 1520,2000, 1528,4048, 1544,2096, 1560,3120,
+   1576,2608, 1592,3632, 1608,2352, 1624,3376, 1640,2864, 1648,1840, 1656,3888, 1672,2224,
+   1688,3248, 1704,2736, 1720,3760, 1736,2480, 1752,3504, 1768,2992, 1776,1968, 1784,4016,
+   1800,2160, 1816,3184, 1832,2672, 1848,3696, 1864,2416, 1880,3440, 1896,2928, 1912,3952,
+   1928,2288, 1944,3312, 1960,2800, 1976,3824, 1992,2544, 2008,3568, 2024,3056, 2040,4080,
+   2072,3080, 2088,2568, 2104,3592, 2120,2312, 2136,3336, 2152,2824, 2168,3848, 2200,3208,
+   2216,2696, 2232,3720, 2248,2440, 2264,3464, 2280,2952, 2296,3976, 2328,3144, 2344,2632,
+   2360,3656, 2392,3400, 2408,2888, 2424,3912, 2456,3272, 2472,2760, 2488,3784, 2520,3528,
+   2536,3016, 2552,4040, 2584,3112, 2616,3624, 2648,3368, 2664,2856, 2680,3880, 2712,3240,
+   2744,3752, 2776,3496, 2792,2984, 2808,4008, 2840,3176, 2872,3688, 2904,3432, 2936,3944,
+   2968,3304, 3000,3816, 3032,3560, 3064,4072, 3128,3608, 3160,3352, 3192,3864, 3256,3736,
+   3288,3480, 3320,3992, 3384,3672, 3448,3928, 3512,3800, 3576,4056, 3704,3896, 3832,4024
+};
+
+const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] = 
+{
+   //radix 4, size 992
+   8,4096, 16,2048, 24,6144, 32,1024, 40,5120, 48,3072, 56,7168, 64,512,
+   72,4608, 80,2560, 88,6656, 96,1536, 104,5632, 112,3584, 120,7680, 128,256,
+   136,4352, 144,2304, 152,6400, 160,1280, 168,5376, 176,3328, 184,7424, 192,768,
+   200,4864, 208,2816, 216,6912, 224,1792, 232,5888, 240,3840, 248,7936, 264,4224,
+   272,2176, 280,6272, 288,1152, 296,5248, 304,3200, 312,7296, 320,640, 328,4736,
+   336,2688, 344,6784, 352,1664, 360,5760, 368,3712, 376,7808, 392,4480, 400,2432,
+   408,6528, 416,1408, 424,5504, 432,3456, 440,7552, 448,896, 456,4992, 464,2944,
+   472,7040, 480,1920, 488,6016, 496,3968, 504,8064, 520,4160, 528,2112, 536,6208,
+   544,1088, 552,5184, 560,3136, 568,7232, 584,4672, 592,2624, 600,6720, 608,1600,
+   616,5696, 624,3648, 632,7744, 648,4416, 656,2368, 664,6464, 672,1344, 680,5440,
+   688,3392, 696,7488, 704,832, 712,4928, 720,2880, 728,6976, 736,1856, 744,5952,
+   752,3904, 760,8000, 776,4288, 784,2240, 792,6336, 800,1216, 808,5312, 816,3264,
+   824,7360, 840,4800, 848,2752, 856,6848, 864,1728, 872,5824, 880,3776, 888,7872,
+   904,4544, 912,2496, 920,6592, 928,1472, 936,5568, 944,3520, 952,7616, 968,5056,
+   976,3008, 984,7104, 992,1984, 1000,6080, 1008,4032, 1016,8128, 1032,4128, 1040,2080,
+   1048,6176, 1064,5152, 1072,3104, 1080,7200, 1096,4640, 1104,2592, 1112,6688, 1120,1568,
+   1128,5664, 1136,3616, 1144,7712, 1160,4384, 1168,2336, 1176,6432, 1184,1312, 1192,5408,
+   1200,3360, 1208,7456, 1224,4896, 1232,2848, 1240,6944, 1248,1824, 1256,5920, 1264,3872,
+   1272,7968, 1288,4256, 1296,2208, 1304,6304, 1320,5280, 1328,3232, 1336,7328, 1352,4768,
+   1360,2720, 1368,6816, 1376,1696, 1384,5792, 1392,3744, 1400,7840, 1416,4512, 1424,2464,
+   1432,6560, 1448,5536, 1456,3488, 1464,7584, 1480,5024, 1488,2976, 1496,7072, 1504,1952,
+   1512,6048, 1520,4000, 1528,8096, 1544,4192, 1552,2144, 1560,6240, 1576,5216, 1584,3168,
+   1592,7264, 1608,4704, 1616,2656, 1624,6752, 1640,5728, 1648,3680, 1656,7776, 1672,4448,
+   1680,2400, 1688,6496, 1704,5472, 1712,3424, 1720,7520, 1736,4960, 1744,2912, 1752,7008,
+   1760,1888, 1768,5984, 1776,3936, 1784,8032, 1800,4320, 1808,2272, 1816,6368, 1832,5344,
+   1840,3296, 1848,7392, 1864,4832, 1872,2784, 1880,6880, 1896,5856, 1904,3808, 1912,7904,
+   1928,4576, 1936,2528, 1944,6624, 1960,5600, 1968,3552, 1976,7648, 1992,5088, 2000,3040,
+   2008,7136, 2024,6112, 2032,4064, 2040,8160, 2056,4112, 2072,6160, 2088,5136, 2096,3088,
+   2104,7184, 2120,4624, 2128,2576, 2136,6672, 2152,5648, 2160,3600, 2168,7696, 2184,4368,
+   2192,2320, 2200,6416, 2216,5392, 2224,3344, 2232,7440, 2248,4880, 2256,2832, 2264,6928,
+   2280,5904, 2288,3856, 2296,7952, 2312,4240, 2328,6288, 2344,5264, 2352,3216, 2360,7312,
+   2376,4752, 2384,2704, 2392,6800, 2408,5776, 2416,3728, 2424,7824, 2440,4496, 2456,6544,
+   2472,5520, 2480,3472, 2488,7568, 2504,5008, 2512,2960, 2520,7056, 2536,6032, 2544,3984,
+   2552,8080, 2568,4176, 2584,6224, 2600,5200, 2608,3152, 2616,7248, 2632,4688, 2648,6736,
+   2664,5712, 2672,3664, 2680,7760, 2696,4432, 2712,6480, 2728,5456, 2736,3408, 2744,7504,
+   2760,4944, 2768,2896, 2776,6992, 2792,5968, 2800,3920, 2808,8016, 2824,4304, 2840,6352,
+   2856,5328, 2864,3280, 2872,7376, 2888,4816, 2904,6864, 2920,5840, 2928,3792, 2936,7888,
+   2952,4560, 2968,6608, 2984,5584, 2992,3536, 3000,7632, 3016,5072, 3032,7120, 3048,6096,
+   3056,4048, 3064,8144, 3080,4144, 3096,6192, 3112,5168, 3128,7216, 3144,4656, 3160,6704,
+   3176,5680, 3184,3632, 3192,7728, 3208,4400, 3224,6448, 3240,5424, 3248,3376, 3256,7472,
+   3272,4912, 3288,6960, 3304,5936, 3312,3888, 3320,7984, 3336,4272, 3352,6320, 3368,5296,
+   3384,7344, 3400,4784, 3416,6832, 3432,5808, 3440,3760, 3448,7856, 3464,4528, 3480,6576,
+   3496,5552, 3512,7600, 3528,5040, 3544,7088, 3560,6064, 3568,4016, 3576,8112, 3592,4208,
+   3608,6256, 3624,5232, 3640,7280, 3656,4720, 3672,6768, 3688,5744, 3704,7792, 3720,4464,
+   3736,6512, 3752,5488, 3768,7536, 3784,4976, 3800,7024, 3816,6000, 3824,3952, 3832,8048,
+   3848,4336, 3864,6384, 3880,5360, 3896,7408, 3912,4848, 3928,6896, 3944,5872, 3960,7920,
+   3976,4592, 3992,6640, 4008,5616, 4024,7664, 4040,5104, 4056,7152, 4072,6128, 4088,8176,
+   4120,6152, 4136,5128, 4152,7176, 4168,4616, 4184,6664, 4200,5640, 4216,7688, 4232,4360,
+   4248,6408, 4264,5384, 4280,7432, 4296,4872, 4312,6920, 4328,5896, 4344,7944, 4376,6280,
+   4392,5256, 4408,7304, 4424,4744, 4440,6792, 4456,5768, 4472,7816, 4504,6536, 4520,5512,
+   4536,7560, 4552,5000, 4568,7048, 4584,6024, 4600,8072, 4632,6216, 4648,5192, 4664,7240,
+   4696,6728, 4712,5704, 4728,7752, 4760,6472, 4776,5448, 4792,7496, 4808,4936, 4824,6984,
+   4840,5960, 4856,8008, 4888,6344, 4904,5320, 4920,7368, 4952,6856, 4968,5832, 4984,7880,
+   5016,6600, 5032,5576, 5048,7624, 5080,7112, 5096,6088, 5112,8136, 5144,6184, 5176,7208,
+   5208,6696, 5224,5672, 5240,7720, 5272,6440, 5288,5416, 5304,7464, 5336,6952, 5352,5928,
+   5368,7976, 5400,6312, 5432,7336, 5464,6824, 5480,5800, 5496,7848, 5528,6568, 5560,7592,
+   5592,7080, 5608,6056, 5624,8104, 5656,6248, 5688,7272, 5720,6760, 5752,7784, 5784,6504,
+   5816,7528, 5848,7016, 5864,5992, 5880,8040, 5912,6376, 5944,7400, 5976,6888, 6008,7912,
+   6040,6632, 6072,7656, 6104,7144, 6136,8168, 6200,7192, 6232,6680, 6264,7704, 6296,6424,
+   6328,7448, 6360,6936, 6392,7960, 6456,7320, 6488,6808, 6520,7832, 6584,7576, 6616,7064,
+   6648,8088, 6712,7256, 6776,7768, 6840,7512, 6872,7000, 6904,8024, 6968,7384, 7032,7896,
+   7096,7640, 7160,8152, 7288,7736, 7352,7480, 7416,7992, 7544,7864, 7672,8120, 7928,8056
+};
+
+const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] = 
+{
+   //radix 4x2, size 1984
+   8,8192, 16,4096, 24,12288, 32,2048, 40,10240, 48,6144, 56,14336, 64,1024,
+   72,9216, 80,5120, 88,13312, 96,3072, 104,11264, 112,7168, 120,15360, 128,512,
+   136,8704, 144,4608, 152,12800, 160,2560, 168,10752, 176,6656, 184,14848, 192,1536,
+   200,9728, 208,5632, 216,13824, 224,3584, 232,11776, 240,7680, 248,15872, 264,8448,
+   272,4352, 280,12544, 288,2304, 296,10496, 304,6400, 312,14592, 320,1280, 328,9472,
+   336,5376, 344,13568, 352,3328, 360,11520, 368,7424, 376,15616, 384,768, 392,8960,
+   400,4864, 408,13056, 416,2816, 424,11008, 432,6912, 440,15104, 448,1792, 456,9984,
+   464,5888, 472,14080, 480,3840, 488,12032, 496,7936, 504,16128, 520,8320, 528,4224,
+   536,12416, 544,2176, 552,10368, 560,6272, 568,14464, 576,1152, 584,9344, 592,5248,
+   600,13440, 608,3200, 616,11392, 624,7296, 632,15488, 648,8832, 656,4736, 664,12928,
+   672,2688, 680,10880, 688,6784, 696,14976, 704,1664, 712,9856, 720,5760, 728,13952,
+   736,3712, 744,11904, 752,7808, 760,16000, 776,8576, 784,4480, 792,12672, 800,2432,
+   808,10624, 816,6528, 824,14720, 832,1408, 840,9600, 848,5504, 856,13696, 864,3456,
+   872,11648, 880,7552, 888,15744, 904,9088, 912,4992, 920,13184, 928,2944, 936,11136,
+   944,7040, 952,15232, 960,1920, 968,10112, 976,6016, 984,14208, 992,3968, 1000,12160,
+   1008,8064, 1016,16256, 1032,8256, 1040,4160, 1048,12352, 1056,2112, 1064,10304, 1072,6208,
+   1080,14400, 1096,9280, 1104,5184, 1112,13376, 1120,3136, 1128,11328, 1136,7232, 1144,15424,
+   1160,8768, 1168,4672, 1176,12864, 1184,2624, 1192,10816, 1200,6720, 1208,14912, 1216,1600,
+   1224,9792, 1232,5696, 1240,13888, 1248,3648, 1256,11840, 1264,7744, 1272,15936, 1288,8512,
+   1296,4416, 1304,12608, 1312,2368, 1320,10560, 1328,6464, 1336,14656, 1352,9536, 1360,5440,
+   1368,13632, 1376,3392, 1384,11584, 1392,7488, 1400,15680, 1416,9024, 1424,4928, 1432,13120,
+   1440,2880, 1448,11072, 1456,6976, 1464,15168, 1472,1856, 1480,10048, 1488,5952, 1496,14144,
+   1504,3904, 1512,12096, 1520,8000, 1528,16192, 1544,8384, 1552,4288, 1560,12480, 1568,2240,
+   1576,10432, 1584,6336, 1592,14528, 1608,9408, 1616,5312, 1624,13504, 1632,3264, 1640,11456,
+   1648,7360, 1656,15552, 1672,8896, 1680,4800, 1688,12992, 1696,2752, 1704,10944, 1712,6848,
+   1720,15040, 1736,9920, 1744,5824, 1752,14016, 1760,3776, 1768,11968, 1776,7872, 1784,16064,
+   1800,8640, 1808,4544, 1816,12736, 1824,2496, 1832,10688, 1840,6592, 1848,14784, 1864,9664,
+   1872,5568, 1880,13760, 1888,3520, 1896,11712, 1904,7616, 1912,15808, 1928,9152, 1936,5056,
+   1944,13248, 1952,3008, 1960,11200, 1968,7104, 1976,15296, 1992,10176, 2000,6080, 2008,14272,
+   2016,4032, 2024,12224, 2032,8128, 2040,16320, 2056,8224, 2064,4128, 2072,12320, 2088,10272,
+   2096,6176, 2104,14368, 2120,9248, 2128,5152, 2136,13344, 2144,3104, 2152,11296, 2160,7200,
+   2168,15392, 2184,8736, 2192,4640, 2200,12832, 2208,2592, 2216,10784, 2224,6688, 2232,14880,
+   2248,9760, 2256,5664, 2264,13856, 2272,3616, 2280,11808, 2288,7712, 2296,15904, 2312,8480,
+   2320,4384, 2328,12576, 2344,10528, 2352,6432, 2360,14624, 2376,9504, 2384,5408, 2392,13600,
+   2400,3360, 2408,11552, 2416,7456, 2424,15648, 2440,8992, 2448,4896, 2456,13088, 2464,2848,
+   2472,11040, 2480,6944, 2488,15136, 2504,10016, 2512,5920, 2520,14112, 2528,3872, 2536,12064,
+   2544,7968, 2552,16160, 2568,8352, 2576,4256, 2584,12448, 2600,10400, 2608,6304, 2616,14496,
+   2632,9376, 2640,5280, 2648,13472, 2656,3232, 2664,11424, 2672,7328, 2680,15520, 2696,8864,
+   2704,4768, 2712,12960, 2728,10912, 2736,6816, 2744,15008, 2760,9888, 2768,5792, 2776,13984,
+   2784,3744, 2792,11936, 2800,7840, 2808,16032, 2824,8608, 2832,4512, 2840,12704, 2856,10656,
+   2864,6560, 2872,14752, 2888,9632, 2896,5536, 2904,13728, 2912,3488, 2920,11680, 2928,7584,
+   2936,15776, 2952,9120, 2960,5024, 2968,13216, 2984,11168, 2992,7072, 3000,15264, 3016,10144,
+   3024,6048, 3032,14240, 3040,4000, 3048,12192, 3056,8096, 3064,16288, 3080,8288, 3088,4192,
+   3096,12384, 3112,10336, 3120,6240, 3128,14432, 3144,9312, 3152,5216, 3160,13408, 3176,11360,
+   3184,7264, 3192,15456, 3208,8800, 3216,4704, 3224,12896, 3240,10848, 3248,6752, 3256,14944,
+   3272,9824, 3280,5728, 3288,13920, 3296,3680, 3304,11872, 3312,7776, 3320,15968, 3336,8544,
+   3344,4448, 3352,12640, 3368,10592, 3376,6496, 3384,14688, 3400,9568, 3408,5472, 3416,13664,
+   3432,11616, 3440,7520, 3448,15712, 3464,9056, 3472,4960, 3480,13152, 3496,11104, 3504,7008,
+   3512,15200, 3528,10080, 3536,5984, 3544,14176, 3552,3936, 3560,12128, 3568,8032, 3576,16224,
+   3592,8416, 3600,4320, 3608,12512, 3624,10464, 3632,6368, 3640,14560, 3656,9440, 3664,5344,
+   3672,13536, 3688,11488, 3696,7392, 3704,15584, 3720,8928, 3728,4832, 3736,13024, 3752,10976,
+   3760,6880, 3768,15072, 3784,9952, 3792,5856, 3800,14048, 3816,12000, 3824,7904, 3832,16096,
+   3848,8672, 3856,4576, 3864,12768, 3880,10720, 3888,6624, 3896,14816, 3912,9696, 3920,5600,
+   3928,13792, 3944,11744, 3952,7648, 3960,15840, 3976,9184, 3984,5088, 3992,13280, 4008,11232,
+   4016,7136, 4024,15328, 4040,10208, 4048,6112, 4056,14304, 4072,12256, 4080,8160, 4088,16352,
+   4104,8208, 4120,12304, 4136,10256, 4144,6160, 4152,14352, 4168,9232, 4176,5136, 4184,13328,
+   4200,11280, 4208,7184, 4216,15376, 4232,8720, 4240,4624, 4248,12816, 4264,10768, 4272,6672,
+   4280,14864, 4296,9744, 4304,5648, 4312,13840, 4328,11792, 4336,7696, 4344,15888, 4360,8464,
+   4376,12560, 4392,10512, 4400,6416, 4408,14608, 4424,9488, 4432,5392, 4440,13584, 4456,11536,
+   4464,7440, 4472,15632, 4488,8976, 4496,4880, 4504,13072, 4520,11024, 4528,6928, 4536,15120,
+   4552,10000, 4560,5904, 4568,14096, 4584,12048, 4592,7952, 4600,16144, 4616,8336, 4632,12432,
+   4648,10384, 4656,6288, 4664,14480, 4680,9360, 4688,5264, 4696,13456, 4712,11408, 4720,7312,
+   4728,15504, 4744,8848, 4760,12944, 4776,10896, 4784,6800, 4792,14992, 4808,9872, 4816,5776,
+   4824,13968, 4840,11920, 4848,7824, 4856,16016, 4872,8592, 4888,12688, 4904,10640, 4912,6544,
+   4920,14736, 4936,9616, 4944,5520, 4952,13712, 4968,11664, 4976,7568, 4984,15760, 5000,9104,
+   5016,13200, 5032,11152, 5040,7056, 5048,15248, 5064,10128, 5072,6032, 5080,14224, 5096,12176,
+   5104,8080, 5112,16272, 5128,8272, 5144,12368, 5160,10320, 5168,6224, 5176,14416, 5192,9296,
+   5208,13392, 5224,11344, 5232,7248, 5240,15440, 5256,8784, 5272,12880, 5288,10832, 5296,6736,
+   5304,14928, 5320,9808, 5328,5712, 5336,13904, 5352,11856, 5360,7760, 5368,15952, 5384,8528,
+   5400,12624, 5416,10576, 5424,6480, 5432,14672, 5448,9552, 5464,13648, 5480,11600, 5488,7504,
+   5496,15696, 5512,9040, 5528,13136, 5544,11088, 5552,6992, 5560,15184, 5576,10064, 5584,5968,
+   5592,14160, 5608,12112, 5616,8016, 5624,16208, 5640,8400, 5656,12496, 5672,10448, 5680,6352,
+   5688,14544, 5704,9424, 5720,13520, 5736,11472, 5744,7376, 5752,15568, 5768,8912, 5784,13008,
+   5800,10960, 5808,6864, 5816,15056, 5832,9936, 5848,14032, 5864,11984, 5872,7888, 5880,16080,
+   5896,8656, 5912,12752, 5928,10704, 5936,6608, 5944,14800, 5960,9680, 5976,13776, 5992,11728,
+   6000,7632, 6008,15824, 6024,9168, 6040,13264, 6056,11216, 6064,7120, 6072,15312, 6088,10192,
+   6104,14288, 6120,12240, 6128,8144, 6136,16336, 6152,8240, 6168,12336, 6184,10288, 6200,14384,
+   6216,9264, 6232,13360, 6248,11312, 6256,7216, 6264,15408, 6280,8752, 6296,12848, 6312,10800,
+   6320,6704, 6328,14896, 6344,9776, 6360,13872, 6376,11824, 6384,7728, 6392,15920, 6408,8496,
+   6424,12592, 6440,10544, 6456,14640, 6472,9520, 6488,13616, 6504,11568, 6512,7472, 6520,15664,
+   6536,9008, 6552,13104, 6568,11056, 6576,6960, 6584,15152, 6600,10032, 6616,14128, 6632,12080,
+   6640,7984, 6648,16176, 6664,8368, 6680,12464, 6696,10416, 6712,14512, 6728,9392, 6744,13488,
+   6760,11440, 6768,7344, 6776,15536, 6792,8880, 6808,12976, 6824,10928, 6840,15024, 6856,9904,
+   6872,14000, 6888,11952, 6896,7856, 6904,16048, 6920,8624, 6936,12720, 6952,10672, 6968,14768,
+   6984,9648, 7000,13744, 7016,11696, 7024,7600, 7032,15792, 7048,9136, 7064,13232, 7080,11184,
+   7096,15280, 7112,10160, 7128,14256, 7144,12208, 7152,8112, 7160,16304, 7176,8304, 7192,12400,
+   7208,10352, 7224,14448, 7240,9328, 7256,13424, 7272,11376, 7288,15472, 7304,8816, 7320,12912,
+   7336,10864, 7352,14960, 7368,9840, 7384,13936, 7400,11888, 7408,7792, 7416,15984, 7432,8560,
+   7448,12656, 7464,10608, 7480,14704, 7496,9584, 7512,13680, 7528,11632, 7544,15728, 7560,9072,
+   7576,13168, 7592,11120, 7608,15216, 7624,10096, 7640,14192, 7656,12144, 7664,8048, 7672,16240,
+   7688,8432, 7704,12528, 7720,10480, 7736,14576, 7752,9456, 7768,13552, 7784,11504, 7800,15600,
+   7816,8944, 7832,13040, 7848,10992, 7864,15088, 7880,9968, 7896,14064, 7912,12016, 7928,16112,
+   7944,8688, 7960,12784, 7976,10736, 7992,14832, 8008,9712, 8024,13808, 8040,11760, 8056,15856,
+   8072,9200, 8088,13296, 8104,11248, 8120,15344, 8136,10224, 8152,14320, 8168,12272, 8184,16368,
+   8216,12296, 8232,10248, 8248,14344, 8264,9224, 8280,13320, 8296,11272, 8312,15368, 8328,8712,
+   8344,12808, 8360,10760, 8376,14856, 8392,9736, 8408,13832, 8424,11784, 8440,15880, 8472,12552,
+   8488,10504, 8504,14600, 8520,9480, 8536,13576, 8552,11528, 8568,15624, 8584,8968, 8600,13064,
+   8616,11016, 8632,15112, 8648,9992, 8664,14088, 8680,12040, 8696,16136, 8728,12424, 8744,10376,
+   8760,14472, 8776,9352, 8792,13448, 8808,11400, 8824,15496, 8856,12936, 8872,10888, 8888,14984,
+   8904,9864, 8920,13960, 8936,11912, 8952,16008, 8984,12680, 9000,10632, 9016,14728, 9032,9608,
+   9048,13704, 9064,11656, 9080,15752, 9112,13192, 9128,11144, 9144,15240, 9160,10120, 9176,14216,
+   9192,12168, 9208,16264, 9240,12360, 9256,10312, 9272,14408, 9304,13384, 9320,11336, 9336,15432,
+   9368,12872, 9384,10824, 9400,14920, 9416,9800, 9432,13896, 9448,11848, 9464,15944, 9496,12616,
+   9512,10568, 9528,14664, 9560,13640, 9576,11592, 9592,15688, 9624,13128, 9640,11080, 9656,15176,
+   9672,10056, 9688,14152, 9704,12104, 9720,16200, 9752,12488, 9768,10440, 9784,14536, 9816,13512,
+   9832,11464, 9848,15560, 9880,13000, 9896,10952, 9912,15048, 9944,14024, 9960,11976, 9976,16072,
+   10008,12744, 10024,10696, 10040,14792, 10072,13768, 10088,11720, 10104,15816, 10136,13256, 10152,11208,
+   10168,15304, 10200,14280, 10216,12232, 10232,16328, 10264,12328, 10296,14376, 10328,13352, 10344,11304,
+   10360,15400, 10392,12840, 10408,10792, 10424,14888, 10456,13864, 10472,11816, 10488,15912, 10520,12584,
+   10552,14632, 10584,13608, 10600,11560, 10616,15656, 10648,13096, 10664,11048, 10680,15144, 10712,14120,
+   10728,12072, 10744,16168, 10776,12456, 10808,14504, 10840,13480, 10856,11432, 10872,15528, 10904,12968,
+   10936,15016, 10968,13992, 10984,11944, 11000,16040, 11032,12712, 11064,14760, 11096,13736, 11112,11688,
+   11128,15784, 11160,13224, 11192,15272, 11224,14248, 11240,12200, 11256,16296, 11288,12392, 11320,14440,
+   11352,13416, 11384,15464, 11416,12904, 11448,14952, 11480,13928, 11496,11880, 11512,15976, 11544,12648,
+   11576,14696, 11608,13672, 11640,15720, 11672,13160, 11704,15208, 11736,14184, 11752,12136, 11768,16232,
+   11800,12520, 11832,14568, 11864,13544, 11896,15592, 11928,13032, 11960,15080, 11992,14056, 12024,16104,
+   12056,12776, 12088,14824, 12120,13800, 12152,15848, 12184,13288, 12216,15336, 12248,14312, 12280,16360,
+   12344,14360, 12376,13336, 12408,15384, 12440,12824, 12472,14872, 12504,13848, 12536,15896, 12600,14616,
+   12632,13592, 12664,15640, 12696,13080, 12728,15128, 12760,14104, 12792,16152, 12856,14488, 12888,13464,
+   12920,15512, 12984,15000, 13016,13976, 13048,16024, 13112,14744, 13144,13720, 13176,15768, 13240,15256,
+   13272,14232, 13304,16280, 13368,14424, 13432,15448, 13496,14936, 13528,13912, 13560,15960, 13624,14680,
+   13688,15704, 13752,15192, 13784,14168, 13816,16216, 13880,14552, 13944,15576, 14008,15064, 14072,16088,
+   14136,14808, 14200,15832, 14264,15320, 14328,16344, 14456,15416, 14520,14904, 14584,15928, 14712,15672,
+   14776,15160, 14840,16184, 14968,15544, 15096,16056, 15224,15800, 15352,16312, 15608,15992, 15864,16248
+};
+
+const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] = 
+{
+   //radix 4, size 4032
+   8,16384, 16,8192, 24,24576, 32,4096, 40,20480, 48,12288, 56,28672, 64,2048,
+   72,18432, 80,10240, 88,26624, 96,6144, 104,22528, 112,14336, 120,30720, 128,1024,
+   136,17408, 144,9216, 152,25600, 160,5120, 168,21504, 176,13312, 184,29696, 192,3072,
+   200,19456, 208,11264, 216,27648, 224,7168, 232,23552, 240,15360, 248,31744, 256,512,
+   264,16896, 272,8704, 280,25088, 288,4608, 296,20992, 304,12800, 312,29184, 320,2560,
+   328,18944, 336,10752, 344,27136, 352,6656, 360,23040, 368,14848, 376,31232, 384,1536,
+   392,17920, 400,9728, 408,26112, 416,5632, 424,22016, 432,13824, 440,30208, 448,3584,
+   456,19968, 464,11776, 472,28160, 480,7680, 488,24064, 496,15872, 504,32256, 520,16640,
+   528,8448, 536,24832, 544,4352, 552,20736, 560,12544, 568,28928, 576,2304, 584,18688,
+   592,10496, 600,26880, 608,6400, 616,22784, 624,14592, 632,30976, 640,1280, 648,17664,
+   656,9472, 664,25856, 672,5376, 680,21760, 688,13568, 696,29952, 704,3328, 712,19712,
+   720,11520, 728,27904, 736,7424, 744,23808, 752,15616, 760,32000, 776,17152, 784,8960,
+   792,25344, 800,4864, 808,21248, 816,13056, 824,29440, 832,2816, 840,19200, 848,11008,
+   856,27392, 864,6912, 872,23296, 880,15104, 888,31488, 896,1792, 904,18176, 912,9984,
+   920,26368, 928,5888, 936,22272, 944,14080, 952,30464, 960,3840, 968,20224, 976,12032,
+   984,28416, 992,7936, 1000,24320, 1008,16128, 1016,32512, 1032,16512, 1040,8320, 1048,24704,
+   1056,4224, 1064,20608, 1072,12416, 1080,28800, 1088,2176, 1096,18560, 1104,10368, 1112,26752,
+   1120,6272, 1128,22656, 1136,14464, 1144,30848, 1160,17536, 1168,9344, 1176,25728, 1184,5248,
+   1192,21632, 1200,13440, 1208,29824, 1216,3200, 1224,19584, 1232,11392, 1240,27776, 1248,7296,
+   1256,23680, 1264,15488, 1272,31872, 1288,17024, 1296,8832, 1304,25216, 1312,4736, 1320,21120,
+   1328,12928, 1336,29312, 1344,2688, 1352,19072, 1360,10880, 1368,27264, 1376,6784, 1384,23168,
+   1392,14976, 1400,31360, 1408,1664, 1416,18048, 1424,9856, 1432,26240, 1440,5760, 1448,22144,
+   1456,13952, 1464,30336, 1472,3712, 1480,20096, 1488,11904, 1496,28288, 1504,7808, 1512,24192,
+   1520,16000, 1528,32384, 1544,16768, 1552,8576, 1560,24960, 1568,4480, 1576,20864, 1584,12672,
+   1592,29056, 1600,2432, 1608,18816, 1616,10624, 1624,27008, 1632,6528, 1640,22912, 1648,14720,
+   1656,31104, 1672,17792, 1680,9600, 1688,25984, 1696,5504, 1704,21888, 1712,13696, 1720,30080,
+   1728,3456, 1736,19840, 1744,11648, 1752,28032, 1760,7552, 1768,23936, 1776,15744, 1784,32128,
+   1800,17280, 1808,9088, 1816,25472, 1824,4992, 1832,21376, 1840,13184, 1848,29568, 1856,2944,
+   1864,19328, 1872,11136, 1880,27520, 1888,7040, 1896,23424, 1904,15232, 1912,31616, 1928,18304,
+   1936,10112, 1944,26496, 1952,6016, 1960,22400, 1968,14208, 1976,30592, 1984,3968, 1992,20352,
+   2000,12160, 2008,28544, 2016,8064, 2024,24448, 2032,16256, 2040,32640, 2056,16448, 2064,8256,
+   2072,24640, 2080,4160, 2088,20544, 2096,12352, 2104,28736, 2120,18496, 2128,10304, 2136,26688,
+   2144,6208, 2152,22592, 2160,14400, 2168,30784, 2184,17472, 2192,9280, 2200,25664, 2208,5184,
+   2216,21568, 2224,13376, 2232,29760, 2240,3136, 2248,19520, 2256,11328, 2264,27712, 2272,7232,
+   2280,23616, 2288,15424, 2296,31808, 2312,16960, 2320,8768, 2328,25152, 2336,4672, 2344,21056,
+   2352,12864, 2360,29248, 2368,2624, 2376,19008, 2384,10816, 2392,27200, 2400,6720, 2408,23104,
+   2416,14912, 2424,31296, 2440,17984, 2448,9792, 2456,26176, 2464,5696, 2472,22080, 2480,13888,
+   2488,30272, 2496,3648, 2504,20032, 2512,11840, 2520,28224, 2528,7744, 2536,24128, 2544,15936,
+   2552,32320, 2568,16704, 2576,8512, 2584,24896, 2592,4416, 2600,20800, 2608,12608, 2616,28992,
+   2632,18752, 2640,10560, 2648,26944, 2656,6464, 2664,22848, 2672,14656, 2680,31040, 2696,17728,
+   2704,9536, 2712,25920, 2720,5440, 2728,21824, 2736,13632, 2744,30016, 2752,3392, 2760,19776,
+   2768,11584, 2776,27968, 2784,7488, 2792,23872, 2800,15680, 2808,32064, 2824,17216, 2832,9024,
+   2840,25408, 2848,4928, 2856,21312, 2864,13120, 2872,29504, 2888,19264, 2896,11072, 2904,27456,
+   2912,6976, 2920,23360, 2928,15168, 2936,31552, 2952,18240, 2960,10048, 2968,26432, 2976,5952,
+   2984,22336, 2992,14144, 3000,30528, 3008,3904, 3016,20288, 3024,12096, 3032,28480, 3040,8000,
+   3048,24384, 3056,16192, 3064,32576, 3080,16576, 3088,8384, 3096,24768, 3104,4288, 3112,20672,
+   3120,12480, 3128,28864, 3144,18624, 3152,10432, 3160,26816, 3168,6336, 3176,22720, 3184,14528,
+   3192,30912, 3208,17600, 3216,9408, 3224,25792, 3232,5312, 3240,21696, 3248,13504, 3256,29888,
+   3272,19648, 3280,11456, 3288,27840, 3296,7360, 3304,23744, 3312,15552, 3320,31936, 3336,17088,
+   3344,8896, 3352,25280, 3360,4800, 3368,21184, 3376,12992, 3384,29376, 3400,19136, 3408,10944,
+   3416,27328, 3424,6848, 3432,23232, 3440,15040, 3448,31424, 3464,18112, 3472,9920, 3480,26304,
+   3488,5824, 3496,22208, 3504,14016, 3512,30400, 3520,3776, 3528,20160, 3536,11968, 3544,28352,
+   3552,7872, 3560,24256, 3568,16064, 3576,32448, 3592,16832, 3600,8640, 3608,25024, 3616,4544,
+   3624,20928, 3632,12736, 3640,29120, 3656,18880, 3664,10688, 3672,27072, 3680,6592, 3688,22976,
+   3696,14784, 3704,31168, 3720,17856, 3728,9664, 3736,26048, 3744,5568, 3752,21952, 3760,13760,
+   3768,30144, 3784,19904, 3792,11712, 3800,28096, 3808,7616, 3816,24000, 3824,15808, 3832,32192,
+   3848,17344, 3856,9152, 3864,25536, 3872,5056, 3880,21440, 3888,13248, 3896,29632, 3912,19392,
+   3920,11200, 3928,27584, 3936,7104, 3944,23488, 3952,15296, 3960,31680, 3976,18368, 3984,10176,
+   3992,26560, 4000,6080, 4008,22464, 4016,14272, 4024,30656, 4040,20416, 4048,12224, 4056,28608,
+   4064,8128, 4072,24512, 4080,16320, 4088,32704, 4104,16416, 4112,8224, 4120,24608, 4136,20512,
+   4144,12320, 4152,28704, 4168,18464, 4176,10272, 4184,26656, 4192,6176, 4200,22560, 4208,14368,
+   4216,30752, 4232,17440, 4240,9248, 4248,25632, 4256,5152, 4264,21536, 4272,13344, 4280,29728,
+   4296,19488, 4304,11296, 4312,27680, 4320,7200, 4328,23584, 4336,15392, 4344,31776, 4360,16928,
+   4368,8736, 4376,25120, 4384,4640, 4392,21024, 4400,12832, 4408,29216, 4424,18976, 4432,10784,
+   4440,27168, 4448,6688, 4456,23072, 4464,14880, 4472,31264, 4488,17952, 4496,9760, 4504,26144,
+   4512,5664, 4520,22048, 4528,13856, 4536,30240, 4552,20000, 4560,11808, 4568,28192, 4576,7712,
+   4584,24096, 4592,15904, 4600,32288, 4616,16672, 4624,8480, 4632,24864, 4648,20768, 4656,12576,
+   4664,28960, 4680,18720, 4688,10528, 4696,26912, 4704,6432, 4712,22816, 4720,14624, 4728,31008,
+   4744,17696, 4752,9504, 4760,25888, 4768,5408, 4776,21792, 4784,13600, 4792,29984, 4808,19744,
+   4816,11552, 4824,27936, 4832,7456, 4840,23840, 4848,15648, 4856,32032, 4872,17184, 4880,8992,
+   4888,25376, 4904,21280, 4912,13088, 4920,29472, 4936,19232, 4944,11040, 4952,27424, 4960,6944,
+   4968,23328, 4976,15136, 4984,31520, 5000,18208, 5008,10016, 5016,26400, 5024,5920, 5032,22304,
+   5040,14112, 5048,30496, 5064,20256, 5072,12064, 5080,28448, 5088,7968, 5096,24352, 5104,16160,
+   5112,32544, 5128,16544, 5136,8352, 5144,24736, 5160,20640, 5168,12448, 5176,28832, 5192,18592,
+   5200,10400, 5208,26784, 5216,6304, 5224,22688, 5232,14496, 5240,30880, 5256,17568, 5264,9376,
+   5272,25760, 5288,21664, 5296,13472, 5304,29856, 5320,19616, 5328,11424, 5336,27808, 5344,7328,
+   5352,23712, 5360,15520, 5368,31904, 5384,17056, 5392,8864, 5400,25248, 5416,21152, 5424,12960,
+   5432,29344, 5448,19104, 5456,10912, 5464,27296, 5472,6816, 5480,23200, 5488,15008, 5496,31392,
+   5512,18080, 5520,9888, 5528,26272, 5536,5792, 5544,22176, 5552,13984, 5560,30368, 5576,20128,
+   5584,11936, 5592,28320, 5600,7840, 5608,24224, 5616,16032, 5624,32416, 5640,16800, 5648,8608,
+   5656,24992, 5672,20896, 5680,12704, 5688,29088, 5704,18848, 5712,10656, 5720,27040, 5728,6560,
+   5736,22944, 5744,14752, 5752,31136, 5768,17824, 5776,9632, 5784,26016, 5800,21920, 5808,13728,
+   5816,30112, 5832,19872, 5840,11680, 5848,28064, 5856,7584, 5864,23968, 5872,15776, 5880,32160,
+   5896,17312, 5904,9120, 5912,25504, 5928,21408, 5936,13216, 5944,29600, 5960,19360, 5968,11168,
+   5976,27552, 5984,7072, 5992,23456, 6000,15264, 6008,31648, 6024,18336, 6032,10144, 6040,26528,
+   6056,22432, 6064,14240, 6072,30624, 6088,20384, 6096,12192, 6104,28576, 6112,8096, 6120,24480,
+   6128,16288, 6136,32672, 6152,16480, 6160,8288, 6168,24672, 6184,20576, 6192,12384, 6200,28768,
+   6216,18528, 6224,10336, 6232,26720, 6248,22624, 6256,14432, 6264,30816, 6280,17504, 6288,9312,
+   6296,25696, 6312,21600, 6320,13408, 6328,29792, 6344,19552, 6352,11360, 6360,27744, 6368,7264,
+   6376,23648, 6384,15456, 6392,31840, 6408,16992, 6416,8800, 6424,25184, 6440,21088, 6448,12896,
+   6456,29280, 6472,19040, 6480,10848, 6488,27232, 6496,6752, 6504,23136, 6512,14944, 6520,31328,
+   6536,18016, 6544,9824, 6552,26208, 6568,22112, 6576,13920, 6584,30304, 6600,20064, 6608,11872,
+   6616,28256, 6624,7776, 6632,24160, 6640,15968, 6648,32352, 6664,16736, 6672,8544, 6680,24928,
+   6696,20832, 6704,12640, 6712,29024, 6728,18784, 6736,10592, 6744,26976, 6760,22880, 6768,14688,
+   6776,31072, 6792,17760, 6800,9568, 6808,25952, 6824,21856, 6832,13664, 6840,30048, 6856,19808,
+   6864,11616, 6872,28000, 6880,7520, 6888,23904, 6896,15712, 6904,32096, 6920,17248, 6928,9056,
+   6936,25440, 6952,21344, 6960,13152, 6968,29536, 6984,19296, 6992,11104, 7000,27488, 7016,23392,
+   7024,15200, 7032,31584, 7048,18272, 7056,10080, 7064,26464, 7080,22368, 7088,14176, 7096,30560,
+   7112,20320, 7120,12128, 7128,28512, 7136,8032, 7144,24416, 7152,16224, 7160,32608, 7176,16608,
+   7184,8416, 7192,24800, 7208,20704, 7216,12512, 7224,28896, 7240,18656, 7248,10464, 7256,26848,
+   7272,22752, 7280,14560, 7288,30944, 7304,17632, 7312,9440, 7320,25824, 7336,21728, 7344,13536,
+   7352,29920, 7368,19680, 7376,11488, 7384,27872, 7400,23776, 7408,15584, 7416,31968, 7432,17120,
+   7440,8928, 7448,25312, 7464,21216, 7472,13024, 7480,29408, 7496,19168, 7504,10976, 7512,27360,
+   7528,23264, 7536,15072, 7544,31456, 7560,18144, 7568,9952, 7576,26336, 7592,22240, 7600,14048,
+   7608,30432, 7624,20192, 7632,12000, 7640,28384, 7648,7904, 7656,24288, 7664,16096, 7672,32480,
+   7688,16864, 7696,8672, 7704,25056, 7720,20960, 7728,12768, 7736,29152, 7752,18912, 7760,10720,
+   7768,27104, 7784,23008, 7792,14816, 7800,31200, 7816,17888, 7824,9696, 7832,26080, 7848,21984,
+   7856,13792, 7864,30176, 7880,19936, 7888,11744, 7896,28128, 7912,24032, 7920,15840, 7928,32224,
+   7944,17376, 7952,9184, 7960,25568, 7976,21472, 7984,13280, 7992,29664, 8008,19424, 8016,11232,
+   8024,27616, 8040,23520, 8048,15328, 8056,31712, 8072,18400, 8080,10208, 8088,26592, 8104,22496,
+   8112,14304, 8120,30688, 8136,20448, 8144,12256, 8152,28640, 8168,24544, 8176,16352, 8184,32736,
+   8200,16400, 8216,24592, 8232,20496, 8240,12304, 8248,28688, 8264,18448, 8272,10256, 8280,26640,
+   8296,22544, 8304,14352, 8312,30736, 8328,17424, 8336,9232, 8344,25616, 8360,21520, 8368,13328,
+   8376,29712, 8392,19472, 8400,11280, 8408,27664, 8424,23568, 8432,15376, 8440,31760, 8456,16912,
+   8464,8720, 8472,25104, 8488,21008, 8496,12816, 8504,29200, 8520,18960, 8528,10768, 8536,27152,
+   8552,23056, 8560,14864, 8568,31248, 8584,17936, 8592,9744, 8600,26128, 8616,22032, 8624,13840,
+   8632,30224, 8648,19984, 8656,11792, 8664,28176, 8680,24080, 8688,15888, 8696,32272, 8712,16656,
+   8728,24848, 8744,20752, 8752,12560, 8760,28944, 8776,18704, 8784,10512, 8792,26896, 8808,22800,
+   8816,14608, 8824,30992, 8840,17680, 8848,9488, 8856,25872, 8872,21776, 8880,13584, 8888,29968,
+   8904,19728, 8912,11536, 8920,27920, 8936,23824, 8944,15632, 8952,32016, 8968,17168, 8984,25360,
+   9000,21264, 9008,13072, 9016,29456, 9032,19216, 9040,11024, 9048,27408, 9064,23312, 9072,15120,
+   9080,31504, 9096,18192, 9104,10000, 9112,26384, 9128,22288, 9136,14096, 9144,30480, 9160,20240,
+   9168,12048, 9176,28432, 9192,24336, 9200,16144, 9208,32528, 9224,16528, 9240,24720, 9256,20624,
+   9264,12432, 9272,28816, 9288,18576, 9296,10384, 9304,26768, 9320,22672, 9328,14480, 9336,30864,
+   9352,17552, 9368,25744, 9384,21648, 9392,13456, 9400,29840, 9416,19600, 9424,11408, 9432,27792,
+   9448,23696, 9456,15504, 9464,31888, 9480,17040, 9496,25232, 9512,21136, 9520,12944, 9528,29328,
+   9544,19088, 9552,10896, 9560,27280, 9576,23184, 9584,14992, 9592,31376, 9608,18064, 9616,9872,
+   9624,26256, 9640,22160, 9648,13968, 9656,30352, 9672,20112, 9680,11920, 9688,28304, 9704,24208,
+   9712,16016, 9720,32400, 9736,16784, 9752,24976, 9768,20880, 9776,12688, 9784,29072, 9800,18832,
+   9808,10640, 9816,27024, 9832,22928, 9840,14736, 9848,31120, 9864,17808, 9880,26000, 9896,21904,
+   9904,13712, 9912,30096, 9928,19856, 9936,11664, 9944,28048, 9960,23952, 9968,15760, 9976,32144,
+   9992,17296, 10008,25488, 10024,21392, 10032,13200, 10040,29584, 10056,19344, 10064,11152, 10072,27536,
+   10088,23440, 10096,15248, 10104,31632, 10120,18320, 10136,26512, 10152,22416, 10160,14224, 10168,30608,
+   10184,20368, 10192,12176, 10200,28560, 10216,24464, 10224,16272, 10232,32656, 10248,16464, 10264,24656,
+   10280,20560, 10288,12368, 10296,28752, 10312,18512, 10328,26704, 10344,22608, 10352,14416, 10360,30800,
+   10376,17488, 10392,25680, 10408,21584, 10416,13392, 10424,29776, 10440,19536, 10448,11344, 10456,27728,
+   10472,23632, 10480,15440, 10488,31824, 10504,16976, 10520,25168, 10536,21072, 10544,12880, 10552,29264,
+   10568,19024, 10576,10832, 10584,27216, 10600,23120, 10608,14928, 10616,31312, 10632,18000, 10648,26192,
+   10664,22096, 10672,13904, 10680,30288, 10696,20048, 10704,11856, 10712,28240, 10728,24144, 10736,15952,
+   10744,32336, 10760,16720, 10776,24912, 10792,20816, 10800,12624, 10808,29008, 10824,18768, 10840,26960,
+   10856,22864, 10864,14672, 10872,31056, 10888,17744, 10904,25936, 10920,21840, 10928,13648, 10936,30032,
+   10952,19792, 10960,11600, 10968,27984, 10984,23888, 10992,15696, 11000,32080, 11016,17232, 11032,25424,
+   11048,21328, 11056,13136, 11064,29520, 11080,19280, 11096,27472, 11112,23376, 11120,15184, 11128,31568,
+   11144,18256, 11160,26448, 11176,22352, 11184,14160, 11192,30544, 11208,20304, 11216,12112, 11224,28496,
+   11240,24400, 11248,16208, 11256,32592, 11272,16592, 11288,24784, 11304,20688, 11312,12496, 11320,28880,
+   11336,18640, 11352,26832, 11368,22736, 11376,14544, 11384,30928, 11400,17616, 11416,25808, 11432,21712,
+   11440,13520, 11448,29904, 11464,19664, 11480,27856, 11496,23760, 11504,15568, 11512,31952, 11528,17104,
+   11544,25296, 11560,21200, 11568,13008, 11576,29392, 11592,19152, 11608,27344, 11624,23248, 11632,15056,
+   11640,31440, 11656,18128, 11672,26320, 11688,22224, 11696,14032, 11704,30416, 11720,20176, 11728,11984,
+   11736,28368, 11752,24272, 11760,16080, 11768,32464, 11784,16848, 11800,25040, 11816,20944, 11824,12752,
+   11832,29136, 11848,18896, 11864,27088, 11880,22992, 11888,14800, 11896,31184, 11912,17872, 11928,26064,
+   11944,21968, 11952,13776, 11960,30160, 11976,19920, 11992,28112, 12008,24016, 12016,15824, 12024,32208,
+   12040,17360, 12056,25552, 12072,21456, 12080,13264, 12088,29648, 12104,19408, 12120,27600, 12136,23504,
+   12144,15312, 12152,31696, 12168,18384, 12184,26576, 12200,22480, 12208,14288, 12216,30672, 12232,20432,
+   12248,28624, 12264,24528, 12272,16336, 12280,32720, 12296,16432, 12312,24624, 12328,20528, 12344,28720,
+   12360,18480, 12376,26672, 12392,22576, 12400,14384, 12408,30768, 12424,17456, 12440,25648, 12456,21552,
+   12464,13360, 12472,29744, 12488,19504, 12504,27696, 12520,23600, 12528,15408, 12536,31792, 12552,16944,
+   12568,25136, 12584,21040, 12592,12848, 12600,29232, 12616,18992, 12632,27184, 12648,23088, 12656,14896,
+   12664,31280, 12680,17968, 12696,26160, 12712,22064, 12720,13872, 12728,30256, 12744,20016, 12760,28208,
+   12776,24112, 12784,15920, 12792,32304, 12808,16688, 12824,24880, 12840,20784, 12856,28976, 12872,18736,
+   12888,26928, 12904,22832, 12912,14640, 12920,31024, 12936,17712, 12952,25904, 12968,21808, 12976,13616,
+   12984,30000, 13000,19760, 13016,27952, 13032,23856, 13040,15664, 13048,32048, 13064,17200, 13080,25392,
+   13096,21296, 13112,29488, 13128,19248, 13144,27440, 13160,23344, 13168,15152, 13176,31536, 13192,18224,
+   13208,26416, 13224,22320, 13232,14128, 13240,30512, 13256,20272, 13272,28464, 13288,24368, 13296,16176,
+   13304,32560, 13320,16560, 13336,24752, 13352,20656, 13368,28848, 13384,18608, 13400,26800, 13416,22704,
+   13424,14512, 13432,30896, 13448,17584, 13464,25776, 13480,21680, 13496,29872, 13512,19632, 13528,27824,
+   13544,23728, 13552,15536, 13560,31920, 13576,17072, 13592,25264, 13608,21168, 13624,29360, 13640,19120,
+   13656,27312, 13672,23216, 13680,15024, 13688,31408, 13704,18096, 13720,26288, 13736,22192, 13744,14000,
+   13752,30384, 13768,20144, 13784,28336, 13800,24240, 13808,16048, 13816,32432, 13832,16816, 13848,25008,
+   13864,20912, 13880,29104, 13896,18864, 13912,27056, 13928,22960, 13936,14768, 13944,31152, 13960,17840,
+   13976,26032, 13992,21936, 14008,30128, 14024,19888, 14040,28080, 14056,23984, 14064,15792, 14072,32176,
+   14088,17328, 14104,25520, 14120,21424, 14136,29616, 14152,19376, 14168,27568, 14184,23472, 14192,15280,
+   14200,31664, 14216,18352, 14232,26544, 14248,22448, 14264,30640, 14280,20400, 14296,28592, 14312,24496,
+   14320,16304, 14328,32688, 14344,16496, 14360,24688, 14376,20592, 14392,28784, 14408,18544, 14424,26736,
+   14440,22640, 14456,30832, 14472,17520, 14488,25712, 14504,21616, 14520,29808, 14536,19568, 14552,27760,
+   14568,23664, 14576,15472, 14584,31856, 14600,17008, 14616,25200, 14632,21104, 14648,29296, 14664,19056,
+   14680,27248, 14696,23152, 14704,14960, 14712,31344, 14728,18032, 14744,26224, 14760,22128, 14776,30320,
+   14792,20080, 14808,28272, 14824,24176, 14832,15984, 14840,32368, 14856,16752, 14872,24944, 14888,20848,
+   14904,29040, 14920,18800, 14936,26992, 14952,22896, 14968,31088, 14984,17776, 15000,25968, 15016,21872,
+   15032,30064, 15048,19824, 15064,28016, 15080,23920, 15088,15728, 15096,32112, 15112,17264, 15128,25456,
+   15144,21360, 15160,29552, 15176,19312, 15192,27504, 15208,23408, 15224,31600, 15240,18288, 15256,26480,
+   15272,22384, 15288,30576, 15304,20336, 15320,28528, 15336,24432, 15344,16240, 15352,32624, 15368,16624,
+   15384,24816, 15400,20720, 15416,28912, 15432,18672, 15448,26864, 15464,22768, 15480,30960, 15496,17648,
+   15512,25840, 15528,21744, 15544,29936, 15560,19696, 15576,27888, 15592,23792, 15608,31984, 15624,17136,
+   15640,25328, 15656,21232, 15672,29424, 15688,19184, 15704,27376, 15720,23280, 15736,31472, 15752,18160,
+   15768,26352, 15784,22256, 15800,30448, 15816,20208, 15832,28400, 15848,24304, 15856,16112, 15864,32496,
+   15880,16880, 15896,25072, 15912,20976, 15928,29168, 15944,18928, 15960,27120, 15976,23024, 15992,31216,
+   16008,17904, 16024,26096, 16040,22000, 16056,30192, 16072,19952, 16088,28144, 16104,24048, 16120,32240,
+   16136,17392, 16152,25584, 16168,21488, 16184,29680, 16200,19440, 16216,27632, 16232,23536, 16248,31728,
+   16264,18416, 16280,26608, 16296,22512, 16312,30704, 16328,20464, 16344,28656, 16360,24560, 16376,32752,
+   16408,24584, 16424,20488, 16440,28680, 16456,18440, 16472,26632, 16488,22536, 16504,30728, 16520,17416,
+   16536,25608, 16552,21512, 16568,29704, 16584,19464, 16600,27656, 16616,23560, 16632,31752, 16648,16904,
+   16664,25096, 16680,21000, 16696,29192, 16712,18952, 16728,27144, 16744,23048, 16760,31240, 16776,17928,
+   16792,26120, 16808,22024, 16824,30216, 16840,19976, 16856,28168, 16872,24072, 16888,32264, 16920,24840,
+   16936,20744, 16952,28936, 16968,18696, 16984,26888, 17000,22792, 17016,30984, 17032,17672, 17048,25864,
+   17064,21768, 17080,29960, 17096,19720, 17112,27912, 17128,23816, 17144,32008, 17176,25352, 17192,21256,
+   17208,29448, 17224,19208, 17240,27400, 17256,23304, 17272,31496, 17288,18184, 17304,26376, 17320,22280,
+   17336,30472, 17352,20232, 17368,28424, 17384,24328, 17400,32520, 17432,24712, 17448,20616, 17464,28808,
+   17480,18568, 17496,26760, 17512,22664, 17528,30856, 17560,25736, 17576,21640, 17592,29832, 17608,19592,
+   17624,27784, 17640,23688, 17656,31880, 17688,25224, 17704,21128, 17720,29320, 17736,19080, 17752,27272,
+   17768,23176, 17784,31368, 17800,18056, 17816,26248, 17832,22152, 17848,30344, 17864,20104, 17880,28296,
+   17896,24200, 17912,32392, 17944,24968, 17960,20872, 17976,29064, 17992,18824, 18008,27016, 18024,22920,
+   18040,31112, 18072,25992, 18088,21896, 18104,30088, 18120,19848, 18136,28040, 18152,23944, 18168,32136,
+   18200,25480, 18216,21384, 18232,29576, 18248,19336, 18264,27528, 18280,23432, 18296,31624, 18328,26504,
+   18344,22408, 18360,30600, 18376,20360, 18392,28552, 18408,24456, 18424,32648, 18456,24648, 18472,20552,
+   18488,28744, 18520,26696, 18536,22600, 18552,30792, 18584,25672, 18600,21576, 18616,29768, 18632,19528,
+   18648,27720, 18664,23624, 18680,31816, 18712,25160, 18728,21064, 18744,29256, 18760,19016, 18776,27208,
+   18792,23112, 18808,31304, 18840,26184, 18856,22088, 18872,30280, 18888,20040, 18904,28232, 18920,24136,
+   18936,32328, 18968,24904, 18984,20808, 19000,29000, 19032,26952, 19048,22856, 19064,31048, 19096,25928,
+   19112,21832, 19128,30024, 19144,19784, 19160,27976, 19176,23880, 19192,32072, 19224,25416, 19240,21320,
+   19256,29512, 19288,27464, 19304,23368, 19320,31560, 19352,26440, 19368,22344, 19384,30536, 19400,20296,
+   19416,28488, 19432,24392, 19448,32584, 19480,24776, 19496,20680, 19512,28872, 19544,26824, 19560,22728,
+   19576,30920, 19608,25800, 19624,21704, 19640,29896, 19672,27848, 19688,23752, 19704,31944, 19736,25288,
+   19752,21192, 19768,29384, 19800,27336, 19816,23240, 19832,31432, 19864,26312, 19880,22216, 19896,30408,
+   19912,20168, 19928,28360, 19944,24264, 19960,32456, 19992,25032, 20008,20936, 20024,29128, 20056,27080,
+   20072,22984, 20088,31176, 20120,26056, 20136,21960, 20152,30152, 20184,28104, 20200,24008, 20216,32200,
+   20248,25544, 20264,21448, 20280,29640, 20312,27592, 20328,23496, 20344,31688, 20376,26568, 20392,22472,
+   20408,30664, 20440,28616, 20456,24520, 20472,32712, 20504,24616, 20536,28712, 20568,26664, 20584,22568,
+   20600,30760, 20632,25640, 20648,21544, 20664,29736, 20696,27688, 20712,23592, 20728,31784, 20760,25128,
+   20776,21032, 20792,29224, 20824,27176, 20840,23080, 20856,31272, 20888,26152, 20904,22056, 20920,30248,
+   20952,28200, 20968,24104, 20984,32296, 21016,24872, 21048,28968, 21080,26920, 21096,22824, 21112,31016,
+   21144,25896, 21160,21800, 21176,29992, 21208,27944, 21224,23848, 21240,32040, 21272,25384, 21304,29480,
+   21336,27432, 21352,23336, 21368,31528, 21400,26408, 21416,22312, 21432,30504, 21464,28456, 21480,24360,
+   21496,32552, 21528,24744, 21560,28840, 21592,26792, 21608,22696, 21624,30888, 21656,25768, 21688,29864,
+   21720,27816, 21736,23720, 21752,31912, 21784,25256, 21816,29352, 21848,27304, 21864,23208, 21880,31400,
+   21912,26280, 21928,22184, 21944,30376, 21976,28328, 21992,24232, 22008,32424, 22040,25000, 22072,29096,
+   22104,27048, 22120,22952, 22136,31144, 22168,26024, 22200,30120, 22232,28072, 22248,23976, 22264,32168,
+   22296,25512, 22328,29608, 22360,27560, 22376,23464, 22392,31656, 22424,26536, 22456,30632, 22488,28584,
+   22504,24488, 22520,32680, 22552,24680, 22584,28776, 22616,26728, 22648,30824, 22680,25704, 22712,29800,
+   22744,27752, 22760,23656, 22776,31848, 22808,25192, 22840,29288, 22872,27240, 22888,23144, 22904,31336,
+   22936,26216, 22968,30312, 23000,28264, 23016,24168, 23032,32360, 23064,24936, 23096,29032, 23128,26984,
+   23160,31080, 23192,25960, 23224,30056, 23256,28008, 23272,23912, 23288,32104, 23320,25448, 23352,29544,
+   23384,27496, 23416,31592, 23448,26472, 23480,30568, 23512,28520, 23528,24424, 23544,32616, 23576,24808,
+   23608,28904, 23640,26856, 23672,30952, 23704,25832, 23736,29928, 23768,27880, 23800,31976, 23832,25320,
+   23864,29416, 23896,27368, 23928,31464, 23960,26344, 23992,30440, 24024,28392, 24040,24296, 24056,32488,
+   24088,25064, 24120,29160, 24152,27112, 24184,31208, 24216,26088, 24248,30184, 24280,28136, 24312,32232,
+   24344,25576, 24376,29672, 24408,27624, 24440,31720, 24472,26600, 24504,30696, 24536,28648, 24568,32744,
+   24632,28696, 24664,26648, 24696,30744, 24728,25624, 24760,29720, 24792,27672, 24824,31768, 24856,25112,
+   24888,29208, 24920,27160, 24952,31256, 24984,26136, 25016,30232, 25048,28184, 25080,32280, 25144,28952,
+   25176,26904, 25208,31000, 25240,25880, 25272,29976, 25304,27928, 25336,32024, 25400,29464, 25432,27416,
+   25464,31512, 25496,26392, 25528,30488, 25560,28440, 25592,32536, 25656,28824, 25688,26776, 25720,30872,
+   25784,29848, 25816,27800, 25848,31896, 25912,29336, 25944,27288, 25976,31384, 26008,26264, 26040,30360,
+   26072,28312, 26104,32408, 26168,29080, 26200,27032, 26232,31128, 26296,30104, 26328,28056, 26360,32152,
+   26424,29592, 26456,27544, 26488,31640, 26552,30616, 26584,28568, 26616,32664, 26680,28760, 26744,30808,
+   26808,29784, 26840,27736, 26872,31832, 26936,29272, 26968,27224, 27000,31320, 27064,30296, 27096,28248,
+   27128,32344, 27192,29016, 27256,31064, 27320,30040, 27352,27992, 27384,32088, 27448,29528, 27512,31576,
+   27576,30552, 27608,28504, 27640,32600, 27704,28888, 27768,30936, 27832,29912, 27896,31960, 27960,29400,
+   28024,31448, 28088,30424, 28120,28376, 28152,32472, 28216,29144, 28280,31192, 28344,30168, 28408,32216,
+   28472,29656, 28536,31704, 28600,30680, 28664,32728, 28792,30776, 28856,29752, 28920,31800, 28984,29240,
+   29048,31288, 29112,30264, 29176,32312, 29304,31032, 29368,30008, 29432,32056, 29560,31544, 29624,30520,
+   29688,32568, 29816,30904, 29944,31928, 30072,31416, 30136,30392, 30200,32440, 30328,31160, 30456,32184,
+   30584,31672, 30712,32696, 30968,31864, 31096,31352, 31224,32376, 31480,32120, 31736,32632, 32248,32504
+};
+
+/**    
+* @brief  Floating-point sine table for the fast math functions    
+* \par    
+* Example code for the generation of the table:    
+* <pre>for(i = 0; i <= FAST_MATH_TABLE_SIZE; i++)    
+* {    
+*    sinTable_f32[i] = sin(i * 2*PI/FAST_MATH_TABLE_SIZE);    
+* } </pre>    
+* \par    
+* where FAST_MATH_TABLE_SIZE = 512 and PI = 3.14159265358979.  The last value repeats the first one,    
+* so that the table can be interpolated from any of its FAST_MATH_TABLE_SIZE entries.    
+*/
+const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1] = {
+  0.000000000f, 0.012271538f, 0.024541229f, 0.036807223f,
+  0.049067674f, 0.061320736f, 0.073564564f, 0.085797312f,
+  0.098017140f, 0.110222207f, 0.122410675f, 0.134580709f,
+  0.146730474f, 0.158858143f, 0.170961889f, 0.183039888f,
+  0.195090322f, 0.207111376f, 0.219101240f, 0.231058108f,
+  0.242980180f, 0.254865660f, 0.266712757f, 0.278519689f,
+  0.290284677f, 0.302005949f, 0.313681740f, 0.325310292f,
+  0.336889853f, 0.348418680f, 0.359895037f, 0.371317194f,
+  0.382683432f, 0.393992040f, 0.405241314f, 0.416429560f,
+  0.427555093f, 0.438616239f, 0.449611330f, 0.460538711f,
+  0.471396737f, 0.482183772f, 0.492898192f, 0.503538384f,
+  0.514102744f, 0.524589683f, 0.534997620f, 0.545324988f,
+  0.555570233f, 0.565731811f, 0.575808191f, 0.585797857f,
+  0.595699304f, 0.605511041f, 0.615231591f, 0.624859488f,
+  0.634393284f, 0.643831543f, 0.653172843f, 0.662415778f,
+  0.671558955f, 0.680600998f, 0.689540545f, 0.698376249f,
+  0.707106781f, 0.715730825f, 0.724247083f, 0.732654272f,
+  0.740951125f, 0.749136395f, 0.757208847f, 0.765167266f,
+  0.773010453f, 0.780737229f, 0.788346428f, 0.795836905f,
+  0.803207531f, 0.810457198f, 0.817584813f, 0.824589303f,
+  0.831469612f, 0.838224706f, 0.844853565f, 0.851355193f,
+  0.857728610f, 0.863972856f, 0.870086991f, 0.876070094f,
+  0.881921264f, 0.887639620f, 0.893224301f, 0.898674466f,
+  0.903989293f, 0.909167983f, 0.914209756f, 0.919113852f,
+  0.923879533f, 0.928506080f, 0.932992799f, 0.937339012f,
+  0.941544065f, 0.945607325f, 0.949528181f, 0.953306040f,
+  0.956940336f, 0.960430519f, 0.963776066f, 0.966976471f,
+  0.970031253f, 0.972939952f, 0.975702130f, 0.978317371f,
+  0.980785280f, 0.983105487f, 0.985277642f, 0.987301418f,
+  0.989176510f, 0.990902635f, 0.992479535f, 0.993906970f,
+  0.995184727f, 0.996312612f, 0.997290457f, 0.998118113f,
+  0.998795456f, 0.999322385f, 0.999698819f, 0.999924702f,
+  1.000000000f, 0.999924702f, 0.999698819f, 0.999322385f,
+  0.998795456f, 0.998118113f, 0.997290457f, 0.996312612f,
+  0.995184727f, 0.993906970f, 0.992479535f, 0.990902635f,
+  0.989176510f, 0.987301418f, 0.985277642f, 0.983105487f,
+  0.980785280f, 0.978317371f, 0.975702130f, 0.972939952f,
+  0.970031253f, 0.966976471f, 0.963776066f, 0.960430519f,
+  0.956940336f, 0.953306040f, 0.949528181f, 0.945607325f,
+  0.941544065f, 0.937339012f, 0.932992799f, 0.928506080f,
+  0.923879533f, 0.919113852f, 0.914209756f, 0.909167983f,
+  0.903989293f, 0.898674466f, 0.893224301f, 0.887639620f,
+  0.881921264f, 0.876070094f, 0.870086991f, 0.863972856f,
+  0.857728610f, 0.851355193f, 0.844853565f, 0.838224706f,
+  0.831469612f, 0.824589303f, 0.817584813f, 0.810457198f,
+  0.803207531f, 0.795836905f, 0.788346428f, 0.780737229f,
+  0.773010453f, 0.765167266f, 0.757208847f, 0.749136395f,
+  0.740951125f, 0.732654272f, 0.724247083f, 0.715730825f,
+  0.707106781f, 0.698376249f, 0.689540545f, 0.680600998f,
+  0.671558955f, 0.662415778f, 0.653172843f, 0.643831543f,
+  0.634393284f, 0.624859488f, 0.615231591f, 0.605511041f,
+  0.595699304f, 0.585797857f, 0.575808191f, 0.565731811f,
+  0.555570233f, 0.545324988f, 0.534997620f, 0.524589683f,
+  0.514102744f, 0.503538384f, 0.492898192f, 0.482183772f,
+  0.471396737f, 0.460538711f, 0.449611330f, 0.438616239f,
+  0.427555093f, 0.416429560f, 0.405241314f, 0.393992040f,
+  0.382683432f, 0.371317194f, 0.359895037f, 0.348418680f,
+  0.336889853f, 0.325310292f, 0.313681740f, 0.302005949f,
+  0.290284677f, 0.278519689f, 0.266712757f, 0.254865660f,
+  0.242980180f, 0.231058108f, 0.219101240f, 0.207111376f,
+  0.195090322f, 0.183039888f, 0.170961889f, 0.158858143f,
+  0.146730474f, 0.134580709f, 0.122410675f, 0.110222207f,
+  0.098017140f, 0.085797312f, 0.073564564f, 0.061320736f,
+  0.049067674f, 0.036807223f, 0.024541229f, 0.012271538f,
+  0.000000000f, -0.012271538f, -0.024541229f, -0.036807223f,
+  -0.049067674f, -0.061320736f, -0.073564564f, -0.085797312f,
+  -0.098017140f, -0.110222207f, -0.122410675f, -0.134580709f,
+  -0.146730474f, -0.158858143f, -0.170961889f, -0.183039888f,
+  -0.195090322f, -0.207111376f, -0.219101240f, -0.231058108f,
+  -0.242980180f, -0.254865660f, -0.266712757f, -0.278519689f,
+  -0.290284677f, -0.302005949f, -0.313681740f, -0.325310292f,
+  -0.336889853f, -0.348418680f, -0.359895037f, -0.371317194f,
+  -0.382683432f, -0.393992040f, -0.405241314f, -0.416429560f,
+  -0.427555093f, -0.438616239f, -0.449611330f, -0.460538711f,
+  -0.471396737f, -0.482183772f, -0.492898192f, -0.503538384f,
+  -0.514102744f, -0.524589683f, -0.534997620f, -0.545324988f,
+  -0.555570233f, -0.565731811f, -0.575808191f, -0.585797857f,
+  -0.595699304f, -0.605511041f, -0.615231591f, -0.624859488f,
+  -0.634393284f, -0.643831543f, -0.653172843f, -0.662415778f,
+  -0.671558955f, -0.680600998f, -0.689540545f, -0.698376249f,
+  -0.707106781f, -0.715730825f, -0.724247083f, -0.732654272f,
+  -0.740951125f, -0.749136395f, -0.757208847f, -0.765167266f,
+  -0.773010453f, -0.780737229f, -0.788346428f, -0.795836905f,
+  -0.803207531f, -0.810457198f, -0.817584813f, -0.824589303f,
+  -0.831469612f, -0.838224706f, -0.844853565f, -0.851355193f,
+  -0.857728610f, -0.863972856f, -0.870086991f, -0.876070094f,
+  -0.881921264f, -0.887639620f, -0.893224301f, -0.898674466f,
+  -0.903989293f, -0.909167983f, -0.914209756f, -0.919113852f,
+  -0.923879533f, -0.928506080f, -0.932992799f, -0.937339012f,
+  -0.941544065f, -0.945607325f, -0.949528181f, -0.953306040f,
+  -0.956940336f, -0.960430519f, -0.963776066f, -0.966976471f,
+  -0.970031253f, -0.972939952f, -0.975702130f, -0.978317371f,
+  -0.980785280f, -0.983105487f, -0.985277642f, -0.987301418f,
+  -0.989176510f, -0.990902635f, -0.992479535f, -0.993906970f,
+  -0.995184727f, -0.996312612f, -0.997290457f, -0.998118113f,
+  -0.998795456f, -0.999322385f, -0.999698819f, -0.999924702f,
+  -1.000000000f, -0.999924702f, -0.999698819f, -0.999322385f,
+  -0.998795456f, -0.998118113f, -0.997290457f, -0.996312612f,
+  -0.995184727f, -0.993906970f, -0.992479535f, -0.990902635f,
+  -0.989176510f, -0.987301418f, -0.985277642f, -0.983105487f,
+  -0.980785280f, -0.978317371f, -0.975702130f, -0.972939952f,
+  -0.970031253f, -0.966976471f, -0.963776066f, -0.960430519f,
+  -0.956940336f, -0.953306040f, -0.949528181f, -0.945607325f,
+  -0.941544065f, -0.937339012f, -0.932992799f, -0.928506080f,
+  -0.923879533f, -0.919113852f, -0.914209756f, -0.909167983f,
+  -0.903989293f, -0.898674466f, -0.893224301f, -0.887639620f,
+  -0.881921264f, -0.876070094f, -0.870086991f, -0.863972856f,
+  -0.857728610f, -0.851355193f, -0.844853565f, -0.838224706f,
+  -0.831469612f, -0.824589303f, -0.817584813f, -0.810457198f,
+  -0.803207531f, -0.795836905f, -0.788346428f, -0.780737229f,
+  -0.773010453f, -0.765167266f, -0.757208847f, -0.749136395f,
+  -0.740951125f, -0.732654272f, -0.724247083f, -0.715730825f,
+  -0.707106781f, -0.698376249f, -0.689540545f, -0.680600998f,
+  -0.671558955f, -0.662415778f, -0.653172843f, -0.643831543f,
+  -0.634393284f, -0.624859488f, -0.615231591f, -0.605511041f,
+  -0.595699304f, -0.585797857f, -0.575808191f, -0.565731811f,
+  -0.555570233f, -0.545324988f, -0.534997620f, -0.524589683f,
+  -0.514102744f, -0.503538384f, -0.492898192f, -0.482183772f,
+  -0.471396737f, -0.460538711f, -0.449611330f, -0.438616239f,
+  -0.427555093f, -0.416429560f, -0.405241314f, -0.393992040f,
+  -0.382683432f, -0.371317194f, -0.359895037f, -0.348418680f,
+  -0.336889853f, -0.325310292f, -0.313681740f, -0.302005949f,
+  -0.290284677f, -0.278519689f, -0.266712757f, -0.254865660f,
+  -0.242980180f, -0.231058108f, -0.219101240f, -0.207111376f,
+  -0.195090322f, -0.183039888f, -0.170961889f, -0.158858143f,
+  -0.146730474f, -0.134580709f, -0.122410675f, -0.110222207f,
+  -0.098017140f, -0.085797312f, -0.073564564f, -0.061320736f,
+  -0.049067674f, -0.036807223f, -0.024541229f, -0.012271538f,
+  0.000000000f
+};
+
+/**    
+* @brief  Q31 sine table for the fast math functions    
+* \par    
+* The values of sinTable_f32 converted to Q31 (Fixed point 1.31):    
+*	round(sinTable_f32[i] * pow(2, 31)), saturated to 0x7FFFFFFF    
+*/
+const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1] = {
+  0x00000000, 0x01921D20, 0x03242ABF, 0x04B6195D, 0x0647D97C, 0x07D95B9E,
+  0x096A9049, 0x0AFB6805, 0x0C8BD35E, 0x0E1BC2E4, 0x0FAB272B, 0x1139F0CF,
+  0x12C8106F, 0x145576B1, 0x15E21445, 0x176DD9DE, 0x18F8B83C, 0x1A82A026,
+  0x1C0B826A, 0x1D934FE5, 0x1F19F97B, 0x209F701C, 0x2223A4C5, 0x23A6887F,
+  0x25280C5E, 0x26A82186, 0x2826B928, 0x29A3C485, 0x2B1F34EB, 0x2C98FBBA,
+  0x2E110A62, 0x2F875262, 0x30FBC54D, 0x326E54C7, 0x33DEF287, 0x354D9057,
+  0x36BA2014, 0x382493B0, 0x398CDD32, 0x3AF2EEB7, 0x3C56BA70, 0x3DB832A6,
+  0x3F1749B8, 0x4073F21D, 0x41CE1E65, 0x4325C135, 0x447ACD50, 0x45CD358F,
+  0x471CECE7, 0x4869E665, 0x49B41533, 0x4AFB6C98, 0x4C3FDFF4, 0x4D8162C4,
+  0x4EBFE8A5, 0x4FFB654D, 0x5133CC94, 0x5269126E, 0x539B2AF0, 0x54CA0A4B,
+  0x55F5A4D2, 0x571DEEFA, 0x5842DD54, 0x59646498, 0x5A82799A, 0x5B9D1154,
+  0x5CB420E0, 0x5DC79D7C, 0x5ED77C8A, 0x5FE3B38D, 0x60EC3830, 0x61F1003F,
+  0x62F201AC, 0x63EF3290, 0x64E88926, 0x65DDFBD3, 0x66CF8120, 0x67BD0FBD,
+  0x68A69E81, 0x698C246C, 0x6A6D98A4, 0x6B4AF279, 0x6C242960, 0x6CF934FC,
+  0x6DCA0D14, 0x6E96A99D, 0x6F5F02B2, 0x7023109A, 0x70E2CBC6, 0x719E2CD2,
+  0x72552C85, 0x7307C3D0, 0x73B5EBD1, 0x745F9DD1, 0x7504D345, 0x75A585CF,
+  0x7641AF3D, 0x76D94989, 0x776C4EDB, 0x77FAB989, 0x78848414, 0x7909A92D,
+  0x798A23B1, 0x7A05EEAD, 0x7A7D055B, 0x7AEF6323, 0x7B5D039E, 0x7BC5E290,
+  0x7C29FBEE, 0x7C894BDE, 0x7CE3CEB2, 0x7D3980EC, 0x7D8A5F40, 0x7DD6668F,
+  0x7E1D93EA, 0x7E5FE493, 0x7E9D55FC, 0x7ED5E5C6, 0x7F0991C4, 0x7F3857F6,
+  0x7F62368F, 0x7F872BF3, 0x7FA736B4, 0x7FC25596, 0x7FD8878E, 0x7FE9CBC0,
+  0x7FF62182, 0x7FFD885A, 0x7FFFFFFF, 0x7FFD885A, 0x7FF62182, 0x7FE9CBC0,
+  0x7FD8878E, 0x7FC25596, 0x7FA736B4, 0x7F872BF3, 0x7F62368F, 0x7F3857F6,
+  0x7F0991C4, 0x7ED5E5C6, 0x7E9D55FC, 0x7E5FE493, 0x7E1D93EA, 0x7DD6668F,
+  0x7D8A5F40, 0x7D3980EC, 0x7CE3CEB2, 0x7C894BDE, 0x7C29FBEE, 0x7BC5E290,
+  0x7B5D039E, 0x7AEF6323, 0x7A7D055B, 0x7A05EEAD, 0x798A23B1, 0x7909A92D,
+  0x78848414, 0x77FAB989, 0x776C4EDB, 0x76D94989, 0x7641AF3D, 0x75A585CF,
+  0x7504D345, 0x745F9DD1, 0x73B5EBD1, 0x7307C3D0, 0x72552C85, 0x719E2CD2,
+  0x70E2CBC6, 0x7023109A, 0x6F5F02B2, 0x6E96A99D, 0x6DCA0D14, 0x6CF934FC,
+  0x6C242960, 0x6B4AF279, 0x6A6D98A4, 0x698C246C, 0x68A69E81, 0x67BD0FBD,
+  0x66CF8120, 0x65DDFBD3, 0x64E88926, 0x63EF3290, 0x62F201AC, 0x61F1003F,
+  0x60EC3830, 0x5FE3B38D, 0x5ED77C8A, 0x5DC79D7C, 0x5CB420E0, 0x5B9D1154,
+  0x5A82799A, 0x59646498, 0x5842DD54, 0x571DEEFA, 0x55F5A4D2, 0x54CA0A4B,
+  0x539B2AF0, 0x5269126E, 0x5133CC94, 0x4FFB654D, 0x4EBFE8A5, 0x4D8162C4,
+  0x4C3FDFF4, 0x4AFB6C98, 0x49B41533, 0x4869E665, 0x471CECE7, 0x45CD358F,
+  0x447ACD50, 0x4325C135, 0x41CE1E65, 0x4073F21D, 0x3F1749B8, 0x3DB832A6,
+  0x3C56BA70, 0x3AF2EEB7, 0x398CDD32, 0x382493B0, 0x36BA2014, 0x354D9057,
+  0x33DEF287, 0x326E54C7, 0x30FBC54D, 0x2F875262, 0x2E110A62, 0x2C98FBBA,
+  0x2B1F34EB, 0x29A3C485, 0x2826B928, 0x26A82186, 0x25280C5E, 0x23A6887F,
+  0x2223A4C5, 0x209F701C, 0x1F19F97B, 0x1D934FE5, 0x1C0B826A, 0x1A82A026,
+  0x18F8B83C, 0x176DD9DE, 0x15E21445, 0x145576B1, 0x12C8106F, 0x1139F0CF,
+  0x0FAB272B, 0x0E1BC2E4, 0x0C8BD35E, 0x0AFB6805, 0x096A9049, 0x07D95B9E,
+  0x0647D97C, 0x04B6195D, 0x03242ABF, 0x01921D20, 0x00000000, 0xFE6DE2E0,
+  0xFCDBD541, 0xFB49E6A3, 0xF9B82684, 0xF826A462, 0xF6956FB7, 0xF50497FB,
+  0xF3742CA2, 0xF1E43D1C, 0xF054D8D5, 0xEEC60F31, 0xED37EF91, 0xEBAA894F,
+  0xEA1DEBBB, 0xE8922622, 0xE70747C4, 0xE57D5FDA, 0xE3F47D96, 0xE26CB01B,
+  0xE0E60685, 0xDF608FE4, 0xDDDC5B3B, 0xDC597781, 0xDAD7F3A2, 0xD957DE7A,
+  0xD7D946D8, 0xD65C3B7B, 0xD4E0CB15, 0xD3670446, 0xD1EEF59E, 0xD078AD9E,
+  0xCF043AB3, 0xCD91AB39, 0xCC210D79, 0xCAB26FA9, 0xC945DFEC, 0xC7DB6C50,
+  0xC67322CE, 0xC50D1149, 0xC3A94590, 0xC247CD5A, 0xC0E8B648, 0xBF8C0DE3,
+  0xBE31E19B, 0xBCDA3ECB, 0xBB8532B0, 0xBA32CA71, 0xB8E31319, 0xB796199B,
+  0xB64BEACD, 0xB5049368, 0xB3C0200C, 0xB27E9D3C, 0xB140175B, 0xB0049AB3,
+  0xAECC336C, 0xAD96ED92, 0xAC64D510, 0xAB35F5B5, 0xAA0A5B2E, 0xA8E21106,
+  0xA7BD22AC, 0xA69B9B68, 0xA57D8666, 0xA462EEAC, 0xA34BDF20, 0xA2386284,
+  0xA1288376, 0xA01C4C73, 0x9F13C7D0, 0x9E0EFFC1, 0x9D0DFE54, 0x9C10CD70,
+  0x9B1776DA, 0x9A22042D, 0x99307EE0, 0x9842F043, 0x9759617F, 0x9673DB94,
+  0x9592675C, 0x94B50D87, 0x93DBD6A0, 0x9306CB04, 0x9235F2EC, 0x91695663,
+  0x90A0FD4E, 0x8FDCEF66, 0x8F1D343A, 0x8E61D32E, 0x8DAAD37B, 0x8CF83C30,
+  0x8C4A142F, 0x8BA0622F, 0x8AFB2CBB, 0x8A5A7A31, 0x89BE50C3, 0x8926B677,
+  0x8893B125, 0x88054677, 0x877B7BEC, 0x86F656D3, 0x8675DC4F, 0x85FA1153,
+  0x8582FAA5, 0x85109CDD, 0x84A2FC62, 0x843A1D70, 0x83D60412, 0x8376B422,
+  0x831C314E, 0x82C67F14, 0x8275A0C0, 0x82299971, 0x81E26C16, 0x81A01B6D,
+  0x8162AA04, 0x812A1A3A, 0x80F66E3C, 0x80C7A80A, 0x809DC971, 0x8078D40D,
+  0x8058C94C, 0x803DAA6A, 0x80277872, 0x80163440, 0x8009DE7E, 0x800277A6,
+  0x80000000, 0x800277A6, 0x8009DE7E, 0x80163440, 0x80277872, 0x803DAA6A,
+  0x8058C94C, 0x8078D40D, 0x809DC971, 0x80C7A80A, 0x80F66E3C, 0x812A1A3A,
+  0x8162AA04, 0x81A01B6D, 0x81E26C16, 0x82299971, 0x8275A0C0, 0x82C67F14,
+  0x831C314E, 0x8376B422, 0x83D60412, 0x843A1D70, 0x84A2FC62, 0x85109CDD,
+  0x8582FAA5, 0x85FA1153, 0x8675DC4F, 0x86F656D3, 0x877B7BEC, 0x88054677,
+  0x8893B125, 0x8926B677, 0x89BE50C3, 0x8A5A7A31, 0x8AFB2CBB, 0x8BA0622F,
+  0x8C4A142F, 0x8CF83C30, 0x8DAAD37B, 0x8E61D32E, 0x8F1D343A, 0x8FDCEF66,
+  0x90A0FD4E, 0x91695663, 0x9235F2EC, 0x9306CB04, 0x93DBD6A0, 0x94B50D87,
+  0x9592675C, 0x9673DB94, 0x9759617F, 0x9842F043, 0x99307EE0, 0x9A22042D,
+  0x9B1776DA, 0x9C10CD70, 0x9D0DFE54, 0x9E0EFFC1, 0x9F13C7D0, 0xA01C4C73,
+  0xA1288376, 0xA2386284, 0xA34BDF20, 0xA462EEAC, 0xA57D8666, 0xA69B9B68,
+  0xA7BD22AC, 0xA8E21106, 0xAA0A5B2E, 0xAB35F5B5, 0xAC64D510, 0xAD96ED92,
+  0xAECC336C, 0xB0049AB3, 0xB140175B, 0xB27E9D3C, 0xB3C0200C, 0xB5049368,
+  0xB64BEACD, 0xB796199B, 0xB8E31319, 0xBA32CA71, 0xBB8532B0, 0xBCDA3ECB,
+  0xBE31E19B, 0xBF8C0DE3, 0xC0E8B648, 0xC247CD5A, 0xC3A94590, 0xC50D1149,
+  0xC67322CE, 0xC7DB6C50, 0xC945DFEC, 0xCAB26FA9, 0xCC210D79, 0xCD91AB39,
+  0xCF043AB3, 0xD078AD9E, 0xD1EEF59E, 0xD3670446, 0xD4E0CB15, 0xD65C3B7B,
+  0xD7D946D8, 0xD957DE7A, 0xDAD7F3A2, 0xDC597781, 0xDDDC5B3B, 0xDF608FE4,
+  0xE0E60685, 0xE26CB01B, 0xE3F47D96, 0xE57D5FDA, 0xE70747C4, 0xE8922622,
+  0xEA1DEBBB, 0xEBAA894F, 0xED37EF91, 0xEEC60F31, 0xF054D8D5, 0xF1E43D1C,
+  0xF3742CA2, 0xF50497FB, 0xF6956FB7, 0xF826A462, 0xF9B82684, 0xFB49E6A3,
+  0xFCDBD541, 0xFE6DE2E0, 0x00000000
+};
+
+/**    
+* @brief  Q15 sine table for the fast math functions    
+* \par    
+* The values of sinTable_f32 converted to Q15 (Fixed point 1.15):    
+*	round(sinTable_f32[i] * pow(2, 15)), saturated to 0x7FFF    
+*/
+const q15_t ALIGN4 sinTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
+  0x0000, 0x0192, 0x0324, 0x04B6, 0x0648, 0x07D9, 0x096B, 0x0AFB,
+  0x0C8C, 0x0E1C, 0x0FAB, 0x113A, 0x12C8, 0x1455, 0x15E2, 0x176E,
+  0x18F9, 0x1A83, 0x1C0C, 0x1D93, 0x1F1A, 0x209F, 0x2224, 0x23A7,
+  0x2528, 0x26A8, 0x2827, 0x29A4, 0x2B1F, 0x2C99, 0x2E11, 0x2F87,
+  0x30FC, 0x326E, 0x33DF, 0x354E, 0x36BA, 0x3825, 0x398D, 0x3AF3,
+  0x3C57, 0x3DB8, 0x3F17, 0x4074, 0x41CE, 0x4326, 0x447B, 0x45CD,
+  0x471D, 0x486A, 0x49B4, 0x4AFB, 0x4C40, 0x4D81, 0x4EC0, 0x4FFB,
+  0x5134, 0x5269, 0x539B, 0x54CA, 0x55F6, 0x571E, 0x5843, 0x5964,
+  0x5A82, 0x5B9D, 0x5CB4, 0x5DC8, 0x5ED7, 0x5FE4, 0x60EC, 0x61F1,
+  0x62F2, 0x63EF, 0x64E9, 0x65DE, 0x66D0, 0x67BD, 0x68A7, 0x698C,
+  0x6A6E, 0x6B4B, 0x6C24, 0x6CF9, 0x6DCA, 0x6E97, 0x6F5F, 0x7023,
+  0x70E3, 0x719E, 0x7255, 0x7308, 0x73B6, 0x7460, 0x7505, 0x75A6,
+  0x7642, 0x76D9, 0x776C, 0x77FB, 0x7885, 0x790A, 0x798A, 0x7A06,
+  0x7A7D, 0x7AEF, 0x7B5D, 0x7BC6, 0x7C2A, 0x7C89, 0x7CE4, 0x7D3A,
+  0x7D8A, 0x7DD6, 0x7E1E, 0x7E60, 0x7E9D, 0x7ED6, 0x7F0A, 0x7F38,
+  0x7F62, 0x7F87, 0x7FA7, 0x7FC2, 0x7FD9, 0x7FEA, 0x7FF6, 0x7FFE,
+  0x7FFF, 0x7FFE, 0x7FF6, 0x7FEA, 0x7FD9, 0x7FC2, 0x7FA7, 0x7F87,
+  0x7F62, 0x7F38, 0x7F0A, 0x7ED6, 0x7E9D, 0x7E60, 0x7E1E, 0x7DD6,
+  0x7D8A, 0x7D3A, 0x7CE4, 0x7C89, 0x7C2A, 0x7BC6, 0x7B5D, 0x7AEF,
+  0x7A7D, 0x7A06, 0x798A, 0x790A, 0x7885, 0x77FB, 0x776C, 0x76D9,
+  0x7642, 0x75A6, 0x7505, 0x7460, 0x73B6, 0x7308, 0x7255, 0x719E,
+  0x70E3, 0x7023, 0x6F5F, 0x6E97, 0x6DCA, 0x6CF9, 0x6C24, 0x6B4B,
+  0x6A6E, 0x698C, 0x68A7, 0x67BD, 0x66D0, 0x65DE, 0x64E9, 0x63EF,
+  0x62F2, 0x61F1, 0x60EC, 0x5FE4, 0x5ED7, 0x5DC8, 0x5CB4, 0x5B9D,
+  0x5A82, 0x5964, 0x5843, 0x571E, 0x55F6, 0x54CA, 0x539B, 0x5269,
+  0x5134, 0x4FFB, 0x4EC0, 0x4D81, 0x4C40, 0x4AFB, 0x49B4, 0x486A,
+  0x471D, 0x45CD, 0x447B, 0x4326, 0x41CE, 0x4074, 0x3F17, 0x3DB8,
+  0x3C57, 0x3AF3, 0x398D, 0x3825, 0x36BA, 0x354E, 0x33DF, 0x326E,
+  0x30FC, 0x2F87, 0x2E11, 0x2C99, 0x2B1F, 0x29A4, 0x2827, 0x26A8,
+  0x2528, 0x23A7, 0x2224, 0x209F, 0x1F1A, 0x1D93, 0x1C0C, 0x1A83,
+  0x18F9, 0x176E, 0x15E2, 0x1455, 0x12C8, 0x113A, 0x0FAB, 0x0E1C,
+  0x0C8C, 0x0AFB, 0x096B, 0x07D9, 0x0648, 0x04B6, 0x0324, 0x0192,
+  0x0000, 0xFE6E, 0xFCDC, 0xFB4A, 0xF9B8, 0xF827, 0xF695, 0xF505,
+  0xF374, 0xF1E4, 0xF055, 0xEEC6, 0xED38, 0xEBAB, 0xEA1E, 0xE892,
+  0xE707, 0xE57D, 0xE3F4, 0xE26D, 0xE0E6, 0xDF61, 0xDDDC, 0xDC59,
+  0xDAD8, 0xD958, 0xD7D9, 0xD65C, 0xD4E1, 0xD367, 0xD1EF, 0xD079,
+  0xCF04, 0xCD92, 0xCC21, 0xCAB2, 0xC946, 0xC7DB, 0xC673, 0xC50D,
+  0xC3A9, 0xC248, 0xC0E9, 0xBF8C, 0xBE32, 0xBCDA, 0xBB85, 0xBA33,
+  0xB8E3, 0xB796, 0xB64C, 0xB505, 0xB3C0, 0xB27F, 0xB140, 0xB005,
+  0xAECC, 0xAD97, 0xAC65, 0xAB36, 0xAA0A, 0xA8E2, 0xA7BD, 0xA69C,
+  0xA57E, 0xA463, 0xA34C, 0xA238, 0xA129, 0xA01C, 0x9F14, 0x9E0F,
+  0x9D0E, 0x9C11, 0x9B17, 0x9A22, 0x9930, 0x9843, 0x9759, 0x9674,
+  0x9592, 0x94B5, 0x93DC, 0x9307, 0x9236, 0x9169, 0x90A1, 0x8FDD,
+  0x8F1D, 0x8E62, 0x8DAB, 0x8CF8, 0x8C4A, 0x8BA0, 0x8AFB, 0x8A5A,
+  0x89BE, 0x8927, 0x8894, 0x8805, 0x877B, 0x86F6, 0x8676, 0x85FA,
+  0x8583, 0x8511, 0x84A3, 0x843A, 0x83D6, 0x8377, 0x831C, 0x82C6,
+  0x8276, 0x822A, 0x81E2, 0x81A0, 0x8163, 0x812A, 0x80F6, 0x80C8,
+  0x809E, 0x8079, 0x8059, 0x803E, 0x8027, 0x8016, 0x800A, 0x8002,
+  0x8000, 0x8002, 0x800A, 0x8016, 0x8027, 0x803E, 0x8059, 0x8079,
+  0x809E, 0x80C8, 0x80F6, 0x812A, 0x8163, 0x81A0, 0x81E2, 0x822A,
+  0x8276, 0x82C6, 0x831C, 0x8377, 0x83D6, 0x843A, 0x84A3, 0x8511,
+  0x8583, 0x85FA, 0x8676, 0x86F6, 0x877B, 0x8805, 0x8894, 0x8927,
+  0x89BE, 0x8A5A, 0x8AFB, 0x8BA0, 0x8C4A, 0x8CF8, 0x8DAB, 0x8E62,
+  0x8F1D, 0x8FDD, 0x90A1, 0x9169, 0x9236, 0x9307, 0x93DC, 0x94B5,
+  0x9592, 0x9674, 0x9759, 0x9843, 0x9930, 0x9A22, 0x9B17, 0x9C11,
+  0x9D0E, 0x9E0F, 0x9F14, 0xA01C, 0xA129, 0xA238, 0xA34C, 0xA463,
+  0xA57E, 0xA69C, 0xA7BD, 0xA8E2, 0xAA0A, 0xAB36, 0xAC65, 0xAD97,
+  0xAECC, 0xB005, 0xB140, 0xB27F, 0xB3C0, 0xB505, 0xB64C, 0xB796,
+  0xB8E3, 0xBA33, 0xBB85, 0xBCDA, 0xBE32, 0xBF8C, 0xC0E9, 0xC248,
+  0xC3A9, 0xC50D, 0xC673, 0xC7DB, 0xC946, 0xCAB2, 0xCC21, 0xCD92,
+  0xCF04, 0xD079, 0xD1EF, 0xD367, 0xD4E1, 0xD65C, 0xD7D9, 0xD958,
+  0xDAD8, 0xDC59, 0xDDDC, 0xDF61, 0xE0E6, 0xE26D, 0xE3F4, 0xE57D,
+  0xE707, 0xE892, 0xEA1E, 0xEBAB, 0xED38, 0xEEC6, 0xF055, 0xF1E4,
+  0xF374, 0xF505, 0xF695, 0xF827, 0xF9B8, 0xFB4A, 0xFCDC, 0xFE6E,
+  0x0000
+};
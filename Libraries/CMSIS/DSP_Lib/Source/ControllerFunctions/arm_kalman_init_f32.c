@@ -0,0 +1,144 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_kalman_init_f32.c    
+*    
+* Description:  Floating-point Kalman filter initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @defgroup Kalman Kalman Filter    
+ *    
+ * A linear or extended Kalman filter whose temporary matrices live in one arena laid out at    
+ * initialization, so that a step allocates nothing and calls no matrix function per product.    
+ *    
+ * \par Algorithm    
+ * The prediction step computes    
+ * <pre>    
+ *     x = F * x    
+ *     P = F * P * F<sup>T</sup> + Q    
+ * </pre>    
+ * in one function.  <code>F * P</code> is formed row by row, skipping the zero elements of    
+ * <code>F</code>, and stored transposed, so that the product with <code>F<sup>T</sup></code> is formed row by row    
+ * as well.  Only the upper triangle of the symmetric result is computed, then mirrored.    
+ * \par    
+ * A scalar measurement <code>z = h * x + v</code>, where <code>h</code> is a row of <code>n</code> values and    
+ * <code>v</code> has the variance <code>r</code>, is absorbed without any matrix inversion:    
+ * <pre>    
+ *     p = P * h<sup>T</sup>    
+ *     s = h * p + r    
+ *     x = x + p * (z - h * x) / s    
+ *     P = P - p * p<sup>T</sup> / s    
+ * </pre>    
+ * A vector measurement <code>z = H * x + v</code> with covariance <code>R</code> is decorrelated with the    
+ * Cholesky factor <code>R = L * L<sup>T</sup></code>: the rows of <code>L<sup>-1</sup> * H</code> and of    
+ * <code>L<sup>-1</sup> * z</code> are then independent scalar measurements of unit variance, absorbed    
+ * one after the other.  When <code>R</code> is diagonal, calling <code>arm_kalman_update_scalar_f32()</code>    
+ * once per row avoids the decomposition.    
+ *    
+ * \par Instance Structure    
+ * The state, covariance, transition and process noise buffers belong to the application, which    
+ * may change <code>F</code> and <code>Q</code> between steps.  <code>pArena</code> points to a work buffer of    
+ * <pre>    
+ *     n*n + n + m*m + m*n + m    
+ * </pre>    
+ * values, where <code>n</code> is the number of states and <code>m</code> the largest number of measurements    
+ * passed to <code>arm_kalman_update_f32()</code>.  <code>m</code> may be 0 when only scalar updates are used.    
+ *    
+ * \par Extended Kalman Filter    
+ * For a nonlinear model, load the Jacobian into <code>F</code> and pass the propagated state to    
+ * <code>arm_kalman_predict_f32()</code>.  For a nonlinear measurement <code>z = h(x)</code> with the Jacobian    
+ * <code>H</code>, pass <code>z - h(x) + H * x</code> as the measurement.    
+ */
+
+/**    
+ * @addtogroup Kalman    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point Kalman filter.    
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.    
+ * @param[in]     numStates number of states <code>n</code>.    
+ * @param[in]     numMeas largest number of measurements per call to <code>arm_kalman_update_f32()</code>.    
+ * @param[in]     *pState points to the state vector of length <code>n</code>.    
+ * @param[in]     *pCov points to the <code>n x n</code> state covariance matrix.    
+ * @param[in]     *pTrans points to the <code>n x n</code> state transition matrix.    
+ * @param[in]     *pProcNoise points to the <code>n x n</code> process noise covariance matrix.    
+ * @param[in]     *pArena points to the work buffer of <code>n*n + n + numMeas*numMeas + numMeas*n + numMeas</code> values.    
+ * @return        none.    
+ *    
+ * \par    
+ * The state and the covariance are used as given: they hold the initial estimate.    
+ */
+
+void arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  float32_t * pState,
+  float32_t * pCov,
+  float32_t * pTrans,
+  float32_t * pProcNoise,
+  float32_t * pArena)
+{
+  /* Assign the sizes */
+  S->numStates = numStates;
+  S->numMeas = numMeas;
+
+  /* Assign the application buffers */
+  S->pState = pState;
+  S->pCov = pCov;
+  S->pTrans = pTrans;
+  S->pProcNoise = pProcNoise;
+
+  /* Lay out the temporary buffers in the arena */
+  S->pFP = pArena;
+  S->pPHt = S->pFP + ((uint32_t) numStates * numStates);
+  S->pRChol = S->pPHt + numStates;
+  S->pHw = S->pRChol + ((uint32_t) numMeas * numMeas);
+  S->pZw = S->pHw + ((uint32_t) numMeas * numStates);
+
+}
+
+/**    
+ * @} end of Kalman group    
+ */
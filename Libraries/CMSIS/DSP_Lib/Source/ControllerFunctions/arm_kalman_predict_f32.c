@@ -0,0 +1,212 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_kalman_predict_f32.c    
+*    
+* Description:  Floating-point Kalman filter prediction step.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup Kalman    
+ * @{    
+ */
+
+/**    
+ * @brief  Prediction step of the floating-point Kalman filter.    
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.    
+ * @param[in]     *pStatePred points to the predicted state computed by the application, or NULL    
+ * to compute <code>x = F * x</code>.    
+ * @return        none.    
+ *    
+ * \par    
+ * Computes <code>P = F * P * F<sup>T</sup> + Q</code> in two passes over the arena, both of which    
+ * scale and add whole rows so that zero elements of <code>F</code>, common in kinematic models, cost nothing.    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+/*    
+ * Host build: pDst[j] += f * pSrc[j] for numBlks blocks of __HOST_VLEN values.    
+ */
+
+__HOST_SIMD_TARGET
+static void arm_kalman_axpy_f32_host(
+  float32_t * pDst,
+  const float32_t * pSrc,
+  float32_t f,
+  uint32_t numBlks)
+{
+  while(numBlks > 0u)
+  {
+    __HOST_ST(pDst, __HOST_LD(pDst) + f * __HOST_LD(pSrc));
+    pDst += __HOST_VLEN;
+    pSrc += __HOST_VLEN;
+
+    numBlks--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+void arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pStatePred)
+{
+  float32_t *pF = S->pTrans;                     /* transition matrix pointer */
+  float32_t *pP = S->pCov;                       /* covariance matrix pointer */
+  float32_t *pQ = S->pProcNoise;                 /* process noise matrix pointer */
+  float32_t *pFP = S->pFP;                       /* F * P matrix pointer */
+  float32_t *pX = S->pState;                     /* state vector pointer */
+  float32_t *pTmp = S->pPHt;                     /* temporary state vector */
+  float32_t *pRowF, *pRowFP, *pRowP;             /* row pointers */
+  float32_t f, sum;                              /* temporary values */
+  uint32_t n = S->numStates;                     /* number of states */
+  uint32_t i, j, k;                              /* loop counters */
+
+  /* x = F * x, or the state propagated by the application */
+  if(pStatePred == NULL)
+  {
+    for (i = 0u; i < n; i++)
+    {
+      pRowF = pF + (i * n);
+      sum = 0.0f;
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += pRowF[k] * pX[k];
+      }
+
+      pTmp[i] = sum;
+    }
+
+    pStatePred = pTmp;
+  }
+
+  memcpy(pX, pStatePred, n * sizeof(float32_t));
+
+  /* FP(i,:) = F(i,0) * P(0,:) + ... + F(i,n-1) * P(n-1,:), stored transposed */
+  for (i = 0u; i < n; i++)
+  {
+    pRowF = pF + (i * n);
+
+    memset(pTmp, 0, n * sizeof(float32_t));
+
+    for (k = 0u; k < n; k++)
+    {
+      f = pRowF[k];
+
+      if(f != 0.0f)
+      {
+        pRowP = pP + (k * n);
+
+        j = 0u;
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+        /* Host build: the blocks of __HOST_VLEN values are computed with the vector unit */
+        if(__HOST_SIMD_READY())
+        {
+          arm_kalman_axpy_f32_host(pTmp, pRowP, f, (n) / __HOST_VLEN);
+          j = n - ((n) % __HOST_VLEN);
+        }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+        for (; j < n; j++)
+        {
+          pTmp[j] += f * pRowP[j];
+        }
+      }
+    }
+
+    for (j = 0u; j < n; j++)
+    {
+      pFP[(j * n) + i] = pTmp[j];
+    }
+  }
+
+  /* P(i,j) = Q(i,j) + F(i,0) * FP(j,0) + ... + F(i,n-1) * FP(j,n-1) for j >= i, mirrored below the diagonal */
+  for (i = 0u; i < n; i++)
+  {
+    pRowF = pF + (i * n);
+    pRowP = pP + (i * n);
+
+    memcpy(pRowP + i, pQ + (i * n) + i, (n - i) * sizeof(float32_t));
+
+    for (k = 0u; k < n; k++)
+    {
+      f = pRowF[k];
+
+      if(f != 0.0f)
+      {
+        pRowFP = pFP + (k * n);
+
+        j = i;
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+        /* Host build: the blocks of __HOST_VLEN values are computed with the vector unit */
+        if(__HOST_SIMD_READY())
+        {
+          arm_kalman_axpy_f32_host(pRowP + i, pRowFP + i, f, (n - i) / __HOST_VLEN);
+          j = n - ((n - i) % __HOST_VLEN);
+        }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+        for (; j < n; j++)
+        {
+          pRowP[j] += f * pRowFP[j];
+        }
+      }
+    }
+
+    for (j = i + 1u; j < n; j++)
+    {
+      pP[(j * n) + i] = pRowP[j];
+    }
+  }
+
+}
+
+/**    
+ * @} end of Kalman group    
+ */
@@ -0,0 +1,123 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_kalman_update_f32.c    
+*    
+* Description:  Floating-point Kalman filter vector measurement update.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup Kalman    
+ * @{    
+ */
+
+/**    
+ * @brief  Vector measurement update of the floating-point Kalman filter.    
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.    
+ * @param[in]     *pH points to the instance of the <code>m x n</code> measurement matrix, <code>m <= numMeas</code>.    
+ * @param[in]     *pZ points to the measurement vector of length <code>m</code>.    
+ * @param[in]     *pR points to the instance of the <code>m x m</code> measurement noise covariance matrix.    
+ * @return        The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match,    
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code> if <code>R</code> is not positive definite and    
+ * <code>ARM_MATH_SINGULAR</code> if an innovation variance is not positive; otherwise <code>ARM_MATH_SUCCESS</code>.    
+ *    
+ * \par    
+ * The measurements are decorrelated with the Cholesky factor of <code>R</code> and absorbed as    
+ * <code>m</code> scalar measurements, which needs no matrix inversion.    
+ */
+
+arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pH,
+  float32_t * pZ,
+  const arm_matrix_instance_f32 * pR)
+{
+  arm_matrix_instance_f32 chol;                  /* Cholesky factor of R */
+  arm_matrix_instance_f32 hw;                    /* whitened measurement matrix */
+  arm_matrix_instance_f32 z;                     /* measurement vector */
+  arm_matrix_instance_f32 zw;                    /* whitened measurement vector */
+  uint32_t n = S->numStates;                     /* number of states */
+  uint32_t m = pH->numRows;                      /* number of measurements */
+  uint32_t i;                                    /* loop counter */
+  arm_status status;                             /* status of the update */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pH->numCols != n) || (m > S->numMeas)
+     || (pR->numRows != m) || (pR->numCols != m))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Views of the arena */
+    arm_mat_init_f32(&chol, m, m, S->pRChol);
+    arm_mat_init_f32(&hw, m, n, S->pHw);
+    arm_mat_init_f32(&z, m, 1u, pZ);
+    arm_mat_init_f32(&zw, m, 1u, S->pZw);
+
+    /* R = L * L^T, then L^-1 * H and L^-1 * z have uncorrelated unit variance noise */
+    status = arm_mat_cholesky_f32(pR, &chol);
+
+    if(status == ARM_MATH_SUCCESS)
+    {
+      arm_mat_solve_lower_triangular_f32(&chol, pH, &hw);
+      arm_mat_solve_lower_triangular_f32(&chol, &z, &zw);
+
+      /* Absorb the rows one after the other */
+      for (i = 0u; (i < m) && (status == ARM_MATH_SUCCESS); i++)
+      {
+        status = arm_kalman_update_scalar_f32(S, S->pHw + (i * n), S->pZw[i], 1.0f);
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of Kalman group    
+ */
@@ -0,0 +1,204 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_kalman_update_scalar_f32.c    
+*    
+* Description:  Floating-point Kalman filter scalar measurement update.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup Kalman    
+ * @{    
+ */
+
+/**    
+ * @brief  Scalar measurement update of the floating-point Kalman filter.    
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.    
+ * @param[in]     *pH points to the measurement row <code>h</code> of length <code>n</code>.    
+ * @param[in]     z measurement.    
+ * @param[in]     r variance of the measurement noise.    
+ * @return        The function returns <code>ARM_MATH_SINGULAR</code> if the innovation variance    
+ * <code>h * P * h<sup>T</sup> + r</code> is not positive, in which case the filter is left unchanged,    
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * Zero elements of <code>h</code>, as when a sensor observes a single state, cost nothing.    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+/*    
+ * Host build: pDst[j] += f * pSrc[j] for numBlks blocks of __HOST_VLEN values.    
+ */
+
+__HOST_SIMD_TARGET
+static void arm_kalman_axpy_f32_host(
+  float32_t * pDst,
+  const float32_t * pSrc,
+  float32_t f,
+  uint32_t numBlks)
+{
+  while(numBlks > 0u)
+  {
+    __HOST_ST(pDst, __HOST_LD(pDst) + f * __HOST_LD(pSrc));
+    pDst += __HOST_VLEN;
+    pSrc += __HOST_VLEN;
+
+    numBlks--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+arm_status arm_kalman_update_scalar_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pH,
+  float32_t z,
+  float32_t r)
+{
+  float32_t *pP = S->pCov;                       /* covariance matrix pointer */
+  float32_t *pX = S->pState;                     /* state vector pointer */
+  float32_t *pPh = S->pPHt;                      /* P * h^T vector pointer */
+  float32_t *pRowP;                              /* row pointer */
+  float32_t h, s, y, gain;                       /* temporary values */
+  uint32_t n = S->numStates;                     /* number of states */
+  uint32_t i, j;                                 /* loop counters */
+  arm_status status;                             /* status of the update */
+
+  /* p = P * h^T, as the sum of the rows of the symmetric P weighted by h; y = z - h * x */
+  memset(pPh, 0, n * sizeof(float32_t));
+  y = z;
+
+  for (i = 0u; i < n; i++)
+  {
+    h = pH[i];
+
+    if(h != 0.0f)
+    {
+      pRowP = pP + (i * n);
+
+      j = 0u;
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+      /* Host build: the blocks of __HOST_VLEN values are computed with the vector unit */
+      if(__HOST_SIMD_READY())
+      {
+        arm_kalman_axpy_f32_host(pPh, pRowP, h, (n) / __HOST_VLEN);
+        j = n - ((n) % __HOST_VLEN);
+      }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+      for (; j < n; j++)
+      {
+        pPh[j] += h * pRowP[j];
+      }
+
+      y -= h * pX[i];
+    }
+  }
+
+  /* s = h * p + r */
+  s = r;
+
+  for (i = 0u; i < n; i++)
+  {
+    s += pH[i] * pPh[i];
+  }
+
+  if(!(s > 0.0f))
+  {
+    /* Set status as ARM_MATH_SINGULAR */
+    status = ARM_MATH_SINGULAR;
+  }
+  else
+  {
+    /* x = x + p * y / s */
+    s = 1.0f / s;
+    gain = y * s;
+
+    for (i = 0u; i < n; i++)
+    {
+      pX[i] += pPh[i] * gain;
+    }
+
+    /* P = P - p * p^T / s, upper triangle mirrored below the diagonal */
+    for (i = 0u; i < n; i++)
+    {
+      gain = pPh[i] * s;
+      pRowP = pP + (i * n);
+
+      j = i;
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+      /* Host build: the blocks of __HOST_VLEN values are computed with the vector unit */
+      if(__HOST_SIMD_READY())
+      {
+        arm_kalman_axpy_f32_host(pRowP + i, pPh + i, -gain, (n - i) / __HOST_VLEN);
+        j = n - ((n - i) % __HOST_VLEN);
+      }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+      for (; j < n; j++)
+      {
+        pRowP[j] -= gain * pPh[j];
+      }
+
+      for (j = i + 1u; j < n; j++)
+      {
+        pP[(j * n) + i] = pRowP[j];
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of Kalman group    
+ */
@@ -385,19 +385,11 @@ void arm_sin_cos_f32(
   float32_t y0, y1;                              /* nearest output values */
   float32_t y2, y3;
   float32_t fract;                               /* fractional part of input */
-
-  /* Calculation of fractional part */
-  if(theta > 0.0f)
-  {
-    fract = theta - (float32_t) ((int32_t) theta);
-  }
-  else
-  {
-    fract = (theta - (float32_t) ((int32_t) theta)) + 1.0f;
-  }
+  float32_t findex;                              /* input value as a table position */
 
   /* index calculation for reading nearest output values */
-  i = (uint32_t) (theta - x1);
+  findex = theta - x1;
+  i = (int32_t) findex;
 
   /* Checking min and max index of table */
   if(i < 0)
@@ -409,6 +401,10 @@ void arm_sin_cos_f32(
     i = 358;
   }
 
+  /* Calculation of fractional part, from the same value as the index,
+   * so that both truncate at the same place */
+  fract = findex - (float32_t) i;
+
   /* reading nearest sine output values */
   y0 = sinTable[i];
   y1 = sinTable[i + 1u];
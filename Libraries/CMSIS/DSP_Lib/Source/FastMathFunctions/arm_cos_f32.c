@@ -207,7 +207,7 @@ static const float32_t cosTable[260] = {
 float32_t arm_cos_f32(
   float32_t x)
 {
-  float32_t cosVal, fract, in;
+  float32_t cosVal, fract, in, findex;
   int32_t index;
   uint32_t tableSize = (uint32_t) TABLE_SIZE;
   float32_t wa, wb, wc, wd;
@@ -235,21 +235,24 @@ float32_t arm_cos_f32(
   in = in - (float32_t) n;
 
   /* Calculation of index of the table */
-  index = (uint32_t) (tableSize * in);
+  findex = (float32_t) tableSize * in;
+  index = (int32_t) findex;
 
-  /* fractional value calculation */
-  fract = ((float32_t) tableSize * in) - (float32_t) index;
-
-  /* Checking min and max index of table */
+  /* Checking min and max index of table: a negative input with a tiny
+   * fractional part maps to in = 1.0f, the end of the last interval */
   if(index < 0)
   {
     index = 0;
   }
-  else if(index > 256)
+  else if(index > 255)
   {
-    index = 256;
+    index = 255;
   }
 
+  /* fractional value calculation, from the same value as the index,
+   * so that both truncate at the same place */
+  fract = findex - (float32_t) index;
+
   /* Initialise table pointer */
   tablePtr = (float32_t *) & cosTable[index];
 
@@ -0,0 +1,223 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_nco_cmplx_q31.c    
+*    
+* Description:  Q31 numerically controlled oscillator with a complex output.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup NCO    
+ * @{    
+ */
+
+/* Sine and cosine of one phase, with 2^32 steps per turn */
+static __INLINE void arm_nco_sample_q31(
+  uint32_t phase,
+  q31_t * pSinVal,
+  q31_t * pCosVal)
+{
+  q31_t s, c, b, h, k, bs, bc;                   /* Table values, residual angle and products */
+  q63_t accS, accC;                              /* Accumulators */
+  uint32_t index;                                /* Table index */
+
+  /* The phase rounded to 9 bits selects the nearest table entry, the cosine a quarter turn further */
+  index = (phase + 0x400000u) >> 23;
+  s = sinTable_q31[index];
+  c = sinTable_q31[(index + (FAST_MATH_TABLE_SIZE / 4u)) & (FAST_MATH_TABLE_SIZE - 1u)];
+
+  /* Residual angle in [-pi/512, pi/512] radians, in 1.38 format: pi * 2^7 per step,
+   * with pi in 3.29 format */
+  b = (q31_t) (((q63_t) ((int32_t) ((phase + 0x400000u) & 0x7FFFFFu) - 0x400000) * 0x6487ED51) >> 22);
+
+  /* b^2 in 1.45 format, and b^2 / 6 */
+  h = (q31_t) (((q63_t) b * b) >> 31);
+  k = (q31_t) (((q63_t) h * 0x15555555) >> 31);
+
+  /* b * cos(a) and b * sin(a) in 2.69 format, and in 1.31 format */
+  accS = (q63_t) b * c;
+  accC = (q63_t) b * s;
+  bc = (q31_t) (accS >> 38);
+  bs = (q31_t) (accC >> 38);
+
+  /* sin(a + b) = sin(a) + b*cos(a) - b^2/2 * sin(a) - b^3/6 * cos(a), and
+   * cos(a + b) = cos(a) - b*sin(a) - b^2/2 * cos(a) + b^3/6 * sin(a), accumulated in 2.62 format */
+  accS = ((((q63_t) s << 31) + (accS >> 7)) - (((q63_t) s * h) >> 15)) - (((q63_t) bc * k) >> 14);
+  accC = ((((q63_t) c << 31) - (accC >> 7)) - (((q63_t) c * h) >> 15)) + (((q63_t) bs * k) >> 14);
+
+  /* Round to 1.31 format, and saturate sin(pi/2) and cos(0) */
+  *pSinVal = clip_q63_to_q31((accS + 0x40000000) >> 31);
+  *pCosVal = clip_q63_to_q31((accC + 0x40000000) >> 31);
+}
+
+/**    
+ * @brief  Q31 NCO with a complex output.    
+ * @param[in,out] *S points to an instance of the Q31 NCO structure.    
+ * @param[in]     *pFreqMod points to the frequency modulation, added to the phase increment, or NULL.    
+ * @param[in]     *pPhaseMod points to the phase modulation, added to the phase of each sample, or NULL.    
+ * @param[out]    *pDst points to the block of complex samples cos(theta) + j*sin(theta), of 2*blockSize values.    
+ * @param[in]     blockSize number of complex samples to generate.    
+ * @return none.    
+ *    
+ * The modulation inputs hold <code>blockSize</code> Q31 values in the units of the phase accumulator.    
+ * The output is in the interleaved format of the complex math functions, {real[0], imag[0], real[1], ...},    
+ * e.g. to shift a complex signal in frequency with arm_cmplx_mult_cmplx_q31().    
+ */
+
+void arm_nco_cmplx_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pFreqMod,
+  q31_t * pPhaseMod,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t ditherMask = S->ditherMask;           /* Dither bits */
+  uint32_t state = S->ditherState;               /* Dither generator */
+  uint32_t ph;                                   /* Phase of the sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if((pFreqMod == NULL) && (pPhaseMod == NULL) && (ditherMask == 0u))
+  {
+    /* Unmodulated carrier without dither */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* The four phases are independent, so that their evaluations can be interleaved */
+      arm_nco_sample_q31(phase, &pDst[1], &pDst[0]);
+      arm_nco_sample_q31(phase + phaseInc, &pDst[3], &pDst[2]);
+      arm_nco_sample_q31(phase + (2u * phaseInc), &pDst[5], &pDst[4]);
+      arm_nco_sample_q31(phase + (3u * phaseInc), &pDst[7], &pDst[6]);
+
+      /* Advance the phase accumulator by four samples */
+      phase += 4u * phaseInc;
+
+      /* update pointer to process next samples */
+      pDst += 8u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(blkCnt > 0u)
+    {
+      arm_nco_sample_q31(phase, &pDst[1], &pDst[0]);
+      pDst += 2u;
+
+      /* Advance the phase accumulator */
+      phase += phaseInc;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Modulated or dithered carrier */
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      /* Phase of the sample, with the phase modulation */
+      ph = phase;
+
+      if(pPhaseMod != NULL)
+      {
+        ph += (uint32_t) * pPhaseMod++;
+      }
+
+      /* Dither from a xorshift generator */
+      if(ditherMask != 0u)
+      {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        ph += state & ditherMask;
+      }
+
+      arm_nco_sample_q31(ph, &pDst[1], &pDst[0]);
+      pDst += 2u;
+
+      /* Advance the phase accumulator, with the frequency modulation */
+      phase += phaseInc;
+
+      if(pFreqMod != NULL)
+      {
+        phase += (uint32_t) * pFreqMod++;
+      }
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Save the phase and the dither generator for the next block */
+  S->phase = phase;
+  S->ditherState = state;
+}
+
+/**    
+ * @} end of NCO group    
+ */
@@ -0,0 +1,217 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_nco_f32.c    
+*    
+* Description:  Floating-point numerically controlled oscillator.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup NCO    
+ * @{    
+ */
+
+/* Sine and cosine of one phase, with 2^32 steps per turn */
+static __INLINE void arm_nco_sample_f32(
+  uint32_t phase,
+  float32_t * pSinVal,
+  float32_t * pCosVal)
+{
+  float32_t s, c, b;                             /* Table values and residual angle */
+  uint32_t index;                                /* Table index */
+
+  /* The phase rounded to 9 bits selects the nearest table entry, the cosine a quarter turn further */
+  index = (phase + 0x400000u) >> 23;
+  s = sinTable_f32[index];
+  c = sinTable_f32[(index + (FAST_MATH_TABLE_SIZE / 4u)) & (FAST_MATH_TABLE_SIZE - 1u)];
+
+  /* Residual angle in [-pi/512, pi/512] radians, 2*pi / 2^32 per step */
+  b = (float32_t) ((int32_t) ((phase + 0x400000u) & 0x7FFFFFu) - 0x400000) * 1.46291807927e-9f;
+
+  /* sin(a + b) = sin(a) * cos(b) + cos(a) * sin(b), with cos(b) = 1 - b^2/2 and sin(b) = b - b^3/6 */
+  *pSinVal = s + (b * (c - (b * ((0.5f * s) + ((b * c) * 0.166666667f)))));
+  *pCosVal = c - (b * (s + (b * ((0.5f * c) - ((b * s) * 0.166666667f)))));
+}
+
+/**    
+ * @brief  Floating-point NCO.    
+ * @param[in,out] *S points to an instance of the floating-point NCO structure.    
+ * @param[in]     *pFreqMod points to the frequency modulation, added to the phase increment, or NULL.    
+ * @param[in]     *pPhaseMod points to the phase modulation, added to the phase of each sample, or NULL.    
+ * @param[out]    *pSin points to the block of sine samples, or NULL.    
+ * @param[out]    *pCos points to the block of cosine samples, or NULL.    
+ * @param[in]     blockSize number of samples to generate.    
+ * @return none.    
+ *    
+ * The modulation inputs hold <code>blockSize</code> Q31 values in the units of the phase accumulator.    
+ */
+
+void arm_nco_f32(
+  arm_nco_instance_f32 * S,
+  q31_t * pFreqMod,
+  q31_t * pPhaseMod,
+  float32_t * pSin,
+  float32_t * pCos,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t ditherMask = S->ditherMask;           /* Dither bits */
+  uint32_t state = S->ditherState;               /* Dither generator */
+  uint32_t ph;                                   /* Phase of the sample */
+  float32_t sinVal, cosVal;                      /* Outputs */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if((pFreqMod == NULL) && (pPhaseMod == NULL) && (ditherMask == 0u) &&
+     (pSin != NULL) && (pCos != NULL))
+  {
+    /* Unmodulated carrier without dither */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* The four phases are independent, so that their evaluations can be interleaved */
+      arm_nco_sample_f32(phase, &pSin[0], &pCos[0]);
+      arm_nco_sample_f32(phase + phaseInc, &pSin[1], &pCos[1]);
+      arm_nco_sample_f32(phase + (2u * phaseInc), &pSin[2], &pCos[2]);
+      arm_nco_sample_f32(phase + (3u * phaseInc), &pSin[3], &pCos[3]);
+
+      /* Advance the phase accumulator by four samples */
+      phase += 4u * phaseInc;
+
+      /* update pointers to process next samples */
+      pSin += 4u;
+      pCos += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(blkCnt > 0u)
+    {
+      arm_nco_sample_f32(phase, pSin++, pCos++);
+
+      /* Advance the phase accumulator */
+      phase += phaseInc;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Modulated or dithered carrier, or a single output */
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      /* Phase of the sample, with the phase modulation */
+      ph = phase;
+
+      if(pPhaseMod != NULL)
+      {
+        ph += (uint32_t) * pPhaseMod++;
+      }
+
+      /* Dither from a xorshift generator */
+      if(ditherMask != 0u)
+      {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        ph += state & ditherMask;
+      }
+
+      arm_nco_sample_f32(ph, &sinVal, &cosVal);
+
+      if(pSin != NULL)
+      {
+        *pSin++ = sinVal;
+      }
+
+      if(pCos != NULL)
+      {
+        *pCos++ = cosVal;
+      }
+
+      /* Advance the phase accumulator, with the frequency modulation */
+      phase += phaseInc;
+
+      if(pFreqMod != NULL)
+      {
+        phase += (uint32_t) * pFreqMod++;
+      }
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Save the phase and the dither generator for the next block */
+  S->phase = phase;
+  S->ditherState = state;
+}
+
+/**    
+ * @} end of NCO group    
+ */
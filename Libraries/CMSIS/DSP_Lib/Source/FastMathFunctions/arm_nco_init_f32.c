@@ -0,0 +1,126 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_nco_init_f32.c    
+*    
+* Description:  Floating-point NCO initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup NCO Numerically Controlled Oscillator    
+ *    
+ * Generates blocks of samples of a sine and cosine carrier, or of the complex exponential    
+ * <code>cos(theta) + j*sin(theta)</code>, from a 32-bit phase accumulator.  The phase is kept in the    
+ * instance structure, so that consecutive blocks continue the carrier without discontinuity, and    
+ * each sample costs a phase addition and a table lookup instead of a call to arm_sin_cos_f32().    
+ *    
+ * \par Phase and frequency    
+ * The phase accumulator wraps around with 2^32 steps per turn.  The frequency is set by the phase    
+ * increment added after each sample:    
+ * <pre>    
+ *     phaseInc = round(frequency / samplingFrequency * 2^32)    
+ * </pre>    
+ * which resolves <code>samplingFrequency / 2^32</code>, about 12 uHz at 48 kHz.  A phase increment above    
+ * 2^31 is a negative frequency.  The field <code>phaseInc</code> of the instance can be changed between    
+ * blocks without a phase discontinuity.    
+ *    
+ * \par Modulation    
+ * Optional Q31 modulation inputs, one value per sample, are in the units of the phase accumulator:    
+ * - the frequency modulation <code>pFreqMod[n]</code> is added to the phase increment after sample n,    
+ *   so that the range [-1 +1) maps to frequency offsets in [-samplingFrequency/2 samplingFrequency/2);    
+ * - the phase modulation <code>pPhaseMod[n]</code> is added to the phase of sample n only, the range    
+ *   [-1 +1) mapping to [-pi pi).    
+ *    
+ * \par Algorithm    
+ * The phase selects one of the 512 entries of <code>sinTable_f32</code>, <code>sinTable_q31</code> or    
+ * <code>sinTable_q15</code>, and the cosine is read a quarter of the table further.    
+ * The floating-point and Q31 versions take the nearest entry and correct it for the rest of the phase,    
+ * an angle <code>b</code> below pi/512 in magnitude, with the angle addition formulas and the Taylor series of    
+ * <code>sin(b)</code> and <code>cos(b)</code> up to the third order, so that the whole 32-bit phase is used.    
+ * The Q15 version interpolates linearly between two table entries, with a 16-bit fraction.    
+ * \par    
+ * The largest errors measured against the double-precision sine and cosine of the phase are:    
+ * <pre>    
+ *     arm_nco_f32     6.0e-8    
+ *     arm_nco_q31     1.6 LSB    
+ *     arm_nco_q15     1.5 LSB    
+ * </pre>    
+ *    
+ * \par Dithering    
+ * With <code>ditherBits</code> greater than zero, a pseudo-random value of that many bits (a 32-bit    
+ * xorshift generator) is added to the phase of each sample before the table lookup.  It does not    
+ * affect the phase accumulator, so the frequency stays exact.  Dithering turns the periodic error of    
+ * the interpolation and of the output quantization, which appears as spurious tones when the period of    
+ * the carrier is a small number of samples, into a noise floor.  It is mostly useful for the Q15 version.    
+ */
+
+/**    
+ * @addtogroup NCO    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point NCO.    
+ * @param[out] *S points to an instance of the floating-point NCO structure.    
+ * @param[in]  phaseInc phase increment per sample, frequency / sampling frequency * 2^32.    
+ * @param[in]  phase initial phase, with 2^32 steps per turn.    
+ * @param[in]  ditherBits number of dither bits added to the phase, 0 to 23; 0 disables the dither.    
+ * @return none.    
+ */
+
+void arm_nco_init_f32(
+  arm_nco_instance_f32 * S,
+  uint32_t phaseInc,
+  uint32_t phase,
+  uint8_t ditherBits)
+{
+  /* Assign the phase accumulator and the frequency */
+  S->phase = phase;
+  S->phaseInc = phaseInc;
+
+  /* Mask of the dither bits, and a non-zero seed for the xorshift generator */
+  S->ditherMask = (ditherBits == 0u) ? 0u : (0xFFFFFFFFu >> (32u - ditherBits));
+  S->ditherState = 0x2545F491u;
+}
+
+/**    
+ * @} end of NCO group    
+ */
@@ -0,0 +1,78 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_nco_init_q31.c    
+*    
+* Description:  Q31 NCO initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup NCO    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q31 NCO.    
+ * @param[out] *S points to an instance of the Q31 NCO structure.    
+ * @param[in]  phaseInc phase increment per sample, frequency / sampling frequency * 2^32.    
+ * @param[in]  phase initial phase, with 2^32 steps per turn.    
+ * @param[in]  ditherBits number of dither bits added to the phase, 0 to 23; 0 disables the dither.    
+ * @return none.    
+ */
+
+void arm_nco_init_q31(
+  arm_nco_instance_q31 * S,
+  uint32_t phaseInc,
+  uint32_t phase,
+  uint8_t ditherBits)
+{
+  /* Assign the phase accumulator and the frequency */
+  S->phase = phase;
+  S->phaseInc = phaseInc;
+
+  /* Mask of the dither bits, and a non-zero seed for the xorshift generator */
+  S->ditherMask = (ditherBits == 0u) ? 0u : (0xFFFFFFFFu >> (32u - ditherBits));
+  S->ditherState = 0x2545F491u;
+}
+
+/**    
+ * @} end of NCO group    
+ */
@@ -209,6 +209,7 @@ float32_t arm_sin_f32(
   float32_t x)
 {
   float32_t sinVal, fract, in;                   /* Temporary variables for input, output */
+  float32_t findex;                              /* Scaled input, for the index and the fraction */
   int32_t index;                                 /* Index variable */
   uint32_t tableSize = (uint32_t) TABLE_SIZE;    /* Initialise tablesize */
   float32_t wa, wb, wc, wd;                      /* Cubic interpolation coefficients */
@@ -236,21 +237,24 @@ float32_t arm_sin_f32(
   in = in - (float32_t) n;
 
   /* Calculation of index of the table */
-  index = (uint32_t) (tableSize * in);
+  findex = (float32_t) tableSize * in;
+  index = (int32_t) findex;
 
-  /* fractional value calculation */
-  fract = ((float32_t) tableSize * in) - (float32_t) index;
-
-  /* Checking min and max index of table */
+  /* Checking min and max index of table: a negative input with a tiny
+   * fractional part maps to in = 1.0f, whose index would read past the table */
   if(index < 0)
   {
     index = 0;
   }
-  else if(index > 256)
+  else if(index > 255)
   {
-    index = 256;
+    index = 255;
   }
 
+  /* fractional value calculation, from the same value as the index,
+   * so that both truncate at the same place */
+  fract = findex - (float32_t) index;
+
   /* Initialise table pointer */
   tablePtr = (float32_t *) & sinTable[index];
 
@@ -0,0 +1,298 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vatan2_f32.c    
+*    
+* Description:  Floating-point vector four-quadrant arctangent function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup vatan2 Vector Four-Quadrant Arctangent    
+ *    
+ * Computes the angle <code>atan2(y, x)</code> of each point <code>(x, y)</code> of two vectors, in (-pi, pi],    
+ * e.g. the phase of IQ samples.  The floating-point version returns radians, the fixed-point Q31    
+ * and Q15 versions return the angle divided by pi in [-1 +1): an angle of pi is returned as -1    
+ * (0x80000000 or 0x8000), which is the same angle.  Shifted right by one bit, the result is an angle    
+ * in the scaling of the inputs of arm_vsin_q31() and arm_vsin_q15().    
+ *    
+ * \par Algorithm    
+ * The smaller of <code>|x|</code> and <code>|y|</code> is divided by the larger; when the ratio exceeds    
+ * <code>tan(pi/8)</code> the point is first rotated by -pi/4, so that the arctangent is evaluated    
+ * in [0, tan(pi/8)] with a minimax odd polynomial: of degree 9 in floating point (Cephes),    
+ * 11 in Q31 and 5 in Q15.  The octant is then restored from the comparison and the signs.    
+ * The Q31 version avoids a 64-bit division: the reciprocal of the normalized larger value is    
+ * a 32-bit quotient with 16 significant bits, refined by one Newton-Raphson iteration.  The Q15    
+ * version uses one 32-bit division.    
+ * \par    
+ * There is no branch on the data in the floating-point version, so the evaluations of consecutive    
+ * samples are interleaved in the FPU pipeline of the Cortex-M4, and in the lanes of the vector unit    
+ * on a host build.    
+ *    
+ * \par Accuracy    
+ * The largest errors measured against the double-precision <code>atan2()</code> are:    
+ * <pre>    
+ *     arm_vatan2_f32     1.1 ulp of pi    
+ *     arm_vatan2_q31     1.4 LSB    
+ *     arm_vatan2_q15     0.9 LSB    
+ * </pre>    
+ * <code>atan2(0, 0)</code> is 0, and the floating-point version follows the signs of zero as    
+ * <code>atan2()</code> does.  Infinite inputs are not supported.    
+ */
+
+/**    
+ * @addtogroup vatan2    
+ * @{    
+ */
+
+/* Four-quadrant arctangent of one point */
+static __INLINE float32_t arm_vatan2_sample_f32(
+  float32_t y,
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } ux, uy, t;                                   /* Floating-point values and their bits */
+  float32_t ax, ay, n, d, a, z;                  /* Temporary variables */
+  uint32_t swap, rot;                            /* Octant */
+
+  /* Absolute values */
+  ux.f = x;
+  uy.f = y;
+  t.u = ux.u & 0x7FFFFFFFu;
+  ax = t.f;
+  t.u = uy.u & 0x7FFFFFFFu;
+  ay = t.f;
+
+  /* n / d is the ratio of the smaller to the larger absolute value */
+  swap = (ay > ax);
+  n = (swap != 0u) ? ax : ay;
+  d = (swap != 0u) ? ay : ax;
+
+  /* Above tan(pi/8), atan(n/d) = pi/4 + atan((n - d) / (n + d)) */
+  rot = (n > (0.414213562f * d));
+  a = (rot != 0u) ? (n - d) : n;
+  d = (rot != 0u) ? (n + d) : d;
+  d = (d == 0.0f) ? 1.0f : d;
+  a = a / d;
+
+  /* Polynomial approximation of the arctangent in [-tan(pi/8), tan(pi/8)] */
+  z = a * a;
+  a = (((((((8.05374449538e-2f * z) - 1.38776856032e-1f) * z) + 1.99777106478e-1f) * z) - 3.33329491539e-1f) * z * a) + a;
+
+  /* Restore the octant, then the quadrant */
+  a = (rot != 0u) ? (a + 0.785398163f) : a;
+  a = (swap != 0u) ? (1.570796327f - a) : a;
+  a = ((ux.u & 0x80000000u) != 0u) ? (3.141592654f - a) : a;
+  t.f = a;
+  t.u ^= uy.u & 0x80000000u;
+
+  return (t.f);
+}
+
+/**    
+ * @brief  Four-quadrant arctangent of the elements of floating-point vectors.    
+ * @param[in]  *pSrcY points to the vector of ordinates (imaginary parts)    
+ * @param[in]  *pSrcX points to the vector of abscissas (real parts)    
+ * @param[out] *pDst points to the output vector, in radians    
+ * @param[in]  blockSize number of samples in the vector    
+ * @return none.    
+ *    
+ * <b>Host build:</b>    
+ * \par    
+ * With ARM_MATH_HOST the samples are processed in the lanes of the vector unit, with the operations of    
+ * the C code in the same order: the results are bit-exact with the C code.    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+__HOST_SIMD_TARGET
+static void arm_vatan2_f32_host(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  __host_vf x, y, ax, ay, n, d, a, z;            /* Temporary vectors */
+  __host_vf one = { 0.0f };                      /* 1.0f in all the lanes */
+  __host_vi swap, rot;                           /* Octants */
+  uint32_t blkCnt;                               /* loop counter */
+
+  one += 1.0f;
+
+  blkCnt = blockSize / __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    y = __HOST_LD(pSrcY);
+    x = __HOST_LD(pSrcX);
+
+    ax = (__host_vf) ((__host_vi) x & 0x7FFFFFFF);
+    ay = (__host_vf) ((__host_vi) y & 0x7FFFFFFF);
+
+    swap = (ay > ax);
+    n = __HOST_SEL(swap, ax, ay);
+    d = __HOST_SEL(swap, ay, ax);
+
+    rot = (n > (0.414213562f * d));
+    a = __HOST_SEL(rot, n - d, n);
+    d = __HOST_SEL(rot, n + d, d);
+    d = __HOST_SEL(d == 0.0f, one, d);
+    a = a / d;
+
+    z = a * a;
+    a = (((((((8.05374449538e-2f * z) - 1.38776856032e-1f) * z) + 1.99777106478e-1f) * z) - 3.33329491539e-1f) * z * a) + a;
+
+    a = __HOST_SEL(rot, a + 0.785398163f, a);
+    a = __HOST_SEL(swap, 1.570796327f - a, a);
+    a = __HOST_SEL((__host_vi) x < 0, 3.141592654f - a, a);
+    a = (__host_vf) ((__host_vi) a ^ ((__host_vi) y & (int32_t) 0x80000000));
+
+    __HOST_ST(pDst, a);
+    pSrcY += __HOST_VLEN;
+    pSrcX += __HOST_VLEN;
+    pDst += __HOST_VLEN;
+
+    blkCnt--;
+  }
+
+  /* Remaining samples */
+  blkCnt = blockSize % __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vatan2_sample_f32(*pSrcY++, *pSrcX++);
+
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t y1, y2, y3, y4;                      /* Temporary input variables */
+  float32_t x1, x2, x3, x4;                      /* Temporary input variables */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+  /* Host build: vector unit */
+  if(__HOST_SIMD_READY())
+  {
+    arm_vatan2_f32_host(pSrcY, pSrcX, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the four inputs before writing any output, so that the four independent
+     * evaluations can be interleaved in the FPU pipeline, also when pDst is pSrcY or pSrcX */
+    y1 = pSrcY[0];
+    x1 = pSrcX[0];
+    y2 = pSrcY[1];
+    x2 = pSrcX[1];
+    y3 = pSrcY[2];
+    x3 = pSrcX[2];
+    y4 = pSrcY[3];
+    x4 = pSrcX[3];
+
+    pDst[0] = arm_vatan2_sample_f32(y1, x1);
+    pDst[1] = arm_vatan2_sample_f32(y2, x2);
+    pDst[2] = arm_vatan2_sample_f32(y3, x3);
+    pDst[3] = arm_vatan2_sample_f32(y4, x4);
+
+    /* update pointers to process next samples */
+    pSrcY += 4u;
+    pSrcX += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vatan2_sample_f32(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vatan2 group    
+ */
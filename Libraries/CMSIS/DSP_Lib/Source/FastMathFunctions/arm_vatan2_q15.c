@@ -0,0 +1,181 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vatan2_q15.c    
+*    
+* Description:  Q15 vector four-quadrant arctangent function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup vatan2    
+ * @{    
+ */
+
+/* Four-quadrant arctangent of one point, divided by pi */
+static __INLINE q15_t arm_vatan2_sample_q15(
+  q15_t y,
+  q15_t x)
+{
+  uint32_t n, d, e;                              /* Temporary variables */
+  uint32_t swap, rot;                            /* Octant */
+  q31_t t, z, p;                                 /* Temporary variables in 17.15 format */
+
+  /* Absolute values, 0x8000 included */
+  n = (uint32_t) ((y < 0) ? -y : y);
+  d = (uint32_t) ((x < 0) ? -x : x);
+
+  /* n / d is the ratio of the smaller to the larger absolute value */
+  swap = (n > d);
+  e = (swap != 0u) ? d : n;
+  d = (swap != 0u) ? n : d;
+  n = e;
+
+  /* Above tan(pi/8), atan(n/d) = pi/4 - atan((d - n) / (d + n)) */
+  rot = ((n << 16) > (d * 27146u));
+  e = (rot != 0u) ? (d - n) : n;
+  d = (rot != 0u) ? (d + n) : d;
+  n = e;
+
+  /* t = n / d in [0, tan(pi/8)], rounded, in 1.15 format */
+  d = (d == 0u) ? 1u : d;
+  t = (q31_t) (((n << 15) + (d >> 1)) / d);
+
+  /* atan(t) / pi = t * p(t^2), with the coefficients of p in 1.15 format and rounded products */
+  z = ((t * t) + 0x4000) >> 15;
+  p = (((0x06C1 * z) + 0x4000) >> 15) - 0x0D7D;
+  p = (((p * z) + 0x4000) >> 15) + 0x28BE;
+  t = ((p * t) + 0x4000) >> 15;
+
+  /* Restore the octant, then the quadrant: pi/4, pi/2 and pi are 0x2000, 0x4000 and 0x8000 */
+  t = (rot != 0u) ? (0x2000 - t) : t;
+  t = (swap != 0u) ? (0x4000 - t) : t;
+  t = (x < 0) ? (0x8000 - t) : t;
+  t = (y < 0) ? -t : t;
+
+  /* pi wraps around to -1 */
+  return ((q15_t) t);
+}
+
+/**    
+ * @brief  Four-quadrant arctangent of the elements of Q15 vectors.    
+ * @param[in]  *pSrcY points to the vector of ordinates (imaginary parts)    
+ * @param[in]  *pSrcX points to the vector of abscissas (real parts)    
+ * @param[out] *pDst points to the output vector, the angle divided by pi    
+ * @param[in]  blockSize number of samples in the vector    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * Only the ratio of the inputs matters, and the full input range is supported, 0x8000 included.    
+ * The ratio and the polynomial are computed in 1.15 format with 32-bit intermediate products, which    
+ * cannot overflow, and the result in [-1 +1) is the angle divided by pi.    
+ */
+
+void arm_vatan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q15_t y1, y2, y3, y4;                          /* Temporary input variables */
+  q15_t x1, x2, x3, x4;                          /* Temporary input variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the four inputs before writing any output, also when pDst is pSrcY or pSrcX */
+    y1 = pSrcY[0];
+    x1 = pSrcX[0];
+    y2 = pSrcY[1];
+    x2 = pSrcX[1];
+    y3 = pSrcY[2];
+    x3 = pSrcX[2];
+    y4 = pSrcY[3];
+    x4 = pSrcX[3];
+
+    pDst[0] = arm_vatan2_sample_q15(y1, x1);
+    pDst[1] = arm_vatan2_sample_q15(y2, x2);
+    pDst[2] = arm_vatan2_sample_q15(y3, x3);
+    pDst[3] = arm_vatan2_sample_q15(y4, x4);
+
+    /* update pointers to process next samples */
+    pSrcY += 4u;
+    pSrcX += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vatan2_sample_q15(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vatan2 group    
+ */
@@ -0,0 +1,247 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vcos_f32.c    
+*    
+* Description:  Floating-point vector cosine function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup vcos Vector Cosine    
+ *    
+ * Computes the cosine of each element of a vector.    
+ * The input to the floating-point version is in radians while the    
+ * fixed-point Q15 and Q31 versions have a scaled input with the range    
+ * [0 +0.9999] mapping to [0 2*pi), as for arm_cos_q31().    
+ *    
+ * \par    
+ * The cosine is computed as the sine of <code>x + pi/2</code>, with the algorithm and the accuracy    
+ * of the \ref vsin functions: the quadrant is advanced by one before the sine or cosine polynomial    
+ * of the reduced argument is selected, so that no accuracy is lost in the addition of <code>pi/2</code>.    
+ */
+
+/**    
+ * @addtogroup vcos    
+ * @{    
+ */
+
+/* Cosine of one sample */
+static __INLINE float32_t arm_vcos_sample_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } t;                                           /* Floating-point value and its bits */
+  float32_t n, r, z, s, c;                       /* Temporary variables */
+  uint32_t q;                                    /* Quadrant */
+
+  /* Adding 1.5*2^23 rounds x*2/pi to the nearest integer n, held in the low bits of t.
+   * The quadrant is n + 1, since cos(x) = sin(x + pi/2) */
+  t.f = (x * 0.636619772f) + 12582912.0f;
+  n = t.f - 12582912.0f;
+  q = t.u + 1u;
+
+  /* r = x - n*pi/2, with pi/2 split in three parts so that the first products are exact */
+  r = ((x - (n * 1.5703125f)) - (n * 4.837512969970703125e-4f)) - (n * 7.54978995489188216e-8f);
+
+  /* Polynomial approximations of sin(r) and cos(r) in [-pi/4, pi/4] */
+  z = r * r;
+  s = ((((-1.9515295891e-4f * z) + 8.3321608736e-3f) * z) - 1.6666654611e-1f) * z * r;
+  s = s + r;
+  c = ((((2.443315711809948e-5f * z) - 1.388731625493765e-3f) * z) + 4.166664568298827e-2f) * z * z;
+  c = (c - (0.5f * z)) + 1.0f;
+
+  /* cos(x) is cos(r), -sin(r), -cos(r) or sin(r) for n = 0, 1, 2 or 3 modulo 4 */
+  t.f = ((q & 1u) != 0u) ? c : s;
+  t.u ^= (q & 2u) << 30;
+
+  return (t.f);
+}
+
+/**    
+ * @brief  Cosine of the elements of a floating-point vector.    
+ * @param[in]  *pSrc points to the input vector, in radians    
+ * @param[out] *pDst points to the output vector    
+ * @param[in]  blockSize number of samples in the vector    
+ * @return none.    
+ *    
+ * <b>Host build:</b>    
+ * \par    
+ * With ARM_MATH_HOST the samples are processed in the lanes of the vector unit, with the operations of    
+ * the C code in the same order: the results are bit-exact with the C code.    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+__HOST_SIMD_TARGET
+static void arm_vcos_f32_host(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  __host_vf x, t, n, r, z, s, c;                 /* Temporary vectors */
+  __host_vi q;                                   /* Quadrants */
+  uint32_t blkCnt;                               /* loop counter */
+
+  blkCnt = blockSize / __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    x = __HOST_LD(pSrc);
+
+    t = (x * 0.636619772f) + 12582912.0f;
+    n = t - 12582912.0f;
+    q = (__host_vi) t + 1;
+
+    r = ((x - (n * 1.5703125f)) - (n * 4.837512969970703125e-4f)) - (n * 7.54978995489188216e-8f);
+
+    z = r * r;
+    s = ((((-1.9515295891e-4f * z) + 8.3321608736e-3f) * z) - 1.6666654611e-1f) * z * r;
+    s = s + r;
+    c = ((((2.443315711809948e-5f * z) - 1.388731625493765e-3f) * z) + 4.166664568298827e-2f) * z * z;
+    c = (c - (0.5f * z)) + 1.0f;
+
+    t = __HOST_SEL((q & 1) != 0, c, s);
+    t = (__host_vf) ((__host_vi) t ^ (((q & 2) != 0) & (int32_t) 0x80000000));
+
+    __HOST_ST(pDst, t);
+    pSrc += __HOST_VLEN;
+    pDst += __HOST_VLEN;
+
+    blkCnt--;
+  }
+
+  /* Remaining samples */
+  blkCnt = blockSize % __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vcos_sample_f32(*pSrc++);
+
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+void arm_vcos_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+  /* Host build: vector unit */
+  if(__HOST_SIMD_READY())
+  {
+    arm_vcos_f32_host(pSrc, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the four inputs before writing any output, so that the four independent
+     * evaluations can be interleaved in the FPU pipeline, also when pDst is pSrc */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_vcos_sample_f32(in1);
+    pDst[1] = arm_vcos_sample_f32(in2);
+    pDst[2] = arm_vcos_sample_f32(in3);
+    pDst[3] = arm_vcos_sample_f32(in4);
+
+    /* update pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vcos_sample_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vcos group    
+ */
@@ -0,0 +1,153 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vcos_q15.c    
+*    
+* Description:  Q15 vector cosine function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup vcos    
+ * @{    
+ */
+
+/* Sine of one angle u, in units of 2^-16 turn, already advanced by a quarter turn */
+static __INLINE q15_t arm_vcos_sample_q15(
+  uint32_t u)
+{
+  q31_t f, z, p, s;                              /* Temporary variables */
+
+  /* Position in the quadrant in 2.14 format, mirrored in the second and fourth quadrants */
+  f = (q31_t) (u & 0x3FFFu);
+  f = ((u & 0x4000u) != 0u) ? (0x4000 - f) : f;
+
+  /* sin(f*pi/2) = f + f * p(f^2), with f^2 in 1.15 format, the coefficients of p in 16.16 format
+   * and rounded products */
+  z = ((f * f) + 0x1000) >> 13;
+  p = (((-0x011C * z) + 0x4000) >> 15) + 0x1456;
+  p = (((p * z) + 0x4000) >> 15) - 0xA559;
+  p = (((p * z) + 0x4000) >> 15) + 0x921F;
+  s = (f << 1) + (((p * f) + 0x4000) >> 15);
+  s = (s > 0x7FFF) ? 0x7FFF : s;
+
+  /* Negative in the third and fourth quadrants */
+  return (((u & 0x8000u) != 0u) ? (q15_t) - s : (q15_t) s);
+}
+
+/**    
+ * @brief  Cosine of the elements of a Q15 vector.    
+ * @param[in]  *pSrc points to the input vector, with the range [0 +0.9999] mapping to [0 2*pi)    
+ * @param[out] *pDst points to the output vector    
+ * @param[in]  blockSize number of samples in the vector    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The input is scaled by 2 into an angle of 2^16 steps per turn, so that negative inputs wrap around,    
+ * and advanced by a quarter turn since cos(x) = sin(x + pi/2).    
+ * The polynomial is evaluated with 32-bit intermediate products, which cannot overflow, and the result    
+ * is converted to 1.15 format, saturating 1.0 to 0x7FFF.    
+ */
+
+void arm_vcos_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t in1, in2, in3, in4;                   /* Temporary input variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the four inputs before writing any output, also when pDst is pSrc.
+     * cos(x) = sin(x + pi/2), a quarter turn is added to each angle */
+    in1 = ((uint32_t) pSrc[0] << 1) + 0x4000u;
+    in2 = ((uint32_t) pSrc[1] << 1) + 0x4000u;
+    in3 = ((uint32_t) pSrc[2] << 1) + 0x4000u;
+    in4 = ((uint32_t) pSrc[3] << 1) + 0x4000u;
+
+    pDst[0] = arm_vcos_sample_q15(in1);
+    pDst[1] = arm_vcos_sample_q15(in2);
+    pDst[2] = arm_vcos_sample_q15(in3);
+    pDst[3] = arm_vcos_sample_q15(in4);
+
+    /* update pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vcos_sample_q15(((uint32_t) (*pSrc++) << 1) + 0x4000u);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vcos group    
+ */
@@ -0,0 +1,157 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vcos_q31.c    
+*    
+* Description:  Q31 vector cosine function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @addtogroup vcos    
+ * @{    
+ */
+
+/* Sine of one angle u, in units of 2^-32 turn, already advanced by a quarter turn */
+static __INLINE q31_t arm_vcos_sample_q31(
+  uint32_t u)
+{
+  q31_t f, z, p;                                 /* Temporary variables in 1.31 format */
+  q63_t s;                                       /* Result */
+
+  /* Position in the quadrant in 1.31 format, mirrored in the second and fourth quadrants.
+   * The end of the quadrant is saturated to 0x7FFFFFFF, where the sine is flat */
+  f = (q31_t) (u & 0x3FFFFFFFu);
+  f = ((u & 0x40000000u) != 0u) ? (0x40000000 - f) : f;
+  f = (f == 0x40000000) ? 0x7FFFFFFF : (f << 1);
+
+  /* sin(f*pi/2) = f + f * p(f^2), with the coefficients of p in 1.31 format and rounded products */
+  z = (q31_t) ((((q63_t) f * f) + 0x40000000) >> 31);
+  p = (q31_t) ((((q63_t) -0x00001CAD * z) + 0x40000000) >> 31) + 0x00054000;
+  p = (q31_t) ((((q63_t) p * z) + 0x40000000) >> 31) - 0x00996847;
+  p = (q31_t) ((((q63_t) p * z) + 0x40000000) >> 31) + 0x0A335DE0;
+  p = (q31_t) ((((q63_t) p * z) + 0x40000000) >> 31) - 0x52AEF38E;
+  p = (q31_t) ((((q63_t) p * z) + 0x40000000) >> 31) + 0x490FDAA2;
+  s = (q63_t) f + ((((q63_t) p * f) + 0x40000000) >> 31);
+  s = (s > 0x7FFFFFFF) ? 0x7FFFFFFF : s;
+
+  /* Negative in the third and fourth quadrants */
+  return (((u & 0x80000000u) != 0u) ? (q31_t) - s : (q31_t) s);
+}
+
+/**    
+ * @brief  Cosine of the elements of a Q31 vector.    
+ * @param[in]  *pSrc points to the input vector, with the range [0 +0.9999] mapping to [0 2*pi)    
+ * @param[out] *pDst points to the output vector    
+ * @param[in]  blockSize number of samples in the vector    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The input is scaled by 2 into an angle of 2^32 steps per turn, so that negative inputs wrap around,    
+ * and advanced by a quarter turn since cos(x) = sin(x + pi/2).    
+ * The polynomial is evaluated in 1.31 format with rounded 64-bit intermediate products, and the result is    
+ * converted to 1.31 format, saturating 1.0 to 0x7FFFFFFF.    
+ */
+
+void arm_vcos_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t in1, in2, in3, in4;                   /* Temporary input variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the four inputs before writing any output, also when pDst is pSrc.
+     * cos(x) = sin(x + pi/2), a quarter turn is added to each angle */
+    in1 = ((uint32_t) pSrc[0] << 1) + 0x40000000u;
+    in2 = ((uint32_t) pSrc[1] << 1) + 0x40000000u;
+    in3 = ((uint32_t) pSrc[2] << 1) + 0x40000000u;
+    in4 = ((uint32_t) pSrc[3] << 1) + 0x40000000u;
+
+    pDst[0] = arm_vcos_sample_q31(in1);
+    pDst[1] = arm_vcos_sample_q31(in2);
+    pDst[2] = arm_vcos_sample_q31(in3);
+    pDst[3] = arm_vcos_sample_q31(in4);
+
+    /* update pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vcos_sample_q31(((uint32_t) (*pSrc++) << 1) + 0x40000000u);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vcos group    
+ */
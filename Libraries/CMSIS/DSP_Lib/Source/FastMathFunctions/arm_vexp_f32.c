@@ -0,0 +1,262 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vexp_f32.c    
+*    
+* Description:  Floating-point vector exponential function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup vexp Vector Exponential    
+ *    
+ * Computes the natural exponential of each element of a floating-point vector.    
+ *    
+ * \par Algorithm    
+ * The input is split into <code>x = n*ln(2) + r</code>, where <code>n</code> is the nearest integer to    
+ * <code>x/ln(2)</code> and <code>r</code> is in [-ln(2)/2, ln(2)/2], with <code>ln(2)</code> in two parts so that    
+ * <code>n*ln(2)</code> is subtracted without rounding error.  <code>exp(r)</code> is computed with a minimax polynomial    
+ * of degree 7 (Cephes) and scaled by <code>2^n</code>, built in the exponent field in two factors so that    
+ * the results below FLT_MIN are rounded to subnormal numbers once.    
+ * \par    
+ * There is no branch on the data, so the evaluations of consecutive samples are interleaved in    
+ * the FPU pipeline of the Cortex-M4, and in the lanes of the vector unit on a host build.    
+ *    
+ * \par Accuracy    
+ * The largest error measured against the double-precision <code>exp()</code> is 1.0 ulp.    
+ * The results overflow to +infinity above 88.72 and underflow to zero below -103.97,    
+ * a NaN input gives a NaN output.    
+ */
+
+/**    
+ * @addtogroup vexp    
+ * @{    
+ */
+
+/* Exponential of one sample */
+static __INLINE float32_t arm_vexp_sample_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } t, s1, s2;                                   /* Floating-point values and their bits */
+  float32_t n, r, z, p;                          /* Temporary variables */
+  int32_t k;                                     /* Power of two */
+
+  /* Limit the input to the range where 2^n is at most 2^129, a NaN goes through */
+  x = (x > 88.8f) ? 88.8f : x;
+  x = (x < -104.0f) ? -104.0f : x;
+
+  /* Adding 1.5*2^23 rounds x/ln(2) to the nearest integer n, held in the low bits of t */
+  t.f = (x * 1.44269504089f) + 12582912.0f;
+  n = t.f - 12582912.0f;
+  k = t.i - 0x4B400000;
+
+  /* r = x - n*ln(2), with ln(2) split in two parts so that the first product is exact */
+  r = (x - (n * 0.693359375f)) - (n * -2.12194440e-4f);
+
+  /* Polynomial approximation of exp(r) in [-ln(2)/2, ln(2)/2] */
+  z = r * r;
+  p = ((((((1.9875691500e-4f * r) + 1.3981999507e-3f) * r) + 8.3334519073e-3f) * r) + 4.1665795894e-2f) * r;
+  p = ((((p + 1.6666665459e-1f) * r) + 5.0000001201e-1f) * z) + r;
+  p = p + 1.0f;
+
+  /* 2^n is the product of two normal numbers, 2^(n/2) and 2^(n - n/2) */
+  s1.i = (((k >> 1) + 127) & 0xFF) << 23;
+  s2.i = (((k - (k >> 1)) + 127) & 0xFF) << 23;
+
+  return ((p * s1.f) * s2.f);
+}
+
+/**    
+ * @brief  Exponential of the elements of a floating-point vector.    
+ * @param[in]  *pSrc points to the input vector    
+ * @param[out] *pDst points to the output vector    
+ * @param[in]  blockSize number of samples in the vector    
+ * @return none.    
+ *    
+ * <b>Host build:</b>    
+ * \par    
+ * With ARM_MATH_HOST the samples are processed in the lanes of the vector unit, with the operations of    
+ * the C code in the same order: the results are bit-exact with the C code.    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+__HOST_SIMD_TARGET
+static void arm_vexp_f32_host(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  __host_vf x, t, n, r, z, p;                    /* Temporary vectors */
+  __host_vf xMax = { 0.0f }, xMin = { 0.0f };    /* Limits of the input */
+  __host_vi k, s1, s2;                           /* Powers of two */
+  uint32_t blkCnt;                               /* loop counter */
+
+  xMax += 88.8f;
+  xMin -= 104.0f;
+
+  blkCnt = blockSize / __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    x = __HOST_LD(pSrc);
+
+    x = __HOST_SEL(x > xMax, xMax, x);
+    x = __HOST_SEL(x < xMin, xMin, x);
+
+    t = (x * 1.44269504089f) + 12582912.0f;
+    n = t - 12582912.0f;
+    k = (__host_vi) t - 0x4B400000;
+
+    r = (x - (n * 0.693359375f)) - (n * -2.12194440e-4f);
+
+    z = r * r;
+    p = ((((((1.9875691500e-4f * r) + 1.3981999507e-3f) * r) + 8.3334519073e-3f) * r) + 4.1665795894e-2f) * r;
+    p = ((((p + 1.6666665459e-1f) * r) + 5.0000001201e-1f) * z) + r;
+    p = p + 1.0f;
+
+    s1 = (((k >> 1) + 127) & 0xFF) << 23;
+    s2 = (((k - (k >> 1)) + 127) & 0xFF) << 23;
+
+    __HOST_ST(pDst, (p * (__host_vf) s1) * (__host_vf) s2);
+    pSrc += __HOST_VLEN;
+    pDst += __HOST_VLEN;
+
+    blkCnt--;
+  }
+
+  /* Remaining samples */
+  blkCnt = blockSize % __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vexp_sample_f32(*pSrc++);
+
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+  /* Host build: vector unit */
+  if(__HOST_SIMD_READY())
+  {
+    arm_vexp_f32_host(pSrc, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the four inputs before writing any output, so that the four independent
+     * evaluations can be interleaved in the FPU pipeline, also when pDst is pSrc */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_vexp_sample_f32(in1);
+    pDst[1] = arm_vexp_sample_f32(in2);
+    pDst[2] = arm_vexp_sample_f32(in3);
+    pDst[3] = arm_vexp_sample_f32(in4);
+
+    /* update pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vexp_sample_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vexp group    
+ */
@@ -0,0 +1,277 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vlog_f32.c    
+*    
+* Description:  Floating-point vector natural logarithm function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup vlog Vector Natural Logarithm    
+ *    
+ * Computes the natural logarithm of each element of a floating-point vector.    
+ *    
+ * \par Algorithm    
+ * The input is split into <code>x = m * 2^e</code>, with <code>m</code> in [sqrt(2)/2, sqrt(2)), by reading the    
+ * exponent field; subnormal inputs are first scaled by <code>2^23</code>.  <code>log(m)</code> is computed with    
+ * a minimax polynomial of degree 10 in <code>f = m - 1</code> (Cephes), and <code>e*ln(2)</code>, with <code>ln(2)</code> in    
+ * two parts, is added last.    
+ * \par    
+ * There is no branch on the data, so the evaluations of consecutive samples are interleaved in    
+ * the FPU pipeline of the Cortex-M4, and in the lanes of the vector unit on a host build.    
+ *    
+ * \par Accuracy    
+ * The largest error measured against the double-precision <code>log()</code> is 0.8 ulp.    
+ * <code>log(0)</code> is -infinity, <code>log(+infinity)</code> is +infinity, and a negative or NaN input    
+ * gives a NaN output.    
+ */
+
+/**    
+ * @addtogroup vlog    
+ * @{    
+ */
+
+/* Natural logarithm of one sample */
+static __INLINE float32_t arm_vlog_sample_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } t;                                           /* Floating-point value and its bits */
+  float32_t m, f, z, y, e;                       /* Temporary variables */
+  int32_t k;                                     /* Exponent */
+
+  /* Scale the subnormal inputs by 2^23 into the normal range */
+  t.f = (x < 1.17549435e-38f) ? (x * 8388608.0f) : x;
+  k = (x < 1.17549435e-38f) ? -23 : 0;
+
+  /* x = m * 2^k, with m in [0.5, 1) */
+  k += ((t.i >> 23) & 0xFF) - 126;
+  t.i = (t.i & 0x007FFFFF) | 0x3F000000;
+  m = t.f;
+
+  /* Move m to [sqrt(2)/2, sqrt(2)) and take f = m - 1 */
+  k = (m < 0.707106781f) ? (k - 1) : k;
+  m = (m < 0.707106781f) ? (m + m) : m;
+  f = m - 1.0f;
+  e = (float32_t) k;
+
+  /* Polynomial approximation of log(1 + f) - f + f^2/2 */
+  z = f * f;
+  y = ((((((7.0376836292e-2f * f) - 1.1514610310e-1f) * f) + 1.1676998740e-1f) * f) - 1.2420140846e-1f) * f;
+  y = ((((((y + 1.4249322787e-1f) * f) - 1.6668057665e-1f) * f) + 2.0000714765e-1f) * f) - 2.4999993993e-1f;
+  y = (((y * f) + 3.3333331174e-1f) * f) * z;
+
+  /* log(x) = f - f^2/2 + y + k*ln(2), with ln(2) split in two parts */
+  y = y + (e * -2.12194440e-4f);
+  y = y - (0.5f * z);
+  y = f + y;
+  y = y + (e * 0.693359375f);
+
+  /* log(0) = -infinity, log(+infinity) = +infinity, log(x) = NaN for a negative or NaN x */
+  t.i = (x == 0.0f) ? (int32_t) 0xFF800000 : 0x7FC00000;
+  y = (x > 0.0f) ? y : t.f;
+  y = (x > 3.40282347e+38f) ? x : y;
+
+  return (y);
+}
+
+/**    
+ * @brief  Natural logarithm of the elements of a floating-point vector.    
+ * @param[in]  *pSrc points to the input vector    
+ * @param[out] *pDst points to the output vector    
+ * @param[in]  blockSize number of samples in the vector    
+ * @return none.    
+ *    
+ * <b>Host build:</b>    
+ * \par    
+ * With ARM_MATH_HOST the samples are processed in the lanes of the vector unit, with the operations of    
+ * the C code in the same order: the results are bit-exact with the C code.    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+__HOST_SIMD_TARGET
+static void arm_vlog_f32_host(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  __host_vf x, t, m, f, z, y, e;                 /* Temporary vectors */
+  __host_vi k, small, lowM;                      /* Exponents and lane masks */
+  uint32_t blkCnt;                               /* loop counter */
+
+  blkCnt = blockSize / __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    x = __HOST_LD(pSrc);
+
+    small = (x < 1.17549435e-38f);
+    t = __HOST_SEL(small, x * 8388608.0f, x);
+    k = small & -23;
+
+    k += (((__host_vi) t >> 23) & 0xFF) - 126;
+    m = (__host_vf) (((__host_vi) t & 0x007FFFFF) | 0x3F000000);
+
+    lowM = (m < 0.707106781f);
+    k = k + lowM;
+    m = __HOST_SEL(lowM, m + m, m);
+    f = m - 1.0f;
+    e = __builtin_convertvector(k, __host_vf);
+
+    z = f * f;
+    y = ((((((7.0376836292e-2f * f) - 1.1514610310e-1f) * f) + 1.1676998740e-1f) * f) - 1.2420140846e-1f) * f;
+    y = ((((((y + 1.4249322787e-1f) * f) - 1.6668057665e-1f) * f) + 2.0000714765e-1f) * f) - 2.4999993993e-1f;
+    y = (((y * f) + 3.3333331174e-1f) * f) * z;
+
+    y = y + (e * -2.12194440e-4f);
+    y = y - (0.5f * z);
+    y = f + y;
+    y = y + (e * 0.693359375f);
+
+    t = (__host_vf) (((x == 0.0f) & (int32_t) 0xFF800000) | (~(x == 0.0f) & 0x7FC00000));
+    y = __HOST_SEL(x > 0.0f, y, t);
+    y = __HOST_SEL(x > 3.40282347e+38f, x, y);
+
+    __HOST_ST(pDst, y);
+    pSrc += __HOST_VLEN;
+    pDst += __HOST_VLEN;
+
+    blkCnt--;
+  }
+
+  /* Remaining samples */
+  blkCnt = blockSize % __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vlog_sample_f32(*pSrc++);
+
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+  /* Host build: vector unit */
+  if(__HOST_SIMD_READY())
+  {
+    arm_vlog_f32_host(pSrc, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the four inputs before writing any output, so that the four independent
+     * evaluations can be interleaved in the FPU pipeline, also when pDst is pSrc */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_vlog_sample_f32(in1);
+    pDst[1] = arm_vlog_sample_f32(in2);
+    pDst[2] = arm_vlog_sample_f32(in3);
+    pDst[3] = arm_vlog_sample_f32(in4);
+
+    /* update pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vlog_sample_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vlog group    
+ */
@@ -0,0 +1,264 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vsin_f32.c    
+*    
+* Description:  Floating-point vector sine function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup vsin Vector Sine    
+ *    
+ * Computes the sine of each element of a vector.    
+ * The input to the floating-point version is in radians while the    
+ * fixed-point Q15 and Q31 versions have a scaled input with the range    
+ * [0 +0.9999] mapping to [0 2*pi), as for arm_sin_q31().  The fixed-point    
+ * inputs wrap around, so that a negative value gives the sine of the    
+ * corresponding negative angle.    
+ *    
+ * \par Algorithm    
+ * The input is reduced to <code>r = x - n*pi/2</code> in [-pi/4, pi/4], and the sine    
+ * is <code>sin(r)</code>, <code>cos(r)</code>, <code>-sin(r)</code> or <code>-cos(r)</code> depending    
+ * on <code>n</code> modulo 4.  The floating-point version subtracts <code>n*pi/2</code> in three parts    
+ * (Cody and Waite), and uses minimax polynomials of degree 7 for <code>sin(r)</code> and 8 for    
+ * <code>cos(r)</code> (Cephes).  The fixed-point versions use an odd polynomial of    
+ * <code>t</code> in [0, 1] for <code>sin(t*pi/2)</code>, with 6 coefficients in Q31 and 4 in Q15.    
+ * \par    
+ * There is no table lookup and no branch on the data, so the evaluations of consecutive samples are    
+ * interleaved in the FPU pipeline of the Cortex-M4, and in the lanes of the vector unit on a host build.    
+ *    
+ * \par Accuracy    
+ * The largest errors measured against the double-precision <code>sin()</code> are:    
+ * <pre>    
+ *     arm_vsin_f32   |x| <= 8192         7.7e-8 absolute, 1.3 ulp relative to max(|sin(x)|, 0.5)    
+ *     arm_vsin_q31   full input range     2.6 LSB    
+ *     arm_vsin_q15   full input range     1.1 LSB    
+ * </pre>    
+ * Beyond |x| = 8192 the error of the range reduction grows with |x|.  The floating-point input must    
+ * be smaller than 4e6 in magnitude.    
+ */
+
+/**    
+ * @addtogroup vsin    
+ * @{    
+ */
+
+/* Sine of one sample */
+static __INLINE float32_t arm_vsin_sample_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } t;                                           /* Floating-point value and its bits */
+  float32_t n, r, z, s, c;                       /* Temporary variables */
+  uint32_t q;                                    /* Quadrant */
+
+  /* Adding 1.5*2^23 rounds x*2/pi to the nearest integer n, held in the low bits of t */
+  t.f = (x * 0.636619772f) + 12582912.0f;
+  n = t.f - 12582912.0f;
+  q = t.u;
+
+  /* r = x - n*pi/2, with pi/2 split in three parts so that the first products are exact */
+  r = ((x - (n * 1.5703125f)) - (n * 4.837512969970703125e-4f)) - (n * 7.54978995489188216e-8f);
+
+  /* Polynomial approximations of sin(r) and cos(r) in [-pi/4, pi/4] */
+  z = r * r;
+  s = ((((-1.9515295891e-4f * z) + 8.3321608736e-3f) * z) - 1.6666654611e-1f) * z * r;
+  s = s + r;
+  c = ((((2.443315711809948e-5f * z) - 1.388731625493765e-3f) * z) + 4.166664568298827e-2f) * z * z;
+  c = (c - (0.5f * z)) + 1.0f;
+
+  /* sin(x) is sin(r), cos(r), -sin(r) or -cos(r) for n = 0, 1, 2 or 3 modulo 4 */
+  t.f = ((q & 1u) != 0u) ? c : s;
+  t.u ^= (q & 2u) << 30;
+
+  return (t.f);
+}
+
+/**    
+ * @brief  Sine of the elements of a floating-point vector.    
+ * @param[in]  *pSrc points to the input vector, in radians    
+ * @param[out] *pDst points to the output vector    
+ * @param[in]  blockSize number of samples in the vector    
+ * @return none.    
+ *    
+ * <b>Host build:</b>    
+ * \par    
+ * With ARM_MATH_HOST the samples are processed in the lanes of the vector unit, with the operations of    
+ * the C code in the same order: the results are bit-exact with the C code.    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+__HOST_SIMD_TARGET
+static void arm_vsin_f32_host(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  __host_vf x, t, n, r, z, s, c;                 /* Temporary vectors */
+  __host_vi q;                                   /* Quadrants */
+  uint32_t blkCnt;                               /* loop counter */
+
+  blkCnt = blockSize / __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    x = __HOST_LD(pSrc);
+
+    t = (x * 0.636619772f) + 12582912.0f;
+    n = t - 12582912.0f;
+    q = (__host_vi) t;
+
+    r = ((x - (n * 1.5703125f)) - (n * 4.837512969970703125e-4f)) - (n * 7.54978995489188216e-8f);
+
+    z = r * r;
+    s = ((((-1.9515295891e-4f * z) + 8.3321608736e-3f) * z) - 1.6666654611e-1f) * z * r;
+    s = s + r;
+    c = ((((2.443315711809948e-5f * z) - 1.388731625493765e-3f) * z) + 4.166664568298827e-2f) * z * z;
+    c = (c - (0.5f * z)) + 1.0f;
+
+    t = __HOST_SEL((q & 1) != 0, c, s);
+    t = (__host_vf) ((__host_vi) t ^ (((q & 2) != 0) & (int32_t) 0x80000000));
+
+    __HOST_ST(pDst, t);
+    pSrc += __HOST_VLEN;
+    pDst += __HOST_VLEN;
+
+    blkCnt--;
+  }
+
+  /* Remaining samples */
+  blkCnt = blockSize % __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vsin_sample_f32(*pSrc++);
+
+    blkCnt--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+void arm_vsin_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+  /* Host build: vector unit */
+  if(__HOST_SIMD_READY())
+  {
+    arm_vsin_f32_host(pSrc, pDst, blockSize);
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the four inputs before writing any output, so that the four independent
+     * evaluations can be interleaved in the FPU pipeline, also when pDst is pSrc */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_vsin_sample_f32(in1);
+    pDst[1] = arm_vsin_sample_f32(in2);
+    pDst[2] = arm_vsin_sample_f32(in3);
+    pDst[3] = arm_vsin_sample_f32(in4);
+
+    /* update pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_vsin_sample_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of vsin group    
+ */
@@ -0,0 +1,249 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_vsqrt_f32.c    
+*    
+* Description:  Floating-point vector square root function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFastMath    
+ */
+
+/**    
+ * @defgroup vsqrt Vector Square Root    
+ *    
+ * Computes the square root of each element of a floating-point vector.    
+ *    
+ * \par    
+ * The result is correctly rounded: the square root instruction of the FPU is used on a Cortex-M4    
+ * with FPU, four samples per iteration so that the loads and stores overlap the computation,    
+ * and the square root instruction of the vector unit on a host build.  As with arm_sqrt_f32(),    
+ * a negative input gives a zero output; a NaN input too.    
+ */
+
+/**    
+ * @addtogroup vsqrt    
+ * @{    
+ */
+
+/* Square root of one sample, zero for a negative or NaN input */
+static __INLINE float32_t arm_vsqrt_sample_f32(
+  float32_t in)
+{
+  float32_t out = 0.0f;                          /* Temporary result */
+
+  if(in >= 0.0f)
+  {
+#if (__FPU_USED == 1) && defined ( __CC_ARM   )
+    out = __sqrtf(in);
+#else
+    out = sqrtf(in);
+#endif
+  }
+
+  return (out);
+}
+
+/**    
+ * @brief  Square root of the elements of a floating-point vector.    
+ * @param[in]  *pSrc points to the input vector    
+ * @param[out] *pDst points to the output vector    
+ * @param[in]  blockSize number of samples in the vector    
+ * @return The function returns ARM_MATH_SUCCESS if all the inputs are zero or positive, or ARM_MATH_ARGUMENT_ERROR    
+ * if one of them is negative or NaN; the outputs of these are zero.    
+ *    
+ * <b>Host build:</b>    
+ * \par    
+ * With ARM_MATH_HOST the samples are processed in the lanes of the vector unit.  The square root is correctly    
+ * rounded in both, so the results are bit-exact with the C code.    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+__HOST_SIMD_TARGET
+static arm_status arm_vsqrt_f32_host(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  __host_vf x;                                   /* Temporary vector */
+  __host_vi valid, invalid = { 0 };              /* Lane masks of the valid and invalid inputs */
+  arm_status status = ARM_MATH_SUCCESS;          /* Result of the checks of the inputs */
+  uint32_t blkCnt, i;                            /* loop counters */
+
+  blkCnt = blockSize / __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    x = __HOST_LD(pSrc);
+
+    /* Zero in the lanes of the negative and NaN inputs */
+    valid = (x >= 0.0f);
+    invalid |= ~valid;
+    x = (__host_vf) ((__host_vi) x & valid);
+
+    __HOST_ST(pDst, __HOST_SQRT(x));
+    pSrc += __HOST_VLEN;
+    pDst += __HOST_VLEN;
+
+    blkCnt--;
+  }
+
+  for (i = 0u; i < __HOST_VLEN; i++)
+  {
+    if(invalid[i] != 0)
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+  }
+
+  /* Remaining samples */
+  blkCnt = blockSize % __HOST_VLEN;
+
+  while(blkCnt > 0u)
+  {
+    if(!(*pSrc >= 0.0f))
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    *pDst++ = arm_vsqrt_sample_f32(*pSrc++);
+
+    blkCnt--;
+  }
+
+  return (status);
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+arm_status arm_vsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  arm_status status = ARM_MATH_SUCCESS;          /* Result of the checks of the inputs */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+  /* Host build: vector unit */
+  if(__HOST_SIMD_READY())
+  {
+    return (arm_vsqrt_f32_host(pSrc, pDst, blockSize));
+  }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the four inputs before writing any output, so that the loads and stores
+     * overlap the square roots, also when pDst is pSrc */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pDst[0] = arm_vsqrt_sample_f32(in1);
+    pDst[1] = arm_vsqrt_sample_f32(in2);
+    pDst[2] = arm_vsqrt_sample_f32(in3);
+    pDst[3] = arm_vsqrt_sample_f32(in4);
+
+    /* Check for negative or NaN inputs */
+    if(!((in1 >= 0.0f) && (in2 >= 0.0f) && (in3 >= 0.0f) && (in4 >= 0.0f)))
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* update pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    /* Check for a negative or NaN input */
+    if(!(*pSrc >= 0.0f))
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    *pDst++ = arm_vsqrt_sample_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  return (status);
+}
+
+/**    
+ * @} end of vsqrt group    
+ */
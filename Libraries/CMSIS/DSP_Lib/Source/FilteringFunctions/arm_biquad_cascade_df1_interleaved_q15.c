@@ -0,0 +1,166 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_biquad_cascade_df1_interleaved_q15.c    
+*    
+* Description:  Processing function for the Q15 interleaved multichannel Biquad cascade filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeDF1    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q15 interleaved multichannel Biquad cascade filter.    
+ * @param[in]  *S        points to an instance of the Q15 interleaved Biquad cascade structure.    
+ * @param[in]  *pSrc     points to the block of input frames.    
+ * @param[out] *pDst     points to the block of output frames.    
+ * @param[in]  blockSize number of frames to process.    
+ * @return none.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * Filters <code>S->numChans</code> channels with the same coefficients.  The samples of all the channels    
+ * at one instant make a frame and the buffers hold consecutive frames:    
+ * <pre>    
+ *    {x0[0], x1[0], ..., x0[1], x1[1], ...}    
+ * </pre>    
+ * Each channel gives the same results as <code>arm_biquad_cascade_df1_q15()</code> on its own samples,    
+ * without deinterleaving the buffers.  Each stage filters the channels one after the other, with the    
+ * state of the channel in registers, and the frames in place in <code>pDst</code> after the first stage.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * As with <code>arm_biquad_cascade_df1_q15()</code>, the products are accumulated in a 64-bit accumulator    
+ * in 34.30 format, which is shifted by <code>15-postShift</code> bits and saturated to 1.15 format.    
+ */
+
+void arm_biquad_cascade_df1_interleaved_q15(
+  const arm_biquad_casd_df1_interleaved_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /* Source pointer */
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *px, *py;                                /* Input and output of a channel */
+  q15_t b0, b1, b2, a1, a2;                      /* Filter coefficients */
+  q15_t Xn, Xn1, Xn2, Yn1, Yn2;                  /* Input and state variables */
+  q15_t out;                                     /* Output sample */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t lShift = 15u - (uint32_t) S->postShift; /* Shift to be applied to the output */
+  uint16_t numChans = S->numChans;               /* Number of channels, distance between two frames */
+  uint32_t sample, ch, stage = S->numStages;     /* Loop counters */
+
+  do
+  {
+    /* Reading the coefficients */
+    /* pCoeffs[1] is the 0 coefficient of the packed format */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+
+    for (ch = 0u; ch < numChans; ch++)
+    {
+      /* Reading the state values of the channel: x[n-1] of all the channels, then x[n-2], y[n-1] and y[n-2] */
+      Xn1 = pState[ch];
+      Xn2 = pState[numChans + ch];
+      Yn1 = pState[(2u * numChans) + ch];
+      Yn2 = pState[(3u * numChans) + ch];
+
+      px = pIn + ch;
+      py = pDst + ch;
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *px;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 * Xn;
+        acc += (q63_t) b1 * Xn1;
+        acc += (q63_t) b2 * Xn2;
+        acc += (q63_t) a1 * Yn1;
+        acc += (q63_t) a2 * Yn2;
+
+        /* The result is converted to 1.15 and saturated */
+        out = (q15_t) __SSAT((q31_t) (acc >> lShift), 16);
+        /* Every time after the output is computed state should be updated. */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = out;
+
+        /* Store the output in the destination buffer. */
+        *py = out;
+
+        px += numChans;
+        py += numChans;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the pState array */
+      pState[ch] = Xn1;
+      pState[numChans + ch] = Xn2;
+      pState[(2u * numChans) + ch] = Yn1;
+      pState[(3u * numChans) + ch] = Yn2;
+    }
+
+    /* The first stage goes from the input buffer to the output buffer. */
+    /* Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    pCoeffs += 6u;
+    pState += 4u * numChans;
+
+  } while(--stage);
+}
+
+/**    
+ * @} end of BiquadCascadeDF1 group    
+ */
@@ -50,7 +50,7 @@
 * This set of functions implements arbitrary order recursive (IIR) filters using a transposed direct form II structure.       
 * The filters are implemented as a cascade of second order Biquad sections.       
 * These functions provide a slight memory savings as compared to the direct form I Biquad filter functions.      
-* Only floating-point data is supported.       
+* Only floating-point data is supported, in single and double precision.       
 *       
 * This function operate on blocks of input and output data and each call to the function       
 * processes <code>blockSize</code> samples through the filter.       
@@ -133,8 +133,93 @@
 * where <code>numStages</code> is the number of Biquad stages in the filter; <code>pState</code> is the address of the state buffer.       
 * <code>pCoeffs</code> is the address of the coefficient buffer;        
 *       
+* \par Host Build       
+* With ARM_MATH_HOST, groups of 2 to 4 stages are computed together, one stage per vector lane:       
+* at each step lane <code>s</code> filters the output that lane <code>s-1</code> produced at the previous step.       
+* Every stage still computes the difference equation above in the same order, so the results are bit-exact.       
+*       
+*/
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+/*       
+* Host build: filters blockSize samples through numLanes (1 to 4) stages, one stage per vector lane.       
+* Lane s processes sample t - s at step t; during the first and the last numLanes - 1 steps the lanes       
+* that have no sample to process keep their state.       
 */
 
+static void arm_biquad_cascade_df2T_f32_host4(
+const float32_t * pCoeffs,
+float32_t * pState,
+const float32_t * pIn,
+float32_t * pOut,
+uint32_t numLanes,
+uint32_t blockSize)
+{
+   __host_v4f b0 = { 0.0f }, b1 = { 0.0f }, b2 = { 0.0f };   /*  Filter coefficients       */
+   __host_v4f a1 = { 0.0f }, a2 = { 0.0f };
+   __host_v4f d1 = { 0.0f }, d2 = { 0.0f };       /*  state variables           */
+   __host_v4f Xn = { 0.0f }, acc, d1n, d2n;       /*  input, output and new state */
+   const __host_v4i lane = { 0, 1, 2, 3 };
+   __host_v4i valid;                              /*  lanes with a sample       */
+   uint32_t last = numLanes - 1u;                 /*  lane of the last stage    */
+   uint32_t s, t;
+
+   for (s = 0u; s < numLanes; s++)
+   {
+      b0[s] = pCoeffs[5u * s];
+      b1[s] = pCoeffs[5u * s + 1u];
+      b2[s] = pCoeffs[5u * s + 2u];
+      a1[s] = pCoeffs[5u * s + 3u];
+      a2[s] = pCoeffs[5u * s + 4u];
+      d1[s] = pState[2u * s];
+      d2[s] = pState[2u * s + 1u];
+   }
+
+   Xn[0] = pIn[0];
+
+   for (t = 0u; t < blockSize + last; t++)
+   {
+      /* y[n] = b0 * x[n] + d1 */
+      acc = (b0 * Xn) + d1;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1n = ((b1 * Xn) + (a1 * acc)) + d2;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2n = (b2 * Xn) + (a2 * acc);
+
+      if((t >= last) && (t < blockSize))
+      {
+         d1 = d1n;
+         d2 = d2n;
+      }
+      else
+      {
+         valid = (lane <= (int32_t) t) & ((lane + (int32_t) blockSize) > (int32_t) t);
+         d1 = __HOST_SEL4(valid, d1n, d1);
+         d2 = __HOST_SEL4(valid, d2n, d2);
+      }
+
+      if(t >= last)
+      {
+         pOut[t - last] = acc[last];
+      }
+
+      /* Each stage takes the output of the previous one, the first stage the next input */
+      Xn = __HOST_SHUF4(acc, acc, 0, 0, 1, 2);
+      Xn[0] = (t + 1u < blockSize) ? pIn[t + 1u] : 0.0f;
+   }
+
+   for (s = 0u; s < numLanes; s++)
+   {
+      pState[2u * s] = d1[s];
+      pState[2u * s + 1u] = d2[s];
+   }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
 /**       
 * @addtogroup BiquadCascadeDF2T       
 * @{       
@@ -176,6 +261,27 @@ uint32_t blockSize)
 
    float32_t p0, p1, p2, p3, p4, A1;
 
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+   /* Host build: groups of 2 to 4 stages are computed with the vector unit */
+   while((stage > 1u) && (blockSize > 0u))
+   {
+      sample = (stage > 4u) ? 4u : stage;
+      arm_biquad_cascade_df2T_f32_host4(pCoeffs, pState, pIn, pDst, sample, blockSize);
+
+      pCoeffs += 5u * sample;
+      pState += 2u * sample;
+      pIn = pDst;
+      stage -= sample;
+   }
+
+   if(stage == 0u)
+   {
+      return;
+   }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
    /* Run the below code for Cortex-M4 and Cortex-M3 */
    do
    {
@@ -0,0 +1,212 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_biquad_cascade_df2T_f64.c    
+*    
+* Description:  Processing function for the double-precision floating-point transposed direct form II Biquad cascade filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeDF2T    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the double-precision floating-point transposed direct form II Biquad cascade filter.    
+ * @param[in]  *S        points to an instance of the filter data structure.    
+ * @param[in]  *pSrc     points to the block of input data.    
+ * @param[out] *pDst     points to the block of output data    
+ * @param[in]  blockSize number of samples to process.    
+ * @return none.    
+ *    
+ * \par    
+ * The double-precision filter is meant for the stages that single precision cannot realise: low cutoff    
+ * frequencies at high sample rates and high Q, whose poles are so close to the unit circle that the    
+ * float32 coefficients and states lose the response or make the filter unstable.    
+ * No Cortex-M core of this library has a double-precision FPU: the operations are emulated in software.    
+ */
+
+void arm_biquad_cascade_df2T_f64(
+  const arm_biquad_cascade_df2T_instance_f64 * S,
+  float64_t * pSrc,
+  float64_t * pDst,
+  uint32_t blockSize)
+{
+  float64_t *pIn = pSrc;                         /* source pointer */
+  float64_t *pOut = pDst;                        /* destination pointer */
+  float64_t *pState = S->pState;                 /* State pointer */
+  float64_t *pCoeffs = S->pCoeffs;               /* coefficient pointer */
+  float64_t acc1;                                /* accumulator */
+  float64_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+  float64_t Xn1;                                 /* temporary input */
+  float64_t d1, d2;                              /* state variables */
+  uint32_t sample, stage = S->numStages;         /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float64_t Xn2, Xn3, Xn4;                       /* Input State variables */
+  float64_t acc2, acc3, acc4;                    /* accumulator */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /*Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    /* Apply loop unrolling and compute 4 output values simultaneously. */
+    sample = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(sample > 0u)
+    {
+      /* Read the four inputs */
+      Xn1 = pIn[0];
+      Xn2 = pIn[1];
+      Xn3 = pIn[2];
+      Xn4 = pIn[3];
+      pIn += 4;
+
+      /* y[n] = b0 * x[n] + d1 */
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      acc1 = (b0 * Xn1) + d1;
+      d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+      d2 = (b2 * Xn1) + (a2 * acc1);
+
+      acc2 = (b0 * Xn2) + d1;
+      d1 = ((b1 * Xn2) + (a1 * acc2)) + d2;
+      d2 = (b2 * Xn2) + (a2 * acc2);
+
+      acc3 = (b0 * Xn3) + d1;
+      d1 = ((b1 * Xn3) + (a1 * acc3)) + d2;
+      d2 = (b2 * Xn3) + (a2 * acc3);
+
+      acc4 = (b0 * Xn4) + d1;
+      d1 = ((b1 * Xn4) + (a1 * acc4)) + d2;
+      d2 = (b2 * Xn4) + (a2 * acc4);
+
+      /* Store the results in the destination buffer */
+      pOut[0] = acc1;
+      pOut[1] = acc2;
+      pOut[2] = acc3;
+      pOut[3] = acc4;
+      pOut += 4;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+     ** No loop unrolling is used. */
+    sample = blockSize & 0x3u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /*Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    sample = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(sample > 0u)
+    {
+      /* Read the input */
+      Xn1 = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc1 = (b0 * Xn1) + d1;
+
+      /* Store the result in the accumulator in the destination buffer. */
+      *pOut++ = acc1;
+
+      /* Every time after the output is computed state should be updated. */
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2 = (b2 * Xn1) + (a2 * acc1);
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /*Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**    
+ * @} end of BiquadCascadeDF2T group    
+ */
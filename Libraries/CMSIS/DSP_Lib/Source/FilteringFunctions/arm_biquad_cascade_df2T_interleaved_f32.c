@@ -0,0 +1,305 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_biquad_cascade_df2T_interleaved_f32.c    
+*    
+* Description:  Processing function for the floating-point interleaved multichannel transposed direct form II Biquad cascade filter.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+/*    
+ * Host build: filters __HOST_VLEN consecutive channels through one stage, one channel per vector lane.    
+ * Each lane computes the same operations in the same order as the scalar code, so the results are bit-exact.    
+ */
+
+__HOST_SIMD_TARGET
+static void arm_biquad_cascade_df2T_interleaved_f32_host(
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint16_t stride,
+  uint32_t blockSize)
+{
+  float32_t b0 = pCoeffs[0], b1 = pCoeffs[1], b2 = pCoeffs[2];   /* Filter coefficients */
+  float32_t a1 = pCoeffs[3], a2 = pCoeffs[4];
+  __host_vf d1 = __HOST_LD(pState);              /* State variables of the channels */
+  __host_vf d2 = __HOST_LD(pState + stride);
+  __host_vf Xn, acc;                             /* Input and output of the channels */
+  uint32_t sample;                               /* Loop counter */
+
+  for (sample = 0u; sample < blockSize; sample++)
+  {
+    Xn = __HOST_LD(pIn);
+
+    /* y[n] = b0 * x[n] + d1 */
+    acc = (b0 * Xn) + d1;
+
+    /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+    d1 = ((b1 * Xn) + (a1 * acc)) + d2;
+
+    /* d2 = b2 * x[n] + a2 * y[n] */
+    d2 = (b2 * Xn) + (a2 * acc);
+
+    __HOST_ST(pOut, acc);
+
+    pIn += stride;
+    pOut += stride;
+  }
+
+  __HOST_ST(pState, d1);
+  __HOST_ST(pState + stride, d2);
+}
+
+/*    
+ * Host build: same as above for the last 1 to 4 channels, which do not fill a vector.    
+ * The vectors are built from the samples, as loading partly written arrays stalls the loop.    
+ * The unused lanes compute on zeros and are not stored.    
+ */
+
+static void arm_biquad_cascade_df2T_interleaved_f32_host4(
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint16_t stride,
+  uint32_t numLanes,
+  uint32_t blockSize)
+{
+  float32_t b0 = pCoeffs[0], b1 = pCoeffs[1], b2 = pCoeffs[2];   /* Filter coefficients */
+  float32_t a1 = pCoeffs[3], a2 = pCoeffs[4];
+  __host_v4f d1 = { 0.0f }, d2 = { 0.0f };       /* State variables of the channels */
+  __host_v4f Xn, acc;                            /* Input and output of the channels */
+  uint32_t sample, l;                            /* Loop counters */
+
+  for (l = 0u; l < numLanes; l++)
+  {
+    d1[l] = pState[l];
+    d2[l] = pState[stride + l];
+  }
+
+  for (sample = 0u; sample < blockSize; sample++)
+  {
+    Xn = (__host_v4f) { pIn[0],
+                        (numLanes > 1u) ? pIn[1] : 0.0f,
+                        (numLanes > 2u) ? pIn[2] : 0.0f,
+                        (numLanes > 3u) ? pIn[3] : 0.0f };
+
+    /* y[n] = b0 * x[n] + d1 */
+    acc = (b0 * Xn) + d1;
+
+    /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+    d1 = ((b1 * Xn) + (a1 * acc)) + d2;
+
+    /* d2 = b2 * x[n] + a2 * y[n] */
+    d2 = (b2 * Xn) + (a2 * acc);
+
+    pOut[0] = acc[0];
+
+    if(numLanes > 1u)
+    {
+      pOut[1] = acc[1];
+    }
+
+    if(numLanes > 2u)
+    {
+      pOut[2] = acc[2];
+    }
+
+    if(numLanes > 3u)
+    {
+      pOut[3] = acc[3];
+    }
+
+    pIn += stride;
+    pOut += stride;
+  }
+
+  for (l = 0u; l < numLanes; l++)
+  {
+    pState[l] = d1[l];
+    pState[stride + l] = d2[l];
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+/**    
+ * @addtogroup BiquadCascadeDF2T    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point interleaved multichannel transposed direct form II Biquad cascade filter.    
+ * @param[in]  *S        points to an instance of the filter data structure.    
+ * @param[in]  *pSrc     points to the block of input frames.    
+ * @param[out] *pDst     points to the block of output frames.    
+ * @param[in]  blockSize number of frames to process.    
+ * @return none.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * Filters <code>S->numChans</code> channels with the same coefficients.  The samples of all the channels    
+ * at one instant make a frame and the buffers hold consecutive frames, as in the DMA buffers of a    
+ * multichannel audio interface:    
+ * <pre>    
+ *    {x0[0], x1[0], ..., x0[1], x1[1], ...}    
+ * </pre>    
+ * Each channel gives the same results as <code>arm_biquad_cascade_df2T_f32()</code> on its own samples,    
+ * without deinterleaving the buffers.  Each stage filters the channels one after the other, with the    
+ * state of the channel in registers, and the frames in place in <code>pDst</code> after the first stage.    
+ * With ARM_MATH_HOST the channels are computed in the lanes of the vector unit.    
+ * A single channel is passed to <code>arm_biquad_cascade_df2T_f32()</code>, with the same state layout.    
+ */
+
+void arm_biquad_cascade_df2T_interleaved_f32(
+  const arm_biquad_cascade_df2T_interleaved_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* Source pointer */
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *px, *py;                            /* Input and output of a channel */
+  float32_t acc;                                 /* Accumulator */
+  float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+  float32_t Xn;                                  /* Temporary input */
+  float32_t d1, d2;                              /* State variables */
+  uint16_t numChans = S->numChans;               /* Number of channels, distance between two frames */
+  uint32_t sample, ch, stage = S->numStages;     /* Loop counters */
+  arm_biquad_cascade_df2T_instance_f32 mono;     /* Instance for a single channel */
+
+  /* A single channel is not interleaved: use the single channel filter, which is faster */
+  if(numChans == 1u)
+  {
+    mono.numStages = S->numStages;
+    mono.pState = S->pState;
+    mono.pCoeffs = S->pCoeffs;
+
+    arm_biquad_cascade_df2T_f32(&mono, pSrc, pDst, blockSize);
+
+    return;
+  }
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    ch = 0u;
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+    /* Host build: groups of channels are computed with the vector unit */
+    if(__HOST_SIMD_READY())
+    {
+      while((ch + __HOST_VLEN) <= numChans)
+      {
+        arm_biquad_cascade_df2T_interleaved_f32_host(pCoeffs, pState + ch, pIn + ch, pDst + ch, numChans, blockSize);
+        ch += __HOST_VLEN;
+      }
+    }
+
+    while(ch < numChans)
+    {
+      sample = ((numChans - ch) > 4u) ? 4u : (numChans - ch);
+      arm_biquad_cascade_df2T_interleaved_f32_host4(pCoeffs, pState + ch, pIn + ch, pDst + ch, numChans, sample, blockSize);
+      ch += sample;
+    }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+    for (; ch < numChans; ch++)
+    {
+      /* Reading the state values of the channel: d1 of all the channels, then d2 */
+      d1 = pState[ch];
+      d2 = pState[numChans + ch];
+
+      px = pIn + ch;
+      py = pDst + ch;
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        Xn = *px;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc = (b0 * Xn) + d1;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = ((b1 * Xn) + (a1 * acc)) + d2;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = (b2 * Xn) + (a2 * acc);
+
+        *py = acc;
+
+        px += numChans;
+        py += numChans;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the pState array */
+      pState[ch] = d1;
+      pState[numChans + ch] = d2;
+    }
+
+    /* The first stage goes from the input buffer to the output buffer. */
+    /* Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    pCoeffs += 5u;
+    pState += 2u * numChans;
+
+  } while(--stage);
+}
+
+/**    
+ * @} end of BiquadCascadeDF2T group    
+ */
@@ -0,0 +1,194 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_conv_fft_f32.c    
+*    
+* Description:  Floating-point convolution in direct or FFT form.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup Conv    
+ * @{    
+ */
+
+/**    
+ * The FFT form is used when the direct form would take more than ARM_MATH_CONV_FFT_RATIO    
+ * multiply-accumulates per <code>fftLen*log2(fftLen)</code>.  Timing both forms on the host build for    
+ * FFT lengths of 32 to 8192 gives a break-even ratio of 2 to 3, hence the default of 3.  A project may    
+ * define its own value, calibrated on its target.    
+ */
+#ifndef ARM_MATH_CONV_FFT_RATIO
+#define ARM_MATH_CONV_FFT_RATIO   3
+#endif
+
+/* Longest real FFT: 8192 points only with the table of ARM_MATH_RFFT_8192 */
+#if defined (ARM_MATH_RFFT_8192)
+#define ARM_MATH_CONV_FFT_MAX_LEN   8192u
+#else
+#define ARM_MATH_CONV_FFT_MAX_LEN   4096u
+#endif
+
+/**    
+ * @brief  Length of the real FFT for the fast convolution of two sequences.    
+ * @param[in] srcALen length of the first input sequence.    
+ * @param[in] srcBLen length of the second input sequence.    
+ * @return The function returns the FFT length, or 0 when the direct form is faster    
+ * or the sequences are too long for the real FFT.    
+ */
+
+uint32_t arm_conv_fft_len(
+  uint32_t srcALen,
+  uint32_t srcBLen)
+{
+  uint32_t outLen = (srcALen + srcBLen) - 1u;    /* Length of the linear convolution */
+  uint32_t fftLen = 32u;                         /* Shortest real FFT */
+  uint32_t log2Len = 5u;                         /* log2 of the FFT length */
+
+  /* The circular convolution of the FFT must hold the whole linear convolution */
+  while(fftLen < outLen)
+  {
+    fftLen <<= 1u;
+    log2Len++;
+  }
+
+  /* Longest real FFT, or the direct form costs less */
+  if((fftLen > ARM_MATH_CONV_FFT_MAX_LEN) ||
+     (((uint64_t) srcALen * srcBLen) <= ((uint64_t) ARM_MATH_CONV_FFT_RATIO * fftLen * log2Len)))
+  {
+    fftLen = 0u;
+  }
+
+  return (fftLen);
+}
+
+/**    
+ * @brief  Circular convolution of two zero padded sequences with the real FFT.    
+ * @param[in,out] *pScratch points to 3*fftLen words: the first sequence, the second sequence and working space.    
+ *                The result overwrites the first sequence.    
+ * @param[in]     fftLen length of the real FFT.    
+ * @return none.    
+ */
+
+void arm_conv_fft_kernel_f32(
+  float32_t * pScratch,
+  uint32_t fftLen)
+{
+  arm_rfft_fast_instance_f32 S;                  /* Real FFT instance */
+  float32_t *pA = pScratch;                      /* First sequence, then result */
+  float32_t *pB = pScratch + fftLen;             /* Second sequence, then product */
+  float32_t *pX = pB + fftLen;                   /* Spectrum of the first sequence */
+  float32_t dc, nyquist;                         /* Real bins packed in the first complex bin */
+
+  (void) arm_rfft_fast_init_f32(&S, (uint16_t) fftLen);
+
+  /* Spectra of both sequences; the real FFT overwrites its input */
+  arm_rfft_fast_f32(&S, pA, pX, 0u);
+  arm_rfft_fast_f32(&S, pB, pA, 0u);
+
+  /* Product of the spectra.    
+   ** The DC and Nyquist bins are real and packed together, they multiply separately. */
+  dc = pX[0] * pA[0];
+  nyquist = pX[1] * pA[1];
+  arm_cmplx_mult_cmplx_f32(pX, pA, pB, fftLen / 2u);
+  pB[0] = dc;
+  pB[1] = nyquist;
+
+  /* Back to the time domain */
+  arm_rfft_fast_f32(&S, pB, pA, 1u);
+}
+
+/**    
+ * @brief Convolution of floating-point sequences, in direct or FFT form.    
+ * @param[in]  *pSrcA points to the first input sequence.    
+ * @param[in]  srcALen length of the first input sequence.    
+ * @param[in]  *pSrcB points to the second input sequence.    
+ * @param[in]  srcBLen length of the second input sequence.    
+ * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.    
+ * @param[in]  *pScratch points to a scratch buffer of <code>3*fftLen</code> words, where <code>fftLen</code>    
+ *             is the power of 2 from 32 to 8192 not less than <code>srcALen+srcBLen-1</code>.    
+ * @return none.    
+ *    
+ * \par    
+ * The function computes the same output as <code>arm_conv_f32()</code>, with the same layout and scaling.    
+ * Long sequences are convolved in the frequency domain with the real FFT <code>arm_rfft_fast_f32()</code>,    
+ * in <code>O(fftLen*log2(fftLen))</code> operations instead of <code>O(srcALen*srcBLen)</code>.    
+ * The function selects the form from the lengths: the FFT form is used when the direct form costs more    
+ * than <code>ARM_MATH_CONV_FFT_RATIO</code> multiply-accumulates per <code>fftLen*log2(fftLen)</code>    
+ * and the lengths fit in an FFT of 8192 points, e.g. for two sequences of 4096 samples, when the library is    
+ * built with ARM_MATH_RFFT_8192.  Otherwise the longest FFT has 4096 points.    
+ * <code>pScratch</code> is not used by the direct form.    
+ */
+
+void arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  uint32_t fftLen;                               /* Length of the real FFT, 0 for the direct form */
+  uint32_t outLen = (srcALen + srcBLen) - 1u;    /* Length of the linear convolution */
+
+  fftLen = arm_conv_fft_len(srcALen, srcBLen);
+
+  if(fftLen == 0u)
+  {
+    /* Direct form */
+    arm_conv_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+  }
+  else
+  {
+    /* Both sequences, zero padded to the FFT length */
+    arm_copy_f32(pSrcA, pScratch, srcALen);
+    arm_fill_f32(0.0f, pScratch + srcALen, fftLen - srcALen);
+    arm_copy_f32(pSrcB, pScratch + fftLen, srcBLen);
+    arm_fill_f32(0.0f, pScratch + (fftLen + srcBLen), fftLen - srcBLen);
+
+    arm_conv_fft_kernel_f32(pScratch, fftLen);
+
+    arm_copy_f32(pScratch, pDst, outLen);
+  }
+}
+
+/**    
+ * @} end of Conv group    
+ */
@@ -78,7 +78,7 @@ arm_status arm_conv_partial_q15(
   uint32_t numPoints)
 {
 
-#if (defined(ARM_MATH_CM4) || defined(ARM_MATH_CM3)) && !defined(UNALIGNED_SUPPORT_DISABLE)
+#if (defined(ARM_MATH_CM4) || defined(ARM_MATH_CM3) || defined(ARM_MATH_HOST)) && !defined(UNALIGNED_SUPPORT_DISABLE)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -770,7 +770,7 @@ arm_status arm_conv_partial_q15(
   }
   return (status);
 
-#endif /* #if (defined(ARM_MATH_CM4) || defined(ARM_MATH_CM3)) && !defined(UNALIGNED_SUPPORT_DISABLE)  */
+#endif /* #if (defined(ARM_MATH_CM4) || defined(ARM_MATH_CM3) || defined(ARM_MATH_HOST)) && !defined(UNALIGNED_SUPPORT_DISABLE)  */
 
 }
 
@@ -0,0 +1,155 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_correlate_fft_q31.c    
+*    
+* Description:  Q31 correlation in direct or FFT form.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup Corr    
+ * @{    
+ */
+
+extern uint32_t arm_conv_fft_len(
+  uint32_t srcALen,
+  uint32_t srcBLen);
+
+extern void arm_conv_fft_kernel_f32(
+  float32_t * pScratch,
+  uint32_t fftLen);
+
+/**    
+ * @brief Correlation of Q31 sequences, in direct or FFT form.    
+ * @param[in]  *pSrcA points to the first input sequence.    
+ * @param[in]  srcALen length of the first input sequence.    
+ * @param[in]  *pSrcB points to the second input sequence.    
+ * @param[in]  srcBLen length of the second input sequence.    
+ * @param[out] *pDst points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.    
+ * @param[in]  *pScratch points to a scratch buffer of <code>3*fftLen</code> words, where <code>fftLen</code>    
+ *             is the power of 2 from 32 to 8192 not less than <code>srcALen+srcBLen-1</code>.    
+ * @return none.    
+ *    
+ * \par    
+ * The function computes the same output as <code>arm_correlate_q31()</code>, with the same layout and scaling.    
+ * Long sequences are correlated in the frequency domain with the real FFT <code>arm_rfft_fast_f32()</code>,    
+ * in <code>O(fftLen*log2(fftLen))</code> operations instead of <code>O(srcALen*srcBLen)</code>.    
+ * The function selects the form from the lengths: the FFT form is used when the direct form costs more    
+ * than <code>ARM_MATH_CONV_FFT_RATIO</code> multiply-accumulates per <code>fftLen*log2(fftLen)</code>    
+ * and the lengths fit in an FFT of 8192 points, e.g. for two sequences of 4096 samples, when the library is    
+ * built with ARM_MATH_RFFT_8192.  Otherwise the longest FFT has 4096 points.    
+ * <code>pScratch</code> is not used by the direct form.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The FFT form converts the inputs to floating-point, so it is only built for targets with a floating-point unit    
+ * and for the host build; elsewhere the function always uses <code>arm_correlate_q31()</code>.    
+ * The output is converted back with <code>arm_float_to_q31()</code>, which saturates instead of wrapping around.    
+ * The floating-point result has a precision of 24 bits relative to the largest output sample, which is less than the 31 bits of the direct form.    
+ *    
+ * \par    
+ * As with <code>arm_correlate_q31()</code>, the first <code>srcALen-srcBLen</code> samples of <code>pDst</code>    
+ * (when <code>srcALen</code> is longer) or the last <code>srcBLen-srcALen</code> samples (when <code>srcBLen</code>    
+ * is longer) are not written and <code>pDst</code> should be initialized to all zeros.    
+ */
+
+void arm_correlate_fft_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  float32_t * pScratch)
+{
+  uint32_t fftLen;                               /* Length of the real FFT, 0 for the direct form */
+  uint32_t outLen = (srcALen + srcBLen) - 1u;    /* Length of the linear correlation */
+  uint32_t offset;                               /* Position of the first output sample in pDst */
+  float32_t *pB;                                 /* Second sequence in the scratch buffer */
+  float32_t tmp;                                 /* Temporary variable for the reversal */
+  uint32_t i;                                    /* Loop counter */
+
+#if defined (ARM_MATH_HOST) || (__FPU_USED == 1)
+
+  fftLen = arm_conv_fft_len(srcALen, srcBLen);
+
+#else
+
+  /* No floating-point unit: always use the direct form */
+  fftLen = 0u;
+
+#endif /* #if defined (ARM_MATH_HOST) || (__FPU_USED == 1) */
+
+  if(fftLen == 0u)
+  {
+    /* Direct form */
+    arm_correlate_q31(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+  }
+  else
+  {
+    /* Both sequences in floating-point, zero padded to the FFT length */
+    arm_q31_to_float(pSrcA, pScratch, srcALen);
+    arm_fill_f32(0.0f, pScratch + srcALen, fftLen - srcALen);
+    arm_q31_to_float(pSrcB, pScratch + fftLen, srcBLen);
+    arm_fill_f32(0.0f, pScratch + (fftLen + srcBLen), fftLen - srcBLen);
+
+    /* Correlation is the convolution with the second sequence reversed in time */
+    pB = pScratch + fftLen;
+
+    for (i = 0u; i < (srcBLen / 2u); i++)
+    {
+      tmp = pB[i];
+      pB[i] = pB[(srcBLen - 1u) - i];
+      pB[(srcBLen - 1u) - i] = tmp;
+    }
+
+    arm_conv_fft_kernel_f32(pScratch, fftLen);
+
+    /* The output starts after srcALen - srcBLen untouched samples when srcALen is longer */
+    offset = (srcALen > srcBLen) ? (srcALen - srcBLen) : 0u;
+
+    /* Back to Q31, with saturation */
+    arm_float_to_q31(pScratch, pDst + offset, outLen);
+  }
+}
+
+/**    
+ * @} end of Corr group    
+ */
@@ -84,7 +84,7 @@ void arm_correlate_q15(
   q15_t * pDst)
 {
 
-#if (defined(ARM_MATH_CM4) || defined(ARM_MATH_CM3)) && !defined(UNALIGNED_SUPPORT_DISABLE)
+#if (defined(ARM_MATH_CM4) || defined(ARM_MATH_CM3) || defined(ARM_MATH_HOST)) && !defined(UNALIGNED_SUPPORT_DISABLE)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -710,7 +710,7 @@ void arm_correlate_q15(
       *pDst++ = (q15_t) __SSAT((sum >> 15u), 16u);
   }
 
-#endif /*#if (defined(ARM_MATH_CM4) || defined(ARM_MATH_CM3)) && !defined(UNALIGNED_SUPPORT_DISABLE) */
+#endif /*#if (defined(ARM_MATH_CM4) || defined(ARM_MATH_CM3) || defined(ARM_MATH_HOST)) && !defined(UNALIGNED_SUPPORT_DISABLE) */
 
 }
 
@@ -0,0 +1,159 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_farrow_f32.c    
+*    
+* Description:  Floating-point Farrow fractional resampler.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_Resample    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point Farrow fractional resampler.    
+ * @param[in,out] *S    points to an instance of the floating-point Farrow resampler structure.    
+ * @param[in] *pSrc     points to the block of input data.    
+ * @param[out] *pDst    points to the block of output data.    
+ * @param[in] blockSize number of input samples to process per call.    
+ * @return The function returns the number of output samples written to <code>pDst</code>.    
+ *    
+ * \par    
+ * The number of output samples varies from block to block; it is at most <code>blockSize/step + 1</code>    
+ * and <code>pDst</code> must be large enough for it.    
+ * \par    
+ * Each output sample is interpolated between two input samples <code>x[n]</code> and <code>x[n+1]</code>,    
+ * at the fractional position <code>mu</code>, by the cubic through <code>x[n-1]</code> to <code>x[n+2]</code>:    
+ * <pre>    
+ *    c0 = x[n]    
+ *    c1 = x[n+1] - x[n-1]/3 - x[n]/2 - x[n+2]/6    
+ *    c2 = (x[n-1] + x[n+1])/2 - x[n]    
+ *    c3 = (x[n+2] - x[n-1])/6 + (x[n] - x[n+1])/2    
+ *    y  = ((c3 * mu + c2) * mu + c1) * mu + c0    
+ * </pre>    
+ * The output is delayed by 2 input samples.    
+ */
+
+uint32_t arm_farrow_f32(
+  arm_farrow_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px;                                 /* Points to x[n-1] */
+  float32_t xm1, x0, x1, x2;                     /* Samples around the output sample */
+  float32_t c1, c2, c3, mu;                      /* Polynomial coefficients and fractional position */
+  uint32_t stepInt = S->stepInt;                 /* Integer part of the step */
+  uint32_t stepFrac = S->stepFrac;               /* Fractional part of the step */
+  uint32_t frac = S->frac;                       /* Fractional position */
+  uint32_t n = S->index;                         /* Index of x[n-1] in the state buffer */
+  uint32_t outCnt = 0u;                          /* Number of output samples */
+  uint32_t i;                                    /* Loop counter */
+
+  /* S->pState buffer contains the last 3 samples of the previous frame */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + 3u;
+
+  /* Copy the new input block into the state buffer */
+  i = blockSize;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  /* x[n+2] must be in the state buffer */
+  while(n < blockSize)
+  {
+    px = pState + n;
+    xm1 = px[0];
+    x0 = px[1];
+    x1 = px[2];
+    x2 = px[3];
+
+    /* Coefficients of the cubic in Farrow form */
+    c1 = x1 - (0.5f * x0) - ((1.0f / 3.0f) * xm1) - ((1.0f / 6.0f) * x2);
+    c2 = (0.5f * (xm1 + x1)) - x0;
+    c3 = ((1.0f / 6.0f) * (x2 - xm1)) + (0.5f * (x0 - x1));
+
+    /* Fractional position in [0, 1) */
+    mu = (float32_t) frac * 2.3283064365386963e-10f;
+
+    /* Evaluate the cubic with Horner's method */
+    *pDst++ = (((c3 * mu) + c2) * mu + c1) * mu + x0;
+    outCnt++;
+
+    /* Advance by the step, carrying the fractional part into the index */
+    n += stepInt;
+    frac += stepFrac;
+
+    if(frac < stepFrac)
+    {
+      n++;
+    }
+  }
+
+  /* Save the position relative to the next block */
+  S->index = n - blockSize;
+  S->frac = frac;
+
+  /* Processing is complete.    
+   ** Now copy the last 3 samples to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+  pStateCurnt = S->pState;
+  pState = pState + blockSize;
+
+  pStateCurnt[0] = pState[0];
+  pStateCurnt[1] = pState[1];
+  pStateCurnt[2] = pState[2];
+
+  return (outCnt);
+}
+
+/**    
+ * @} end of FIR_Resample group    
+ */
@@ -0,0 +1,98 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_farrow_init_f32.c    
+*    
+* Description:  Floating-point Farrow fractional resampler initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_Resample    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point Farrow fractional resampler.    
+ * @param[in,out] *S        points to an instance of the floating-point Farrow resampler structure.    
+ * @param[in]     step      number of input samples per output sample, i.e. the input rate divided by the output rate.    
+ * @param[in]     *pState   points to the state buffer.    
+ * @param[in]     blockSize number of input samples to process per call.    
+ * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>step</code>    
+ * is not greater than 0 and less than 65536.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * <code>pState</code> points to the array of state variables.    
+ * <code>pState</code> is of length <code>blockSize+3</code> words    
+ * where <code>blockSize</code> is the largest number of input samples processed by a call to <code>arm_farrow_f32()</code>.    
+ */
+
+arm_status arm_farrow_init_f32(
+  arm_farrow_instance_f32 * S,
+  float32_t step,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  /* Assign the step */
+  status = arm_farrow_set_step_f32(S, step);
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    /* The first output sample is 2 input samples before the first input sample, in the cleared state */
+    S->frac = 0u;
+    S->index = 0u;
+
+    /* Clear state buffer and size of buffer is always blockSize + 3 */
+    memset(pState, 0, (blockSize + 3u) * sizeof(float32_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+  }
+
+  return (status);
+
+}
+
+/**    
+ * @} end of FIR_Resample group    
+ */
@@ -0,0 +1,95 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_farrow_set_step_f32.c    
+*    
+* Description:  Floating-point Farrow fractional resampler step function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_Resample    
+ * @{    
+ */
+
+/**    
+ * @brief  Sets the step of the floating-point Farrow fractional resampler.    
+ * @param[in,out] *S    points to an instance of the floating-point Farrow resampler structure.    
+ * @param[in]     step  number of input samples per output sample, i.e. the input rate divided by the output rate.    
+ * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>step</code>    
+ * is not greater than 0 and less than 65536.    
+ *    
+ * \par    
+ * The function may be called between two calls to <code>arm_farrow_f32()</code> to track a drifting ratio;    
+ * the position of the next output sample is kept.    
+ * The step is stored with a fractional part of 32 bits so the position does not drift by rounding;    
+ * the resolution of the step is that of <code>step</code>, about 6e-8 for steps near 1.    
+ */
+
+arm_status arm_farrow_set_step_f32(
+  arm_farrow_instance_f32 * S,
+  float32_t step)
+{
+  arm_status status;
+  uint32_t stepInt;
+
+  if((step <= 0.0f) || (step >= 65536.0f))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Split the step in an integer part and a fractional part in units of 2^-32.    
+     ** The fractional part of a float32_t is exact and less than 1, so the product is below 2^32. */
+    stepInt = (uint32_t) step;
+
+    S->stepInt = (uint16_t) stepInt;
+    S->stepFrac = (uint32_t) ((step - (float32_t) stepInt) * 4294967296.0f);
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**    
+ * @} end of FIR_Resample group    
+ */
@@ -133,6 +133,61 @@
 
 #ifndef ARM_MATH_CM0_FAMILY
 
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+/*  
+ * Host build: computes blkCnt blocks of 8 outputs, one output per vector lane.  
+ * Each lane sums the products in the same order as the 8 accumulators of arm_fir_f32(),  
+ * so the results are bit-exact.  
+ */
+
+__HOST_SIMD_TARGET
+static void arm_fir_f32_host8(
+float32_t * pState,
+float32_t * pCoeffs,
+uint32_t numTaps,
+float32_t * pStateCurnt,
+float32_t * pSrc,
+float32_t * pDst,
+uint32_t blkCnt)
+{
+   __host_vf acc[8 / __HOST_VLEN];                /* Accumulators of the 8 outputs */
+   uint32_t i, l;                                 /* Loop counters */
+
+   while(blkCnt > 0u)
+   {
+      /* Copy 8 new input samples into the state buffer */
+      for (l = 0u; l < 8u; l += __HOST_VLEN)
+      {
+         __HOST_ST(pStateCurnt + l, __HOST_LD(pSrc + l));
+         acc[l / __HOST_VLEN] = (__host_vf) { 0.0f };
+      }
+      pStateCurnt += 8;
+      pSrc += 8;
+
+      for (i = 0u; i < numTaps; i++)
+      {
+         for (l = 0u; l < 8u; l += __HOST_VLEN)
+         {
+            acc[l / __HOST_VLEN] += __HOST_LD(pState + i + l) * pCoeffs[i];
+         }
+      }
+
+      for (l = 0u; l < 8u; l += __HOST_VLEN)
+      {
+         __HOST_ST(pDst + l, acc[l / __HOST_VLEN]);
+      }
+      pDst += 8;
+
+      /* Advance the state pointer by 8 to process the next group of 8 samples */
+      pState += 8;
+
+      blkCnt--;
+   }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
 void arm_fir_f32(
@@ -165,6 +220,21 @@ uint32_t blockSize)
     */
    blkCnt = blockSize >> 3;
 
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+   /* Host build: the blocks of 8 outputs are computed with the vector unit */
+   if(__HOST_SIMD_READY())
+   {
+      arm_fir_f32_host8(pState, pCoeffs, numTaps, pStateCurnt, pSrc, pDst, blkCnt);
+      pState += 8u * blkCnt;
+      pStateCurnt += 8u * blkCnt;
+      pSrc += 8u * blkCnt;
+      pDst += 8u * blkCnt;
+      blkCnt = 0u;
+   }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
    /* First part of the processing with loop unrolling.  Compute 8 outputs at a time.  
    ** a second loop below computes the remaining 1 to 7 samples. */
    while(blkCnt > 0u)
@@ -0,0 +1,186 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_fft_f32.c    
+*    
+* Description:  Floating-point partitioned fast convolution FIR filter processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup FIR_FFT Partitioned Fast Convolution FIR Filter    
+ *    
+ * This function implements a long FIR filter by uniformly partitioned overlap-save fast convolution.    
+ * It computes the same output as the direct form FIR filter (see \ref FIR) but the cost per sample    
+ * grows with log2 of the partition length instead of with the number of taps, which makes filters of    
+ * several thousand taps practical.    
+ *    
+ * \par Algorithm:    
+ * The impulse response is cut into <code>numParts = ceil(numTaps/partSize)</code> partitions of    
+ * <code>partSize</code> taps.  Each partition is zero padded to <code>2*partSize</code> and transformed once,    
+ * by the initialization function, with the real FFT <code>arm_rfft_fast_f32()</code>.    
+ * For each block of <code>partSize</code> new input samples the processing function then:    
+ * - transforms the last <code>2*partSize</code> input samples and stores the spectrum in a frequency domain delay line,    
+ *   which holds the spectra of the last <code>numParts</code> input blocks.    
+ * - multiplies each spectrum of the delay line by the spectrum of the matching partition and accumulates the products.    
+ * - transforms the sum back and keeps its last <code>partSize</code> samples, which are the output samples of the block.    
+ *    
+ * \par    
+ * The output is not delayed: output sample <code>n</code> only depends on the input samples up to <code>n</code>,    
+ * like with <code>arm_fir_f32()</code>.  The partition size only sets the granularity of the calls:    
+ * <code>blockSize</code> must be a multiple of <code>partSize</code>.    
+ *    
+ * \par Cost:    
+ * Each block of <code>partSize</code> samples takes one forward and one inverse real FFT of <code>2*partSize</code>    
+ * points and <code>numParts</code> complex multiplications of <code>partSize</code> bins.  A small partition    
+ * allows small blocks; a large partition lowers the cost per sample until the FFTs dominate.    
+ * Per sample this is about <code>4*numParts</code> multiply-accumulates plus the share of the two FFTs,    
+ * against <code>numTaps</code> multiply-accumulates for the direct form.  The fast convolution usually    
+ * wins from a few hundred taps, and by more than ten times for a 4096 tap filter with <code>partSize</code>    
+ * of 256 or more.    
+ *    
+ * \par    
+ * <code>pCoeffs</code> holds the coefficients of the filter in time reversed order, as for <code>arm_fir_f32()</code>:    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * <code>pCoeffsFreq</code> is of length <code>2*partSize*numParts</code> and receives the spectra of the partitions.    
+ * <code>pState</code> is of length <code>2*partSize*(numParts+3)</code>.    
+ *    
+ * \par Instance Structure    
+ * The spectra of the partitions, the state and the real FFT instance are stored together in an instance data structure.    
+ * A separate instance structure must be defined for each filter.    
+ * The instance structure must be initialized with <code>arm_fir_fft_init_f32()</code>, which computes the spectra.    
+ * Instances of the same filter may share <code>pCoeffsFreq</code> once it has been computed.    
+ */
+
+/**    
+ * @addtogroup FIR_FFT    
+ * @{    
+ */
+
+/**    
+ * @param[in]  *S points to an instance of the floating-point partitioned fast convolution FIR structure.    
+ * @param[in]  *pSrc points to the block of input data.    
+ * @param[out] *pDst points to the block of output data.    
+ * @param[in]  blockSize number of samples to process, a multiple of <code>partSize</code>.    
+ * @return     none.    
+ *    
+ * \par    
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.    
+ */
+
+void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t partSize = S->partSize;               /* Partition length */
+  uint32_t fftLen = 2u * partSize;               /* Length of the real FFT */
+  uint32_t numParts = S->numParts;               /* Number of partitions */
+  float32_t *pHist = S->pState;                  /* Last 2*partSize input samples */
+  float32_t *pScratch = pHist + fftLen;          /* FFT input and product buffer */
+  float32_t *pAcc = pScratch + fftLen;           /* Accumulated spectrum */
+  float32_t *pFdl = pAcc + fftLen;               /* Frequency domain delay line */
+  float32_t *pX, *pH;                            /* Spectrum of an input block and of a partition */
+  uint32_t blkCnt, i, slot;                      /* Loop counters */
+
+  /* Process the input one partition at a time */
+  blkCnt = blockSize / partSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Slide the input history by one partition and append the new samples */
+    arm_copy_f32(pHist + partSize, pHist, partSize);
+    arm_copy_f32(pSrc, pHist + partSize, partSize);
+
+    /* Transform the history into the newest slot of the delay line.    
+     ** The real FFT overwrites its input so it works on a copy. */
+    slot = S->fdlIndex;
+    pX = pFdl + (slot * fftLen);
+    arm_copy_f32(pHist, pScratch, fftLen);
+    arm_rfft_fast_f32(&S->rfft, pScratch, pX, 0u);
+
+    /* Multiply each input spectrum by the spectrum of its partition and accumulate.    
+     ** The first bin packs the real DC and Nyquist values, which multiply separately. */
+    pH = S->pCoeffsFreq;
+
+    for (i = 0u; i < numParts; i++)
+    {
+      pX = pFdl + (slot * fftLen);
+
+      if(i == 0u)
+      {
+        arm_cmplx_mult_cmplx_f32(pX, pH, pAcc, partSize);
+        pAcc[0] = pX[0] * pH[0];
+        pAcc[1] = pX[1] * pH[1];
+      }
+      else
+      {
+        arm_cmplx_mult_cmplx_f32(pX, pH, pScratch, partSize);
+        pScratch[0] = pX[0] * pH[0];
+        pScratch[1] = pX[1] * pH[1];
+        arm_add_f32(pAcc, pScratch, pAcc, fftLen);
+      }
+
+      /* Older input blocks go with later partitions */
+      slot = (slot == 0u) ? (numParts - 1u) : (slot - 1u);
+      pH += fftLen;
+    }
+
+    /* Back to the time domain: the last partSize samples are the valid output */
+    arm_rfft_fast_f32(&S->rfft, pAcc, pScratch, 1u);
+    arm_copy_f32(pScratch + partSize, pDst, partSize);
+
+    /* Advance the delay line */
+    S->fdlIndex = (S->fdlIndex + 1u == numParts) ? 0u : (uint16_t) (S->fdlIndex + 1u);
+
+    pSrc += partSize;
+    pDst += partSize;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of FIR_FFT group    
+ */
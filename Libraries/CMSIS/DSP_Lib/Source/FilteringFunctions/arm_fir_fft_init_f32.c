@@ -0,0 +1,131 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_fft_init_f32.c    
+*    
+* Description:  Floating-point partitioned fast convolution FIR filter initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_FFT    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point partitioned fast convolution FIR filter.    
+ * @param[in,out] *S points to an instance of the floating-point partitioned fast convolution FIR structure.    
+ * @param[in]     numTaps  Number of filter coefficients in the filter.    
+ * @param[in]     *pCoeffs points to the filter coefficients, in time reversed order.    
+ * @param[out]    *pCoeffsFreq points to the buffer that receives the spectra of the partitions.    
+ * @param[in]     *pState points to the state buffer.    
+ * @param[in]     partSize length of a partition: 16, 32, 64, 128, 256, 512, 1024, 2048, or 4096 with ARM_MATH_RFFT_8192.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if    
+ * <code>partSize</code> is not supported or <code>numTaps</code> is zero.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * The number of partitions is <code>numParts = (numTaps + partSize - 1) / partSize</code>.    
+ * <code>pCoeffsFreq</code> is of length <code>2*partSize*numParts</code> and    
+ * <code>pState</code> is of length <code>2*partSize*(numParts+3)</code>.    
+ * The function computes the spectra of the partitions with the state buffer as scratch, then clears the state.    
+ */
+
+arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pCoeffsFreq,
+  float32_t * pState,
+  uint16_t partSize)
+{
+  uint32_t fftLen = 2u * partSize;               /* Length of the real FFT */
+  uint32_t numParts, i, j, k;                    /* Number of partitions and loop counters */
+  float32_t *pScratch = pState;                  /* Time domain partition */
+  arm_status status;
+
+  /* The real FFT of 2*partSize points must be supported */
+  if((numTaps == 0u) || (arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen) != ARM_MATH_SUCCESS))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    numParts = ((uint32_t) numTaps + partSize - 1u) / partSize;
+
+    /* Assign filter taps and partitions */
+    S->numTaps = numTaps;
+    S->partSize = partSize;
+    S->numParts = (uint16_t) numParts;
+    S->fdlIndex = 0u;
+
+    for (i = 0u; i < numParts; i++)
+    {
+      /* Taps b[i*partSize] to b[i*partSize+partSize-1], zero padded to fftLen.    
+       ** b[n] is stored at pCoeffs[numTaps-1-n]. */
+      for (j = 0u; j < fftLen; j++)
+      {
+        k = (i * partSize) + j;
+        pScratch[j] = ((j < partSize) && (k < numTaps)) ? (pCoeffs[numTaps - 1u - k]) : 0.0f;
+      }
+
+      arm_rfft_fast_f32(&S->rfft, pScratch, pCoeffsFreq + (i * fftLen), 0u);
+    }
+
+    /* Assign coefficient pointer */
+    S->pCoeffsFreq = pCoeffsFreq;
+
+    /* Clear state buffer and size is always 2*partSize*(numParts+3) */
+    memset(pState, 0, fftLen * (numParts + 3u) * sizeof(float32_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+
+}
+
+/**    
+ * @} end of FIR_FFT group    
+ */
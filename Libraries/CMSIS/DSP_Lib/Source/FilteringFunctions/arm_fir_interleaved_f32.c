@@ -0,0 +1,211 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_interleaved_f32.c    
+*    
+* Description:  Floating-point interleaved multichannel FIR filter processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+/*    
+ * Host build: outputs of one frame for numChans channels, a group of channels per vector lane.    
+ * Each lane sums the products in the same order as the scalar code, so the results are bit-exact.    
+ */
+
+__HOST_SIMD_TARGET
+static void arm_fir_interleaved_f32_host(
+  const float32_t * px,
+  const float32_t * pCoeffs,
+  uint16_t numTaps,
+  uint16_t stride,
+  float32_t * pDst,
+  uint16_t numChans)
+{
+  __host_vf acc;                                 /* Accumulators of the channels */
+  uint32_t i;                                    /* Loop counter */
+
+  while(numChans >= __HOST_VLEN)
+  {
+    acc = (__host_vf) { 0.0f };
+
+    for (i = 0u; i < numTaps; i++)
+    {
+      acc += __HOST_LD(px + i * stride) * pCoeffs[i];
+    }
+
+    __HOST_ST(pDst, acc);
+
+    px += __HOST_VLEN;
+    pDst += __HOST_VLEN;
+    numChans -= __HOST_VLEN;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+/**    
+ * @addtogroup FIR    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point interleaved FIR filter, for a range of its channels.    
+ * @param[in]  *S points to an instance of the floating-point interleaved FIR filter structure.    
+ * @param[in]  *pSrc points to the block of input frames.    
+ * @param[out] *pDst points to the block of output frames.    
+ * @param[in]  blockSize number of frames to process per call.    
+ * @param[in]  firstChan first channel to process.    
+ * @param[in]  numChans number of channels to process, from <code>firstChan</code>.    
+ * @return     none.    
+ *    
+ * Only the samples and the state of the given channels are accessed, so separate ranges of    
+ * channels of the same instance can be processed concurrently (see arm_fir_interleaved_batch_f32()).    
+ */
+
+void arm_fir_interleaved_range_f32(
+  const arm_fir_interleaved_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  uint16_t firstChan,
+  uint16_t numChans)
+{
+  float32_t *pState = S->pState + firstChan;     /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current frame of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t acc;                                 /* Accumulator */
+  uint16_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint16_t stride = S->numChans;                 /* Distance between two frames */
+  uint32_t i, ch, chCnt, frmCnt;                 /* Loop counters */
+
+  /* S->pState holds the previous (numTaps - 1) frames, the new frames are written after them */
+  pStateCurnt = pState + ((numTaps - 1u) * stride);
+  pSrc += firstChan;
+  pDst += firstChan;
+
+  /* Copy the new frames into the state buffer */
+  for (i = 0u; i < blockSize; i++)
+  {
+    memcpy(pStateCurnt + (i * stride), pSrc + (i * stride), numChans * sizeof(float32_t));
+  }
+
+  for (frmCnt = 0u; frmCnt < blockSize; frmCnt++)
+  {
+    ch = 0u;
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+    /* Host build: groups of channels are computed with the vector unit */
+    if(__HOST_SIMD_READY())
+    {
+      arm_fir_interleaved_f32_host(pState, pCoeffs, numTaps, stride, pDst, numChans);
+      ch = numChans - (numChans % __HOST_VLEN);
+    }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+    for (; ch < numChans; ch++)
+    {
+      /* acc = b[numTaps-1] * x[n-numTaps+1] + ... + b[0] * x[n], for one channel */
+      acc = 0.0f;
+      px = pState + ch;
+      pb = pCoeffs;
+      chCnt = numTaps;
+
+      do
+      {
+        acc += *px * *pb++;
+        px += stride;
+        chCnt--;
+      } while(chCnt > 0u);
+
+      pDst[ch] = acc;
+    }
+
+    /* Advance the state and destination pointers to the next frame */
+    pState += stride;
+    pDst += stride;
+  }
+
+  /* Processing is complete.    
+   ** Now copy the last numTaps - 1 frames to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+  pStateCurnt = S->pState + firstChan;
+
+  for (i = 0u; i < (numTaps - 1u); i++)
+  {
+    memmove(pStateCurnt + (i * stride), pState + (i * stride), numChans * sizeof(float32_t));
+  }
+}
+
+/**    
+ * @brief Processing function for the floating-point interleaved FIR filter.    
+ * @param[in]  *S points to an instance of the floating-point interleaved FIR filter structure.    
+ * @param[in]  *pSrc points to the block of input frames.    
+ * @param[out] *pDst points to the block of output frames.    
+ * @param[in]  blockSize number of frames to process per call.    
+ * @return     none.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * Filters <code>S->numChans</code> channels with the same coefficients.  The samples of all the channels    
+ * at one instant make a frame and the buffers hold consecutive frames:    
+ * <pre>    
+ *    {x0[0], x1[0], ..., x0[1], x1[1], ...}    
+ * </pre>    
+ * Each channel gives the same results as <code>arm_fir_f32()</code> on its own samples.    
+ * With ARM_MATH_HOST the channels are computed in the lanes of the vector unit.    
+ */
+
+void arm_fir_interleaved_f32(
+  const arm_fir_interleaved_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  arm_fir_interleaved_range_f32(S, pSrc, pDst, blockSize, 0u, S->numChans);
+}
+
+/**    
+ * @} end of FIR group    
+ */
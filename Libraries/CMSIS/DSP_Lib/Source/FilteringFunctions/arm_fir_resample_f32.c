@@ -0,0 +1,273 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_fir_resample_f32.c    
+*    
+* Description:  Floating-point FIR rational resampler.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler    
+ *    
+ * These functions change the sample rate of a signal by a rational factor <code>L/M</code>, for instance    
+ * 160/147 from 44.1 kHz to 48 kHz.    
+ * Conceptually, they upsample by <code>L</code> (zero stuffing), filter with a lowpass FIR filter and    
+ * downsample by <code>M</code>, like an FIR interpolator (see \ref FIR_Interpolate) followed by an FIR decimator    
+ * (see \ref FIR_decimate) running at the intermediate rate.    
+ * The user of the function is responsible for providing the filter coefficients: a lowpass filter designed at    
+ * the intermediate rate, with a gain of <code>L</code> and a normalized cutoff frequency of <code>1/max(L,M)</code>.    
+ *    
+ * The functions use the polyphase structure of the interpolator but only compute the output samples that are kept,    
+ * so each output sample costs <code>numTaps/L</code> multiply-accumulates whatever the factors.    
+ * Cascading <code>arm_fir_interpolate_f32()</code> and <code>arm_fir_decimate_f32()</code> instead computes all the    
+ * <code>L</code> intermediate samples of each input sample and keeps one out of <code>M</code>, which costs    
+ * <code>M</code> times as much per output sample (147 times for 44.1 kHz to 48 kHz).    
+ *    
+ * The functions operate on blocks of input and output data.    
+ * <code>pSrc</code> points to an array of <code>blockSize</code> input values and    
+ * <code>pDst</code> points to an array of <code>blockSize*L/M</code> output values.    
+ * In order to have an integer number of output samples <code>blockSize</code> must be a multiple of <code>M</code>,    
+ * e.g. 441 samples (10 ms) for 147 in the example above.    
+ * <code>L</code> and <code>M</code> should have no common factor.    
+ *    
+ * The library provides separate functions for Q15, Q31 and floating-point data types.    
+ *    
+ * \par Algorithm:    
+ * Output sample <code>k</code> falls on sample <code>u = k*M</code> of the intermediate rate, that is on phase    
+ * <code>p = u % L</code> after input sample <code>n = u / L</code>:    
+ * <pre>    
+ *    y[k] = b[p] * x[n] + b[L+p] * x[n-1] + ... + b[L*(phaseLength-1)+p] * x[n-phaseLength+1]    
+ * </pre>    
+ * where <code>b[n]</code> are the filter coefficients and <code>phaseLength=numTaps/L</code>.    
+ * The phase and the input sample are advanced incrementally, without division.    
+ * \par    
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>, a multiple of <code>L</code>.    
+ * Coefficients are stored in time reversed order, as for the FIR interpolator:    
+ * \par    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * \par    
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>.    
+ * The state variables are updated after each block of data is processed, the coefficients are untouched.    
+ *    
+ * \par Instance Structure    
+ * The coefficients and state variables for a filter are stored together in an instance data structure.    
+ * A separate instance structure must be defined for each filter.    
+ * Coefficient arrays may be shared among several instances while state variable array should be allocated separately.    
+ * There are separate instance structure declarations for each of the 3 supported data types.    
+ *    
+ * \par Initialization Functions    
+ * There is also an associated initialization function for each data type.    
+ * The initialization function performs the following operations:    
+ * - Sets the values of the internal structure fields.    
+ * - Zeros out the values in the state buffer.    
+ * - Checks that <code>numTaps</code> is a multiple of <code>L</code> and <code>blockSize</code> a multiple of <code>M</code>.    
+ * To do this manually without calling the init function, assign the follow subfields of the instance structure:
+ * L, M, phaseLength (numTaps / L), pCoeffs, pState. Also set all of the values in pState to zero. 
+ *    
+ * \par    
+ * The code below statically initializes each of the 3 different data type filter instance structures    
+ * <pre>    
+ * arm_fir_resample_instance_f32 S = {L, M, phaseLength, pCoeffs, pState};    
+ * arm_fir_resample_instance_q31 S = {L, M, phaseLength, pCoeffs, pState};    
+ * arm_fir_resample_instance_q15 S = {L, M, phaseLength, pCoeffs, pState};    
+ * </pre>    
+ *    
+ * \par Fractional Resampling    
+ * When the two sample rates come from free running clocks the ratio is not a fixed rational number    
+ * and drifts slowly.  <code>arm_farrow_f32()</code> resamples by any ratio, which can be changed between    
+ * calls with <code>arm_farrow_set_step_f32()</code> to track the drift.    
+ * It interpolates the input with a cubic Lagrange polynomial evaluated in Farrow form, 4 samples per output,    
+ * and returns the number of output samples of each block, which varies.    
+ * The cubic interpolator attenuates images by about 30 to 50 dB only at high frequencies, so for high quality    
+ * it is best run on a signal oversampled by 2 or more, e.g. by a rational resampler before it.    
+ *    
+ * \par Fixed-Point Behavior    
+ * Care must be taken when using the fixed-point versions of the FIR resampler functions.    
+ * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.    
+ * Refer to the function specific documentation below for usage guidelines.    
+ */
+
+/**    
+ * @addtogroup FIR_Resample    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point FIR rational resampler.    
+ * @param[in] *S        points to an instance of the floating-point FIR resampler structure.    
+ * @param[in] *pSrc     points to the block of input data.    
+ * @param[out] *pDst    points to the block of output data, of length <code>blockSize*L/M</code>.    
+ * @param[in] blockSize number of input samples to process per call, a multiple of <code>M</code>.    
+ * @return none.    
+ */
+
+void arm_fir_resample_f32(
+  const arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *ptr1, *ptr2;                        /* Temporary pointers for state and coefficient buffers */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t L = S->L;                             /* Upsample factor */
+  uint32_t stepInt = S->M / L;                   /* Input samples advanced per output sample */
+  uint32_t stepPhase = S->M % L;                 /* Phases advanced per output sample */
+  uint32_t phase, n, tapCnt;                     /* Current phase, input sample and tap counter */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1u);
+
+  /* Copy the new input block into the state buffer */
+  n = blockSize;
+
+  while(n > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    n--;
+  }
+
+  /* The first output sample of the block is on phase 0 of the first input sample */
+  phase = 0u;
+  n = 0u;
+
+  /* The block ends on phase 0 of the input sample after it, as blockSize is a multiple of M */
+  while(n < blockSize)
+  {
+    /* Set accumulator to zero */
+    acc0 = 0.0f;
+
+    /* State of input sample n: the oldest sample of the phase is at pState[n] */
+    ptr1 = pState + n;
+
+    /* Coefficients of the phase: b[L*(phaseLength-1)+phase] first, then every L */
+    ptr2 = pCoeffs + ((L - 1u) - phase);
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop over the polyPhase length. Unroll by a factor of 4. */
+    tapCnt = phaseLen >> 2u;
+
+    while(tapCnt > 0u)
+    {
+      /* Perform the multiply-accumulates */
+      acc0 += *ptr1++ * *ptr2;
+      ptr2 += L;
+      acc0 += *ptr1++ * *ptr2;
+      ptr2 += L;
+      acc0 += *ptr1++ * *ptr2;
+      ptr2 += L;
+      acc0 += *ptr1++ * *ptr2;
+      ptr2 += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyPhase length is not a multiple of 4, compute the remaining filter taps */
+    tapCnt = phaseLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = phaseLen;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(tapCnt > 0u)
+    {
+      /* Perform the multiply-accumulate */
+      acc0 += *ptr1++ * *ptr2;
+      ptr2 += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in the accumulator, store in the destination buffer. */
+    *pDst++ = acc0;
+
+    /* Advance by M samples of the intermediate rate */
+    phase += stepPhase;
+    n += stepInt;
+
+    if(phase >= L)
+    {
+      phase -= L;
+      n++;
+    }
+  }
+
+  /* Processing is complete.    
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Points to the last phaseLen - 1 samples */
+  pState = pState + blockSize;
+
+  tapCnt = phaseLen - 1u;
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+}
+
+/**    
+ * @} end of FIR_Resample group    
+ */
@@ -0,0 +1,147 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_cholesky_f64.c    
+*    
+* Description:  Double-precision floating-point Cholesky decomposition.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixChol    
+ * @{    
+ */
+
+/**    
+ * @brief Double-precision floating-point Cholesky decomposition.    
+ * @param[in]       *pSrc points to the instance of the input symmetric positive definite matrix    
+ * @param[out]      *pDst points to the instance of the output lower triangular matrix <code>L</code>    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not square    
+ * and of the same size, <code>ARM_MATH_DECOMPOSITION_FAILURE</code> if the input matrix is not positive definite,    
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * Only the lower triangle of the input matrix is read and <code>pDst</code> may be <code>pSrc</code>:    
+ * the decomposition is then computed in place.  The upper triangle of the output is cleared.    
+ */
+
+arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst)
+{
+  float64_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float64_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float64_t *pRowI, *pRowJ;                      /* rows of the factor */
+  float64_t sum;                                 /* Accumulator */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+
+    /* Compute L column by column: the diagonal element, then the elements below it */
+    for (j = 0u; j < n; j++)
+    {
+      pRowJ = pL + (j * n);
+
+      /* L(j,j) = sqrt(A(j,j) - L(j,0)^2 - ... - L(j,j-1)^2) */
+      sum = pA[(j * n) + j];
+
+      for (k = 0u; k < j; k++)
+      {
+        sum -= pRowJ[k] * pRowJ[k];
+      }
+
+      /* The matrix is not positive definite */
+      if(!(sum > 0.0))
+      {
+        /* Set status as ARM_MATH_DECOMPOSITION_FAILURE */
+        status = ARM_MATH_DECOMPOSITION_FAILURE;
+        break;
+      }
+
+      pRowJ[j] = sqrt(sum);
+
+      /* L(i,j) = (A(i,j) - L(i,0) * L(j,0) - ... - L(i,j-1) * L(j,j-1)) / L(j,j) */
+      for (i = j + 1u; i < n; i++)
+      {
+        pRowI = pL + (i * n);
+        sum = pA[(i * n) + j];
+
+        for (k = 0u; k < j; k++)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+        }
+
+        pRowI[j] = sum / pRowJ[j];
+      }
+    }
+
+    /* Clear the upper triangle */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = i + 1u; j < n; j++)
+      {
+        pL[(i * n) + j] = 0.0;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixChol group    
+ */
@@ -214,9 +214,9 @@ arm_status arm_mat_inverse_f32(
       /* Destination pointer modifier */
       k = 1u;
 
-     /* Grab the most significant value from column l */
+      /* Grab the most significant value from column l, on and below the pivot row */
       maxC = 0;
-      for (i = 0; i < numRows; i++)
+      for (i = l; i < numRows; i++)
       {
         maxC = *pInT1 > 0 ? (*pInT1 > maxC ? *pInT1 : maxC) : (-*pInT1 > maxC ? -*pInT1 : maxC);
         pInT1 += numCols;
@@ -230,7 +230,7 @@ arm_status arm_mat_inverse_f32(
       }
 
       /* Restore pInT1  */
-      pInT1 -= numRows * numCols;
+      pInT1 -= (numRows - l) * numCols;
       
       /* Check if the pivot element is the most significant of the column */
       if( (in > 0.0f ? in : -in) != maxC)
@@ -241,7 +241,7 @@ arm_status arm_mat_inverse_f32(
         while(i > 0u)
         {
           /* Update the input and destination pointers */
-          pInT2 = pInT1 + (numCols * l);
+          pInT2 = pInT1 + (numCols * k);
           pInT4 = pInT3 + (numCols * k);
 
           /* Look for the most significant element to    
@@ -550,7 +550,7 @@ arm_status arm_mat_inverse_f32(
         for (i = (l + 1u); i < numRows; i++)
         {
           /* Update the input and destination pointers */
-          pInT2 = pInT1 + (numCols * l);
+          pInT2 = pInT1 + (numCols * k);
           pInT4 = pInT3 + (numCols * k);
 
           /* Check if there is a non zero pivot element to     
@@ -0,0 +1,228 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_ldlt_f64.c    
+*    
+* Description:  Double-precision floating-point LDL<sup>T</sup> decomposition.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixChol    
+ * @{    
+ */
+
+/**    
+ * @brief Double-precision floating-point LDL<sup>T</sup> decomposition with symmetric pivoting.    
+ * @param[in]       *pSrc points to the instance of the input symmetric positive semidefinite matrix    
+ * @param[out]      *pL points to the instance of the output unit lower triangular matrix <code>L</code>    
+ * @param[out]      *pD points to the instance of the output diagonal matrix <code>D</code>    
+ * @param[out]      *pPerm points to the permutation, an array of <code>n</code> row indices    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not square    
+ * and of the same size, <code>ARM_MATH_DECOMPOSITION_FAILURE</code> if the input matrix is not positive    
+ * semidefinite, and <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * Row <code>i</code> of <code>P * A</code> is row <code>pPerm[i]</code> of <code>A</code>.    
+ * The whole input matrix is read and <code>pL</code> may be <code>pSrc</code>.    
+ * \par    
+ * A pivot smaller than <code>n * DBL_EPSILON</code> times the largest diagonal element of <code>A</code> is taken    
+ * as zero: the remaining diagonal of <code>D</code> is then cleared if the remaining submatrix is negligible    
+ * as well, which happens for a singular positive semidefinite matrix, and the function fails otherwise.    
+ */
+
+arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pL,
+  arm_matrix_instance_f64 * pD,
+  uint16_t * pPerm)
+{
+  float64_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float64_t *pW = pL->pData;                     /* work matrix, then L */
+  float64_t *pOut = pD->pData;                   /* output data matrix pointer D */
+  float64_t *pRowK, *pRowI;                      /* rows of the work matrix */
+  float64_t dk, lik, Xchg;                       /* pivot, multiplier and temporary value */
+  float64_t tol;                                 /* threshold of a zero pivot */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k, p;                           /* loop counters and pivot index */
+  uint16_t iXchg;                                /* temporary index */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pL->numRows != pL->numCols)
+     || (pD->numRows != pD->numCols) || (pSrc->numRows != pL->numRows)
+     || (pSrc->numRows != pD->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+
+    /* The decomposition is computed in place in L */
+    if(pW != pA)
+    {
+      memcpy(pW, pA, n * n * sizeof(float64_t));
+    }
+
+    /* Identity permutation and largest diagonal element */
+    tol = 0.0;
+
+    for (i = 0u; i < n; i++)
+    {
+      pPerm[i] = (uint16_t) i;
+
+      if(fabs(pW[(i * n) + i]) > tol)
+      {
+        tol = fabs(pW[(i * n) + i]);
+      }
+    }
+
+    tol = tol * ((float64_t) n * 2.220446049250313e-16);
+
+    for (k = 0u; k < n; k++)
+    {
+      /* Pivot: the largest remaining diagonal element */
+      p = k;
+
+      for (i = k + 1u; i < n; i++)
+      {
+        if(fabs(pW[(i * n) + i]) > fabs(pW[(p * n) + p]))
+        {
+          p = i;
+        }
+      }
+
+      /* Exchange the rows and the columns k and p */
+      if(p != k)
+      {
+        for (j = 0u; j < n; j++)
+        {
+          Xchg = pW[(k * n) + j];
+          pW[(k * n) + j] = pW[(p * n) + j];
+          pW[(p * n) + j] = Xchg;
+        }
+
+        for (i = 0u; i < n; i++)
+        {
+          Xchg = pW[(i * n) + k];
+          pW[(i * n) + k] = pW[(i * n) + p];
+          pW[(i * n) + p] = Xchg;
+        }
+
+        iXchg = pPerm[k];
+        pPerm[k] = pPerm[p];
+        pPerm[p] = iXchg;
+      }
+
+      pRowK = pW + (k * n);
+      dk = pRowK[k];
+
+      /* Zero pivot: the remaining submatrix must be negligible too */
+      if(fabs(dk) <= tol)
+      {
+        for (i = k; i < n; i++)
+        {
+          for (j = k; j < n; j++)
+          {
+            if(fabs(pW[(i * n) + j]) > tol)
+            {
+              /* Set status as ARM_MATH_DECOMPOSITION_FAILURE */
+              status = ARM_MATH_DECOMPOSITION_FAILURE;
+            }
+
+            pW[(i * n) + j] = 0.0;
+          }
+        }
+
+        break;
+      }
+
+      /* A negative pivot: the matrix is not positive semidefinite */
+      if(dk < 0.0)
+      {
+        /* Set status as ARM_MATH_DECOMPOSITION_FAILURE */
+        status = ARM_MATH_DECOMPOSITION_FAILURE;
+        break;
+      }
+
+      /* Update the remaining submatrix: A(i,j) -= A(i,k) * A(k,j) / A(k,k), and store L(i,k) */
+      for (i = k + 1u; i < n; i++)
+      {
+        pRowI = pW + (i * n);
+        lik = pRowI[k] / dk;
+
+        for (j = k + 1u; j < n; j++)
+        {
+          pRowI[j] -= lik * pRowK[j];
+        }
+
+        pRowI[k] = lik;
+      }
+    }
+
+    /* Move the diagonal to D, set the unit diagonal of L and clear its upper triangle */
+    memset(pOut, 0, n * n * sizeof(float64_t));
+
+    for (i = 0u; i < n; i++)
+    {
+      pOut[(i * n) + i] = pW[(i * n) + i];
+      pW[(i * n) + i] = 1.0;
+
+      for (j = i + 1u; j < n; j++)
+      {
+        pW[(i * n) + j] = 0.0;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixChol group    
+ */
@@ -0,0 +1,409 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_mult_blocked_f32.c    
+*    
+* Description:  Floating-point matrix multiplication by blocks.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixMult    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point matrix multiplication by blocks, for large matrices.    
+ * @param[in]       *pSrcA points to the first input matrix structure    
+ * @param[in]       *pSrcB points to the second input matrix structure, or to its transpose    
+ * @param[out]      *pDst points to output matrix structure    
+ * @param[in]       *pState points to a buffer of <code>MAT_MULT_BLOCK_K * MAT_MULT_BLOCK_N</code> values    
+ * for the packed blocks of <code>pSrcB</code>, or NULL    
+ * @param[in]       transposeFlagB flag that selects the layout of <code>pSrcB</code>:    
+ * 0 for <code>B</code>, 1 for <code>B<sup>T</sup></code>    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes of the matrices    
+ * do not match, <code>ARM_MATH_ARGUMENT_ERROR</code> if <code>pSrcB</code> is transposed and <code>pState</code>    
+ * is NULL, and <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * The output is computed by tiles of 4 rows and 4 columns (4 rows and 2 vectors of columns on a host    
+ * build), whose accumulators stay in registers: each value loaded from <code>A</code> or <code>B</code>    
+ * serves 4 multiplications instead of one.  The inner dimension is cut into blocks of    
+ * <code>MAT_MULT_BLOCK_K</code> and the columns of <code>B</code> into panels of <code>MAT_MULT_BLOCK_N</code>:    
+ * a <code>MAT_MULT_BLOCK_K x MAT_MULT_BLOCK_N</code> block of <code>B</code> is reused for all the rows of    
+ * <code>A</code>, and a block of <code>MAT_MULT_BLOCK_K</code> columns of <code>A</code> for all the panels,    
+ * while they are in the cache.    
+ * \par    
+ * When <code>pState</code> is not NULL, each block of <code>B</code> is first copied into it in the order    
+ * in which the tiles read it, which turns the strided column walk of <code>B</code> into sequential accesses:    
+ * with <code>pState</code> in internal SRAM, a <code>B</code> in external SDRAM is read once per row block of    
+ * <code>MAT_MULT_BLOCK_K</code> instead of once per row of <code>A</code>.    
+ * A pre-transposed <code>B</code> (<code>transposeFlagB = 1</code>, <code>pSrcB</code> of size    
+ * <code>numColsB x numColsA</code>) is read through the same copy.    
+ * \par    
+ * Each output is the sum of the products in the same order as in <code>arm_mat_mult_f32()</code>,    
+ * which calls this function with a NULL <code>pState</code> when all the dimensions reach    
+ * <code>MAT_MULT_BLOCK_MIN</code>.    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+/*    
+ * Host build: tile of 4 rows and 2 * __HOST_VLEN columns.    
+ */
+
+__HOST_SIMD_TARGET
+static void arm_mat_mult_blocked_f32_host(
+  const float32_t * pA,
+  uint32_t lda,
+  const float32_t * pB,
+  uint32_t ldb,
+  float32_t * pC,
+  uint32_t ldc,
+  uint32_t numK,
+  uint32_t firstBlk)
+{
+  __host_vf c00, c01, c10, c11, c20, c21, c30, c31;     /* Accumulators of the tile */
+  __host_vf b0, b1;                              /* Row of the tile of B */
+  const float32_t *pA1 = pA + lda;               /* Rows of A */
+  const float32_t *pA2 = pA1 + lda;
+  const float32_t *pA3 = pA2 + lda;
+  uint32_t k;                                    /* Loop counter */
+
+  if(firstBlk)
+  {
+    c00 = c01 = c10 = c11 = (__host_vf) { 0.0f };
+    c20 = c21 = c30 = c31 = (__host_vf) { 0.0f };
+  }
+  else
+  {
+    c00 = __HOST_LD(pC);
+    c01 = __HOST_LD(pC + __HOST_VLEN);
+    c10 = __HOST_LD(pC + ldc);
+    c11 = __HOST_LD(pC + ldc + __HOST_VLEN);
+    c20 = __HOST_LD(pC + (2u * ldc));
+    c21 = __HOST_LD(pC + (2u * ldc) + __HOST_VLEN);
+    c30 = __HOST_LD(pC + (3u * ldc));
+    c31 = __HOST_LD(pC + (3u * ldc) + __HOST_VLEN);
+  }
+
+  for (k = 0u; k < numK; k++)
+  {
+    b0 = __HOST_LD(pB);
+    b1 = __HOST_LD(pB + __HOST_VLEN);
+    pB += ldb;
+
+    c00 += pA[k] * b0;
+    c01 += pA[k] * b1;
+    c10 += pA1[k] * b0;
+    c11 += pA1[k] * b1;
+    c20 += pA2[k] * b0;
+    c21 += pA2[k] * b1;
+    c30 += pA3[k] * b0;
+    c31 += pA3[k] * b1;
+  }
+
+  __HOST_ST(pC, c00);
+  __HOST_ST(pC + __HOST_VLEN, c01);
+  __HOST_ST(pC + ldc, c10);
+  __HOST_ST(pC + ldc + __HOST_VLEN, c11);
+  __HOST_ST(pC + (2u * ldc), c20);
+  __HOST_ST(pC + (2u * ldc) + __HOST_VLEN, c21);
+  __HOST_ST(pC + (3u * ldc), c30);
+  __HOST_ST(pC + (3u * ldc) + __HOST_VLEN, c31);
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+/*    
+ * Tile of 4 rows and 4 columns: C(0:3,0:3) = (firstBlk ? 0 : C(0:3,0:3)) + A(0:3,0:numK-1) * B(0:numK-1,0:3),    
+ * where the rows of the tile of B are ldb values apart.    
+ */
+
+static void arm_mat_mult_blocked_f32_tile(
+  const float32_t * pA,
+  uint32_t lda,
+  const float32_t * pB,
+  uint32_t ldb,
+  float32_t * pC,
+  uint32_t ldc,
+  uint32_t numK,
+  uint32_t firstBlk)
+{
+  float32_t c00, c01, c02, c03, c10, c11, c12, c13;     /* Accumulators of the tile */
+  float32_t c20, c21, c22, c23, c30, c31, c32, c33;
+  float32_t a0, a1, a2, a3, b0, b1, b2, b3;      /* Column of A and row of B */
+  const float32_t *pA1 = pA + lda;               /* Rows of A */
+  const float32_t *pA2 = pA1 + lda;
+  const float32_t *pA3 = pA2 + lda;
+  float32_t *pC1 = pC + ldc;                     /* Rows of C */
+  float32_t *pC2 = pC1 + ldc;
+  float32_t *pC3 = pC2 + ldc;
+  uint32_t k;                                    /* Loop counter */
+
+  if(firstBlk)
+  {
+    c00 = c01 = c02 = c03 = c10 = c11 = c12 = c13 = 0.0f;
+    c20 = c21 = c22 = c23 = c30 = c31 = c32 = c33 = 0.0f;
+  }
+  else
+  {
+    c00 = pC[0];  c01 = pC[1];  c02 = pC[2];  c03 = pC[3];
+    c10 = pC1[0]; c11 = pC1[1]; c12 = pC1[2]; c13 = pC1[3];
+    c20 = pC2[0]; c21 = pC2[1]; c22 = pC2[2]; c23 = pC2[3];
+    c30 = pC3[0]; c31 = pC3[1]; c32 = pC3[2]; c33 = pC3[3];
+  }
+
+  for (k = 0u; k < numK; k++)
+  {
+    /* Load a column of the tile of A and a row of the tile of B */
+    a0 = pA[k];
+    a1 = pA1[k];
+    a2 = pA2[k];
+    a3 = pA3[k];
+    b0 = pB[0];
+    b1 = pB[1];
+    b2 = pB[2];
+    b3 = pB[3];
+    pB += ldb;
+
+    /* 16 multiplications for 8 loads */
+    c00 += a0 * b0;
+    c01 += a0 * b1;
+    c02 += a0 * b2;
+    c03 += a0 * b3;
+    c10 += a1 * b0;
+    c11 += a1 * b1;
+    c12 += a1 * b2;
+    c13 += a1 * b3;
+    c20 += a2 * b0;
+    c21 += a2 * b1;
+    c22 += a2 * b2;
+    c23 += a2 * b3;
+    c30 += a3 * b0;
+    c31 += a3 * b1;
+    c32 += a3 * b2;
+    c33 += a3 * b3;
+  }
+
+  pC[0] = c00;  pC[1] = c01;  pC[2] = c02;  pC[3] = c03;
+  pC1[0] = c10; pC1[1] = c11; pC1[2] = c12; pC1[3] = c13;
+  pC2[0] = c20; pC2[1] = c21; pC2[2] = c22; pC2[3] = c23;
+  pC3[0] = c30; pC3[1] = c31; pC3[2] = c32; pC3[3] = c33;
+}
+
+arm_status arm_mat_mult_blocked_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pState,
+  uint8_t transposeFlagB)
+{
+  float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A */
+  float32_t *pInB = pSrcB->pData;                /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pIn1, *pIn2, *px;                   /* Temporary data matrix pointers */
+  float32_t *pPanel;                             /* Block of B read by the tiles */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t numRowsA = pDst->numRows;             /* number of rows of input matrix A */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numColsB = pDst->numCols;             /* number of columns of input matrix B */
+  uint32_t numRows4 = numRowsA & ~3u;            /* rows of A computed by tiles */
+  uint32_t ldb;                                  /* distance between the rows of the block of B */
+  uint32_t strideB;                              /* distance between consecutive elements of a column of B */
+  uint32_t tileCols;                             /* number of columns of a tile */
+  uint32_t width;                                /* number of columns of the current tile */
+  uint32_t jc, pc, nc, kc;                       /* position and size of the block */
+  uint32_t ncTiles, ncTiles4;                    /* columns of the block computed by tiles */
+  uint32_t i, j, k, l;                           /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numRows != pDst->numRows) ||
+     ((transposeFlagB == 0u) && ((pSrcB->numRows != numColsA) || (pSrcB->numCols != numColsB))) ||
+     ((transposeFlagB != 0u) && ((pSrcB->numCols != numColsA) || (pSrcB->numRows != numColsB))))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  if((transposeFlagB != 0u) && (pState == NULL))
+  {
+    /* A transposed B is read through the packed blocks only */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    tileCols = 4u;
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+    /* Host build: the tiles are computed with the vector unit */
+    if(__HOST_SIMD_READY())
+    {
+      tileCols = 2u * __HOST_VLEN;
+    }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+    strideB = (transposeFlagB != 0u) ? 1u : numColsB;
+
+    /* Blocks of MAT_MULT_BLOCK_K columns of A: the block of A stays in the cache for all the panels */
+    for (pc = 0u; pc < numColsA; pc += MAT_MULT_BLOCK_K)
+    {
+      kc = ((numColsA - pc) < MAT_MULT_BLOCK_K) ? (numColsA - pc) : MAT_MULT_BLOCK_K;
+
+      /* Panels of MAT_MULT_BLOCK_N columns of the corresponding rows of B */
+      for (jc = 0u; jc < numColsB; jc += MAT_MULT_BLOCK_N)
+      {
+        nc = ((numColsB - jc) < MAT_MULT_BLOCK_N) ? (numColsB - jc) : MAT_MULT_BLOCK_N;
+        ncTiles = nc - (nc % tileCols);
+        ncTiles4 = nc & ~3u;
+
+        if(pState != NULL)
+        {
+          /* Copy the block, tile after tile, each tile row after row.    
+           ** The tile of columns j to j + width - 1 starts at pState + j * kc. */
+          px = pState;
+
+          for (j = 0u; j < ncTiles4; j += width)
+          {
+            width = (j < ncTiles) ? tileCols : 4u;
+
+            if(transposeFlagB != 0u)
+            {
+              for (l = 0u; l < width; l++)
+              {
+                pIn2 = pInB + ((jc + j + l) * numColsA) + pc;
+
+                for (k = 0u; k < kc; k++)
+                {
+                  px[(k * width) + l] = pIn2[k];
+                }
+              }
+
+              px += kc * width;
+            }
+            else
+            {
+              for (k = 0u; k < kc; k++)
+              {
+                pIn2 = pInB + ((pc + k) * numColsB) + jc + j;
+
+                for (l = 0u; l < width; l++)
+                {
+                  *px++ = pIn2[l];
+                }
+              }
+            }
+          }
+
+          pPanel = pState;
+        }
+        else
+        {
+          /* The tiles read B in place */
+          pPanel = pInB + (pc * numColsB) + jc;
+        }
+
+        /* Tiles of 4 rows */
+        for (i = 0u; i < numRows4; i += 4u)
+        {
+          pIn1 = pInA + (i * numColsA) + pc;
+          px = pOut + (i * numColsB) + jc;
+
+          for (j = 0u; j < ncTiles4; j += width)
+          {
+            /* Wide tiles, then tiles of 4 columns */
+            width = (j < ncTiles) ? tileCols : 4u;
+            pIn2 = (pState != NULL) ? (pPanel + (j * kc)) : (pPanel + j);
+            ldb = (pState != NULL) ? width : numColsB;
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+            if(width != 4u)
+            {
+              arm_mat_mult_blocked_f32_host(pIn1, numColsA, pIn2, ldb, px + j, numColsB, kc, pc == 0u);
+            }
+            else
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
+            arm_mat_mult_blocked_f32_tile(pIn1, numColsA, pIn2, ldb, px + j, numColsB, kc, pc == 0u);
+          }
+        }
+
+        /* Remaining columns of the panel for the tiled rows, then all the columns for the remaining rows */
+        for (i = 0u; i < numRowsA; i++)
+        {
+          for (j = (i < numRows4) ? ncTiles4 : 0u; j < nc; j++)
+          {
+            pIn1 = pInA + (i * numColsA) + pc;
+            pIn2 = (transposeFlagB != 0u) ? (pInB + ((jc + j) * numColsA) + pc) : (pInB + (pc * numColsB) + jc + j);
+            px = pOut + (i * numColsB) + jc + j;
+
+            sum = (pc == 0u) ? 0.0f : *px;
+
+            for (k = 0u; k < kc; k++)
+            {
+              sum += pIn1[k] * (*pIn2);
+              pIn2 += strideB;
+            }
+
+            *px = sum;
+          }
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixMult group    
+ */
@@ -0,0 +1,236 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_mult_blocked_q15.c    
+*    
+* Description:  Q15 matrix multiplication by tiles.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixMult    
+ * @{    
+ */
+
+/**    
+ * @brief Q15 matrix multiplication by tiles, for large matrices.    
+ * @param[in]       *pSrcA points to the first input matrix structure    
+ * @param[in]       *pSrcB points to the second input matrix structure, or to its transpose    
+ * @param[out]      *pDst points to output matrix structure    
+ * @param[in]       *pState points to the array of <code>numRowsB * numColsB</code> values that receives    
+ * the transpose of <code>B</code>; unused when <code>transposeFlagB</code> is 1    
+ * @param[in]       transposeFlagB flag that selects the layout of <code>pSrcB</code>:    
+ * 0 for <code>B</code>, 1 for <code>B<sup>T</sup></code>    
+ * @return     		The function returns either    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.    
+ *    
+ * @details    
+ * The output is computed by tiles of 2 rows and 2 columns: each pair of values loaded from a row of    
+ * <code>A</code> or from a row of <code>B<sup>T</sup></code> serves two dual multiply-accumulates instead of one.    
+ * With <code>transposeFlagB</code> set, <code>pSrcB</code> is a <code>numColsB x numColsA</code> matrix    
+ * which is read in place, and the transposition is saved.    
+ * \par    
+ * The scaling, the saturation and the results are those of <code>arm_mat_mult_q15()</code>, which calls    
+ * this function when all the dimensions reach <code>MAT_MULT_BLOCK_MIN</code>.    
+ */
+
+arm_status arm_mat_mult_blocked_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst,
+  q15_t * pState,
+  uint8_t transposeFlagB)
+{
+  q15_t *pInA = pSrcA->pData;                    /* input data matrix pointer A */
+  q15_t *pInB = pSrcB->pData;                    /* input data matrix pointer B */
+  q15_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  q15_t *pSrcBT;                                 /* transposed B */
+  q15_t *pA0, *pA1, *pB0, *pB1;                  /* rows of the tile of A and of B transposed */
+  q63_t sum00, sum01, sum10, sum11;              /* accumulators of the tile */
+  uint32_t numRowsA = pDst->numRows;             /* number of rows of input matrix A */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numColsB = pDst->numCols;             /* number of columns of input matrix B */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of matrix multiplication */
+
+#ifndef UNALIGNED_SUPPORT_DISABLE
+
+  q31_t inA0, inA1, inB0, inB1;                  /* pairs of input values */
+
+#else
+
+  q15_t inA0, inA1, inB0, inB1;                  /* input values */
+
+#endif	/*	#ifndef UNALIGNED_SUPPORT_DISABLE	*/
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numRows != pDst->numRows) ||
+     ((transposeFlagB == 0u) && ((pSrcB->numRows != numColsA) || (pSrcB->numCols != numColsB))) ||
+     ((transposeFlagB != 0u) && ((pSrcB->numCols != numColsA) || (pSrcB->numRows != numColsB))))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    if(transposeFlagB != 0u)
+    {
+      pSrcBT = pInB;
+    }
+    else
+    {
+      /* Matrix transpose: the columns of B become contiguous */
+      for (k = 0u; k < numColsA; k++)
+      {
+        for (j = 0u; j < numColsB; j++)
+        {
+          pState[(j * numColsA) + k] = pInB[(k * numColsB) + j];
+        }
+      }
+
+      pSrcBT = pState;
+    }
+
+    /* Tiles of 2 rows and 2 columns.  A last odd row or column is computed twice and stored once. */
+    for (i = 0u; i < numRowsA; i += 2u)
+    {
+      for (j = 0u; j < numColsB; j += 2u)
+      {
+        pA0 = pInA + (i * numColsA);
+        pA1 = ((i + 1u) < numRowsA) ? (pA0 + numColsA) : pA0;
+        pB0 = pSrcBT + (j * numColsA);
+        pB1 = ((j + 1u) < numColsB) ? (pB0 + numColsA) : pB0;
+
+        sum00 = 0;
+        sum01 = 0;
+        sum10 = 0;
+        sum11 = 0;
+
+        /* Two columns of A and two rows of B at a time */
+        k = numColsA >> 1u;
+
+        while(k > 0u)
+        {
+#ifndef UNALIGNED_SUPPORT_DISABLE
+
+          /* Read two values from each row */
+          inA0 = *__SIMD32(pA0)++;
+          inA1 = *__SIMD32(pA1)++;
+          inB0 = *__SIMD32(pB0)++;
+          inB1 = *__SIMD32(pB1)++;
+
+          /* 8 multiply-accumulates for 4 loads */
+          sum00 = __SMLALD(inA0, inB0, sum00);
+          sum01 = __SMLALD(inA0, inB1, sum01);
+          sum10 = __SMLALD(inA1, inB0, sum10);
+          sum11 = __SMLALD(inA1, inB1, sum11);
+
+#else
+
+          inA0 = *pA0++;
+          inA1 = *pA1++;
+          inB0 = *pB0++;
+          inB1 = *pB1++;
+
+          sum00 += (q31_t) inA0 * inB0;
+          sum01 += (q31_t) inA0 * inB1;
+          sum10 += (q31_t) inA1 * inB0;
+          sum11 += (q31_t) inA1 * inB1;
+
+          inA0 = *pA0++;
+          inA1 = *pA1++;
+          inB0 = *pB0++;
+          inB1 = *pB1++;
+
+          sum00 += (q31_t) inA0 * inB0;
+          sum01 += (q31_t) inA0 * inB1;
+          sum10 += (q31_t) inA1 * inB0;
+          sum11 += (q31_t) inA1 * inB1;
+
+#endif	/*	#ifndef UNALIGNED_SUPPORT_DISABLE	*/
+
+          /* Decrement the loop counter */
+          k--;
+        }
+
+        /* Last column of A when their number is odd */
+        if((numColsA & 1u) != 0u)
+        {
+          sum00 += (q31_t) * pA0 * *pB0;
+          sum01 += (q31_t) * pA0 * *pB1;
+          sum10 += (q31_t) * pA1 * *pB0;
+          sum11 += (q31_t) * pA1 * *pB1;
+        }
+
+        /* Saturate and store the results in the destination buffer */
+        pOut[(i * numColsB) + j] = (q15_t) (__SSAT((sum00 >> 15), 16));
+
+        if((j + 1u) < numColsB)
+        {
+          pOut[(i * numColsB) + j + 1u] = (q15_t) (__SSAT((sum01 >> 15), 16));
+        }
+
+        if((i + 1u) < numRowsA)
+        {
+          pOut[((i + 1u) * numColsB) + j] = (q15_t) (__SSAT((sum10 >> 15), 16));
+
+          if((j + 1u) < numColsB)
+          {
+            pOut[((i + 1u) * numColsB) + j + 1u] = (q15_t) (__SSAT((sum11 >> 15), 16));
+          }
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixMult group    
+ */
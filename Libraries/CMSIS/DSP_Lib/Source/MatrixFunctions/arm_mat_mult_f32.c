@@ -73,8 +73,62 @@
  * @param[out]      *pDst points to output matrix structure    
  * @return     		The function returns either    
  * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.    
+ *    
+ * \par    
+ * Except on Cortex-M0, matrices whose dimensions all reach <code>MAT_MULT_BLOCK_MIN</code> are multiplied    
+ * by <code>arm_mat_mult_blocked_f32()</code>, with the same results.    
+ */
+
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+/*    
+ * Host build: computes numBlks blocks of 8 columns of one output row, one column per vector lane.    
+ * Each lane sums the products in the same order as the scalar code, so the results are bit-exact.    
  */
 
+__HOST_SIMD_TARGET
+static void arm_mat_mult_f32_host8(
+  const float32_t * pInA,
+  const float32_t * pInB,
+  float32_t * pOut,
+  uint16_t numColsA,
+  uint16_t numColsB,
+  uint16_t numBlks)
+{
+  __host_vf sum[8 / __HOST_VLEN];                /* Accumulators of 8 columns */
+  const float32_t *pIn2;                         /* Column block of matrix B */
+  uint16_t k, l;                                 /* Loop counters */
+
+  while(numBlks > 0u)
+  {
+    for (l = 0u; l < 8u; l += __HOST_VLEN)
+    {
+      sum[l / __HOST_VLEN] = (__host_vf) { 0.0f };
+    }
+    pIn2 = pInB;
+
+    for (k = 0u; k < numColsA; k++)
+    {
+      for (l = 0u; l < 8u; l += __HOST_VLEN)
+      {
+        sum[l / __HOST_VLEN] += pInA[k] * __HOST_LD(pIn2 + l);
+      }
+      pIn2 += numColsB;
+    }
+
+    for (l = 0u; l < 8u; l += __HOST_VLEN)
+    {
+      __HOST_ST(pOut + l, sum[l / __HOST_VLEN]);
+    }
+    pOut += 8;
+    pInB += 8;
+
+    numBlks--;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
 arm_status arm_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcA,
   const arm_matrix_instance_f32 * pSrcB,
@@ -95,9 +149,16 @@ arm_status arm_mat_mult_f32(
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
   float32_t in1, in2, in3, in4;
-  uint16_t col, i = 0u, j, row = numRowsA, colCnt;      /* loop counters */
+  uint16_t col, j, row = numRowsA, colCnt;       /* loop counters */
+  uint32_t i = 0u;                               /* offset of the row being processed */
   arm_status status;                             /* status of matrix multiplication */
 
+  /* Large matrices are multiplied by register tiles and cache blocks */
+  if((numRowsA >= MAT_MULT_BLOCK_MIN) && (numColsA >= MAT_MULT_BLOCK_MIN) && (numColsB >= MAT_MULT_BLOCK_MIN))
+  {
+    return (arm_mat_mult_blocked_f32(pSrcA, pSrcB, pDst, NULL, 0u));
+  }
+
 #ifdef ARM_MATH_MATRIX_CHECK
 
 
@@ -129,8 +190,22 @@ arm_status arm_mat_mult_f32(
 
       j = 0u;
 
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+      /* Host build: the blocks of 8 columns are computed with the vector unit */
+      if(__HOST_SIMD_READY())
+      {
+        arm_mat_mult_f32_host8(pInA, pIn2, px, numColsA, numColsB, numColsB >> 3u);
+        j = numColsB & ~7u;
+        col = numColsB & 7u;
+        px += j;
+        pIn2 += j;
+      }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
       /* column loop */
-      do
+      while(col > 0u)
       {
         /* Set the variable sum, that acts as accumulator, to zero */
         sum = 0.0f;
@@ -192,14 +267,15 @@ arm_status arm_mat_mult_f32(
         /* Decrement the column loop counter */
         col--;
 
-      } while(col > 0u);
+      }
 
 #else
 
   /* Run the below code for Cortex-M0 */
 
   float32_t *pInB = pSrcB->pData;                /* input data matrix pointer B */
-  uint16_t col, i = 0u, row = numRowsA, colCnt;  /* loop counters */
+  uint16_t col, row = numRowsA, colCnt;          /* loop counters */
+  uint32_t i = 0u;                               /* offset of the row being processed */
   arm_status status;                             /* status of matrix multiplication */
 
 #ifdef ARM_MATH_MATRIX_CHECK
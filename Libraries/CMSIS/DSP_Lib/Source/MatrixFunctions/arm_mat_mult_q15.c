@@ -74,6 +74,9 @@
  * \par    
  * Refer to <code>arm_mat_mult_fast_q15()</code> for a faster but less precise version of this function for Cortex-M3 and Cortex-M4.    
  *    
+ * \par    
+ * Except on Cortex-M0, matrices whose dimensions all reach <code>MAT_MULT_BLOCK_MIN</code> are multiplied    
+ * by <code>arm_mat_mult_blocked_q15()</code>, with the same results.    
  */
 
 arm_status arm_mat_mult_q15(
@@ -96,7 +99,8 @@ arm_status arm_mat_mult_q15(
   uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
   uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
   uint16_t numRowsB = pSrcB->numRows;            /* number of rows of input matrix A    */
-  uint16_t col, i = 0u, row = numRowsB, colCnt;  /* loop counters */
+  uint16_t col, row = numRowsB, colCnt;          /* loop counters */
+  uint32_t i = 0u;                               /* offset of the row being processed */
   arm_status status;                             /* status of matrix multiplication */
 
 #ifndef UNALIGNED_SUPPORT_DISABLE
@@ -111,6 +115,12 @@ arm_status arm_mat_mult_q15(
 
 #endif	/*	#ifndef UNALIGNED_SUPPORT_DISABLE	*/
 
+  /* Large matrices are multiplied by register tiles */
+  if((numRowsA >= MAT_MULT_BLOCK_MIN) && (numColsA >= MAT_MULT_BLOCK_MIN) && (numColsB >= MAT_MULT_BLOCK_MIN))
+  {
+    return (arm_mat_mult_blocked_q15(pSrcA, pSrcB, pDst, pState, 0u));
+  }
+
 #ifdef ARM_MATH_MATRIX_CHECK
   /* Check for matrix mismatch condition */
   if((pSrcA->numCols != pSrcB->numRows) ||
@@ -380,7 +390,8 @@ arm_status arm_mat_mult_q15(
   uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
   uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
   uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A    */
-  uint16_t col, i = 0u, row = numRowsA, colCnt;  /* loop counters */
+  uint16_t col, row = numRowsA, colCnt;          /* loop counters */
+  uint32_t i = 0u;                               /* offset of the row being processed */
   arm_status status;                             /* status of matrix multiplication */
 
 #ifdef ARM_MATH_MATRIX_CHECK
@@ -94,7 +94,8 @@ arm_status arm_mat_mult_q31(
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
-  uint16_t col, i = 0u, j, row = numRowsA, colCnt;      /* loop counters */
+  uint16_t col, j, row = numRowsA, colCnt;       /* loop counters */
+  uint32_t i = 0u;                               /* offset of the row being processed */
   arm_status status;                             /* status of matrix multiplication */
   q31_t a0, a1, a2, a3, b0, b1, b2, b3;
 
@@ -205,7 +206,8 @@ arm_status arm_mat_mult_q31(
   /* Run the below code for Cortex-M0 */
 
   q31_t *pInB = pSrcB->pData;                    /* input data matrix pointer B */
-  uint16_t col, i = 0u, row = numRowsA, colCnt;  /* loop counters */
+  uint16_t col, row = numRowsA, colCnt;          /* loop counters */
+  uint32_t i = 0u;                               /* offset of the row being processed */
   arm_status status;                             /* status of matrix multiplication */
 
 
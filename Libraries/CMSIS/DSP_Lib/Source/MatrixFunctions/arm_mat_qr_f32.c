@@ -0,0 +1,226 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_qr_f32.c    
+*    
+* Description:  Floating-point QR decomposition.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixQR QR Decomposition    
+ *    
+ * Factorises an <code>M x N</code> matrix, <code>M >= N</code>, as    
+ * <pre>    
+ *     A = Q * R    
+ * </pre>    
+ * where <code>Q</code> is an <code>M x M</code> orthogonal matrix and <code>R</code> is an <code>M x N</code>    
+ * upper triangular matrix.  The least squares solution of <code>A * x = b</code> is then found by solving    
+ * <code>R * x = Q<sup>T</sup> * b</code> with <code>arm_mat_solve_upper_triangular_f32()</code>.    
+ *    
+ * \par Algorithm    
+ * The columns are reduced one after the other with Householder reflections    
+ * <code>H = I - tau * v * v<sup>T</sup></code>.  The reflections are stored below the diagonal of    
+ * <code>R</code> until <code>Q</code> is formed, then the lower part of <code>R</code> is cleared.    
+ */
+
+/**    
+ * @addtogroup MatrixQR    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point QR decomposition.    
+ * @param[in]       *pSrc points to the instance of the input <code>M x N</code> matrix, <code>M >= N</code>    
+ * @param[out]      *pR points to the instance of the output <code>M x N</code> upper triangular matrix    
+ * @param[out]      *pQ points to the instance of the output <code>M x M</code> orthogonal matrix    
+ * @param[out]      *pTau points to a buffer of <code>N</code> values, the scale factors of the reflections    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes of the matrices    
+ * do not match, and <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * <code>pR</code> may be <code>pSrc</code>: the decomposition is then computed in place.    
+ */
+
+arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pR,
+  arm_matrix_instance_f32 * pQ,
+  float32_t * pTau)
+{
+  float32_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float32_t *pOut = pR->pData;                   /* output data matrix pointer R */
+  float32_t *pOutQ = pQ->pData;                  /* output data matrix pointer Q */
+  float32_t norm, x0, beta, scale, sum;          /* temporary values */
+  uint32_t numRows = pSrc->numRows;              /* Number of rows in the matrix */
+  uint32_t numCols = pSrc->numCols;              /* Number of columns in the matrix */
+  uint32_t numRefl;                              /* Number of reflections */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows < pSrc->numCols) || (pR->numRows != pSrc->numRows)
+     || (pR->numCols != pSrc->numCols) || (pQ->numRows != pSrc->numRows)
+     || (pQ->numCols != pSrc->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* The decomposition is computed in place in R */
+    if(pOut != pA)
+    {
+      memcpy(pOut, pA, numRows * numCols * sizeof(float32_t));
+    }
+
+    /* The last column of a square matrix needs no reflection */
+    numRefl = (numRows > numCols) ? numCols : (numRows - 1u);
+
+    for (k = 0u; k < numRefl; k++)
+    {
+      /* Norm of the column below the diagonal */
+      x0 = pOut[(k * numCols) + k];
+      norm = 0.0f;
+
+      for (i = k + 1u; i < numRows; i++)
+      {
+        norm += pOut[(i * numCols) + k] * pOut[(i * numCols) + k];
+      }
+
+      /* Nothing to reduce */
+      if(norm == 0.0f)
+      {
+        pTau[k] = 0.0f;
+        continue;
+      }
+
+      /* The reflection maps the column to beta * e1, with the sign that avoids cancellation */
+      arm_sqrt_f32((x0 * x0) + norm, &beta);
+      beta = (x0 > 0.0f) ? -beta : beta;
+
+      /* v = x / (x0 - beta) with v(0) = 1, tau = (beta - x0) / beta */
+      pTau[k] = (beta - x0) / beta;
+      scale = 1.0f / (x0 - beta);
+
+      for (i = k + 1u; i < numRows; i++)
+      {
+        pOut[(i * numCols) + k] *= scale;
+      }
+
+      pOut[(k * numCols) + k] = beta;
+
+      /* Apply the reflection to the remaining columns */
+      for (j = k + 1u; j < numCols; j++)
+      {
+        sum = pOut[(k * numCols) + j];
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          sum += pOut[(i * numCols) + k] * pOut[(i * numCols) + j];
+        }
+
+        sum *= pTau[k];
+        pOut[(k * numCols) + j] -= sum;
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          pOut[(i * numCols) + j] -= sum * pOut[(i * numCols) + k];
+        }
+      }
+    }
+
+    /* Q = H(0) * H(1) * ... applied to the identity, from the last reflection */
+    memset(pOutQ, 0, numRows * numRows * sizeof(float32_t));
+
+    for (i = 0u; i < numRows; i++)
+    {
+      pOutQ[(i * numRows) + i] = 1.0f;
+    }
+
+    k = numRefl;
+
+    while(k > 0u)
+    {
+      k--;
+
+      for (j = k; j < numRows; j++)
+      {
+        sum = pOutQ[(k * numRows) + j];
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          sum += pOut[(i * numCols) + k] * pOutQ[(i * numRows) + j];
+        }
+
+        sum *= pTau[k];
+        pOutQ[(k * numRows) + j] -= sum;
+
+        for (i = k + 1u; i < numRows; i++)
+        {
+          pOutQ[(i * numRows) + j] -= sum * pOut[(i * numCols) + k];
+        }
+      }
+    }
+
+    /* Clear the reflections below the diagonal of R */
+    for (i = 1u; i < numRows; i++)
+    {
+      for (j = 0u; (j < i) && (j < numCols); j++)
+      {
+        pOut[(i * numCols) + j] = 0.0f;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixQR group    
+ */
@@ -0,0 +1,133 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_solve_cholesky_f32.c    
+*    
+* Description:  Floating-point solution of a system factorised by the Cholesky decomposition.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixSolve    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point solution of a system factorised by the Cholesky decomposition.    
+ * @param[in]       *pT points to the instance of the Cholesky factor <code>L</code>    
+ * @param[in]       *pB points to the instance of the right-hand side matrix    
+ * @param[out]      *pX points to the instance of the solution matrix, which may be <code>pB</code>    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes of the matrices    
+ * do not match, <code>ARM_MATH_SINGULAR</code> if a diagonal element of <code>L</code> is zero,    
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * Solves <code>L * Y = B</code> by forward substitution, then <code>L<sup>T</sup> * X = Y</code> by    
+ * back substitution reading <code>L</code> by columns.  Only the lower triangle of <code>pT</code> is read.    
+ */
+
+arm_status arm_mat_solve_cholesky_f32(
+  const arm_matrix_instance_f32 * pT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+  float32_t *pIn = pT->pData;                    /* Cholesky factor pointer */
+  float32_t *pRowX, *pRowK;                      /* rows of the solution */
+  float32_t tik, tii;                            /* elements of the factor */
+  uint32_t n = pT->numRows;                      /* Number of equations */
+  uint32_t numCols = pB->numCols;                /* Number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of the solution */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pT->numRows != pT->numCols) || (pB->numRows != pT->numRows)
+     || (pX->numRows != pB->numRows) || (pX->numCols != pB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* L * Y = B */
+    status = arm_mat_solve_lower_triangular_f32(pT, pB, pX);
+
+    if(status == ARM_MATH_SUCCESS)
+    {
+      /* Back substitution: X(i,:) = (Y(i,:) - L(i+1,i) * X(i+1,:) - ... - L(n-1,i) * X(n-1,:)) / L(i,i) */
+      i = n;
+
+      while(i > 0u)
+      {
+        i--;
+
+        pRowX = pX->pData + (i * numCols);
+
+        for (k = i + 1u; k < n; k++)
+        {
+          tik = pIn[(k * n) + i];
+          pRowK = pX->pData + (k * numCols);
+
+          for (c = 0u; c < numCols; c++)
+          {
+            pRowX[c] -= tik * pRowK[c];
+          }
+        }
+
+        tii = pIn[(i * n) + i];
+
+        for (c = 0u; c < numCols; c++)
+        {
+          pRowX[c] /= tii;
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixSolve group    
+ */
@@ -0,0 +1,151 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_mat_solve_lower_triangular_f32.c    
+*    
+* Description:  Floating-point solution of a lower triangular system.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixSolve Triangular Solvers    
+ *    
+ * Solves <code>T * X = B</code> by forward or back substitution, where <code>T</code> is an    
+ * <code>N x N</code> lower or upper triangular matrix and <code>B</code> and <code>X</code> are    
+ * <code>N x P</code> matrices, one right-hand side per column.    
+ * <code>arm_mat_solve_cholesky_f32()</code> solves <code>L * L<sup>T</sup> * X = B</code> with the    
+ * factor of <code>arm_mat_cholesky_f32()</code>, without transposing it.    
+ *    
+ * \par    
+ * <code>X</code> may be <code>B</code>: the solution then overwrites the right-hand sides.    
+ * The rows of <code>X</code> are updated as a whole, which keeps the accesses sequential.    
+ */
+
+/**    
+ * @addtogroup MatrixSolve    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point solution of a lower triangular system.    
+ * @param[in]       *pT points to the instance of the triangular matrix    
+ * @param[in]       *pB points to the instance of the right-hand side matrix    
+ * @param[out]      *pX points to the instance of the solution matrix, which may be <code>pB</code>    
+ * @return     		The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes of the matrices    
+ * do not match, <code>ARM_MATH_SINGULAR</code> if a diagonal element of <code>pT</code> is zero,    
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * Only the lower triangle of <code>pT</code> is read.    
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pX)
+{
+  float32_t *pIn = pT->pData;                    /* triangular matrix pointer */
+  float32_t *pRowX, *pRowK;                      /* rows of the solution */
+  float32_t tik, tii;                            /* elements of the triangular matrix */
+  uint32_t n = pT->numRows;                      /* Number of equations */
+  uint32_t numCols = pB->numCols;                /* Number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of the solution */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pT->numRows != pT->numCols) || (pB->numRows != pT->numRows)
+     || (pX->numRows != pB->numRows) || (pX->numCols != pB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+
+    if(pX->pData != pB->pData)
+    {
+      memcpy(pX->pData, pB->pData, n * numCols * sizeof(float32_t));
+    }
+
+    /* Forward substitution: X(i,:) = (B(i,:) - T(i,0) * X(0,:) - ... - T(i,i-1) * X(i-1,:)) / T(i,i) */
+    for (i = 0u; i < n; i++)
+    {
+      pRowX = pX->pData + (i * numCols);
+
+      for (k = 0u; k < i; k++)
+      {
+        tik = pIn[(i * n) + k];
+        pRowK = pX->pData + (k * numCols);
+
+        for (c = 0u; c < numCols; c++)
+        {
+          pRowX[c] -= tik * pRowK[c];
+        }
+      }
+
+      tii = pIn[(i * n) + i];
+
+      if(tii == 0.0f)
+      {
+        /* Set status as ARM_MATH_SINGULAR */
+        status = ARM_MATH_SINGULAR;
+        break;
+      }
+
+      for (c = 0u; c < numCols; c++)
+      {
+        pRowX[c] /= tii;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixSolve group    
+ */
@@ -54,7 +54,7 @@
  * 	Result = pSrc[0] * pSrc[0] + pSrc[1] * pSrc[1] + pSrc[2] * pSrc[2] + ... + pSrc[blockSize-1] * pSrc[blockSize-1];    
  * </pre>    
  *   
- * There are separate functions for floating point, Q31, Q15, and Q7 data types.     
+ * There are separate functions for double-precision floating point, floating point, Q31, Q15, and Q7 data types.     
  */
 
 /**    
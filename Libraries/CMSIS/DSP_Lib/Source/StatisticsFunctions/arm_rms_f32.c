@@ -55,7 +55,7 @@
  * 	Result = sqrt(((pSrc[0] * pSrc[0] + pSrc[1] * pSrc[1] + ... + pSrc[blockSize-1] * pSrc[blockSize-1]) / blockSize));    
  * </pre>    
  *   
- * There are separate functions for floating point, Q31, and Q15 data types.     
+ * There are separate functions for double-precision floating point, floating point, Q31, and Q15 data types.     
  */
 
 /**    
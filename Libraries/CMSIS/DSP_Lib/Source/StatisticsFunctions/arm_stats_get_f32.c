@@ -0,0 +1,120 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_stats_get_f32.c    
+*    
+* Description:  Computes the floating-point statistics of the accumulated samples.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup StreamStats    
+ * @{    
+ */
+
+/**    
+ * @brief  Computes the floating-point statistics of the accumulated samples.    
+ * @param[in]  *S points to an instance of the floating-point streaming statistics structure.    
+ * @param[out] *pMean mean value returned here.    
+ * @param[out] *pVar variance returned here.    
+ * @param[out] *pStd standard deviation returned here.    
+ * @param[out] *pRms RMS value returned here.    
+ * @param[out] *pPower power, the sum of the squares of the samples, returned here.    
+ * @return none.    
+ *    
+ * \par    
+ * Any of the output pointers may be NULL when the value is not needed.  The variance and the    
+ * standard deviation are zero when fewer than two samples have been accumulated, and all the    
+ * values are zero when no sample has been accumulated.    
+ */
+
+void arm_stats_get_f32(
+  const arm_stats_instance_f32 * S,
+  float32_t * pMean,
+  float32_t * pVar,
+  float32_t * pStd,
+  float32_t * pRms,
+  float32_t * pPower)
+{
+  float32_t var = 0.0f, power = 0.0f, rms = 0.0f;  /* Temporary results */
+  float32_t n;                                   /* Number of samples */
+
+  if(S->count > 0u)
+  {
+    n = (float32_t) S->count;
+
+    /* The sum of the squares is the sum of the squared deviations plus n times the squared mean */
+    power = S->m2 + n * (S->mean * S->mean);
+
+    /* Compute the root mean square value */
+    arm_sqrt_f32(power / n, &rms);
+
+    if(S->count > 1u)
+    {
+      /* The variance is normalized by (count - 1) */
+      var = S->m2 / (n - 1.0f);
+    }
+  }
+
+  if(pMean != NULL)
+  {
+    *pMean = (S->count > 0u) ? S->mean : 0.0f;
+  }
+  if(pVar != NULL)
+  {
+    *pVar = var;
+  }
+  if(pStd != NULL)
+  {
+    arm_sqrt_f32(var, pStd);
+  }
+  if(pRms != NULL)
+  {
+    *pRms = rms;
+  }
+  if(pPower != NULL)
+  {
+    *pPower = power;
+  }
+}
+
+/**    
+ * @} end of StreamStats group    
+ */
@@ -0,0 +1,137 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_stats_get_q15.c    
+*    
+* Description:  Computes the Q15 statistics of the accumulated samples.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup StreamStats    
+ * @{    
+ */
+
+/**    
+ * @brief  Computes the Q15 statistics of the accumulated samples.    
+ * @param[in]  *S points to an instance of the Q15 streaming statistics structure.    
+ * @param[out] *pMean mean value returned here.    
+ * @param[out] *pVar variance returned here.    
+ * @param[out] *pStd standard deviation returned here.    
+ * @param[out] *pRms RMS value returned here.    
+ * @param[out] *pPower power, the sum of the squares of the samples, returned here.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The mean is the 49.15 sum divided by the number of samples, in 1.15 format.    
+ * The variance and the mean of the squares are computed in 34.30 format, truncated to 34.15 format    
+ * by discarding the lower 15 bits, and then saturated to yield results in 1.15 format.  The power is    
+ * the 34.30 sum of squares, as returned by <code>arm_power_q15()</code>.    
+ * \par    
+ * Any of the output pointers may be NULL when the value is not needed.  The variance and the    
+ * standard deviation are zero when fewer than two samples have been accumulated, and all the    
+ * values are zero when no sample has been accumulated.    
+ */
+
+void arm_stats_get_q15(
+  const arm_stats_instance_q15 * S,
+  q15_t * pMean,
+  q15_t * pVar,
+  q15_t * pStd,
+  q15_t * pRms,
+  q63_t * pPower)
+{
+  q63_t quot, rem;                               /* Quotient and remainder of the sum by the count */
+  q63_t sumDev;                                  /* Sum of squared deviations */
+  q15_t mean = 0, var = 0, rms = 0;              /* Temporary results */
+
+  if(S->count > 0u)
+  {
+    /* Compute the mean from the exact sum */
+    quot = S->sum / (q63_t) S->count;
+    rem = S->sum - quot * (q63_t) S->count;
+    mean = (q15_t) quot;
+
+    /* Compute the RMS value from the mean of the squares, converted from 2.30 to 1.15 */
+    arm_sqrt_q15((q15_t) __SSAT((S->sumSquare / (q63_t) S->count) >> 15, 16), &rms);
+
+    if(S->count > 1u)
+    {
+      /* With sum = quot * count + rem, sum * sum / count equals
+       * quot * sum + quot * rem + rem * rem / count, where the last term,
+       * smaller than one sample, is neglected.  No term can overflow. */
+      sumDev = S->sumSquare - (quot * S->sum + quot * rem);
+
+      if(sumDev < 0)
+      {
+        sumDev = 0;
+      }
+
+      /* Normalize by (count - 1) and convert from 2.30 to 1.15 */
+      var = (q15_t) __SSAT((sumDev / (q63_t) (S->count - 1u)) >> 15, 16);
+    }
+  }
+
+  if(pMean != NULL)
+  {
+    *pMean = mean;
+  }
+  if(pVar != NULL)
+  {
+    *pVar = var;
+  }
+  if(pStd != NULL)
+  {
+    arm_sqrt_q15(var, pStd);
+  }
+  if(pRms != NULL)
+  {
+    *pRms = rms;
+  }
+  if(pPower != NULL)
+  {
+    *pPower = S->sumSquare;
+  }
+}
+
+/**    
+ * @} end of StreamStats group    
+ */
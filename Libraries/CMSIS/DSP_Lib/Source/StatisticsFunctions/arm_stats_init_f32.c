@@ -0,0 +1,114 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_stats_init_f32.c    
+*    
+* Description:  Floating-point streaming statistics initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @defgroup StreamStats Streaming Statistics    
+ *    
+ * Accumulates the mean, variance, standard deviation, RMS, power, minimum and maximum of a    
+ * signal in a single pass over the data.  The statistics are updated block by block, so a signal    
+ * arriving in DMA half-buffers is summarized without storing it, and the partial statistics of    
+ * separate blocks, channels or threads can be merged into the statistics of the whole.    
+ *    
+ * \par    
+ * The functions operate on an instance structure, which is cleared by the init function,    
+ * updated with <code>arm_stats_update_xxx()</code> or <code>arm_stats_merge_xxx()</code>, and read with    
+ * <code>arm_stats_get_xxx()</code>.  The minimum and maximum are read directly from the fields    
+ * <code>min</code>, <code>max</code>, <code>minIndex</code> and <code>maxIndex</code> of the instance.  The indices count the    
+ * samples from the first one passed after initialization, and the first occurrence is returned    
+ * when a value is repeated.    
+ *    
+ * \par Algorithm    
+ * The floating-point functions keep the count, the mean and the sum of squared deviations from the    
+ * mean, <code>M2</code>.  Each block is accumulated relative to the running mean, and combined with the    
+ * running statistics as described by Chan, Golub and LeVeque:    
+ * <pre>    
+ *     n     = n<sub>a</sub> + n<sub>b</sub>    
+ *     delta = mean<sub>b</sub> - mean<sub>a</sub>    
+ *     mean  = mean<sub>a</sub> + delta * n<sub>b</sub> / n    
+ *     M2    = M2<sub>a</sub> + M2<sub>b</sub> + delta<sup>2</sup> * n<sub>a</sub> * n<sub>b</sub> / n    
+ * </pre>    
+ * which does not suffer from the cancellation of <code>sumOfSquares - sum<sup>2</sup> / blockSize</code>    
+ * when the mean is large compared to the deviations.    
+ * \par    
+ * The fixed-point functions keep the exact sum and sum of squares of the samples in 64-bit    
+ * accumulators, so that merging two instances is an addition and the result does not depend on    
+ * how the signal was split into blocks.    
+ * \par    
+ * As in <code>arm_var_f32()</code>, the variance is normalized by <code>count - 1</code>, while the RMS value    
+ * and the mean are normalized by <code>count</code>.    
+ */
+
+/**    
+ * @addtogroup StreamStats    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point streaming statistics.    
+ * @param[out] *S points to an instance of the floating-point streaming statistics structure.    
+ * @return none.    
+ */
+
+void arm_stats_init_f32(
+  arm_stats_instance_f32 * S)
+{
+  /* No sample has been accumulated yet */
+  S->count = 0u;
+
+  /* Clear the mean and the sum of squared deviations */
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+
+  /* The extrema are set by the first sample */
+  S->min = 0.0f;
+  S->max = 0.0f;
+  S->minIndex = 0u;
+  S->maxIndex = 0u;
+}
+
+/**    
+ * @} end of StreamStats group    
+ */
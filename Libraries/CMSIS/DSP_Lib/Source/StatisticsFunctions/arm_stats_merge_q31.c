@@ -0,0 +1,97 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_stats_merge_q31.c    
+*    
+* Description:  Merges two Q31 streaming statistics.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup StreamStats    
+ * @{    
+ */
+
+/**    
+ * @brief  Merges two Q31 streaming statistics.    
+ * @param[in,out] *S points to an instance of the Q31 streaming statistics structure, which receives the merged statistics.    
+ * @param[in]     *pSrc points to the statistics of the samples that follow those of <code>S</code>.    
+ * @return none.    
+ *    
+ * \par    
+ * The result describes the samples of <code>S</code> followed by those of <code>pSrc</code>, so the    
+ * indices of the extrema of <code>pSrc</code> are offset by <code>S->count</code>.  Blocks processed in    
+ * parallel are merged in the order of the samples to obtain the indices within the whole signal.    
+ */
+
+void arm_stats_merge_q31(
+  arm_stats_instance_q31 * S,
+  const arm_stats_instance_q31 * pSrc)
+{
+  if(S->count == 0u)
+  {
+    /* An empty instance becomes a copy of pSrc */
+    *S = *pSrc;
+  }
+  else if(pSrc->count > 0u)
+  {
+    /* The sums are exact, so the merged sums are their additions */
+    S->sum += pSrc->sum;
+    S->sumSquare += pSrc->sumSquare;
+
+    /* Take the extrema of pSrc when they are strictly beyond those of S */
+    if(pSrc->min < S->min)
+    {
+      S->min = pSrc->min;
+      S->minIndex = S->count + pSrc->minIndex;
+    }
+    if(pSrc->max > S->max)
+    {
+      S->max = pSrc->max;
+      S->maxIndex = S->count + pSrc->maxIndex;
+    }
+
+    S->count += pSrc->count;
+  }
+}
+
+/**    
+ * @} end of StreamStats group    
+ */
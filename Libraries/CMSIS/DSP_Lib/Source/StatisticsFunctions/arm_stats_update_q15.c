@@ -0,0 +1,239 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_stats_update_q15.c    
+*    
+* Description:  Accumulates a block of Q15 samples into the streaming statistics.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup StreamStats    
+ * @{    
+ */
+
+/**    
+ * @brief  Accumulates a block of Q15 samples into the streaming statistics.    
+ * @param[in,out] *S points to an instance of the Q15 streaming statistics structure.    
+ * @param[in]     *pSrc points to the block of input samples.    
+ * @param[in]     blockSize number of samples in the block.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The input is represented in 1.15 format and is accumulated in a 64-bit accumulator    
+ * in 49.15 format.  Intermediate multiplication yields a 2.30 format, and this result is added    
+ * without saturation to a 64-bit accumulator in 34.30 format.  With 33 guard bits in the    
+ * accumulator, there is no risk of overflow, and the full precision of the intermediate    
+ * multiplication is preserved.    
+ */
+
+void arm_stats_update_q15(
+  arm_stats_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  q63_t sum = 0, sumSquare = 0;                  /* Accumulators */
+  q15_t minVal, maxVal;                          /* Running extrema */
+  q15_t in;                                      /* input value */
+  uint32_t minIndex, maxIndex;                   /* Indices of the extrema */
+  uint32_t index, blkCnt;                        /* Sample index and loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q63_t sumSquare1 = 0;                          /* Second accumulator */
+  q15_t in1, in2, in3, in4;                      /* Temporary input variables */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  if(blockSize > 0u)
+  {
+    /* An empty instance takes its extrema from the first sample */
+    if(S->count == 0u)
+    {
+      S->min = *pSrc;
+      S->max = *pSrc;
+      S->minIndex = 0u;
+      S->maxIndex = 0u;
+    }
+
+    minVal = S->min;
+    maxVal = S->max;
+    minIndex = S->minIndex;
+    maxIndex = S->maxIndex;
+
+    /* Global index of the first sample of the block */
+    index = S->count;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* read input samples from source buffer */
+      in1 = pSrc[0];
+      in2 = pSrc[1];
+      in3 = pSrc[2];
+      in4 = pSrc[3];
+
+      /* Accumulate the samples and their squares */
+      sum += in1;
+      sumSquare += (q31_t) in1 * in1;
+      sum += in2;
+      sumSquare1 += (q31_t) in2 * in2;
+      sum += in3;
+      sumSquare += (q31_t) in3 * in3;
+      sum += in4;
+      sumSquare1 += (q31_t) in4 * in4;
+
+      /* Update the extrema and their indices */
+      if(in1 < minVal)
+      {
+        minVal = in1;
+        minIndex = index;
+      }
+      if(in1 > maxVal)
+      {
+        maxVal = in1;
+        maxIndex = index;
+      }
+      if(in2 < minVal)
+      {
+        minVal = in2;
+        minIndex = index + 1u;
+      }
+      if(in2 > maxVal)
+      {
+        maxVal = in2;
+        maxIndex = index + 1u;
+      }
+      if(in3 < minVal)
+      {
+        minVal = in3;
+        minIndex = index + 2u;
+      }
+      if(in3 > maxVal)
+      {
+        maxVal = in3;
+        maxIndex = index + 2u;
+      }
+      if(in4 < minVal)
+      {
+        minVal = in4;
+        minIndex = index + 3u;
+      }
+      if(in4 > maxVal)
+      {
+        maxVal = in4;
+        maxIndex = index + 3u;
+      }
+
+      /* update input pointer and index to process next samples */
+      pSrc += 4u;
+      index += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* add two accumulators */
+    sumSquare = sumSquare + sumSquare1;
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(blkCnt > 0u)
+    {
+      in = *pSrc++;
+
+      /* Accumulate the sample and its square */
+      sum += in;
+      sumSquare += (q31_t) in * in;
+
+      /* Update the extrema and their indices */
+      if(in < minVal)
+      {
+        minVal = in;
+        minIndex = index;
+      }
+      if(in > maxVal)
+      {
+        maxVal = in;
+        maxIndex = index;
+      }
+
+      index++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Add the block to the running sums */
+    S->sum += sum;
+    S->sumSquare += sumSquare;
+
+    S->count = index;
+    S->min = minVal;
+    S->max = maxVal;
+    S->minIndex = minIndex;
+    S->maxIndex = maxIndex;
+  }
+}
+
+/**    
+ * @} end of StreamStats group    
+ */
@@ -58,7 +58,8 @@
  *	                   sum = pSrc[0] + pSrc[1] + pSrc[2] + ... + pSrc[blockSize-1]   
  * </pre>   
  *    
- * There are separate functions for floating point, Q31, and Q15 data types.    
+ * There are separate functions for double-precision floating point, floating point, Q31, and Q15 data types.    
+ * The double-precision function subtracts the mean from the samples instead of using the sums above.    
  */
 
 /**    
@@ -0,0 +1,143 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_var_f64.c    
+*    
+* Description:  Variance of the elements of a double-precision floating-point vector.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup variance    
+ * @{    
+ */
+
+/**    
+ * @brief Variance of the elements of a double-precision floating-point vector.    
+ * @param[in]       *pSrc points to the input vector    
+ * @param[in]       blockSize length of the input vector    
+ * @param[out]      *pResult variance value returned here    
+ * @return none.    
+ *    
+ * \par    
+ * Unlike the other data types, the mean is computed first and the variance is computed from the    
+ * deviations from the mean:    
+ * <pre>    
+ * 	Result = ((pSrc[0] - mean)<sup>2</sup> + ... + (pSrc[blockSize-1] - mean)<sup>2</sup>) / (blockSize - 1)    
+ * </pre>    
+ * This reads the input twice but does not subtract two large sums, so the result stays accurate when    
+ * the mean is large compared to the standard deviation.    
+ */
+
+void arm_var_f64(
+  float64_t * pSrc,
+  uint32_t blockSize,
+  float64_t * pResult)
+{
+  float64_t *pIn = pSrc;                         /* Source pointer */
+  float64_t sum = 0.0;                           /* Temporary result storage */
+  float64_t mean;                                /* Mean of the input */
+  float64_t in;                                  /* input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(blockSize <= 1u)
+  {
+    *pResult = 0.0;
+    return;
+  }
+
+  /* Compute the mean of the input */
+  arm_mean_f64(pSrc, blockSize, &mean);
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = (A[0] - mean) * (A[0] - mean) + ... + (A[blockSize-1] - mean) * (A[blockSize-1] - mean) */
+    in = *pIn++ - mean;
+    sum += in * in;
+    in = *pIn++ - mean;
+    sum += in * in;
+    in = *pIn++ - mean;
+    sum += in * in;
+    in = *pIn++ - mean;
+    sum += in * in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    /* C = (A[0] - mean) * (A[0] - mean) + ... + (A[blockSize-1] - mean) * (A[blockSize-1] - mean) */
+    in = *pIn++ - mean;
+    sum += in * in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the variance and then store the result to the destination */
+  *pResult = sum / (float64_t) (blockSize - 1u);
+}
+
+/**    
+ * @} end of variance group    
+ */
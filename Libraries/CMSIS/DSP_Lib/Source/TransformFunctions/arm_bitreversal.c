@@ -240,3 +240,68 @@ uint16_t * pBitRevTab)
       pBitRevTab += bitRevFactor;
    }
 }
+
+/*    
+   * @brief  In-place bit reversal function of the Q15 CFFT.   
+   * @param[in, out] *pSrc        points to the in-place buffer of Q15 complex data.   
+   * @param[in]      bitRevLen    number of entries in the bit reversal table.   
+   * @param[in]      *pBitRevTab  points to the table of pairs of byte offsets to swap, for complex q31 data.   
+   * @return none.   
+*/
+
+void arm_bitreversal_16(
+uint16_t * pSrc,
+const uint16_t bitRevLen,
+const uint16_t * pBitRevTab)
+{
+   uint32_t *pSrc32 = (uint32_t *) pSrc;
+   uint32_t a, b, i, tmp;
+
+   for (i = 0u; i < bitRevLen; i += 2u)
+   {
+      /*  Byte offsets of complex q31 values, 8 bytes each: halved for complex q15 values */
+      a = pBitRevTab[i] >> 3u;
+      b = pBitRevTab[i + 1u] >> 3u;
+
+      /*  pSrc[a] <-> pSrc[b], a complex q15 value in one word */
+      tmp = pSrc32[a];
+      pSrc32[a] = pSrc32[b];
+      pSrc32[b] = tmp;
+   }
+}
+
+#if defined (ARM_MATH_HOST)
+
+/*    
+   * @brief  In-place bit reversal function of the CFFT (C version of arm_bitreversal2.S for host builds).   
+   * @param[in, out] *pSrc        points to the in-place buffer of 32-bit complex data.   
+   * @param[in]      bitRevLen    number of entries in the bit reversal table.   
+   * @param[in]      *pBitRevTab  points to the table of pairs of byte offsets to swap.   
+   * @return none.   
+*/
+
+void arm_bitreversal_32(
+uint32_t * pSrc,
+const uint16_t bitRevLen,
+const uint16_t * pBitRevTab)
+{
+   uint32_t a, b, i, tmp;
+
+   for (i = 0u; i < bitRevLen; i += 2u)
+   {
+      a = pBitRevTab[i] >> 2u;
+      b = pBitRevTab[i + 1u] >> 2u;
+
+      /*  pSrc[a] <-> pSrc[b], real parts */
+      tmp = pSrc[a];
+      pSrc[a] = pSrc[b];
+      pSrc[b] = tmp;
+
+      /*  pSrc[a+1u] <-> pSrc[b+1u], imaginary parts */
+      tmp = pSrc[a + 1u];
+      pSrc[a + 1u] = pSrc[b + 1u];
+      pSrc[b + 1u] = tmp;
+   }
+}
+
+#endif /* #if defined (ARM_MATH_HOST) */
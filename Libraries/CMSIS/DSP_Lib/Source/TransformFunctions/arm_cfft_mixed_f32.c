@@ -0,0 +1,425 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_cfft_mixed_f32.c    
+*    
+* Description:  Floating-point mixed-radix (4, 2, 3, 5) complex FFT processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**   
+* @ingroup groupTransforms   
+*/
+
+/**   
+* @addtogroup ComplexFFT   
+* @{   
+*/
+
+/* Constants of the radix-3 and radix-5 butterflies */
+#define ARM_CFFT_MR_S3   0.866025404f            /* sin(2*pi/3) */
+#define ARM_CFFT_MR_C51  0.309016994f            /* cos(2*pi/5) */
+#define ARM_CFFT_MR_C52 -0.809016994f            /* cos(4*pi/5) */
+#define ARM_CFFT_MR_S51  0.951056516f            /* sin(2*pi/5) */
+#define ARM_CFFT_MR_S52  0.587785252f            /* sin(4*pi/5) */
+
+/* Stores the complex value (xr, xi), multiplied by the twiddle factor (twR, twI) in the forward direction */
+#define ARM_CFFT_MR_TWIDDLE(pOut, xr, xi, twR, twI)  \
+  do                                                 \
+  {                                                  \
+    (pOut)[0] = ((xr) * (twR)) + ((xi) * (twI));     \
+    (pOut)[1] = ((xi) * (twR)) - ((xr) * (twI));     \
+  } while(0)
+
+/*   
+ * One decimation in frequency stage of radix 4, 2, 3 or 5.   
+ * The data is made of fftLen/L sub-transforms of length L.  Each butterfly takes the elements j,   
+ * j+m, ..., j+(radix-1)*m of a sub-transform (m = L/radix), computes their DFT of length radix and   
+ * multiplies output q by W_L^(j*q).  twStep is the step in the table of W_L^1.   
+ */
+
+static void arm_radix4_mixed_f32(
+  float32_t * p,
+  uint32_t fftLen,
+  uint32_t L,
+  const float32_t * pTw,
+  uint32_t twStep)
+{
+  float32_t *p0, *p1, *p2, *p3;
+  float32_t ar, ai, br, bi, cr, ci, dr, di;
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+  float32_t tw1r, tw1i, tw2r, tw2i, tw3r, tw3i;
+  uint32_t m = L >> 2u, i, j;
+
+  /* j = 0: the twiddle factors are 1 */
+  for (i = 0u; i < fftLen; i += L)
+  {
+    p0 = p + (2u * i);
+    p1 = p0 + (2u * m);
+    p2 = p1 + (2u * m);
+    p3 = p2 + (2u * m);
+
+    t0r = p0[0] + p2[0];
+    t0i = p0[1] + p2[1];
+    t1r = p0[0] - p2[0];
+    t1i = p0[1] - p2[1];
+    t2r = p1[0] + p3[0];
+    t2i = p1[1] + p3[1];
+    t3r = p1[0] - p3[0];
+    t3i = p1[1] - p3[1];
+
+    p0[0] = t0r + t2r;
+    p0[1] = t0i + t2i;
+    p1[0] = t1r + t3i;
+    p1[1] = t1i - t3r;
+    p2[0] = t0r - t2r;
+    p2[1] = t0i - t2i;
+    p3[0] = t1r - t3i;
+    p3[1] = t1i + t3r;
+  }
+
+  for (j = 1u; j < m; j++)
+  {
+    tw1r = pTw[2u * j * twStep];
+    tw1i = pTw[(2u * j * twStep) + 1u];
+    tw2r = pTw[4u * j * twStep];
+    tw2i = pTw[(4u * j * twStep) + 1u];
+    tw3r = pTw[6u * j * twStep];
+    tw3i = pTw[(6u * j * twStep) + 1u];
+
+    for (i = j; i < fftLen; i += L)
+    {
+      p0 = p + (2u * i);
+      p1 = p0 + (2u * m);
+      p2 = p1 + (2u * m);
+      p3 = p2 + (2u * m);
+
+      t0r = p0[0] + p2[0];
+      t0i = p0[1] + p2[1];
+      t1r = p0[0] - p2[0];
+      t1i = p0[1] - p2[1];
+      t2r = p1[0] + p3[0];
+      t2i = p1[1] + p3[1];
+      t3r = p1[0] - p3[0];
+      t3i = p1[1] - p3[1];
+
+      /* y0 = a + b + c + d, y1 = (a - c) - i(b - d), y2 = (a + c) - (b + d), y3 = (a - c) + i(b - d) */
+      ar = t0r + t2r;
+      ai = t0i + t2i;
+      br = t1r + t3i;
+      bi = t1i - t3r;
+      cr = t0r - t2r;
+      ci = t0i - t2i;
+      dr = t1r - t3i;
+      di = t1i + t3r;
+
+      p0[0] = ar;
+      p0[1] = ai;
+      ARM_CFFT_MR_TWIDDLE(p1, br, bi, tw1r, tw1i);
+      ARM_CFFT_MR_TWIDDLE(p2, cr, ci, tw2r, tw2i);
+      ARM_CFFT_MR_TWIDDLE(p3, dr, di, tw3r, tw3i);
+    }
+  }
+}
+
+static void arm_radix2_mixed_f32(
+  float32_t * p,
+  uint32_t fftLen,
+  uint32_t L,
+  const float32_t * pTw,
+  uint32_t twStep)
+{
+  float32_t *p0, *p1;
+  float32_t br, bi, twr, twi;
+  uint32_t m = L >> 1u, i, j;
+
+  for (j = 0u; j < m; j++)
+  {
+    twr = pTw[2u * j * twStep];
+    twi = pTw[(2u * j * twStep) + 1u];
+
+    for (i = j; i < fftLen; i += L)
+    {
+      p0 = p + (2u * i);
+      p1 = p0 + (2u * m);
+
+      br = p0[0] - p1[0];
+      bi = p0[1] - p1[1];
+      p0[0] = p0[0] + p1[0];
+      p0[1] = p0[1] + p1[1];
+      ARM_CFFT_MR_TWIDDLE(p1, br, bi, twr, twi);
+    }
+  }
+}
+
+static void arm_radix3_mixed_f32(
+  float32_t * p,
+  uint32_t fftLen,
+  uint32_t L,
+  const float32_t * pTw,
+  uint32_t twStep)
+{
+  float32_t *p0, *p1, *p2;
+  float32_t t1r, t1i, t2r, t2i, t3r, t3i;
+  float32_t tw1r, tw1i, tw2r, tw2i;
+  uint32_t m = L / 3u, i, j;
+
+  for (j = 0u; j < m; j++)
+  {
+    tw1r = pTw[2u * j * twStep];
+    tw1i = pTw[(2u * j * twStep) + 1u];
+    tw2r = pTw[4u * j * twStep];
+    tw2i = pTw[(4u * j * twStep) + 1u];
+
+    for (i = j; i < fftLen; i += L)
+    {
+      p0 = p + (2u * i);
+      p1 = p0 + (2u * m);
+      p2 = p1 + (2u * m);
+
+      /* y0 = a + (b + c), y1,2 = a - (b + c)/2 -/+ i*sin(2*pi/3)*(b - c) */
+      t1r = p1[0] + p2[0];
+      t1i = p1[1] + p2[1];
+      t2r = p0[0] - (0.5f * t1r);
+      t2i = p0[1] - (0.5f * t1i);
+      t3r = ARM_CFFT_MR_S3 * (p1[0] - p2[0]);
+      t3i = ARM_CFFT_MR_S3 * (p1[1] - p2[1]);
+
+      p0[0] = p0[0] + t1r;
+      p0[1] = p0[1] + t1i;
+      ARM_CFFT_MR_TWIDDLE(p1, t2r + t3i, t2i - t3r, tw1r, tw1i);
+      ARM_CFFT_MR_TWIDDLE(p2, t2r - t3i, t2i + t3r, tw2r, tw2i);
+    }
+  }
+}
+
+static void arm_radix5_mixed_f32(
+  float32_t * p,
+  uint32_t fftLen,
+  uint32_t L,
+  const float32_t * pTw,
+  uint32_t twStep)
+{
+  float32_t *p0, *p1, *p2, *p3, *p4;
+  float32_t t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;
+  float32_t a1r, a1i, a2r, a2i, b1r, b1i, b2r, b2i;
+  float32_t tw1r, tw1i, tw2r, tw2i, tw3r, tw3i, tw4r, tw4i;
+  uint32_t m = L / 5u, i, j;
+
+  for (j = 0u; j < m; j++)
+  {
+    tw1r = pTw[2u * j * twStep];
+    tw1i = pTw[(2u * j * twStep) + 1u];
+    tw2r = pTw[4u * j * twStep];
+    tw2i = pTw[(4u * j * twStep) + 1u];
+    tw3r = pTw[6u * j * twStep];
+    tw3i = pTw[(6u * j * twStep) + 1u];
+    tw4r = pTw[8u * j * twStep];
+    tw4i = pTw[(8u * j * twStep) + 1u];
+
+    for (i = j; i < fftLen; i += L)
+    {
+      p0 = p + (2u * i);
+      p1 = p0 + (2u * m);
+      p2 = p1 + (2u * m);
+      p3 = p2 + (2u * m);
+      p4 = p3 + (2u * m);
+
+      t1r = p1[0] + p4[0];
+      t1i = p1[1] + p4[1];
+      t2r = p2[0] + p3[0];
+      t2i = p2[1] + p3[1];
+      t3r = p1[0] - p4[0];
+      t3i = p1[1] - p4[1];
+      t4r = p2[0] - p3[0];
+      t4i = p2[1] - p3[1];
+
+      a1r = p0[0] + (ARM_CFFT_MR_C51 * t1r) + (ARM_CFFT_MR_C52 * t2r);
+      a1i = p0[1] + (ARM_CFFT_MR_C51 * t1i) + (ARM_CFFT_MR_C52 * t2i);
+      a2r = p0[0] + (ARM_CFFT_MR_C52 * t1r) + (ARM_CFFT_MR_C51 * t2r);
+      a2i = p0[1] + (ARM_CFFT_MR_C52 * t1i) + (ARM_CFFT_MR_C51 * t2i);
+      b1r = (ARM_CFFT_MR_S51 * t3r) + (ARM_CFFT_MR_S52 * t4r);
+      b1i = (ARM_CFFT_MR_S51 * t3i) + (ARM_CFFT_MR_S52 * t4i);
+      b2r = (ARM_CFFT_MR_S52 * t3r) - (ARM_CFFT_MR_S51 * t4r);
+      b2i = (ARM_CFFT_MR_S52 * t3i) - (ARM_CFFT_MR_S51 * t4i);
+
+      /* y1,4 = a1 -/+ i*b1, y2,3 = a2 -/+ i*b2 */
+      p0[0] = p0[0] + t1r + t2r;
+      p0[1] = p0[1] + t1i + t2i;
+      ARM_CFFT_MR_TWIDDLE(p1, a1r + b1i, a1i - b1r, tw1r, tw1i);
+      ARM_CFFT_MR_TWIDDLE(p2, a2r + b2i, a2i - b2r, tw2r, tw2i);
+      ARM_CFFT_MR_TWIDDLE(p3, a2r - b2i, a2i + b2r, tw3r, tw3i);
+      ARM_CFFT_MR_TWIDDLE(p4, a1r - b1i, a1i + b1r, tw4r, tw4i);
+    }
+  }
+}
+
+/*   
+ * Puts the output of the stages in natural order.  The table lists the cycles of the   
+ * permutation, each as its length followed by the indexes: element i(k) receives element i(k+1)   
+ * and the last one receives the first.   
+ */
+
+static void arm_digitreversal_f32(
+  float32_t * p,
+  const uint16_t * pTable,
+  uint16_t tableLen)
+{
+  const uint16_t *pEnd = pTable + tableLen;
+  float32_t tmpR, tmpI;
+  uint32_t len, a, b;
+
+  while(pTable < pEnd)
+  {
+    len = *pTable++;
+    a = 2u * (*pTable++);
+    tmpR = p[a];
+    tmpI = p[a + 1u];
+
+    while(--len > 0u)
+    {
+      b = 2u * (*pTable++);
+      p[a] = p[b];
+      p[a + 1u] = p[b + 1u];
+      a = b;
+    }
+
+    p[a] = tmpR;
+    p[a + 1u] = tmpI;
+  }
+}
+
+/**   
+* @details   
+* @brief       Processing function for the floating-point mixed-radix complex FFT.   
+* @param[in]      *S    points to an instance of the floating-point mixed-radix CFFT structure.     
+* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.     
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.     
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) the reordering of the output.     
+* @return none.     
+*   
+* \par   
+* Computes transforms of length <code>2^a * 3^b * 5^c</code> with radix-4, radix-2, radix-3 and radix-5   
+* decimation in frequency stages, for the lengths that are not a power of two, e.g. 480, 960 or 1920   
+* points for 10, 20 or 40 ms at 48 kHz.  The conventions are those of <code>arm_cfft_f32()</code>:   
+* the inverse transform includes the scale of <code>1/fftLen</code>, and with <code>bitReverseFlag</code>   
+* set to 0 the output stays in the digit reversed order of the stages.   
+* \par   
+* Preinitialized instances are defined in <code>arm_const_structs.h</code>, named   
+* <code>arm_cfft_mR_f32_len<i>N</i></code>, for 48, 96, 192, 384, 768 (3*2^n), 80, 160, 320, 640,   
+* 1280 (5*2^n), 60, 120, 240, 480, 960, 1920 and 3840 (15*2^n) points.  All of them use the   
+* twiddle factor table of 3840 points, <code>twiddleCoef_3840</code>, with a step of   
+* <code>twidCoefModifier = 3840/fftLen</code>, and a digit reversal table of their own.   
+*/
+
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag)
+{
+  uint32_t fftLen = S->fftLen, L, l;
+  uint32_t twStep = S->twidCoefModifier;
+  float32_t invL, *pSrc;
+
+  if(ifftFlag == 1u)
+  {
+    /*  Conjugate input data  */
+    pSrc = p1 + 1;
+    for (l = 0u; l < fftLen; l++)
+    {
+      *pSrc = -*pSrc;
+      pSrc += 2;
+    }
+  }
+
+  /* Stages of radix 4 first, then at most one of radix 2, then radix 3 and radix 5.    
+   ** The digit reversal tables are generated for this order. */
+  L = fftLen;
+
+  while(L > 1u)
+  {
+    if((L & 3u) == 0u)
+    {
+      arm_radix4_mixed_f32(p1, fftLen, L, S->pTwiddle, twStep);
+      L >>= 2u;
+      twStep <<= 2u;
+    }
+    else if((L & 1u) == 0u)
+    {
+      arm_radix2_mixed_f32(p1, fftLen, L, S->pTwiddle, twStep);
+      L >>= 1u;
+      twStep <<= 1u;
+    }
+    else if((L % 3u) == 0u)
+    {
+      arm_radix3_mixed_f32(p1, fftLen, L, S->pTwiddle, twStep);
+      L /= 3u;
+      twStep *= 3u;
+    }
+    else if((L % 5u) == 0u)
+    {
+      arm_radix5_mixed_f32(p1, fftLen, L, S->pTwiddle, twStep);
+      L /= 5u;
+      twStep *= 5u;
+    }
+    else
+    {
+      /* Unsupported length */
+      return;
+    }
+  }
+
+  if(bitReverseFlag)
+    arm_digitreversal_f32(p1, S->pDigitRevTable, S->digitRevLength);
+
+  if(ifftFlag == 1u)
+  {
+    invL = 1.0f / (float32_t) fftLen;
+    /*  Conjugate and scale output data */
+    pSrc = p1;
+    for (l = 0u; l < fftLen; l++)
+    {
+      *pSrc++ *= invL;
+      *pSrc = -(*pSrc) * invL;
+      pSrc++;
+    }
+  }
+}
+
+/**   
+* @} end of ComplexFFT group   
+*/
@@ -0,0 +1,255 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_cfft_q15.c    
+*    
+* Description:  Combined Radix Decimation in Frequency CFFT fixed point processing function    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+extern void arm_radix4_butterfly_q15(
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  q15_t * pCoef16,
+  uint32_t twidCoefModifier);
+
+extern void arm_radix4_butterfly_inverse_q15(
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  q15_t * pCoef16,
+  uint32_t twidCoefModifier);
+
+extern void arm_bitreversal_16(
+  uint16_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable);
+
+/*    
+ * Lengths 2*4^k: a radix-2 stage, then a radix-4 transform of each half.    
+ * The radix-2 stage scales by 1/4 to leave room for the twiddle multiplication and the    
+ * result is scaled back up by 2 at the end, so the overall scaling is 1/fftLen as in the    
+ * radix-4 lengths.    
+ */
+
+static void arm_cfft_radix4by2_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef,
+  uint16_t twidCoefModifier,
+  uint8_t ifftFlag)
+{
+  uint32_t i, n2 = fftLen >> 1u;
+  uint32_t ia = 0u;
+  q15_t *pSi = pSrc;
+  q15_t *pLi = pSrc + fftLen;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  q31_t T, S, R, coeff, out1, out2;
+
+  for (i = n2; i > 0u; i--)
+  {
+    coeff = _SIMD32_OFFSET(pCoef + (ia * 2u));
+    ia = ia + twidCoefModifier;
+
+    /* Halving adds with 0 shift both halfwords right by 1 */
+    T = __SHADD16(_SIMD32_OFFSET(pSi), 0);
+    S = __SHADD16(_SIMD32_OFFSET(pLi), 0);
+
+    R = __QSUB16(T, S);
+
+    _SIMD32_OFFSET(pSi) = __SHADD16(T, S);
+    pSi += 2;
+
+    if(ifftFlag == 0u)
+    {
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      out1 = __SMUAD(coeff, R) >> 16;
+      out2 = __SMUSDX(coeff, R);
+
+#else
+
+      out1 = __SMUSDX(R, coeff) >> 16u;
+      out2 = __SMUAD(coeff, R);
+
+#endif //     #ifndef ARM_MATH_BIG_ENDIAN
+    }
+    else
+    {
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      out1 = __SMUSD(coeff, R) >> 16;
+      out2 = __SMUADX(coeff, R);
+
+#else
+
+      out1 = __SMUADX(R, coeff) >> 16u;
+      out2 = __SMUSD(__QSUB(0, coeff), R);
+
+#endif //     #ifndef ARM_MATH_BIG_ENDIAN
+    }
+
+    _SIMD32_OFFSET(pLi) = (q31_t) ((out2) & 0xFFFF0000) | (out1 & 0x0000FFFF);
+    pLi += 2;
+  }
+
+#else
+
+  q15_t xt, yt, cosVal, sinVal;
+
+  for (i = n2; i > 0u; i--)
+  {
+    cosVal = pCoef[ia * 2u];
+    sinVal = pCoef[(ia * 2u) + 1u];
+    ia = ia + twidCoefModifier;
+
+    xt = (pSi[0] >> 1u) - (pLi[0] >> 1u);
+    yt = (pSi[1] >> 1u) - (pLi[1] >> 1u);
+    pSi[0] = ((pSi[0] >> 1u) + (pLi[0] >> 1u)) >> 1u;
+    pSi[1] = ((pSi[1] >> 1u) + (pLi[1] >> 1u)) >> 1u;
+    pSi += 2;
+
+    if(ifftFlag == 0u)
+    {
+      pLi[0] = (((int16_t) (((q31_t) xt * cosVal) >> 16)) +
+                ((int16_t) (((q31_t) yt * sinVal) >> 16)));
+      pLi[1] = (((int16_t) (((q31_t) yt * cosVal) >> 16)) -
+                ((int16_t) (((q31_t) xt * sinVal) >> 16)));
+    }
+    else
+    {
+      pLi[0] = (((int16_t) (((q31_t) xt * cosVal) >> 16)) -
+                ((int16_t) (((q31_t) yt * sinVal) >> 16)));
+      pLi[1] = (((int16_t) (((q31_t) yt * cosVal) >> 16)) +
+                ((int16_t) (((q31_t) xt * sinVal) >> 16)));
+    }
+    pLi += 2;
+  }
+
+#endif //             #ifndef ARM_MATH_CM0_FAMILY
+
+  /* Radix-4 transforms of the two halves, the twiddle factors of length fftLen/2 */
+  if(ifftFlag == 0u)
+  {
+    arm_radix4_butterfly_q15(pSrc, n2, (q15_t *) pCoef, 2u * twidCoefModifier);
+    arm_radix4_butterfly_q15(pSrc + fftLen, n2, (q15_t *) pCoef, 2u * twidCoefModifier);
+  }
+  else
+  {
+    arm_radix4_butterfly_inverse_q15(pSrc, n2, (q15_t *) pCoef, 2u * twidCoefModifier);
+    arm_radix4_butterfly_inverse_q15(pSrc + fftLen, n2, (q15_t *) pCoef, 2u * twidCoefModifier);
+  }
+
+  /* Scale the result back up by 2 */
+  pSi = pSrc;
+
+  for (i = 2u * fftLen; i > 0u; i--)
+  {
+    *pSi = (q15_t) (*pSi << 1);
+    pSi++;
+  }
+}
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup ComplexFFT    
+ * @{    
+ */
+
+/**    
+ * @details    
+ * @brief       Processing function for the Q15 complex FFT.    
+ * @param[in]      *S    points to an instance of the Q15 CFFT structure.    
+ * @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.    
+ * @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.    
+ * @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.    
+ * @return none.    
+ *    
+ * \par    
+ * Same interface as <code>arm_cfft_f32()</code>, with the constant instances <code>arm_cfft_sR_q15_len16</code>    
+ * to <code>arm_cfft_sR_q15_len4096</code> of <code>arm_const_structs.h</code>: no initialization is needed.    
+ * The lengths 16, 64, 256, 1024 and 4096 use radix-4 stages, the lengths 32, 128, 512 and 2048 a radix-2    
+ * stage followed by radix-4 stages, and the output is put in order with a table of the pairs to swap.    
+ * \par    
+ * The scaling is that of <code>arm_cfft_radix4_q15()</code> and <code>arm_cfft_radix2_q15()</code>: the forward    
+ * and the inverse transforms are both scaled by <code>1/fftLen</code>, so the output format is different for    
+ * each length (see the tables of <code>arm_cfft_radix4_q15()</code>).    
+ */
+
+void arm_cfft_q15(
+  const arm_cfft_instance_q15 * S,
+  q15_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag)
+{
+  uint32_t L = S->fftLen;
+
+  switch (L)
+  {
+  case 16:
+  case 64:
+  case 256:
+  case 1024:
+  case 4096:
+    if(ifftFlag == 0u)
+    {
+      arm_radix4_butterfly_q15(p1, L, (q15_t *) S->pTwiddle, S->twidCoefModifier);
+    }
+    else
+    {
+      arm_radix4_butterfly_inverse_q15(p1, L, (q15_t *) S->pTwiddle, S->twidCoefModifier);
+    }
+    break;
+
+  case 32:
+  case 128:
+  case 512:
+  case 2048:
+    arm_cfft_radix4by2_q15(p1, L, S->pTwiddle, S->twidCoefModifier, ifftFlag);
+    break;
+  }
+
+  if(bitReverseFlag)
+    arm_bitreversal_16((uint16_t *) p1, S->bitRevLength, S->pBitRevTable);
+}
+
+/**    
+ * @} end of ComplexFFT group    
+ */
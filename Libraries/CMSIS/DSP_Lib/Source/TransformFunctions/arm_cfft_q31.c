@@ -0,0 +1,196 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_cfft_q31.c    
+*    
+* Description:  Combined Radix Decimation in Frequency CFFT fixed point processing function    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+extern void arm_radix4_butterfly_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  q31_t * pCoef,
+  uint32_t twidCoefModifier);
+
+extern void arm_radix4_butterfly_inverse_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  q31_t * pCoef,
+  uint32_t twidCoefModifier);
+
+extern void arm_bitreversal_32(
+  uint32_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable);
+
+/*    
+ * Lengths 2*4^k: a radix-2 stage, then a radix-4 transform of each half.    
+ * The radix-2 stage scales by 1/4 and the result is scaled back up by 2 at the end,    
+ * so the overall scaling is 1/fftLen as in the radix-4 lengths.    
+ */
+
+static void arm_cfft_radix4by2_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  const q31_t * pCoef,
+  uint16_t twidCoefModifier,
+  uint8_t ifftFlag)
+{
+  uint32_t i, l, n2 = fftLen >> 1u;
+  uint32_t ia = 0u;
+  q31_t xt, yt, cosVal, sinVal;
+  q31_t p0, p1;
+
+  for (i = 0u; i < n2; i++)
+  {
+    cosVal = pCoef[ia * 2u];
+    sinVal = pCoef[(ia * 2u) + 1u];
+    ia = ia + twidCoefModifier;
+
+    l = i + n2;
+    xt = (pSrc[2u * i] >> 2u) - (pSrc[2u * l] >> 2u);
+    pSrc[2u * i] = (pSrc[2u * i] >> 2u) + (pSrc[2u * l] >> 2u);
+
+    yt = (pSrc[(2u * i) + 1u] >> 2u) - (pSrc[(2u * l) + 1u] >> 2u);
+    pSrc[(2u * i) + 1u] = (pSrc[(2u * l) + 1u] >> 2u) + (pSrc[(2u * i) + 1u] >> 2u);
+
+    mult_32x32_keep32_R(p0, xt, cosVal);
+    mult_32x32_keep32_R(p1, yt, cosVal);
+
+    if(ifftFlag == 0u)
+    {
+      multAcc_32x32_keep32_R(p0, yt, sinVal);
+      multSub_32x32_keep32_R(p1, xt, sinVal);
+    }
+    else
+    {
+      multSub_32x32_keep32_R(p0, yt, sinVal);
+      multAcc_32x32_keep32_R(p1, xt, sinVal);
+    }
+
+    pSrc[2u * l] = p0 << 1;
+    pSrc[(2u * l) + 1u] = p1 << 1;
+  }
+
+  /* Radix-4 transforms of the two halves, the twiddle factors of length fftLen/2 */
+  if(ifftFlag == 0u)
+  {
+    arm_radix4_butterfly_q31(pSrc, n2, (q31_t *) pCoef, 2u * twidCoefModifier);
+    arm_radix4_butterfly_q31(pSrc + fftLen, n2, (q31_t *) pCoef, 2u * twidCoefModifier);
+  }
+  else
+  {
+    arm_radix4_butterfly_inverse_q31(pSrc, n2, (q31_t *) pCoef, 2u * twidCoefModifier);
+    arm_radix4_butterfly_inverse_q31(pSrc + fftLen, n2, (q31_t *) pCoef, 2u * twidCoefModifier);
+  }
+
+  /* Scale the result back up by 2 */
+  for (i = 0u; i < (2u * fftLen); i++)
+  {
+    pSrc[i] = pSrc[i] << 1;
+  }
+}
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup ComplexFFT    
+ * @{    
+ */
+
+/**    
+ * @details    
+ * @brief       Processing function for the Q31 complex FFT.    
+ * @param[in]      *S    points to an instance of the Q31 CFFT structure.    
+ * @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.    
+ * @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.    
+ * @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.    
+ * @return none.    
+ *    
+ * \par    
+ * Same interface as <code>arm_cfft_f32()</code>, with the constant instances <code>arm_cfft_sR_q31_len16</code>    
+ * to <code>arm_cfft_sR_q31_len4096</code> of <code>arm_const_structs.h</code>: no initialization is needed.    
+ * The lengths 16, 64, 256, 1024 and 4096 use radix-4 stages, the lengths 32, 128, 512 and 2048 a radix-2    
+ * stage followed by radix-4 stages, and the output is put in order with a table of the pairs to swap.    
+ * \par    
+ * The scaling is that of <code>arm_cfft_radix4_q31()</code> and <code>arm_cfft_radix2_q31()</code>: the forward    
+ * and the inverse transforms are both scaled by <code>1/fftLen</code>, so the output format is different for    
+ * each length (see the tables of <code>arm_cfft_radix4_q31()</code>).    
+ */
+
+void arm_cfft_q31(
+  const arm_cfft_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag)
+{
+  uint32_t L = S->fftLen;
+
+  switch (L)
+  {
+  case 16:
+  case 64:
+  case 256:
+  case 1024:
+  case 4096:
+    if(ifftFlag == 0u)
+    {
+      arm_radix4_butterfly_q31(p1, L, (q31_t *) S->pTwiddle, S->twidCoefModifier);
+    }
+    else
+    {
+      arm_radix4_butterfly_inverse_q31(p1, L, (q31_t *) S->pTwiddle, S->twidCoefModifier);
+    }
+    break;
+
+  case 32:
+  case 128:
+  case 512:
+  case 2048:
+    arm_cfft_radix4by2_q31(p1, L, S->pTwiddle, S->twidCoefModifier, ifftFlag);
+    break;
+  }
+
+  if(bitReverseFlag)
+    arm_bitreversal_32((uint32_t *) p1, S->bitRevLength, S->pBitRevTable);
+}
+
+/**    
+ * @} end of ComplexFFT group    
+ */
@@ -128,6 +128,243 @@
 */
 
 
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+/* Number of complex lanes of a vector */
+#define ARM_HOST_CLEN       (__HOST_VLEN / 2)
+
+/* Complex number (pair of float32 values) accessed as a single 64-bit lane */
+typedef double arm_host_c64_t __attribute__( ( aligned(4), __may_alias__ ) );
+typedef double arm_host_vc_t  __attribute__( ( vector_size(4 * __HOST_VLEN), aligned(4), __may_alias__ ) );
+
+/* Complex lanes 'ls2' float32 values apart */
+__HOST_SIMD_TARGET
+static __inline__ __attribute__( ( always_inline ) ) __host_vf arm_host_ld_c(
+const float32_t * p,
+uint32_t ls2)
+{
+   if(ls2 == 2u)
+   {
+      return (__HOST_LD(p));
+   }
+
+#if (__HOST_VLEN == 8)
+   return ((__host_vf) (arm_host_vc_t) { *(const arm_host_c64_t *) p,
+                                         *(const arm_host_c64_t *) (p + ls2),
+                                         *(const arm_host_c64_t *) (p + 2u * ls2),
+                                         *(const arm_host_c64_t *) (p + 3u * ls2) });
+#else
+   return ((__host_vf) (arm_host_vc_t) { *(const arm_host_c64_t *) p,
+                                         *(const arm_host_c64_t *) (p + ls2) });
+#endif
+}
+
+__HOST_SIMD_TARGET
+static __inline__ __attribute__( ( always_inline ) ) void arm_host_st_c(
+float32_t * p,
+uint32_t ls2,
+__host_vf v)
+{
+   arm_host_vc_t c = (arm_host_vc_t) v;
+
+   if(ls2 == 2u)
+   {
+      __HOST_ST(p, v);
+      return;
+   }
+
+   *(arm_host_c64_t *) p = c[0];
+   *(arm_host_c64_t *) (p + ls2) = c[1];
+#if (__HOST_VLEN == 8)
+   *(arm_host_c64_t *) (p + 2u * ls2) = c[2];
+   *(arm_host_c64_t *) (p + 3u * ls2) = c[3];
+#endif
+}
+
+/* Product by -j of each complex lane: (re, im) -> (im, -re) */
+#if (__HOST_VLEN == 8)
+static const __host_vf arm_host_mj_sign = { 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f };
+#else
+static const __host_vf arm_host_mj_sign = { 1.0f, -1.0f, 1.0f, -1.0f };
+#endif
+
+#define ARM_HOST_MJ(V)      (__HOST_SWAP2(V) * arm_host_mj_sign)
+
+/* Real (even) or imaginary (odd) part of each complex lane, in both lanes of the pair */
+#if (__HOST_VLEN == 8)
+#define ARM_HOST_DUP_RE(V)  __HOST_SHUF8((V), (V), 0, 0, 2, 2, 4, 4, 6, 6)
+#define ARM_HOST_DUP_IM(V)  __HOST_SHUF8((V), (V), 1, 1, 3, 3, 5, 5, 7, 7)
+#else
+#define ARM_HOST_DUP_RE(V)  __HOST_SHUF4((V), (V), 0, 0, 2, 2)
+#define ARM_HOST_DUP_IM(V)  __HOST_SHUF4((V), (V), 1, 1, 3, 3)
+#endif
+
+/* Twiddle of an output: (re, im) -> (co * re + si * im, co * im - si * re) */
+#define ARM_HOST_TW(Y,K)    (Y) = (pTw == NULL) ? (Y) :                                              \
+                                  __HOST_SEL(keep, (Y), (pTw[2u * (K) - 2u] * (Y)) +                 \
+                                                        (pTw[2u * (K) - 1u] * ARM_HOST_MJ(Y)))
+
+/*    
+* @brief  Radix-8 butterflies of the vector lanes, one butterfly per complex lane (host build).   
+* @param[in, out] *p     points to the first input of the butterfly of lane 0.   
+* @param[in]      n2x2   distance between the 8 inputs of a butterfly, in float32 values.   
+* @param[in]      ls2    distance between the butterflies of two lanes, in float32 values.   
+* @param[in]      *pTw   points to the twiddles of the outputs 1 to 7 (co, si), or NULL.   
+* @param[in]      keep   lanes that are not twiddled (the butterfly j = 0).   
+* @return none.   
+*   
+* Every lane makes the operations of arm_radix8_butterfly_f32() in the same order, so the results   
+* are bit-exact.   
+*/
+
+__HOST_SIMD_TARGET
+static __inline__ __attribute__( ( always_inline ) ) void arm_radix8_bfly_host(
+float32_t * p,
+uint32_t n2x2,
+uint32_t ls2,
+const __host_vf * pTw,
+__host_vi keep)
+{
+   __host_vf a1, a2, a3, a4, a5, a6, a7, a8, t, r3, u, v;
+   __host_vf y1, y2, y3, y4, y5, y6, y7;
+   __host_vf C81 = { 0.0f };
+
+   C81 += 0.70710678118f;
+
+   a1 = arm_host_ld_c(p, ls2);
+   a5 = arm_host_ld_c(p + 4u * n2x2, ls2);
+   t = a1;
+   a1 = t + a5;
+   a5 = t - a5;
+   a2 = arm_host_ld_c(p + n2x2, ls2);
+   a6 = arm_host_ld_c(p + 5u * n2x2, ls2);
+   t = a2;
+   a2 = t + a6;
+   a6 = t - a6;
+   a3 = arm_host_ld_c(p + 2u * n2x2, ls2);
+   a7 = arm_host_ld_c(p + 6u * n2x2, ls2);
+   t = a3;
+   a3 = t + a7;
+   a7 = t - a7;
+   a4 = arm_host_ld_c(p + 3u * n2x2, ls2);
+   a8 = arm_host_ld_c(p + 7u * n2x2, ls2);
+   t = a4;
+   a4 = t + a8;
+   a8 = t - a8;
+
+   t = a1 - a3;
+   a1 = a1 + a3;
+   r3 = a2 - a4;
+   a2 = a2 + a4;
+   arm_host_st_c(p, ls2, a1 + a2);
+   y4 = a1 - a2;
+   y2 = t + ARM_HOST_MJ(r3);
+   y6 = t - ARM_HOST_MJ(r3);
+
+   a1 = (a6 - a8) * C81;
+   a6 = (a6 + a8) * C81;
+   u = a5 - a1;
+   a5 = a5 + a1;
+   v = a7 - a6;
+   a7 = a7 + a6;
+   y1 = a5 + ARM_HOST_MJ(a7);
+   y7 = a5 - ARM_HOST_MJ(a7);
+   y5 = u + ARM_HOST_MJ(v);
+   y3 = u - ARM_HOST_MJ(v);
+
+   ARM_HOST_TW(y1, 1u);
+   ARM_HOST_TW(y2, 2u);
+   ARM_HOST_TW(y3, 3u);
+   ARM_HOST_TW(y4, 4u);
+   ARM_HOST_TW(y5, 5u);
+   ARM_HOST_TW(y6, 6u);
+   ARM_HOST_TW(y7, 7u);
+
+   arm_host_st_c(p + n2x2, ls2, y1);
+   arm_host_st_c(p + 2u * n2x2, ls2, y2);
+   arm_host_st_c(p + 3u * n2x2, ls2, y3);
+   arm_host_st_c(p + 4u * n2x2, ls2, y4);
+   arm_host_st_c(p + 5u * n2x2, ls2, y5);
+   arm_host_st_c(p + 6u * n2x2, ls2, y6);
+   arm_host_st_c(p + 7u * n2x2, ls2, y7);
+}
+
+/*    
+* @brief  Floating-point radix-8 CFFT butterflies with the vector unit (host build, fftLen >= 64).   
+* @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.   
+* @param[in]      fftLen           length of the FFT.   
+* @param[in]      *pCoef           points to the twiddle coefficient buffer.   
+* @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+* @return none.   
+*   
+* While a stage has fewer butterflies per twiddle than complex lanes, the lanes take butterflies   
+* with consecutive twiddles (j), otherwise butterflies of the same twiddle, n1 complex values apart.   
+*/
+
+__HOST_SIMD_TARGET
+static void arm_radix8_butterfly_f32_host(
+float32_t * pSrc,
+uint16_t fftLen,
+const float32_t * pCoef,
+uint16_t twidCoefModifier)
+{
+   __host_vf tw[14];                              /* co, si of the outputs 1 to 7 */
+   const __host_vi none = { 0 }, first = { -1, -1 };   /* lanes not twiddled */
+   __host_vf cs;                                  /* co, si of each lane */
+   uint32_t n1, n2, i1, j, k, ia;
+
+   n2 = fftLen;
+
+   do
+   {
+      n1 = n2;
+      n2 = n2 >> 3;
+
+      if((fftLen / n1) < ARM_HOST_CLEN)
+      {
+         /* Lanes j, j + 1, ..., each with its own twiddles */
+         for (j = 0u; j < n2; j += ARM_HOST_CLEN)
+         {
+            for (k = 1u; k < 8u; k++)
+            {
+               ia = 2u * k * j * twidCoefModifier;
+               cs = arm_host_ld_c(pCoef + ia, 2u * k * twidCoefModifier);
+               tw[2u * (k - 1u)] = ARM_HOST_DUP_RE(cs);
+               tw[2u * (k - 1u) + 1u] = ARM_HOST_DUP_IM(cs);
+            }
+
+            for (i1 = j; i1 < fftLen; i1 += n1)
+            {
+               arm_radix8_bfly_host(pSrc + 2u * i1, 2u * n2, 2u, tw, (j == 0u) ? first : none);
+            }
+         }
+      }
+      else
+      {
+         /* Lanes i1, i1 + n1, i1 + 2 * n1, ..., with the same twiddles */
+         for (j = 0u; j < n2; j++)
+         {
+            for (k = 1u; k < 8u; k++)
+            {
+               ia = 2u * k * j * twidCoefModifier;
+               cs = arm_host_ld_c(pCoef + ia, 0u);
+               tw[2u * (k - 1u)] = ARM_HOST_DUP_RE(cs);
+               tw[2u * (k - 1u) + 1u] = ARM_HOST_DUP_IM(cs);
+            }
+
+            for (i1 = j; i1 < fftLen; i1 += ARM_HOST_CLEN * n1)
+            {
+               arm_radix8_bfly_host(pSrc + 2u * i1, 2u * n2, 2u * n1, (j == 0u) ? NULL : tw, none);
+            }
+         }
+      }
+
+      twidCoefModifier <<= 3;
+   } while(n2 > 1u);
+}
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
 /*    
 * @brief  Core function for the floating-point CFFT butterfly process.   
 * @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.   
@@ -156,6 +393,17 @@ uint16_t twidCoefModifier)
    float32_t si2, si3, si4, si5, si6, si7, si8;
    const float32_t C81 = 0.70710678118f;
 
+#if defined (ARM_MATH_HOST) && defined (__HOST_SIMD)
+
+   /* Host build: vector unit */
+   if((fftLen >= 64u) && __HOST_SIMD_READY())
+   {
+      arm_radix8_butterfly_f32_host(pSrc, fftLen, pCoef, twidCoefModifier);
+      return;
+   }
+
+#endif /* #if defined (ARM_MATH_HOST) && defined (__HOST_SIMD) */
+
    n2 = fftLen;
    
    do 
@@ -0,0 +1,287 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_goertzel_f32.c    
+*    
+* Description:  Floating-point Goertzel bank.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief  Processing function for the floating-point Goertzel bank.    
+ * @param[in]  *S points to an instance of the floating-point Goertzel bank structure.    
+ * @param[in]  *pSrc points to the frame of <code>frameLen</code> input samples.    
+ * @param[out] *pDst points to the complex DFT values of the bins, <code>2*numBins</code> values    
+ *             in the order of <code>pBins</code>.    
+ * @return none.    
+ *    
+ * \par    
+ * The input frame is not modified, also when the real FFT computes the bins.    
+ */
+
+void arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t *pC = S->pCoeffs;                    /* Coefficients of the current bins */
+  float32_t *pIn;                                /* Input pointer */
+  float32_t x, l1, g1, s1, d1;                   /* Input, coefficients and states of the first bin */
+  uint32_t frameLen = S->frameLen;               /* Length of a frame */
+  uint32_t binCnt, sampCnt;                      /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t l2, l3, l4, g2, g3, g4;              /* Coefficients of the other bins */
+  float32_t s2, s3, s4, d2, d3, d4;              /* States of the other bins */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  if(S->fftLen != 0u)
+  {
+    float32_t *pX = S->pScratch + frameLen;      /* Spectrum of the frame */
+    uint32_t half = frameLen >> 1u;              /* Index of the Nyquist bin */
+    uint32_t k, i;                               /* Bin index and loop counter */
+
+    /* Real FFT of a copy of the frame, as the real FFT overwrites its input */
+    arm_copy_f32(pSrc, S->pScratch, frameLen);
+    arm_rfft_fast_f32(&S->rfft, S->pScratch, pX, 0u);
+
+    for (i = 0u; i < S->numBins; i++)
+    {
+      k = S->pBins[i];
+
+      /* The DC and Nyquist bins are real and packed in the first complex bin,
+       ** the bins above the Nyquist bin are the conjugates of the bins below */
+      if((k == 0u) || (k == half))
+      {
+        pDst[0] = (k == 0u) ? pX[0] : pX[1];
+        pDst[1] = 0.0f;
+      }
+      else if(k < half)
+      {
+        pDst[0] = pX[2u * k];
+        pDst[1] = pX[(2u * k) + 1u];
+      }
+      else
+      {
+        pDst[0] = pX[2u * (frameLen - k)];
+        pDst[1] = -pX[(2u * (frameLen - k)) + 1u];
+      }
+
+      pDst += 2u;
+    }
+
+    return;
+  }
+
+  /* Reinsch form of the Goertzel filter, with d[n] = s[n] - s[n-1] and l = 4*sin(w/2)^2:
+   ** d[n] = d[n-1] + x[n] - l*s[n-1], s[n] = s[n-1] + d[n].
+   ** Bins above a quarter of the sampling frequency are computed at w - pi, with the odd
+   ** samples of the input multiplied by g = -1, so that l is small where cos(w) is close to +1 or -1.
+   ** X = d[N-1] - l/2*s[N-1] + j*sin(w)*s[N-1], times g^N. */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Four bins at a time, with their states in registers.
+   ** The input is read once per four bins and the four recursions are interleaved. */
+  binCnt = (uint32_t) S->numBins >> 2u;
+
+  while(binCnt > 0u)
+  {
+    l1 = pC[0];
+    g1 = pC[2];
+    l2 = pC[3];
+    g2 = pC[5];
+    l3 = pC[6];
+    g3 = pC[8];
+    l4 = pC[9];
+    g4 = pC[11];
+
+    s1 = s2 = s3 = s4 = 0.0f;
+    d1 = d2 = d3 = d4 = 0.0f;
+
+    pIn = pSrc;
+
+    /* An even and an odd sample per iteration */
+    sampCnt = frameLen >> 1u;
+
+    while(sampCnt > 0u)
+    {
+      x = pIn[0];
+      d1 = (d1 + x) - (l1 * s1);
+      d2 = (d2 + x) - (l2 * s2);
+      d3 = (d3 + x) - (l3 * s3);
+      d4 = (d4 + x) - (l4 * s4);
+      s1 = s1 + d1;
+      s2 = s2 + d2;
+      s3 = s3 + d3;
+      s4 = s4 + d4;
+
+      x = pIn[1];
+      d1 = (d1 + (g1 * x)) - (l1 * s1);
+      d2 = (d2 + (g2 * x)) - (l2 * s2);
+      d3 = (d3 + (g3 * x)) - (l3 * s3);
+      d4 = (d4 + (g4 * x)) - (l4 * s4);
+      s1 = s1 + d1;
+      s2 = s2 + d2;
+      s3 = s3 + d3;
+      s4 = s4 + d4;
+
+      pIn += 2u;
+
+      /* Decrement the loop counter */
+      sampCnt--;
+    }
+
+    if((frameLen & 1u) != 0u)
+    {
+      /* Last sample of an odd frame, an even sample */
+      x = pIn[0];
+      d1 = (d1 + x) - (l1 * s1);
+      d2 = (d2 + x) - (l2 * s2);
+      d3 = (d3 + x) - (l3 * s3);
+      d4 = (d4 + x) - (l4 * s4);
+      s1 = s1 + d1;
+      s2 = s2 + d2;
+      s3 = s3 + d3;
+      s4 = s4 + d4;
+
+      /* The bins computed at w - pi are multiplied by exp(j*pi*frameLen) = -1 */
+      d1 = g1 * d1;
+      d2 = g2 * d2;
+      d3 = g3 * d3;
+      d4 = g4 * d4;
+      s1 = g1 * s1;
+      s2 = g2 * s2;
+      s3 = g3 * s3;
+      s4 = g4 * s4;
+    }
+
+    /* X = d - l/2*s + j*sin(w)*s */
+    pDst[0] = d1 - ((0.5f * l1) * s1);
+    pDst[1] = pC[1] * s1;
+    pDst[2] = d2 - ((0.5f * l2) * s2);
+    pDst[3] = pC[4] * s2;
+    pDst[4] = d3 - ((0.5f * l3) * s3);
+    pDst[5] = pC[7] * s3;
+    pDst[6] = d4 - ((0.5f * l4) * s4);
+    pDst[7] = pC[10] * s4;
+
+    /* update pointers to process next bins */
+    pC += 12u;
+    pDst += 8u;
+
+    /* Decrement the loop counter */
+    binCnt--;
+  }
+
+  /* If the number of bins is not a multiple of 4, compute the remaining bins here.
+   ** No loop unrolling is used. */
+  binCnt = (uint32_t) S->numBins % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over all bins */
+  binCnt = (uint32_t) S->numBins;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(binCnt > 0u)
+  {
+    l1 = pC[0];
+    g1 = pC[2];
+    s1 = 0.0f;
+    d1 = 0.0f;
+
+    pIn = pSrc;
+
+    sampCnt = frameLen >> 1u;
+
+    while(sampCnt > 0u)
+    {
+      x = pIn[0];
+      d1 = (d1 + x) - (l1 * s1);
+      s1 = s1 + d1;
+      x = pIn[1];
+      d1 = (d1 + (g1 * x)) - (l1 * s1);
+      s1 = s1 + d1;
+
+      pIn += 2u;
+
+      /* Decrement the loop counter */
+      sampCnt--;
+    }
+
+    if((frameLen & 1u) != 0u)
+    {
+      x = pIn[0];
+      d1 = (d1 + x) - (l1 * s1);
+      s1 = s1 + d1;
+
+      d1 = g1 * d1;
+      s1 = g1 * s1;
+    }
+
+    pDst[0] = d1 - ((0.5f * l1) * s1);
+    pDst[1] = pC[1] * s1;
+
+    /* update pointers to process next bin */
+    pC += 3u;
+    pDst += 2u;
+
+    /* Decrement the loop counter */
+    binCnt--;
+  }
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
@@ -0,0 +1,233 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_goertzel_init_f32.c    
+*    
+* Description:  Floating-point Goertzel bank initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @defgroup Goertzel Goertzel Bank    
+ *    
+ * Computes selected bins of the DFT of a frame of <code>N = frameLen</code> real samples,    
+ * <pre>    
+ *     X[k] = sum(x[n] * exp(-j*2*pi*k*n/N)),   n = 0, 1, ..., N-1    
+ * </pre>    
+ * for the bin indices <code>k</code> listed in <code>pBins</code>, one call per frame.  Tone and DTMF detectors    
+ * read a few bins of each frame, which a full FFT computes together with all the others.    
+ * The bins are written as complex values in the layout of the complex FFT, so that    
+ * <code>arm_cmplx_mag_f32()</code> or <code>arm_cmplx_mag_squared_f32()</code> gives their magnitude.    
+ *    
+ * \par Algorithm    
+ * Each bin is computed by a second order resonator, the Goertzel filter, in the form of Reinsch with    
+ * <code>l = 4*sin(w/2)^2</code>, <code>w = 2*pi*k/N</code>:    
+ * <pre>    
+ *     d[n] = d[n-1] + x[n] - l*s[n-1]    
+ *     s[n] = s[n-1] + d[n]    
+ * </pre>    
+ * at the cost of one multiplication and three additions per sample, and the DFT value is formed from    
+ * the last states:    
+ * <pre>    
+ *     X[k] = d[N-1] - l/2*s[N-1] + j*sin(w)*s[N-1]    
+ * </pre>    
+ * Unlike the classic recursion on <code>2*cos(w)</code>, this form does not lose the low bits of    
+ * <code>1 - cos(w)</code> near DC.  Bins above a quarter of the sampling frequency are computed at    
+ * <code>w - pi</code> with the odd input samples negated, which keeps the same accuracy near the Nyquist frequency.    
+ * \par    
+ * The resonators of several bins run together over the frame with their states in registers, four bins    
+ * in the floating-point version and two in the fixed-point versions, so that each pass over the input    
+ * serves all of them and their recursions are interleaved in the pipeline.    
+ *    
+ * \par Choice of the FFT    
+ * The Goertzel bank takes <code>numBins*N</code> resonator updates per frame and the real FFT    
+ * takes of the order of <code>N*log2(N)</code> operations, whatever the number of bins.  When a scratch buffer    
+ * is given and <code>N</code> is a length of <code>arm_rfft_fast_f32()</code>, a power of 2 from 32 to 8192,    
+ * the initialization function selects the real FFT if    
+ * <pre>    
+ *     4*numBins > ARM_MATH_GOERTZEL_FFT_RATIO * log2(N)    
+ * </pre>    
+ * where <code>N/4*log2(N)</code> is about the number of radix-2 butterflies of the real FFT, and the processing    
+ * function then reads the bins from the spectrum.  The default ratio of 2 selects it from 6 bins of a    
+ * 1024-sample frame.  The fixed-point versions use the real FFT only on targets with a floating-point unit    
+ * and on the host build.    
+ *    
+ * \par Coefficients    
+ * The sines of <code>w/2</code> and <code>w</code> are computed by the initialization function with the    
+ * numerically controlled oscillator, from the phase <code>k/N</code> rounded to 32 bits.    
+ * \par    
+ * The fixed-point versions hold <code>l</code> and <code>sin(w)</code> in 2.30 format, with the right shift of    
+ * the input that keeps each resonator from overflowing.    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * The real FFT replaces the Goertzel filters when they would take more than ARM_MATH_GOERTZEL_FFT_RATIO    
+ * resonator updates per radix-2 butterfly of the FFT, that is when <code>4*numBins</code> is above    
+ * <code>ARM_MATH_GOERTZEL_FFT_RATIO*log2(frameLen)</code>.  Timing both on the host build for frames of 256    
+ * to 4096 samples gives a break-even ratio of 1.7 to 3.0, hence the default of 2.  A project may define its    
+ * own value, calibrated on its target.    
+ */
+#ifndef ARM_MATH_GOERTZEL_FFT_RATIO
+#define ARM_MATH_GOERTZEL_FFT_RATIO   2
+#endif
+
+/**    
+ * @brief  Length of the real FFT that replaces the Goertzel filters.    
+ * @param[in] numBins number of bins.    
+ * @param[in] frameLen length of a frame, in samples.    
+ * @return The function returns the FFT length, or 0 when the Goertzel filters are faster    
+ * or the frame length is not a length of the real FFT.    
+ */
+
+uint32_t arm_goertzel_fft_len(
+  uint32_t numBins,
+  uint32_t frameLen)
+{
+  uint32_t fftLen = 32u;                         /* Shortest real FFT */
+  uint32_t log2Len = 5u;                         /* log2 of the FFT length */
+
+  while(fftLen < frameLen)
+  {
+    fftLen <<= 1u;
+    log2Len++;
+  }
+
+  /* Lengths of arm_rfft_fast_f32(), or the Goertzel filters cost less */
+  if((fftLen != frameLen) || (fftLen > 8192u) ||
+     ((4u * numBins) <= (ARM_MATH_GOERTZEL_FFT_RATIO * log2Len)))
+  {
+    fftLen = 0u;
+  }
+
+  return (fftLen);
+}
+
+/**    
+ * @brief  Initialization function for the floating-point Goertzel bank.    
+ * @param[out] *S points to an instance of the floating-point Goertzel bank structure.    
+ * @param[in]  numBins number of bins.    
+ * @param[in]  frameLen length of a frame, in samples.    
+ * @param[in]  *pBins points to the bin indices, <code>numBins</code> values below <code>frameLen</code>.    
+ * @param[out] *pCoeffs points to the coefficient buffer of <code>3*numBins</code> values.    
+ * @param[in]  *pScratch points to a scratch buffer of <code>2*frameLen</code> words, or NULL to always use    
+ *             the Goertzel filters.    
+ * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if    
+ * <code>numBins</code> or <code>frameLen</code> is zero, or a bin index is not below <code>frameLen</code>.    
+ *    
+ * \par    
+ * <code>pBins</code> is kept by the instance and read by the processing function when it uses the real FFT.    
+ */
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const uint16_t * pBins,
+  float32_t * pCoeffs,
+  float32_t * pScratch)
+{
+  arm_nco_instance_f32 nco;                      /* Oscillator for the coefficients */
+  uint32_t phase;                                /* Phase of a bin frequency, 2^32 steps per turn */
+  uint32_t high;                                 /* Bin above a quarter of the sampling frequency */
+  float32_t sinVal;                              /* sin(w/2) */
+  uint32_t i;                                    /* loop counter */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  if((numBins == 0u) || (frameLen == 0u))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0u; (i < numBins) && (status == ARM_MATH_SUCCESS); i++)
+  {
+    if(pBins[i] >= frameLen)
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    for (i = 0u; i < numBins; i++)
+    {
+      /* Phase of w = 2*pi*k/frameLen, minus half a turn above a quarter of the sampling frequency */
+      phase = (uint32_t) ((((uint64_t) pBins[i] << 32) + (frameLen >> 1u)) / frameLen);
+      high = (((phase + 0x40000000u) & 0x80000000u) != 0u) ? 1u : 0u;
+      phase = (high != 0u) ? (phase - 0x80000000u) : phase;
+
+      /* sin(w/2), then l = 4*sin(w/2)^2 */
+      arm_nco_init_f32(&nco, 0u, (uint32_t) ((int32_t) phase >> 1), 0u);
+      arm_nco_f32(&nco, NULL, NULL, &sinVal, NULL, 1u);
+      pCoeffs[3u * i] = 4.0f * (sinVal * sinVal);
+
+      /* sin(w), and the factor of the odd samples */
+      arm_nco_init_f32(&nco, 0u, phase, 0u);
+      arm_nco_f32(&nco, NULL, NULL, &pCoeffs[(3u * i) + 1u], NULL, 1u);
+      pCoeffs[(3u * i) + 2u] = (high != 0u) ? -1.0f : 1.0f;
+    }
+
+    /* Assign the bins and the coefficients */
+    S->numBins = numBins;
+    S->frameLen = frameLen;
+    S->pBins = pBins;
+    S->pCoeffs = pCoeffs;
+    S->pScratch = pScratch;
+
+    /* The real FFT replaces the Goertzel filters for many bins */
+    S->fftLen = 0u;
+
+    if((pScratch != NULL) && (arm_goertzel_fft_len(numBins, frameLen) != 0u))
+    {
+      (void) arm_rfft_fast_init_f32(&S->rfft, frameLen);
+      S->fftLen = frameLen;
+    }
+  }
+
+  return (status);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
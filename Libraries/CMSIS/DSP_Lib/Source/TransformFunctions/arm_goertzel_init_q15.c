@@ -0,0 +1,195 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_goertzel_init_q15.c    
+*    
+* Description:  Q15 Goertzel bank initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+extern uint32_t arm_goertzel_fft_len(
+  uint32_t numBins,
+  uint32_t frameLen);
+
+/**    
+ * @brief  Initialization function for the Q15 Goertzel bank.    
+ * @param[out] *S points to an instance of the Q15 Goertzel bank structure.    
+ * @param[in]  numBins number of bins.    
+ * @param[in]  frameLen length of a frame, in samples.    
+ * @param[in]  *pBins points to the bin indices, <code>numBins</code> values below <code>frameLen</code>.    
+ * @param[out] *pCoeffs points to the coefficient buffer of <code>4*numBins</code> values.    
+ * @param[in]  *pScratch points to a scratch buffer of <code>2*frameLen</code> words, or NULL to always use    
+ *             the Goertzel filters.    
+ * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if    
+ * <code>numBins</code> or <code>frameLen</code> is zero, a bin index is not below <code>frameLen</code>,    
+ * or the states of a bin would need an input shift of more than 31 bits, which happens only for frames    
+ * longer than 46340 samples with a bin at DC or at the Nyquist frequency.    
+ *    
+ * \par    
+ * The coefficients are the same as in the Q31 version, with the input shift applied to the Q15 input    
+ * extended to 1.31 format.    
+ * \par    
+ * <code>pBins</code> is kept by the instance and read by the processing function when it uses the real FFT.    
+ */
+
+arm_status arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const uint16_t * pBins,
+  q31_t * pCoeffs,
+  float32_t * pScratch)
+{
+  arm_nco_instance_q31 nco;                      /* Oscillator for the coefficients */
+  uint32_t phase;                                /* Phase of a bin frequency, 2^32 steps per turn */
+  uint32_t high;                                 /* Bin above a quarter of the sampling frequency */
+  q31_t sinVal;                                  /* sin(w/2), then sin(w) */
+  uint32_t absSin;                               /* |sin(w)| */
+  q63_t lambda;                                  /* 4*sin(w/2)^2 in 2.30 format */
+  uint64_t bound;                                /* Bound of the states, in units of the input */
+  uint32_t shift;                                /* Input shift of a bin */
+  uint32_t log2Len;                              /* log2 of the frame length */
+  uint32_t i;                                    /* loop counter */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  if((numBins == 0u) || (frameLen == 0u))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0u; (i < numBins) && (status == ARM_MATH_SUCCESS); i++)
+  {
+    if(pBins[i] >= frameLen)
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+  }
+
+  log2Len = 0u;
+
+  while((1u << log2Len) < frameLen)
+  {
+    log2Len++;
+  }
+
+  for (i = 0u; (i < numBins) && (status == ARM_MATH_SUCCESS); i++)
+  {
+    /* Phase of w = 2*pi*k/frameLen, minus half a turn above a quarter of the sampling frequency */
+    phase = (uint32_t) ((((uint64_t) pBins[i] << 32) + (frameLen >> 1u)) / frameLen);
+    high = (((phase + 0x40000000u) & 0x80000000u) != 0u) ? 1u : 0u;
+    phase = (high != 0u) ? (phase - 0x80000000u) : phase;
+
+    /* l = 4*sin(w/2)^2 in 2.30 format, at most 2 */
+    arm_nco_init_q31(&nco, 0u, (uint32_t) ((int32_t) phase >> 1), 0u);
+    arm_nco_q31(&nco, NULL, NULL, &sinVal, NULL, 1u);
+    lambda = (((q63_t) sinVal * sinVal) + 0x20000000) >> 30;
+    pCoeffs[4u * i] = (lambda > 0x7FFFFFFF) ? 0x7FFFFFFF : (q31_t) lambda;
+
+    /* sin(w) in 2.30 format */
+    arm_nco_init_q31(&nco, 0u, phase, 0u);
+    arm_nco_q31(&nco, NULL, NULL, &sinVal, NULL, 1u);
+    pCoeffs[(4u * i) + 1u] = (q31_t) (((q63_t) sinVal + 1) >> 1);
+
+    /* The states are bounded by sum(|sin(m*w)|) / |sin(w)| times the largest input, m = 1, ..., frameLen,
+     ** which is below frameLen / |sin(w)| and frameLen*(frameLen+1)/2 */
+    bound = ((uint64_t) frameLen * (frameLen + 1u)) >> 1u;
+
+    absSin = (sinVal > 0) ? (uint32_t) sinVal : (0u - (uint32_t) sinVal);
+
+    if((absSin != 0u) && ((((uint64_t) frameLen << 31) / absSin) < bound))
+    {
+      bound = ((uint64_t) frameLen << 31) / absSin;
+    }
+
+    /* The states hold the input shifted right by shift bits, so that 2*bound + 1 times the largest input
+     ** stays below 2^31, and shift is not below log2Len so that the DFT value also fits */
+    shift = log2Len;
+
+    while(((uint64_t) 1 << shift) <= ((2u * bound) + 1u))
+    {
+      shift++;
+    }
+
+    if(shift > 31u)
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    pCoeffs[(4u * i) + 2u] = (q31_t) shift;
+
+    /* Mask that negates the odd samples of the bins computed at w - pi */
+    pCoeffs[(4u * i) + 3u] = (high != 0u) ? -1 : 0;
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    /* Assign the bins and the coefficients */
+    S->numBins = numBins;
+    S->frameLen = frameLen;
+    S->shift = (uint8_t) log2Len;
+    S->pBins = pBins;
+    S->pCoeffs = pCoeffs;
+    S->pScratch = pScratch;
+
+    /* The real FFT replaces the Goertzel filters for many bins, on targets with a floating-point unit */
+    S->fftLen = 0u;
+
+#if defined (ARM_MATH_HOST) || (__FPU_USED == 1)
+
+    if((pScratch != NULL) && (arm_goertzel_fft_len(numBins, frameLen) != 0u))
+    {
+      (void) arm_rfft_fast_init_f32(&S->rfft, frameLen);
+      S->fftLen = frameLen;
+    }
+
+#endif /* #if defined (ARM_MATH_HOST) || (__FPU_USED == 1) */
+  }
+
+  return (status);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
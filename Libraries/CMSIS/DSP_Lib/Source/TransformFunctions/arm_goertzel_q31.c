@@ -0,0 +1,302 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_goertzel_q31.c    
+*    
+* Description:  Q31 Goertzel bank.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief  Processing function for the Q31 Goertzel bank.    
+ * @param[in]  *S points to an instance of the Q31 Goertzel bank structure.    
+ * @param[in]  *pSrc points to the frame of <code>frameLen</code> input samples.    
+ * @param[out] *pDst points to the complex DFT values of the bins, <code>2*numBins</code> values    
+ *             in the order of <code>pBins</code>.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The DFT values are divided by <code>2^shift</code>, the smallest power of 2 not below <code>frameLen</code>,    
+ * and written in 1.31 format, so that they cannot overflow.    
+ * \par    
+ * The input of each resonator is shifted right, with rounding, by the number of bits that keeps its states    
+ * from overflowing, which the initialization function computes from the frame length and the bin frequency.    
+ * It is 1 or 2 bits above <code>shift</code> for bins far from DC and from the Nyquist frequency, and grows    
+ * as <code>log2(1/sin(w))</code> near them, up to <code>2*shift</code> at DC.    
+ */
+
+void arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst)
+{
+  q31_t *pC = S->pCoeffs;                        /* Coefficients of the current bins */
+  q31_t *pIn;                                    /* Input pointer */
+  q31_t x, l1, g1, s1, d1;                       /* Input, coefficients and states of the first bin */
+  uint32_t sh1;                                  /* Input shift of the first bin */
+  q63_t accR, accI;                              /* DFT value */
+  uint32_t outShift;                             /* Shift of the DFT value to the output format */
+  uint32_t frameLen = S->frameLen;               /* Length of a frame */
+  uint32_t binCnt, sampCnt;                      /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t l2, g2, s2, d2;                          /* Coefficients and states of the second bin */
+  uint32_t sh2;                                  /* Input shift of the second bin */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+#if defined (ARM_MATH_HOST) || (__FPU_USED == 1)
+
+  if(S->fftLen != 0u)
+  {
+    float32_t *pX = S->pScratch + frameLen;      /* Spectrum of the frame */
+    float32_t scale;                             /* Scaling to the output format */
+    float32_t re, im;                            /* Bin of the spectrum */
+    uint32_t half = frameLen >> 1u;              /* Index of the Nyquist bin */
+    uint32_t k, i;                               /* Bin index and loop counter */
+
+    /* Real FFT of the frame in floating-point */
+    arm_q31_to_float(pSrc, S->pScratch, frameLen);
+    arm_rfft_fast_f32(&S->rfft, S->pScratch, pX, 0u);
+
+    /* 2^31 / 2^shift */
+    scale = (float32_t) (1u << (31u - S->shift));
+
+    for (i = 0u; i < S->numBins; i++)
+    {
+      k = S->pBins[i];
+
+      /* The DC and Nyquist bins are real and packed in the first complex bin,
+       ** the bins above the Nyquist bin are the conjugates of the bins below */
+      if((k == 0u) || (k == half))
+      {
+        re = (k == 0u) ? pX[0] : pX[1];
+        im = 0.0f;
+      }
+      else if(k < half)
+      {
+        re = pX[2u * k];
+        im = pX[(2u * k) + 1u];
+      }
+      else
+      {
+        re = pX[2u * (frameLen - k)];
+        im = -pX[(2u * (frameLen - k)) + 1u];
+      }
+
+      pDst[0] = clip_q63_to_q31((q63_t) (re * scale));
+      pDst[1] = clip_q63_to_q31((q63_t) (im * scale));
+
+      pDst += 2u;
+    }
+
+    return;
+  }
+
+#endif /* #if defined (ARM_MATH_HOST) || (__FPU_USED == 1) */
+
+  /* Reinsch form of the Goertzel filter, with d[n] = s[n] - s[n-1] and l = 4*sin(w/2)^2 in 2.30 format:
+   ** d[n] = d[n-1] + x[n] - l*s[n-1], s[n] = s[n-1] + d[n].
+   ** Bins above a quarter of the sampling frequency are computed at w - pi, with the odd
+   ** samples of the input negated by the mask g, so that l is small where cos(w) is close to +1 or -1.
+   ** X = d[N-1] - l/2*s[N-1] + j*sin(w)*s[N-1], negated by g for an odd frame. */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Two bins at a time, with their states in registers.
+   ** The input is read once per two bins and the two recursions are interleaved. */
+  binCnt = (uint32_t) S->numBins >> 1u;
+
+  while(binCnt > 0u)
+  {
+    l1 = pC[0];
+    sh1 = (uint32_t) pC[2];
+    g1 = pC[3];
+    l2 = pC[4];
+    sh2 = (uint32_t) pC[6];
+    g2 = pC[7];
+
+    s1 = s2 = 0;
+    d1 = d2 = 0;
+
+    pIn = pSrc;
+
+    /* An even and an odd sample per iteration */
+    sampCnt = frameLen >> 1u;
+
+    while(sampCnt > 0u)
+    {
+      /* The input shifted right with rounding */
+      x = pIn[0];
+      d1 = (d1 + (((x >> (sh1 - 1u)) + 1) >> 1)) - (q31_t) ((((q63_t) l1 * s1) + 0x20000000) >> 30);
+      d2 = (d2 + (((x >> (sh2 - 1u)) + 1) >> 1)) - (q31_t) ((((q63_t) l2 * s2) + 0x20000000) >> 30);
+      s1 = s1 + d1;
+      s2 = s2 + d2;
+
+      x = pIn[1];
+      d1 = (d1 + (((((x >> (sh1 - 1u)) + 1) >> 1) ^ g1) - g1)) -
+        (q31_t) ((((q63_t) l1 * s1) + 0x20000000) >> 30);
+      d2 = (d2 + (((((x >> (sh2 - 1u)) + 1) >> 1) ^ g2) - g2)) -
+        (q31_t) ((((q63_t) l2 * s2) + 0x20000000) >> 30);
+      s1 = s1 + d1;
+      s2 = s2 + d2;
+
+      pIn += 2u;
+
+      /* Decrement the loop counter */
+      sampCnt--;
+    }
+
+    if((frameLen & 1u) != 0u)
+    {
+      /* Last sample of an odd frame, an even sample */
+      x = pIn[0];
+      d1 = (d1 + (((x >> (sh1 - 1u)) + 1) >> 1)) - (q31_t) ((((q63_t) l1 * s1) + 0x20000000) >> 30);
+      d2 = (d2 + (((x >> (sh2 - 1u)) + 1) >> 1)) - (q31_t) ((((q63_t) l2 * s2) + 0x20000000) >> 30);
+      s1 = s1 + d1;
+      s2 = s2 + d2;
+
+      /* The bins computed at w - pi are multiplied by exp(j*pi*frameLen) = -1 */
+      d1 = (d1 ^ g1) - g1;
+      s1 = (s1 ^ g1) - g1;
+      d2 = (d2 ^ g2) - g2;
+      s2 = (s2 ^ g2) - g2;
+    }
+
+    /* X = d - l/2*s + j*sin(w)*s with 31 more fractional bits than the states,
+     ** shifted with rounding to X / 2^shift in 1.31 format */
+    outShift = (31u + S->shift) - sh1;
+    accR = ((q63_t) d1 << 31) - ((q63_t) l1 * s1);
+    accI = ((q63_t) pC[1] * s1) << 1;
+    pDst[0] = clip_q63_to_q31((accR + (((q63_t) 1 << outShift) >> 1)) >> outShift);
+    pDst[1] = clip_q63_to_q31((accI + (((q63_t) 1 << outShift) >> 1)) >> outShift);
+
+    outShift = (31u + S->shift) - sh2;
+    accR = ((q63_t) d2 << 31) - ((q63_t) l2 * s2);
+    accI = ((q63_t) pC[5] * s2) << 1;
+    pDst[2] = clip_q63_to_q31((accR + (((q63_t) 1 << outShift) >> 1)) >> outShift);
+    pDst[3] = clip_q63_to_q31((accI + (((q63_t) 1 << outShift) >> 1)) >> outShift);
+
+    /* update pointers to process next bins */
+    pC += 8u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    binCnt--;
+  }
+
+  /* If the number of bins is odd, compute the last bin here. */
+  binCnt = (uint32_t) S->numBins % 0x2u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over all bins */
+  binCnt = (uint32_t) S->numBins;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(binCnt > 0u)
+  {
+    l1 = pC[0];
+    sh1 = (uint32_t) pC[2];
+    g1 = pC[3];
+    s1 = 0;
+    d1 = 0;
+
+    pIn = pSrc;
+
+    sampCnt = frameLen >> 1u;
+
+    while(sampCnt > 0u)
+    {
+      x = pIn[0];
+      d1 = (d1 + (((x >> (sh1 - 1u)) + 1) >> 1)) - (q31_t) ((((q63_t) l1 * s1) + 0x20000000) >> 30);
+      s1 = s1 + d1;
+      x = pIn[1];
+      d1 = (d1 + (((((x >> (sh1 - 1u)) + 1) >> 1) ^ g1) - g1)) -
+        (q31_t) ((((q63_t) l1 * s1) + 0x20000000) >> 30);
+      s1 = s1 + d1;
+
+      pIn += 2u;
+
+      /* Decrement the loop counter */
+      sampCnt--;
+    }
+
+    if((frameLen & 1u) != 0u)
+    {
+      x = pIn[0];
+      d1 = (d1 + (((x >> (sh1 - 1u)) + 1) >> 1)) - (q31_t) ((((q63_t) l1 * s1) + 0x20000000) >> 30);
+      s1 = s1 + d1;
+
+      d1 = (d1 ^ g1) - g1;
+      s1 = (s1 ^ g1) - g1;
+    }
+
+    outShift = (31u + S->shift) - sh1;
+    accR = ((q63_t) d1 << 31) - ((q63_t) l1 * s1);
+    accI = ((q63_t) pC[1] * s1) << 1;
+    pDst[0] = clip_q63_to_q31((accR + (((q63_t) 1 << outShift) >> 1)) >> outShift);
+    pDst[1] = clip_q63_to_q31((accI + (((q63_t) 1 << outShift) >> 1)) >> outShift);
+
+    /* update pointers to process next bin */
+    pC += 4u;
+    pDst += 2u;
+
+    /* Decrement the loop counter */
+    binCnt--;
+  }
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
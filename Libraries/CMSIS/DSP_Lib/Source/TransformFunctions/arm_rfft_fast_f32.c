@@ -263,7 +263,8 @@ float32_t * p, float32_t * pOut)
  * forward transform outputs the data in this form and the inverse transform
  * expects input data in this form.  The function always performs the needed
  * bitreversal so that the input and output data is always in normal order.  The 
- * functions support lengths of [32, 64, 128, ..., 4096] samples.
+ * functions support lengths of [32, 64, 128, ..., 4096] samples, and 8192 with
+ * ARM_MATH_RFFT_8192 (see the pre-processor macros of the library).
  * \par
  * The forward and inverse real FFT functions apply the standard FFT scaling; no
  * scaling on the forward transform and 1/fftLen scaling on the inverse
@@ -0,0 +1,198 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_rfft_mixed_f32.c    
+*    
+* Description:  Floating-point mixed-radix real FFT processing function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/*   
+ * Real FFT of fftLenRFFT points from the complex FFT of the fftLenRFFT/2 points of the even   
+ * and odd samples: X(k) = 1/2 * (XA(k) + XB(k) + TW(k) * (XB(k) - XA(k))), with   
+ * XB(k) = conj(XA(N/2-k)) and TW(k) = sin(2*pi*k/N) + i*cos(2*pi*k/N), the values of   
+ * twiddleCoef_rfft_N, read from the twiddle table of the complex FFT.  Same computation as   
+ * stage_rfft_f32().   
+ */
+
+static void arm_rfft_mixed_split_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut)
+{
+  const float32_t *pTw = S->pTwiddleRFFT;        /* Points to the twiddle factors */
+  uint32_t twStep = 2u * S->twidCoefRModifier;   /* Step of TW(k) in the table */
+  float32_t *pA = p;                             /* increasing pointer */
+  float32_t *pB;                                 /* decreasing pointer */
+  float32_t xAR, xAI, xBR, xBI;                  /* temporary variables */
+  float32_t twR, twI, t1a, t1b;                  /* temporary variables */
+  uint32_t k = S->Sint.fftLen - 1u;              /* Loop counter */
+  uint32_t tw = twStep;                          /* Index of TW(k) */
+
+  /* Pack the first and the middle bin together: X(0) and X(N/2) are real */
+  xAR = pA[0];
+  xAI = pA[1];
+  *pOut++ = xAR + xAI;
+  *pOut++ = xAR - xAI;
+
+  pB = p + (2u * k);
+  pA += 2;
+
+  while(k > 0u)
+  {
+    xBR = pB[0];
+    xBI = pB[1];
+    xAR = pA[0];
+    xAI = pA[1];
+
+    twR = pTw[tw + 1u];
+    twI = pTw[tw];
+
+    t1a = xBR - xAR;
+    t1b = xBI + xAI;
+
+    *pOut++ = 0.5f * (xAR + xBR + (twR * t1a) + (twI * t1b));
+    *pOut++ = 0.5f * (xAI - xBI + (twI * t1a) - (twR * t1b));
+
+    tw += twStep;
+    pA += 2;
+    pB -= 2;
+    k--;
+  }
+}
+
+/*   
+ * Inverse of arm_rfft_mixed_split_f32(): complex spectrum of fftLenRFFT/2 points whose inverse   
+ * complex FFT gives the even and odd samples.  Same computation as merge_rfft_f32().   
+ */
+
+static void arm_rfft_mixed_merge_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut)
+{
+  const float32_t *pTw = S->pTwiddleRFFT;        /* Points to the twiddle factors */
+  uint32_t twStep = 2u * S->twidCoefRModifier;   /* Step of TW(k) in the table */
+  float32_t *pA = p;                             /* increasing pointer */
+  float32_t *pB;                                 /* decreasing pointer */
+  float32_t xAR, xAI, xBR, xBI;                  /* temporary variables */
+  float32_t twR, twI, t1a, t1b;                  /* temporary variables */
+  uint32_t k = S->Sint.fftLen - 1u;              /* Loop counter */
+  uint32_t tw = twStep;                          /* Index of TW(k) */
+
+  xAR = pA[0];
+  xAI = pA[1];
+  *pOut++ = 0.5f * (xAR + xAI);
+  *pOut++ = 0.5f * (xAR - xAI);
+
+  pB = p + (2u * k);
+  pA += 2;
+
+  while(k > 0u)
+  {
+    /* Xk(k) = 1/2 * (G(k) + conj(G(N-k+2)) + Tw(k)*( G(k) - conj(G(N-k+2)))) */
+    xBR = pB[0];
+    xBI = pB[1];
+    xAR = pA[0];
+    xAI = pA[1];
+
+    twR = pTw[tw + 1u];
+    twI = pTw[tw];
+
+    t1a = xAR - xBR;
+    t1b = xAI + xBI;
+
+    *pOut++ = 0.5f * (xAR + xBR - (twR * t1a) - (twI * t1b));
+    *pOut++ = 0.5f * (xAI - xBI + (twI * t1a) - (twR * t1b));
+
+    tw += twStep;
+    pA += 2;
+    pB -= 2;
+    k--;
+  }
+}
+
+/**   
+* @ingroup groupTransforms   
+*/
+
+/**   
+* @addtogroup RealFFT   
+* @{   
+*/
+
+/**   
+* @brief Processing function for the floating-point mixed-radix real FFT.   
+* @param[in]  *S         points to an arm_rfft_mixed_instance_f32 structure.   
+* @param[in]  *p         points to the input buffer, which is modified.   
+* @param[out] *pOut      points to the output buffer.   
+* @param[in]  ifftFlag   RFFT if flag is 0, RIFFT if flag is 1   
+* @return none.   
+*   
+* \par   
+* Same input and output formats as <code>arm_rfft_fast_f32()</code>, for the lengths of   
+* <code>arm_rfft_mixed_init_f32()</code>: the output of the forward transform holds the real   
+* parts of X(0) and X(fftLen/2), then the complex bins 1 to fftLen/2-1.   
+*/
+
+void arm_rfft_mixed_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag)
+{
+  /* Calculation of Real FFT */
+  if(ifftFlag)
+  {
+    /*  Real FFT compression */
+    arm_rfft_mixed_merge_f32(S, p, pOut);
+
+    /* Complex IFFT of half the length */
+    arm_cfft_mixed_f32(&S->Sint, pOut, ifftFlag, 1u);
+  }
+  else
+  {
+    /* Complex FFT of half the length */
+    arm_cfft_mixed_f32(&S->Sint, p, ifftFlag, 1u);
+
+    /*  Real FFT extraction */
+    arm_rfft_mixed_split_f32(S, p, pOut);
+  }
+}
+
+/**   
+* @} end of RealFFT group   
+*/
@@ -0,0 +1,153 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_rfft_mixed_init_f32.c    
+*    
+* Description:  Floating-point mixed-radix real FFT initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**   
+ * @ingroup groupTransforms   
+ */
+
+/**   
+ * @addtogroup RealFFT   
+ * @{   
+ */
+
+/**   
+* @brief  Initialization function for the floating-point mixed-radix real FFT.   
+* @param[in,out] *S             points to an arm_rfft_mixed_instance_f32 structure.   
+* @param[in]     fftLen         length of the Real Sequence.   
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.   
+*   
+* \par Description:   
+* \par   
+* The parameter <code>fftLen</code>	Specifies length of RFFT/RIFFT process. Supported FFT Lengths are 96, 192, 384, 768,   
+* 160, 320, 640, 1280, 120, 240, 480, 960, 1920 and 3840: the lengths of the complex FFT of half the length for which   
+* <code>twiddleCoef_3840</code> also holds the twiddle factors of the real stage.   
+* \par   
+* This Function also initializes Twiddle factor table pointers and the digit reversal table pointer.   
+*/
+
+arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen)
+{
+  arm_cfft_mixed_instance_f32 *Sint = &(S->Sint);
+
+  /*  Initialise the FFT lengths */
+  S->fftLenRFFT = fftLen;
+  Sint->fftLen = fftLen / 2u;
+
+  /*  Initializations of the digit reversal table depending on the FFT length */
+  switch (Sint->fftLen)
+  {
+  case 1920u:
+    Sint->pDigitRevTable = armDigitRevIndexTable1920;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE1920_TABLE_LENGTH;
+    break;
+  case 960u:
+    Sint->pDigitRevTable = armDigitRevIndexTable960;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE_960_TABLE_LENGTH;
+    break;
+  case 640u:
+    Sint->pDigitRevTable = armDigitRevIndexTable640;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE_640_TABLE_LENGTH;
+    break;
+  case 480u:
+    Sint->pDigitRevTable = armDigitRevIndexTable480;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE_480_TABLE_LENGTH;
+    break;
+  case 384u:
+    Sint->pDigitRevTable = armDigitRevIndexTable384;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE_384_TABLE_LENGTH;
+    break;
+  case 320u:
+    Sint->pDigitRevTable = armDigitRevIndexTable320;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE_320_TABLE_LENGTH;
+    break;
+  case 240u:
+    Sint->pDigitRevTable = armDigitRevIndexTable240;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE_240_TABLE_LENGTH;
+    break;
+  case 192u:
+    Sint->pDigitRevTable = armDigitRevIndexTable192;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE_192_TABLE_LENGTH;
+    break;
+  case 160u:
+    Sint->pDigitRevTable = armDigitRevIndexTable160;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE_160_TABLE_LENGTH;
+    break;
+  case 120u:
+    Sint->pDigitRevTable = armDigitRevIndexTable120;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE_120_TABLE_LENGTH;
+    break;
+  case 96u:
+    Sint->pDigitRevTable = armDigitRevIndexTable96;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE__96_TABLE_LENGTH;
+    break;
+  case 80u:
+    Sint->pDigitRevTable = armDigitRevIndexTable80;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE__80_TABLE_LENGTH;
+    break;
+  case 60u:
+    Sint->pDigitRevTable = armDigitRevIndexTable60;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE__60_TABLE_LENGTH;
+    break;
+  case 48u:
+    Sint->pDigitRevTable = armDigitRevIndexTable48;
+    Sint->digitRevLength = ARMDIGITREVINDEXTABLE__48_TABLE_LENGTH;
+    break;
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  All the lengths share the twiddle factor table of 3840 points */
+  Sint->pTwiddle = twiddleCoef_3840;
+  Sint->twidCoefModifier = (uint16_t) (3840u / Sint->fftLen);
+  S->pTwiddleRFFT = twiddleCoef_3840;
+  S->twidCoefRModifier = (uint16_t) (3840u / fftLen);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**   
+ * @} end of RealFFT group   
+ */
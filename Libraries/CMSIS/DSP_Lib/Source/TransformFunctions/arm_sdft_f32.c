@@ -0,0 +1,240 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_sdft_f32.c    
+*    
+* Description:  Floating-point sliding DFT.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup SDFT    
+ * @{    
+ */
+
+/**    
+ * @brief  Processing function for the floating-point sliding DFT.    
+ * @param[in,out] *S points to an instance of the floating-point sliding DFT structure.    
+ * @param[in]     *pSrc points to the block of input samples.    
+ * @param[out]    *pDst points to the complex DFT values of the bins after the last sample, <code>2*numBins</code>    
+ *                values in the order of <code>pBins</code>, or NULL.    
+ * @param[in]     blockSize number of samples to process.    
+ * @return none.    
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pC;                                 /* Coefficients of the current bins */
+  float32_t *pR;                                 /* States of the current bins */
+  float32_t *pIn = pSrc;                         /* Input pointer */
+  float32_t *pOld;                               /* Samples leaving the window */
+  float32_t combCoeff = S->combCoeff;            /* damping^frameLen */
+  float32_t d, t;                                /* Comb filter output and temporary */
+  float32_t c1r, c1i, r1r, r1i;                  /* Coefficients and state of the first bin */
+  uint32_t frameLen = S->frameLen;               /* Length of the window */
+  uint32_t delayIndex = S->delayIndex;           /* Position of the oldest sample */
+  uint32_t sampLeft = blockSize;                 /* Samples left in the block */
+  uint32_t cnt;                                  /* Samples in the current run */
+  uint32_t binCnt, j;                            /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t c2r, c2i, c3r, c3i, c4r, c4i;        /* Coefficients of the other bins */
+  float32_t r2r, r2i, r3r, r3i, r4r, r4i;        /* States of the other bins */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(sampLeft > 0u)
+  {
+    /* Run of samples up to the end of the delay line, so that the old samples are contiguous */
+    cnt = frameLen - delayIndex;
+    cnt = (cnt < sampLeft) ? cnt : sampLeft;
+
+    pOld = S->pDelay + delayIndex;
+    pC = S->pCoeffs;
+    pR = S->pState;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Four bins at a time, with their states in registers */
+    binCnt = (uint32_t) S->numBins >> 2u;
+
+    while(binCnt > 0u)
+    {
+      c1r = pC[0];
+      c1i = pC[1];
+      c2r = pC[4];
+      c2i = pC[5];
+      c3r = pC[8];
+      c3i = pC[9];
+      c4r = pC[12];
+      c4i = pC[13];
+
+      r1r = pR[0];
+      r1i = pR[1];
+      r2r = pR[2];
+      r2i = pR[3];
+      r3r = pR[4];
+      r3i = pR[5];
+      r4r = pR[6];
+      r4i = pR[7];
+
+      for (j = 0u; j < cnt; j++)
+      {
+        /* Comb filter, shared by the four bins */
+        d = pIn[j] - (combCoeff * pOld[j]);
+
+        /* R = r*exp(j*w)*R + d */
+        t = ((c1r * r1r) - (c1i * r1i)) + d;
+        r1i = (c1r * r1i) + (c1i * r1r);
+        r1r = t;
+        t = ((c2r * r2r) - (c2i * r2i)) + d;
+        r2i = (c2r * r2i) + (c2i * r2r);
+        r2r = t;
+        t = ((c3r * r3r) - (c3i * r3i)) + d;
+        r3i = (c3r * r3i) + (c3i * r3r);
+        r3r = t;
+        t = ((c4r * r4r) - (c4i * r4i)) + d;
+        r4i = (c4r * r4i) + (c4i * r4r);
+        r4r = t;
+      }
+
+      pR[0] = r1r;
+      pR[1] = r1i;
+      pR[2] = r2r;
+      pR[3] = r2i;
+      pR[4] = r3r;
+      pR[5] = r3i;
+      pR[6] = r4r;
+      pR[7] = r4i;
+
+      /* update pointers to process next bins */
+      pC += 16u;
+      pR += 8u;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    /* If the number of bins is not a multiple of 4, compute the remaining bins here.
+     ** No loop unrolling is used. */
+    binCnt = (uint32_t) S->numBins % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over all bins */
+    binCnt = (uint32_t) S->numBins;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(binCnt > 0u)
+    {
+      c1r = pC[0];
+      c1i = pC[1];
+      r1r = pR[0];
+      r1i = pR[1];
+
+      for (j = 0u; j < cnt; j++)
+      {
+        d = pIn[j] - (combCoeff * pOld[j]);
+
+        t = ((c1r * r1r) - (c1i * r1i)) + d;
+        r1i = (c1r * r1i) + (c1i * r1r);
+        r1r = t;
+      }
+
+      pR[0] = r1r;
+      pR[1] = r1i;
+
+      /* update pointers to process next bin */
+      pC += 4u;
+      pR += 2u;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    /* The new samples replace the old ones in the delay line */
+    arm_copy_f32(pIn, pOld, cnt);
+
+    delayIndex += cnt;
+
+    if(delayIndex == frameLen)
+    {
+      delayIndex = 0u;
+    }
+
+    /* update pointers to process next run */
+    pIn += cnt;
+    sampLeft -= cnt;
+  }
+
+  S->delayIndex = (uint16_t) delayIndex;
+
+  if(pDst != NULL)
+  {
+    pC = S->pCoeffs;
+    pR = S->pState;
+
+    for (binCnt = S->numBins; binCnt > 0u; binCnt--)
+    {
+      /* X = exp(j*w)*R */
+      pDst[0] = (pC[2] * pR[0]) - (pC[3] * pR[1]);
+      pDst[1] = (pC[2] * pR[1]) + (pC[3] * pR[0]);
+
+      pC += 4u;
+      pR += 2u;
+      pDst += 2u;
+    }
+  }
+}
+
+/**    
+ * @} end of SDFT group    
+ */
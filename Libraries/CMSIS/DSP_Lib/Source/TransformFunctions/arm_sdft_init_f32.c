@@ -0,0 +1,187 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_sdft_init_f32.c    
+*    
+* Description:  Floating-point sliding DFT initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @defgroup SDFT Sliding DFT    
+ *    
+ * Updates selected bins of the DFT of the last <code>N = frameLen</code> input samples after every sample,    
+ * <pre>    
+ *     X[k] = sum(x[n-N+1+i] * exp(-j*2*pi*k*i/N)),   i = 0, 1, ..., N-1    
+ * </pre>    
+ * for the bin indices <code>k</code> listed in <code>pBins</code>.  Where the Goertzel bank computes the bins    
+ * once per frame, the sliding DFT follows them sample by sample, for detectors that need the onset of a    
+ * tone to a sample or overlapping frames.    
+ *    
+ * \par Algorithm    
+ * Each bin is a complex first order resonator fed by a comb filter, with the damping factor <code>r</code>:    
+ * <pre>    
+ *     R[n] = r*exp(j*w)*R[n-1] + x[n] - r^N*x[n-N],    w = 2*pi*k/N    
+ *     X[k] = exp(j*w)*R[n]    
+ * </pre>    
+ * at the cost of one complex multiplication per bin and sample, whatever the window length.  With    
+ * <code>r = 1</code> the result is the DFT of the window above; a damping factor just below 1, such as    
+ * <code>1 - 1/(16*N)</code>, keeps the rounding errors from accumulating forever, and weights the sample    
+ * <code>i</code> of the window by <code>r^(N-1-i)</code>.    
+ * \par    
+ * The block is processed in runs of samples whose old samples are contiguous in the delay line.  The    
+ * resonators of several bins run together over each run with their states in registers, four bins in the    
+ * floating-point version and two in the fixed-point versions, and the comb filter output is shared by them.    
+ *    
+ * \par Delay line and state    
+ * The delay line holds the last <code>N</code> input samples and the state the resonators of all bins.  Both    
+ * are cleared by the initialization function.  The DFT values are written, if <code>pDst</code> is not NULL,    
+ * after the last sample of the block; a block of one sample gives them after every sample.    
+ *    
+ * \par Fixed-Point Behavior    
+ * The fixed-point versions hold the states and the DFT values divided by <code>2^shift</code>, the smallest power    
+ * of 2 not below <code>N</code> and 4, so that they cannot overflow.  The states are 32-bit, the products 64-bit and    
+ * each update is rounded once; the Q15 version keeps Q31 states and coefficients and a Q15 delay line.    
+ */
+
+/**    
+ * @addtogroup SDFT    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point sliding DFT.    
+ * @param[out] *S points to an instance of the floating-point sliding DFT structure.    
+ * @param[in]  numBins number of bins.    
+ * @param[in]  frameLen length of the sliding window, in samples.    
+ * @param[in]  *pBins points to the bin indices, <code>numBins</code> values below <code>frameLen</code>.    
+ * @param[in]  damping damping factor of the resonators, in (0 1].    
+ * @param[out] *pCoeffs points to the coefficient buffer of <code>4*numBins</code> values.    
+ * @param[in]  *pState points to the state buffer of <code>2*numBins</code> values.    
+ * @param[in]  *pDelay points to the delay line of <code>frameLen</code> samples.    
+ * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if    
+ * <code>numBins</code> or <code>frameLen</code> is zero, a bin index is not below <code>frameLen</code>    
+ * or <code>damping</code> is out of range.    
+ *    
+ * \par    
+ * The coefficients of each bin are <code>{r*cos(w), r*sin(w), cos(w), sin(w)}</code>.    
+ */
+
+arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const uint16_t * pBins,
+  float32_t damping,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pDelay)
+{
+  arm_nco_instance_f32 nco;                      /* Oscillator for the coefficients */
+  uint32_t phase;                                /* Phase of a bin frequency, 2^32 steps per turn */
+  float32_t sinVal, cosVal;                      /* sin(w) and cos(w) */
+  float32_t power;                               /* damping^(2^m) */
+  uint32_t n;                                    /* Remaining exponent */
+  uint32_t i;                                    /* loop counter */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  if((numBins == 0u) || (frameLen == 0u) || !(damping > 0.0f) || (damping > 1.0f))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0u; (i < numBins) && (status == ARM_MATH_SUCCESS); i++)
+  {
+    if(pBins[i] >= frameLen)
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    for (i = 0u; i < numBins; i++)
+    {
+      /* Phase of w = 2*pi*k/frameLen */
+      phase = (uint32_t) ((((uint64_t) pBins[i] << 32) + (frameLen >> 1u)) / frameLen);
+
+      arm_nco_init_f32(&nco, 0u, phase, 0u);
+      arm_nco_f32(&nco, NULL, NULL, &sinVal, &cosVal, 1u);
+
+      pCoeffs[4u * i] = damping * cosVal;
+      pCoeffs[(4u * i) + 1u] = damping * sinVal;
+      pCoeffs[(4u * i) + 2u] = cosVal;
+      pCoeffs[(4u * i) + 3u] = sinVal;
+    }
+
+    /* Coefficient of the comb filter, damping^frameLen by repeated squaring */
+    S->combCoeff = 1.0f;
+    power = damping;
+    n = frameLen;
+
+    while(n > 0u)
+    {
+      if((n & 1u) != 0u)
+      {
+        S->combCoeff *= power;
+      }
+
+      power *= power;
+      n >>= 1u;
+    }
+
+    /* Assign the coefficients and clear the state and the delay line */
+    S->numBins = numBins;
+    S->frameLen = frameLen;
+    S->delayIndex = 0u;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->pDelay = pDelay;
+
+    arm_fill_f32(0.0f, pState, 2u * numBins);
+    arm_fill_f32(0.0f, pDelay, frameLen);
+  }
+
+  return (status);
+}
+
+/**    
+ * @} end of SDFT group    
+ */
@@ -0,0 +1,160 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_sdft_init_q31.c    
+*    
+* Description:  Q31 sliding DFT initialization function.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup SDFT    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q31 sliding DFT.    
+ * @param[out] *S points to an instance of the Q31 sliding DFT structure.    
+ * @param[in]  numBins number of bins.    
+ * @param[in]  frameLen length of the sliding window, in samples.    
+ * @param[in]  *pBins points to the bin indices, <code>numBins</code> values below <code>frameLen</code>.    
+ * @param[in]  damping damping factor of the resonators, in (0 1], in 1.31 format.    
+ * @param[out] *pCoeffs points to the coefficient buffer of <code>4*numBins</code> values.    
+ * @param[in]  *pState points to the state buffer of <code>2*numBins</code> values.    
+ * @param[in]  *pDelay points to the delay line of <code>frameLen</code> samples.    
+ * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if    
+ * <code>numBins</code> or <code>frameLen</code> is zero, a bin index is not below <code>frameLen</code>    
+ * or <code>damping</code> is out of range.    
+ *    
+ * \par    
+ * The coefficients of each bin are <code>{r*cos(w), r*sin(w), cos(w), sin(w)}</code> in 1.31 format.    
+ */
+
+arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const uint16_t * pBins,
+  q31_t damping,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pDelay)
+{
+  arm_nco_instance_q31 nco;                      /* Oscillator for the coefficients */
+  uint32_t phase;                                /* Phase of a bin frequency, 2^32 steps per turn */
+  q31_t sinVal, cosVal;                          /* sin(w) and cos(w) */
+  q31_t power;                                   /* damping^(2^m) */
+  uint32_t n;                                    /* Remaining exponent */
+  uint32_t shift;                                /* log2 of the output scaling */
+  uint32_t i;                                    /* loop counter */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  if((numBins == 0u) || (frameLen == 0u) || (damping <= 0))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0u; (i < numBins) && (status == ARM_MATH_SUCCESS); i++)
+  {
+    if(pBins[i] >= frameLen)
+    {
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    for (i = 0u; i < numBins; i++)
+    {
+      /* Phase of w = 2*pi*k/frameLen */
+      phase = (uint32_t) ((((uint64_t) pBins[i] << 32) + (frameLen >> 1u)) / frameLen);
+
+      arm_nco_init_q31(&nco, 0u, phase, 0u);
+      arm_nco_q31(&nco, NULL, NULL, &sinVal, &cosVal, 1u);
+
+      pCoeffs[4u * i] = (q31_t) ((((q63_t) damping * cosVal) + 0x40000000) >> 31);
+      pCoeffs[(4u * i) + 1u] = (q31_t) ((((q63_t) damping * sinVal) + 0x40000000) >> 31);
+      pCoeffs[(4u * i) + 2u] = cosVal;
+      pCoeffs[(4u * i) + 3u] = sinVal;
+    }
+
+    /* Coefficient of the comb filter, damping^frameLen by repeated squaring */
+    S->combCoeff = 0x7FFFFFFF;
+    power = damping;
+    n = frameLen;
+
+    while(n > 0u)
+    {
+      if((n & 1u) != 0u)
+      {
+        S->combCoeff = (q31_t) ((((q63_t) S->combCoeff * power) + 0x40000000) >> 31);
+      }
+
+      power = (q31_t) ((((q63_t) power * power) + 0x40000000) >> 31);
+      n >>= 1u;
+    }
+
+    /* Output scaling, at least 4 so that the comb filter output adds to the rotated state without overflow */
+    shift = 2u;
+
+    while((1u << shift) < frameLen)
+    {
+      shift++;
+    }
+
+    /* Assign the coefficients and clear the state and the delay line */
+    S->numBins = numBins;
+    S->frameLen = frameLen;
+    S->delayIndex = 0u;
+    S->shift = (uint8_t) shift;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->pDelay = pDelay;
+
+    arm_fill_q31(0, pState, 2u * numBins);
+    arm_fill_q31(0, pDelay, frameLen);
+  }
+
+  return (status);
+}
+
+/**    
+ * @} end of SDFT group    
+ */
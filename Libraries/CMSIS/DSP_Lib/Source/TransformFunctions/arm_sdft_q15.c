@@ -0,0 +1,231 @@
+/*-----------------------------------------------------------------------------    
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.    
+*    
+* $Date:        17. January 2013
+* $Revision: 	V1.4.1
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:        arm_sdft_q15.c    
+*    
+* Description:  Q15 sliding DFT.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* ---------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup SDFT    
+ * @{    
+ */
+
+/**    
+ * @brief  Processing function for the Q15 sliding DFT.    
+ * @param[in,out] *S points to an instance of the Q15 sliding DFT structure.    
+ * @param[in]     *pSrc points to the block of input samples.    
+ * @param[out]    *pDst points to the complex DFT values of the bins after the last sample, <code>2*numBins</code>    
+ *                values in the order of <code>pBins</code>, or NULL.    
+ * @param[in]     blockSize number of samples to process.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The states and the DFT values are divided by <code>2^shift</code>, the smallest power of 2 not below    
+ * <code>frameLen</code> and 4.  The states are held in 1.31 format and the DFT values are written in 1.15 format.    
+ * The input is extended to 1.31 format, the comb filter output is kept in 2.62 format and    
+ * each update of a state is rounded once from its 64-bit accumulator, and saturated.    
+ */
+
+void arm_sdft_q15(
+  arm_sdft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pC;                                     /* Coefficients of the current bins */
+  q31_t *pR;                                     /* States of the current bins */
+  q15_t *pIn = pSrc;                             /* Input pointer */
+  q15_t *pOld;                                   /* Samples leaving the window */
+  q31_t combCoeff = S->combCoeff;                /* damping^frameLen */
+  q63_t d, acc;                                  /* Comb filter output and accumulator */
+  q31_t c1r, c1i, r1r, r1i;                      /* Coefficients and state of the first bin */
+  uint32_t shift = S->shift;                     /* log2 of the output scaling */
+  uint32_t frameLen = S->frameLen;               /* Length of the window */
+  uint32_t delayIndex = S->delayIndex;           /* Position of the oldest sample */
+  uint32_t sampLeft = blockSize;                 /* Samples left in the block */
+  uint32_t cnt;                                  /* Samples in the current run */
+  uint32_t binCnt, j;                            /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t c2r, c2i, r2r, r2i;                      /* Coefficients and state of the second bin */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(sampLeft > 0u)
+  {
+    /* Run of samples up to the end of the delay line, so that the old samples are contiguous */
+    cnt = frameLen - delayIndex;
+    cnt = (cnt < sampLeft) ? cnt : sampLeft;
+
+    pOld = S->pDelay + delayIndex;
+    pC = S->pCoeffs;
+    pR = S->pState;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Two bins at a time, with their states in registers */
+    binCnt = (uint32_t) S->numBins >> 1u;
+
+    while(binCnt > 0u)
+    {
+      c1r = pC[0];
+      c1i = pC[1];
+      c2r = pC[4];
+      c2i = pC[5];
+
+      r1r = pR[0];
+      r1i = pR[1];
+      r2r = pR[2];
+      r2i = pR[3];
+
+      for (j = 0u; j < cnt; j++)
+      {
+        /* Comb filter in 2.62 format divided by 2^shift, shared by the two bins */
+        d = (((q63_t) pIn[j] << 47) - (((q63_t) combCoeff * pOld[j]) << 16)) >> shift;
+
+        /* R = r*exp(j*w)*R + d, rounded once */
+        acc = (((q63_t) c1r * r1r) - ((q63_t) c1i * r1i)) + d;
+        r1i = clip_q63_to_q31(((((q63_t) c1r * r1i) + ((q63_t) c1i * r1r)) + 0x40000000) >> 31);
+        r1r = clip_q63_to_q31((acc + 0x40000000) >> 31);
+
+        acc = (((q63_t) c2r * r2r) - ((q63_t) c2i * r2i)) + d;
+        r2i = clip_q63_to_q31(((((q63_t) c2r * r2i) + ((q63_t) c2i * r2r)) + 0x40000000) >> 31);
+        r2r = clip_q63_to_q31((acc + 0x40000000) >> 31);
+      }
+
+      pR[0] = r1r;
+      pR[1] = r1i;
+      pR[2] = r2r;
+      pR[3] = r2i;
+
+      /* update pointers to process next bins */
+      pC += 8u;
+      pR += 4u;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    /* If the number of bins is odd, compute the last bin here. */
+    binCnt = (uint32_t) S->numBins % 0x2u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over all bins */
+    binCnt = (uint32_t) S->numBins;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(binCnt > 0u)
+    {
+      c1r = pC[0];
+      c1i = pC[1];
+      r1r = pR[0];
+      r1i = pR[1];
+
+      for (j = 0u; j < cnt; j++)
+      {
+        d = (((q63_t) pIn[j] << 47) - (((q63_t) combCoeff * pOld[j]) << 16)) >> shift;
+
+        acc = (((q63_t) c1r * r1r) - ((q63_t) c1i * r1i)) + d;
+        r1i = clip_q63_to_q31(((((q63_t) c1r * r1i) + ((q63_t) c1i * r1r)) + 0x40000000) >> 31);
+        r1r = clip_q63_to_q31((acc + 0x40000000) >> 31);
+      }
+
+      pR[0] = r1r;
+      pR[1] = r1i;
+
+      /* update pointers to process next bin */
+      pC += 4u;
+      pR += 2u;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    /* The new samples replace the old ones in the delay line */
+    arm_copy_q15(pIn, pOld, cnt);
+
+    delayIndex += cnt;
+
+    if(delayIndex == frameLen)
+    {
+      delayIndex = 0u;
+    }
+
+    /* update pointers to process next run */
+    pIn += cnt;
+    sampLeft -= cnt;
+  }
+
+  S->delayIndex = (uint16_t) delayIndex;
+
+  if(pDst != NULL)
+  {
+    pC = S->pCoeffs;
+    pR = S->pState;
+
+    for (binCnt = S->numBins; binCnt > 0u; binCnt--)
+    {
+      /* X = exp(j*w)*R */
+      acc = ((q63_t) pC[2] * pR[0]) - ((q63_t) pC[3] * pR[1]);
+      pDst[0] = (q15_t) __SSAT((q31_t) ((acc + ((q63_t) 1 << 46)) >> 47), 16);
+      acc = ((q63_t) pC[2] * pR[1]) + ((q63_t) pC[3] * pR[0]);
+      pDst[1] = (q15_t) __SSAT((q31_t) ((acc + ((q63_t) 1 << 46)) >> 47), 16);
+
+      pC += 4u;
+      pR += 2u;
+      pDst += 2u;
+    }
+  }
+}
+
+/**    
+ * @} end of SDFT group    
+ */
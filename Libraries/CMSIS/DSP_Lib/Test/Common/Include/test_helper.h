@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        test_helper.h
+*
+* Description:  Support functions of the host accuracy tests and benchmarks.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Each program of DSP_Lib/Test checks a group of kernels against references
+ * computed in double precision, then measures them when run with the "bench"
+ * argument:
+ *
+ *   int main(int argc, char **argv)
+ *   {
+ *     test_begin("arm_xxx_test", argc, argv);
+ *     ...test_check_snr("arm_xxx_f32", test_snr_f32(ref, out, n), 120.0);
+ *     if (test_bench_enabled())
+ *     {
+ *       ...TEST_BENCH("arm_xxx_f32", n, arm_xxx_f32(...));
+ *     }
+ *     return test_end();
+ *   }
+ *
+ * The SNR is 10*log10(sum(ref^2) / sum((ref - out)^2)) in dB.  The fixed-point
+ * outputs are read as fractions (q31 / 2^31, q15 / 2^15): the reference must be
+ * scaled as the kernel scales its output.  The times are host times, in ns per
+ * sample (or per the unit given to TEST_BENCH()), to compare the kernels with
+ * each other and to see how they scale, not as Cortex-M figures.
+ */
+
+#ifndef TEST_HELPER_H
+#define TEST_HELPER_H
+
+#include "arm_math.h"
+
+/* Minimum duration of one measure of TEST_BENCH(), in ns */
+#define TEST_BENCH_NS     20000000u
+
+/* Checks a condition, prints it with its line if it fails */
+#define TEST_CHECK(expr)  test_check((expr) != 0, #expr, __FILE__, __LINE__)
+
+/* Runs 'stmt' for at least TEST_BENCH_NS, prints the time per unit; 'nbr' is
+   the number of units (samples, ...) processed by one run of 'stmt' */
+#define TEST_BENCH(name, nbr, stmt)                                   \
+  do                                                                  \
+  {                                                                   \
+    uint64_t bench_start = test_time_ns();                            \
+    uint64_t bench_runs  = 0;                                         \
+    do                                                                \
+    {                                                                 \
+      stmt;                                                           \
+      bench_runs++;                                                   \
+    } while ((test_time_ns() - bench_start) < TEST_BENCH_NS);         \
+    test_bench_print((name), (uint64_t)(nbr) * bench_runs,            \
+                     test_time_ns() - bench_start);                   \
+  } while (0)
+
+void     test_begin(const char *name, int argc, char **argv);
+int      test_end(void);
+int      test_bench_enabled(void);
+
+void     test_check(int ok, const char *expr, const char *file, int line);
+void     test_check_snr(const char *name, double snr, double snrMin);
+
+uint64_t test_time_ns(void);
+void     test_bench_print(const char *name, uint64_t nbr, uint64_t ns);
+
+void     test_seed(uint32_t seed);
+void     test_rand_f64(double *pDst, uint32_t n, double amplitude);
+
+void     test_f64_to_f32(const double *pSrc, float32_t *pDst, uint32_t n);
+void     test_f64_to_q31(const double *pSrc, q31_t *pDst, uint32_t n);
+void     test_f64_to_q15(const double *pSrc, q15_t *pDst, uint32_t n);
+
+double   test_snr_f32(const double *pRef, const float32_t *pTest, uint32_t n);
+double   test_snr_q31(const double *pRef, const q31_t *pTest, uint32_t n);
+double   test_snr_q15(const double *pRef, const q15_t *pTest, uint32_t n);
+double   test_snr_f64(const double *pRef, const float64_t *pTest, uint32_t n);
+
+double   test_max_err_f32(const double *pRef, const float32_t *pTest, uint32_t n);
+
+void     test_dft_f64(const double *pSrc, double *pDst, uint32_t n, uint8_t ifftFlag);
+
+#endif /* TEST_HELPER_H */
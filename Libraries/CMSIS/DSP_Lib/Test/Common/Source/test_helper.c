@@ -0,0 +1,318 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        test_helper.c
+*
+* Description:  Support functions of the host accuracy tests and benchmarks.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "test_helper.h"
+
+static const char *testName;
+static int         testBench;
+static uint32_t    testChecks;
+static uint32_t    testFailed;
+static uint32_t    testRand = 1u;
+
+/**
+ * @brief  Starts a program: 'name' prefixes its report, a "bench" argument
+ *         enables the benchmarks.
+ */
+void test_begin(const char *name, int argc, char **argv)
+{
+  testName   = name;
+  testBench  = (argc > 1) && (strcmp(argv[1], "bench") == 0);
+  testChecks = 0u;
+  testFailed = 0u;
+  printf("%s:\n", name);
+}
+
+/**
+ * @brief  Prints the result of the checks.
+ * @return exit status of the program: 0 if all the checks passed, 1 otherwise
+ */
+int test_end(void)
+{
+  if (testFailed != 0u)
+  {
+    printf("%s: FAILED, %u of %u checks\n", testName, (unsigned)testFailed, (unsigned)testChecks);
+    return (1);
+  }
+  printf("%s: passed, %u checks\n", testName, (unsigned)testChecks);
+  return (0);
+}
+
+int test_bench_enabled(void)
+{
+  return (testBench);
+}
+
+void test_check(int ok, const char *expr, const char *file, int line)
+{
+  testChecks++;
+  if (!ok)
+  {
+    testFailed++;
+    printf("%s:%d: check failed: %s\n", file, line, expr);
+  }
+}
+
+/**
+ * @brief  Prints the SNR of a kernel, fails if it is below 'snrMin' (dB).
+ */
+void test_check_snr(const char *name, double snr, double snrMin)
+{
+  testChecks++;
+  if (!(snr >= snrMin))                         /* Also catches a NaN */
+  {
+    testFailed++;
+    printf("  %-48s %7.1f dB  < %5.1f  FAILED\n", name, snr, snrMin);
+  }
+  else
+  {
+    printf("  %-48s %7.1f dB\n", name, snr);
+  }
+}
+
+uint64_t test_time_ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+void test_bench_print(const char *name, uint64_t nbr, uint64_t ns)
+{
+  printf("  %-48s %10.2f ns\n", name, (nbr != 0u) ? (double)ns / (double)nbr : 0.0);
+}
+
+/**
+ * @brief  Restarts the pseudo-random sequence of test_rand_f64(), so that
+ *         the inputs are the same from one run to the next.
+ */
+void test_seed(uint32_t seed)
+{
+  testRand = seed;
+}
+
+/**
+ * @brief  Uniform pseudo-random values in [-amplitude, amplitude).
+ */
+void test_rand_f64(double *pDst, uint32_t n, double amplitude)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    testRand = testRand * 1664525u + 1013904223u;
+    pDst[i]  = amplitude * ((double)testRand / 2147483648.0 - 1.0);
+  }
+}
+
+void test_f64_to_f32(const double *pSrc, float32_t *pDst, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pDst[i] = (float32_t)pSrc[i];
+  }
+}
+
+/**
+ * @brief  Rounds fractions to q31 or q15, with saturation.
+ */
+void test_f64_to_q31(const double *pSrc, q31_t *pDst, uint32_t n)
+{
+  double   x;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    x = floor(pSrc[i] * 2147483648.0 + 0.5);
+    pDst[i] = (x >= 2147483647.0) ? 0x7FFFFFFF : (x <= -2147483648.0) ? (q31_t)0x80000000 : (q31_t)x;
+  }
+}
+
+void test_f64_to_q15(const double *pSrc, q15_t *pDst, uint32_t n)
+{
+  double   x;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    x = floor(pSrc[i] * 32768.0 + 0.5);
+    pDst[i] = (x >= 32767.0) ? 0x7FFF : (x <= -32768.0) ? (q15_t)0x8000 : (q15_t)x;
+  }
+}
+
+static double test_snr(double energySignal, double energyError)
+{
+  if (energyError == 0.0)
+  {
+    return (INFINITY);                          /* Exact */
+  }
+  return (10.0 * log10(energySignal / energyError));
+}
+
+/**
+ * @brief  SNR (dB) of 'pTest' against the double precision reference 'pRef'.
+ */
+double test_snr_f32(const double *pRef, const float32_t *pTest, uint32_t n)
+{
+  double   es = 0.0, ee = 0.0, d;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    d   = pRef[i] - (double)pTest[i];
+    es += pRef[i] * pRef[i];
+    ee += d * d;
+  }
+  return (test_snr(es, ee));
+}
+
+double test_snr_q31(const double *pRef, const q31_t *pTest, uint32_t n)
+{
+  double   es = 0.0, ee = 0.0, d;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    d   = pRef[i] - (double)pTest[i] / 2147483648.0;
+    es += pRef[i] * pRef[i];
+    ee += d * d;
+  }
+  return (test_snr(es, ee));
+}
+
+double test_snr_q15(const double *pRef, const q15_t *pTest, uint32_t n)
+{
+  double   es = 0.0, ee = 0.0, d;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    d   = pRef[i] - (double)pTest[i] / 32768.0;
+    es += pRef[i] * pRef[i];
+    ee += d * d;
+  }
+  return (test_snr(es, ee));
+}
+
+/**
+ * @brief  SNR of a double precision kernel: 'pRef' must be computed with more
+ *         precision (long double) and rounded, which bounds the SNR to about
+ *         300 dB.
+ */
+double test_snr_f64(const double *pRef, const float64_t *pTest, uint32_t n)
+{
+  double   es = 0.0, ee = 0.0, d;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    d   = pRef[i] - pTest[i];
+    es += pRef[i] * pRef[i];
+    ee += d * d;
+  }
+  return (test_snr(es, ee));
+}
+
+/**
+ * @brief  Largest absolute difference between 'pTest' and 'pRef'.
+ */
+double test_max_err_f32(const double *pRef, const float32_t *pTest, uint32_t n)
+{
+  double   err = 0.0, d;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    d = fabs(pRef[i] - (double)pTest[i]);
+    if (!(d <= err))                            /* Also propagates a NaN */
+    {
+      err = d;
+    }
+  }
+  return (err);
+}
+
+/**
+ * @brief  Direct DFT of 'n' interleaved complex values, in double precision.
+ *         The inverse (ifftFlag = 1) is scaled by 1/n, as arm_cfft_f32().
+ */
+void test_dft_f64(const double *pSrc, double *pDst, uint32_t n, uint8_t ifftFlag)
+{
+  double   *pCos, *pSin, re, im, sign, scale;
+  uint32_t  k, i, j;
+
+  pCos = (double *)malloc(2u * n * sizeof(double));
+  if (pCos == NULL)
+  {
+    return;
+  }
+  pSin  = pCos + n;
+  sign  = (ifftFlag != 0u) ? 1.0 : -1.0;
+  scale = (ifftFlag != 0u) ? 1.0 / (double)n : 1.0;
+  for (i = 0u; i < n; i++)
+  {
+    pCos[i] = cos(2.0 * PI * (double)i / (double)n);
+    pSin[i] = sign * sin(2.0 * PI * (double)i / (double)n);
+  }
+  for (k = 0u; k < n; k++)
+  {
+    re = im = 0.0;
+    j  = 0u;                                    /* (k * i) mod n */
+    for (i = 0u; i < n; i++)
+    {
+      re += pSrc[2 * i] * pCos[j] - pSrc[2 * i + 1] * pSin[j];
+      im += pSrc[2 * i] * pSin[j] + pSrc[2 * i + 1] * pCos[j];
+      j  += k;
+      j   = (j >= n) ? j - n : j;
+    }
+    pDst[2 * k]     = re * scale;
+    pDst[2 * k + 1] = im * scale;
+  }
+  free(pCos);
+}
@@ -0,0 +1,288 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_batch_test.c
+*
+* Description:  Batch thread pool and batch kernels against the single channel kernels.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks that arm_batch_run() runs each job once for several pool sizes, and
+ * that the batch kernels give the same bits as the per-channel kernels run in
+ * sequence, over several blocks (the state carries over).  With "bench" it
+ * measures the batch kernels from 1 thread to one per online CPU: the time
+ * per sample of all the channels shows the scaling.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_CHANS          64u         /* Channels of the batch kernels */
+#define TEST_BLOCK         256u         /* Samples per channel and block */
+#define TEST_BLOCKS          3u         /* Blocks processed by the tests */
+#define TEST_TAPS           32u
+#define TEST_STAGES          4u
+#define TEST_FFT_LEN      1024u
+#define TEST_JOBS_MAX     1000u
+
+static const uint16_t testThreadsTbl[] = {1u, 2u, 3u, 8u, 0u};    /* 0: one per online CPU */
+
+static double    refIn[TEST_CHANS * TEST_FFT_LEN];
+static float32_t f32In[TEST_CHANS * TEST_FFT_LEN];
+static float32_t f32Tmp[TEST_CHANS * TEST_FFT_LEN];
+static float32_t f32Out[TEST_CHANS * TEST_FFT_LEN];
+static float32_t f32OutRef[TEST_CHANS * TEST_FFT_LEN];
+static q31_t     q31In[TEST_CHANS * TEST_BLOCK];
+static q31_t     q31Out[TEST_CHANS * TEST_BLOCK];
+static q31_t     q31OutRef[TEST_CHANS * TEST_BLOCK];
+
+static float32_t firCoeffs[TEST_TAPS];
+static float32_t firState[2][TEST_CHANS][TEST_TAPS + TEST_BLOCK - 1];
+static float32_t firIlvState[2][(TEST_TAPS + TEST_BLOCK - 1) * TEST_CHANS];
+static q31_t     iirCoeffs[5 * TEST_STAGES];
+static q31_t     iirState[2][TEST_CHANS][4 * TEST_STAGES];
+
+static arm_fir_instance_f32          firInst[2][TEST_CHANS];
+static arm_biquad_casd_df1_inst_q31  iirInst[2][TEST_CHANS];
+static arm_rfft_fast_instance_f32    rfftInst[TEST_CHANS];
+static float32_t                    *pSrcTbl[TEST_CHANS];
+static float32_t                    *pDstTbl[TEST_CHANS];
+static q31_t                        *pSrcTblQ31[TEST_CHANS];
+static q31_t                        *pDstTblQ31[TEST_CHANS];
+
+static uint32_t  testJobRuns[TEST_JOBS_MAX];
+
+static void test_job(void *pCtx, uint32_t job)
+{
+  (void)pCtx;
+  testJobRuns[job]++;                           /* Each job has its own counter */
+}
+
+/* Stable low-pass sections in Q31 with postShift 1, the same for each channel */
+static void iir_design(void)
+{
+  double   coeffs[5 * TEST_STAGES], w, alpha, a0;
+  uint32_t s;
+
+  for (s = 0u; s < TEST_STAGES; s++)
+  {
+    w     = 2.0 * PI * (0.05 + 0.05 * s);
+    alpha = sin(w) / (2.0 * 0.707);
+    a0    = 1.0 + alpha;
+    coeffs[5 * s]     = (1.0 - cos(w)) / 4.0 / a0;
+    coeffs[5 * s + 1] = (1.0 - cos(w)) / 2.0 / a0;
+    coeffs[5 * s + 2] = coeffs[5 * s];
+    coeffs[5 * s + 3] = cos(w) / a0;
+    coeffs[5 * s + 4] = -(1.0 - alpha) / 2.0 / a0;
+  }
+  test_f64_to_q31(coeffs, iirCoeffs, 5u * TEST_STAGES);
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+static void test_pool(void)
+{
+  static const uint32_t jobsTbl[] = {0u, 1u, 7u, TEST_JOBS_MAX};
+  arm_batch_instance    b;
+  uint32_t              it, ij, i, bad = 0u;
+
+  for (it = 0u; it < sizeof(testThreadsTbl) / sizeof(testThreadsTbl[0]); it++)
+  {
+    TEST_CHECK(arm_batch_init(&b, testThreadsTbl[it]) == ARM_MATH_SUCCESS);
+    TEST_CHECK(b.numThreads >= 1u);
+    for (ij = 0u; ij < sizeof(jobsTbl) / sizeof(jobsTbl[0]); ij++)
+    {
+      memset(testJobRuns, 0, sizeof(testJobRuns));
+      arm_batch_run(&b, test_job, NULL, jobsTbl[ij]);
+      for (i = 0u; i < TEST_JOBS_MAX; i++)
+      {
+        bad += (testJobRuns[i] != ((i < jobsTbl[ij]) ? 1u : 0u)) ? 1u : 0u;
+      }
+    }
+    arm_batch_deinit(&b);
+  }
+  TEST_CHECK(bad == 0u);
+}
+
+static void test_kernels(uint16_t numThreads)
+{
+  arm_batch_instance               b;
+  arm_fir_interleaved_instance_f32 ilv, ilvRef;
+  uint32_t                         blk, c, diffs = 0u;
+  char                             name[64];
+
+  TEST_CHECK(arm_batch_init(&b, numThreads) == ARM_MATH_SUCCESS);
+
+  for (c = 0u; c < TEST_CHANS; c++)             /* FIR, one instance per channel */
+  {
+    arm_fir_init_f32(&firInst[0][c], TEST_TAPS, firCoeffs, firState[0][c], TEST_BLOCK);
+    arm_fir_init_f32(&firInst[1][c], TEST_TAPS, firCoeffs, firState[1][c], TEST_BLOCK);
+    arm_biquad_cascade_df1_init_q31(&iirInst[0][c], TEST_STAGES, iirCoeffs, iirState[0][c], 1);
+    arm_biquad_cascade_df1_init_q31(&iirInst[1][c], TEST_STAGES, iirCoeffs, iirState[1][c], 1);
+  }
+  for (blk = 0u; blk < TEST_BLOCKS; blk++)
+  {
+    for (c = 0u; c < TEST_CHANS; c++)
+    {
+      pSrcTbl[c]    = &f32In[(blk * TEST_CHANS + c) * TEST_BLOCK];
+      pDstTbl[c]    = &f32Out[c * TEST_BLOCK];
+      pSrcTblQ31[c] = &q31In[((blk * 7u + c) % TEST_CHANS) * TEST_BLOCK];
+      pDstTblQ31[c] = &q31Out[c * TEST_BLOCK];
+      arm_fir_f32(&firInst[1][c], pSrcTbl[c], &f32OutRef[c * TEST_BLOCK], TEST_BLOCK);
+      arm_biquad_cascade_df1_q31(&iirInst[1][c], pSrcTblQ31[c], &q31OutRef[c * TEST_BLOCK], TEST_BLOCK);
+    }
+    arm_fir_batch_f32(&b, firInst[0], pSrcTbl, pDstTbl, TEST_CHANS, TEST_BLOCK);
+    arm_biquad_cascade_df1_batch_q31(&b, iirInst[0], pSrcTblQ31, pDstTblQ31, TEST_CHANS, TEST_BLOCK);
+    diffs += (memcmp(f32Out, f32OutRef, TEST_CHANS * TEST_BLOCK * sizeof(float32_t)) != 0) ? 1u : 0u;
+    diffs += (memcmp(q31Out, q31OutRef, TEST_CHANS * TEST_BLOCK * sizeof(q31_t)) != 0) ? 1u : 0u;
+  }
+
+  arm_fir_interleaved_init_f32(&ilv, TEST_TAPS, TEST_CHANS, firCoeffs, firIlvState[0], TEST_BLOCK);
+  arm_fir_interleaved_init_f32(&ilvRef, TEST_TAPS, TEST_CHANS, firCoeffs, firIlvState[1], TEST_BLOCK);
+  for (blk = 0u; blk < TEST_BLOCKS; blk++)      /* Interleaved FIR, one instance for all channels */
+  {
+    arm_fir_interleaved_f32(&ilvRef, &f32In[blk * TEST_CHANS * TEST_BLOCK], f32OutRef, TEST_BLOCK);
+    arm_fir_interleaved_batch_f32(&b, &ilv, &f32In[blk * TEST_CHANS * TEST_BLOCK], f32Out, TEST_BLOCK);
+    diffs += (memcmp(f32Out, f32OutRef, TEST_CHANS * TEST_BLOCK * sizeof(float32_t)) != 0) ? 1u : 0u;
+  }
+
+  for (c = 0u; c < TEST_CHANS; c++)             /* Real FFT, forward then inverse */
+  {
+    TEST_CHECK(arm_rfft_fast_init_f32(&rfftInst[c], TEST_FFT_LEN) == ARM_MATH_SUCCESS);
+    pSrcTbl[c] = &f32Tmp[c * TEST_FFT_LEN];
+    pDstTbl[c] = &f32Out[c * TEST_FFT_LEN];
+  }
+  for (c = 0u; c <= 1u; c++)
+  {
+    uint32_t ch;
+
+    memcpy(f32Tmp, f32In, sizeof(f32Tmp));      /* The transforms modify their input */
+    for (ch = 0u; ch < TEST_CHANS; ch++)
+    {
+      arm_rfft_fast_f32(&rfftInst[ch], &f32Tmp[ch * TEST_FFT_LEN], &f32OutRef[ch * TEST_FFT_LEN], (uint8_t)c);
+    }
+    memcpy(f32Tmp, f32In, sizeof(f32Tmp));
+    arm_rfft_fast_batch_f32(&b, rfftInst, pSrcTbl, pDstTbl, (uint8_t)c, TEST_CHANS);
+    diffs += (memcmp(f32Out, f32OutRef, sizeof(f32Out)) != 0) ? 1u : 0u;
+  }
+  arm_batch_deinit(&b);
+
+  snprintf(name, sizeof(name), "batch kernels, %u threads", (unsigned)b.numThreads);
+  printf("  %-48s %s\n", name, (diffs == 0u) ? "bit-exact" : "differ  FAILED");
+  TEST_CHECK(diffs == 0u);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(uint16_t numThreads)
+{
+  arm_batch_instance               b;
+  arm_fir_interleaved_instance_f32 ilv;
+  uint32_t                         c;
+  char                             name[64];
+
+  (void)arm_batch_init(&b, numThreads);
+  for (c = 0u; c < TEST_CHANS; c++)
+  {
+    arm_fir_init_f32(&firInst[0][c], TEST_TAPS, firCoeffs, firState[0][c], TEST_BLOCK);
+    arm_biquad_cascade_df1_init_q31(&iirInst[0][c], TEST_STAGES, iirCoeffs, iirState[0][c], 1);
+    pSrcTbl[c]    = &f32In[c * TEST_BLOCK];
+    pDstTbl[c]    = &f32Out[c * TEST_BLOCK];
+    pSrcTblQ31[c] = &q31In[c * TEST_BLOCK];
+    pDstTblQ31[c] = &q31Out[c * TEST_BLOCK];
+  }
+  arm_fir_interleaved_init_f32(&ilv, TEST_TAPS, TEST_CHANS, firCoeffs, firIlvState[0], TEST_BLOCK);
+
+  snprintf(name, sizeof(name), "arm_fir_batch_f32, %u threads", (unsigned)b.numThreads);
+  TEST_BENCH(name, TEST_CHANS * TEST_BLOCK, arm_fir_batch_f32(&b, firInst[0], pSrcTbl, pDstTbl, TEST_CHANS, TEST_BLOCK));
+  snprintf(name, sizeof(name), "arm_biquad_cascade_df1_batch_q31, %u threads", (unsigned)b.numThreads);
+  TEST_BENCH(name, TEST_CHANS * TEST_BLOCK,
+             arm_biquad_cascade_df1_batch_q31(&b, iirInst[0], pSrcTblQ31, pDstTblQ31, TEST_CHANS, TEST_BLOCK));
+  snprintf(name, sizeof(name), "arm_fir_interleaved_batch_f32, %u threads", (unsigned)b.numThreads);
+  TEST_BENCH(name, TEST_CHANS * TEST_BLOCK, arm_fir_interleaved_batch_f32(&b, &ilv, f32In, f32Out, TEST_BLOCK));
+
+  for (c = 0u; c < TEST_CHANS; c++)             /* Forward + inverse, the data stays bounded */
+  {
+    (void)arm_rfft_fast_init_f32(&rfftInst[c], TEST_FFT_LEN);
+    pSrcTbl[c] = &f32In[c * TEST_FFT_LEN];
+    pDstTbl[c] = &f32Out[c * TEST_FFT_LEN];
+  }
+  snprintf(name, sizeof(name), "arm_rfft_fast_batch_f32, %u threads", (unsigned)b.numThreads);
+  TEST_BENCH(name, 2u * TEST_CHANS * TEST_FFT_LEN,
+             (arm_rfft_fast_batch_f32(&b, rfftInst, pSrcTbl, pDstTbl, 0u, TEST_CHANS),
+              arm_rfft_fast_batch_f32(&b, rfftInst, pDstTbl, pSrcTbl, 1u, TEST_CHANS)));
+  arm_batch_deinit(&b);
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t it;
+  long     numCpus;
+
+  test_begin("arm_batch_test", argc, argv);
+  test_seed(1u);
+  test_rand_f64(refIn, TEST_TAPS, 0.1);
+  test_f64_to_f32(refIn, firCoeffs, TEST_TAPS);
+  iir_design();
+  test_rand_f64(refIn, TEST_CHANS * TEST_FFT_LEN, 0.5);
+  test_f64_to_f32(refIn, f32In, TEST_CHANS * TEST_FFT_LEN);
+  test_f64_to_q31(refIn, q31In, TEST_CHANS * TEST_BLOCK);
+
+  test_pool();
+  for (it = 0u; it < sizeof(testThreadsTbl) / sizeof(testThreadsTbl[0]); it++)
+  {
+    test_kernels(testThreadsTbl[it]);
+  }
+  if (test_bench_enabled())
+  {
+    numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    printf("  %ld online CPUs\n", numCpus);
+    for (it = 1u; it < (uint32_t)numCpus; it *= 2u)
+    {
+      bench((uint16_t)it);
+    }
+    bench(0u);
+  }
+  return (test_end());
+}
@@ -0,0 +1,322 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_biquad_interleaved_test.c
+*
+* Description:  Interleaved multichannel biquad cascades against the single-channel functions.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks arm_biquad_cascade_df2T_interleaved_f32() and
+ * arm_biquad_cascade_df1_interleaved_q31/q15() against the single-channel
+ * functions run on each deinterleaved channel: every channel must be
+ * bit-exact, for 1 to 16 channels over consecutive blocks.  The outputs are
+ * also compared with a double precision cascade.  With "bench" it compares each
+ * interleaved function with what it replaces: deinterleave, the single-channel
+ * function per channel, reinterleave, per sample.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_STAGES          4u
+#define TEST_CHANS_MAX      16u
+#define TEST_FRAMES        256u         /* Frames of a block */
+#define TEST_BLOCKS          3u
+#define TEST_LEN_MAX        (TEST_CHANS_MAX * TEST_FRAMES * TEST_BLOCKS)
+
+static const uint16_t testChansTbl[] = {1u, 2u, 3u, 8u, 11u, 16u};
+
+static double    refCoeffs[5u * TEST_STAGES];   /* {b0, b1, b2, a1, a2}, feedback added */
+static double    refIn[TEST_LEN_MAX];
+static double    refOut[TEST_LEN_MAX];
+static float32_t coeffsF32[5u * TEST_STAGES];
+static q31_t     coeffsQ31[5u * TEST_STAGES];
+static q15_t     coeffsQ15[6u * TEST_STAGES];
+static float32_t stateF32[4u * TEST_STAGES * TEST_CHANS_MAX];
+static q31_t     stateQ31[4u * TEST_STAGES * TEST_CHANS_MAX];
+static q15_t     stateQ15[4u * TEST_STAGES * TEST_CHANS_MAX];
+static float32_t inF32[TEST_LEN_MAX], outF32[TEST_LEN_MAX], chanF32[TEST_LEN_MAX], refF32[TEST_LEN_MAX];
+static q31_t     inQ31[TEST_LEN_MAX], outQ31[TEST_LEN_MAX], chanQ31[TEST_LEN_MAX], refQ31[TEST_LEN_MAX];
+static q15_t     inQ15[TEST_LEN_MAX], outQ15[TEST_LEN_MAX], chanQ15[TEST_LEN_MAX], refQ15[TEST_LEN_MAX];
+
+/* Low-pass stages, poles of radius 0.5 to 0.8, unit gain at DC.  The fixed-point
+   coefficients are halved, with a postShift of 1. */
+static void biquad_design(void)
+{
+  double   r, theta, g;
+  uint32_t s;
+
+  for (s = 0u; s < TEST_STAGES; s++)
+  {
+    r     = 0.5 + 0.1 * (double)s;
+    theta = 0.2 + 0.3 * (double)s;
+    refCoeffs[5u * s + 3u] = 2.0 * r * cos(theta);
+    refCoeffs[5u * s + 4u] = -r * r;
+    g = (1.0 - refCoeffs[5u * s + 3u] - refCoeffs[5u * s + 4u]) / 4.0;
+    refCoeffs[5u * s]      = g;
+    refCoeffs[5u * s + 1u] = 2.0 * g;
+    refCoeffs[5u * s + 2u] = g;
+  }
+  for (s = 0u; s < 5u * TEST_STAGES; s++)
+  {
+    coeffsF32[s] = (float32_t)refCoeffs[s];
+    refCoeffs[s] = floor(refCoeffs[s] * 1073741824.0 + 0.5) / 1073741824.0;   /* q31 / 2 */
+    coeffsQ31[s] = (q31_t)(refCoeffs[s] * 1073741824.0);
+  }
+  for (s = 0u; s < TEST_STAGES; s++)            /* {b0, 0, b1, b2, a1, a2} */
+  {
+    coeffsQ15[6u * s]      = (q15_t)floor(refCoeffs[5u * s] * 16384.0 + 0.5);
+    coeffsQ15[6u * s + 1u] = 0;
+    coeffsQ15[6u * s + 2u] = (q15_t)floor(refCoeffs[5u * s + 1u] * 16384.0 + 0.5);
+    coeffsQ15[6u * s + 3u] = (q15_t)floor(refCoeffs[5u * s + 2u] * 16384.0 + 0.5);
+    coeffsQ15[6u * s + 4u] = (q15_t)floor(refCoeffs[5u * s + 3u] * 16384.0 + 0.5);
+    coeffsQ15[6u * s + 5u] = (q15_t)floor(refCoeffs[5u * s + 4u] * 16384.0 + 0.5);
+  }
+}
+
+/* Cascade in double precision, with the q31 coefficients, over 'n' frames of 'numChans' channels */
+static void ref_biquad(const double *pX, double *pY, uint32_t numChans, uint32_t n)
+{
+  double   x, y, x1, x2, y1, y2;
+  uint32_t c, s, i;
+
+  memcpy(pY, pX, n * numChans * sizeof(double));
+  for (c = 0u; c < numChans; c++)
+  {
+    for (s = 0u; s < TEST_STAGES; s++)
+    {
+      x1 = x2 = y1 = y2 = 0.0;
+      for (i = 0u; i < n; i++)
+      {
+        x  = pY[i * numChans + c];
+        y  = refCoeffs[5u * s] * x + refCoeffs[5u * s + 1u] * x1 + refCoeffs[5u * s + 2u] * x2 +
+             refCoeffs[5u * s + 3u] * y1 + refCoeffs[5u * s + 4u] * y2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        pY[i * numChans + c] = y;
+      }
+    }
+  }
+}
+
+/* Channel 'c' of 'n' frames, into or out of the interleaved buffer */
+#define TEST_DEINTERLEAVE(pSrc, pDst, c, numChans, n) \
+  for (i = 0u; i < (n); i++) { (pDst)[i] = (pSrc)[i * (numChans) + (c)]; }
+#define TEST_INTERLEAVE(pSrc, pDst, c, numChans, n) \
+  for (i = 0u; i < (n); i++) { (pDst)[i * (numChans) + (c)] = (pSrc)[i]; }
+
+/* The single-channel functions on each channel, over the blocks: what the interleaved functions replace */
+static void chan_f32(float32_t *pState, uint32_t numChans, uint32_t numBlocks, float32_t *pSrc, float32_t *pDst)
+{
+  arm_biquad_cascade_df2T_instance_f32 s;
+  uint32_t                             c, b, i, n = numBlocks * TEST_FRAMES;
+
+  for (c = 0u; c < numChans; c++)
+  {
+    arm_biquad_cascade_df2T_init_f32(&s, TEST_STAGES, coeffsF32, &pState[2u * TEST_STAGES * c]);
+    TEST_DEINTERLEAVE(pSrc, chanF32, c, numChans, n);
+    for (b = 0u; b < numBlocks; b++)
+    {
+      arm_biquad_cascade_df2T_f32(&s, &chanF32[b * TEST_FRAMES], &chanF32[b * TEST_FRAMES], TEST_FRAMES);
+    }
+    TEST_INTERLEAVE(chanF32, pDst, c, numChans, n);
+  }
+}
+
+static void chan_q31(q31_t *pState, uint32_t numChans, uint32_t numBlocks, q31_t *pSrc, q31_t *pDst)
+{
+  arm_biquad_casd_df1_inst_q31 s;
+  uint32_t                     c, b, i, n = numBlocks * TEST_FRAMES;
+
+  for (c = 0u; c < numChans; c++)
+  {
+    arm_biquad_cascade_df1_init_q31(&s, TEST_STAGES, coeffsQ31, &pState[4u * TEST_STAGES * c], 1);
+    TEST_DEINTERLEAVE(pSrc, chanQ31, c, numChans, n);
+    for (b = 0u; b < numBlocks; b++)
+    {
+      arm_biquad_cascade_df1_q31(&s, &chanQ31[b * TEST_FRAMES], &chanQ31[b * TEST_FRAMES], TEST_FRAMES);
+    }
+    TEST_INTERLEAVE(chanQ31, pDst, c, numChans, n);
+  }
+}
+
+static void chan_q15(q15_t *pState, uint32_t numChans, uint32_t numBlocks, q15_t *pSrc, q15_t *pDst)
+{
+  arm_biquad_casd_df1_inst_q15 s;
+  uint32_t                     c, b, i, n = numBlocks * TEST_FRAMES;
+
+  for (c = 0u; c < numChans; c++)
+  {
+    arm_biquad_cascade_df1_init_q15(&s, TEST_STAGES, coeffsQ15, &pState[4u * TEST_STAGES * c], 1);
+    TEST_DEINTERLEAVE(pSrc, chanQ15, c, numChans, n);
+    for (b = 0u; b < numBlocks; b++)
+    {
+      arm_biquad_cascade_df1_q15(&s, &chanQ15[b * TEST_FRAMES], &chanQ15[b * TEST_FRAMES], TEST_FRAMES);
+    }
+    TEST_INTERLEAVE(chanQ15, pDst, c, numChans, n);
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+static void test_interleaved(void)
+{
+  static const char                               *nameTbl[3] =
+  {
+    "df2T_interleaved_f32 vs df2T_f32 per channel",
+    "df1_interleaved_q31 vs df1_q31 per channel",
+    "df1_interleaved_q15 vs df1_q15 per channel"
+  };
+  arm_biquad_cascade_df2T_interleaved_instance_f32 sF32;
+  arm_biquad_casd_df1_interleaved_inst_q31         sQ31;
+  arm_biquad_casd_df1_interleaved_inst_q15         sQ15;
+  static float32_t                                 chanState[4u * TEST_STAGES * TEST_CHANS_MAX];
+  uint32_t                                         ix, b, n, numChans, diffs[3] = {0u, 0u, 0u};
+  double                                           snr[3], snrMin[3] = {INFINITY, INFINITY, INFINITY};
+
+  biquad_design();
+  for (ix = 0u; ix < sizeof(testChansTbl) / sizeof(testChansTbl[0]); ix++)
+  {
+    numChans = testChansTbl[ix];
+    n        = numChans * TEST_FRAMES * TEST_BLOCKS;
+    test_rand_f64(refIn, n, 0.5);
+    test_f64_to_f32(refIn, inF32, n);
+    test_f64_to_q31(refIn, inQ31, n);
+    test_f64_to_q15(refIn, inQ15, n);
+
+    arm_biquad_cascade_df2T_interleaved_init_f32(&sF32, TEST_STAGES, (uint16_t)numChans, coeffsF32, stateF32);
+    arm_biquad_cascade_df1_interleaved_init_q31(&sQ31, TEST_STAGES, (uint16_t)numChans, coeffsQ31, stateQ31, 1u);
+    arm_biquad_cascade_df1_interleaved_init_q15(&sQ15, TEST_STAGES, (uint16_t)numChans, coeffsQ15, stateQ15, 1);
+    for (b = 0u; b < TEST_BLOCKS; b++)
+    {
+      arm_biquad_cascade_df2T_interleaved_f32(&sF32, &inF32[b * numChans * TEST_FRAMES],
+                                              &outF32[b * numChans * TEST_FRAMES], TEST_FRAMES);
+      arm_biquad_cascade_df1_interleaved_q31(&sQ31, &inQ31[b * numChans * TEST_FRAMES],
+                                             &outQ31[b * numChans * TEST_FRAMES], TEST_FRAMES);
+      arm_biquad_cascade_df1_interleaved_q15(&sQ15, &inQ15[b * numChans * TEST_FRAMES],
+                                             &outQ15[b * numChans * TEST_FRAMES], TEST_FRAMES);
+    }
+
+    chan_f32(chanState, numChans, TEST_BLOCKS, inF32, refF32);
+    chan_q31((q31_t *)chanState, numChans, TEST_BLOCKS, inQ31, refQ31);
+    chan_q15((q15_t *)chanState, numChans, TEST_BLOCKS, inQ15, refQ15);
+    diffs[0] += (memcmp(outF32, refF32, n * sizeof(float32_t)) != 0) ? 1u : 0u;
+    diffs[1] += (memcmp(outQ31, refQ31, n * sizeof(q31_t)) != 0) ? 1u : 0u;
+    diffs[2] += (memcmp(outQ15, refQ15, n * sizeof(q15_t)) != 0) ? 1u : 0u;
+
+    ref_biquad(refIn, refOut, numChans, TEST_FRAMES * TEST_BLOCKS);
+    snr[0] = test_snr_f32(refOut, outF32, n);
+    snr[1] = test_snr_q31(refOut, outQ31, n);
+    snr[2] = test_snr_q15(refOut, outQ15, n);
+    for (b = 0u; b < 3u; b++)
+    {
+      snrMin[b] = (snr[b] < snrMin[b]) ? snr[b] : snrMin[b];
+    }
+  }
+
+  test_check_snr("df2T_interleaved_f32, 1 to 16 ch, lowest", snrMin[0], 125.0);
+  test_check_snr("df1_interleaved_q31, 1 to 16 ch, lowest", snrMin[1], 145.0);
+  test_check_snr("df1_interleaved_q15, 1 to 16 ch, lowest", snrMin[2], 50.0);
+  for (b = 0u; b < 3u; b++)
+  {
+    printf("  %-48s %s\n", nameTbl[b], (diffs[b] == 0u) ? "bit-exact" : "differ  FAILED");
+  }
+  TEST_CHECK(diffs[0] == 0u);
+  TEST_CHECK(diffs[1] == 0u);
+  TEST_CHECK(diffs[2] == 0u);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  static const uint16_t                            chansTbl[] = {2u, 8u, 16u};
+  arm_biquad_cascade_df2T_interleaved_instance_f32 sF32;
+  arm_biquad_casd_df1_interleaved_inst_q31         sQ31;
+  arm_biquad_casd_df1_interleaved_inst_q15         sQ15;
+  static float32_t                                 chanState[4u * TEST_STAGES * TEST_CHANS_MAX];
+  uint32_t                                         ix, numChans, n;
+  char                                             name[64];
+
+  test_rand_f64(refIn, TEST_LEN_MAX, 0.5);
+  test_f64_to_f32(refIn, inF32, TEST_LEN_MAX);
+  test_f64_to_q31(refIn, inQ31, TEST_LEN_MAX);
+  test_f64_to_q15(refIn, inQ15, TEST_LEN_MAX);
+  for (ix = 0u; ix < sizeof(chansTbl) / sizeof(chansTbl[0]); ix++)
+  {
+    numChans = chansTbl[ix];
+    n        = numChans * TEST_FRAMES;
+    arm_biquad_cascade_df2T_interleaved_init_f32(&sF32, TEST_STAGES, (uint16_t)numChans, coeffsF32, stateF32);
+    snprintf(name, sizeof(name), "df2T_interleaved_f32, %u ch", (unsigned)numChans);
+    TEST_BENCH(name, n, arm_biquad_cascade_df2T_interleaved_f32(&sF32, inF32, outF32, TEST_FRAMES));
+    snprintf(name, sizeof(name), "df2T_f32 per channel + (de)interleave, %u ch", (unsigned)numChans);
+    TEST_BENCH(name, n, chan_f32(chanState, numChans, 1u, inF32, outF32));
+
+    arm_biquad_cascade_df1_interleaved_init_q31(&sQ31, TEST_STAGES, (uint16_t)numChans, coeffsQ31, stateQ31, 1u);
+    snprintf(name, sizeof(name), "df1_interleaved_q31, %u ch", (unsigned)numChans);
+    TEST_BENCH(name, n, arm_biquad_cascade_df1_interleaved_q31(&sQ31, inQ31, outQ31, TEST_FRAMES));
+    snprintf(name, sizeof(name), "df1_q31 per channel + (de)interleave, %u ch", (unsigned)numChans);
+    TEST_BENCH(name, n, chan_q31((q31_t *)chanState, numChans, 1u, inQ31, outQ31));
+
+    arm_biquad_cascade_df1_interleaved_init_q15(&sQ15, TEST_STAGES, (uint16_t)numChans, coeffsQ15, stateQ15, 1);
+    snprintf(name, sizeof(name), "df1_interleaved_q15, %u ch", (unsigned)numChans);
+    TEST_BENCH(name, n, arm_biquad_cascade_df1_interleaved_q15(&sQ15, inQ15, outQ15, TEST_FRAMES));
+    snprintf(name, sizeof(name), "df1_q15 per channel + (de)interleave, %u ch", (unsigned)numChans);
+    TEST_BENCH(name, n, chan_q15((q15_t *)chanState, numChans, 1u, inQ15, outQ15));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_biquad_interleaved_test", argc, argv);
+  test_seed(1u);
+  test_interleaved();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
@@ -0,0 +1,225 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_cfft_fixed_test.c
+*
+* Description:  Q15 and Q31 complex FFTs against a direct DFT and the radix-2/radix-4 functions.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks arm_cfft_q15() and arm_cfft_q31() for every constant instance, 16 to
+ * 4096 points, against a double precision DFT scaled by 1/N (both directions
+ * scale by 1/fftLen).  For the powers of 4 the results must also be those of
+ * arm_cfft_radix4_q15/q31().  With "bench" it compares each length with the
+ * radix-4 function (powers of 4) or the radix-2 function (other lengths),
+ * with the bit reversal.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "test_helper.h"
+
+#define TEST_LEN_MAX      4096u
+
+static const arm_cfft_instance_q15 *testQ15Tbl[] =
+{
+  &arm_cfft_sR_q15_len16,  &arm_cfft_sR_q15_len32,   &arm_cfft_sR_q15_len64,   &arm_cfft_sR_q15_len128,
+  &arm_cfft_sR_q15_len256, &arm_cfft_sR_q15_len512,  &arm_cfft_sR_q15_len1024, &arm_cfft_sR_q15_len2048,
+  &arm_cfft_sR_q15_len4096
+};
+
+static const arm_cfft_instance_q31 *testQ31Tbl[] =
+{
+  &arm_cfft_sR_q31_len16,  &arm_cfft_sR_q31_len32,   &arm_cfft_sR_q31_len64,   &arm_cfft_sR_q31_len128,
+  &arm_cfft_sR_q31_len256, &arm_cfft_sR_q31_len512,  &arm_cfft_sR_q31_len1024, &arm_cfft_sR_q31_len2048,
+  &arm_cfft_sR_q31_len4096
+};
+
+static double refIn[2 * TEST_LEN_MAX];
+static double refOut[2 * TEST_LEN_MAX];
+static q31_t  q31Out[2 * TEST_LEN_MAX];
+static q31_t  q31Out4[2 * TEST_LEN_MAX];
+static q15_t  q15Out[2 * TEST_LEN_MAX];
+static q15_t  q15Out4[2 * TEST_LEN_MAX];
+
+static int is_pow4(uint32_t n)
+{
+  while (n > 4u)
+  {
+    n >>= 2u;
+  }
+  return (n == 4u);
+}
+
+/* Reference of the fixed-point transforms: the DFT scaled by 1/N */
+static void ref_dft_scaled(uint32_t n, uint8_t ifftFlag)
+{
+  uint32_t i;
+
+  test_dft_f64(refIn, refOut, n, ifftFlag);
+  if (ifftFlag == 0u)
+  {
+    for (i = 0u; i < 2u * n; i++)
+    {
+      refOut[i] /= (double)n;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+static void test_cfft(void)
+{
+  arm_cfft_radix4_instance_q31 s4Q31;
+  arm_cfft_radix4_instance_q15 s4Q15;
+  double                       snrInvQ31 = INFINITY, snrInvQ15 = INFINITY, snr;
+  uint32_t                     ix, n, diffs = 0u;
+  char                         name[64];
+
+  for (ix = 0u; ix < sizeof(testQ31Tbl) / sizeof(testQ31Tbl[0]); ix++)
+  {
+    n = testQ31Tbl[ix]->fftLen;
+    test_rand_f64(refIn, 2u * n, 0.5);
+    ref_dft_scaled(n, 0u);
+
+    test_f64_to_q31(refIn, q31Out, 2u * n);
+    arm_cfft_q31(testQ31Tbl[ix], q31Out, 0u, 1u);
+    snprintf(name, sizeof(name), "arm_cfft_q31, %u", (unsigned)n);
+    test_check_snr(name, test_snr_q31(refOut, q31Out, 2u * n), 125.0);
+
+    test_f64_to_q15(refIn, q15Out, 2u * n);
+    arm_cfft_q15(testQ15Tbl[ix], q15Out, 0u, 1u);
+    snprintf(name, sizeof(name), "arm_cfft_q15, %u", (unsigned)n);
+    test_check_snr(name, test_snr_q15(refOut, q15Out, 2u * n), 35.0);
+
+    if (is_pow4(n))                             /* Same code as the radix-4 functions */
+    {
+      test_f64_to_q31(refIn, q31Out4, 2u * n);
+      TEST_CHECK(arm_cfft_radix4_init_q31(&s4Q31, (uint16_t)n, 0u, 1u) == ARM_MATH_SUCCESS);
+      arm_cfft_radix4_q31(&s4Q31, q31Out4);
+      diffs += (memcmp(q31Out, q31Out4, 2u * n * sizeof(q31_t)) != 0) ? 1u : 0u;
+      test_f64_to_q15(refIn, q15Out4, 2u * n);
+      TEST_CHECK(arm_cfft_radix4_init_q15(&s4Q15, (uint16_t)n, 0u, 1u) == ARM_MATH_SUCCESS);
+      arm_cfft_radix4_q15(&s4Q15, q15Out4);
+      diffs += (memcmp(q15Out, q15Out4, 2u * n * sizeof(q15_t)) != 0) ? 1u : 0u;
+    }
+
+    ref_dft_scaled(n, 1u);                      /* Inverse of a random spectrum */
+    test_f64_to_q31(refIn, q31Out, 2u * n);
+    arm_cfft_q31(testQ31Tbl[ix], q31Out, 1u, 1u);
+    snr       = test_snr_q31(refOut, q31Out, 2u * n);
+    snrInvQ31 = (snr < snrInvQ31) ? snr : snrInvQ31;
+    test_f64_to_q15(refIn, q15Out, 2u * n);
+    arm_cfft_q15(testQ15Tbl[ix], q15Out, 1u, 1u);
+    snr       = test_snr_q15(refOut, q15Out, 2u * n);
+    snrInvQ15 = (snr < snrInvQ15) ? snr : snrInvQ15;
+  }
+  test_check_snr("arm_cfft_q31, inverse, lowest", snrInvQ31, 125.0);
+  test_check_snr("arm_cfft_q15, inverse, lowest", snrInvQ15, 35.0);
+  printf("  %-48s %s\n", "powers of 4 against arm_cfft_radix4_q31/q15", (diffs == 0u) ? "bit-exact" : "differ  FAILED");
+  TEST_CHECK(diffs == 0u);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  arm_cfft_radix4_instance_q31 s4Q31;
+  arm_cfft_radix4_instance_q15 s4Q15;
+  arm_cfft_radix2_instance_q31 s2Q31;
+  arm_cfft_radix2_instance_q15 s2Q15;
+  uint32_t                     ix, n;
+  char                         name[64];
+
+  test_rand_f64(refIn, 2u * TEST_LEN_MAX, 0.5);
+  test_f64_to_q31(refIn, q31Out, 2u * TEST_LEN_MAX);
+  test_f64_to_q15(refIn, q15Out, 2u * TEST_LEN_MAX);
+  for (ix = 2u; ix < sizeof(testQ31Tbl) / sizeof(testQ31Tbl[0]); ix++)
+  {
+    n = testQ31Tbl[ix]->fftLen;
+    snprintf(name, sizeof(name), "arm_cfft_q31, %u", (unsigned)n);
+    TEST_BENCH(name, n, arm_cfft_q31(testQ31Tbl[ix], q31Out, 0u, 1u));
+    if (is_pow4(n))
+    {
+      (void)arm_cfft_radix4_init_q31(&s4Q31, (uint16_t)n, 0u, 1u);
+      snprintf(name, sizeof(name), "arm_cfft_radix4_q31, %u", (unsigned)n);
+      TEST_BENCH(name, n, arm_cfft_radix4_q31(&s4Q31, q31Out));
+    }
+    else
+    {
+      (void)arm_cfft_radix2_init_q31(&s2Q31, (uint16_t)n, 0u, 1u);
+      snprintf(name, sizeof(name), "arm_cfft_radix2_q31, %u", (unsigned)n);
+      TEST_BENCH(name, n, arm_cfft_radix2_q31(&s2Q31, q31Out));
+    }
+  }
+  for (ix = 2u; ix < sizeof(testQ15Tbl) / sizeof(testQ15Tbl[0]); ix++)
+  {
+    n = testQ15Tbl[ix]->fftLen;
+    snprintf(name, sizeof(name), "arm_cfft_q15, %u", (unsigned)n);
+    TEST_BENCH(name, n, arm_cfft_q15(testQ15Tbl[ix], q15Out, 0u, 1u));
+    if (is_pow4(n))
+    {
+      (void)arm_cfft_radix4_init_q15(&s4Q15, (uint16_t)n, 0u, 1u);
+      snprintf(name, sizeof(name), "arm_cfft_radix4_q15, %u", (unsigned)n);
+      TEST_BENCH(name, n, arm_cfft_radix4_q15(&s4Q15, q15Out));
+    }
+    else
+    {
+      (void)arm_cfft_radix2_init_q15(&s2Q15, (uint16_t)n, 0u, 1u);
+      snprintf(name, sizeof(name), "arm_cfft_radix2_q15, %u", (unsigned)n);
+      TEST_BENCH(name, n, arm_cfft_radix2_q15(&s2Q15, q15Out));
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_cfft_fixed_test", argc, argv);
+  test_seed(1u);
+  test_cfft();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
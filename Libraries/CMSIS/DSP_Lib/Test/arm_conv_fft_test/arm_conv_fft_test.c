@@ -0,0 +1,302 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_conv_fft_test.c
+*
+* Description:  Convolution and correlation in FFT form against the direct functions.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks arm_conv_fft_f32/q15() and arm_correlate_fft_f32/q31() against
+ * double precision references and against the direct functions, for equal,
+ * longer-A and longer-B lengths on both sides of the choice of
+ * arm_conv_fft_len(), up to two sequences of 4096 samples (8192-point real
+ * FFT, ARM_MATH_RFFT_8192) and beyond (direct form).  With "bench" it compares
+ * both forms of the correlation, and measures the break-even ratio that
+ * ARM_MATH_CONV_FFT_RATIO (3) is calibrated on: the time of the FFT form in
+ * multiply-accumulates of the direct form, per fftLen*log2(fftLen).
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_LEN_MAX      5000u         /* Longest sequence */
+#define TEST_OUT_MAX      (2u * TEST_LEN_MAX - 1u)
+#define TEST_FFT_MAX      8192u
+
+/* Not in arm_math.h: shared by the FFT forms, in arm_conv_fft_f32.c */
+extern uint32_t arm_conv_fft_len(uint32_t srcALen, uint32_t srcBLen);
+extern void     arm_conv_fft_kernel_f32(float32_t *pScratch, uint32_t fftLen);
+
+typedef struct
+{
+  uint32_t srcALen;
+  uint32_t srcBLen;
+} test_lengths;
+
+static const test_lengths testLenTbl[] =
+{
+  {16u, 16u}, {64u, 8u}, {200u, 100u}, {1000u, 40u}, {40u, 1000u}, {1000u, 1000u},
+  {3000u, 333u}, {333u, 3000u}, {4096u, 4096u}, {5000u, 5000u}
+};
+
+static double    refA[TEST_LEN_MAX];
+static double    refB[TEST_LEN_MAX];
+static double    refBRev[TEST_LEN_MAX];
+static double    refOut[TEST_OUT_MAX];
+static double    refAQ15[TEST_LEN_MAX];
+static double    refBQ15[TEST_LEN_MAX];
+static float32_t aF32[TEST_LEN_MAX];
+static float32_t bF32[TEST_LEN_MAX];
+static q31_t     aQ31[TEST_LEN_MAX];
+static q31_t     bQ31[TEST_LEN_MAX];
+static q15_t     aQ15[TEST_LEN_MAX];
+static q15_t     bQ15[TEST_LEN_MAX];
+static float32_t outF32[TEST_OUT_MAX];
+static float32_t outDirF32[TEST_OUT_MAX];
+static q31_t     outQ31[TEST_OUT_MAX];
+static q15_t     outQ15[TEST_OUT_MAX];
+static q15_t     outDirQ15[TEST_OUT_MAX];
+static float32_t scratch[3u * TEST_FFT_MAX];
+
+/* Linear convolution of 'pA' and 'pB' at pY[offset], zeros elsewhere up to 'n' */
+static void ref_conv(const double *pA, uint32_t lenA, const double *pB, uint32_t lenB,
+                     double *pY, uint32_t offset, uint32_t n)
+{
+  uint32_t k, i;
+  double   acc;
+
+  memset(pY, 0, n * sizeof(double));
+  for (k = 0u; k < lenA + lenB - 1u; k++)
+  {
+    acc = 0.0;
+    for (i = (k >= lenB) ? k - lenB + 1u : 0u; (i <= k) && (i < lenA); i++)
+    {
+      acc += pA[i] * pB[k - i];
+    }
+    pY[offset + k] = acc;
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+static void test_fft_len(void)
+{
+  TEST_CHECK(arm_conv_fft_len(16u, 16u) == 0u);          /* Direct below the ratio */
+  TEST_CHECK(arm_conv_fft_len(1000u, 40u) == 0u);
+  TEST_CHECK(arm_conv_fft_len(200u, 100u) == 512u);
+  TEST_CHECK(arm_conv_fft_len(1000u, 1000u) == 2048u);
+  TEST_CHECK(arm_conv_fft_len(4096u, 4096u) == 8192u);   /* Longest real FFT */
+  TEST_CHECK(arm_conv_fft_len(4097u, 4096u) == 8192u);
+  TEST_CHECK(arm_conv_fft_len(4097u, 4097u) == 0u);
+}
+
+static void test_conv_corr(void)
+{
+  const test_lengths *pL;
+  uint32_t            ix, i, lenA, lenB, outLen, corrLen, offset, fftLen;
+  double              lsbFft = 0.0, lsbDir = 0.0, d;
+  char                name[64];
+
+  for (ix = 0u; ix < sizeof(testLenTbl) / sizeof(testLenTbl[0]); ix++)
+  {
+    pL      = &testLenTbl[ix];
+    lenA    = pL->srcALen;
+    lenB    = pL->srcBLen;
+    outLen  = lenA + lenB - 1u;
+    corrLen = 2u * ((lenA > lenB) ? lenA : lenB) - 1u;
+    fftLen  = arm_conv_fft_len(lenA, lenB);
+
+    /* Scaled so that the fixed-point sums stay below 1 */
+    test_rand_f64(refA, lenA, 0.5 / sqrt((double)((lenA < lenB) ? lenA : lenB)));
+    test_rand_f64(refB, lenB, 0.5);
+    test_f64_to_f32(refA, aF32, lenA);
+    test_f64_to_f32(refB, bF32, lenB);
+    test_f64_to_q31(refA, aQ31, lenA);
+    test_f64_to_q31(refB, bQ31, lenB);
+    test_f64_to_q15(refA, aQ15, lenA);
+    test_f64_to_q15(refB, bQ15, lenB);
+
+    /* Convolution */
+    ref_conv(refA, lenA, refB, lenB, refOut, 0u, outLen);
+    arm_conv_fft_f32(aF32, lenA, bF32, lenB, outF32, scratch);
+    snprintf(name, sizeof(name), "arm_conv_fft_f32, %u x %u, %s", (unsigned)lenA, (unsigned)lenB,
+             (fftLen != 0u) ? "FFT" : "direct");
+    test_check_snr(name, test_snr_f32(refOut, outF32, outLen), 110.0);
+
+    for (i = 0u; i < lenA; i++)                 /* q15 reference from the rounded inputs */
+    {
+      refAQ15[i] = (double)aQ15[i] / 32768.0;
+    }
+    for (i = 0u; i < lenB; i++)
+    {
+      refBQ15[i] = (double)bQ15[i] / 32768.0;
+    }
+    ref_conv(refAQ15, lenA, refBQ15, lenB, refOut, 0u, outLen);
+    arm_conv_fft_q15(aQ15, lenA, bQ15, lenB, outQ15, scratch);
+    arm_conv_q15(aQ15, lenA, bQ15, lenB, outDirQ15);
+    for (i = 0u; i < outLen; i++)                /* Both truncate, the direct form towards minus infinity */
+    {
+      d      = fabs(refOut[i] * 32768.0 - (double)outQ15[i]);
+      lsbFft = (d > lsbFft) ? d : lsbFft;
+      d      = fabs(refOut[i] * 32768.0 - (double)outDirQ15[i]);
+      lsbDir = (d > lsbDir) ? d : lsbDir;
+    }
+
+    /* Correlation: the convolution with B reversed, after max(0, lenA - lenB) unwritten samples */
+    for (i = 0u; i < lenB; i++)
+    {
+      refBRev[i] = refB[lenB - 1u - i];
+    }
+    offset = (lenA > lenB) ? lenA - lenB : 0u;
+    ref_conv(refA, lenA, refBRev, lenB, refOut, offset, corrLen);
+    memset(outF32, 0, corrLen * sizeof(float32_t));
+    memset(outDirF32, 0, corrLen * sizeof(float32_t));
+    arm_correlate_fft_f32(aF32, lenA, bF32, lenB, outF32, scratch);
+    arm_correlate_f32(aF32, lenA, bF32, lenB, outDirF32);
+    snprintf(name, sizeof(name), "arm_correlate_fft_f32, %u x %u, %s", (unsigned)lenA, (unsigned)lenB,
+             (fftLen != 0u) ? "FFT" : "direct");
+    test_check_snr(name, test_snr_f32(refOut, outF32, corrLen), 110.0);
+    TEST_CHECK(test_snr_f32(refOut, outDirF32, corrLen) >= 110.0);   /* Same layout as the direct form */
+
+    memset(outQ31, 0, corrLen * sizeof(q31_t));
+    arm_correlate_fft_q31(aQ31, lenA, bQ31, lenB, outQ31, scratch);
+    snprintf(name, sizeof(name), "arm_correlate_fft_q31, %u x %u, %s", (unsigned)lenA, (unsigned)lenB,
+             (fftLen != 0u) ? "FFT" : "direct");
+    test_check_snr(name, test_snr_q31(refOut, outQ31, corrLen), 120.0);
+  }
+  printf("  %-48s %7.3f LSB\n", "arm_conv_fft_q15, largest error", lsbFft);
+  printf("  %-48s %7.3f LSB\n", "arm_conv_q15, largest error", lsbDir);
+  TEST_CHECK(lsbFft < 1.01);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+/* Break-even ratio of the FFT form for fftLen: its time in multiply-accumulates of arm_conv_f32(), with
+   two sequences of fftLen/2 samples, per fftLen*log2(fftLen) */
+static double bench_ratio(uint32_t fftLen, uint32_t log2Len)
+{
+  uint32_t n = fftLen / 2u;
+  uint64_t start, runs, nsDirect, nsFft;
+
+  start = test_time_ns();
+  runs  = 0u;
+  do
+  {
+    arm_conv_f32(aF32, n, bF32, n, outF32);
+    runs++;
+  } while ((test_time_ns() - start) < TEST_BENCH_NS);
+  nsDirect = (test_time_ns() - start) / runs;
+
+  start = test_time_ns();
+  runs  = 0u;
+  do
+  {
+    arm_copy_f32(aF32, scratch, n);                     /* As arm_conv_fft_f32() */
+    arm_fill_f32(0.0f, scratch + n, fftLen - n);
+    arm_copy_f32(bF32, scratch + fftLen, n);
+    arm_fill_f32(0.0f, scratch + fftLen + n, fftLen - n);
+    arm_conv_fft_kernel_f32(scratch, fftLen);
+    arm_copy_f32(scratch, outF32, 2u * n - 1u);
+    runs++;
+  } while ((test_time_ns() - start) < TEST_BENCH_NS);
+  nsFft = (test_time_ns() - start) / runs;
+
+  return (((double)nsFft * (double)n * (double)n / (double)nsDirect) / ((double)fftLen * (double)log2Len));
+}
+
+static void bench(void)
+{
+  static const uint32_t lenTbl[] = {64u, 256u, 1024u, 4096u};
+  uint32_t              ix, n, fftLen, log2Len;
+  char                  name[64];
+
+  test_rand_f64(refA, TEST_LEN_MAX, 0.01);
+  test_rand_f64(refB, TEST_LEN_MAX, 0.5);
+  test_f64_to_f32(refA, aF32, TEST_LEN_MAX);
+  test_f64_to_f32(refB, bF32, TEST_LEN_MAX);
+  test_f64_to_q31(refA, aQ31, TEST_LEN_MAX);
+  test_f64_to_q31(refB, bQ31, TEST_LEN_MAX);
+  test_f64_to_q15(refA, aQ15, TEST_LEN_MAX);
+  test_f64_to_q15(refB, bQ15, TEST_LEN_MAX);
+
+  /* ns per output sample */
+  for (ix = 0u; ix < sizeof(lenTbl) / sizeof(lenTbl[0]); ix++)
+  {
+    n = lenTbl[ix];
+    snprintf(name, sizeof(name), "arm_correlate_f32, %u x %u", (unsigned)n, (unsigned)n);
+    TEST_BENCH(name, 2u * n - 1u, arm_correlate_f32(aF32, n, bF32, n, outF32));
+    snprintf(name, sizeof(name), "arm_correlate_fft_f32, %u x %u", (unsigned)n, (unsigned)n);
+    TEST_BENCH(name, 2u * n - 1u, arm_correlate_fft_f32(aF32, n, bF32, n, outF32, scratch));
+    snprintf(name, sizeof(name), "arm_correlate_f32, %u x 32", (unsigned)n);
+    TEST_BENCH(name, 2u * n - 1u, arm_correlate_f32(aF32, n, bF32, 32u, outF32));
+    snprintf(name, sizeof(name), "arm_correlate_fft_f32, %u x 32", (unsigned)n);
+    TEST_BENCH(name, 2u * n - 1u, arm_correlate_fft_f32(aF32, n, bF32, 32u, outF32, scratch));
+  }
+  TEST_BENCH("arm_conv_q15, 4096 x 4096", 8191u, arm_conv_q15(aQ15, 4096u, bQ15, 4096u, outQ15));
+  TEST_BENCH("arm_conv_fft_q15, 4096 x 4096", 8191u, arm_conv_fft_q15(aQ15, 4096u, bQ15, 4096u, outQ15, scratch));
+  TEST_BENCH("arm_correlate_q31, 4096 x 4096", 8191u, arm_correlate_q31(aQ31, 4096u, bQ31, 4096u, outQ31));
+  TEST_BENCH("arm_correlate_fft_q31, 4096 x 4096", 8191u,
+             arm_correlate_fft_q31(aQ31, 4096u, bQ31, 4096u, outQ31, scratch));
+
+  /* Calibration of ARM_MATH_CONV_FFT_RATIO: the FFT form wins above the printed ratio */
+  for (fftLen = 32u, log2Len = 5u; fftLen <= TEST_FFT_MAX; fftLen <<= 1u, log2Len++)
+  {
+    snprintf(name, sizeof(name), "break-even ratio, fftLen %u", (unsigned)fftLen);
+    printf("  %-48s %10.2f\n", name, bench_ratio(fftLen, log2Len));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_conv_fft_test", argc, argv);
+  test_seed(1u);
+  test_fft_len();
+  test_conv_corr();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
@@ -0,0 +1,450 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_f64_test.c
+*
+* Description:  Double precision kernels against long double references, compared with float32.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks the float64 functions against long double references: the biquad
+ * cascade, matrix addition, transpose, multiplication and inverse, the dot
+ * product and the statistics.  Each test also prints the float32 function
+ * on the same problem, where float32 fails: a low biquad cut-off, an
+ * ill-conditioned inverse, a cancelling dot product, the variance of values
+ * with a large mean.  With "bench" it compares the float64 functions with the
+ * float32 ones.
+ */
+
+#include <float.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_LEN          48000u        /* 1 s at 48 kHz */
+#define TEST_DIM_MAX         64u
+
+static double    refIn[TEST_LEN];
+static double    refOut[TEST_LEN];
+static float64_t inF64[TEST_LEN];
+static float64_t outF64[TEST_LEN];
+static float32_t inF32[TEST_LEN];
+static float32_t outF32[TEST_LEN];
+static float64_t matF64[4][TEST_DIM_MAX * TEST_DIM_MAX];
+static float32_t matF32[4][TEST_DIM_MAX * TEST_DIM_MAX];
+
+/* Prints a float32 result, for comparison: it is not checked */
+static void print_f32(const char *name, double value, const char *unit)
+{
+  printf("  %-48s %10.3g %s\n", name, value, unit);
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+/* Low-pass f0 = 10 Hz, Q = 20 at 48 kHz: the poles are within 1e-3 of 1 */
+static void test_biquad(void)
+{
+  arm_biquad_cascade_df2T_instance_f64 sF64;
+  arm_biquad_cascade_df2T_instance_f32 sF32;
+  float64_t                            coeffsF64[5], stateF64[2];
+  float32_t                            coeffsF32[5], stateF32[2];
+  long double                          w, alpha, a0, x1 = 0.0L, x2 = 0.0L, y1 = 0.0L, y2 = 0.0L, y;
+  uint32_t                             i;
+
+  w     = 2.0L * PI * 10.0L / 48000.0L;
+  alpha = sinl(w) / (2.0L * 20.0L);
+  a0    = 1.0L + alpha;
+  coeffsF64[0] = (double)((1.0L - cosl(w)) / 2.0L / a0);
+  coeffsF64[1] = (double)((1.0L - cosl(w)) / a0);
+  coeffsF64[2] = coeffsF64[0];
+  coeffsF64[3] = (double)(2.0L * cosl(w) / a0);           /* Feedback added */
+  coeffsF64[4] = (double)(-(1.0L - alpha) / a0);
+  for (i = 0u; i < 5u; i++)
+  {
+    coeffsF32[i] = (float32_t)coeffsF64[i];
+  }
+
+  test_rand_f64(refIn, TEST_LEN, 0.5);
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    inF64[i] = refIn[i];
+    y  = coeffsF64[0] * (long double)refIn[i] + coeffsF64[1] * x1 + coeffsF64[2] * x2 +
+         coeffsF64[3] * y1 + coeffsF64[4] * y2;
+    x2 = x1;
+    x1 = refIn[i];
+    y2 = y1;
+    y1 = y;
+    refOut[i] = (double)y;
+  }
+  test_f64_to_f32(refIn, inF32, TEST_LEN);
+
+  arm_biquad_cascade_df2T_init_f64(&sF64, 1u, coeffsF64, stateF64);
+  arm_biquad_cascade_df2T_f64(&sF64, inF64, outF64, TEST_LEN / 2u);         /* Two blocks */
+  arm_biquad_cascade_df2T_f64(&sF64, &inF64[TEST_LEN / 2u], &outF64[TEST_LEN / 2u], TEST_LEN / 2u);
+  arm_biquad_cascade_df2T_init_f32(&sF32, 1u, coeffsF32, stateF32);
+  arm_biquad_cascade_df2T_f32(&sF32, inF32, outF32, TEST_LEN);
+
+  /* Second half: steady state */
+  test_check_snr("arm_biquad_cascade_df2T_f64, 10 Hz, Q 20",
+                 test_snr_f64(&refOut[TEST_LEN / 2u], &outF64[TEST_LEN / 2u], TEST_LEN / 2u), 200.0);
+  print_f32("arm_biquad_cascade_df2T_f32, 10 Hz, Q 20",
+            test_snr_f32(&refOut[TEST_LEN / 2u], &outF32[TEST_LEN / 2u], TEST_LEN / 2u), "dB");
+}
+
+/* Inverse of the 12 x 12 matrix 'pA' by Gauss-Jordan elimination with partial pivoting, in long double */
+static void ref_inverse(const double *pA, double *pX)
+{
+  static long double m[12][24];
+  long double        t;
+  uint32_t           i, j, k, p;
+
+  for (i = 0u; i < 12u; i++)
+  {
+    for (j = 0u; j < 24u; j++)
+    {
+      m[i][j] = (j < 12u) ? (long double)pA[i * 12u + j] : (long double)(j - 12u == i);
+    }
+  }
+  for (k = 0u; k < 12u; k++)
+  {
+    for (p = k, i = k + 1u; i < 12u; i++)
+    {
+      p = (fabsl(m[i][k]) > fabsl(m[p][k])) ? i : p;
+    }
+    for (j = 0u; j < 24u; j++)
+    {
+      t       = m[k][j];
+      m[k][j] = m[p][j];
+      m[p][j] = t;
+    }
+    for (t = m[k][k], j = 0u; j < 24u; j++)
+    {
+      m[k][j] /= t;
+    }
+    for (i = 0u; i < 12u; i++)
+    {
+      for (t = m[i][k], j = 0u; (i != k) && (j < 24u); j++)
+      {
+        m[i][j] -= t * m[k][j];
+      }
+    }
+  }
+  for (i = 0u; i < 144u; i++)
+  {
+    pX[i] = (double)m[i / 12u][12u + i % 12u];
+  }
+}
+
+/* max |X - Xref| / max |Xref| */
+static double rel_err(const double *pRef, const double *pX, uint32_t n)
+{
+  double   err = 0.0, norm = 0.0;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    err  = (fabs(pX[i] - pRef[i]) > err) ? fabs(pX[i] - pRef[i]) : err;
+    norm = (fabs(pRef[i]) > norm) ? fabs(pRef[i]) : norm;
+  }
+  return (err / norm);
+}
+
+static void test_matrix(void)
+{
+  static const uint16_t   dimTbl[][3] = {{1u, 1u, 1u}, {5u, 7u, 9u}, {16u, 16u, 16u}, {13u, 8u, 21u}, {33u, 17u, 3u}};
+  arm_matrix_instance_f64 a, b, c, d;
+  arm_matrix_instance_f32 a32, c32;
+  static double           v[12], work[3][12 * 12], lambda[12];
+  long double             acc;
+  double                  norm;
+  uint32_t                ix, i, j, k, m, n, p, diffs = 0u;
+
+  /* Multiplication, addition and transpose: the same operations in the same order as a naive loop */
+  for (ix = 0u; ix < sizeof(dimTbl) / sizeof(dimTbl[0]); ix++)
+  {
+    m = dimTbl[ix][0];
+    n = dimTbl[ix][1];
+    p = dimTbl[ix][2];
+    test_rand_f64(matF64[0], m * n, 1.0);
+    test_rand_f64(matF64[1], n * p, 1.0);
+    arm_mat_init_f64(&a, (uint16_t)m, (uint16_t)n, matF64[0]);
+    arm_mat_init_f64(&b, (uint16_t)n, (uint16_t)p, matF64[1]);
+    arm_mat_init_f64(&c, (uint16_t)m, (uint16_t)p, matF64[2]);
+    TEST_CHECK(arm_mat_mult_f64(&a, &b, &c) == ARM_MATH_SUCCESS);
+    for (i = 0u; i < m; i++)
+    {
+      for (j = 0u; j < p; j++)
+      {
+        norm = 0.0;
+        for (k = 0u; k < n; k++)
+        {
+          norm += matF64[0][i * n + k] * matF64[1][k * p + j];
+        }
+        diffs += (matF64[2][i * p + j] != norm) ? 1u : 0u;
+      }
+    }
+
+    arm_mat_init_f64(&d, (uint16_t)n, (uint16_t)m, matF64[3]);
+    TEST_CHECK(arm_mat_trans_f64(&a, &d) == ARM_MATH_SUCCESS);
+    for (i = 0u; i < m * n; i++)
+    {
+      diffs += (matF64[3][(i % n) * m + i / n] != matF64[0][i]) ? 1u : 0u;
+    }
+    arm_mat_init_f64(&d, (uint16_t)m, (uint16_t)n, matF64[3]);
+    TEST_CHECK(arm_mat_add_f64(&a, &a, &d) == ARM_MATH_SUCCESS);
+    for (i = 0u; i < m * n; i++)
+    {
+      diffs += (matF64[3][i] != 2.0 * matF64[0][i]) ? 1u : 0u;
+    }
+  }
+  printf("  %-48s %s\n", "arm_mat_mult/trans/add_f64 against naive loops", (diffs == 0u) ? "bit-exact" : "differ  FAILED");
+  TEST_CHECK(diffs == 0u);
+
+  /* Inverse of a 12 x 12 covariance Q * diag(lambda) * Q', Q a Householder reflection, condition 1e9 */
+  test_rand_f64(v, 12u, 1.0);
+  norm = 0.0;
+  for (i = 0u; i < 12u; i++)
+  {
+    norm     += v[i] * v[i];
+    lambda[i] = pow(10.0, -9.0 * (double)i / 11.0);
+  }
+  for (i = 0u; i < 12u; i++)
+  {
+    for (j = 0u; j < 12u; j++)
+    {
+      acc = 0.0L;
+      for (k = 0u; k < 12u; k++)
+      {
+        acc += ((long double)(i == k) - 2.0L * v[i] * v[k] / norm) * lambda[k] *
+               ((long double)(k == j) - 2.0L * v[k] * v[j] / norm);
+      }
+      work[0][i * 12u + j] = (double)acc;
+    }
+  }
+  for (i = 0u; i < 12u; i++)                    /* Exactly symmetric */
+  {
+    for (j = 0u; j < i; j++)
+    {
+      work[0][i * 12u + j] = work[0][j * 12u + i];
+    }
+  }
+  memcpy(matF64[0], work[0], sizeof(work[0]));  /* The inverse overwrites its input */
+  test_f64_to_f32(work[0], matF32[0], 144u);
+  arm_mat_init_f64(&a, 12u, 12u, matF64[0]);
+  arm_mat_init_f64(&c, 12u, 12u, matF64[1]);
+  arm_mat_init_f32(&a32, 12u, 12u, matF32[0]);
+  arm_mat_init_f32(&c32, 12u, 12u, matF32[1]);
+  TEST_CHECK(arm_mat_inverse_f64(&a, &c) == ARM_MATH_SUCCESS);
+  ref_inverse(work[0], work[1]);
+  norm = rel_err(work[1], matF64[1], 144u);     /* About cond * eps */
+  printf("  %-48s %10.3g\n", "arm_mat_inverse_f64, cond 1e9, relative error", norm);
+  TEST_CHECK(norm < 1e-5);
+  (void)arm_mat_inverse_f32(&a32, &c32);
+  for (i = 0u; i < 144u; i++)
+  {
+    work[2][i] = matF32[1][i];
+  }
+  print_f32("arm_mat_inverse_f32, cond 1e9, relative error", rel_err(work[1], work[2], 144u), "");
+
+  /* Well conditioned, but only with row exchanges: tiny pivots on the diagonal */
+  test_rand_f64(work[0], 144u, 1.0);
+  for (i = 0u; i < 12u; i++)
+  {
+    work[0][i * 12u + i] = 1e-12 * work[0][i * 12u + i];
+  }
+  memcpy(matF64[0], work[0], sizeof(work[0]));
+  TEST_CHECK(arm_mat_inverse_f64(&a, &c) == ARM_MATH_SUCCESS);
+  ref_inverse(work[0], work[1]);
+  norm = rel_err(work[1], matF64[1], 144u);
+  printf("  %-48s %10.3g\n", "arm_mat_inverse_f64, small pivots, relative error", norm);
+  TEST_CHECK(norm < 1e-12);
+
+  memset(matF64[0], 0, 144u * sizeof(float64_t));              /* Singular */
+  TEST_CHECK(arm_mat_inverse_f64(&a, &c) == ARM_MATH_SINGULAR);
+}
+
+static void test_dot_prod(void)
+{
+  float64_t   a[3] = {1e8, 1.0, -1e8}, b[3] = {1.0, 1.0, 1.0}, resF64;
+  float32_t   a32[3] = {1e8f, 1.0f, -1e8f}, b32[3] = {1.0f, 1.0f, 1.0f}, resF32;
+  long double acc = 0.0L, absSum = 0.0L;
+  uint32_t    i;
+
+  test_rand_f64(inF64, 1000u, 1.0);
+  test_rand_f64(outF64, 1000u, 1.0);
+  for (i = 0u; i < 1000u; i++)
+  {
+    acc    += (long double)inF64[i] * outF64[i];
+    absSum += fabsl((long double)inF64[i] * outF64[i]);
+  }
+  arm_dot_prod_f64(inF64, outF64, 1000u, &resF64);
+  /* Summation bound: n * eps * sum |a * b| */
+  TEST_CHECK(fabsl(resF64 - acc) <= 1000.0L * DBL_EPSILON * absSum);
+  printf("  %-48s %10.3g\n", "arm_dot_prod_f64, 1000, error / sum |a*b|", (double)(fabsl(resF64 - acc) / absSum));
+
+  arm_dot_prod_f64(a, b, 3u, &resF64);
+  arm_dot_prod_f32(a32, b32, 3u, &resF32);
+  printf("  %-48s %10.3g\n", "arm_dot_prod_f64, {1e8, 1, -1e8}.{1, 1, 1}", resF64);
+  TEST_CHECK(resF64 == 1.0);
+  print_f32("arm_dot_prod_f32, {1e8, 1, -1e8}.{1, 1, 1}", resF32, "");
+}
+
+static void test_stats(void)
+{
+  long double mean, var, power;
+  float64_t   res[5];
+  float32_t   resF32;
+  double      err, errMax;
+  uint32_t    i, pass;
+
+  for (pass = 0u; pass < 2u; pass++)            /* Zero mean, then 1e4 +/- 1 */
+  {
+    test_rand_f64(inF64, 1000u, 1.0);
+    for (i = 0u; i < 1000u; i++)
+    {
+      inF64[i] += (pass == 0u) ? 0.0 : 1e4;
+      inF32[i]  = (float32_t)inF64[i];
+    }
+    mean = power = var = 0.0L;
+    for (i = 0u; i < 1000u; i++)
+    {
+      mean  += inF64[i];
+      power += (long double)inF64[i] * inF64[i];
+    }
+    mean /= 1000.0L;
+    for (i = 0u; i < 1000u; i++)
+    {
+      var += (inF64[i] - mean) * (inF64[i] - mean);
+    }
+    var /= 999.0L;
+
+    arm_mean_f64(inF64, 1000u, &res[0]);
+    arm_var_f64(inF64, 1000u, &res[1]);
+    arm_std_f64(inF64, 1000u, &res[2]);
+    arm_power_f64(inF64, 1000u, &res[3]);
+    arm_rms_f64(inF64, 1000u, &res[4]);
+    errMax = fabs((double)((res[0] - mean) / mean));
+    err    = fabs((double)((res[1] - var) / var));
+    errMax = (err > errMax) ? err : errMax;
+    err    = fabs((double)((res[2] - sqrtl(var)) / sqrtl(var)));
+    errMax = (err > errMax) ? err : errMax;
+    err    = fabs((double)((res[3] - power) / power));
+    errMax = (err > errMax) ? err : errMax;
+    err    = fabs((double)((res[4] - sqrtl(power / 1000.0L)) / sqrtl(power / 1000.0L)));
+    errMax = (err > errMax) ? err : errMax;
+    printf("  %-48s %10.3g\n", (pass == 0u) ? "arm_mean/var/std/power/rms_f64, largest rel. error" :
+                                              "same, mean 1e4, largest rel. error", errMax);
+    TEST_CHECK(errMax < 1e-12);
+  }
+  printf("  %-48s %10.6g\n", "arm_var_f64, 1e4 +/- 1", res[1]);
+  arm_var_f32(inF32, 1000u, &resF32);
+  print_f32("arm_var_f32, 1e4 +/- 1", resF32, "");
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  static float64_t                     coeffsF64[20], stateF64[8];
+  static float32_t                     coeffsF32[20], stateF32[8];
+  arm_biquad_cascade_df2T_instance_f64 sF64;
+  arm_biquad_cascade_df2T_instance_f32 sF32;
+  arm_matrix_instance_f64              a, c;
+  arm_matrix_instance_f32              a32, c32;
+  float64_t                            resF64;
+  float32_t                            resF32;
+  uint32_t                             i, n;
+  char                                 name[64];
+
+  for (i = 0u; i < 4u; i++)                     /* Four copies of a stable stage */
+  {
+    coeffsF64[5u * i]      = 0.1;
+    coeffsF64[5u * i + 1u] = 0.2;
+    coeffsF64[5u * i + 2u] = 0.1;
+    coeffsF64[5u * i + 3u] = 1.0;
+    coeffsF64[5u * i + 4u] = -0.5;
+  }
+  for (i = 0u; i < 20u; i++)
+  {
+    coeffsF32[i] = (float32_t)coeffsF64[i];
+  }
+  test_rand_f64(inF64, TEST_LEN, 0.5);
+  test_f64_to_f32(inF64, inF32, TEST_LEN);
+  arm_biquad_cascade_df2T_init_f64(&sF64, 4u, coeffsF64, stateF64);
+  arm_biquad_cascade_df2T_init_f32(&sF32, 4u, coeffsF32, stateF32);
+  TEST_BENCH("arm_biquad_cascade_df2T_f64, 4 stages", 256u, arm_biquad_cascade_df2T_f64(&sF64, inF64, outF64, 256u));
+  TEST_BENCH("arm_biquad_cascade_df2T_f32, 4 stages", 256u, arm_biquad_cascade_df2T_f32(&sF32, inF32, outF32, 256u));
+
+  TEST_BENCH("arm_dot_prod_f64, 1024", 1024u, arm_dot_prod_f64(inF64, outF64, 1024u, &resF64));
+  TEST_BENCH("arm_dot_prod_f32, 1024", 1024u, arm_dot_prod_f32(inF32, outF32, 1024u, &resF32));
+  TEST_BENCH("arm_var_f64, 1024", 1024u, arm_var_f64(inF64, 1024u, &resF64));
+  TEST_BENCH("arm_var_f32, 1024", 1024u, arm_var_f32(inF32, 1024u, &resF32));
+
+  for (n = 16u; n <= TEST_DIM_MAX; n *= 4u)     /* ns per multiply-accumulate */
+  {
+    memcpy(matF64[0], inF64, n * n * sizeof(float64_t));
+    memcpy(matF32[0], inF32, n * n * sizeof(float32_t));
+    arm_mat_init_f64(&a, (uint16_t)n, (uint16_t)n, matF64[0]);
+    arm_mat_init_f64(&c, (uint16_t)n, (uint16_t)n, matF64[1]);
+    arm_mat_init_f32(&a32, (uint16_t)n, (uint16_t)n, matF32[0]);
+    arm_mat_init_f32(&c32, (uint16_t)n, (uint16_t)n, matF32[1]);
+    snprintf(name, sizeof(name), "arm_mat_mult_f64, %ux%u, per MAC", (unsigned)n, (unsigned)n);
+    TEST_BENCH(name, n * n * n, (void)arm_mat_mult_f64(&a, &a, &c));
+    snprintf(name, sizeof(name), "arm_mat_mult_f32, %ux%u, per MAC", (unsigned)n, (unsigned)n);
+    TEST_BENCH(name, n * n * n, (void)arm_mat_mult_f32(&a32, &a32, &c32));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_f64_test", argc, argv);
+  test_seed(1u);
+  test_biquad();
+  test_matrix();
+  test_dot_prod();
+  test_stats();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_fir_fft_test.c
+*
+* Description:  Partitioned fast convolution FIR filter against the direct form.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks arm_fir_fft_f32() against a double precision FIR for short to long
+ * filters and several partition sizes, streaming blocks of two partitions.
+ * With "bench" it measures the direct form arm_fir_f32() and the partitioned
+ * filter for several filter lengths, to show where the FFT form wins.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_LEN          8192u         /* Samples of the tests */
+#define TEST_TAPS_MAX     4096u
+#define TEST_PART_MAX     1024u
+#define TEST_FREQ_LEN     (2u * (TEST_TAPS_MAX + TEST_PART_MAX))
+#define TEST_STATE_LEN    (TEST_FREQ_LEN + 6u * TEST_PART_MAX)
+
+static const uint16_t testTapsTbl[] = {1u, 17u, 100u, 1000u, 4096u};
+static const uint16_t testPartTbl[] = {16u, 64u, 256u, 1024u};
+
+static double    refCoeffs[TEST_TAPS_MAX];
+static double    refIn[TEST_LEN];
+static double    refOut[TEST_LEN];
+static float32_t coeffs[TEST_TAPS_MAX];         /* Time reversed */
+static float32_t coeffsFreq[TEST_FREQ_LEN];
+static float32_t state[TEST_STATE_LEN];
+static float32_t stateDirect[TEST_TAPS_MAX + TEST_LEN - 1];
+static float32_t testIn[TEST_LEN];
+static float32_t testOut[TEST_LEN];
+
+static void ref_fir(uint32_t numTaps)
+{
+  double   acc;
+  uint32_t i, k;
+
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    acc = 0.0;
+    for (k = 0u; (k < numTaps) && (k <= i); k++)
+    {
+      acc += refCoeffs[k] * refIn[i - k];
+    }
+    refOut[i] = acc;
+  }
+}
+
+/* Decaying random impulse response of unit energy, as a room response */
+static void fir_design(uint32_t numTaps)
+{
+  double   energy = 0.0;
+  uint32_t i;
+
+  test_rand_f64(refCoeffs, numTaps, 1.0);
+  for (i = 0u; i < numTaps; i++)
+  {
+    refCoeffs[i] *= exp(-3.0 * (double)i / (double)numTaps);
+    energy       += refCoeffs[i] * refCoeffs[i];
+  }
+  for (i = 0u; i < numTaps; i++)
+  {
+    refCoeffs[i] /= sqrt(energy);
+    coeffs[numTaps - 1u - i] = (float32_t)refCoeffs[i];
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+static void test_fir_fft(void)
+{
+  arm_fir_fft_instance_f32 s;
+  uint32_t                 it, ip, i, part;
+  double                   snr, snrMin;
+  char                     name[64];
+
+  TEST_CHECK(arm_fir_fft_init_f32(&s, 32u, coeffs, coeffsFreq, state, 8u) == ARM_MATH_ARGUMENT_ERROR);
+  TEST_CHECK(arm_fir_fft_init_f32(&s, 32u, coeffs, coeffsFreq, state, 100u) == ARM_MATH_ARGUMENT_ERROR);
+  TEST_CHECK(arm_fir_fft_init_f32(&s, 0u, coeffs, coeffsFreq, state, 64u) == ARM_MATH_ARGUMENT_ERROR);
+
+  test_rand_f64(refIn, TEST_LEN, 1.0);
+  test_f64_to_f32(refIn, testIn, TEST_LEN);
+  for (it = 0u; it < sizeof(testTapsTbl) / sizeof(testTapsTbl[0]); it++)
+  {
+    fir_design(testTapsTbl[it]);
+    ref_fir(testTapsTbl[it]);
+    snrMin = INFINITY;
+    for (ip = 0u; ip < sizeof(testPartTbl) / sizeof(testPartTbl[0]); ip++)
+    {
+      part = testPartTbl[ip];
+      TEST_CHECK(arm_fir_fft_init_f32(&s, testTapsTbl[it], coeffs, coeffsFreq, state, (uint16_t)part)
+                 == ARM_MATH_SUCCESS);
+      memset(testOut, 0, sizeof(testOut));
+      for (i = 0u; i < TEST_LEN; i += 2u * part)
+      {
+        arm_fir_fft_f32(&s, &testIn[i], &testOut[i], 2u * part);
+      }
+      snr    = test_snr_f32(refOut, testOut, TEST_LEN);
+      snrMin = (snr < snrMin) ? snr : snrMin;
+    }
+    snprintf(name, sizeof(name), "arm_fir_fft_f32, %u taps, partSize 16 to 1024", (unsigned)testTapsTbl[it]);
+    test_check_snr(name, snrMin, 110.0);
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  static const uint16_t    tapsTbl[] = {16u, 64u, 256u, 1024u, 4096u};
+  arm_fir_instance_f32     sDirect;
+  arm_fir_fft_instance_f32 s;
+  uint32_t                 it, ip, part;
+  char                     name[64];
+
+  test_rand_f64(refIn, TEST_LEN, 1.0);
+  test_f64_to_f32(refIn, testIn, TEST_LEN);
+  for (it = 0u; it < sizeof(tapsTbl) / sizeof(tapsTbl[0]); it++)
+  {
+    fir_design(tapsTbl[it]);
+    arm_fir_init_f32(&sDirect, tapsTbl[it], coeffs, stateDirect, TEST_LEN);
+    snprintf(name, sizeof(name), "arm_fir_f32, %u taps", (unsigned)tapsTbl[it]);
+    TEST_BENCH(name, TEST_LEN, arm_fir_f32(&sDirect, testIn, testOut, TEST_LEN));
+    for (ip = 1u; ip < sizeof(testPartTbl) / sizeof(testPartTbl[0]); ip++)
+    {
+      part = testPartTbl[ip];
+      (void)arm_fir_fft_init_f32(&s, tapsTbl[it], coeffs, coeffsFreq, state, (uint16_t)part);
+      snprintf(name, sizeof(name), "arm_fir_fft_f32, %u taps, partSize %u", (unsigned)tapsTbl[it],
+               (unsigned)part);
+      TEST_BENCH(name, TEST_LEN, arm_fir_fft_f32(&s, testIn, testOut, TEST_LEN));
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_fir_fft_test", argc, argv);
+  test_seed(1u);
+  test_fir_fft();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
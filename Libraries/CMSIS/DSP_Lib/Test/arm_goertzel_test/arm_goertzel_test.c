@@ -0,0 +1,456 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_goertzel_test.c
+*
+* Description:  Goertzel bank and sliding DFT against a direct DFT of the selected bins and the real FFT.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks arm_goertzel_f32/q31/q15() against a double precision DFT of the
+ * selected bins, with bins at DC, near a quarter of the sampling frequency,
+ * at the Nyquist frequency and above it, for even, odd and power of 2 frame
+ * lengths, both with the Goertzel filters and with the real FFT that the
+ * initialization function picks for many bins.  Checks arm_sdft_f32/q31/q15()
+ * against the DFT of the last frameLen samples after blocks of random sizes,
+ * with and without damping, and the drift of the undamped f32 resonators over
+ * 2^20 samples.  The fixed-point outputs are compared in LSB of their format,
+ * the DFT divided by 2^shift, and those of the Goertzel filters separately for
+ * the middle bins and for the bins next to DC and to the Nyquist frequency,
+ * whose input shift is larger.  With "bench" it compares, per frame, the
+ * Goertzel bank, the sliding DFT and arm_rfft_fast_f32() for 4 to 32 bins.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_LEN_MAX      4096u
+#define TEST_BINS_MAX       32u
+#define TEST_NUM_BINS        9u
+#define TEST_EDGE_BINS       4u                        /* Last bins of make_bins() */
+#define TEST_DRIFT_LEN    (1u << 20)
+#define TEST_PI           3.14159265358979323846      /* PI of arm_math.h is a float32_t */
+
+static const uint16_t testLenTbl[]   = {256u, 999u, 1000u, 1024u, 4096u};
+static const uint16_t testSdftTbl[]  = {256u, 999u};
+static const uint32_t testSplitTbl[] = {1u, 7u, 64u, 300u, 2u, 999u, 0u, 45u, 1u, 1u, 128u};
+
+static double    refIn[TEST_DRIFT_LEN];
+static double    refOut[2 * TEST_BINS_MAX];
+static float32_t f32In[TEST_DRIFT_LEN], f32Out[2 * TEST_BINS_MAX];
+static q31_t     q31In[4u * TEST_LEN_MAX], q31Out[2 * TEST_BINS_MAX];
+static q15_t     q15In[4u * TEST_LEN_MAX], q15Out[2 * TEST_BINS_MAX];
+static float32_t f32Coeffs[4 * TEST_BINS_MAX], f32State[2 * TEST_BINS_MAX], f32Delay[TEST_LEN_MAX];
+static q31_t     q31Coeffs[4 * TEST_BINS_MAX], q31State[2 * TEST_BINS_MAX], q31Delay[TEST_LEN_MAX];
+static q31_t     q15Coeffs[4 * TEST_BINS_MAX], q15State[2 * TEST_BINS_MAX];
+static q15_t     q15Delay[TEST_LEN_MAX];
+static float32_t scratch[2 * TEST_LEN_MAX];
+static uint16_t  bins[TEST_BINS_MAX];
+
+static void print_err(const char *name, double err, const char *unit, double errMax)
+{
+  printf("  %-48s %10.3g%s%s\n", name, err, (unit[0] != '\0') ? " " : "", unit);
+  test_check(err <= errMax, name, __FILE__, __LINE__);
+}
+
+/* Bins of the middle of the band, around a quarter of the sampling frequency
+   where the Goertzel filters switch to w - pi, then TEST_EDGE_BINS bins at DC
+   and at the Nyquist frequency, where the fixed-point filters lose precision */
+static void make_bins(uint16_t n)
+{
+  bins[0] = (uint16_t)(n / 4u - 1u);
+  bins[1] = (uint16_t)(n / 4u);
+  bins[2] = (uint16_t)(n / 4u + 1u);
+  bins[3] = (uint16_t)(n / 3u);
+  bins[4] = (uint16_t)((3u * n) / 4u + 3u);
+  bins[5] = 0u;
+  bins[6] = 1u;
+  bins[7] = (uint16_t)(n / 2u);
+  bins[8] = (uint16_t)(n - 1u);
+}
+
+/* DFT of the window pSrc[0 .. n-1] at the bins, its sample i weighted by
+   damping^(n-1-i); (k * i) mod n keeps the angles exact */
+static void ref_bins(const double *pSrc, uint32_t n, uint32_t numBins, double damping, double scale)
+{
+  double   re, im, w, a;
+  uint32_t b, i;
+
+  for (b = 0u; b < numBins; b++)
+  {
+    re = im = 0.0;
+    w  = 1.0;
+    for (i = n; i > 0u; i--)
+    {
+      a   = 2.0 * TEST_PI * (double)(((uint64_t)bins[b] * (i - 1u)) % n) / (double)n;
+      re += w * pSrc[i - 1u] * cos(a);
+      im -= w * pSrc[i - 1u] * sin(a);
+      w  *= damping;
+    }
+    refOut[2 * b]     = re * scale;
+    refOut[2 * b + 1] = im * scale;
+  }
+}
+
+/* Largest error in LSB of the output format, over the values first to first + n - 1 */
+static double max_err_q31(const q31_t *pTest, uint32_t first, uint32_t n)
+{
+  double   err = 0.0;
+  uint32_t i;
+
+  for (i = first; i < first + n; i++)
+  {
+    err = fmax(err, fabs((double)pTest[i] - refOut[i] * 2147483648.0));
+  }
+  return (err);
+}
+
+static double max_err_q15(const q15_t *pTest, uint32_t first, uint32_t n)
+{
+  double   err = 0.0;
+  uint32_t i;
+
+  for (i = first; i < first + n; i++)
+  {
+    err = fmax(err, fabs((double)pTest[i] - refOut[i] * 32768.0));
+  }
+  return (err);
+}
+
+/* Random inputs of the three formats, and their exact values in refIn */
+static void make_inputs(uint32_t n, uint32_t fmt)
+{
+  uint32_t i;
+
+  test_rand_f64(refIn, n, 0.999);
+  if (fmt == 0u)
+  {
+    test_f64_to_f32(refIn, f32In, n);
+    for (i = 0u; i < n; i++)
+    {
+      refIn[i] = (double)f32In[i];
+    }
+  }
+  else if (fmt == 1u)
+  {
+    test_f64_to_q31(refIn, q31In, n);
+    for (i = 0u; i < n; i++)
+    {
+      refIn[i] = (double)q31In[i] / 2147483648.0;
+    }
+  }
+  else
+  {
+    test_f64_to_q15(refIn, q15In, n);
+    for (i = 0u; i < n; i++)
+    {
+      refIn[i] = (double)q15In[i] / 32768.0;
+    }
+  }
+}
+
+static uint32_t log2_ceil(uint32_t n)
+{
+  uint32_t sh = 0u;
+
+  while ((1u << sh) < n)
+  {
+    sh++;
+  }
+  return (sh);
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+/* Goertzel filters (no scratch) and real FFT (scratch, 9 bins) */
+static void test_goertzel(void)
+{
+  arm_goertzel_instance_f32 sF32;
+  arm_goertzel_instance_q31 sQ31;
+  arm_goertzel_instance_q15 sQ15;
+  uint32_t                  ix, fft, n, path, fftCnt;
+  double                    err, errF32[2] = {0.0}, errQ31[2][2] = {{0.0}}, errQ15[2][2] = {{0.0}};
+  char                      name[64];
+
+  /* The errors are sorted by path (filters, FFT) and bins (middle, edges) */
+  for (fft = 0u; fft < 2u; fft++)
+  {
+    fftCnt = 0u;
+    for (ix = 0u; ix < sizeof(testLenTbl) / sizeof(testLenTbl[0]); ix++)
+    {
+      n = testLenTbl[ix];
+      make_bins((uint16_t)n);
+
+      make_inputs(n, 0u);
+      ref_bins(refIn, n, TEST_NUM_BINS, 1.0, 1.0);
+      TEST_CHECK(arm_goertzel_init_f32(&sF32, TEST_NUM_BINS, (uint16_t)n, bins, f32Coeffs,
+                                       (fft != 0u) ? scratch : NULL) == ARM_MATH_SUCCESS);
+      arm_goertzel_f32(&sF32, f32In, f32Out);
+      path         = (sF32.fftLen != 0u) ? 1u : 0u;
+      err          = test_max_err_f32(refOut, f32Out, 2u * TEST_NUM_BINS);
+      errF32[path] = fmax(errF32[path], err);
+      if ((fft == 0u) || (path != 0u))
+      {
+        snprintf(name, sizeof(name), "arm_goertzel_f32, %u%s, absolute", (unsigned)n, (path != 0u) ? ", FFT" : "");
+        printf("  %-48s %10.3g\n", name, err);
+      }
+
+      make_inputs(n, 1u);
+      ref_bins(refIn, n, TEST_NUM_BINS, 1.0, 1.0 / (double)(1u << log2_ceil(n)));
+      TEST_CHECK(arm_goertzel_init_q31(&sQ31, TEST_NUM_BINS, (uint16_t)n, bins, q31Coeffs,
+                                       (fft != 0u) ? scratch : NULL) == ARM_MATH_SUCCESS);
+      arm_goertzel_q31(&sQ31, q31In, q31Out);
+      errQ31[path][0] = fmax(errQ31[path][0], max_err_q31(q31Out, 0u, 2u * (TEST_NUM_BINS - TEST_EDGE_BINS)));
+      errQ31[path][1] = fmax(errQ31[path][1], max_err_q31(q31Out, 2u * (TEST_NUM_BINS - TEST_EDGE_BINS),
+                                                          2u * TEST_EDGE_BINS));
+
+      make_inputs(n, 2u);
+      ref_bins(refIn, n, TEST_NUM_BINS, 1.0, 1.0 / (double)(1u << log2_ceil(n)));
+      TEST_CHECK(arm_goertzel_init_q15(&sQ15, TEST_NUM_BINS, (uint16_t)n, bins, q15Coeffs,
+                                       (fft != 0u) ? scratch : NULL) == ARM_MATH_SUCCESS);
+      arm_goertzel_q15(&sQ15, q15In, q15Out);
+      errQ15[path][0] = fmax(errQ15[path][0], max_err_q15(q15Out, 0u, 2u * (TEST_NUM_BINS - TEST_EDGE_BINS)));
+      errQ15[path][1] = fmax(errQ15[path][1], max_err_q15(q15Out, 2u * (TEST_NUM_BINS - TEST_EDGE_BINS),
+                                                          2u * TEST_EDGE_BINS));
+
+      /* The FFT replaces the filters for the powers of 2 only */
+      fftCnt += ((sF32.fftLen != 0u) && (sQ31.fftLen != 0u) && (sQ15.fftLen != 0u)) ? 1u : 0u;
+      TEST_CHECK((sF32.fftLen == sQ31.fftLen) && (sQ31.fftLen == sQ15.fftLen));
+      TEST_CHECK((sF32.fftLen == 0u) || ((fft != 0u) && (sF32.fftLen == n) && ((n & (n - 1u)) == 0u)));
+    }
+    TEST_CHECK(fftCnt == ((fft != 0u) ? 3u : 0u));
+  }
+  print_err("arm_goertzel_f32, filters", errF32[0], "", 0.02);
+  print_err("arm_goertzel_f32, FFT", errF32[1], "", 1.0e-5);
+  print_err("arm_goertzel_q31, filters, middle bins", errQ31[0][0], "LSB", 250.0);
+  print_err("arm_goertzel_q31, filters, DC, 1, N/2, N-1", errQ31[0][1], "LSB", 2.0e5);
+  print_err("arm_goertzel_q31, FFT", fmax(errQ31[1][0], errQ31[1][1]), "LSB", 30.0);
+  print_err("arm_goertzel_q15, filters, middle bins", errQ15[0][0], "LSB", 1.0);
+  print_err("arm_goertzel_q15, filters, DC, 1, N/2, N-1", errQ15[0][1], "LSB", 6.0);
+  print_err("arm_goertzel_q15, FFT", fmax(errQ15[1][0], errQ15[1][1]), "LSB", 1.1);
+
+  /* Few bins keep the filters; the arguments */
+  make_bins(1024u);
+  TEST_CHECK(arm_goertzel_init_f32(&sF32, 2u, 1024u, bins, f32Coeffs, scratch) == ARM_MATH_SUCCESS);
+  TEST_CHECK(sF32.fftLen == 0u);
+  TEST_CHECK(arm_goertzel_init_f32(&sF32, 0u, 1024u, bins, f32Coeffs, NULL) == ARM_MATH_ARGUMENT_ERROR);
+  TEST_CHECK(arm_goertzel_init_q31(&sQ31, 2u, 0u, bins, q31Coeffs, NULL) == ARM_MATH_ARGUMENT_ERROR);
+  bins[1] = 1024u;
+  TEST_CHECK(arm_goertzel_init_q15(&sQ15, 2u, 1024u, bins, q15Coeffs, NULL) == ARM_MATH_ARGUMENT_ERROR);
+}
+
+/* Blocks of testSplitTbl over 4 windows and a half, compared after each block */
+static void test_sdft(void)
+{
+  arm_sdft_instance_f32 sF32;
+  arm_sdft_instance_q31 sQ31;
+  arm_sdft_instance_q15 sQ15;
+  uint32_t              ix, n, len, pos, cnt, blk, fmt, damped, start;
+  q31_t                 damp;
+  double                r, scale, err[2][3] = {{0.0}};
+  char                  name[64];
+
+  for (damped = 0u; damped < 2u; damped++)
+  {
+    for (ix = 0u; ix < sizeof(testSdftTbl) / sizeof(testSdftTbl[0]); ix++)
+    {
+      n     = testSdftTbl[ix];
+      len   = (9u * n) / 2u;
+      r     = (damped != 0u) ? 1.0 - 1.0 / (16.0 * (double)n) : 1.0;
+      scale = 1.0 / (double)(1u << ((log2_ceil(n) > 2u) ? log2_ceil(n) : 2u));
+      damp  = (damped != 0u) ? (q31_t)(r * 2147483648.0) : 0x7FFFFFFF;
+      make_bins((uint16_t)n);
+      for (fmt = 0u; fmt < 3u; fmt++)
+      {
+        /* The reference takes the damping as the kernel rounds it */
+        make_inputs(len, fmt);
+        if (fmt == 0u)
+        {
+          TEST_CHECK(arm_sdft_init_f32(&sF32, TEST_NUM_BINS, (uint16_t)n, bins, (float32_t)r,
+                                       f32Coeffs, f32State, f32Delay) == ARM_MATH_SUCCESS);
+        }
+        else if (fmt == 1u)
+        {
+          TEST_CHECK(arm_sdft_init_q31(&sQ31, TEST_NUM_BINS, (uint16_t)n, bins, damp,
+                                       q31Coeffs, q31State, q31Delay) == ARM_MATH_SUCCESS);
+        }
+        else
+        {
+          TEST_CHECK(arm_sdft_init_q15(&sQ15, TEST_NUM_BINS, (uint16_t)n, bins, damp,
+                                       q15Coeffs, q15State, q15Delay) == ARM_MATH_SUCCESS);
+        }
+        for (blk = 0u, pos = 0u; pos < len; blk++, pos += cnt)
+        {
+          cnt = testSplitTbl[blk % (sizeof(testSplitTbl) / sizeof(testSplitTbl[0]))];
+          cnt = (cnt < len - pos) ? cnt : len - pos;
+          if (fmt == 0u)
+          {
+            arm_sdft_f32(&sF32, f32In + pos, f32Out, cnt);
+          }
+          else if (fmt == 1u)
+          {
+            arm_sdft_q31(&sQ31, q31In + pos, q31Out, cnt);
+          }
+          else
+          {
+            arm_sdft_q15(&sQ15, q15In + pos, q15Out, cnt);
+          }
+
+          /* Window of the last frameLen samples, the first windows start with zeros */
+          if (pos + cnt >= n)
+          {
+            start = pos + cnt - n;
+            ref_bins(refIn + start, n, TEST_NUM_BINS, (fmt == 0u) ? (double)(float32_t)r : (double)damp / 2147483648.0,
+                     (fmt == 0u) ? 1.0 : scale);
+            err[damped][fmt] = fmax(err[damped][fmt],
+                                    (fmt == 0u) ? test_max_err_f32(refOut, f32Out, 2u * TEST_NUM_BINS) :
+                                    (fmt == 1u) ? max_err_q31(q31Out, 0u, 2u * TEST_NUM_BINS) :
+                                    max_err_q15(q15Out, 0u, 2u * TEST_NUM_BINS));
+          }
+        }
+      }
+    }
+    snprintf(name, sizeof(name), "arm_sdft_f32%s, absolute", (damped != 0u) ? ", damped" : "");
+    print_err(name, err[damped][0], "", (damped != 0u) ? 7.5e-4 : 3.0e-3);
+    snprintf(name, sizeof(name), "arm_sdft_q31%s", (damped != 0u) ? ", damped" : "");
+    print_err(name, err[damped][1], "LSB", 160.0);
+    snprintf(name, sizeof(name), "arm_sdft_q15%s", (damped != 0u) ? ", damped" : "");
+    print_err(name, err[damped][2], "LSB", 1.5);
+  }
+
+  TEST_CHECK(arm_sdft_init_f32(&sF32, 2u, 256u, bins, 1.5f, f32Coeffs, f32State, f32Delay) == ARM_MATH_ARGUMENT_ERROR);
+  TEST_CHECK(arm_sdft_init_f32(&sF32, 2u, 256u, bins, 0.0f, f32Coeffs, f32State, f32Delay) == ARM_MATH_ARGUMENT_ERROR);
+  TEST_CHECK(arm_sdft_init_q31(&sQ31, 2u, 256u, bins, 0, q31Coeffs, q31State, q31Delay) == ARM_MATH_ARGUMENT_ERROR);
+  bins[0] = 256u;
+  TEST_CHECK(arm_sdft_init_q15(&sQ15, 2u, 256u, bins, 0x7FFFFFFF, q15Coeffs, q15State, q15Delay) == ARM_MATH_ARGUMENT_ERROR);
+}
+
+/* 2^20 samples in blocks of 4096: the damping bounds the accumulated error */
+static void test_sdft_drift(void)
+{
+  arm_sdft_instance_f32 s;
+  uint32_t              damped, pos, n = 256u;
+  double                r, err[2];
+
+  make_inputs(TEST_DRIFT_LEN, 0u);
+  make_bins((uint16_t)n);
+  for (damped = 0u; damped < 2u; damped++)
+  {
+    r = (damped != 0u) ? 1.0 - 1.0 / (16.0 * (double)n) : 1.0;
+    (void)arm_sdft_init_f32(&s, TEST_NUM_BINS, (uint16_t)n, bins, (float32_t)r, f32Coeffs, f32State, f32Delay);
+    for (pos = 0u; pos < TEST_DRIFT_LEN; pos += 4096u)
+    {
+      arm_sdft_f32(&s, f32In + pos, f32Out, 4096u);
+    }
+    ref_bins(refIn + TEST_DRIFT_LEN - n, n, TEST_NUM_BINS, (double)(float32_t)r, 1.0);
+    err[damped] = test_max_err_f32(refOut, f32Out, 2u * TEST_NUM_BINS);
+  }
+  printf("  %-48s %10.3g\n", "arm_sdft_f32, 256, 2^20 samples, absolute", err[0]);
+  print_err("arm_sdft_f32, 256, 2^20 samples, damped", err[1], "", 2.0e-4);
+  TEST_CHECK(err[1] < err[0]);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  static const uint16_t lenTbl[] = {256u, 1024u};
+  static const uint16_t binTbl[] = {4u, 8u, 16u, 32u};
+  arm_goertzel_instance_f32  sF32;
+  arm_goertzel_instance_q31  sQ31;
+  arm_goertzel_instance_q15  sQ15;
+  arm_sdft_instance_f32      sSdft;
+  arm_rfft_fast_instance_f32 sRfft;
+  uint32_t                   ix, jx, i, n, nb;
+  char                       name[64];
+
+  make_inputs(TEST_LEN_MAX, 0u);
+  make_inputs(TEST_LEN_MAX, 1u);
+  make_inputs(TEST_LEN_MAX, 2u);
+  for (ix = 0u; ix < sizeof(lenTbl) / sizeof(lenTbl[0]); ix++)
+  {
+    n = lenTbl[ix];
+    (void)arm_rfft_fast_init_f32(&sRfft, (uint16_t)n);
+    snprintf(name, sizeof(name), "arm_rfft_fast_f32, %u, per frame", (unsigned)n);
+    TEST_BENCH(name, 1u, arm_rfft_fast_f32(&sRfft, f32In, scratch, 0u));
+    for (jx = 0u; jx < sizeof(binTbl) / sizeof(binTbl[0]); jx++)
+    {
+      nb = binTbl[jx];
+      for (i = 0u; i < nb; i++)
+      {
+        bins[i] = (uint16_t)(1u + (7u * i) % (n / 2u - 1u));
+      }
+      (void)arm_goertzel_init_f32(&sF32, (uint16_t)nb, (uint16_t)n, bins, f32Coeffs, NULL);
+      snprintf(name, sizeof(name), "arm_goertzel_f32, %u, %u bins", (unsigned)n, (unsigned)nb);
+      TEST_BENCH(name, 1u, arm_goertzel_f32(&sF32, f32In, f32Out));
+      (void)arm_goertzel_init_f32(&sF32, (uint16_t)nb, (uint16_t)n, bins, f32Coeffs, scratch);
+      snprintf(name, sizeof(name), "arm_goertzel_f32, %u, %u bins, %s", (unsigned)n, (unsigned)nb,
+               (sF32.fftLen != 0u) ? "FFT picked" : "filters picked");
+      TEST_BENCH(name, 1u, arm_goertzel_f32(&sF32, f32In, f32Out));
+      (void)arm_sdft_init_f32(&sSdft, (uint16_t)nb, (uint16_t)n, bins, 1.0f, f32Coeffs, f32State, f32Delay);
+      snprintf(name, sizeof(name), "arm_sdft_f32, %u, %u bins, per frame", (unsigned)n, (unsigned)nb);
+      TEST_BENCH(name, 1u, arm_sdft_f32(&sSdft, f32In, f32Out, n));
+      (void)arm_goertzel_init_q31(&sQ31, (uint16_t)nb, (uint16_t)n, bins, q31Coeffs, NULL);
+      snprintf(name, sizeof(name), "arm_goertzel_q31, %u, %u bins", (unsigned)n, (unsigned)nb);
+      TEST_BENCH(name, 1u, arm_goertzel_q31(&sQ31, q31In, q31Out));
+      (void)arm_goertzel_init_q15(&sQ15, (uint16_t)nb, (uint16_t)n, bins, q15Coeffs, NULL);
+      snprintf(name, sizeof(name), "arm_goertzel_q15, %u, %u bins", (unsigned)n, (unsigned)nb);
+      TEST_BENCH(name, 1u, arm_goertzel_q15(&sQ15, q15In, q15Out));
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_goertzel_test", argc, argv);
+  test_seed(1u);
+  test_goertzel();
+  test_sdft();
+  test_sdft_drift();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
@@ -0,0 +1,727 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_host_test.c
+*
+* Description:  Accuracy and benchmark of the kernels of each family on the host.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks one or more kernels of each family, BasicMathFunctions through
+ * TransformFunctions, against double precision references (SNR in dB), and
+ * with the "bench" argument measures the filters, transforms and products for
+ * several block sizes (ns per sample, ns per multiply-accumulate for the
+ * matrix product).
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "test_helper.h"
+
+#define TEST_LEN          1024u         /* Samples of the tests, largest benchmarked block */
+#define TEST_TAPS           32u         /* Taps of the FIR filters */
+#define TEST_STAGES          2u         /* Stages of the biquad cascades */
+#define TEST_BLOCK          64u         /* Block of the streaming tests */
+#define TEST_MAT_DIM        16u         /* Size of the matrix product test */
+#define TEST_INV_DIM         8u         /* Size of the matrix inverse test */
+#define TEST_CONV_A        256u         /* Lengths of the convolution and correlation */
+#define TEST_CONV_B         64u
+
+static const uint32_t testBlockTbl[] = {64u, 256u, 1024u};
+static const uint32_t testMatTbl[]   = {8u, 16u, 32u};
+
+static double    refIn[2 * TEST_LEN];
+static double    refIn2[2 * TEST_LEN];
+static double    refOut[2 * TEST_LEN];
+static float32_t f32In[2 * TEST_LEN];
+static float32_t f32In2[2 * TEST_LEN];
+static float32_t f32Out[2 * TEST_LEN];
+static q31_t     q31In[2 * TEST_LEN];
+static q31_t     q31In2[2 * TEST_LEN];
+static q31_t     q31Out[2 * TEST_LEN];
+static q15_t     q15In[2 * TEST_LEN];
+static q15_t     q15In2[2 * TEST_LEN];
+static q15_t     q15Out[2 * TEST_LEN];
+
+/* FIR and biquad filters, shared by the tests and the benchmarks */
+static double    firCoeffs[TEST_TAPS];
+static float32_t firCoeffsF32[TEST_TAPS];
+static q31_t     firCoeffsQ31[TEST_TAPS];
+static q15_t     firCoeffsQ15[TEST_TAPS];
+static float32_t firStateF32[TEST_TAPS + TEST_LEN - 1];
+static q31_t     firStateQ31[TEST_TAPS + TEST_LEN - 1];
+static q15_t     firStateQ15[TEST_TAPS + TEST_LEN];
+
+static double    iirCoeffs[5 * TEST_STAGES];
+static float32_t iirCoeffsF32[5 * TEST_STAGES];
+static q31_t     iirCoeffsQ31[5 * TEST_STAGES];
+static float32_t iirStateF32[2 * TEST_STAGES];
+static q31_t     iirStateQ31[4 * TEST_STAGES];
+
+static float32_t matA[TEST_LEN];
+static float32_t matB[TEST_LEN];
+static float32_t matC[TEST_LEN];
+
+/* ----------------------------------------------------------------------
+** References
+** ------------------------------------------------------------------- */
+
+/* Windowed-sinc low-pass of cutoff 'fc' (fraction of fs) and DC gain 'gain' */
+static void ref_lowpass(double *pH, uint32_t numTaps, double fc, double gain)
+{
+  double   m = (double)(numTaps - 1u) / 2.0, t, sum = 0.0;
+  uint32_t i;
+
+  for (i = 0u; i < numTaps; i++)
+  {
+    t     = (double)i - m;
+    pH[i] = ((t == 0.0) ? 2.0 * fc : sin(2.0 * PI * fc * t) / (PI * t)) *
+            (0.54 - 0.46 * cos(2.0 * PI * (double)i / (double)(numTaps - 1u)));
+    sum  += pH[i];
+  }
+  for (i = 0u; i < numTaps; i++)
+  {
+    pH[i] *= gain / sum;
+  }
+}
+
+static void ref_fir(const double *pH, uint32_t numTaps, const double *pX, double *pY, uint32_t n)
+{
+  double   acc;
+  uint32_t i, k;
+
+  for (i = 0u; i < n; i++)
+  {
+    acc = 0.0;
+    for (k = 0u; (k < numTaps) && (k <= i); k++)
+    {
+      acc += pH[k] * pX[i - k];
+    }
+    pY[i] = acc;
+  }
+}
+
+/* Biquad cascade, coefficients {b0, b1, b2, a1, a2} per stage with the CMSIS
+   sign convention: y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2] */
+static void ref_biquad(const double *pCoeffs, uint32_t numStages, const double *pX, double *pY, uint32_t n)
+{
+  double   x1, x2, y1, y2, x, y;
+  uint32_t i, s;
+
+  memcpy(pY, pX, n * sizeof(double));
+  for (s = 0u; s < numStages; s++)
+  {
+    x1 = x2 = y1 = y2 = 0.0;
+    for (i = 0u; i < n; i++)
+    {
+      x  = pY[i];
+      y  = pCoeffs[5 * s] * x + pCoeffs[5 * s + 1] * x1 + pCoeffs[5 * s + 2] * x2 +
+           pCoeffs[5 * s + 3] * y1 + pCoeffs[5 * s + 4] * y2;
+      x2 = x1; x1 = x;
+      y2 = y1; y1 = y;
+      pY[i] = y;
+    }
+  }
+}
+
+/* Gauss-Jordan inverse with partial pivoting, 'pA' is destroyed */
+static void ref_inverse(double *pA, double *pInv, uint32_t n)
+{
+  double   t;
+  uint32_t r, c, k, p;
+
+  for (r = 0u; r < n; r++)
+  {
+    for (c = 0u; c < n; c++)
+    {
+      pInv[r * n + c] = (r == c) ? 1.0 : 0.0;
+    }
+  }
+  for (c = 0u; c < n; c++)
+  {
+    p = c;
+    for (r = c + 1u; r < n; r++)
+    {
+      if (fabs(pA[r * n + c]) > fabs(pA[p * n + c]))
+      {
+        p = r;
+      }
+    }
+    for (k = 0u; k < n; k++)
+    {
+      t = pA[c * n + k];   pA[c * n + k]   = pA[p * n + k];   pA[p * n + k]   = t;
+      t = pInv[c * n + k]; pInv[c * n + k] = pInv[p * n + k]; pInv[p * n + k] = t;
+    }
+    t = pA[c * n + c];
+    for (k = 0u; k < n; k++)
+    {
+      pA[c * n + k]   /= t;
+      pInv[c * n + k] /= t;
+    }
+    for (r = 0u; r < n; r++)
+    {
+      if (r != c)
+      {
+        t = pA[r * n + c];
+        for (k = 0u; k < n; k++)
+        {
+          pA[r * n + k]   -= t * pA[c * n + k];
+          pInv[r * n + k] -= t * pInv[c * n + k];
+        }
+      }
+    }
+  }
+}
+
+static double snr_scalar(double ref, double out)
+{
+  return ((ref == out) ? INFINITY : 20.0 * log10(fabs(ref) / fabs(ref - out)));
+}
+
+/* RBJ low-pass and peaking sections, in the CMSIS sign convention */
+static void iir_design(void)
+{
+  double w0, alpha, a0, A;
+
+  w0    = 2.0 * PI * 0.1;                 /* Low-pass at fs/10, Q = 0.707 */
+  alpha = sin(w0) / (2.0 * 0.707);
+  a0    = 1.0 + alpha;
+  iirCoeffs[0] = (1.0 - cos(w0)) / 2.0 / a0;
+  iirCoeffs[1] = (1.0 - cos(w0)) / a0;
+  iirCoeffs[2] = iirCoeffs[0];
+  iirCoeffs[3] = 2.0 * cos(w0) / a0;
+  iirCoeffs[4] = -(1.0 - alpha) / a0;
+
+  w0    = 2.0 * PI * 0.05;                /* Peak of +6 dB at fs/20, Q = 2 */
+  A     = pow(10.0, 6.0 / 40.0);
+  alpha = sin(w0) / (2.0 * 2.0);
+  a0    = 1.0 + alpha / A;
+  iirCoeffs[5] = (1.0 + alpha * A) / a0;
+  iirCoeffs[6] = -2.0 * cos(w0) / a0;
+  iirCoeffs[7] = (1.0 - alpha * A) / a0;
+  iirCoeffs[8] = 2.0 * cos(w0) / a0;
+  iirCoeffs[9] = -(1.0 - alpha / A) / a0;
+}
+
+static void filters_init(void)
+{
+  double   half[5 * TEST_STAGES];
+  double   reversed[TEST_TAPS];
+  uint32_t i;
+
+  ref_lowpass(firCoeffs, TEST_TAPS, 0.2, 0.5);
+  for (i = 0u; i < TEST_TAPS; i++)              /* CMSIS takes the taps in reverse order */
+  {
+    reversed[i] = firCoeffs[TEST_TAPS - 1u - i];
+  }
+  test_f64_to_f32(reversed, firCoeffsF32, TEST_TAPS);
+  test_f64_to_q31(reversed, firCoeffsQ31, TEST_TAPS);
+  test_f64_to_q15(reversed, firCoeffsQ15, TEST_TAPS);
+
+  iir_design();
+  for (i = 0u; i < 5u * TEST_STAGES; i++)       /* Q31 coefficients halved, postShift 1 */
+  {
+    half[i] = iirCoeffs[i] / 2.0;
+  }
+  test_f64_to_f32(iirCoeffs, iirCoeffsF32, 5u * TEST_STAGES);
+  test_f64_to_q31(half, iirCoeffsQ31, 5u * TEST_STAGES);
+}
+
+/* ----------------------------------------------------------------------
+** Accuracy tests
+** ------------------------------------------------------------------- */
+
+static void test_basic(void)
+{
+  uint32_t i;
+
+  test_rand_f64(refIn, TEST_LEN, 0.9);
+  test_rand_f64(refIn2, TEST_LEN, 0.9);
+  test_f64_to_q15(refIn, q15In, TEST_LEN);
+  test_f64_to_q15(refIn2, q15In2, TEST_LEN);
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    refOut[i] = ((double)q15In[i] / 32768.0) * ((double)q15In2[i] / 32768.0);
+  }
+  arm_mult_q15(q15In, q15In2, q15Out, TEST_LEN);
+  test_check_snr("arm_mult_q15", test_snr_q15(refOut, q15Out, TEST_LEN), 80.0);
+
+  test_rand_f64(refIn, TEST_LEN, 0.5);
+  test_f64_to_q31(refIn, q31In, TEST_LEN);
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    refOut[i] = ((double)q31In[i] / 2147483648.0) * 1.5;
+  }
+  arm_scale_q31(q31In, 0x60000000, 1, q31Out, TEST_LEN);       /* 0.75 * 2^1 */
+  test_check_snr("arm_scale_q31", test_snr_q31(refOut, q31Out, TEST_LEN), 170.0);
+}
+
+static void test_dot_prod(void)
+{
+  double    ref;
+  float32_t outF32;
+  q63_t     outQ63;
+  uint32_t  i;
+
+  test_rand_f64(refIn, TEST_LEN, 1.0);
+  test_rand_f64(refIn2, TEST_LEN, 1.0);
+  test_f64_to_f32(refIn, f32In, TEST_LEN);
+  test_f64_to_f32(refIn2, f32In2, TEST_LEN);
+  ref = 0.0;
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    ref += (double)f32In[i] * (double)f32In2[i];
+  }
+  arm_dot_prod_f32(f32In, f32In2, TEST_LEN, &outF32);
+  test_check_snr("arm_dot_prod_f32", snr_scalar(ref, outF32), 100.0);
+
+  test_f64_to_q15(refIn, q15In, TEST_LEN);
+  test_f64_to_q15(refIn2, q15In2, TEST_LEN);
+  ref = 0.0;
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    ref += ((double)q15In[i] / 32768.0) * ((double)q15In2[i] / 32768.0);
+  }
+  arm_dot_prod_q15(q15In, q15In2, TEST_LEN, &outQ63);           /* 34.30 */
+  test_check_snr("arm_dot_prod_q15", snr_scalar(ref, (double)outQ63 / 1073741824.0), 200.0);
+}
+
+static void test_complex(void)
+{
+  uint32_t i;
+
+  test_rand_f64(refIn, 2u * TEST_LEN, 1.0);
+  test_f64_to_f32(refIn, f32In, 2u * TEST_LEN);
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    refOut[i] = sqrt((double)f32In[2 * i] * f32In[2 * i] + (double)f32In[2 * i + 1] * f32In[2 * i + 1]);
+  }
+  arm_cmplx_mag_f32(f32In, f32Out, TEST_LEN);
+  test_check_snr("arm_cmplx_mag_f32", test_snr_f32(refOut, f32Out, TEST_LEN), 130.0);
+
+  test_rand_f64(refIn2, 2u * TEST_LEN, 1.0);
+  test_f64_to_q31(refIn, q31In, 2u * TEST_LEN);
+  test_f64_to_q31(refIn2, q31In2, 2u * TEST_LEN);
+  for (i = 0u; i < TEST_LEN; i++)                               /* 3.29 output */
+  {
+    double ar = q31In[2 * i] / 2147483648.0, ai = q31In[2 * i + 1] / 2147483648.0;
+    double br = q31In2[2 * i] / 2147483648.0, bi = q31In2[2 * i + 1] / 2147483648.0;
+
+    refOut[2 * i]     = (ar * br - ai * bi) / 4.0;
+    refOut[2 * i + 1] = (ar * bi + ai * br) / 4.0;
+  }
+  arm_cmplx_mult_cmplx_q31(q31In, q31In2, q31Out, TEST_LEN);
+  test_check_snr("arm_cmplx_mult_cmplx_q31", test_snr_q31(refOut, q31Out, 2u * TEST_LEN), 150.0);
+}
+
+static void test_math(void)
+{
+  float32_t s, c;
+  uint32_t  i;
+
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    f32In[i]  = (float32_t)(2.0 * PI * (double)i / (double)TEST_LEN);
+    refOut[i] = sin((double)f32In[i]);
+    f32Out[i] = arm_sin_f32(f32In[i]);
+  }
+  test_check_snr("arm_sin_f32", test_snr_f32(refOut, f32Out, TEST_LEN), 90.0);
+
+  for (i = 0u; i < TEST_LEN; i++)               /* Degrees */
+  {
+    f32In[i] = (float32_t)(-180.0 + 360.0 * (double)i / (double)TEST_LEN);
+    arm_sin_cos_f32(f32In[i], &s, &c);
+    refOut[2 * i]     = sin((double)f32In[i] * PI / 180.0);
+    refOut[2 * i + 1] = cos((double)f32In[i] * PI / 180.0);
+    f32Out[2 * i]     = s;
+    f32Out[2 * i + 1] = c;
+  }
+  test_check_snr("arm_sin_cos_f32", test_snr_f32(refOut, f32Out, 2u * TEST_LEN), 80.0);
+}
+
+static void test_stats(void)
+{
+  double    mean, ref;
+  float32_t outF32;
+  q31_t     outQ31;
+  uint32_t  i;
+
+  test_rand_f64(refIn, TEST_LEN, 1.0);
+  test_f64_to_f32(refIn, f32In, TEST_LEN);
+  mean = 0.0;
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    mean += f32In[i];
+  }
+  mean /= TEST_LEN;
+  ref = 0.0;
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    ref += (f32In[i] - mean) * (f32In[i] - mean);
+  }
+  ref /= (TEST_LEN - 1u);
+  arm_var_f32(f32In, TEST_LEN, &outF32);
+  test_check_snr("arm_var_f32", snr_scalar(ref, outF32), 100.0);
+
+  test_rand_f64(refIn, TEST_LEN, 1.0 / 64.0);   /* Sum of the squares below 0.5 */
+  test_f64_to_q31(refIn, q31In, TEST_LEN);
+  ref = 0.0;
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    ref += ((double)q31In[i] / 2147483648.0) * ((double)q31In[i] / 2147483648.0);
+  }
+  ref = sqrt(ref / TEST_LEN);
+  arm_rms_q31(q31In, TEST_LEN, &outQ31);
+  test_check_snr("arm_rms_q31", snr_scalar(ref, (double)outQ31 / 2147483648.0), 80.0);
+}
+
+static void test_support(void)
+{
+  test_rand_f64(refIn, TEST_LEN, 1.0);
+  test_f64_to_f32(refIn, f32In, TEST_LEN);
+  arm_float_to_q15(f32In, q15Out, TEST_LEN);
+  test_check_snr("arm_float_to_q15", test_snr_q15(refIn, q15Out, TEST_LEN), 85.0);
+  arm_float_to_q31(f32In, q31Out, TEST_LEN);
+  test_check_snr("arm_float_to_q31", test_snr_q31(refIn, q31Out, TEST_LEN), 130.0);
+}
+
+static void test_fir(void)
+{
+  arm_fir_instance_f32 sF32;
+  arm_fir_instance_q31 sQ31;
+  arm_fir_instance_q15 sQ15;
+  uint32_t             i;
+
+  test_rand_f64(refIn, TEST_LEN, 0.9);
+  test_f64_to_f32(refIn, f32In, TEST_LEN);
+  test_f64_to_q31(refIn, q31In, TEST_LEN);
+  test_f64_to_q15(refIn, q15In, TEST_LEN);
+  ref_fir(firCoeffs, TEST_TAPS, refIn, refOut, TEST_LEN);
+
+  arm_fir_init_f32(&sF32, TEST_TAPS, firCoeffsF32, firStateF32, TEST_BLOCK);
+  arm_fir_init_q31(&sQ31, TEST_TAPS, firCoeffsQ31, firStateQ31, TEST_BLOCK);
+  TEST_CHECK(arm_fir_init_q15(&sQ15, TEST_TAPS, firCoeffsQ15, firStateQ15, TEST_BLOCK) == ARM_MATH_SUCCESS);
+  for (i = 0u; i < TEST_LEN; i += TEST_BLOCK)
+  {
+    arm_fir_f32(&sF32, &f32In[i], &f32Out[i], TEST_BLOCK);
+    arm_fir_q31(&sQ31, &q31In[i], &q31Out[i], TEST_BLOCK);
+    arm_fir_q15(&sQ15, &q15In[i], &q15Out[i], TEST_BLOCK);
+  }
+  test_check_snr("arm_fir_f32", test_snr_f32(refOut, f32Out, TEST_LEN), 120.0);
+  test_check_snr("arm_fir_q31", test_snr_q31(refOut, q31Out, TEST_LEN), 150.0);
+  test_check_snr("arm_fir_q15", test_snr_q15(refOut, q15Out, TEST_LEN), 70.0);
+}
+
+static void test_biquad(void)
+{
+  arm_biquad_cascade_df2T_instance_f32 sF32;
+  arm_biquad_casd_df1_inst_q31         sQ31;
+  uint32_t                             i;
+
+  test_rand_f64(refIn, TEST_LEN, 0.4);
+  test_f64_to_f32(refIn, f32In, TEST_LEN);
+  test_f64_to_q31(refIn, q31In, TEST_LEN);
+  ref_biquad(iirCoeffs, TEST_STAGES, refIn, refOut, TEST_LEN);
+
+  arm_biquad_cascade_df2T_init_f32(&sF32, TEST_STAGES, iirCoeffsF32, iirStateF32);
+  arm_biquad_cascade_df1_init_q31(&sQ31, TEST_STAGES, iirCoeffsQ31, iirStateQ31, 1);
+  for (i = 0u; i < TEST_LEN; i += TEST_BLOCK)
+  {
+    arm_biquad_cascade_df2T_f32(&sF32, &f32In[i], &f32Out[i], TEST_BLOCK);
+    arm_biquad_cascade_df1_q31(&sQ31, &q31In[i], &q31Out[i], TEST_BLOCK);
+  }
+  test_check_snr("arm_biquad_cascade_df2T_f32", test_snr_f32(refOut, f32Out, TEST_LEN), 110.0);
+  test_check_snr("arm_biquad_cascade_df1_q31", test_snr_q31(refOut, q31Out, TEST_LEN), 130.0);
+}
+
+static void test_conv(void)
+{
+  double   revB[TEST_CONV_B];
+  uint32_t i, k, outLen;
+
+  test_rand_f64(refIn, TEST_CONV_A, 1.0);
+  test_rand_f64(refIn2, TEST_CONV_B, 1.0);
+  test_f64_to_f32(refIn, f32In, TEST_CONV_A);
+  test_f64_to_f32(refIn2, f32In2, TEST_CONV_B);
+  outLen = TEST_CONV_A + TEST_CONV_B - 1u;
+  for (i = 0u; i < outLen; i++)
+  {
+    refOut[i] = 0.0;
+    for (k = 0u; k < TEST_CONV_B; k++)
+    {
+      if ((i >= k) && ((i - k) < TEST_CONV_A))
+      {
+        refOut[i] += refIn[i - k] * refIn2[k];
+      }
+    }
+  }
+  arm_conv_f32(f32In, TEST_CONV_A, f32In2, TEST_CONV_B, f32Out);
+  test_check_snr("arm_conv_f32", test_snr_f32(refOut, f32Out, outLen), 120.0);
+
+  for (k = 0u; k < TEST_CONV_B; k++)            /* Correlation: convolution with B reversed,  */
+  {                                             /* after 'lengthA - lengthB' leading zeros    */
+    revB[k] = refIn2[TEST_CONV_B - 1u - k];
+  }
+  for (i = 0u; i < TEST_CONV_A - TEST_CONV_B; i++)
+  {
+    refOut[i] = 0.0;
+  }
+  for (i = 0u; i < outLen; i++)
+  {
+    refOut[TEST_CONV_A - TEST_CONV_B + i] = 0.0;
+    for (k = 0u; k < TEST_CONV_B; k++)
+    {
+      if ((i >= k) && ((i - k) < TEST_CONV_A))
+      {
+        refOut[TEST_CONV_A - TEST_CONV_B + i] += refIn[i - k] * revB[k];
+      }
+    }
+  }
+  memset(f32Out, 0, sizeof(f32Out));            /* The leading zeros are not written */
+  arm_correlate_f32(f32In, TEST_CONV_A, f32In2, TEST_CONV_B, f32Out);
+  test_check_snr("arm_correlate_f32", test_snr_f32(refOut, f32Out, 2u * TEST_CONV_A - 1u), 120.0);
+}
+
+static void test_matrix(void)
+{
+  arm_matrix_instance_f32 a, b, c;
+  double                  refA[TEST_INV_DIM * TEST_INV_DIM];
+  uint32_t                r, col, k;
+
+  test_rand_f64(refIn, TEST_MAT_DIM * TEST_MAT_DIM, 1.0);
+  test_rand_f64(refIn2, TEST_MAT_DIM * TEST_MAT_DIM, 1.0);
+  test_f64_to_f32(refIn, matA, TEST_MAT_DIM * TEST_MAT_DIM);
+  test_f64_to_f32(refIn2, matB, TEST_MAT_DIM * TEST_MAT_DIM);
+  for (r = 0u; r < TEST_MAT_DIM; r++)
+  {
+    for (col = 0u; col < TEST_MAT_DIM; col++)
+    {
+      refOut[r * TEST_MAT_DIM + col] = 0.0;
+      for (k = 0u; k < TEST_MAT_DIM; k++)
+      {
+        refOut[r * TEST_MAT_DIM + col] += (double)matA[r * TEST_MAT_DIM + k] * matB[k * TEST_MAT_DIM + col];
+      }
+    }
+  }
+  arm_mat_init_f32(&a, TEST_MAT_DIM, TEST_MAT_DIM, matA);
+  arm_mat_init_f32(&b, TEST_MAT_DIM, TEST_MAT_DIM, matB);
+  arm_mat_init_f32(&c, TEST_MAT_DIM, TEST_MAT_DIM, matC);
+  TEST_CHECK(arm_mat_mult_f32(&a, &b, &c) == ARM_MATH_SUCCESS);
+  test_check_snr("arm_mat_mult_f32", test_snr_f32(refOut, matC, TEST_MAT_DIM * TEST_MAT_DIM), 125.0);
+
+  test_rand_f64(refA, TEST_INV_DIM * TEST_INV_DIM, 1.0);
+  for (r = 0u; r < TEST_INV_DIM; r++)           /* Well conditioned */
+  {
+    refA[r * TEST_INV_DIM + r] += 4.0;
+  }
+  test_f64_to_f32(refA, matA, TEST_INV_DIM * TEST_INV_DIM);
+  for (r = 0u; r < TEST_INV_DIM * TEST_INV_DIM; r++)
+  {
+    refA[r] = matA[r];
+  }
+  ref_inverse(refA, refOut, TEST_INV_DIM);
+  arm_mat_init_f32(&a, TEST_INV_DIM, TEST_INV_DIM, matA);
+  arm_mat_init_f32(&c, TEST_INV_DIM, TEST_INV_DIM, matC);
+  TEST_CHECK(arm_mat_inverse_f32(&a, &c) == ARM_MATH_SUCCESS);
+  test_check_snr("arm_mat_inverse_f32", test_snr_f32(refOut, matC, TEST_INV_DIM * TEST_INV_DIM), 110.0);
+}
+
+static void test_transform(void)
+{
+  arm_rfft_fast_instance_f32   sRfft;
+  arm_cfft_radix4_instance_q31 sQ31;
+  arm_cfft_radix4_instance_q15 sQ15;
+  uint32_t                     i;
+
+  test_rand_f64(refIn, 2u * TEST_LEN, 0.5);
+  test_dft_f64(refIn, refOut, TEST_LEN, 0u);
+  test_f64_to_f32(refIn, f32Out, 2u * TEST_LEN);
+  arm_cfft_f32(&arm_cfft_sR_f32_len1024, f32Out, 0, 1);
+  test_check_snr("arm_cfft_f32, 1024", test_snr_f32(refOut, f32Out, 2u * TEST_LEN), 120.0);
+
+  for (i = 0u; i < 2u * TEST_LEN; i++)          /* Output scaled by 1/N */
+  {
+    refOut[i] /= TEST_LEN;
+  }
+  test_f64_to_q31(refIn, q31Out, 2u * TEST_LEN);
+  TEST_CHECK(arm_cfft_radix4_init_q31(&sQ31, TEST_LEN, 0, 1) == ARM_MATH_SUCCESS);
+  arm_cfft_radix4_q31(&sQ31, q31Out);
+  test_check_snr("arm_cfft_radix4_q31, 1024", test_snr_q31(refOut, q31Out, 2u * TEST_LEN), 110.0);
+  test_f64_to_q15(refIn, q15Out, 2u * TEST_LEN);
+  TEST_CHECK(arm_cfft_radix4_init_q15(&sQ15, TEST_LEN, 0, 1) == ARM_MATH_SUCCESS);
+  arm_cfft_radix4_q15(&sQ15, q15Out);
+  test_check_snr("arm_cfft_radix4_q15, 1024", test_snr_q15(refOut, q15Out, 2u * TEST_LEN), 25.0);
+
+  for (i = 0u; i < TEST_LEN; i++)               /* Real input */
+  {
+    refIn2[2 * i]     = refIn[i];
+    refIn2[2 * i + 1] = 0.0;
+  }
+  test_dft_f64(refIn2, refOut, TEST_LEN, 0u);
+  refOut[1] = refOut[TEST_LEN];                 /* Packed: X[0], X[N/2] real, then X[1]... */
+  test_f64_to_f32(refIn, f32In, TEST_LEN);
+  TEST_CHECK(arm_rfft_fast_init_f32(&sRfft, TEST_LEN) == ARM_MATH_SUCCESS);
+  arm_rfft_fast_f32(&sRfft, f32In, f32Out, 0);
+  test_check_snr("arm_rfft_fast_f32, 1024", test_snr_f32(refOut, f32Out, TEST_LEN), 120.0);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench_filters(void)
+{
+  arm_fir_instance_f32                 firF32;
+  arm_fir_instance_q31                 firQ31;
+  arm_fir_instance_q15                 firQ15;
+  arm_biquad_cascade_df2T_instance_f32 iirF32;
+  arm_biquad_casd_df1_inst_q31         iirQ31;
+  float32_t                            dotF32;
+  q63_t                                dotQ63;
+  uint32_t                             ix, n;
+  char                                 name[64];
+
+  test_rand_f64(refIn, TEST_LEN, 0.4);
+  test_f64_to_f32(refIn, f32In, TEST_LEN);
+  test_f64_to_q31(refIn, q31In, TEST_LEN);
+  test_f64_to_q15(refIn, q15In, TEST_LEN);
+  for (ix = 0u; ix < sizeof(testBlockTbl) / sizeof(testBlockTbl[0]); ix++)
+  {
+    n = testBlockTbl[ix];
+    arm_fir_init_f32(&firF32, TEST_TAPS, firCoeffsF32, firStateF32, n);
+    arm_fir_init_q31(&firQ31, TEST_TAPS, firCoeffsQ31, firStateQ31, n);
+    (void)arm_fir_init_q15(&firQ15, TEST_TAPS, firCoeffsQ15, firStateQ15, n);
+    arm_biquad_cascade_df2T_init_f32(&iirF32, TEST_STAGES, iirCoeffsF32, iirStateF32);
+    arm_biquad_cascade_df1_init_q31(&iirQ31, TEST_STAGES, iirCoeffsQ31, iirStateQ31, 1);
+
+    snprintf(name, sizeof(name), "arm_fir_f32, %u taps, block %u", (unsigned)TEST_TAPS, (unsigned)n);
+    TEST_BENCH(name, n, arm_fir_f32(&firF32, f32In, f32Out, n));
+    snprintf(name, sizeof(name), "arm_fir_q31, %u taps, block %u", (unsigned)TEST_TAPS, (unsigned)n);
+    TEST_BENCH(name, n, arm_fir_q31(&firQ31, q31In, q31Out, n));
+    snprintf(name, sizeof(name), "arm_fir_q15, %u taps, block %u", (unsigned)TEST_TAPS, (unsigned)n);
+    TEST_BENCH(name, n, arm_fir_q15(&firQ15, q15In, q15Out, n));
+    snprintf(name, sizeof(name), "arm_biquad_cascade_df2T_f32, %u st, block %u", (unsigned)TEST_STAGES, (unsigned)n);
+    TEST_BENCH(name, n, arm_biquad_cascade_df2T_f32(&iirF32, f32In, f32Out, n));
+    snprintf(name, sizeof(name), "arm_biquad_cascade_df1_q31, %u st, block %u", (unsigned)TEST_STAGES, (unsigned)n);
+    TEST_BENCH(name, n, arm_biquad_cascade_df1_q31(&iirQ31, q31In, q31Out, n));
+    snprintf(name, sizeof(name), "arm_dot_prod_f32, block %u", (unsigned)n);
+    TEST_BENCH(name, n, arm_dot_prod_f32(f32In, f32In, n, &dotF32));
+    snprintf(name, sizeof(name), "arm_dot_prod_q15, block %u", (unsigned)n);
+    TEST_BENCH(name, n, arm_dot_prod_q15(q15In, q15In, n, &dotQ63));
+  }
+}
+
+static void bench_transforms(void)
+{
+  static const arm_cfft_instance_f32 *cfftTbl[] =
+  {
+    &arm_cfft_sR_f32_len64, &arm_cfft_sR_f32_len256, &arm_cfft_sR_f32_len1024
+  };
+  arm_rfft_fast_instance_f32   sRfft;
+  arm_cfft_radix4_instance_q31 sQ31;
+  arm_cfft_radix4_instance_q15 sQ15;
+  uint32_t                     ix, n;
+  char                         name[64];
+
+  test_rand_f64(refIn, 2u * TEST_LEN, 0.5);
+  test_f64_to_f32(refIn, f32In, 2u * TEST_LEN);
+  test_f64_to_q31(refIn, q31In, 2u * TEST_LEN);
+  test_f64_to_q15(refIn, q15In, 2u * TEST_LEN);
+  for (ix = 0u; ix < sizeof(testBlockTbl) / sizeof(testBlockTbl[0]); ix++)
+  {
+    n = testBlockTbl[ix];                       /* Forward + inverse, the data stays bounded */
+    snprintf(name, sizeof(name), "arm_cfft_f32, %u, forward + inverse", (unsigned)n);
+    TEST_BENCH(name, 2u * n, (arm_cfft_f32(cfftTbl[ix], f32In, 0, 1), arm_cfft_f32(cfftTbl[ix], f32In, 1, 1)));
+    (void)arm_rfft_fast_init_f32(&sRfft, (uint16_t)n);
+    snprintf(name, sizeof(name), "arm_rfft_fast_f32, %u, forward + inverse", (unsigned)n);
+    TEST_BENCH(name, 2u * n, (arm_rfft_fast_f32(&sRfft, f32In, f32Out, 0), arm_rfft_fast_f32(&sRfft, f32Out, f32In, 1)));
+    (void)arm_cfft_radix4_init_q31(&sQ31, (uint16_t)n, 0, 1);
+    snprintf(name, sizeof(name), "arm_cfft_radix4_q31, %u", (unsigned)n);
+    TEST_BENCH(name, n, arm_cfft_radix4_q31(&sQ31, q31In));
+    (void)arm_cfft_radix4_init_q15(&sQ15, (uint16_t)n, 0, 1);
+    snprintf(name, sizeof(name), "arm_cfft_radix4_q15, %u", (unsigned)n);
+    TEST_BENCH(name, n, arm_cfft_radix4_q15(&sQ15, q15In));
+  }
+}
+
+static void bench_matrix(void)
+{
+  arm_matrix_instance_f32 a, b, c;
+  uint32_t                ix, n;
+  char                    name[64];
+
+  test_rand_f64(refIn, TEST_LEN, 1.0);
+  test_f64_to_f32(refIn, matA, TEST_LEN);
+  test_f64_to_f32(refIn, matB, TEST_LEN);
+  for (ix = 0u; ix < sizeof(testMatTbl) / sizeof(testMatTbl[0]); ix++)
+  {
+    n = testMatTbl[ix];
+    arm_mat_init_f32(&a, (uint16_t)n, (uint16_t)n, matA);
+    arm_mat_init_f32(&b, (uint16_t)n, (uint16_t)n, matB);
+    arm_mat_init_f32(&c, (uint16_t)n, (uint16_t)n, matC);
+    snprintf(name, sizeof(name), "arm_mat_mult_f32, %ux%u, per MAC", (unsigned)n, (unsigned)n);
+    TEST_BENCH(name, n * n * n, arm_mat_mult_f32(&a, &b, &c));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_host_test", argc, argv);
+  test_seed(1u);
+  filters_init();
+  test_basic();
+  test_dot_prod();
+  test_complex();
+  test_math();
+  test_stats();
+  test_support();
+  test_fir();
+  test_biquad();
+  test_conv();
+  test_matrix();
+  test_transform();
+  if (test_bench_enabled())
+  {
+    bench_filters();
+    bench_transforms();
+    bench_matrix();
+  }
+  return (test_end());
+}
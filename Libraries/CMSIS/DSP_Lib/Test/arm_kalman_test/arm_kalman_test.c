@@ -0,0 +1,558 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_kalman_test.c
+*
+* Description:  Kalman filter against a long double filter and the matrix function chain.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Runs arm_kalman_predict_f32() and arm_kalman_update_f32() on constant
+ * acceleration models (3 axes, 9 states, and 4 axes with jerk, 16 states)
+ * measured in position with correlated noise, for 2000 steps, against the
+ * same filter in long double.  arm_kalman_update_scalar_f32() is run the same
+ * way with uncorrelated noise, and the chain of matrix functions it replaces
+ * (arm_mat_mult/trans/add/sub/inverse_f32) with correlated noise, to compare
+ * the errors.  Also checks the propagated state of an EKF, the symmetry of P
+ * and the errors.  With "bench" it compares one step with the chain.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_N_MAX       16u            /* States */
+#define TEST_M_MAX        4u            /* Measurements */
+#define TEST_STEPS     2000u
+#define TEST_DT        0.01
+
+typedef struct
+{
+  uint32_t axes;                        /* One position measurement per axis */
+  uint32_t order;                       /* States per axis */
+} test_model;
+
+static const test_model testModelTbl[] = {{3u, 3u}, {4u, 4u}};
+
+static float32_t   engState[TEST_N_MAX];
+static float32_t   engCov[TEST_N_MAX * TEST_N_MAX];
+static float32_t   engTrans[TEST_N_MAX * TEST_N_MAX];
+static float32_t   engQ[TEST_N_MAX * TEST_N_MAX];
+static float32_t   engArena[TEST_N_MAX * TEST_N_MAX + TEST_N_MAX + TEST_M_MAX * TEST_M_MAX +
+                            TEST_M_MAX * TEST_N_MAX + TEST_M_MAX];
+static float32_t   engH[TEST_M_MAX * TEST_N_MAX];
+static float32_t   engR[TEST_M_MAX * TEST_M_MAX];
+static float32_t   engZ[TEST_M_MAX];
+
+static long double refState[TEST_N_MAX];
+static long double refCov[TEST_N_MAX * TEST_N_MAX];
+static double      trueState[TEST_N_MAX];
+static double      rChol[TEST_M_MAX * TEST_M_MAX];
+static double      meas[TEST_STEPS][TEST_M_MAX];
+
+/* ----------------------------------------------------------------------
+** Model: per axis, F is the Taylor expansion over TEST_DT of 'order'
+** derivatives, Q is diagonal; R is 0.01 * 0.5^|i - j|, or 0.01 * I.
+** ------------------------------------------------------------------- */
+
+static void model_init(const test_model *pModel, uint32_t correlated)
+{
+  uint32_t n = pModel->axes * pModel->order, m = pModel->axes, i, j, k;
+  double   c;
+
+  memset(engTrans, 0, sizeof(engTrans));
+  memset(engQ, 0, sizeof(engQ));
+  memset(engH, 0, sizeof(engH));
+  for (i = 0u; i < n; i++)
+  {
+    c = 1.0;
+    for (j = i; j < n - n % pModel->order && j / pModel->order == i / pModel->order; j++)
+    {
+      engTrans[i * n + j] = (float32_t)c;
+      c *= TEST_DT / (double)(j - i + 1u);
+    }
+    engQ[i * n + i] = (float32_t)(1e-4 * TEST_DT);
+  }
+  for (i = 0u; i < m; i++)
+  {
+    engH[i * n + i * pModel->order] = 1.0f;
+    for (j = 0u; j < m; j++)
+    {
+      c = (correlated != 0u) ? pow(0.5, fabs((double)i - (double)j)) : (double)(i == j);
+      engR[i * m + j] = (float32_t)(0.01 * c);
+    }
+  }
+
+  /* Cholesky factor of R, to draw the measurement noise */
+  memset(rChol, 0, sizeof(rChol));
+  for (j = 0u; j < m; j++)
+  {
+    for (i = j; i < m; i++)
+    {
+      c = (double)engR[i * m + j];
+      for (k = 0u; k < j; k++)
+      {
+        c -= rChol[i * m + k] * rChol[j * m + k];
+      }
+      rChol[i * m + j] = (i == j) ? sqrt(c) : c / rChol[j * m + j];
+    }
+  }
+
+  /* Trajectory with a random acceleration, and its measurements */
+  memset(trueState, 0, sizeof(trueState));
+  for (k = 0u; k < TEST_STEPS; k++)
+  {
+    double x[TEST_N_MAX], w[TEST_M_MAX];
+
+    for (i = 0u; i < n; i++)
+    {
+      x[i] = 0.0;
+      for (j = 0u; j < n; j++)
+      {
+        x[i] += (double)engTrans[i * n + j] * trueState[j];
+      }
+    }
+    test_rand_f64(w, m, 1.0);
+    for (i = 0u; i < n; i++)
+    {
+      trueState[i] = x[i] + ((i % pModel->order == 2u) ? 0.01 * w[i / pModel->order] : 0.0);
+    }
+    test_rand_f64(w, m, sqrt(3.0));             /* Unit variance */
+    for (i = 0u; i < m; i++)
+    {
+      meas[k][i] = trueState[i * pModel->order];
+      for (j = 0u; j <= i; j++)
+      {
+        meas[k][i] += rChol[i * m + j] * w[j];
+      }
+    }
+  }
+}
+
+static void filter_init(uint32_t n)
+{
+  uint32_t i;
+
+  memset(engState, 0, sizeof(engState));
+  memset(engCov, 0, sizeof(engCov));
+  for (i = 0u; i < n; i++)
+  {
+    engCov[i * n + i] = 10.0f;
+  }
+  for (i = 0u; i < n * n; i++)
+  {
+    refCov[i] = engCov[i];
+  }
+  for (i = 0u; i < n; i++)
+  {
+    refState[i] = 0.0L;
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Reference: the textbook filter, K = P * H' * S^-1, in long double
+** ------------------------------------------------------------------- */
+
+static void ref_step(uint32_t n, uint32_t m, const double *pZ)
+{
+  long double t[TEST_N_MAX * TEST_N_MAX], x[TEST_N_MAX], pht[TEST_N_MAX * TEST_M_MAX];
+  long double s[TEST_M_MAX * (TEST_M_MAX + TEST_N_MAX + 1u)], c;
+  uint32_t    w = m + n + 1u, i, j, k;
+
+  /* x = F * x, P = F * P * F' + Q */
+  for (i = 0u; i < n; i++)
+  {
+    x[i] = 0.0L;
+    for (k = 0u; k < n; k++)
+    {
+      x[i] += (long double)engTrans[i * n + k] * refState[k];
+    }
+    for (j = 0u; j < n; j++)
+    {
+      t[i * n + j] = 0.0L;
+      for (k = 0u; k < n; k++)
+      {
+        t[i * n + j] += (long double)engTrans[i * n + k] * refCov[k * n + j];
+      }
+    }
+  }
+  for (i = 0u; i < n; i++)
+  {
+    refState[i] = x[i];
+    for (j = 0u; j < n; j++)
+    {
+      c = engQ[i * n + j];
+      for (k = 0u; k < n; k++)
+      {
+        c += t[i * n + k] * (long double)engTrans[j * n + k];
+      }
+      refCov[i * n + j] = c;
+    }
+  }
+
+  /* [S | (P * H')' | y] with S = H * P * H' + R, y = z - H * x */
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j < m; j++)
+    {
+      pht[i * m + j] = 0.0L;
+      for (k = 0u; k < n; k++)
+      {
+        pht[i * m + j] += refCov[i * n + k] * (long double)engH[j * n + k];
+      }
+    }
+  }
+  for (i = 0u; i < m; i++)
+  {
+    for (j = 0u; j < m; j++)
+    {
+      c = engR[i * m + j];
+      for (k = 0u; k < n; k++)
+      {
+        c += (long double)engH[i * n + k] * pht[k * m + j];
+      }
+      s[i * w + j] = c;
+    }
+    for (j = 0u; j < n; j++)
+    {
+      s[i * w + m + j] = pht[j * m + i];
+    }
+    c = pZ[i];
+    for (k = 0u; k < n; k++)
+    {
+      c -= (long double)engH[i * n + k] * refState[k];
+    }
+    s[i * w + m + n] = c;
+  }
+
+  /* Gauss-Jordan: S^-1 * [P * H' | y]' (S is SPD, no pivoting) */
+  for (k = 0u; k < m; k++)
+  {
+    c = s[k * w + k];
+    for (j = 0u; j < w; j++)
+    {
+      s[k * w + j] /= c;
+    }
+    for (i = 0u; i < m; i++)
+    {
+      if (i != k)
+      {
+        c = s[i * w + k];
+        for (j = 0u; j < w; j++)
+        {
+          s[i * w + j] -= c * s[k * w + j];
+        }
+      }
+    }
+  }
+
+  /* x += P * H' * S^-1 * y, P -= P * H' * S^-1 * H * P */
+  for (i = 0u; i < n; i++)
+  {
+    for (k = 0u; k < m; k++)
+    {
+      refState[i] += pht[i * m + k] * s[k * w + m + n];
+    }
+  }
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      c = 0.0L;
+      for (k = 0u; k < m; k++)
+      {
+        c += pht[i * m + k] * s[k * w + m + j];
+      }
+      t[i * n + j] = c;
+    }
+  }
+  for (i = 0u; i < n; i++)                      /* Symmetric, as the filter keeps it */
+  {
+    for (j = 0u; j < n; j++)
+    {
+      refCov[i * n + j] -= 0.5L * (t[i * n + j] + t[j * n + i]);
+    }
+  }
+}
+
+/* max |engine - reference| / max |reference| of the state and of P */
+static void step_err(uint32_t n, double *pErrState, double *pErrCov)
+{
+  double   err = 0.0, norm = 0.0;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    err  = fmax(err, fabs((double)(engState[i] - refState[i])));
+    norm = fmax(norm, fabs((double)refState[i]));
+  }
+  *pErrState = fmax(*pErrState, err / norm);
+  err = norm = 0.0;
+  for (i = 0u; i < n * n; i++)
+  {
+    err  = fmax(err, fabs((double)(engCov[i] - refCov[i])));
+    norm = fmax(norm, fabs((double)refCov[i]));
+  }
+  *pErrCov = fmax(*pErrCov, err / norm);
+}
+
+/* ----------------------------------------------------------------------
+** The chain of matrix functions that the filter replaces
+** ------------------------------------------------------------------- */
+
+static float32_t naiveFt[TEST_N_MAX * TEST_N_MAX], naiveHt[TEST_N_MAX * TEST_M_MAX];
+static float32_t naiveT1[TEST_N_MAX * TEST_N_MAX], naiveT2[TEST_N_MAX * TEST_N_MAX];
+static float32_t naiveX[TEST_N_MAX], naiveS[TEST_M_MAX * TEST_M_MAX], naiveSi[TEST_M_MAX * TEST_M_MAX];
+static float32_t naiveK[TEST_N_MAX * TEST_M_MAX], naiveY[TEST_M_MAX];
+
+static void naive_step(uint32_t n, uint32_t m)
+{
+  arm_matrix_instance_f32 f, ft, q, p, x, h, ht, r, z, t1, t2, xp, s, si, k, y, hx, kh;
+
+  arm_mat_init_f32(&f, n, n, engTrans);
+  arm_mat_init_f32(&ft, n, n, naiveFt);
+  arm_mat_init_f32(&q, n, n, engQ);
+  arm_mat_init_f32(&p, n, n, engCov);
+  arm_mat_init_f32(&x, n, 1u, engState);
+  arm_mat_init_f32(&xp, n, 1u, naiveX);
+  arm_mat_init_f32(&h, m, n, engH);
+  arm_mat_init_f32(&ht, n, m, naiveHt);
+  arm_mat_init_f32(&r, m, m, engR);
+  arm_mat_init_f32(&z, m, 1u, engZ);
+  arm_mat_init_f32(&s, m, m, naiveS);
+  arm_mat_init_f32(&si, m, m, naiveSi);
+  arm_mat_init_f32(&k, n, m, naiveK);
+  arm_mat_init_f32(&y, m, 1u, naiveY);
+
+  /* Predict */
+  arm_mat_mult_f32(&f, &x, &xp);
+  arm_mat_trans_f32(&f, &ft);
+  arm_mat_init_f32(&t1, n, n, naiveT1);
+  arm_mat_init_f32(&t2, n, n, naiveT2);
+  arm_mat_mult_f32(&f, &p, &t1);
+  arm_mat_mult_f32(&t1, &ft, &t2);
+  arm_mat_add_f32(&t2, &q, &p);
+
+  /* S = H * P * H' + R, K = P * H' * S^-1 */
+  arm_mat_trans_f32(&h, &ht);
+  arm_mat_init_f32(&t1, n, m, naiveT1);
+  arm_mat_mult_f32(&p, &ht, &t1);
+  arm_mat_init_f32(&t2, m, m, naiveT2);
+  arm_mat_mult_f32(&h, &t1, &t2);
+  arm_mat_add_f32(&t2, &r, &s);
+  (void)arm_mat_inverse_f32(&s, &si);
+  arm_mat_mult_f32(&t1, &si, &k);
+
+  /* x = x + K * (z - H * x) */
+  arm_mat_init_f32(&hx, m, 1u, naiveT2);
+  arm_mat_mult_f32(&h, &xp, &hx);
+  arm_mat_sub_f32(&z, &hx, &y);
+  arm_mat_mult_f32(&k, &y, &x);
+  arm_mat_add_f32(&x, &xp, &x);
+
+  /* P = P - K * H * P */
+  arm_mat_init_f32(&kh, n, n, naiveT1);
+  arm_mat_mult_f32(&k, &h, &kh);
+  arm_mat_init_f32(&t2, n, n, naiveT2);
+  arm_mat_mult_f32(&kh, &p, &t2);
+  arm_mat_sub_f32(&p, &t2, &p);
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+static void test_filter(void)
+{
+  static const char       *modeTbl[3] = {"arm_kalman_update_f32", "arm_kalman_update_scalar_f32", "arm_mat_* chain"};
+  arm_kalman_instance_f32 S;
+  arm_matrix_instance_f32 h, r;
+  double                  errState, errCov;
+  uint32_t                ix, n, m, i, step, mode, fails = 0u;
+  char                    name[64];
+
+  for (ix = 0u; ix < sizeof(testModelTbl) / sizeof(testModelTbl[0]); ix++)
+  {
+    n = testModelTbl[ix].axes * testModelTbl[ix].order;
+    m = testModelTbl[ix].axes;
+
+    /* The vector update and the chain with a correlated R, the scalar update with a diagonal one */
+    for (mode = 0u; mode < 3u; mode++)
+    {
+      model_init(&testModelTbl[ix], (mode != 1u) ? 1u : 0u);
+      filter_init(n);
+      arm_kalman_init_f32(&S, (uint16_t)n, (uint16_t)m, engState, engCov, engTrans, engQ, engArena);
+      arm_mat_init_f32(&h, m, n, engH);
+      arm_mat_init_f32(&r, m, m, engR);
+      errState = errCov = 0.0;
+      for (step = 0u; step < TEST_STEPS; step++)
+      {
+        test_f64_to_f32(meas[step], engZ, m);
+        if (mode == 2u)
+        {
+          naive_step(n, m);
+        }
+        else
+        {
+          arm_kalman_predict_f32(&S, NULL);
+        }
+        if (mode == 0u)
+        {
+          fails += (arm_kalman_update_f32(&S, &h, engZ, &r) != ARM_MATH_SUCCESS) ? 1u : 0u;
+        }
+        for (i = 0u; (mode == 1u) && (i < m); i++)
+        {
+          fails += (arm_kalman_update_scalar_f32(&S, engH + i * n, engZ[i], engR[i * m + i]) != ARM_MATH_SUCCESS) ? 1u : 0u;
+        }
+        ref_step(n, m, meas[step]);
+        if (step >= 10u)                        /* After the initial covariance has shrunk */
+        {
+          step_err(n, &errState, &errCov);
+        }
+      }
+      snprintf(name, sizeof(name), "%s, n %u m %u, state", modeTbl[mode], (unsigned)n, (unsigned)m);
+      printf("  %-48s %10.3g\n", name, errState);
+      snprintf(name, sizeof(name), "%s, n %u m %u, P", modeTbl[mode], (unsigned)n, (unsigned)m);
+      printf("  %-48s %10.3g\n", name, errCov);
+      TEST_CHECK(errState < 1e-3);
+      TEST_CHECK(errCov < 1e-3);
+    }
+  }
+  TEST_CHECK(fails == 0u);
+}
+
+
+static void test_predict(void)
+{
+  arm_kalman_instance_f32 S;
+  arm_matrix_instance_f32 h, r;
+  float32_t               pred[TEST_N_MAX], cov[TEST_N_MAX * TEST_N_MAX];
+  double                  state[TEST_N_MAX];
+  uint32_t                n = 9u, i, j, asym = 0u;
+  arm_status              status;
+
+  /* A state propagated by the application replaces F * x, P is the same */
+  model_init(&testModelTbl[0], 1u);
+  filter_init(n);
+  test_rand_f64(state, n, 1.0);
+  test_f64_to_f32(state, engState, n);
+  arm_kalman_init_f32(&S, (uint16_t)n, 3u, engState, engCov, engTrans, engQ, engArena);
+  arm_kalman_predict_f32(&S, NULL);
+  memcpy(pred, engState, sizeof(pred));
+  memcpy(cov, engCov, sizeof(cov));
+  test_f64_to_f32(state, engState, n);
+  filter_init(n);
+  arm_kalman_predict_f32(&S, pred);
+  TEST_CHECK(memcmp(engState, pred, n * sizeof(float32_t)) == 0);
+  TEST_CHECK(memcmp(engCov, cov, n * n * sizeof(float32_t)) == 0);
+
+  /* P stays exactly symmetric */
+  for (i = 0u; i < 3u; i++)
+  {
+    (void)arm_kalman_update_scalar_f32(&S, engH + i * n, 0.5f, 0.01f);
+  }
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      asym += (engCov[i * n + j] != engCov[j * n + i]) ? 1u : 0u;
+    }
+  }
+  TEST_CHECK(asym == 0u);
+
+  /* Errors: an innovation variance that is not positive, R not positive definite */
+  status = arm_kalman_update_scalar_f32(&S, engH, 0.5f, -100.0f);
+  TEST_CHECK(status == ARM_MATH_SINGULAR);
+  engR[4] = -1.0f;
+  arm_mat_init_f32(&h, 3u, n, engH);
+  arm_mat_init_f32(&r, 3u, 3u, engR);
+  TEST_CHECK(arm_kalman_update_f32(&S, &h, engZ, &r) == ARM_MATH_DECOMPOSITION_FAILURE);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  arm_kalman_instance_f32 S;
+  arm_matrix_instance_f32 h, r;
+  float32_t               state[TEST_N_MAX], cov[TEST_N_MAX * TEST_N_MAX];
+  uint32_t                ix, n, m, i;
+  char                    name[64];
+
+  for (ix = 0u; ix < sizeof(testModelTbl) / sizeof(testModelTbl[0]); ix++)
+  {
+    n = testModelTbl[ix].axes * testModelTbl[ix].order;
+    m = testModelTbl[ix].axes;
+    model_init(&testModelTbl[ix], 1u);
+    filter_init(n);
+    arm_kalman_init_f32(&S, (uint16_t)n, (uint16_t)m, engState, engCov, engTrans, engQ, engArena);
+    arm_mat_init_f32(&h, m, n, engH);
+    arm_mat_init_f32(&r, m, m, engR);
+    for (i = 0u; i < 100u; i++)                 /* Steady state */
+    {
+      test_f64_to_f32(meas[i], engZ, m);
+      arm_kalman_predict_f32(&S, NULL);
+      (void)arm_kalman_update_f32(&S, &h, engZ, &r);
+    }
+    memcpy(state, engState, sizeof(state));
+    memcpy(cov, engCov, sizeof(cov));
+
+    /* Each step restarts from the same state, so that both run the same numbers */
+    snprintf(name, sizeof(name), "arm_kalman_predict + update_f32, n %u m %u", (unsigned)n, (unsigned)m);
+    TEST_BENCH(name, 1u, (memcpy(engState, state, sizeof(state)), memcpy(engCov, cov, sizeof(cov)),
+                          arm_kalman_predict_f32(&S, NULL), (void)arm_kalman_update_f32(&S, &h, engZ, &r)));
+    snprintf(name, sizeof(name), "arm_mat_* chain, n %u m %u", (unsigned)n, (unsigned)m);
+    TEST_BENCH(name, 1u, (memcpy(engState, state, sizeof(state)), memcpy(engCov, cov, sizeof(cov)),
+                          naive_step(n, m)));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_kalman_test", argc, argv);
+  test_seed(1u);
+  test_filter();
+  test_predict();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
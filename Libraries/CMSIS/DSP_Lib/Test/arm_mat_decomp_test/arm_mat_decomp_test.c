@@ -0,0 +1,478 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_mat_decomp_test.c
+*
+* Description:  Cholesky, LDL^T and QR decompositions and triangular solvers.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks arm_mat_cholesky, arm_mat_ldlt, arm_mat_qr and the triangular
+ * solvers, in float32 and float64, for sizes 4 to 32: the factors must
+ * rebuild the input, Q must be orthogonal, the solutions must have a small
+ * backward error, the results must be the same in place, and indefinite
+ * inputs must fail.  A symmetric positive definite system is also solved with
+ * arm_mat_inverse and arm_mat_mult, as the library did before, to compare the
+ * residuals.  With "bench" it compares both ways of solving, per system.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_N_MAX       32u
+#define TEST_RHS          3u            /* Right-hand sides */
+
+static const uint16_t testSizeTbl[] = {4u, 8u, 16u, 32u};
+
+static float32_t bufF32[4][TEST_N_MAX * TEST_N_MAX];
+static float64_t bufF64[4][TEST_N_MAX * TEST_N_MAX];
+static double    refA[TEST_N_MAX * TEST_N_MAX];
+static double    refL[TEST_N_MAX * TEST_N_MAX];
+static double    refD[TEST_N_MAX * TEST_N_MAX];
+static double    refQ[TEST_N_MAX * TEST_N_MAX];
+static double    refB[TEST_N_MAX * TEST_RHS];
+static double    refX[TEST_N_MAX * TEST_RHS];
+static double    work[2][TEST_N_MAX * TEST_N_MAX];
+
+/* ----------------------------------------------------------------------
+** Each function in either precision, on double buffers; 'f64' selects the
+** float64 function.  Buffer 0 is the input, buffer 1 the first output.
+** ------------------------------------------------------------------- */
+
+static void to_buf(uint32_t ix, const double *pSrc, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    bufF32[ix][i] = (float32_t)pSrc[i];
+    bufF64[ix][i] = pSrc[i];
+  }
+}
+
+static void from_buf(uint32_t f64, uint32_t ix, double *pDst, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    pDst[i] = (f64 != 0u) ? bufF64[ix][i] : (double)bufF32[ix][i];
+  }
+}
+
+static arm_status run_cholesky(uint32_t f64, const double *pA, double *pL, uint32_t n, uint32_t inPlace)
+{
+  arm_matrix_instance_f32 a32, l32;
+  arm_matrix_instance_f64 a64, l64;
+  uint32_t                ixL = (inPlace != 0u) ? 0u : 1u;
+  arm_status              status;
+
+  to_buf(0u, pA, n * n);
+  arm_mat_init_f32(&a32, (uint16_t)n, (uint16_t)n, bufF32[0]);
+  arm_mat_init_f32(&l32, (uint16_t)n, (uint16_t)n, bufF32[ixL]);
+  arm_mat_init_f64(&a64, (uint16_t)n, (uint16_t)n, bufF64[0]);
+  arm_mat_init_f64(&l64, (uint16_t)n, (uint16_t)n, bufF64[ixL]);
+  status = (f64 != 0u) ? arm_mat_cholesky_f64(&a64, &l64) : arm_mat_cholesky_f32(&a32, &l32);
+  from_buf(f64, ixL, pL, n * n);
+  return (status);
+}
+
+static arm_status run_ldlt(uint32_t f64, const double *pA, double *pL, double *pD, uint16_t *pPerm, uint32_t n)
+{
+  arm_matrix_instance_f32 a32, l32, d32;
+  arm_matrix_instance_f64 a64, l64, d64;
+  arm_status              status;
+
+  to_buf(0u, pA, n * n);
+  arm_mat_init_f32(&a32, (uint16_t)n, (uint16_t)n, bufF32[0]);
+  arm_mat_init_f32(&l32, (uint16_t)n, (uint16_t)n, bufF32[1]);
+  arm_mat_init_f32(&d32, (uint16_t)n, (uint16_t)n, bufF32[2]);
+  arm_mat_init_f64(&a64, (uint16_t)n, (uint16_t)n, bufF64[0]);
+  arm_mat_init_f64(&l64, (uint16_t)n, (uint16_t)n, bufF64[1]);
+  arm_mat_init_f64(&d64, (uint16_t)n, (uint16_t)n, bufF64[2]);
+  status = (f64 != 0u) ? arm_mat_ldlt_f64(&a64, &l64, &d64, pPerm) : arm_mat_ldlt_f32(&a32, &l32, &d32, pPerm);
+  from_buf(f64, 1u, pL, n * n);
+  from_buf(f64, 2u, pD, n * n);
+  return (status);
+}
+
+static arm_status run_qr(uint32_t f64, const double *pA, double *pR, double *pQ, uint32_t m, uint32_t n)
+{
+  arm_matrix_instance_f32 a32, r32, q32;
+  arm_matrix_instance_f64 a64, r64, q64;
+  arm_status              status;
+
+  to_buf(0u, pA, m * n);
+  arm_mat_init_f32(&a32, (uint16_t)m, (uint16_t)n, bufF32[0]);
+  arm_mat_init_f32(&r32, (uint16_t)m, (uint16_t)n, bufF32[1]);
+  arm_mat_init_f32(&q32, (uint16_t)m, (uint16_t)m, bufF32[2]);
+  arm_mat_init_f64(&a64, (uint16_t)m, (uint16_t)n, bufF64[0]);
+  arm_mat_init_f64(&r64, (uint16_t)m, (uint16_t)n, bufF64[1]);
+  arm_mat_init_f64(&q64, (uint16_t)m, (uint16_t)m, bufF64[2]);
+  status = (f64 != 0u) ? arm_mat_qr_f64(&a64, &r64, &q64, bufF64[3]) : arm_mat_qr_f32(&a32, &r32, &q32, bufF32[3]);
+  from_buf(f64, 1u, pR, m * n);
+  from_buf(f64, 2u, pQ, m * m);
+  return (status);
+}
+
+/* kind: 0 lower triangular, 1 upper triangular, 2 Cholesky factor, 3 arm_mat_inverse + arm_mat_mult.
+   X is written over B when 'inPlace'. */
+static arm_status run_solve(uint32_t f64, uint32_t kind, const double *pT, const double *pB, double *pX,
+                            uint32_t n, uint32_t inPlace)
+{
+  arm_matrix_instance_f32 t32, b32, x32, i32;
+  arm_matrix_instance_f64 t64, b64, x64, i64;
+  uint32_t                ixX = (inPlace != 0u) ? 1u : 2u;
+  arm_status              status;
+
+  to_buf(0u, pT, n * n);
+  to_buf(1u, pB, n * TEST_RHS);
+  arm_mat_init_f32(&t32, (uint16_t)n, (uint16_t)n, bufF32[0]);
+  arm_mat_init_f32(&b32, (uint16_t)n, TEST_RHS, bufF32[1]);
+  arm_mat_init_f32(&x32, (uint16_t)n, TEST_RHS, bufF32[ixX]);
+  arm_mat_init_f32(&i32, (uint16_t)n, (uint16_t)n, bufF32[3]);
+  arm_mat_init_f64(&t64, (uint16_t)n, (uint16_t)n, bufF64[0]);
+  arm_mat_init_f64(&b64, (uint16_t)n, TEST_RHS, bufF64[1]);
+  arm_mat_init_f64(&x64, (uint16_t)n, TEST_RHS, bufF64[ixX]);
+  arm_mat_init_f64(&i64, (uint16_t)n, (uint16_t)n, bufF64[3]);
+  switch (kind)
+  {
+  case 0u:
+    status = (f64 != 0u) ? arm_mat_solve_lower_triangular_f64(&t64, &b64, &x64) :
+                           arm_mat_solve_lower_triangular_f32(&t32, &b32, &x32);
+    break;
+  case 1u:
+    status = (f64 != 0u) ? arm_mat_solve_upper_triangular_f64(&t64, &b64, &x64) :
+                           arm_mat_solve_upper_triangular_f32(&t32, &b32, &x32);
+    break;
+  case 2u:
+    status = (f64 != 0u) ? arm_mat_solve_cholesky_f64(&t64, &b64, &x64) :
+                           arm_mat_solve_cholesky_f32(&t32, &b32, &x32);
+    break;
+  default:
+    status = (f64 != 0u) ? arm_mat_inverse_f64(&t64, &i64) : arm_mat_inverse_f32(&t32, &i32);
+    if (status == ARM_MATH_SUCCESS)
+    {
+      status = (f64 != 0u) ? arm_mat_mult_f64(&i64, &b64, &x64) : arm_mat_mult_f32(&i32, &b32, &x32);
+    }
+    break;
+  }
+  from_buf(f64, ixX, pX, n * TEST_RHS);
+  return (status);
+}
+
+/* ----------------------------------------------------------------------
+** References, in long double
+** ------------------------------------------------------------------- */
+
+/* C = op(A) * B, A m x k (or k x m transposed), B k x p */
+static void ref_mult(const double *pA, uint32_t transA, const double *pB, double *pC, uint32_t m, uint32_t k, uint32_t p)
+{
+  long double acc;
+  uint32_t    i, j, l;
+
+  for (i = 0u; i < m; i++)
+  {
+    for (j = 0u; j < p; j++)
+    {
+      acc = 0.0L;
+      for (l = 0u; l < k; l++)
+      {
+        acc += (long double)((transA != 0u) ? pA[l * m + i] : pA[i * k + l]) * pB[l * p + j];
+      }
+      pC[i * p + j] = (double)acc;
+    }
+  }
+}
+
+/* max |X - Y| / max |Y| */
+static double rel_err(const double *pX, const double *pY, uint32_t n)
+{
+  double   err = 0.0, norm = 0.0;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    err  = (fabs(pX[i] - pY[i]) > err) ? fabs(pX[i] - pY[i]) : err;
+    norm = (fabs(pY[i]) > norm) ? fabs(pY[i]) : norm;
+  }
+  return (err / norm);
+}
+
+/* Symmetric positive semidefinite M * M' / n of rank 'rank', plus 'shift' * I */
+static void make_spd(double *pA, uint32_t n, uint32_t rank, double shift)
+{
+  uint32_t i;
+
+  test_rand_f64(work[0], n * rank, 1.0);
+  for (i = 0u; i < n * rank; i++)
+  {
+    work[1][(i % rank) * n + i / rank] = work[0][i];    /* M' */
+  }
+  ref_mult(work[0], 0u, work[1], pA, n, rank, n);
+  for (i = 0u; i < n * n; i++)
+  {
+    pA[i] /= (double)n;
+  }
+  for (i = 0u; i < n; i++)
+  {
+    pA[i * n + i] += shift;
+  }
+}
+
+/* Backward error of A * X = B: max |A * X - B| / (max |A| * max |X|) */
+static double solve_err(const double *pA, const double *pX, const double *pB, uint32_t n)
+{
+  double   r[TEST_N_MAX * TEST_RHS], normA = 0.0, normX = 0.0, err = 0.0;
+  uint32_t i;
+
+  ref_mult(pA, 0u, pX, r, n, n, TEST_RHS);
+  for (i = 0u; i < n * n; i++)
+  {
+    normA = (fabs(pA[i]) > normA) ? fabs(pA[i]) : normA;
+  }
+  for (i = 0u; i < n * TEST_RHS; i++)
+  {
+    normX = (fabs(pX[i]) > normX) ? fabs(pX[i]) : normX;
+    err   = (fabs(r[i] - pB[i]) > err) ? fabs(r[i] - pB[i]) : err;
+  }
+  return (err / (normA * normX));
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+static void test_decomp(uint32_t f64)
+{
+  static const char *precTbl[2] = {"f32", "f64"};
+  double             tol = (f64 != 0u) ? 1e-13 : 1e-5, err[8] = {0.0}, e, lt[TEST_N_MAX * TEST_N_MAX];
+  uint16_t           perm[TEST_N_MAX];
+  uint32_t           ix, n, i, j, upperNonZero = 0u, diffs = 0u;
+  char               name[64];
+
+  for (ix = 0u; ix < sizeof(testSizeTbl) / sizeof(testSizeTbl[0]); ix++)
+  {
+    n = testSizeTbl[ix];
+
+    /* Cholesky: L * L' = A, L lower triangular, same result in place */
+    make_spd(refA, n, n, 0.1);
+    TEST_CHECK(run_cholesky(f64, refA, refL, n, 0u) == ARM_MATH_SUCCESS);
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j < n; j++)
+      {
+        upperNonZero += ((j > i) && (refL[i * n + j] != 0.0)) ? 1u : 0u;
+        lt[j * n + i] = refL[i * n + j];
+      }
+    }
+    ref_mult(refL, 0u, lt, work[0], n, n, n);
+    e      = rel_err(work[0], refA, n * n);
+    err[0] = (e > err[0]) ? e : err[0];
+    TEST_CHECK(run_cholesky(f64, refA, work[0], n, 1u) == ARM_MATH_SUCCESS);
+    diffs += (memcmp(work[0], refL, n * n * sizeof(double)) != 0) ? 1u : 0u;
+
+    /* Triangular solvers: B = T * X for a known X, with L and L' */
+    test_rand_f64(refX, n * TEST_RHS, 1.0);
+    ref_mult(refL, 0u, refX, refB, n, n, TEST_RHS);
+    TEST_CHECK(run_solve(f64, 0u, refL, refB, work[0], n, 0u) == ARM_MATH_SUCCESS);
+    e      = solve_err(refL, work[0], refB, n);
+    err[1] = (e > err[1]) ? e : err[1];
+    ref_mult(lt, 0u, refX, refB, n, n, TEST_RHS);
+    TEST_CHECK(run_solve(f64, 1u, lt, refB, work[0], n, 0u) == ARM_MATH_SUCCESS);
+    e      = solve_err(lt, work[0], refB, n);
+    err[1] = (e > err[1]) ? e : err[1];
+
+    /* Cholesky solve of A * X = B, X over B */
+    test_rand_f64(refB, n * TEST_RHS, 1.0);
+    TEST_CHECK(run_solve(f64, 2u, refL, refB, refX, n, 0u) == ARM_MATH_SUCCESS);
+    e      = solve_err(refA, refX, refB, n);
+    err[2] = (e > err[2]) ? e : err[2];
+    TEST_CHECK(run_solve(f64, 2u, refL, refB, work[0], n, 1u) == ARM_MATH_SUCCESS);
+    diffs += (memcmp(work[0], refX, n * TEST_RHS * sizeof(double)) != 0) ? 1u : 0u;
+
+    /* LDL': P * A * P' = L * D * L', also for a semidefinite matrix of rank n / 2 */
+    for (j = 0u; j < 2u; j++)
+    {
+      if (j == 1u)
+      {
+        make_spd(refA, n, n / 2u, 0.0);
+      }
+      TEST_CHECK(run_ldlt(f64, refA, refL, refD, perm, n) == ARM_MATH_SUCCESS);
+      ref_mult(refL, 0u, refD, work[0], n, n, n);
+      for (i = 0u; i < n * n; i++)
+      {
+        lt[(i % n) * n + i / n] = refL[i];
+      }
+      ref_mult(work[0], 0u, lt, work[1], n, n, n);
+      for (i = 0u; i < n * n; i++)                  /* P * A * P' */
+      {
+        work[0][i] = refA[perm[i / n] * n + perm[i % n]];
+      }
+      e      = rel_err(work[1], work[0], n * n);
+      err[3] = (e > err[3]) ? e : err[3];
+    }
+
+    /* QR of n x n and 2n x n matrices: Q * R = A, Q' * Q = I, R upper triangular */
+    for (j = 1u; (j <= 2u) && (j * n <= TEST_N_MAX); j++)
+    {
+      test_rand_f64(refA, j * n * n, 1.0);
+      TEST_CHECK(run_qr(f64, refA, refL, refQ, j * n, n) == ARM_MATH_SUCCESS);
+      ref_mult(refQ, 0u, refL, work[0], j * n, j * n, n);
+      e      = rel_err(work[0], refA, j * n * n);
+      err[4] = (e > err[4]) ? e : err[4];
+      ref_mult(refQ, 1u, refQ, work[0], j * n, j * n, j * n);
+      for (i = 0u; i < j * n * j * n; i++)
+      {
+        e      = fabs(work[0][i] - (double)(i % (j * n + 1u) == 0u));
+        err[5] = (e > err[5]) ? e : err[5];
+      }
+      for (i = 0u; i < j * n * n; i++)
+      {
+        upperNonZero += ((i / n > i % n) && (refL[i] != 0.0)) ? 1u : 0u;
+      }
+    }
+
+    /* Indefinite: the decompositions fail */
+    make_spd(refA, n, n, 0.1);
+    refA[(n / 2u) * n + n / 2u] = -1.0;
+    TEST_CHECK(run_cholesky(f64, refA, refL, n, 0u) == ARM_MATH_DECOMPOSITION_FAILURE);
+    TEST_CHECK(run_ldlt(f64, refA, refL, refD, perm, n) == ARM_MATH_DECOMPOSITION_FAILURE);
+  }
+
+  snprintf(name, sizeof(name), "arm_mat_cholesky_%s, |L*L' - A|", precTbl[f64]);
+  printf("  %-48s %10.3g\n", name, err[0]);
+  snprintf(name, sizeof(name), "arm_mat_solve_lower/upper_triangular_%s", precTbl[f64]);
+  printf("  %-48s %10.3g\n", name, err[1]);
+  snprintf(name, sizeof(name), "arm_mat_solve_cholesky_%s", precTbl[f64]);
+  printf("  %-48s %10.3g\n", name, err[2]);
+  snprintf(name, sizeof(name), "arm_mat_ldlt_%s, |L*D*L' - P*A*P'|, PD and PSD", precTbl[f64]);
+  printf("  %-48s %10.3g\n", name, err[3]);
+  snprintf(name, sizeof(name), "arm_mat_qr_%s, |Q*R - A|", precTbl[f64]);
+  printf("  %-48s %10.3g\n", name, err[4]);
+  snprintf(name, sizeof(name), "arm_mat_qr_%s, |Q'*Q - I|", precTbl[f64]);
+  printf("  %-48s %10.3g\n", name, err[5]);
+  for (i = 0u; i < 6u; i++)
+  {
+    TEST_CHECK(err[i] < tol);
+  }
+  TEST_CHECK(upperNonZero == 0u);               /* Zeros of the triangular factors */
+  TEST_CHECK(diffs == 0u);                      /* In place */
+}
+
+/* Backward error of an ill-conditioned SPD system, Cholesky against inverse and multiplication */
+static void test_inverse_compare(void)
+{
+  double   errChol, errInv;
+  uint32_t ix, n;
+  char     name[64];
+
+  for (ix = 0u; ix < sizeof(testSizeTbl) / sizeof(testSizeTbl[0]); ix++)
+  {
+    n = testSizeTbl[ix];
+    make_spd(refA, n, n, 1e-4);
+    test_rand_f64(refB, n * TEST_RHS, 1.0);
+    TEST_CHECK(run_cholesky(0u, refA, refL, n, 0u) == ARM_MATH_SUCCESS);
+    TEST_CHECK(run_solve(0u, 2u, refL, refB, refX, n, 0u) == ARM_MATH_SUCCESS);
+    errChol = solve_err(refA, refX, refB, n);
+    TEST_CHECK(run_solve(0u, 3u, refA, refB, refX, n, 0u) == ARM_MATH_SUCCESS);
+    errInv = solve_err(refA, refX, refB, n);
+    snprintf(name, sizeof(name), "f32 SPD %ux%u, cholesky / inverse", (unsigned)n, (unsigned)n);
+    printf("  %-48s %10.3g %10.3g\n", name, errChol, errInv);
+    TEST_CHECK(errChol < 1e-5);
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  arm_matrix_instance_f32 a32, l32, b32, x32, i32;
+  arm_matrix_instance_f64 a64, l64, b64, x64, i64;
+  uint32_t                ix, n;
+  char                    name[64];
+
+  for (ix = 0u; ix < sizeof(testSizeTbl) / sizeof(testSizeTbl[0]); ix++)
+  {
+    n = testSizeTbl[ix];
+    make_spd(refA, n, n, 0.1);
+    test_rand_f64(refB, n * TEST_RHS, 1.0);
+    to_buf(2u, refB, n);                        /* One right-hand side */
+    arm_mat_init_f32(&a32, (uint16_t)n, (uint16_t)n, bufF32[0]);
+    arm_mat_init_f32(&l32, (uint16_t)n, (uint16_t)n, bufF32[1]);
+    arm_mat_init_f32(&b32, (uint16_t)n, 1u, bufF32[2]);
+    arm_mat_init_f32(&x32, (uint16_t)n, 1u, bufF32[3]);
+    arm_mat_init_f32(&i32, (uint16_t)n, (uint16_t)n, bufF32[1]);
+    arm_mat_init_f64(&a64, (uint16_t)n, (uint16_t)n, bufF64[0]);
+    arm_mat_init_f64(&l64, (uint16_t)n, (uint16_t)n, bufF64[1]);
+    arm_mat_init_f64(&b64, (uint16_t)n, 1u, bufF64[2]);
+    arm_mat_init_f64(&x64, (uint16_t)n, 1u, bufF64[3]);
+    arm_mat_init_f64(&i64, (uint16_t)n, (uint16_t)n, bufF64[1]);
+
+    /* The inverse overwrites A: both ways copy it first */
+    snprintf(name, sizeof(name), "f32 %ux%u, cholesky + solve_cholesky", (unsigned)n, (unsigned)n);
+    TEST_BENCH(name, 1u, (to_buf(0u, refA, n * n), (void)arm_mat_cholesky_f32(&a32, &l32),
+                          (void)arm_mat_solve_cholesky_f32(&l32, &b32, &x32)));
+    snprintf(name, sizeof(name), "f32 %ux%u, inverse + mult", (unsigned)n, (unsigned)n);
+    TEST_BENCH(name, 1u, (to_buf(0u, refA, n * n), (void)arm_mat_inverse_f32(&a32, &i32),
+                          (void)arm_mat_mult_f32(&i32, &b32, &x32)));
+    snprintf(name, sizeof(name), "f64 %ux%u, cholesky + solve_cholesky", (unsigned)n, (unsigned)n);
+    TEST_BENCH(name, 1u, (to_buf(0u, refA, n * n), (void)arm_mat_cholesky_f64(&a64, &l64),
+                          (void)arm_mat_solve_cholesky_f64(&l64, &b64, &x64)));
+    snprintf(name, sizeof(name), "f64 %ux%u, inverse + mult", (unsigned)n, (unsigned)n);
+    TEST_BENCH(name, 1u, (to_buf(0u, refA, n * n), (void)arm_mat_inverse_f64(&a64, &i64),
+                          (void)arm_mat_mult_f64(&i64, &b64, &x64)));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_mat_decomp_test", argc, argv);
+  test_seed(1u);
+  test_decomp(0u);
+  test_decomp(1u);
+  test_inverse_compare();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
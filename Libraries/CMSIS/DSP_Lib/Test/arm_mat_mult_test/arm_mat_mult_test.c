@@ -0,0 +1,373 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_mat_mult_test.c
+*
+* Description:  Blocked matrix multiplications against plain loops, and their throughput.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks arm_mat_mult_blocked_f32() (B as is, packed, or transposed) and
+ * arm_mat_mult_blocked_q15() (B as is or transposed) against plain loops that
+ * sum the products in the same order: the results must be bit-exact, also
+ * through arm_mat_mult_f32/q15(), which switch to them from MAT_MULT_BLOCK_MIN.
+ * The sizes cross the blocks of MAT_MULT_BLOCK_K x MAT_MULT_BLOCK_N, and the
+ * 260 x 260 products, of more than 65535 values, check the row offsets of all
+ * the matrix multiplications.  With "bench" it gives the GOPS (2 * n^3
+ * operations per product) of square products from 16 x 16 to 512 x 512,
+ * against the plain loops, which are the former arm_mat_mult_f32/q15() loops.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_N_MAX      512u
+
+typedef struct
+{
+  uint16_t rowsA;
+  uint16_t colsA;
+  uint16_t colsB;
+} test_size;
+
+static const test_size testSizeTbl[] =
+{
+  {16u, 16u, 16u}, {17u, 33u, 29u}, {64u, 300u, 130u}, {33u, 513u, 259u}, {260u, 260u, 260u}
+};
+
+static const uint16_t testBenchTbl[] = {16u, 32u, 64u, 128u, 256u, 512u};
+
+static double    refA[TEST_N_MAX * TEST_N_MAX];
+static double    refB[TEST_N_MAX * TEST_N_MAX];
+static double    refC[TEST_N_MAX * TEST_N_MAX];
+static float32_t f32A[TEST_N_MAX * TEST_N_MAX], f32B[TEST_N_MAX * TEST_N_MAX], f32BT[TEST_N_MAX * TEST_N_MAX];
+static float32_t f32C[TEST_N_MAX * TEST_N_MAX], f32Ref[TEST_N_MAX * TEST_N_MAX];
+static float32_t f32Pack[MAT_MULT_BLOCK_K * MAT_MULT_BLOCK_N];
+static float64_t f64A[TEST_N_MAX * TEST_N_MAX], f64B[TEST_N_MAX * TEST_N_MAX], f64C[TEST_N_MAX * TEST_N_MAX];
+static q31_t     q31A[TEST_N_MAX * TEST_N_MAX], q31B[TEST_N_MAX * TEST_N_MAX], q31C[TEST_N_MAX * TEST_N_MAX];
+static q15_t     q15A[TEST_N_MAX * TEST_N_MAX], q15B[TEST_N_MAX * TEST_N_MAX], q15BT[TEST_N_MAX * TEST_N_MAX];
+static q15_t     q15C[TEST_N_MAX * TEST_N_MAX], q15Ref[TEST_N_MAX * TEST_N_MAX];
+static q15_t     q15State[TEST_N_MAX * TEST_N_MAX];
+
+/* ----------------------------------------------------------------------
+** Plain loops, each output the sum of its products in order
+** ------------------------------------------------------------------- */
+
+static void ref_mult_f32(const float32_t *pA, const float32_t *pB, float32_t *pC, uint32_t m, uint32_t k, uint32_t n)
+{
+  float32_t sum;
+  uint32_t  i, j, l;
+
+  for (i = 0u; i < m; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      sum = 0.0f;
+      for (l = 0u; l < k; l++)
+      {
+        sum += pA[i * k + l] * pB[l * n + j];
+      }
+      pC[i * n + j] = sum;
+    }
+  }
+}
+
+static void ref_mult_q15(const q15_t *pA, const q15_t *pB, q15_t *pC, uint32_t m, uint32_t k, uint32_t n)
+{
+  q63_t    sum;
+  uint32_t i, j, l;
+
+  for (i = 0u; i < m; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      sum = 0;
+      for (l = 0u; l < k; l++)
+      {
+        sum += (q31_t)pA[i * k + l] * pB[l * n + j];
+      }
+      pC[i * n + j] = (q15_t)__SSAT((q31_t)(sum >> 15), 16);
+    }
+  }
+}
+
+/* Double precision product of the rounded inputs, for the fast and q31 variants */
+static void ref_mult_f64(uint32_t m, uint32_t k, uint32_t n)
+{
+  long double sum;
+  uint32_t    i, j, l;
+
+  for (i = 0u; i < m; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      sum = 0.0L;
+      for (l = 0u; l < k; l++)
+      {
+        sum += (long double)refA[i * k + l] * refB[l * n + j];
+      }
+      refC[i * n + j] = (double)sum;
+    }
+  }
+}
+
+static void transpose_f32(const float32_t *pSrc, float32_t *pDst, uint32_t rows, uint32_t cols)
+{
+  uint32_t i;
+
+  for (i = 0u; i < rows * cols; i++)
+  {
+    pDst[(i % cols) * rows + i / cols] = pSrc[i];
+  }
+}
+
+static void transpose_q15(const q15_t *pSrc, q15_t *pDst, uint32_t rows, uint32_t cols)
+{
+  uint32_t i;
+
+  for (i = 0u; i < rows * cols; i++)
+  {
+    pDst[(i % cols) * rows + i / cols] = pSrc[i];
+  }
+}
+
+/* A of amplitude ampA, B of amplitude 1 */
+static void make_inputs(uint32_t m, uint32_t k, uint32_t n, double ampA)
+{
+  uint32_t i;
+
+  test_rand_f64(refA, m * k, ampA);
+  test_rand_f64(refB, k * n, 1.0);
+  test_f64_to_f32(refA, f32A, m * k);
+  test_f64_to_f32(refB, f32B, k * n);
+  test_f64_to_q15(refA, q15A, m * k);
+  test_f64_to_q15(refB, q15B, k * n);
+  test_f64_to_q31(refA, q31A, m * k);
+  test_f64_to_q31(refB, q31B, k * n);
+  for (i = 0u; i < m * k; i++)
+  {
+    f64A[i] = refA[i];
+  }
+  for (i = 0u; i < k * n; i++)
+  {
+    f64B[i] = refB[i];
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+static void test_blocked(void)
+{
+  arm_matrix_instance_f32 a32, b32, bt32, c32;
+  arm_matrix_instance_q15 a15, b15, bt15, c15;
+  uint32_t                ix, m, k, n, diffs[5] = {0u};
+  size_t                  size32, size15;
+
+  for (ix = 0u; ix < sizeof(testSizeTbl) / sizeof(testSizeTbl[0]); ix++)
+  {
+    m = testSizeTbl[ix].rowsA;
+    k = testSizeTbl[ix].colsA;
+    n = testSizeTbl[ix].colsB;
+    size32 = m * n * sizeof(float32_t);
+    size15 = m * n * sizeof(q15_t);
+    make_inputs(m, k, n, 1.0 / sqrt((double)k));     /* Few saturated q15 results */
+    transpose_f32(f32B, f32BT, k, n);
+    transpose_q15(q15B, q15BT, k, n);
+    arm_mat_init_f32(&a32, (uint16_t)m, (uint16_t)k, f32A);
+    arm_mat_init_f32(&b32, (uint16_t)k, (uint16_t)n, f32B);
+    arm_mat_init_f32(&bt32, (uint16_t)n, (uint16_t)k, f32BT);
+    arm_mat_init_f32(&c32, (uint16_t)m, (uint16_t)n, f32C);
+    arm_mat_init_q15(&a15, (uint16_t)m, (uint16_t)k, q15A);
+    arm_mat_init_q15(&b15, (uint16_t)k, (uint16_t)n, q15B);
+    arm_mat_init_q15(&bt15, (uint16_t)n, (uint16_t)k, q15BT);
+    arm_mat_init_q15(&c15, (uint16_t)m, (uint16_t)n, q15C);
+    ref_mult_f32(f32A, f32B, f32Ref, m, k, n);
+    ref_mult_q15(q15A, q15B, q15Ref, m, k, n);
+
+    TEST_CHECK(arm_mat_mult_blocked_f32(&a32, &b32, &c32, NULL, 0u) == ARM_MATH_SUCCESS);
+    diffs[0] += (memcmp(f32C, f32Ref, size32) != 0) ? 1u : 0u;
+    memset(f32C, 0, size32);
+    TEST_CHECK(arm_mat_mult_blocked_f32(&a32, &b32, &c32, f32Pack, 0u) == ARM_MATH_SUCCESS);
+    diffs[1] += (memcmp(f32C, f32Ref, size32) != 0) ? 1u : 0u;
+    memset(f32C, 0, size32);
+    TEST_CHECK(arm_mat_mult_blocked_f32(&a32, &bt32, &c32, f32Pack, 1u) == ARM_MATH_SUCCESS);
+    diffs[1] += (memcmp(f32C, f32Ref, size32) != 0) ? 1u : 0u;
+    memset(f32C, 0, size32);
+    TEST_CHECK(arm_mat_mult_f32(&a32, &b32, &c32) == ARM_MATH_SUCCESS);
+    diffs[2] += (memcmp(f32C, f32Ref, size32) != 0) ? 1u : 0u;
+
+    TEST_CHECK(arm_mat_mult_blocked_q15(&a15, &b15, &c15, q15State, 0u) == ARM_MATH_SUCCESS);
+    diffs[3] += (memcmp(q15C, q15Ref, size15) != 0) ? 1u : 0u;
+    memset(q15C, 0, size15);
+    TEST_CHECK(arm_mat_mult_blocked_q15(&a15, &bt15, &c15, NULL, 1u) == ARM_MATH_SUCCESS);
+    diffs[3] += (memcmp(q15C, q15Ref, size15) != 0) ? 1u : 0u;
+    memset(q15C, 0, size15);
+    TEST_CHECK(arm_mat_mult_q15(&a15, &b15, &c15, q15State) == ARM_MATH_SUCCESS);
+    diffs[4] += (memcmp(q15C, q15Ref, size15) != 0) ? 1u : 0u;
+  }
+  printf("  %-48s %s\n", "arm_mat_mult_blocked_f32", (diffs[0] == 0u) ? "bit-exact" : "differ  FAILED");
+  printf("  %-48s %s\n", "arm_mat_mult_blocked_f32, packed, B transposed", (diffs[1] == 0u) ? "bit-exact" : "differ  FAILED");
+  printf("  %-48s %s\n", "arm_mat_mult_f32", (diffs[2] == 0u) ? "bit-exact" : "differ  FAILED");
+  printf("  %-48s %s\n", "arm_mat_mult_blocked_q15, B as is and transposed", (diffs[3] == 0u) ? "bit-exact" : "differ  FAILED");
+  printf("  %-48s %s\n", "arm_mat_mult_q15", (diffs[4] == 0u) ? "bit-exact" : "differ  FAILED");
+  for (ix = 0u; ix < 5u; ix++)
+  {
+    TEST_CHECK(diffs[ix] == 0u);
+  }
+
+  /* B transposed needs the pack buffer */
+  TEST_CHECK(arm_mat_mult_blocked_f32(&a32, &bt32, &c32, NULL, 1u) == ARM_MATH_ARGUMENT_ERROR);
+}
+
+/* Products of 260 x 260 values, above the 65535 of the former uint16_t row offsets */
+static void test_large(void)
+{
+  arm_matrix_instance_f64 a64, b64, c64;
+  arm_matrix_instance_q31 a31, b31, c31;
+  arm_matrix_instance_q15 a15, b15, c15;
+  uint32_t                n = 260u, i;
+
+  make_inputs(n, n, n, 1.0 / (double)n);       /* Fixed point without overflow */
+  for (i = 0u; i < n * n; i++)                  /* The rounded inputs */
+  {
+    refA[i] = (double)q31A[i] / 2147483648.0;
+    refB[i] = (double)q31B[i] / 2147483648.0;
+  }
+  ref_mult_f64(n, n, n);
+  arm_mat_init_f64(&a64, (uint16_t)n, (uint16_t)n, f64A);
+  arm_mat_init_f64(&b64, (uint16_t)n, (uint16_t)n, f64B);
+  arm_mat_init_f64(&c64, (uint16_t)n, (uint16_t)n, f64C);
+  arm_mat_init_q31(&a31, (uint16_t)n, (uint16_t)n, q31A);
+  arm_mat_init_q31(&b31, (uint16_t)n, (uint16_t)n, q31B);
+  arm_mat_init_q31(&c31, (uint16_t)n, (uint16_t)n, q31C);
+  arm_mat_init_q15(&a15, (uint16_t)n, (uint16_t)n, q15A);
+  arm_mat_init_q15(&b15, (uint16_t)n, (uint16_t)n, q15B);
+  arm_mat_init_q15(&c15, (uint16_t)n, (uint16_t)n, q15C);
+
+  TEST_CHECK(arm_mat_mult_q31(&a31, &b31, &c31) == ARM_MATH_SUCCESS);
+  test_check_snr("arm_mat_mult_q31, 260x260", test_snr_q31(refC, q31C, n * n), 150.0);
+  memset(q31C, 0, sizeof(q31C));
+  TEST_CHECK(arm_mat_mult_fast_q31(&a31, &b31, &c31) == ARM_MATH_SUCCESS);
+  test_check_snr("arm_mat_mult_fast_q31, 260x260", test_snr_q31(refC, q31C, n * n), 95.0);
+
+  for (i = 0u; i < n * n; i++)
+  {
+    refA[i] = f64A[i];
+    refB[i] = f64B[i];
+  }
+  ref_mult_f64(n, n, n);
+  TEST_CHECK(arm_mat_mult_f64(&a64, &b64, &c64) == ARM_MATH_SUCCESS);
+  test_check_snr("arm_mat_mult_f64, 260x260", test_snr_f64(refC, f64C, n * n), 280.0);
+
+  for (i = 0u; i < n * n; i++)
+  {
+    refA[i] = (double)q15A[i] / 32768.0;
+    refB[i] = (double)q15B[i] / 32768.0;
+  }
+  ref_mult_f64(n, n, n);
+  TEST_CHECK(arm_mat_mult_fast_q15(&a15, &b15, &c15, q15State) == ARM_MATH_SUCCESS);
+  test_check_snr("arm_mat_mult_fast_q15, 260x260", test_snr_q15(refC, q15C, n * n), 55.0);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+/* Runs 'stmt' for at least TEST_BENCH_NS, prints the operations per ns */
+#define BENCH_GOPS(name, ops, stmt)                                   \
+  do                                                                  \
+  {                                                                   \
+    uint64_t bench_start = test_time_ns();                            \
+    uint64_t bench_runs  = 0;                                         \
+    do                                                                \
+    {                                                                 \
+      stmt;                                                           \
+      bench_runs++;                                                   \
+    } while ((test_time_ns() - bench_start) < TEST_BENCH_NS);         \
+    printf("  %-48s %10.2f GOPS\n", (name), (double)(ops) * (double)bench_runs / \
+           (double)(test_time_ns() - bench_start));                   \
+  } while (0)
+
+static void bench(void)
+{
+  arm_matrix_instance_f32 a32, b32, c32;
+  arm_matrix_instance_q15 a15, b15, c15;
+  uint32_t                ix, n;
+  double                  ops;
+  char                    name[64];
+
+  for (ix = 0u; ix < sizeof(testBenchTbl) / sizeof(testBenchTbl[0]); ix++)
+  {
+    n   = testBenchTbl[ix];
+    ops = 2.0 * (double)n * (double)n * (double)n;
+    make_inputs(n, n, n, 1.0 / sqrt((double)n));
+    arm_mat_init_f32(&a32, (uint16_t)n, (uint16_t)n, f32A);
+    arm_mat_init_f32(&b32, (uint16_t)n, (uint16_t)n, f32B);
+    arm_mat_init_f32(&c32, (uint16_t)n, (uint16_t)n, f32C);
+    arm_mat_init_q15(&a15, (uint16_t)n, (uint16_t)n, q15A);
+    arm_mat_init_q15(&b15, (uint16_t)n, (uint16_t)n, q15B);
+    arm_mat_init_q15(&c15, (uint16_t)n, (uint16_t)n, q15C);
+
+    snprintf(name, sizeof(name), "f32 %ux%u, plain loops", (unsigned)n, (unsigned)n);
+    BENCH_GOPS(name, ops, ref_mult_f32(f32A, f32B, f32C, n, n, n));
+    snprintf(name, sizeof(name), "f32 %ux%u, arm_mat_mult_blocked_f32", (unsigned)n, (unsigned)n);
+    BENCH_GOPS(name, ops, (void)arm_mat_mult_blocked_f32(&a32, &b32, &c32, NULL, 0u));
+    snprintf(name, sizeof(name), "f32 %ux%u, arm_mat_mult_blocked_f32, packed", (unsigned)n, (unsigned)n);
+    BENCH_GOPS(name, ops, (void)arm_mat_mult_blocked_f32(&a32, &b32, &c32, f32Pack, 0u));
+    snprintf(name, sizeof(name), "q15 %ux%u, plain loops", (unsigned)n, (unsigned)n);
+    BENCH_GOPS(name, ops, ref_mult_q15(q15A, q15B, q15C, n, n, n));
+    snprintf(name, sizeof(name), "q15 %ux%u, arm_mat_mult_blocked_q15", (unsigned)n, (unsigned)n);
+    BENCH_GOPS(name, ops, (void)arm_mat_mult_blocked_q15(&a15, &b15, &c15, q15State, 0u));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_mat_mult_test", argc, argv);
+  test_seed(1u);
+  test_blocked();
+  test_large();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
@@ -0,0 +1,230 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_mixed_fft_test.c
+*
+* Description:  Mixed-radix complex and real FFTs against a direct DFT.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks every constant instance of arm_cfft_mixed_f32() and every length of
+ * arm_rfft_mixed_f32() against a double precision DFT, forward and inverse.
+ * With "bench" it compares each mixed-radix length with the power of two
+ * transform that an application would otherwise zero-pad to: the times are
+ * per sample of the mixed-radix length, so the two lines of a length compare
+ * the cost of the same signal.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "test_helper.h"
+
+#define TEST_LEN_MAX      4096u
+
+static const arm_cfft_mixed_instance_f32 *testMixedTbl[] =
+{
+  &arm_cfft_mR_f32_len48,   &arm_cfft_mR_f32_len60,   &arm_cfft_mR_f32_len80,   &arm_cfft_mR_f32_len96,
+  &arm_cfft_mR_f32_len120,  &arm_cfft_mR_f32_len160,  &arm_cfft_mR_f32_len192,  &arm_cfft_mR_f32_len240,
+  &arm_cfft_mR_f32_len320,  &arm_cfft_mR_f32_len384,  &arm_cfft_mR_f32_len480,  &arm_cfft_mR_f32_len640,
+  &arm_cfft_mR_f32_len768,  &arm_cfft_mR_f32_len960,  &arm_cfft_mR_f32_len1280, &arm_cfft_mR_f32_len1920,
+  &arm_cfft_mR_f32_len3840
+};
+
+/* Power of two transforms, 64 to 4096 */
+static const arm_cfft_instance_f32 *testPow2Tbl[] =
+{
+  &arm_cfft_sR_f32_len64,   &arm_cfft_sR_f32_len128,  &arm_cfft_sR_f32_len256,  &arm_cfft_sR_f32_len512,
+  &arm_cfft_sR_f32_len1024, &arm_cfft_sR_f32_len2048, &arm_cfft_sR_f32_len4096
+};
+
+static double    refIn[2 * TEST_LEN_MAX];
+static double    refOut[2 * TEST_LEN_MAX];
+static float32_t testIn[2 * TEST_LEN_MAX];
+static float32_t testOut[2 * TEST_LEN_MAX];
+
+static const arm_cfft_instance_f32 *pow2_above(uint32_t n)
+{
+  uint32_t ix = 0u;
+
+  while (testPow2Tbl[ix]->fftLen < n)
+  {
+    ix++;
+  }
+  return (testPow2Tbl[ix]);
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+static void test_cfft(void)
+{
+  double   snr, snrMinFwd = INFINITY, snrMinInv = INFINITY;
+  uint32_t ix, n, nMinFwd = 0u, nMinInv = 0u;
+
+  for (ix = 0u; ix < sizeof(testMixedTbl) / sizeof(testMixedTbl[0]); ix++)
+  {
+    n = testMixedTbl[ix]->fftLen;
+    test_rand_f64(refIn, 2u * n, 1.0);
+    test_f64_to_f32(refIn, testOut, 2u * n);
+    test_dft_f64(refIn, refOut, n, 0u);
+    arm_cfft_mixed_f32(testMixedTbl[ix], testOut, 0u, 1u);
+    snr = test_snr_f32(refOut, testOut, 2u * n);
+    TEST_CHECK(snr >= 120.0);
+    if (snr < snrMinFwd)
+    {
+      snrMinFwd = snr;
+      nMinFwd   = n;
+    }
+
+    test_f64_to_f32(refIn, testOut, 2u * n);    /* Inverse of a random spectrum */
+    test_dft_f64(refIn, refOut, n, 1u);
+    arm_cfft_mixed_f32(testMixedTbl[ix], testOut, 1u, 1u);
+    snr = test_snr_f32(refOut, testOut, 2u * n);
+    TEST_CHECK(snr >= 120.0);
+    if (snr < snrMinInv)
+    {
+      snrMinInv = snr;
+      nMinInv   = n;
+    }
+  }
+  printf("  arm_cfft_mixed_f32, 48 to 3840, lowest: forward %u, inverse %u\n",
+         (unsigned)nMinFwd, (unsigned)nMinInv);
+  test_check_snr("arm_cfft_mixed_f32, forward, lowest", snrMinFwd, 120.0);
+  test_check_snr("arm_cfft_mixed_f32, inverse, lowest", snrMinInv, 120.0);
+}
+
+static void test_rfft(void)
+{
+  arm_rfft_mixed_instance_f32 s;
+  double                      snr, snrMinFwd = INFINITY, snrMinInv = INFINITY;
+  uint32_t                    ix, i, n, runs = 0u;
+
+  TEST_CHECK(arm_rfft_mixed_init_f32(&s, 100u) == ARM_MATH_ARGUMENT_ERROR);
+  TEST_CHECK(arm_rfft_mixed_init_f32(&s, 1024u) == ARM_MATH_ARGUMENT_ERROR);
+  for (ix = 0u; ix < sizeof(testMixedTbl) / sizeof(testMixedTbl[0]); ix++)
+  {
+    n = 2u * testMixedTbl[ix]->fftLen;
+    if (arm_rfft_mixed_init_f32(&s, (uint16_t)n) != ARM_MATH_SUCCESS)
+    {
+      continue;                                 /* Complex length without a real stage */
+    }
+    runs++;
+    test_rand_f64(refIn, n, 1.0);               /* Real input as complex for the reference */
+    for (i = n; i-- > 0u; )
+    {
+      refIn[2 * i]     = refIn[i];
+      refIn[2 * i + 1] = 0.0;
+    }
+    test_dft_f64(refIn, refOut, n, 0u);
+    refOut[1] = refOut[n];                      /* Packed: X[0], X[N/2] real, then X[1]... */
+    for (i = 0u; i < n; i++)
+    {
+      testIn[i] = (float32_t)refIn[2 * i];
+    }
+    arm_rfft_mixed_f32(&s, testIn, testOut, 0u);
+    snr       = test_snr_f32(refOut, testOut, n);
+    snrMinFwd = (snr < snrMinFwd) ? snr : snrMinFwd;
+
+    test_f64_to_f32(refOut, testIn, n);         /* Back to the input */
+    arm_rfft_mixed_f32(&s, testIn, testOut, 1u);
+    for (i = 0u; i < n; i++)
+    {
+      refOut[i] = refIn[2 * i];
+    }
+    snr       = test_snr_f32(refOut, testOut, n);
+    snrMinInv = (snr < snrMinInv) ? snr : snrMinInv;
+  }
+  TEST_CHECK(runs == 14u);
+  test_check_snr("arm_rfft_mixed_f32, 96 to 3840, forward, lowest", snrMinFwd, 120.0);
+  test_check_snr("arm_rfft_mixed_f32, 96 to 3840, inverse, lowest", snrMinInv, 120.0);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  static const uint32_t        lenTbl[] = {3u, 10u, 13u, 15u, 16u};   /* 96, 480, 960, 1920, 3840 */
+  const arm_cfft_instance_f32 *pPow2;
+  arm_rfft_fast_instance_f32   sFast;
+  arm_rfft_mixed_instance_f32  sMixed;
+  uint32_t                     ix, n;
+  char                         name[64];
+
+  test_rand_f64(refIn, 2u * TEST_LEN_MAX, 0.5);
+  test_f64_to_f32(refIn, testIn, 2u * TEST_LEN_MAX);
+  for (ix = 0u; ix < sizeof(lenTbl) / sizeof(lenTbl[0]); ix++)
+  {
+    const arm_cfft_mixed_instance_f32 *pMixed = testMixedTbl[lenTbl[ix]];
+
+    n     = pMixed->fftLen;                     /* Forward + inverse, the data stays bounded */
+    pPow2 = pow2_above(n);
+    snprintf(name, sizeof(name), "arm_cfft_mixed_f32, %u", (unsigned)n);
+    TEST_BENCH(name, 2u * n, (arm_cfft_mixed_f32(pMixed, testIn, 0u, 1u), arm_cfft_mixed_f32(pMixed, testIn, 1u, 1u)));
+    snprintf(name, sizeof(name), "arm_cfft_f32, %u padded to %u", (unsigned)n, (unsigned)pPow2->fftLen);
+    TEST_BENCH(name, 2u * n, (arm_cfft_f32(pPow2, testIn, 0u, 1u), arm_cfft_f32(pPow2, testIn, 1u, 1u)));
+
+    if ((2u * n <= TEST_LEN_MAX) && (arm_rfft_mixed_init_f32(&sMixed, (uint16_t)(2u * n)) == ARM_MATH_SUCCESS))
+    {
+      (void)arm_rfft_fast_init_f32(&sFast, (uint16_t)(2u * pPow2->fftLen));
+      snprintf(name, sizeof(name), "arm_rfft_mixed_f32, %u", (unsigned)(2u * n));
+      TEST_BENCH(name, 4u * n, (arm_rfft_mixed_f32(&sMixed, testIn, testOut, 0u),
+                                arm_rfft_mixed_f32(&sMixed, testOut, testIn, 1u)));
+      snprintf(name, sizeof(name), "arm_rfft_fast_f32, %u padded to %u", (unsigned)(2u * n),
+               (unsigned)(2u * pPow2->fftLen));
+      TEST_BENCH(name, 4u * n, (arm_rfft_fast_f32(&sFast, testIn, testOut, 0u),
+                                arm_rfft_fast_f32(&sFast, testOut, testIn, 1u)));
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_mixed_fft_test", argc, argv);
+  test_seed(1u);
+  test_cfft();
+  test_rfft();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
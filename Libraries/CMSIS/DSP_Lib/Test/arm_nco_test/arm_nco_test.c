@@ -0,0 +1,434 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_nco_test.c
+*
+* Description:  NCOs against the double precision sine and cosine of the phase, block continuity and modulation.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks arm_nco_f32/q31/q15() and their complex forms against the double
+ * precision sine and cosine of the phase accumulator, over 2^20 samples whose
+ * phases spread over the whole turn, with the bounds documented with the NCO
+ * group.  Generating a carrier in blocks of any size must give the samples of
+ * one block, the complex outputs those of the separate sine and cosine, a
+ * constant frequency modulation the carrier of the shifted phase increment and
+ * a constant phase modulation that of the shifted initial phase.  The dither
+ * must leave the phase accumulator alone, and lower the spurious tones of a
+ * Q15 carrier.  With "bench" it compares the NCOs with the loops of
+ * arm_sin_cos_f32/q31() and of arm_sin + arm_cos.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "test_helper.h"
+
+#define TEST_LEN        (1u << 20)
+#define TEST_BLOCK        4096u
+#define TEST_SPLIT_LEN    1000u
+#define TEST_PI           3.14159265358979323846      /* PI of arm_math.h is a float32_t */
+#define TEST_INC          0x9E3779B9u                 /* 2^32 / golden ratio: the phases fill the turn */
+
+/* Block sizes of the split carriers, the last one takes the rest */
+static const uint32_t testSplitTbl[] = {1u, 3u, 4u, 64u, 100u, 7u, 0u, 333u};
+
+static float32_t f32Sin[TEST_BLOCK], f32Cos[TEST_BLOCK], f32Cmplx[2 * TEST_BLOCK];
+static float32_t f32Split[2 * TEST_BLOCK], f32Split2[TEST_BLOCK];
+static q31_t     q31Sin[TEST_BLOCK], q31Cos[TEST_BLOCK], q31Cmplx[2 * TEST_BLOCK];
+static q31_t     q31Split[2 * TEST_BLOCK], q31Split2[TEST_BLOCK];
+static q15_t     q15Sin[TEST_BLOCK], q15Cos[TEST_BLOCK], q15Cmplx[2 * TEST_BLOCK];
+static q15_t     q15Split[2 * TEST_BLOCK], q15Split2[TEST_BLOCK];
+static q31_t     freqMod[TEST_BLOCK], phaseMod[TEST_BLOCK];
+static double    refIn[TEST_BLOCK];
+static float32_t fftBuf[2 * TEST_BLOCK];
+
+static void print_err(const char *name, double err, const char *unit, double errMax)
+{
+  printf("  %-48s %10.3g%s%s\n", name, err, (unit[0] != '\0') ? " " : "", unit);
+  test_check(err <= errMax, name, __FILE__, __LINE__);
+}
+
+static void print_exact(const char *name, int ok)
+{
+  printf("  %-48s %s\n", name, ok ? "bit-exact" : "differ  FAILED");
+  test_check(ok, name, __FILE__, __LINE__);
+}
+
+/* Angle of a phase of the accumulator, in radians */
+static double ref_angle(uint32_t phase)
+{
+  return (2.0 * TEST_PI * (double)phase / 4294967296.0);
+}
+
+/* Random modulation of about 'amplitude' steps of the accumulator */
+static void make_mod(q31_t *pDst, uint32_t n, double amplitude)
+{
+  uint32_t i;
+
+  test_rand_f64(refIn, n, amplitude);
+  for (i = 0u; i < n; i++)
+  {
+    pDst[i] = (q31_t)refIn[i];
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+/* Largest errors over TEST_LEN samples, generated in blocks */
+static void test_accuracy(void)
+{
+  arm_nco_instance_f32 sF32;
+  arm_nco_instance_q31 sQ31;
+  arm_nco_instance_q15 sQ15;
+  double               s, c, err[3] = {0.0};
+  uint32_t             phase = 0x12345678u, blk, i;
+
+  arm_nco_init_f32(&sF32, TEST_INC, phase, 0u);
+  arm_nco_init_q31(&sQ31, TEST_INC, phase, 0u);
+  arm_nco_init_q15(&sQ15, TEST_INC, phase, 0u);
+  for (blk = 0u; blk < TEST_LEN / TEST_BLOCK; blk++)
+  {
+    arm_nco_f32(&sF32, NULL, NULL, f32Sin, f32Cos, TEST_BLOCK);
+    arm_nco_q31(&sQ31, NULL, NULL, q31Sin, q31Cos, TEST_BLOCK);
+    arm_nco_q15(&sQ15, NULL, NULL, q15Sin, q15Cos, TEST_BLOCK);
+    for (i = 0u; i < TEST_BLOCK; i++)
+    {
+      s      = sin(ref_angle(phase));
+      c      = cos(ref_angle(phase));
+      err[0] = fmax(err[0], fmax(fabs((double)f32Sin[i] - s), fabs((double)f32Cos[i] - c)));
+      err[1] = fmax(err[1], fmax(fabs((double)q31Sin[i] - s * 2147483648.0),
+                                 fabs((double)q31Cos[i] - c * 2147483648.0)));
+      err[2] = fmax(err[2], fmax(fabs((double)q15Sin[i] - s * 32768.0),
+                                 fabs((double)q15Cos[i] - c * 32768.0)));
+      phase += TEST_INC;
+    }
+  }
+  TEST_CHECK(sF32.phase == phase);
+  print_err("arm_nco_f32, absolute", err[0], "", 6.05e-8);
+  print_err("arm_nco_q31", err[1], "LSB", 1.65);
+  print_err("arm_nco_q15", err[2], "LSB", 1.55);
+}
+
+/* The carrier in blocks of testSplitTbl, modulated and dithered or not, must
+   be that of one block; the complex output that of the sine and cosine */
+static void test_blocks(void)
+{
+  arm_nco_instance_f32 sF32;
+  arm_nco_instance_q31 sQ31;
+  arm_nco_instance_q15 sQ15;
+  q31_t               *pFm, *pPm;
+  uint32_t             mode, ix, n, pos, diffs[3];
+  uint8_t              dither;
+  char                 name[64];
+
+  make_mod(freqMod, TEST_SPLIT_LEN, 1.0e6);
+  make_mod(phaseMod, TEST_SPLIT_LEN, 1.0e8);
+  for (mode = 0u; mode < 4u; mode++)        /* Fast path, FM, PM, FM + PM + dither */
+  {
+    pFm    = ((mode & 1u) != 0u) ? freqMod : NULL;
+    pPm    = (mode >= 2u) ? phaseMod : NULL;
+    dither = (mode == 3u) ? 12u : 0u;
+    memset(diffs, 0, sizeof(diffs));
+
+    arm_nco_init_f32(&sF32, 0x0A3D70A4u, 0x80000000u, dither);
+    arm_nco_f32(&sF32, pFm, pPm, f32Sin, f32Cos, TEST_SPLIT_LEN);
+    arm_nco_init_q31(&sQ31, 0x0A3D70A4u, 0x80000000u, dither);
+    arm_nco_q31(&sQ31, pFm, pPm, q31Sin, q31Cos, TEST_SPLIT_LEN);
+    arm_nco_init_q15(&sQ15, 0x0A3D70A4u, 0x80000000u, dither);
+    arm_nco_q15(&sQ15, pFm, pPm, q15Sin, q15Cos, TEST_SPLIT_LEN);
+
+    /* Complex output of one block */
+    arm_nco_init_f32(&sF32, 0x0A3D70A4u, 0x80000000u, dither);
+    arm_nco_cmplx_f32(&sF32, pFm, pPm, f32Cmplx, TEST_SPLIT_LEN);
+    arm_nco_init_q31(&sQ31, 0x0A3D70A4u, 0x80000000u, dither);
+    arm_nco_cmplx_q31(&sQ31, pFm, pPm, q31Cmplx, TEST_SPLIT_LEN);
+    arm_nco_init_q15(&sQ15, 0x0A3D70A4u, 0x80000000u, dither);
+    arm_nco_cmplx_q15(&sQ15, pFm, pPm, q15Cmplx, TEST_SPLIT_LEN);
+    for (n = 0u; n < TEST_SPLIT_LEN; n++)
+    {
+      diffs[0] += ((f32Cmplx[2 * n] != f32Cos[n]) || (f32Cmplx[2 * n + 1] != f32Sin[n])) ? 1u : 0u;
+      diffs[1] += ((q31Cmplx[2 * n] != q31Cos[n]) || (q31Cmplx[2 * n + 1] != q31Sin[n])) ? 1u : 0u;
+      diffs[2] += ((q15Cmplx[2 * n] != q15Cos[n]) || (q15Cmplx[2 * n + 1] != q15Sin[n])) ? 1u : 0u;
+    }
+
+    /* Split blocks, of the separate and of the complex outputs */
+    arm_nco_init_f32(&sF32, 0x0A3D70A4u, 0x80000000u, dither);
+    arm_nco_init_q31(&sQ31, 0x0A3D70A4u, 0x80000000u, dither);
+    arm_nco_init_q15(&sQ15, 0x0A3D70A4u, 0x80000000u, dither);
+    for (ix = 0u, pos = 0u; pos < TEST_SPLIT_LEN; ix++, pos += n)
+    {
+      n = (ix < sizeof(testSplitTbl) / sizeof(testSplitTbl[0])) ? testSplitTbl[ix] : TEST_SPLIT_LEN - pos;
+      n = (n < TEST_SPLIT_LEN - pos) ? n : TEST_SPLIT_LEN - pos;
+      arm_nco_f32(&sF32, (pFm != NULL) ? pFm + pos : NULL, (pPm != NULL) ? pPm + pos : NULL,
+                  f32Split + pos, f32Split2 + pos, n);
+      arm_nco_q31(&sQ31, (pFm != NULL) ? pFm + pos : NULL, (pPm != NULL) ? pPm + pos : NULL,
+                  q31Split + pos, q31Split2 + pos, n);
+      arm_nco_q15(&sQ15, (pFm != NULL) ? pFm + pos : NULL, (pPm != NULL) ? pPm + pos : NULL,
+                  q15Split + pos, q15Split2 + pos, n);
+    }
+    diffs[0] += (memcmp(f32Split, f32Sin, TEST_SPLIT_LEN * sizeof(float32_t)) != 0) ? 1u : 0u;
+    diffs[0] += (memcmp(f32Split2, f32Cos, TEST_SPLIT_LEN * sizeof(float32_t)) != 0) ? 1u : 0u;
+    diffs[1] += (memcmp(q31Split, q31Sin, TEST_SPLIT_LEN * sizeof(q31_t)) != 0) ? 1u : 0u;
+    diffs[1] += (memcmp(q31Split2, q31Cos, TEST_SPLIT_LEN * sizeof(q31_t)) != 0) ? 1u : 0u;
+    diffs[2] += (memcmp(q15Split, q15Sin, TEST_SPLIT_LEN * sizeof(q15_t)) != 0) ? 1u : 0u;
+    diffs[2] += (memcmp(q15Split2, q15Cos, TEST_SPLIT_LEN * sizeof(q15_t)) != 0) ? 1u : 0u;
+
+    arm_nco_init_f32(&sF32, 0x0A3D70A4u, 0x80000000u, dither);
+    arm_nco_init_q31(&sQ31, 0x0A3D70A4u, 0x80000000u, dither);
+    arm_nco_init_q15(&sQ15, 0x0A3D70A4u, 0x80000000u, dither);
+    for (ix = 0u, pos = 0u; pos < TEST_SPLIT_LEN; ix++, pos += n)
+    {
+      n = (ix < sizeof(testSplitTbl) / sizeof(testSplitTbl[0])) ? testSplitTbl[ix] : TEST_SPLIT_LEN - pos;
+      n = (n < TEST_SPLIT_LEN - pos) ? n : TEST_SPLIT_LEN - pos;
+      arm_nco_cmplx_f32(&sF32, (pFm != NULL) ? pFm + pos : NULL, (pPm != NULL) ? pPm + pos : NULL,
+                        f32Split + 2u * pos, n);
+      arm_nco_cmplx_q31(&sQ31, (pFm != NULL) ? pFm + pos : NULL, (pPm != NULL) ? pPm + pos : NULL,
+                        q31Split + 2u * pos, n);
+      arm_nco_cmplx_q15(&sQ15, (pFm != NULL) ? pFm + pos : NULL, (pPm != NULL) ? pPm + pos : NULL,
+                        q15Split + 2u * pos, n);
+    }
+    diffs[0] += (memcmp(f32Split, f32Cmplx, 2u * TEST_SPLIT_LEN * sizeof(float32_t)) != 0) ? 1u : 0u;
+    diffs[1] += (memcmp(q31Split, q31Cmplx, 2u * TEST_SPLIT_LEN * sizeof(q31_t)) != 0) ? 1u : 0u;
+    diffs[2] += (memcmp(q15Split, q15Cmplx, 2u * TEST_SPLIT_LEN * sizeof(q15_t)) != 0) ? 1u : 0u;
+
+    snprintf(name, sizeof(name), "split, complex, f32/q31/q15, %s",
+             (mode == 0u) ? "carrier" : (mode == 1u) ? "FM" : (mode == 2u) ? "PM" : "FM, PM, dither");
+    print_exact(name, (diffs[0] + diffs[1] + diffs[2]) == 0u);
+  }
+}
+
+/* A constant modulation is a change of the frequency or of the initial phase;
+   the dither leaves the accumulator and the frequency alone */
+static void test_modulation(void)
+{
+  arm_nco_instance_f32 sF32, sF32b;
+  arm_nco_instance_q31 sQ31, sQ31b;
+  arm_nco_instance_q15 sQ15, sQ15b;
+  double               err = 0.0, mask;
+  uint32_t             i, phase;
+  int                  ok;
+
+  for (i = 0u; i < TEST_SPLIT_LEN; i++)
+  {
+    freqMod[i]  = -0x01234567;
+    phaseMod[i] = 0x40000000;
+  }
+
+  /* FM by a constant against phaseInc + offset */
+  arm_nco_init_f32(&sF32, 0x0A3D70A4u, 0u, 0u);
+  arm_nco_f32(&sF32, freqMod, NULL, f32Sin, f32Cos, TEST_SPLIT_LEN);
+  arm_nco_init_f32(&sF32b, 0x0A3D70A4u - 0x01234567u, 0u, 0u);
+  arm_nco_f32(&sF32b, NULL, NULL, f32Split, f32Split2, TEST_SPLIT_LEN);
+  ok = (memcmp(f32Sin, f32Split, TEST_SPLIT_LEN * sizeof(float32_t)) == 0) &&
+       (memcmp(f32Cos, f32Split2, TEST_SPLIT_LEN * sizeof(float32_t)) == 0) && (sF32.phase == sF32b.phase);
+  arm_nco_init_q31(&sQ31, 0x0A3D70A4u, 0u, 0u);
+  arm_nco_q31(&sQ31, freqMod, NULL, q31Sin, q31Cos, TEST_SPLIT_LEN);
+  arm_nco_init_q31(&sQ31b, 0x0A3D70A4u - 0x01234567u, 0u, 0u);
+  arm_nco_q31(&sQ31b, NULL, NULL, q31Split, q31Split2, TEST_SPLIT_LEN);
+  ok = ok && (memcmp(q31Sin, q31Split, TEST_SPLIT_LEN * sizeof(q31_t)) == 0) &&
+       (memcmp(q31Cos, q31Split2, TEST_SPLIT_LEN * sizeof(q31_t)) == 0) && (sQ31.phase == sQ31b.phase);
+  arm_nco_init_q15(&sQ15, 0x0A3D70A4u, 0u, 0u);
+  arm_nco_q15(&sQ15, freqMod, NULL, q15Sin, q15Cos, TEST_SPLIT_LEN);
+  arm_nco_init_q15(&sQ15b, 0x0A3D70A4u - 0x01234567u, 0u, 0u);
+  arm_nco_q15(&sQ15b, NULL, NULL, q15Split, q15Split2, TEST_SPLIT_LEN);
+  ok = ok && (memcmp(q15Sin, q15Split, TEST_SPLIT_LEN * sizeof(q15_t)) == 0) &&
+       (memcmp(q15Cos, q15Split2, TEST_SPLIT_LEN * sizeof(q15_t)) == 0) && (sQ15.phase == sQ15b.phase);
+  print_exact("constant FM against the shifted phaseInc", ok);
+
+  /* PM by a constant against the shifted initial phase, which the PM does not advance */
+  arm_nco_init_f32(&sF32, 0x0A3D70A4u, 0u, 0u);
+  arm_nco_f32(&sF32, NULL, phaseMod, f32Sin, f32Cos, TEST_SPLIT_LEN);
+  arm_nco_init_f32(&sF32b, 0x0A3D70A4u, 0x40000000u, 0u);
+  arm_nco_f32(&sF32b, NULL, NULL, f32Split, f32Split2, TEST_SPLIT_LEN);
+  ok = (memcmp(f32Sin, f32Split, TEST_SPLIT_LEN * sizeof(float32_t)) == 0) &&
+       (memcmp(f32Cos, f32Split2, TEST_SPLIT_LEN * sizeof(float32_t)) == 0) &&
+       (sF32.phase == sF32b.phase - 0x40000000u);
+  arm_nco_init_q31(&sQ31, 0x0A3D70A4u, 0u, 0u);
+  arm_nco_q31(&sQ31, NULL, phaseMod, q31Sin, q31Cos, TEST_SPLIT_LEN);
+  arm_nco_init_q31(&sQ31b, 0x0A3D70A4u, 0x40000000u, 0u);
+  arm_nco_q31(&sQ31b, NULL, NULL, q31Split, q31Split2, TEST_SPLIT_LEN);
+  ok = ok && (memcmp(q31Sin, q31Split, TEST_SPLIT_LEN * sizeof(q31_t)) == 0) &&
+       (memcmp(q31Cos, q31Split2, TEST_SPLIT_LEN * sizeof(q31_t)) == 0);
+  arm_nco_init_q15(&sQ15, 0x0A3D70A4u, 0u, 0u);
+  arm_nco_q15(&sQ15, NULL, phaseMod, q15Sin, q15Cos, TEST_SPLIT_LEN);
+  arm_nco_init_q15(&sQ15b, 0x0A3D70A4u, 0x40000000u, 0u);
+  arm_nco_q15(&sQ15b, NULL, NULL, q15Split, q15Split2, TEST_SPLIT_LEN);
+  ok = ok && (memcmp(q15Sin, q15Split, TEST_SPLIT_LEN * sizeof(q15_t)) == 0) &&
+       (memcmp(q15Cos, q15Split2, TEST_SPLIT_LEN * sizeof(q15_t)) == 0);
+  print_exact("constant PM against the shifted initial phase", ok);
+
+  /* A single output takes the general path, with the samples of the fast one */
+  arm_nco_init_q31(&sQ31, 0x0A3D70A4u, 0u, 0u);
+  arm_nco_q31(&sQ31, NULL, NULL, q31Sin, NULL, TEST_SPLIT_LEN);
+  arm_nco_init_q31(&sQ31b, 0x0A3D70A4u, 0u, 0u);
+  arm_nco_q31(&sQ31b, NULL, NULL, q31Split, q31Split2, TEST_SPLIT_LEN);
+  print_exact("arm_nco_q31, sine only against both outputs",
+              (memcmp(q31Sin, q31Split, TEST_SPLIT_LEN * sizeof(q31_t)) == 0) && (sQ31.phase == sQ31b.phase));
+
+  /* 12 bits of dither: the accumulator is that of the carrier without dither,
+     and the error is within the phase error of the dither */
+  arm_nco_init_f32(&sF32, TEST_INC, 0u, 12u);
+  arm_nco_f32(&sF32, NULL, NULL, f32Sin, f32Cos, TEST_SPLIT_LEN);
+  phase = 0u;
+  for (i = 0u; i < TEST_SPLIT_LEN; i++)
+  {
+    err    = fmax(err, fmax(fabs((double)f32Sin[i] - sin(ref_angle(phase))),
+                            fabs((double)f32Cos[i] - cos(ref_angle(phase)))));
+    phase += TEST_INC;
+  }
+  mask = ref_angle(0xFFFu);
+  TEST_CHECK(sF32.phase == phase);
+  TEST_CHECK(sF32.ditherState != 0x2545F491u);
+  printf("  %-48s %10.3g\n", "arm_nco_f32, 12 dither bits, absolute", err);
+  TEST_CHECK((err > 6.05e-8) && (err <= mask + 6.05e-8));
+}
+
+/* Largest spurious tone of 4096 samples of a Q15 carrier (dB below it):
+   the phase repeats every 64 samples, so that the error is a set of tones */
+static double spur_q15(uint8_t ditherBits)
+{
+  arm_nco_instance_q15 s;
+  double               carrier, spur = 0.0, p;
+  uint32_t             k;
+
+  arm_nco_init_q15(&s, 9u << 26, 0x00123456u, ditherBits);
+  arm_nco_cmplx_q15(&s, NULL, NULL, q15Cmplx, TEST_BLOCK);
+  for (k = 0u; k < 2u * TEST_BLOCK; k++)
+  {
+    fftBuf[k] = (float32_t)q15Cmplx[k] / 32768.0f;
+  }
+  arm_cfft_f32(&arm_cfft_sR_f32_len4096, fftBuf, 0u, 1u);
+  carrier = 0.0;
+  for (k = 0u; k < TEST_BLOCK; k++)
+  {
+    p = (double)fftBuf[2 * k] * fftBuf[2 * k] + (double)fftBuf[2 * k + 1] * fftBuf[2 * k + 1];
+    if (k == 9u * TEST_BLOCK / 64u)
+    {
+      carrier = p;
+    }
+    else
+    {
+      spur = fmax(spur, p);
+    }
+  }
+  return (10.0 * log10(carrier / spur));
+}
+
+static void test_dither(void)
+{
+  double sfdr, sfdrDither;
+
+  sfdr       = spur_q15(0u);
+  sfdrDither = spur_q15(16u);
+  printf("  %-48s %7.1f dB\n", "arm_nco_q15, largest spur, no dither", sfdr);
+  printf("  %-48s %7.1f dB\n", "arm_nco_q15, largest spur, 16 dither bits", sfdrDither);
+  TEST_CHECK(sfdrDither > sfdr);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  arm_nco_instance_f32 sF32;
+  arm_nco_instance_q31 sQ31;
+  arm_nco_instance_q15 sQ15;
+  uint32_t             n = TEST_BLOCK, i, phase;
+
+  arm_nco_init_f32(&sF32, 0x0A3D70A4u, 0u, 0u);
+  arm_nco_init_q31(&sQ31, 0x0A3D70A4u, 0u, 0u);
+  arm_nco_init_q15(&sQ15, 0x0A3D70A4u, 0u, 0u);
+  make_mod(freqMod, n, 1.0e6);
+
+  /* The loops of the scalar functions advance the same phase */
+  phase = 0u;
+  TEST_BENCH("arm_sin_cos_f32 loop", n, for (i = 0u; i < n; i++)
+  {
+    arm_sin_cos_f32((float32_t)((int32_t)phase) * (180.0f / 2147483648.0f), &f32Sin[i], &f32Cos[i]);
+    phase += 0x0A3D70A4u;
+  });
+  TEST_BENCH("arm_nco_f32", n, arm_nco_f32(&sF32, NULL, NULL, f32Sin, f32Cos, n));
+  TEST_BENCH("arm_nco_cmplx_f32", n, arm_nco_cmplx_f32(&sF32, NULL, NULL, f32Cmplx, n));
+  TEST_BENCH("arm_nco_f32, FM", n, arm_nco_f32(&sF32, freqMod, NULL, f32Sin, f32Cos, n));
+
+  TEST_BENCH("arm_sin_cos_q31 loop", n, for (i = 0u; i < n; i++)
+  {
+    arm_sin_cos_q31((q31_t)phase, &q31Sin[i], &q31Cos[i]);
+    phase += 0x0A3D70A4u;
+  });
+  TEST_BENCH("arm_sin_q31 + arm_cos_q31 loop", n, for (i = 0u; i < n; i++)
+  {
+    q31Sin[i] = arm_sin_q31((q31_t)(phase >> 1));
+    q31Cos[i] = arm_cos_q31((q31_t)(phase >> 1));
+    phase += 0x0A3D70A4u;
+  });
+  TEST_BENCH("arm_nco_q31", n, arm_nco_q31(&sQ31, NULL, NULL, q31Sin, q31Cos, n));
+  TEST_BENCH("arm_nco_cmplx_q31", n, arm_nco_cmplx_q31(&sQ31, NULL, NULL, q31Cmplx, n));
+  TEST_BENCH("arm_nco_q31, FM", n, arm_nco_q31(&sQ31, freqMod, NULL, q31Sin, q31Cos, n));
+
+  TEST_BENCH("arm_sin_q15 + arm_cos_q15 loop", n, for (i = 0u; i < n; i++)
+  {
+    q15Sin[i] = arm_sin_q15((q15_t)(phase >> 17));
+    q15Cos[i] = arm_cos_q15((q15_t)(phase >> 17));
+    phase += 0x0A3D70A4u;
+  });
+  TEST_BENCH("arm_nco_q15", n, arm_nco_q15(&sQ15, NULL, NULL, q15Sin, q15Cos, n));
+  TEST_BENCH("arm_nco_cmplx_q15", n, arm_nco_cmplx_q15(&sQ15, NULL, NULL, q15Cmplx, n));
+  arm_nco_init_q15(&sQ15, 0x0A3D70A4u, 0u, 16u);
+  TEST_BENCH("arm_nco_q15, 16 dither bits", n, arm_nco_q15(&sQ15, NULL, NULL, q15Sin, q15Cos, n));
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_nco_test", argc, argv);
+  test_seed(1u);
+  test_accuracy();
+  test_blocks();
+  test_modulation();
+  test_dither();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
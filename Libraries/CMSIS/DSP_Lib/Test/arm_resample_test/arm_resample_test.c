@@ -0,0 +1,302 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_resample_test.c
+*
+* Description:  Rational and Farrow resamplers against direct evaluations.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Checks arm_fir_resample_f32/q31/q15() against a double precision
+ * upsample-filter-downsample, for several L/M factors over several blocks,
+ * and arm_farrow_f32() against the cubic it evaluates and against the
+ * band-limited signal it samples, with a step changed between blocks.  With
+ * "bench" it compares the 44.1 kHz to 48 kHz resampler (160/147) with
+ * arm_fir_interpolate_f32() followed by arm_fir_decimate_f32(), which is what
+ * the library offered before, per output sample.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_BLOCKS          4u         /* Blocks of each test */
+#define TEST_IN_MAX       1764u         /* Input samples of a test, TEST_BLOCKS * 441 */
+#define TEST_OUT_MAX      3600u
+#define TEST_TAPS_MAX     3840u         /* 24 taps per phase for 160/147 */
+#define TEST_UP_MAX      70560u         /* 441 * 160 intermediate samples of the benchmark */
+
+typedef struct
+{
+  uint16_t L;
+  uint16_t M;
+  uint16_t numTaps;
+  uint16_t blockSize;
+} test_factor;
+
+static const test_factor testFactorTbl[] =
+{
+  {160u, 147u, 3840u, 441u},                    /* 44.1 kHz to 48 kHz */
+  {147u, 160u, 3822u, 320u},                    /* 48 kHz to 44.1 kHz */
+  {2u, 3u, 48u, 99u},
+  {3u, 1u, 36u, 50u},
+  {1u, 4u, 64u, 48u}
+};
+
+static double    refCoeffs[TEST_TAPS_MAX];
+static double    refIn[TEST_IN_MAX];
+static double    refOut[TEST_OUT_MAX];
+static float32_t coeffsF32[TEST_TAPS_MAX];
+static q31_t     coeffsQ31[TEST_TAPS_MAX];
+static q15_t     coeffsQ15[TEST_TAPS_MAX];
+static float32_t stateF32[TEST_UP_MAX + TEST_TAPS_MAX];
+static q31_t     stateQ31[TEST_IN_MAX + TEST_TAPS_MAX];
+static q15_t     stateQ15[TEST_IN_MAX + TEST_TAPS_MAX];
+static float32_t inF32[TEST_IN_MAX];
+static q31_t     inQ31[TEST_IN_MAX];
+static q15_t     inQ15[TEST_IN_MAX];
+static float32_t outF32[TEST_OUT_MAX];
+static q31_t     outQ31[TEST_OUT_MAX];
+static q15_t     outQ15[TEST_OUT_MAX];
+static float32_t upF32[TEST_UP_MAX];
+
+/* Low-pass at the intermediate rate: gain L, cutoff 0.9 / max(L, M) of the
+   Nyquist frequency, Hann window.  The taps are rounded to each format, and
+   the reference uses the float32 ones, time reversed back. */
+static void resample_design(const test_factor *pF)
+{
+  double   fc = 0.45 / (double)((pF->L > pF->M) ? pF->L : pF->M), m, t, h[TEST_TAPS_MAX];
+  uint32_t i;
+
+  m = (double)(pF->numTaps - 1u) / 2.0;
+  for (i = 0u; i < pF->numTaps; i++)
+  {
+    t    = (double)i - m;
+    h[i] = ((t == 0.0) ? 2.0 * fc : sin(2.0 * PI * fc * t) / (PI * t)) * (double)pF->L *
+           (0.5 - 0.5 * cos(2.0 * PI * ((double)i + 0.5) / (double)pF->numTaps));
+  }
+  for (i = 0u; i < pF->numTaps; i++)
+  {
+    refCoeffs[i] = h[pF->numTaps - 1u - i];
+  }
+  test_f64_to_f32(refCoeffs, coeffsF32, pF->numTaps);
+  test_f64_to_q31(refCoeffs, coeffsQ31, pF->numTaps);
+  test_f64_to_q15(refCoeffs, coeffsQ15, pF->numTaps);
+}
+
+/* y[k] = sum of h[j] * xup[k*M - j], xup the input zero stuffed by L; 'pH'
+   holds the taps in time order */
+static uint32_t ref_resample(const test_factor *pF, const double *pH, const double *pX, uint32_t n, double *pY)
+{
+  uint32_t k, j, u, numOut = n * pF->L / pF->M;
+  double   acc;
+
+  for (k = 0u; k < numOut; k++)
+  {
+    acc = 0.0;
+    u   = k * pF->M;
+    for (j = u % pF->L; (j < pF->numTaps) && (j <= u); j += pF->L)
+    {
+      acc += pH[j] * pX[(u - j) / pF->L];
+    }
+    pY[k] = acc;
+  }
+  return (numOut);
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+static void test_resample(void)
+{
+  arm_fir_resample_instance_f32 sF32;
+  arm_fir_resample_instance_q31 sQ31;
+  arm_fir_resample_instance_q15 sQ15;
+  const test_factor            *pF;
+  double                        h[TEST_TAPS_MAX];
+  double                        snr[3], snrMin[3] = {INFINITY, INFINITY, INFINITY};
+  uint32_t                      ix, i, n, numOut, blk, outBlk;
+
+  for (ix = 0u; ix < sizeof(testFactorTbl) / sizeof(testFactorTbl[0]); ix++)
+  {
+    pF = &testFactorTbl[ix];
+    resample_design(pF);
+    n  = TEST_BLOCKS * pF->blockSize;
+    test_rand_f64(refIn, n, 0.5);
+    test_f64_to_f32(refIn, inF32, n);
+    test_f64_to_q31(refIn, inQ31, n);
+    test_f64_to_q15(refIn, inQ15, n);
+
+    TEST_CHECK(arm_fir_resample_init_f32(&sF32, pF->L, pF->M, pF->numTaps, coeffsF32, stateF32, pF->blockSize)
+               == ARM_MATH_SUCCESS);
+    TEST_CHECK(arm_fir_resample_init_q31(&sQ31, pF->L, pF->M, pF->numTaps, coeffsQ31, stateQ31, pF->blockSize)
+               == ARM_MATH_SUCCESS);
+    TEST_CHECK(arm_fir_resample_init_q15(&sQ15, pF->L, pF->M, pF->numTaps, coeffsQ15, stateQ15, pF->blockSize)
+               == ARM_MATH_SUCCESS);
+    outBlk = (uint32_t)pF->blockSize * pF->L / pF->M;
+    for (blk = 0u; blk < TEST_BLOCKS; blk++)
+    {
+      arm_fir_resample_f32(&sF32, &inF32[blk * pF->blockSize], &outF32[blk * outBlk], pF->blockSize);
+      arm_fir_resample_q31(&sQ31, &inQ31[blk * pF->blockSize], &outQ31[blk * outBlk], pF->blockSize);
+      arm_fir_resample_q15(&sQ15, &inQ15[blk * pF->blockSize], &outQ15[blk * outBlk], pF->blockSize);
+    }
+
+    for (i = 0u; i < pF->numTaps; i++)          /* Each format against its own rounded taps */
+    {
+      h[i] = coeffsF32[pF->numTaps - 1u - i];
+    }
+    numOut = ref_resample(pF, h, refIn, n, refOut);
+    TEST_CHECK(numOut == TEST_BLOCKS * outBlk);
+    snr[0] = test_snr_f32(refOut, outF32, numOut);
+    for (i = 0u; i < pF->numTaps; i++)
+    {
+      h[i] = (double)coeffsQ31[pF->numTaps - 1u - i] / 2147483648.0;
+    }
+    (void)ref_resample(pF, h, refIn, n, refOut);
+    snr[1] = test_snr_q31(refOut, outQ31, numOut);
+    for (i = 0u; i < pF->numTaps; i++)
+    {
+      h[i] = (double)coeffsQ15[pF->numTaps - 1u - i] / 32768.0;
+    }
+    for (i = 0u; i < n; i++)                    /* The q15 input is rounded too */
+    {
+      refIn[i] = (double)inQ15[i] / 32768.0;
+    }
+    (void)ref_resample(pF, h, refIn, n, refOut);
+    snr[2] = test_snr_q15(refOut, outQ15, numOut);
+    for (i = 0u; i < 3u; i++)
+    {
+      snrMin[i] = (snr[i] < snrMin[i]) ? snr[i] : snrMin[i];
+    }
+  }
+  test_check_snr("arm_fir_resample_f32, 5 factors, lowest", snrMin[0], 125.0);
+  test_check_snr("arm_fir_resample_q31, 5 factors, lowest", snrMin[1], 160.0);
+  test_check_snr("arm_fir_resample_q15, 5 factors, lowest", snrMin[2], 65.0);
+
+  TEST_CHECK(arm_fir_resample_init_f32(&sF32, 160u, 147u, 3830u, coeffsF32, stateF32, 441u) == ARM_MATH_LENGTH_ERROR);
+  TEST_CHECK(arm_fir_resample_init_f32(&sF32, 160u, 147u, 3840u, coeffsF32, stateF32, 440u) == ARM_MATH_LENGTH_ERROR);
+}
+
+static void test_farrow(void)
+{
+  static const float32_t stepTbl[] = {0.91875f, 1.0884354f, 0.5f, 2.75f};   /* Changed between blocks */
+  arm_farrow_instance_f32 s;
+  double                  refCubic[TEST_OUT_MAX], refSignal[TEST_OUT_MAX];
+  double                  t, mu, xm1, x0, x1, x2;
+  uint64_t                pos = 0u;             /* Position of the next output + 2 samples, 2^-32 units */
+  uint32_t                blk, numOut = 0u, k, nb, n;
+  int64_t                 i;
+
+  for (n = 0u; n < 1600u; n++)                  /* Two tones, well below the Nyquist frequency */
+  {
+    t        = (double)n;
+    inF32[n] = (float32_t)(0.5 * sin(2.0 * PI * 0.011 * t) + 0.3 * cos(2.0 * PI * 0.037 * t + 1.0));
+  }
+  TEST_CHECK(arm_farrow_init_f32(&s, stepTbl[0], stateF32, 400u) == ARM_MATH_SUCCESS);
+  TEST_CHECK(arm_farrow_set_step_f32(&s, 0.0f) == ARM_MATH_ARGUMENT_ERROR);
+  for (blk = 0u; blk < 4u; blk++)
+  {
+    TEST_CHECK(arm_farrow_set_step_f32(&s, stepTbl[blk]) == ARM_MATH_SUCCESS);
+    nb = arm_farrow_f32(&s, &inF32[blk * 400u], &outF32[numOut], 400u);
+    for (k = numOut; k < numOut + nb; k++)      /* The step in the fixed point of the instance */
+    {
+      i  = (int64_t)(pos >> 32) - 2;            /* Output delayed by 2 input samples */
+      mu = (double)(uint32_t)pos / 4294967296.0;
+      xm1 = (i - 1 >= 0) ? inF32[i - 1] : 0.0;
+      x0  = (i >= 0)     ? inF32[i]     : 0.0;
+      x1  = (i + 1 >= 0) ? inF32[i + 1] : 0.0;
+      x2  = (i + 2 >= 0) ? inF32[i + 2] : 0.0;
+      refCubic[k] = x0 + mu * ((x1 - xm1 / 3.0 - x0 / 2.0 - x2 / 6.0) +
+                         mu * (((xm1 + x1) / 2.0 - x0) + mu * ((x2 - xm1) / 6.0 + (x0 - x1) / 2.0)));
+      t = (double)i + mu;
+      refSignal[k] = 0.5 * sin(2.0 * PI * 0.011 * t) + 0.3 * cos(2.0 * PI * 0.037 * t + 1.0);
+      pos += ((uint64_t)s.stepInt << 32) + s.stepFrac;
+    }
+    numOut += nb;
+  }
+  TEST_CHECK(numOut > 1600u);
+  test_check_snr("arm_farrow_f32, against the cubic", test_snr_f32(refCubic, outF32, numOut), 140.0);
+  test_check_snr("arm_farrow_f32, against the signal, 0.011, 0.037", /* After the first input sample */
+                 test_snr_f32(&refSignal[8], &outF32[8], numOut - 8u), 80.0);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  const test_factor               *pF = &testFactorTbl[0];
+  arm_fir_resample_instance_f32    sRes;
+  arm_fir_interpolate_instance_f32 sInt;
+  arm_fir_decimate_instance_f32    sDec;
+  arm_farrow_instance_f32          sFar;
+  static float32_t                 decState[TEST_UP_MAX];
+  float32_t                        one = 1.0f;
+  uint32_t                         numOut = (uint32_t)pF->blockSize * pF->L / pF->M;
+
+  resample_design(pF);
+  test_rand_f64(refIn, pF->blockSize, 0.5);
+  test_f64_to_f32(refIn, inF32, pF->blockSize);
+  (void)arm_fir_resample_init_f32(&sRes, pF->L, pF->M, pF->numTaps, coeffsF32, stateF32, pF->blockSize);
+  TEST_BENCH("arm_fir_resample_f32, 160/147", numOut, arm_fir_resample_f32(&sRes, inF32, outF32, pF->blockSize));
+
+  /* Same filter in the interpolator, the decimator only keeps one sample out of M */
+  (void)arm_fir_interpolate_init_f32(&sInt, (uint8_t)pF->L, pF->numTaps, coeffsF32, stateF32, pF->blockSize);
+  (void)arm_fir_decimate_init_f32(&sDec, 1u, (uint8_t)pF->M, &one, decState, pF->blockSize * pF->L);
+  TEST_BENCH("arm_fir_interpolate_f32 + arm_fir_decimate_f32", numOut,
+             (arm_fir_interpolate_f32(&sInt, inF32, upF32, pF->blockSize),
+              arm_fir_decimate_f32(&sDec, upF32, outF32, pF->blockSize * pF->L)));
+
+  (void)arm_farrow_init_f32(&sFar, 147.0f / 160.0f, stateF32, pF->blockSize);
+  TEST_BENCH("arm_farrow_f32, step 147/160", numOut, (void)arm_farrow_f32(&sFar, inF32, outF32, pF->blockSize));
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_resample_test", argc, argv);
+  test_seed(1u);
+  test_resample();
+  test_farrow();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
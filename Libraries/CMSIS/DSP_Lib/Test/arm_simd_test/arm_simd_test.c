@@ -0,0 +1,464 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_simd_test.c
+*
+* Description:  Vectorised float32 kernels of the host build against their C code.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * The kernels with a host SIMD code path (core_host.h) are also built with
+ * ARM_MATH_HOST_NO_SIMD under the names <name>_nosimd (see the Makefile).  The
+ * test checks that the vectorised FIR, biquad, complex FFT, matrix product and
+ * vector math functions (arm_vsin_f32(), ...) give the same bits as the C code,
+ * for sizes that exercise the vector tails and for the special values, and
+ * that the dot product, which sums in another order, is within its documented
+ * bound.  With "bench" it measures both code paths.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "test_helper.h"
+
+#define TEST_LEN          4096u         /* Largest block and FFT length */
+#define TEST_MAT_MAX        64u         /* Largest matrix */
+#define TEST_TAPS_MAX       64u
+#define TEST_STAGES_MAX      8u
+
+/* The C code of the kernels */
+void arm_fir_f32_nosimd(const arm_fir_instance_f32 *S, float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_biquad_cascade_df2T_f32_nosimd(const arm_biquad_cascade_df2T_instance_f32 *S, float32_t *pSrc,
+                                        float32_t *pDst, uint32_t blockSize);
+void arm_cfft_f32_nosimd(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag, uint8_t bitReverseFlag);
+arm_status arm_mat_mult_f32_nosimd(const arm_matrix_instance_f32 *pSrcA, const arm_matrix_instance_f32 *pSrcB,
+                                   arm_matrix_instance_f32 *pDst);
+void arm_dot_prod_f32_nosimd(float32_t *pSrcA, float32_t *pSrcB, uint32_t blockSize, float32_t *result);
+void arm_vsin_f32_nosimd(float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_vcos_f32_nosimd(float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_vatan2_f32_nosimd(float32_t *pSrcY, float32_t *pSrcX, float32_t *pDst, uint32_t blockSize);
+void arm_vexp_f32_nosimd(float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_vlog_f32_nosimd(float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+arm_status arm_vsqrt_f32_nosimd(float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+
+/* One-input vector function, its C code, the range of its random inputs and its special values */
+typedef struct
+{
+  const char *name;
+  void      (*pFunc)(float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+  void      (*pFuncC)(float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+  double      lo;
+  double      hi;
+  uint32_t    special;                  /* 1: add the special values, 2: also take exp() of the inputs */
+} test_vfunc;
+
+static const arm_cfft_instance_f32 *testCfftTbl[] =
+{
+  &arm_cfft_sR_f32_len16,  &arm_cfft_sR_f32_len32,  &arm_cfft_sR_f32_len64,   &arm_cfft_sR_f32_len128,
+  &arm_cfft_sR_f32_len256, &arm_cfft_sR_f32_len512, &arm_cfft_sR_f32_len1024, &arm_cfft_sR_f32_len2048,
+  &arm_cfft_sR_f32_len4096
+};
+
+static double    refIn[2 * TEST_LEN];
+static float32_t testIn[2 * TEST_LEN];
+static float32_t testIn2[2 * TEST_LEN];
+static float32_t testOut[2 * TEST_LEN];
+static float32_t testOutC[2 * TEST_LEN];
+
+static float32_t firCoeffs[TEST_TAPS_MAX];
+static float32_t firState[TEST_TAPS_MAX + TEST_LEN - 1];
+static float32_t firStateC[TEST_TAPS_MAX + TEST_LEN - 1];
+static float32_t iirCoeffs[5 * TEST_STAGES_MAX];
+static float32_t iirState[2 * TEST_STAGES_MAX];
+static float32_t iirStateC[2 * TEST_STAGES_MAX];
+
+static void test_fill(float32_t *pDst, uint32_t n, double amplitude)
+{
+  test_rand_f64(refIn, n, amplitude);
+  test_f64_to_f32(refIn, pDst, n);
+}
+
+/* Stable sections, poles of radius 0.9 spread over the band */
+static void iir_design(uint32_t numStages)
+{
+  double   w;
+  uint32_t s;
+
+  test_fill(iirCoeffs, 5u * numStages, 0.5);
+  for (s = 0u; s < numStages; s++)
+  {
+    w = PI * (double)(s + 1u) / (double)(numStages + 1u);
+    iirCoeffs[5 * s + 3] = (float32_t)(2.0 * 0.9 * cos(w));
+    iirCoeffs[5 * s + 4] = -0.81f;
+  }
+}
+
+/* Prints and checks that the runs of one kernel gave the bits of the C code */
+static void check_exact(const char *name, uint32_t runs, uint32_t diffs)
+{
+  if (diffs == 0u)
+  {
+    printf("  %-48s bit-exact, %u runs\n", name, (unsigned)runs);
+  }
+  else
+  {
+    printf("  %-48s %u of %u runs differ  FAILED\n", name, (unsigned)diffs, (unsigned)runs);
+  }
+  test_check(diffs == 0u, name, __FILE__, __LINE__);
+}
+
+static uint32_t differ(const float32_t *pA, const float32_t *pB, uint32_t n)
+{
+  return ((memcmp(pA, pB, n * sizeof(float32_t)) != 0) ? 1u : 0u);
+}
+
+static void vsqrt_f32(float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+  (void)arm_vsqrt_f32(pSrc, pDst, blockSize);
+}
+
+static void vsqrt_f32_nosimd(float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+  (void)arm_vsqrt_f32_nosimd(pSrc, pDst, blockSize);
+}
+
+static const test_vfunc testVfuncTbl[] =
+{
+  {"arm_vsin_f32, |x| <= 8192",                 arm_vsin_f32,  arm_vsin_f32_nosimd,  -8192.0, 8192.0, 0u},
+  {"arm_vcos_f32, |x| <= 8192",                 arm_vcos_f32,  arm_vcos_f32_nosimd,  -8192.0, 8192.0, 0u},
+  {"arm_vexp_f32, -104 to 89, inf, NaN",        arm_vexp_f32,  arm_vexp_f32_nosimd,  -104.0, 89.0, 1u},
+  {"arm_vlog_f32, 1e-45 to 1e38, 0, < 0, NaN",  arm_vlog_f32,  arm_vlog_f32_nosimd,  -103.0, 88.0, 2u},
+  {"arm_vsqrt_f32, 1e-45 to 1e38, 0, < 0, NaN", vsqrt_f32,     vsqrt_f32_nosimd,     -103.0, 88.0, 2u}
+};
+
+/* Random inputs in [lo, hi], or their exponentials ('special' 2), then the special values */
+static void vmath_fill(float32_t *pDst, uint32_t n, const test_vfunc *pV)
+{
+  static const float32_t specialTbl[] = {0.0f, -0.0f, 1e-40f, -1e-40f, 1.0f, -1.0f, 88.8f, -104.0f,
+                                         INFINITY, -INFINITY, NAN};
+  uint32_t               i;
+
+  test_rand_f64(refIn, n, 0.5 * (pV->hi - pV->lo));
+  for (i = 0u; i < n; i++)
+  {
+    refIn[i] += 0.5 * (pV->hi + pV->lo);
+    pDst[i]   = (float32_t)((pV->special == 2u) ? exp(refIn[i]) : refIn[i]);
+  }
+  for (i = 0u; (pV->special != 0u) && (i < n) && (i < sizeof(specialTbl) / sizeof(specialTbl[0])); i++)
+  {
+    pDst[(i * 7u) % n] = specialTbl[i];
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+static void test_fir(void)
+{
+  static const uint32_t tapsTbl[]  = {1u, 7u, 8u, 13u, 32u, 64u};
+  static const uint32_t blockTbl[] = {1u, 7u, 61u, 256u};
+  arm_fir_instance_f32  s, sC;
+  uint32_t              it, ib, i, n, runs = 0u, diffs = 0u;
+
+  test_fill(testIn, TEST_LEN, 1.0);
+  for (it = 0u; it < sizeof(tapsTbl) / sizeof(tapsTbl[0]); it++)
+  {
+    test_fill(firCoeffs, tapsTbl[it], 0.5);
+    for (ib = 0u; ib < sizeof(blockTbl) / sizeof(blockTbl[0]); ib++)
+    {
+      n = blockTbl[ib];
+      arm_fir_init_f32(&s, (uint16_t)tapsTbl[it], firCoeffs, firState, n);
+      arm_fir_init_f32(&sC, (uint16_t)tapsTbl[it], firCoeffs, firStateC, n);
+      for (i = 0u; (i + n) <= 1024u; i += n)    /* The state carries over the blocks */
+      {
+        arm_fir_f32(&s, &testIn[i], &testOut[i], n);
+        arm_fir_f32_nosimd(&sC, &testIn[i], &testOutC[i], n);
+      }
+      diffs += differ(testOut, testOutC, i);
+      runs++;
+    }
+  }
+  check_exact("arm_fir_f32, 1 to 64 taps, blocks 1 to 256", runs, diffs);
+}
+
+static void test_biquad(void)
+{
+  static const uint32_t blockTbl[] = {1u, 5u, 64u};
+  arm_biquad_cascade_df2T_instance_f32 s, sC;
+  uint32_t              stages, ib, i, n, runs = 0u, diffs = 0u;
+
+  test_fill(testIn, TEST_LEN, 1.0);
+  for (stages = 1u; stages <= TEST_STAGES_MAX; stages++)
+  {
+    iir_design(stages);
+    for (ib = 0u; ib < sizeof(blockTbl) / sizeof(blockTbl[0]); ib++)
+    {
+      n = blockTbl[ib];
+      arm_biquad_cascade_df2T_init_f32(&s, (uint8_t)stages, iirCoeffs, iirState);
+      arm_biquad_cascade_df2T_init_f32(&sC, (uint8_t)stages, iirCoeffs, iirStateC);
+      for (i = 0u; (i + n) <= 1024u; i += n)
+      {
+        arm_biquad_cascade_df2T_f32(&s, &testIn[i], &testOut[i], n);
+        arm_biquad_cascade_df2T_f32_nosimd(&sC, &testIn[i], &testOutC[i], n);
+      }
+      diffs += differ(testOut, testOutC, i);
+      runs++;
+    }
+  }
+  check_exact("arm_biquad_cascade_df2T_f32, 1 to 8 stages", runs, diffs);
+}
+
+static void test_cfft(void)
+{
+  uint32_t ix, n, ifft, runs = 0u, diffs = 0u;
+
+  for (ix = 0u; ix < sizeof(testCfftTbl) / sizeof(testCfftTbl[0]); ix++)
+  {
+    n = testCfftTbl[ix]->fftLen;
+    for (ifft = 0u; ifft <= 1u; ifft++)
+    {
+      test_fill(testOut, 2u * n, 1.0);
+      memcpy(testOutC, testOut, 2u * n * sizeof(float32_t));
+      arm_cfft_f32(testCfftTbl[ix], testOut, (uint8_t)ifft, 1u);
+      arm_cfft_f32_nosimd(testCfftTbl[ix], testOutC, (uint8_t)ifft, 1u);
+      diffs += differ(testOut, testOutC, 2u * n);
+      runs++;
+    }
+  }
+  check_exact("arm_cfft_f32, 16 to 4096, forward and inverse", runs, diffs);
+}
+
+static void test_mat_mult(void)
+{
+  static const uint16_t dimTbl[][3] =           /* Rows of A, columns of A, columns of B */
+  {
+    {1u, 1u, 1u}, {3u, 5u, 7u}, {8u, 8u, 8u}, {9u, 17u, 13u}, {16u, 3u, 33u},
+    {16u, 16u, 16u}, {37u, 21u, 45u}, {64u, 64u, 64u}   /* MAT_MULT_BLOCK_MIN and above: blocked */
+  };
+  arm_matrix_instance_f32 a, b, c, cC;
+  uint32_t                ix, runs = 0u, diffs = 0u;
+
+  test_fill(testIn, TEST_MAT_MAX * TEST_MAT_MAX, 1.0);
+  test_fill(testIn2, TEST_MAT_MAX * TEST_MAT_MAX, 1.0);
+  for (ix = 0u; ix < sizeof(dimTbl) / sizeof(dimTbl[0]); ix++)
+  {
+    arm_mat_init_f32(&a, dimTbl[ix][0], dimTbl[ix][1], testIn);
+    arm_mat_init_f32(&b, dimTbl[ix][1], dimTbl[ix][2], testIn2);
+    arm_mat_init_f32(&c, dimTbl[ix][0], dimTbl[ix][2], testOut);
+    arm_mat_init_f32(&cC, dimTbl[ix][0], dimTbl[ix][2], testOutC);
+    TEST_CHECK(arm_mat_mult_f32(&a, &b, &c) == ARM_MATH_SUCCESS);
+    TEST_CHECK(arm_mat_mult_f32_nosimd(&a, &b, &cC) == ARM_MATH_SUCCESS);
+    diffs += differ(testOut, testOutC, (uint32_t)dimTbl[ix][0] * dimTbl[ix][2]);
+    runs++;
+  }
+  check_exact("arm_mat_mult_f32, 1x1 to 64x64, blocked above 16", runs, diffs);
+}
+
+static void test_dot_prod(void)
+{
+  static const uint32_t lenTbl[] = {1u, 3u, 8u, 15u, 100u, 1031u, 4096u};
+  float32_t             out, outC;
+  double                exact, bound, ratio, ratioMax = 0.0;
+  uint32_t              ix, i, n;
+
+  for (ix = 0u; ix < sizeof(lenTbl) / sizeof(lenTbl[0]); ix++)
+  {
+    n = lenTbl[ix];
+    test_fill(testIn, n, 1.0);
+    test_fill(testIn2, n, 1.0);
+    exact = 0.0;
+    bound = 0.0;
+    for (i = 0u; i < n; i++)
+    {
+      exact += (double)testIn[i] * testIn2[i];
+      bound += fabs((double)testIn[i] * testIn2[i]);
+    }
+    bound *= (double)n * FLT_EPSILON;
+    arm_dot_prod_f32(testIn, testIn2, n, &out);
+    arm_dot_prod_f32_nosimd(testIn, testIn2, n, &outC);
+    ratio    = fabs(out - exact) / bound;
+    ratioMax = (ratio > ratioMax) ? ratio : ratioMax;
+    TEST_CHECK(ratio <= 1.0);
+    TEST_CHECK(fabs(outC - exact) <= bound);
+  }
+  printf("  %-48s %7.4f of the bound\n", "arm_dot_prod_f32, 1 to 4096, error", ratioMax);
+}
+
+static void test_vmath(void)
+{
+  static const uint32_t lenTbl[] = {1u, 3u, 8u, 15u, 61u, 4096u};
+  uint32_t              ix, il, n, runs, diffs;
+
+  for (ix = 0u; ix < sizeof(testVfuncTbl) / sizeof(testVfuncTbl[0]); ix++)
+  {
+    runs = diffs = 0u;
+    for (il = 0u; il < sizeof(lenTbl) / sizeof(lenTbl[0]); il++)
+    {
+      n = lenTbl[il];
+      vmath_fill(testIn, n, &testVfuncTbl[ix]);
+      testVfuncTbl[ix].pFunc(testIn, testOut, n);
+      testVfuncTbl[ix].pFuncC(testIn, testOutC, n);
+      diffs += differ(testOut, testOutC, n);
+      runs++;
+    }
+    check_exact(testVfuncTbl[ix].name, runs, diffs);
+  }
+
+  /* Four quadrants, with the signed zeros */
+  runs = diffs = 0u;
+  for (il = 0u; il < sizeof(lenTbl) / sizeof(lenTbl[0]); il++)
+  {
+    n = lenTbl[il];
+    test_fill(testIn, n, 2.0);
+    test_fill(testIn2, n, 2.0);
+    for (ix = 0u; (ix < 4u) && (ix < n); ix++)
+    {
+      testIn[(ix * 7u) % n]  = ((ix & 1u) != 0u) ? -0.0f : 0.0f;
+      testIn2[(ix * 5u) % n] = ((ix & 2u) != 0u) ? -0.0f : 0.0f;
+    }
+    arm_vatan2_f32(testIn, testIn2, testOut, n);
+    arm_vatan2_f32_nosimd(testIn, testIn2, testOutC, n);
+    diffs += differ(testOut, testOutC, n);
+    runs++;
+  }
+  check_exact("arm_vatan2_f32, four quadrants, zeros", runs, diffs);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks, SIMD then C code
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  static const uint32_t    tapsTbl[]   = {8u, 64u};
+  static const uint32_t    stagesTbl[] = {2u, 8u};
+  static const uint32_t    cfftTbl[]   = {2u, 6u, 8u};      /* 64, 1024, 4096 */
+  static const uint16_t    matTbl[]    = {8u, 64u};
+  arm_fir_instance_f32                 fir, firC;
+  arm_biquad_cascade_df2T_instance_f32 iir, iirC;
+  arm_matrix_instance_f32              a, b, c;
+  float32_t                            dot;
+  uint32_t                             ix, n;
+  char                                 name[64];
+
+  test_fill(testIn, 2u * TEST_LEN, 0.5);
+  test_fill(testIn2, 2u * TEST_LEN, 0.5);
+  for (ix = 0u; ix < sizeof(tapsTbl) / sizeof(tapsTbl[0]); ix++)
+  {
+    test_fill(firCoeffs, tapsTbl[ix], 0.5);
+    arm_fir_init_f32(&fir, (uint16_t)tapsTbl[ix], firCoeffs, firState, 1024u);
+    arm_fir_init_f32(&firC, (uint16_t)tapsTbl[ix], firCoeffs, firStateC, 1024u);
+    snprintf(name, sizeof(name), "arm_fir_f32, %u taps", (unsigned)tapsTbl[ix]);
+    TEST_BENCH(name, 1024u, arm_fir_f32(&fir, testIn, testOut, 1024u));
+    snprintf(name, sizeof(name), "arm_fir_f32, %u taps, C code", (unsigned)tapsTbl[ix]);
+    TEST_BENCH(name, 1024u, arm_fir_f32_nosimd(&firC, testIn, testOut, 1024u));
+  }
+  for (ix = 0u; ix < sizeof(stagesTbl) / sizeof(stagesTbl[0]); ix++)
+  {
+    iir_design(stagesTbl[ix]);
+    arm_biquad_cascade_df2T_init_f32(&iir, (uint8_t)stagesTbl[ix], iirCoeffs, iirState);
+    arm_biquad_cascade_df2T_init_f32(&iirC, (uint8_t)stagesTbl[ix], iirCoeffs, iirStateC);
+    snprintf(name, sizeof(name), "arm_biquad_cascade_df2T_f32, %u stages", (unsigned)stagesTbl[ix]);
+    TEST_BENCH(name, 1024u, arm_biquad_cascade_df2T_f32(&iir, testIn, testOut, 1024u));
+    snprintf(name, sizeof(name), "arm_biquad_cascade_df2T_f32, %u stages, C code", (unsigned)stagesTbl[ix]);
+    TEST_BENCH(name, 1024u, arm_biquad_cascade_df2T_f32_nosimd(&iirC, testIn, testOut, 1024u));
+  }
+  for (ix = 0u; ix < sizeof(cfftTbl) / sizeof(cfftTbl[0]); ix++)
+  {
+    const arm_cfft_instance_f32 *pS = testCfftTbl[cfftTbl[ix]];
+
+    n = pS->fftLen;                             /* Forward + inverse, the data stays bounded */
+    snprintf(name, sizeof(name), "arm_cfft_f32, %u, forward + inverse", (unsigned)n);
+    TEST_BENCH(name, 2u * n, (arm_cfft_f32(pS, testOut, 0u, 1u), arm_cfft_f32(pS, testOut, 1u, 1u)));
+    snprintf(name, sizeof(name), "arm_cfft_f32, %u, forward + inverse, C code", (unsigned)n);
+    TEST_BENCH(name, 2u * n, (arm_cfft_f32_nosimd(pS, testOut, 0u, 1u), arm_cfft_f32_nosimd(pS, testOut, 1u, 1u)));
+  }
+  for (ix = 0u; ix < sizeof(matTbl) / sizeof(matTbl[0]); ix++)
+  {
+    n = matTbl[ix];
+    arm_mat_init_f32(&a, matTbl[ix], matTbl[ix], testIn);
+    arm_mat_init_f32(&b, matTbl[ix], matTbl[ix], testIn2);
+    arm_mat_init_f32(&c, matTbl[ix], matTbl[ix], testOut);
+    snprintf(name, sizeof(name), "arm_mat_mult_f32, %ux%u, per MAC", (unsigned)n, (unsigned)n);
+    TEST_BENCH(name, n * n * n, arm_mat_mult_f32(&a, &b, &c));
+    snprintf(name, sizeof(name), "arm_mat_mult_f32, %ux%u, per MAC, C code", (unsigned)n, (unsigned)n);
+    TEST_BENCH(name, n * n * n, arm_mat_mult_f32_nosimd(&a, &b, &c));
+  }
+  TEST_BENCH("arm_dot_prod_f32, 1024", 1024u, arm_dot_prod_f32(testIn, testIn2, 1024u, &dot));
+  TEST_BENCH("arm_dot_prod_f32, 1024, C code", 1024u, arm_dot_prod_f32_nosimd(testIn, testIn2, 1024u, &dot));
+  test_fill(testIn, 1024u, 8.0);               /* In [0.001, 8]: no subnormal input or result */
+  for (ix = 0u; ix < 1024u; ix++)
+  {
+    testIn[ix] = fabsf(testIn[ix]) + 0.001f;
+  }
+  for (ix = 0u; ix < sizeof(testVfuncTbl) / sizeof(testVfuncTbl[0]); ix++)
+  {
+    n = (uint32_t)strcspn(testVfuncTbl[ix].name, ",");     /* The name of the function */
+    snprintf(name, sizeof(name), "%.*s, 1024", (int)n, testVfuncTbl[ix].name);
+    TEST_BENCH(name, 1024u, testVfuncTbl[ix].pFunc(testIn, testOut, 1024u));
+    snprintf(name, sizeof(name), "%.*s, 1024, C code", (int)n, testVfuncTbl[ix].name);
+    TEST_BENCH(name, 1024u, testVfuncTbl[ix].pFuncC(testIn, testOut, 1024u));
+  }
+  TEST_BENCH("arm_vatan2_f32, 1024", 1024u, arm_vatan2_f32(testIn, testIn2, testOut, 1024u));
+  TEST_BENCH("arm_vatan2_f32, 1024, C code", 1024u, arm_vatan2_f32_nosimd(testIn, testIn2, testOut, 1024u));
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_simd_test", argc, argv);
+#if defined (__HOST_SIMD)
+  printf("  host SIMD: %u lanes%s\n", (unsigned)__HOST_VLEN, __HOST_SIMD_READY() ? "" : ", not supported by this CPU");
+#else
+  printf("  host SIMD: none, C code only\n");
+#endif
+  test_seed(1u);
+  test_fir();
+  test_biquad();
+  test_cfft();
+  test_mat_mult();
+  test_dot_prod();
+  test_vmath();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
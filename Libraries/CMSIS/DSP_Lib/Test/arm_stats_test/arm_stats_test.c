@@ -0,0 +1,392 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_stats_test.c
+*
+* Description:  Streaming statistics against double precision and the separate functions.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Feeds arm_stats_update_f32/q31/q15() with blocks of 1 to 1000 samples and
+ * checks the mean, variance, standard deviation, RMS value and power of
+ * arm_stats_get_f32/q31/q15() against double precision, the extrema and their
+ * global indices exactly.  Instances built on parts of the input and merged
+ * must give the same statistics (the same sums in fixed point).  With a DC
+ * offset of 10000, the variance must stay accurate where arm_var_f32() cancels.
+ * With "bench" it compares init + update + get with arm_mean, arm_var,
+ * arm_rms, arm_min and arm_max on the same block.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_LEN         4096u
+
+static const uint32_t testBlockTbl[] = {1u, 3u, 64u, 100u, 1000u};    /* Then the rest */
+static const uint32_t testBenchTbl[] = {64u, 512u, 4096u};
+static const char    *testValueTbl[] = {"mean", "var", "std", "rms", "power"};
+
+static double    refIn[TEST_LEN];
+static double    refRounded[TEST_LEN];
+static float32_t f32In[TEST_LEN];
+static q31_t     q31In[TEST_LEN];
+static q15_t     q15In[TEST_LEN];
+
+/* Mean, variance (normalized by n - 1), standard deviation, RMS value and power */
+static void ref_stats(const double *pSrc, uint32_t n, double *pOut)
+{
+  long double sum = 0.0L, sumDev = 0.0L, mean;
+  uint32_t    i;
+
+  for (i = 0u; i < n; i++)
+  {
+    sum += pSrc[i];
+  }
+  mean = sum / n;
+  pOut[4] = 0.0;
+  for (i = 0u; i < n; i++)
+  {
+    sumDev  += (pSrc[i] - mean) * (pSrc[i] - mean);
+    pOut[4] += pSrc[i] * pSrc[i];
+  }
+  pOut[0] = (double)mean;
+  pOut[1] = (double)(sumDev / (n - 1u));
+  pOut[2] = sqrt(pOut[1]);
+  pOut[3] = sqrt(pOut[4] / n);
+}
+
+/* Index of the first minimum and of the first maximum */
+static void ref_extrema(const double *pSrc, uint32_t n, uint32_t *pMinIndex, uint32_t *pMaxIndex)
+{
+  uint32_t i;
+
+  *pMinIndex = *pMaxIndex = 0u;
+  for (i = 1u; i < n; i++)
+  {
+    *pMinIndex = (pSrc[i] < pSrc[*pMinIndex]) ? i : *pMinIndex;
+    *pMaxIndex = (pSrc[i] > pSrc[*pMaxIndex]) ? i : *pMaxIndex;
+  }
+}
+
+/* Uniform in [offset - 0.5, offset + 0.5), with repeated extrema in later blocks */
+static void make_input(double offset)
+{
+  uint32_t i;
+
+  test_rand_f64(refIn, TEST_LEN, 0.5);
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    refIn[i] += offset;
+  }
+  refIn[700]  = refIn[200]  = offset - 0.5;
+  refIn[3000] = refIn[1500] = offset + 0.49;
+  test_f64_to_f32(refIn, f32In, TEST_LEN);
+  test_f64_to_q31(refIn, q31In, TEST_LEN);
+  test_f64_to_q15(refIn, q15In, TEST_LEN);
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+/* Relative errors for f32, absolute errors for the fractional formats */
+static void check_values(const char *pType, const double *pRef, const double *pOut, const double *pTol)
+{
+  double   err;
+  uint32_t i;
+  char     name[64];
+
+  for (i = 0u; i < 5u; i++)
+  {
+    err = fabs(pOut[i] - pRef[i]);
+    err = (pType[0] == 'f') ? err / fabs(pRef[i]) : err;
+    snprintf(name, sizeof(name), "arm_stats_get_%s, %s", pType, testValueTbl[i]);
+    printf("  %-48s %10.3g\n", name, err);
+    TEST_CHECK(err < pTol[i]);
+  }
+}
+
+static void test_stats(void)
+{
+  static const double    tolF32[5] = {1e-6, 1e-5, 1e-5, 1e-6, 1e-6};
+  static const double    tolQ31[5] = {1e-9, 4e-9, 1e-8, 1e-8, 1e-8};
+  static const double    tolQ15[5] = {6.2e-5, 6.2e-5, 1.3e-4, 1.3e-4, 1e-8};
+  arm_stats_instance_f32 sF32;
+  arm_stats_instance_q31 sQ31;
+  arm_stats_instance_q15 sQ15;
+  double                 ref[5], out[5];
+  float32_t              f[5];
+  q31_t                  q[4];
+  q15_t                  h[4];
+  q63_t                  power;
+  uint32_t               i, ix, len, minIndex, maxIndex, bad = 0u;
+
+  make_input(0.1);
+  arm_stats_init_f32(&sF32);
+  arm_stats_init_q31(&sQ31);
+  arm_stats_init_q15(&sQ15);
+  for (i = 0u, ix = 0u; i < TEST_LEN; i += len, ix++)
+  {
+    len = (ix < sizeof(testBlockTbl) / sizeof(testBlockTbl[0])) ? testBlockTbl[ix] : TEST_LEN - i;
+    arm_stats_update_f32(&sF32, f32In + i, len);
+    arm_stats_update_q31(&sQ31, q31In + i, len);
+    arm_stats_update_q15(&sQ15, q15In + i, len);
+  }
+
+  /* Each against the statistics of its rounded input */
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    refRounded[i] = f32In[i];
+  }
+  ref_stats(refRounded, TEST_LEN, ref);
+  arm_stats_get_f32(&sF32, &f[0], &f[1], &f[2], &f[3], &f[4]);
+  for (i = 0u; i < 5u; i++)
+  {
+    out[i] = f[i];
+  }
+  check_values("f32", ref, out, tolF32);
+
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    refRounded[i] = (double)q31In[i] / 2147483648.0;
+  }
+  ref_stats(refRounded, TEST_LEN, ref);
+  arm_stats_get_q31(&sQ31, &q[0], &q[1], &q[2], &q[3], &power);
+  for (i = 0u; i < 4u; i++)
+  {
+    out[i] = (double)q[i] / 2147483648.0;
+  }
+  out[4] = (double)power / 1073741824.0 / TEST_LEN;     /* 34.30, per sample */
+  ref[4] /= TEST_LEN;
+  check_values("q31", ref, out, tolQ31);
+
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    refRounded[i] = (double)q15In[i] / 32768.0;
+  }
+  ref_stats(refRounded, TEST_LEN, ref);
+  arm_stats_get_q15(&sQ15, &h[0], &h[1], &h[2], &h[3], &power);
+  for (i = 0u; i < 4u; i++)
+  {
+    out[i] = (double)h[i] / 32768.0;
+  }
+  out[4] = (double)power / 1073741824.0 / TEST_LEN;
+  ref[4] /= TEST_LEN;
+  check_values("q15", ref, out, tolQ15);
+
+  /* Extrema: the first occurrences, across the blocks */
+  ref_extrema(refIn, TEST_LEN, &minIndex, &maxIndex);
+  bad += ((sF32.minIndex != minIndex) || (sF32.maxIndex != maxIndex) || (sF32.min != f32In[minIndex]) ||
+          (sF32.max != f32In[maxIndex])) ? 1u : 0u;
+  bad += ((sQ31.minIndex != minIndex) || (sQ31.maxIndex != maxIndex) || (sQ31.min != q31In[minIndex]) ||
+          (sQ31.max != q31In[maxIndex])) ? 1u : 0u;
+  bad += ((sQ15.minIndex != minIndex) || (sQ15.maxIndex != maxIndex) || (sQ15.min != q15In[minIndex]) ||
+          (sQ15.max != q15In[maxIndex])) ? 1u : 0u;
+  printf("  %-48s %s\n", "arm_stats_update_f32/q31/q15, extrema and indices", (bad == 0u) ? "exact" : "differ  FAILED");
+  TEST_CHECK(bad == 0u);
+}
+
+/* Instances on three parts of the input, merged, against one instance on all of it */
+static void test_merge(void)
+{
+  static const uint32_t  splitTbl[4] = {0u, 700u, 701u, TEST_LEN};
+  arm_stats_instance_f32 sF32, pF32, mF32;
+  arm_stats_instance_q31 sQ31, pQ31, mQ31;
+  arm_stats_instance_q15 sQ15, pQ15, mQ15;
+  uint32_t               i, bad = 0u;
+  double                 errMean, errM2;
+
+  make_input(-0.1);
+  arm_stats_init_f32(&sF32);
+  arm_stats_init_q31(&sQ31);
+  arm_stats_init_q15(&sQ15);
+  arm_stats_update_f32(&sF32, f32In, TEST_LEN);
+  arm_stats_update_q31(&sQ31, q31In, TEST_LEN);
+  arm_stats_update_q15(&sQ15, q15In, TEST_LEN);
+  arm_stats_init_f32(&mF32);
+  arm_stats_init_q31(&mQ31);
+  arm_stats_init_q15(&mQ15);
+  for (i = 0u; i < 3u; i++)
+  {
+    arm_stats_init_f32(&pF32);
+    arm_stats_init_q31(&pQ31);
+    arm_stats_init_q15(&pQ15);
+    arm_stats_update_f32(&pF32, f32In + splitTbl[i], splitTbl[i + 1u] - splitTbl[i]);
+    arm_stats_update_q31(&pQ31, q31In + splitTbl[i], splitTbl[i + 1u] - splitTbl[i]);
+    arm_stats_update_q15(&pQ15, q15In + splitTbl[i], splitTbl[i + 1u] - splitTbl[i]);
+    arm_stats_merge_f32(&mF32, &pF32);
+    arm_stats_merge_q31(&mQ31, &pQ31);
+    arm_stats_merge_q15(&mQ15, &pQ15);
+  }
+
+  bad += ((mQ31.count != sQ31.count) || (mQ31.sum != sQ31.sum) || (mQ31.sumSquare != sQ31.sumSquare) ||
+          (mQ31.min != sQ31.min) || (mQ31.max != sQ31.max) || (mQ31.minIndex != sQ31.minIndex) ||
+          (mQ31.maxIndex != sQ31.maxIndex)) ? 1u : 0u;
+  bad += ((mQ15.count != sQ15.count) || (mQ15.sum != sQ15.sum) || (mQ15.sumSquare != sQ15.sumSquare) ||
+          (mQ15.min != sQ15.min) || (mQ15.max != sQ15.max) || (mQ15.minIndex != sQ15.minIndex) ||
+          (mQ15.maxIndex != sQ15.maxIndex)) ? 1u : 0u;
+  bad += ((mF32.count != sF32.count) || (mF32.min != sF32.min) || (mF32.max != sF32.max) ||
+          (mF32.minIndex != sF32.minIndex) || (mF32.maxIndex != sF32.maxIndex)) ? 1u : 0u;
+  printf("  %-48s %s\n", "arm_stats_merge_q31/q15, against one instance", (bad == 0u) ? "exact" : "differ  FAILED");
+  TEST_CHECK(bad == 0u);
+  errMean = fabs((double)mF32.mean - (double)sF32.mean) / fabs((double)sF32.mean);
+  errM2   = fabs((double)mF32.m2 - (double)sF32.m2) / (double)sF32.m2;
+  printf("  %-48s %10.3g\n", "arm_stats_merge_f32, mean", errMean);
+  printf("  %-48s %10.3g\n", "arm_stats_merge_f32, M2", errM2);
+  TEST_CHECK(errMean < 1e-6);
+  TEST_CHECK(errM2 < 1e-5);
+}
+
+static void test_edge(void)
+{
+  arm_stats_instance_f32 sF32;
+  arm_stats_instance_q31 sQ31;
+  arm_stats_instance_q15 sQ15;
+  float32_t              f[5], x = 0.25f;
+  q31_t                  q[4], xq31 = 0x20000000;
+  q15_t                  h[4], xq15 = 0x2000;
+  q63_t                  power;
+
+  /* No sample: all zero; one sample: no variance */
+  arm_stats_init_f32(&sF32);
+  arm_stats_get_f32(&sF32, &f[0], &f[1], &f[2], &f[3], &f[4]);
+  TEST_CHECK((f[0] == 0.0f) && (f[1] == 0.0f) && (f[2] == 0.0f) && (f[3] == 0.0f) && (f[4] == 0.0f));
+  arm_stats_update_f32(&sF32, &x, 1u);
+  arm_stats_get_f32(&sF32, &f[0], &f[1], NULL, &f[3], NULL);
+  TEST_CHECK((f[0] == 0.25f) && (f[1] == 0.0f) && (f[3] == 0.25f));
+
+  arm_stats_init_q31(&sQ31);
+  arm_stats_get_q31(&sQ31, &q[0], &q[1], &q[2], &q[3], &power);
+  TEST_CHECK((q[0] == 0) && (q[1] == 0) && (q[2] == 0) && (q[3] == 0) && (power == 0));
+  arm_stats_update_q31(&sQ31, &xq31, 1u);
+  arm_stats_get_q31(&sQ31, &q[0], &q[1], NULL, NULL, NULL);
+  TEST_CHECK((q[0] == xq31) && (q[1] == 0));
+
+  arm_stats_init_q15(&sQ15);
+  arm_stats_get_q15(&sQ15, &h[0], &h[1], &h[2], &h[3], &power);
+  TEST_CHECK((h[0] == 0) && (h[1] == 0) && (h[2] == 0) && (h[3] == 0) && (power == 0));
+  arm_stats_update_q15(&sQ15, &xq15, 1u);
+  arm_stats_get_q15(&sQ15, &h[0], &h[1], NULL, NULL, NULL);
+  TEST_CHECK((h[0] == xq15) && (h[1] == 0));
+}
+
+/* Standard deviation 0.2 around 10000: the sum of squares of arm_var_f32() cancels */
+static void test_offset(void)
+{
+  arm_stats_instance_f32 sF32;
+  double                 ref[5];
+  float32_t              var, varSeparate;
+  uint32_t               i;
+
+  test_rand_f64(refIn, TEST_LEN, 0.2 * sqrt(3.0));
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    refIn[i] += 10000.0;
+    f32In[i]  = (float32_t)refIn[i];
+    refRounded[i] = f32In[i];
+  }
+  ref_stats(refRounded, TEST_LEN, ref);
+  arm_stats_init_f32(&sF32);
+  for (i = 0u; i < TEST_LEN; i += 256u)
+  {
+    arm_stats_update_f32(&sF32, f32In + i, 256u);
+  }
+  arm_stats_get_f32(&sF32, NULL, &var, NULL, NULL, NULL);
+  arm_var_f32(f32In, TEST_LEN, &varSeparate);
+  printf("  %-48s %10.3g\n", "offset 10000, double variance", ref[1]);
+  printf("  %-48s %10.3g\n", "offset 10000, arm_stats_get_f32", (double)var);
+  printf("  %-48s %10.3g\n", "offset 10000, arm_var_f32", (double)varSeparate);
+  TEST_CHECK(fabs((double)var - ref[1]) < 1e-3 * ref[1]);
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  arm_stats_instance_f32 sF32;
+  arm_stats_instance_q31 sQ31;
+  arm_stats_instance_q15 sQ15;
+  float32_t              f[5];
+  q31_t                  q[5];
+  q15_t                  h[5];
+  q63_t                  power;
+  uint32_t               ix, n, index;
+  char                   name[64];
+
+  make_input(0.1);
+  for (ix = 0u; ix < sizeof(testBenchTbl) / sizeof(testBenchTbl[0]); ix++)
+  {
+    n = testBenchTbl[ix];
+    snprintf(name, sizeof(name), "f32 %u, mean + var + rms + min + max", (unsigned)n);
+    TEST_BENCH(name, n, (arm_mean_f32(f32In, n, &f[0]), arm_var_f32(f32In, n, &f[1]), arm_rms_f32(f32In, n, &f[2]),
+                         arm_min_f32(f32In, n, &f[3], &index), arm_max_f32(f32In, n, &f[4], &index)));
+    snprintf(name, sizeof(name), "f32 %u, arm_stats_init + update + get", (unsigned)n);
+    TEST_BENCH(name, n, (arm_stats_init_f32(&sF32), arm_stats_update_f32(&sF32, f32In, n),
+                         arm_stats_get_f32(&sF32, &f[0], &f[1], NULL, &f[2], NULL)));
+    snprintf(name, sizeof(name), "q31 %u, mean + var + rms + min + max", (unsigned)n);
+    TEST_BENCH(name, n, (arm_mean_q31(q31In, n, &q[0]), arm_var_q31(q31In, n, &power), arm_rms_q31(q31In, n, &q[2]),
+                         arm_min_q31(q31In, n, &q[3], &index), arm_max_q31(q31In, n, &q[4], &index)));
+    snprintf(name, sizeof(name), "q31 %u, arm_stats_init + update + get", (unsigned)n);
+    TEST_BENCH(name, n, (arm_stats_init_q31(&sQ31), arm_stats_update_q31(&sQ31, q31In, n),
+                         arm_stats_get_q31(&sQ31, &q[0], &q[1], NULL, &q[2], &power)));
+    snprintf(name, sizeof(name), "q15 %u, mean + var + rms + min + max", (unsigned)n);
+    TEST_BENCH(name, n, (arm_mean_q15(q15In, n, &h[0]), arm_var_q15(q15In, n, &q[1]), arm_rms_q15(q15In, n, &h[2]),
+                         arm_min_q15(q15In, n, &h[3], &index), arm_max_q15(q15In, n, &h[4], &index)));
+    snprintf(name, sizeof(name), "q15 %u, arm_stats_init + update + get", (unsigned)n);
+    TEST_BENCH(name, n, (arm_stats_init_q15(&sQ15), arm_stats_update_q15(&sQ15, q15In, n),
+                         arm_stats_get_q15(&sQ15, &h[0], &h[1], NULL, &h[2], &power)));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_stats_test", argc, argv);
+  test_seed(1u);
+  test_stats();
+  test_merge();
+  test_edge();
+  test_offset();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
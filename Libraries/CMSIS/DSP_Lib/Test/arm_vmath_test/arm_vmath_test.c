@@ -0,0 +1,343 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2013 ARM Limited. All rights reserved.
+*
+* $Date:        17. January 2013
+* $Revision:    V1.4.1
+*
+* Project:      CMSIS DSP Library
+*
+* Title:        arm_vmath_test.c
+*
+* Description:  Vector sine, cosine, arctangent, exponential, logarithm and square root against libm.
+*
+* Target Processor: Host (ARM_MATH_HOST)
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+ * Measures the largest errors of arm_vsin, arm_vcos and arm_vatan2 (f32, q31,
+ * q15) and of arm_vexp_f32, arm_vlog_f32 and arm_vsqrt_f32 against the double
+ * precision libm functions, over their documented input ranges, and checks
+ * them against the bounds documented with each group.  Also checks the special
+ * values.  For comparison it prints the errors of arm_sin_f32/q31/q15().  With
+ * "bench" it compares each function with the loop of the libm function or of
+ * the scalar CMSIS function it replaces.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+#include "test_helper.h"
+
+#define TEST_LEN        (1u << 20)
+#define TEST_BENCH_LEN    4096u
+#define TEST_PI           3.14159265358979323846      /* PI of arm_math.h is a float32_t */
+
+static double    refIn[TEST_LEN];
+static double    refIn2[TEST_LEN];
+static float32_t f32In[TEST_LEN], f32In2[TEST_LEN], f32Out[TEST_LEN];
+static q31_t     q31In[TEST_LEN], q31In2[TEST_LEN], q31Out[TEST_LEN];
+static q15_t     q15In[TEST_LEN], q15In2[TEST_LEN], q15Out[TEST_LEN];
+
+/* Unit in the last place of a float32_t of magnitude 'x', subnormals included */
+static double ulp_f32(double x)
+{
+  int e;
+
+  x = fabs(x);
+  if (x < FLT_MIN)
+  {
+    return (ldexp(1.0, -149));
+  }
+  (void)frexp(x, &e);
+  return (ldexp(1.0, e - 24));
+}
+
+/* The bounds are the documented errors, plus half a unit of their last digit */
+static void print_err(const char *name, double err, const char *unit, double errMax)
+{
+  printf("  %-48s %10.3g%s%s\n", name, err, (unit[0] != '\0') ? " " : "", unit);
+  test_check(err <= errMax, name, __FILE__, __LINE__);
+}
+
+/* ----------------------------------------------------------------------
+** Tests
+** ------------------------------------------------------------------- */
+
+/* |x| <= 8192: absolute error, and ulp of max(|sin(x)|, 0.5) */
+static void test_sin_cos_f32(void)
+{
+  double   ref, err, errAbs[3] = {0.0}, errUlp[3] = {0.0};
+  uint32_t i, f;
+
+  test_rand_f64(refIn, TEST_LEN, 8192.0);
+  test_f64_to_f32(refIn, f32In, TEST_LEN);
+  for (f = 0u; f < 3u; f++)
+  {
+    if (f == 0u)
+    {
+      arm_vsin_f32(f32In, f32Out, TEST_LEN);
+    }
+    else if (f == 1u)
+    {
+      arm_vcos_f32(f32In, f32Out, TEST_LEN);
+    }
+    for (i = 0u; i < TEST_LEN; i++)
+    {
+      ref = (f == 1u) ? cos((double)f32In[i]) : sin((double)f32In[i]);
+      err = fabs((f == 2u) ? (double)arm_sin_f32(f32In[i]) - ref : (double)f32Out[i] - ref);
+      errAbs[f] = fmax(errAbs[f], err);
+      errUlp[f] = fmax(errUlp[f], err / ulp_f32(fmax(fabs(ref), 0.5)));
+    }
+  }
+  print_err("arm_vsin_f32, |x| <= 8192, absolute", errAbs[0], "", 7.75e-8);
+  print_err("arm_vsin_f32, |x| <= 8192", errUlp[0], "ulp", 1.35);
+  print_err("arm_vcos_f32, |x| <= 8192, absolute", errAbs[1], "", 7.75e-8);
+  print_err("arm_vcos_f32, |x| <= 8192", errUlp[1], "ulp", 1.35);
+  printf("  %-48s %10.3g\n", "arm_sin_f32, |x| <= 8192, absolute", errAbs[2]);
+}
+
+/* Inputs of the whole range: every q15, one q31 in 4096 */
+static void test_sin_cos_fixed(void)
+{
+  double   ref, err[6] = {0.0};
+  uint32_t i, f;
+
+  for (i = 0u; i < 65536u; i++)
+  {
+    q15In[i] = (q15_t)i;
+    q31In[i] = (q31_t)(i << 16) + (q31_t)(i * 40503u % 65536u);
+  }
+  for (f = 0u; f < 3u; f++)
+  {
+    if (f == 0u)
+    {
+      arm_vsin_q31(q31In, q31Out, 65536u);
+      arm_vsin_q15(q15In, q15Out, 65536u);
+    }
+    else if (f == 1u)
+    {
+      arm_vcos_q31(q31In, q31Out, 65536u);
+      arm_vcos_q15(q15In, q15Out, 65536u);
+    }
+    else
+    {
+      for (i = 0u; i < 65536u; i++)
+      {
+        q31Out[i] = arm_sin_q31(q31In[i] & 0x7FFFFFFF);         /* [0 +0.9999] only */
+        q15Out[i] = arm_sin_q15(q15In[i] & 0x7FFF);
+      }
+    }
+    for (i = 0u; i < 65536u; i++)
+    {
+      ref = 2.0 * TEST_PI * (double)((f == 2u) ? (q31In[i] & 0x7FFFFFFF) : q31In[i]) / 2147483648.0;
+      ref = (f == 1u) ? cos(ref) : sin(ref);
+      err[f] = fmax(err[f], fabs((double)q31Out[i] - fmin(ref * 2147483648.0, 2147483647.0)));
+      ref = 2.0 * TEST_PI * (double)((f == 2u) ? (q15In[i] & 0x7FFF) : q15In[i]) / 32768.0;
+      ref = (f == 1u) ? cos(ref) : sin(ref);
+      err[3u + f] = fmax(err[3u + f], fabs((double)q15Out[i] - fmin(ref * 32768.0, 32767.0)));
+    }
+  }
+  print_err("arm_vsin_q31, full range", err[0], "LSB", 2.65);
+  print_err("arm_vcos_q31, full range", err[1], "LSB", 2.65);
+  printf("  %-48s %10.3g LSB\n", "arm_sin_q31, [0 +0.9999]", err[2]);
+  print_err("arm_vsin_q15, every input", err[3], "LSB", 1.15);
+  print_err("arm_vcos_q15, every input", err[4], "LSB", 1.15);
+  printf("  %-48s %10.3g LSB\n", "arm_sin_q15, [0 +0.9999]", err[5]);
+}
+
+static void test_exp_log_sqrt(void)
+{
+  static const float32_t specialTbl[] = {0.0f, -1.0f, INFINITY, NAN, 89.0f, -104.5f, -INFINITY};
+  float32_t              out[7];
+  double                 errExp = 0.0, errLog = 0.0, ref;
+  uint32_t               i, diffs = 0u;
+
+  /* exp: -103.97 to 88.72, down to the subnormal results */
+  test_rand_f64(refIn, TEST_LEN, 0.5 * (88.72 + 103.97));
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    f32In[i] = (float32_t)(refIn[i] + 0.5 * (88.72 - 103.97));
+  }
+  arm_vexp_f32(f32In, f32Out, TEST_LEN);
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    ref    = exp((double)f32In[i]);
+    errExp = fmax(errExp, fabs((double)f32Out[i] - ref) / ulp_f32(ref));
+  }
+  print_err("arm_vexp_f32, -103.97 to 88.72", errExp, "ulp", 1.05);
+
+  /* log and sqrt: every exponent, subnormals included */
+  test_rand_f64(refIn, TEST_LEN, 1.0);
+  test_rand_f64(refIn2, TEST_LEN, 138.5);
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    f32In[i] = (float32_t)ldexp(1.5 + 0.5 * refIn[i], (int)floor(refIn2[i] - 11.0));
+  }
+  arm_vlog_f32(f32In, f32Out, TEST_LEN);
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    ref    = log((double)f32In[i]);
+    errLog = fmax(errLog, fabs((double)f32Out[i] - ref) / ulp_f32(ref));
+  }
+  print_err("arm_vlog_f32, 1e-45 to 3e38", errLog, "ulp", 0.85);
+  TEST_CHECK(arm_vsqrt_f32(f32In, f32Out, TEST_LEN) == ARM_MATH_SUCCESS);
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    diffs += (f32Out[i] != (float32_t)sqrt((double)f32In[i])) ? 1u : 0u;
+  }
+  printf("  %-48s %s\n", "arm_vsqrt_f32, 1e-45 to 3e38", (diffs == 0u) ? "correctly rounded" : "differ  FAILED");
+  TEST_CHECK(diffs == 0u);
+
+  /* Special values */
+  arm_vexp_f32((float32_t *)specialTbl, out, 7u);
+  TEST_CHECK((out[0] == 1.0f) && (out[2] == INFINITY) && isnan(out[3]) && (out[4] == INFINITY) &&
+             (out[5] == 0.0f) && (out[6] == 0.0f));
+  arm_vlog_f32((float32_t *)specialTbl, out, 4u);
+  TEST_CHECK((out[0] == -INFINITY) && isnan(out[1]) && (out[2] == INFINITY) && isnan(out[3]));
+  TEST_CHECK(arm_vsqrt_f32((float32_t *)specialTbl, out, 4u) == ARM_MATH_ARGUMENT_ERROR);
+  TEST_CHECK((out[0] == 0.0f) && (out[1] == 0.0f) && (out[2] == INFINITY) && (out[3] == 0.0f));
+}
+
+/* Points of magnitudes 1e-3 to 1: error in ulp of pi, or in LSB of the angle divided by pi, modulo 2 */
+static void test_atan2(void)
+{
+  static const float32_t zeroY[4] = {0.0f, 0.0f, -0.0f, -0.0f};
+  static const float32_t zeroX[4] = {0.0f, -1.0f, -1.0f, 1.0f};
+  float32_t              out[4];
+  double                 ref, scale, err[3] = {0.0};
+  uint32_t               i;
+
+  test_rand_f64(refIn, TEST_LEN, 1.0);
+  test_rand_f64(refIn2, TEST_LEN, 1.0);
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    scale     = pow(10.0, -3.0 * (double)(i % 4u) / 3.0);
+    refIn[i] *= scale;
+    refIn2[i] *= scale;
+  }
+  test_f64_to_f32(refIn, f32In, TEST_LEN);
+  test_f64_to_f32(refIn2, f32In2, TEST_LEN);
+  test_f64_to_q31(refIn, q31In, TEST_LEN);
+  test_f64_to_q31(refIn2, q31In2, TEST_LEN);
+  test_f64_to_q15(refIn, q15In, TEST_LEN);
+  test_f64_to_q15(refIn2, q15In2, TEST_LEN);
+  arm_vatan2_f32(f32In, f32In2, f32Out, TEST_LEN);
+  arm_vatan2_q31(q31In, q31In2, q31Out, TEST_LEN);
+  arm_vatan2_q15(q15In, q15In2, q15Out, TEST_LEN);
+  for (i = 0u; i < TEST_LEN; i++)
+  {
+    ref    = atan2((double)f32In[i], (double)f32In2[i]);
+    err[0] = fmax(err[0], fabs((double)f32Out[i] - ref) / ulp_f32(TEST_PI));
+    ref    = atan2((double)q31In[i], (double)q31In2[i]) / TEST_PI * 2147483648.0 - (double)q31Out[i];
+    err[1] = fmax(err[1], fabs(remainder(ref, 4294967296.0)));
+    ref    = atan2((double)q15In[i], (double)q15In2[i]) / TEST_PI * 32768.0 - (double)q15Out[i];
+    err[2] = fmax(err[2], fabs(remainder(ref, 65536.0)));
+  }
+  print_err("arm_vatan2_f32, ulp of pi", err[0], "ulp", 1.15);
+  print_err("arm_vatan2_q31", err[1], "LSB", 1.45);
+  print_err("arm_vatan2_q15", err[2], "LSB", 0.95);
+
+  /* atan2(0, 0) = 0, and the signed zeros as atan2() */
+  arm_vatan2_f32((float32_t *)zeroY, (float32_t *)zeroX, out, 4u);
+  TEST_CHECK((out[0] == 0.0f) && (out[1] == (float32_t)TEST_PI) && (out[2] == -(float32_t)TEST_PI) &&
+             (out[3] == 0.0f) && signbit(out[3]));
+  q31In[0] = q31In2[0] = 0;
+  q15In[0] = q15In2[0] = 0;
+  arm_vatan2_q31(q31In, q31In2, q31Out, 1u);
+  arm_vatan2_q15(q15In, q15In2, q15Out, 1u);
+  TEST_CHECK((q31Out[0] == 0) && (q15Out[0] == 0));
+}
+
+/* ----------------------------------------------------------------------
+** Benchmarks
+** ------------------------------------------------------------------- */
+
+static void bench(void)
+{
+  uint32_t n = TEST_BENCH_LEN, i;
+
+  /* sin: |x| <= 8; exp: |x| <= 10; log and sqrt: 0.001 to 1000; atan2: |x|, |y| <= 1 */
+  test_rand_f64(refIn, n, 8.0);
+  test_f64_to_f32(refIn, f32In, n);
+  TEST_BENCH("sinf loop", n, for (i = 0u; i < n; i++) { f32Out[i] = sinf(f32In[i]); });
+  TEST_BENCH("arm_sin_f32 loop", n, for (i = 0u; i < n; i++) { f32Out[i] = arm_sin_f32(f32In[i]); });
+  TEST_BENCH("arm_vsin_f32", n, arm_vsin_f32(f32In, f32Out, n));
+  TEST_BENCH("arm_vcos_f32", n, arm_vcos_f32(f32In, f32Out, n));
+  for (i = 0u; i < n; i++)
+  {
+    f32In2[i] = 1.25f * f32In[i];
+  }
+  TEST_BENCH("expf loop", n, for (i = 0u; i < n; i++) { f32Out[i] = expf(f32In2[i]); });
+  TEST_BENCH("arm_vexp_f32", n, arm_vexp_f32(f32In2, f32Out, n));
+  for (i = 0u; i < n; i++)
+  {
+    f32In2[i] = (float32_t)pow(10.0, 0.375 * refIn[i]);
+  }
+  TEST_BENCH("logf loop", n, for (i = 0u; i < n; i++) { f32Out[i] = logf(f32In2[i]); });
+  TEST_BENCH("arm_vlog_f32", n, arm_vlog_f32(f32In2, f32Out, n));
+  TEST_BENCH("sqrtf loop", n, for (i = 0u; i < n; i++) { f32Out[i] = sqrtf(f32In2[i]); });
+  TEST_BENCH("arm_sqrt_f32 loop", n, for (i = 0u; i < n; i++) { (void)arm_sqrt_f32(f32In2[i], &f32Out[i]); });
+  TEST_BENCH("arm_vsqrt_f32", n, (void)arm_vsqrt_f32(f32In2, f32Out, n));
+
+  test_rand_f64(refIn, n, 1.0);
+  test_rand_f64(refIn2, n, 1.0);
+  test_f64_to_f32(refIn, f32In, n);
+  test_f64_to_f32(refIn2, f32In2, n);
+  TEST_BENCH("atan2f loop", n, for (i = 0u; i < n; i++) { f32Out[i] = atan2f(f32In[i], f32In2[i]); });
+  TEST_BENCH("arm_vatan2_f32", n, arm_vatan2_f32(f32In, f32In2, f32Out, n));
+
+  test_f64_to_q31(refIn, q31In, n);
+  test_f64_to_q31(refIn2, q31In2, n);
+  test_f64_to_q15(refIn, q15In, n);
+  test_f64_to_q15(refIn2, q15In2, n);
+  TEST_BENCH("arm_sin_q31 loop", n, for (i = 0u; i < n; i++) { q31Out[i] = arm_sin_q31(q31In[i] & 0x7FFFFFFF); });
+  TEST_BENCH("arm_vsin_q31", n, arm_vsin_q31(q31In, q31Out, n));
+  TEST_BENCH("arm_vatan2_q31", n, arm_vatan2_q31(q31In, q31In2, q31Out, n));
+  TEST_BENCH("arm_sin_q15 loop", n, for (i = 0u; i < n; i++) { q15Out[i] = arm_sin_q15(q15In[i] & 0x7FFF); });
+  TEST_BENCH("arm_vsin_q15", n, arm_vsin_q15(q15In, q15Out, n));
+  TEST_BENCH("arm_vatan2_q15", n, arm_vatan2_q15(q15In, q15In2, q15Out, n));
+}
+
+int main(int argc, char **argv)
+{
+  test_begin("arm_vmath_test", argc, argv);
+  test_seed(1u);
+  test_sin_cos_f32();
+  test_sin_cos_fixed();
+  test_exp_log_sqrt();
+  test_atan2();
+  if (test_bench_enabled())
+  {
+    bench();
+  }
+  return (test_end());
+}
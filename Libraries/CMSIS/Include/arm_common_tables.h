@@ -68,6 +68,9 @@ extern const float32_t twiddleCoef_rfft_512[512];
 extern const float32_t twiddleCoef_rfft_1024[1024];
 extern const float32_t twiddleCoef_rfft_2048[2048];
 extern const float32_t twiddleCoef_rfft_4096[4096];
+#if defined (ARM_MATH_RFFT_8192)
+extern const float32_t twiddleCoef_rfft_8192[8192];
+#endif
 
 
 #define ARMBITREVINDEXTABLE__16_TABLE_LENGTH ((uint16_t)20  )
@@ -90,4 +93,67 @@ extern const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE1024_TABLE_LENG
 extern const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE2048_TABLE_LENGTH];
 extern const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE4096_TABLE_LENGTH];
 
+extern const float32_t twiddleCoef_3840[7680];
+
+#define ARMDIGITREVINDEXTABLE__48_TABLE_LENGTH ((uint16_t)50   )
+#define ARMDIGITREVINDEXTABLE__60_TABLE_LENGTH ((uint16_t)62   )
+#define ARMDIGITREVINDEXTABLE__80_TABLE_LENGTH ((uint16_t)82   )
+#define ARMDIGITREVINDEXTABLE__96_TABLE_LENGTH ((uint16_t)102  )
+#define ARMDIGITREVINDEXTABLE_120_TABLE_LENGTH ((uint16_t)122  )
+#define ARMDIGITREVINDEXTABLE_160_TABLE_LENGTH ((uint16_t)164  )
+#define ARMDIGITREVINDEXTABLE_192_TABLE_LENGTH ((uint16_t)192  )
+#define ARMDIGITREVINDEXTABLE_240_TABLE_LENGTH ((uint16_t)242  )
+#define ARMDIGITREVINDEXTABLE_320_TABLE_LENGTH ((uint16_t)326  )
+#define ARMDIGITREVINDEXTABLE_384_TABLE_LENGTH ((uint16_t)390  )
+#define ARMDIGITREVINDEXTABLE_480_TABLE_LENGTH ((uint16_t)482  )
+#define ARMDIGITREVINDEXTABLE_640_TABLE_LENGTH ((uint16_t)642  )
+#define ARMDIGITREVINDEXTABLE_768_TABLE_LENGTH ((uint16_t)774  )
+#define ARMDIGITREVINDEXTABLE_960_TABLE_LENGTH ((uint16_t)966  )
+#define ARMDIGITREVINDEXTABLE1280_TABLE_LENGTH ((uint16_t)1288 )
+#define ARMDIGITREVINDEXTABLE1920_TABLE_LENGTH ((uint16_t)1924 )
+#define ARMDIGITREVINDEXTABLE3840_TABLE_LENGTH ((uint16_t)3852 )
+
+extern const uint16_t armDigitRevIndexTable48[ARMDIGITREVINDEXTABLE__48_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable60[ARMDIGITREVINDEXTABLE__60_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable80[ARMDIGITREVINDEXTABLE__80_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable96[ARMDIGITREVINDEXTABLE__96_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable120[ARMDIGITREVINDEXTABLE_120_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable160[ARMDIGITREVINDEXTABLE_160_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable192[ARMDIGITREVINDEXTABLE_192_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable240[ARMDIGITREVINDEXTABLE_240_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable320[ARMDIGITREVINDEXTABLE_320_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable384[ARMDIGITREVINDEXTABLE_384_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable480[ARMDIGITREVINDEXTABLE_480_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable640[ARMDIGITREVINDEXTABLE_640_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable768[ARMDIGITREVINDEXTABLE_768_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable960[ARMDIGITREVINDEXTABLE_960_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable1280[ARMDIGITREVINDEXTABLE1280_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable1920[ARMDIGITREVINDEXTABLE1920_TABLE_LENGTH];
+extern const uint16_t armDigitRevIndexTable3840[ARMDIGITREVINDEXTABLE3840_TABLE_LENGTH];
+
+#define ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH ((uint16_t)12   )
+#define ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH ((uint16_t)24   )
+#define ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH ((uint16_t)56   )
+#define ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH ((uint16_t)112  )
+#define ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH ((uint16_t)240  )
+#define ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH ((uint16_t)480  )
+#define ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH ((uint16_t)992  )
+#define ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH ((uint16_t)1984 )
+#define ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH ((uint16_t)4032 )
+
+extern const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH];
+
+#define FAST_MATH_TABLE_SIZE  512
+extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
+extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
+extern const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1];
+
 #endif /*  ARM_COMMON_TABLES_H */
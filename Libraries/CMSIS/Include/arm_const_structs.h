@@ -82,4 +82,144 @@
       4096, twiddleCoef_4096, armBitRevIndexTable4096, ARMBITREVINDEXTABLE4096_TABLE_LENGTH
    };
 
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len48 = {
+      48, twiddleCoef_3840, 80, armDigitRevIndexTable48, ARMDIGITREVINDEXTABLE__48_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len60 = {
+      60, twiddleCoef_3840, 64, armDigitRevIndexTable60, ARMDIGITREVINDEXTABLE__60_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len80 = {
+      80, twiddleCoef_3840, 48, armDigitRevIndexTable80, ARMDIGITREVINDEXTABLE__80_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len96 = {
+      96, twiddleCoef_3840, 40, armDigitRevIndexTable96, ARMDIGITREVINDEXTABLE__96_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len120 = {
+      120, twiddleCoef_3840, 32, armDigitRevIndexTable120, ARMDIGITREVINDEXTABLE_120_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len160 = {
+      160, twiddleCoef_3840, 24, armDigitRevIndexTable160, ARMDIGITREVINDEXTABLE_160_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len192 = {
+      192, twiddleCoef_3840, 20, armDigitRevIndexTable192, ARMDIGITREVINDEXTABLE_192_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len240 = {
+      240, twiddleCoef_3840, 16, armDigitRevIndexTable240, ARMDIGITREVINDEXTABLE_240_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len320 = {
+      320, twiddleCoef_3840, 12, armDigitRevIndexTable320, ARMDIGITREVINDEXTABLE_320_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len384 = {
+      384, twiddleCoef_3840, 10, armDigitRevIndexTable384, ARMDIGITREVINDEXTABLE_384_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len480 = {
+      480, twiddleCoef_3840, 8, armDigitRevIndexTable480, ARMDIGITREVINDEXTABLE_480_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len640 = {
+      640, twiddleCoef_3840, 6, armDigitRevIndexTable640, ARMDIGITREVINDEXTABLE_640_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len768 = {
+      768, twiddleCoef_3840, 5, armDigitRevIndexTable768, ARMDIGITREVINDEXTABLE_768_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len960 = {
+      960, twiddleCoef_3840, 4, armDigitRevIndexTable960, ARMDIGITREVINDEXTABLE_960_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len1280 = {
+      1280, twiddleCoef_3840, 3, armDigitRevIndexTable1280, ARMDIGITREVINDEXTABLE1280_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len1920 = {
+      1920, twiddleCoef_3840, 2, armDigitRevIndexTable1920, ARMDIGITREVINDEXTABLE1920_TABLE_LENGTH
+   };
+
+   const arm_cfft_mixed_instance_f32 arm_cfft_mR_f32_len3840 = {
+      3840, twiddleCoef_3840, 1, armDigitRevIndexTable3840, ARMDIGITREVINDEXTABLE3840_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len16 = {
+      16, twiddleCoefQ15, 256, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len32 = {
+      32, twiddleCoefQ15, 128, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len64 = {
+      64, twiddleCoefQ15, 64, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len128 = {
+      128, twiddleCoefQ15, 32, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len256 = {
+      256, twiddleCoefQ15, 16, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len512 = {
+      512, twiddleCoefQ15, 8, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len1024 = {
+      1024, twiddleCoefQ15, 4, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048 = {
+      2048, twiddleCoefQ15, 2, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096 = {
+      4096, twiddleCoefQ15, 1, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len16 = {
+      16, twiddleCoefQ31, 256, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len32 = {
+      32, twiddleCoefQ31, 128, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len64 = {
+      64, twiddleCoefQ31, 64, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len128 = {
+      128, twiddleCoefQ31, 32, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len256 = {
+      256, twiddleCoefQ31, 16, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len512 = {
+      512, twiddleCoefQ31, 8, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len1024 = {
+      1024, twiddleCoefQ31, 4, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len2048 = {
+      2048, twiddleCoefQ31, 2, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
+   };
+
+   const arm_cfft_instance_q31 arm_cfft_sR_q31_len4096 = {
+      4096, twiddleCoefQ31, 1, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
+   };
+
 #endif
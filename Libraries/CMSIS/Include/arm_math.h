@@ -128,6 +128,37 @@
    * Define macro ARM_MATH_CM4 for building the library on Cortex-M4 target, ARM_MATH_CM3 for building library on Cortex-M3 target
    * and ARM_MATH_CM0 for building library on cortex-M0 target, ARM_MATH_CM0PLUS for building library on cortex-M0+ target.
    *
+   * - ARM_MATH_HOST:
+   *
+   * Define macro ARM_MATH_HOST to build the library on a little endian PC (x86-64 Linux, GCC or Clang), e.g. to test or
+   * measure a kernel off-target. The Cortex-M4 code paths are built and the core and SIMD intrinsics come from
+   * <code>core_host.h</code>, in portable C with the results of the Cortex-M4 instructions:
+   * <pre>
+   *     gcc -O2 -fno-strict-aliasing -pthread -DARM_MATH_HOST -IInclude app.c DSP_Lib/Source/[A-Z]*[a-z]/[a-z]*.c -lm
+   * </pre>
+   * -fno-strict-aliasing is required: the q7 and q15 kernels access their buffers through 32 bit pointers (__SIMD32).
+   *
+   * <code>DSP_Lib/Test/Makefile</code> builds the library this way, with the programs that check the kernels against
+   * double precision references (SNR in dB) and measure them (ns per sample on the host):
+   * <pre>
+   *     make -C DSP_Lib/Test test      runs the accuracy tests
+   *     make -C DSP_Lib/Test bench     also runs the benchmarks
+   * </pre>
+   *
+   * The float32 FIR, transposed direct form II biquad, complex FFT, matrix multiplication, dot product and vector
+   * transcendental functions (arm_vsin_f32(), ...) use the SIMD unit of the host: AVX2 on x86-64, selected at run time
+   * from the CPUID (a CPU without AVX2 runs the C code), or NEON on AArch64. Define ARM_MATH_HOST_SSE2 to build 4-lane
+   * SSE2 kernels instead of the AVX2 ones, or ARM_MATH_HOST_NO_SIMD to build the C code only. The results are bit-exact
+   * with the C code, except for the dot product, which sums in a different order (see arm_dot_prod_f32()).
+   *
+   * - ARM_MATH_RFFT_8192:
+   *
+   * Define macro ARM_MATH_RFFT_8192 to support the 8192-point real FFT in arm_rfft_fast_init_f32(). Its twiddle table,
+   * twiddleCoef_rfft_8192, takes 32 KB of flash, and the init function links it as soon as it is used for any length.
+   * arm_fir_fft_init_f32() then accepts partitions of 4096 samples, and the FFT form of arm_conv_fft_f32(),
+   * arm_correlate_fft_f32() and their fixed-point versions extends to two sequences of 4096 samples. Without it the
+   * longest real FFT has 4096 points.
+   *
    * - __FPU_PRESENT:
    *
    * Initialize macro __FPU_PRESENT = 1 when building on FPU supported Targets. Enable this macro for M4bf and M4lf libraries
@@ -149,6 +180,13 @@
  * operate on individual values and not arrays.
  * There are separate functions for Q15, Q31, and floating-point data.
  *
+ * The vector functions (arm_vsin_f32(), arm_vcos_f32(), arm_vatan2_f32(), arm_vexp_f32(), arm_vlog_f32()
+ * and arm_vsqrt_f32(), with Q31 and Q15 forms of the trigonometric ones) operate on arrays, with
+ * polynomial approximations of documented accuracy and no table lookup.
+ *
+ * The numerically controlled oscillators (arm_nco_f32(), ...) generate blocks of sine and cosine
+ * samples from a phase accumulator, which keeps the carrier continuous from one block to the next.
+ *
  */
 
 /**
@@ -238,6 +276,9 @@
 
 /**
  * @defgroup groupTransforms Transform Functions
+ *
+ * Besides the FFTs and the DCT, the Goertzel bank and the sliding DFT compute a few selected bins
+ * of the DFT, either once per frame or after every input sample.
  */
 
 /**
@@ -258,6 +299,12 @@
  * bilinear interpolation is used for 2-dimensional data.
  */
 
+/**
+ * @defgroup groupBatch Batch Functions
+ * These functions run a kernel over many independent channels on a pool of threads.
+ * They are only available with ARM_MATH_HOST (POSIX threads).
+ */
+
 /**
  * @defgroup groupExamples Examples
  */
@@ -276,6 +323,8 @@
 #elif defined (ARM_MATH_CM0PLUS)
 #include "core_cm0plus.h"
 #define ARM_MATH_CM0_FAMILY
+#elif defined (ARM_MATH_HOST)
+#include "core_host.h"
 #else
 #include "ARMCM4.h"
 #warning "Define either ARM_MATH_CM4 OR ARM_MATH_CM3...By Default building on ARM_MATH_CM4....."
@@ -316,6 +365,23 @@ extern "C"
   /* -1 to +1 is divided into 360 values so total spacing is (2/360) */
 #define INPUT_SPACING			0xB60B61
 
+  /**
+   * @brief Macros required for the blocked matrix multiplication
+   */
+  /* Block of B reused for all the rows of A, and size below which arm_mat_mult_f32() does not use blocks */
+#ifndef MAT_MULT_BLOCK_K
+#if defined (ARM_MATH_HOST)
+#define MAT_MULT_BLOCK_K		256
+#define MAT_MULT_BLOCK_N		128
+#else
+#define MAT_MULT_BLOCK_K		32
+#define MAT_MULT_BLOCK_N		32
+#endif
+#endif
+#ifndef MAT_MULT_BLOCK_MIN
+#define MAT_MULT_BLOCK_MIN		16
+#endif
+
   /**
    * @brief Macro for Unaligned Support
    */
@@ -341,7 +407,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by matrix decompositions if the input matrix is not positive (semi)definite. */
   } arm_status;
 
   /**
@@ -1232,6 +1299,67 @@ extern "C"
   float32_t * pState,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the floating-point interleaved multichannel FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;     /**< number of filter coefficients in the filter. */
+    uint16_t numChans;    /**< number of interleaved channels. */
+    float32_t *pState;    /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChans. */
+    float32_t *pCoeffs;   /**< points to the coefficient array, shared by the channels. The array is of length numTaps. */
+  } arm_fir_interleaved_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point interleaved multichannel FIR filter.
+   * @param[in] *S points to an instance of the floating-point interleaved FIR structure.
+   * @param[in] *pSrc points to the block of input frames.
+   * @param[out] *pDst points to the block of output frames.
+   * @param[in] blockSize number of frames to process.
+   * @return none.
+   */
+  void arm_fir_interleaved_f32(
+  const arm_fir_interleaved_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for a range of channels of the floating-point interleaved FIR filter.
+   * @param[in] *S points to an instance of the floating-point interleaved FIR structure.
+   * @param[in] *pSrc points to the block of input frames.
+   * @param[out] *pDst points to the block of output frames.
+   * @param[in] blockSize number of frames to process.
+   * @param[in] firstChan first channel to process.
+   * @param[in] numChans number of channels to process.
+   * @return none.
+   */
+  void arm_fir_interleaved_range_f32(
+  const arm_fir_interleaved_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  uint16_t firstChan,
+  uint16_t numChans);
+
+  /**
+   * @brief  Initialization function for the floating-point interleaved FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point interleaved FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter.
+   * @param[in] numChans Number of interleaved channels.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of frames that are processed at a time.
+   * @return none.
+   */
+  void arm_fir_interleaved_init_f32(
+  arm_fir_interleaved_instance_f32 * S,
+  uint16_t numTaps,
+  uint16_t numChans,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
 
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
@@ -1398,6 +1526,98 @@ extern "C"
   float32_t * pCoeffs,
   float32_t * pState);
 
+  /**
+   * @brief Instance structure for the Q15 interleaved multichannel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;    /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChans;    /**< number of interleaved channels. */
+    q15_t *pState;        /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChans. */
+    q15_t *pCoeffs;       /**< Points to the array of coefficients, shared by the channels.  The array is of length 6*numStages. */
+    int8_t postShift;     /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_casd_df1_interleaved_inst_q15;
+
+  /**
+   * @brief Processing function for the Q15 interleaved multichannel Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the Q15 interleaved Biquad cascade structure.
+   * @param[in]  *pSrc     points to the block of input frames.
+   * @param[out] *pDst     points to the block of output frames.
+   * @param[in]  blockSize number of frames to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df1_interleaved_q15(
+  const arm_biquad_casd_df1_interleaved_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 interleaved multichannel Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the Q15 interleaved Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChans     number of interleaved channels.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df1_interleaved_init_q15(
+  arm_biquad_casd_df1_interleaved_inst_q15 * S,
+  uint8_t numStages,
+  uint16_t numChans,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift);
+
+  /**
+   * @brief Instance structure for the Q31 interleaved multichannel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;    /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChans;    /**< number of interleaved channels. */
+    q31_t *pState;        /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChans. */
+    q31_t *pCoeffs;       /**< Points to the array of coefficients, shared by the channels.  The array is of length 5*numStages. */
+    uint8_t postShift;     /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_casd_df1_interleaved_inst_q31;
+
+  /**
+   * @brief Processing function for the Q31 interleaved multichannel Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the Q31 interleaved Biquad cascade structure.
+   * @param[in]  *pSrc     points to the block of input frames.
+   * @param[out] *pDst     points to the block of output frames.
+   * @param[in]  blockSize number of frames to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df1_interleaved_q31(
+  const arm_biquad_casd_df1_interleaved_inst_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 interleaved multichannel Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the Q31 interleaved Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChans     number of interleaved channels.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df1_interleaved_init_q31(
+  arm_biquad_casd_df1_interleaved_inst_q31 * S,
+  uint8_t numStages,
+  uint16_t numChans,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint8_t postShift);
+
 
   /**
    * @brief Instance structure for the floating-point matrix structure.
@@ -1410,6 +1630,17 @@ extern "C"
     float32_t *pData;     /**< points to the data of the matrix. */
   } arm_matrix_instance_f32;
 
+  /**
+   * @brief Instance structure for the double-precision floating-point matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    float64_t *pData;     /**< points to the data of the matrix. */
+  } arm_matrix_instance_f64;
+
   /**
    * @brief Instance structure for the Q15 matrix structure.
    */
@@ -1450,6 +1681,20 @@ extern "C"
   const arm_matrix_instance_f32 * pSrcB,
   arm_matrix_instance_f32 * pDst);
 
+  /**
+   * @brief Double-precision floating-point matrix addition.
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_add_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
   /**
    * @brief Q15 matrix addition.
    * @param[in]       *pSrcA points to the first input matrix structure
@@ -1491,6 +1736,18 @@ extern "C"
   const arm_matrix_instance_f32 * pSrc,
   arm_matrix_instance_f32 * pDst);
 
+  /**
+   * @brief Double-precision floating-point matrix transpose.
+   * @param[in]  *pSrc points to the input matrix
+   * @param[out] *pDst points to the output matrix
+   * @return 	The function returns either  <code>ARM_MATH_SIZE_MISMATCH</code>
+   * or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_trans_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
 
   /**
    * @brief Q15 matrix transpose.
@@ -1531,6 +1788,38 @@ extern "C"
   const arm_matrix_instance_f32 * pSrcB,
   arm_matrix_instance_f32 * pDst);
 
+  /**
+   * @brief Floating-point matrix multiplication by blocks, for large matrices
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure, or to its transpose
+   * @param[out]      *pDst points to output matrix structure
+   * @param[in]       *pState points to a buffer of MAT_MULT_BLOCK_K * MAT_MULT_BLOCK_N values for the packed blocks of B, or NULL
+   * @param[in]       transposeFlagB flag that selects the layout of pSrcB: 0 for B, 1 for B transposed
+   * @return     The function returns <code>ARM_MATH_SIZE_MISMATCH</code>, <code>ARM_MATH_ARGUMENT_ERROR</code>
+   * if B is transposed and pState is NULL, or <code>ARM_MATH_SUCCESS</code>.
+   */
+
+  arm_status arm_mat_mult_blocked_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pState,
+  uint8_t transposeFlagB);
+
+  /**
+   * @brief Double-precision floating-point matrix multiplication
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_mult_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
   /**
    * @brief Q15 matrix multiplication
    * @param[in]       *pSrcA points to the first input matrix structure
@@ -1547,6 +1836,24 @@ extern "C"
   arm_matrix_instance_q15 * pDst,
   q15_t * pState);
 
+  /**
+   * @brief Q15 matrix multiplication by tiles, for large matrices
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure, or to its transpose
+   * @param[out]      *pDst points to output matrix structure
+   * @param[in]		  *pState points to the array for the transpose of B, unused if transposeFlagB is 1
+   * @param[in]       transposeFlagB flag that selects the layout of pSrcB: 0 for B, 1 for B transposed
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_mult_blocked_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst,
+  q15_t * pState,
+  uint8_t transposeFlagB);
+
   /**
    * @brief Q15 matrix multiplication (fast variant) for Cortex-M3 and Cortex-M4
    * @param[in]       *pSrcA  points to the first input matrix structure
@@ -1726,6 +2033,21 @@ extern "C"
   uint16_t nColumns,
   float32_t * pData);
 
+  /**
+   * @brief  Double-precision floating-point matrix initialization.
+   * @param[in,out] *S             points to an instance of the double-precision floating-point matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pData	       points to the matrix data array.
+   * @return        none
+   */
+
+  void arm_mat_init_f64(
+  arm_matrix_instance_f64 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  float64_t * pData);
+
 
 
   /**
@@ -1834,6 +2156,86 @@ extern "C"
   void arm_pid_reset_q15(
   arm_pid_instance_q15 * S);
 
+  /**
+   * @brief Instance structure for the floating-point Kalman filter.
+   */
+  typedef struct
+  {
+    uint16_t numStates;         /**< number of states n. */
+    uint16_t numMeas;           /**< largest number of measurements per vector update m. */
+    float32_t *pState;          /**< points to the state vector of length n. */
+    float32_t *pCov;            /**< points to the n x n state covariance matrix P. */
+    float32_t *pTrans;          /**< points to the n x n state transition matrix F. */
+    float32_t *pProcNoise;      /**< points to the n x n process noise covariance matrix Q. */
+    float32_t *pFP;             /**< points to the n x n product F * P in the arena. */
+    float32_t *pPHt;            /**< points to the n values P * h^T in the arena. */
+    float32_t *pRChol;          /**< points to the m x m Cholesky factor of R in the arena. */
+    float32_t *pHw;             /**< points to the m x n decorrelated measurement matrix in the arena. */
+    float32_t *pZw;             /**< points to the m decorrelated measurements in the arena. */
+  } arm_kalman_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Kalman filter.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     numStates number of states n.
+   * @param[in]     numMeas largest number of measurements m per call to arm_kalman_update_f32().
+   * @param[in]     *pState points to the state vector of length n.
+   * @param[in]     *pCov points to the n x n state covariance matrix.
+   * @param[in]     *pTrans points to the n x n state transition matrix.
+   * @param[in]     *pProcNoise points to the n x n process noise covariance matrix.
+   * @param[in]     *pArena points to the work buffer of n*n + n + m*m + m*n + m values.
+   * @return none.
+   */
+  void arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  float32_t * pState,
+  float32_t * pCov,
+  float32_t * pTrans,
+  float32_t * pProcNoise,
+  float32_t * pArena);
+
+  /**
+   * @brief  Prediction step of the floating-point Kalman filter, x = F * x and P = F * P * F^T + Q.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     *pStatePred points to the state propagated by the application, or NULL to compute x = F * x.
+   * @return none.
+   */
+  void arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pStatePred);
+
+  /**
+   * @brief  Scalar measurement update of the floating-point Kalman filter.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     *pH points to the measurement row of length n.
+   * @param[in]     z measurement.
+   * @param[in]     r variance of the measurement noise.
+   * @return The function returns ARM_MATH_SINGULAR if the innovation variance is not positive.
+   */
+  arm_status arm_kalman_update_scalar_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pH,
+  float32_t z,
+  float32_t r);
+
+  /**
+   * @brief  Vector measurement update of the floating-point Kalman filter.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     *pH points to the instance of the m x n measurement matrix.
+   * @param[in]     *pZ points to the measurement vector of length m.
+   * @param[in]     *pR points to the instance of the m x m measurement noise covariance matrix.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match,
+   * ARM_MATH_DECOMPOSITION_FAILURE if R is not positive definite and ARM_MATH_SINGULAR
+   * if an innovation variance is not positive.
+   */
+  arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pH,
+  float32_t * pZ,
+  const arm_matrix_instance_f32 * pR);
+
 
   /**
    * @brief Instance structure for the floating-point Linear Interpolate function.
@@ -2133,6 +2535,63 @@ extern "C"
   uint8_t ifftFlag,
   uint8_t bitReverseFlag);
 
+  /**
+   * @brief Instance structure for the Q15 CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< length of the FFT. */
+    const q15_t *pTwiddle;             /**< points to the Twiddle factor table. */
+    uint16_t twidCoefModifier;         /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    const uint16_t *pBitRevTable;      /**< points to the bit reversal table. */
+    uint16_t bitRevLength;             /**< bit reversal table length. */
+  } arm_cfft_instance_q15;
+
+  void arm_cfft_q15(
+  const arm_cfft_instance_q15 * S,
+  q15_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
+
+  /**
+   * @brief Instance structure for the Q31 CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< length of the FFT. */
+    const q31_t *pTwiddle;             /**< points to the Twiddle factor table. */
+    uint16_t twidCoefModifier;         /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    const uint16_t *pBitRevTable;      /**< points to the bit reversal table. */
+    uint16_t bitRevLength;             /**< bit reversal table length. */
+  } arm_cfft_instance_q31;
+
+  void arm_cfft_q31(
+  const arm_cfft_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< length of the FFT, 2^a * 3^b * 5^c. */
+    const float32_t *pTwiddle;         /**< points to the Twiddle factor table. */
+    uint16_t twidCoefModifier;         /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    const uint16_t *pDigitRevTable;    /**< points to the digit reversal table. */
+    uint16_t digitRevLength;           /**< digit reversal table length. */
+  } arm_cfft_mixed_instance_f32;
+
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
+
   /**
    * @brief Instance structure for the Q15 RFFT/RIFFT function.
    */
@@ -2238,41 +2697,425 @@ void arm_rfft_fast_f32(
   uint8_t ifftFlag);
 
   /**
-   * @brief Instance structure for the floating-point DCT4/IDCT4 function.
+   * @brief Instance structure for the floating-point mixed-radix RFFT/RIFFT function.
    */
 
   typedef struct
   {
-    uint16_t N;                         /**< length of the DCT4. */
-    uint16_t Nby2;                      /**< half of the length of the DCT4. */
-    float32_t normalize;                /**< normalizing factor. */
-    float32_t *pTwiddle;                /**< points to the twiddle factor table. */
-    float32_t *pCosFactor;              /**< points to the cosFactor table. */
-    arm_rfft_instance_f32 *pRfft;        /**< points to the real FFT instance. */
-    arm_cfft_radix4_instance_f32 *pCfft; /**< points to the complex FFT instance. */
-  } arm_dct4_instance_f32;
+    arm_cfft_mixed_instance_f32 Sint;  /**< Internal CFFT structure. */
+    uint16_t fftLenRFFT;               /**< length of the real sequence */
+    const float32_t *pTwiddleRFFT;     /**< Twiddle factors real stage */
+    uint16_t twidCoefRModifier;        /**< step of the real stage in the twiddle factor table */
+  } arm_rfft_mixed_instance_f32;
+
+  arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen);
+
+  void arm_rfft_mixed_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
 
   /**
-   * @brief  Initialization function for the floating-point DCT4/IDCT4.
-   * @param[in,out] *S         points to an instance of floating-point DCT4/IDCT4 structure.
-   * @param[in]     *S_RFFT    points to an instance of floating-point RFFT/RIFFT structure.
-   * @param[in]     *S_CFFT    points to an instance of floating-point CFFT/CIFFT structure.
-   * @param[in]     N          length of the DCT4.
-   * @param[in]     Nby2       half of the length of the DCT4.
-   * @param[in]     normalize  normalizing factor.
-   * @return		arm_status function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLenReal</code> is not a supported transform length.
+   * @brief Instance structure for the floating-point Goertzel bank.
    */
 
-  arm_status arm_dct4_init_f32(
-  arm_dct4_instance_f32 * S,
-  arm_rfft_instance_f32 * S_RFFT,
-  arm_cfft_radix4_instance_f32 * S_CFFT,
-  uint16_t N,
-  uint16_t Nby2,
-  float32_t normalize);
-
-  /**
-   * @brief Processing function for the floating-point DCT4/IDCT4.
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of bins. */
+    uint16_t frameLen;                 /**< length of a frame, in samples. */
+    uint16_t fftLen;                   /**< length of the real FFT that replaces the Goertzel filters, or 0. */
+    const uint16_t *pBins;             /**< points to the bin indices, numBins values below frameLen. */
+    float32_t *pCoeffs;                /**< points to the coefficients, 4*sin(w/2)^2, sin(w) and the sign of the odd samples of each bin. The array is of length 3*numBins. */
+    float32_t *pScratch;               /**< points to a scratch buffer of 2*frameLen words for the real FFT, or NULL. */
+    arm_rfft_fast_instance_f32 rfft;   /**< real FFT of frameLen points. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel bank.
+   * @param[out] *S points to an instance of the floating-point Goertzel bank structure.
+   * @param[in]  numBins number of bins.
+   * @param[in]  frameLen length of a frame, in samples.
+   * @param[in]  *pBins points to the bin indices, numBins values below frameLen.
+   * @param[out] *pCoeffs points to the coefficient buffer of 3*numBins values.
+   * @param[in]  *pScratch points to a scratch buffer of 2*frameLen words, or NULL to always use the Goertzel filters.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numBins</code> or <code>frameLen</code> is zero, or a bin index is not below <code>frameLen</code>.
+   */
+
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const uint16_t * pBins,
+  float32_t * pCoeffs,
+  float32_t * pScratch);
+
+  /**
+   * @brief  Processing function for the floating-point Goertzel bank.
+   * @param[in]  *S points to an instance of the floating-point Goertzel bank structure.
+   * @param[in]  *pSrc points to the frame of frameLen input samples.
+   * @param[out] *pDst points to the complex DFT values of the bins, 2*numBins values.
+   * @return none.
+   */
+
+  void arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst);
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of bins. */
+    uint16_t frameLen;                 /**< length of a frame, in samples. */
+    uint16_t fftLen;                   /**< length of the real FFT that replaces the Goertzel filters, or 0. */
+    uint8_t shift;                     /**< log2 of the output scaling, the smallest power of 2 not below frameLen. */
+    const uint16_t *pBins;             /**< points to the bin indices, numBins values below frameLen. */
+    q31_t *pCoeffs;                    /**< points to the coefficients, 4*sin(w/2)^2 and sin(w) of each bin in 2.30 format, the right shift of the input and the sign mask of the odd samples. The array is of length 4*numBins. */
+    float32_t *pScratch;               /**< points to a scratch buffer of 2*frameLen words for the real FFT, or NULL. */
+    arm_rfft_fast_instance_f32 rfft;   /**< real FFT of frameLen points. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel bank.
+   * @param[out] *S points to an instance of the Q31 Goertzel bank structure.
+   * @param[in]  numBins number of bins.
+   * @param[in]  frameLen length of a frame, in samples.
+   * @param[in]  *pBins points to the bin indices, numBins values below frameLen.
+   * @param[out] *pCoeffs points to the coefficient buffer of 4*numBins values.
+   * @param[in]  *pScratch points to a scratch buffer of 2*frameLen words, or NULL to always use the Goertzel filters.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numBins</code> or <code>frameLen</code> is zero, a bin index is not below <code>frameLen</code>,
+   * or the input shift of a bin would exceed 31 bits.
+   */
+
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const uint16_t * pBins,
+  q31_t * pCoeffs,
+  float32_t * pScratch);
+
+  /**
+   * @brief  Processing function for the Q31 Goertzel bank.
+   * @param[in]  *S points to an instance of the Q31 Goertzel bank structure.
+   * @param[in]  *pSrc points to the frame of frameLen input samples.
+   * @param[out] *pDst points to the complex DFT values of the bins, 2*numBins values.
+   * @return none.
+   */
+
+  void arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst);
+
+  /**
+   * @brief Instance structure for the Q15 Goertzel bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of bins. */
+    uint16_t frameLen;                 /**< length of a frame, in samples. */
+    uint16_t fftLen;                   /**< length of the real FFT that replaces the Goertzel filters, or 0. */
+    uint8_t shift;                     /**< log2 of the output scaling, the smallest power of 2 not below frameLen. */
+    const uint16_t *pBins;             /**< points to the bin indices, numBins values below frameLen. */
+    q31_t *pCoeffs;                    /**< points to the coefficients, 4*sin(w/2)^2 and sin(w) of each bin in 2.30 format, the right shift of the input and the sign mask of the odd samples. The array is of length 4*numBins. */
+    float32_t *pScratch;               /**< points to a scratch buffer of 2*frameLen words for the real FFT, or NULL. */
+    arm_rfft_fast_instance_f32 rfft;   /**< real FFT of frameLen points. */
+  } arm_goertzel_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 Goertzel bank.
+   * @param[out] *S points to an instance of the Q15 Goertzel bank structure.
+   * @param[in]  numBins number of bins.
+   * @param[in]  frameLen length of a frame, in samples.
+   * @param[in]  *pBins points to the bin indices, numBins values below frameLen.
+   * @param[out] *pCoeffs points to the coefficient buffer of 4*numBins values.
+   * @param[in]  *pScratch points to a scratch buffer of 2*frameLen words, or NULL to always use the Goertzel filters.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numBins</code> or <code>frameLen</code> is zero, a bin index is not below <code>frameLen</code>,
+   * or the input shift of a bin would exceed 31 bits.
+   */
+
+  arm_status arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const uint16_t * pBins,
+  q31_t * pCoeffs,
+  float32_t * pScratch);
+
+  /**
+   * @brief  Processing function for the Q15 Goertzel bank.
+   * @param[in]  *S points to an instance of the Q15 Goertzel bank structure.
+   * @param[in]  *pSrc points to the frame of frameLen input samples.
+   * @param[out] *pDst points to the complex DFT values of the bins, 2*numBins values.
+   * @return none.
+   */
+
+  void arm_goertzel_q15(
+  arm_goertzel_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of bins. */
+    uint16_t frameLen;                 /**< length of the sliding window, in samples. */
+    uint16_t delayIndex;               /**< position of the oldest sample in the delay line. */
+    float32_t combCoeff;               /**< damping factor raised to the power frameLen. */
+    float32_t *pCoeffs;                /**< points to the coefficients, the damped and the undamped rotation of each bin. The array is of length 4*numBins. */
+    float32_t *pState;                 /**< points to the state of the resonators, 2*numBins values. */
+    float32_t *pDelay;                 /**< points to the delay line of frameLen samples. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[out] *S points to an instance of the floating-point sliding DFT structure.
+   * @param[in]  numBins number of bins.
+   * @param[in]  frameLen length of the sliding window, in samples.
+   * @param[in]  *pBins points to the bin indices, numBins values below frameLen.
+   * @param[in]  damping damping factor of the resonators, in (0 1].
+   * @param[out] *pCoeffs points to the coefficient buffer of 4*numBins values.
+   * @param[in]  *pState points to the state buffer of 2*numBins values.
+   * @param[in]  *pDelay points to the delay line of frameLen samples.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numBins</code> or <code>frameLen</code> is zero, a bin index is not below <code>frameLen</code>
+   * or <code>damping</code> is out of range.
+   */
+
+  arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const uint16_t * pBins,
+  float32_t damping,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pDelay);
+
+  /**
+   * @brief  Processing function for the floating-point sliding DFT.
+   * @param[in,out] *S points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[out]    *pDst points to the complex DFT values of the bins after the last sample, 2*numBins values, or NULL.
+   * @param[in]     blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of bins. */
+    uint16_t frameLen;                 /**< length of the sliding window, in samples. */
+    uint16_t delayIndex;               /**< position of the oldest sample in the delay line. */
+    uint8_t shift;                     /**< log2 of the output scaling, the smallest power of 2 not below frameLen and 4. */
+    q31_t combCoeff;                   /**< damping factor raised to the power frameLen. */
+    q31_t *pCoeffs;                    /**< points to the coefficients, the damped and the undamped rotation of each bin. The array is of length 4*numBins. */
+    q31_t *pState;                     /**< points to the state of the resonators, 2*numBins values. */
+    q31_t *pDelay;                     /**< points to the delay line of frameLen samples. */
+  } arm_sdft_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 sliding DFT.
+   * @param[out] *S points to an instance of the Q31 sliding DFT structure.
+   * @param[in]  numBins number of bins.
+   * @param[in]  frameLen length of the sliding window, in samples.
+   * @param[in]  *pBins points to the bin indices, numBins values below frameLen.
+   * @param[in]  damping damping factor of the resonators, in (0 1], in 1.31 format.
+   * @param[out] *pCoeffs points to the coefficient buffer of 4*numBins values.
+   * @param[in]  *pState points to the state buffer of 2*numBins values.
+   * @param[in]  *pDelay points to the delay line of frameLen samples.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numBins</code> or <code>frameLen</code> is zero, a bin index is not below <code>frameLen</code>
+   * or <code>damping</code> is out of range.
+   */
+
+  arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const uint16_t * pBins,
+  q31_t damping,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pDelay);
+
+  /**
+   * @brief  Processing function for the Q31 sliding DFT.
+   * @param[in,out] *S points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[out]    *pDst points to the complex DFT values of the bins after the last sample, 2*numBins values, or NULL.
+   * @param[in]     blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 sliding DFT.
+   */
+
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of bins. */
+    uint16_t frameLen;                 /**< length of the sliding window, in samples. */
+    uint16_t delayIndex;               /**< position of the oldest sample in the delay line. */
+    uint8_t shift;                     /**< log2 of the output scaling, the smallest power of 2 not below frameLen and 4. */
+    q31_t combCoeff;                   /**< damping factor raised to the power frameLen. */
+    q31_t *pCoeffs;                    /**< points to the coefficients, the damped and the undamped rotation of each bin. The array is of length 4*numBins. */
+    q31_t *pState;                     /**< points to the state of the resonators, 2*numBins values. */
+    q15_t *pDelay;                     /**< points to the delay line of frameLen samples. */
+  } arm_sdft_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 sliding DFT.
+   * @param[out] *S points to an instance of the Q15 sliding DFT structure.
+   * @param[in]  numBins number of bins.
+   * @param[in]  frameLen length of the sliding window, in samples.
+   * @param[in]  *pBins points to the bin indices, numBins values below frameLen.
+   * @param[in]  damping damping factor of the resonators, in (0 1], in 1.31 format.
+   * @param[out] *pCoeffs points to the coefficient buffer of 4*numBins values.
+   * @param[in]  *pState points to the state buffer of 2*numBins values.
+   * @param[in]  *pDelay points to the delay line of frameLen samples.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numBins</code> or <code>frameLen</code> is zero, a bin index is not below <code>frameLen</code>
+   * or <code>damping</code> is out of range.
+   */
+
+  arm_status arm_sdft_init_q15(
+  arm_sdft_instance_q15 * S,
+  uint16_t numBins,
+  uint16_t frameLen,
+  const uint16_t * pBins,
+  q31_t damping,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q15_t * pDelay);
+
+  /**
+   * @brief  Processing function for the Q15 sliding DFT.
+   * @param[in,out] *S points to an instance of the Q15 sliding DFT structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[out]    *pDst points to the complex DFT values of the bins after the last sample, 2*numBins values, or NULL.
+   * @param[in]     blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_sdft_q15(
+  arm_sdft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point partitioned fast convolution FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;                 /**< number of filter coefficients in the filter. */
+    uint16_t partSize;                /**< length of a partition of the impulse response. */
+    uint16_t numParts;                /**< number of partitions. */
+    uint16_t fdlIndex;                /**< slot of the newest spectrum in the frequency domain delay line. */
+    float32_t *pState;                /**< points to the state variable array. The array is of length 2*partSize*(numParts+3). */
+    float32_t *pCoeffsFreq;           /**< points to the spectra of the partitions. The array is of length 2*partSize*numParts. */
+    arm_rfft_fast_instance_f32 rfft;  /**< real FFT of 2*partSize points. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point partitioned fast convolution FIR filter.
+   * @param[in] *S points to an instance of the floating-point partitioned fast convolution FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process, a multiple of partSize.
+   * @return none.
+   */
+  void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned fast convolution FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point partitioned fast convolution FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter.
+   * @param[in] *pCoeffs points to the filter coefficients, in time reversed order.
+   * @param[out] *pCoeffsFreq points to the buffer that receives the spectra of the partitions.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] partSize length of a partition, from 16 to 2048 in powers of 2, or 4096 with ARM_MATH_RFFT_8192.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>partSize</code> is not supported.
+   */
+  arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pCoeffsFreq,
+  float32_t * pState,
+  uint16_t partSize);
+
+  /**
+   * @brief Instance structure for the floating-point DCT4/IDCT4 function.
+   */
+
+  typedef struct
+  {
+    uint16_t N;                         /**< length of the DCT4. */
+    uint16_t Nby2;                      /**< half of the length of the DCT4. */
+    float32_t normalize;                /**< normalizing factor. */
+    float32_t *pTwiddle;                /**< points to the twiddle factor table. */
+    float32_t *pCosFactor;              /**< points to the cosFactor table. */
+    arm_rfft_instance_f32 *pRfft;        /**< points to the real FFT instance. */
+    arm_cfft_radix4_instance_f32 *pCfft; /**< points to the complex FFT instance. */
+  } arm_dct4_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point DCT4/IDCT4.
+   * @param[in,out] *S         points to an instance of floating-point DCT4/IDCT4 structure.
+   * @param[in]     *S_RFFT    points to an instance of floating-point RFFT/RIFFT structure.
+   * @param[in]     *S_CFFT    points to an instance of floating-point CFFT/CIFFT structure.
+   * @param[in]     N          length of the DCT4.
+   * @param[in]     Nby2       half of the length of the DCT4.
+   * @param[in]     normalize  normalizing factor.
+   * @return		arm_status function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLenReal</code> is not a supported transform length.
+   */
+
+  arm_status arm_dct4_init_f32(
+  arm_dct4_instance_f32 * S,
+  arm_rfft_instance_f32 * S_RFFT,
+  arm_cfft_radix4_instance_f32 * S_CFFT,
+  uint16_t N,
+  uint16_t Nby2,
+  float32_t normalize);
+
+  /**
+   * @brief Processing function for the floating-point DCT4/IDCT4.
    * @param[in]       *S             points to an instance of the floating-point DCT4/IDCT4 structure.
    * @param[in]       *pState        points to state buffer.
    * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
@@ -2631,6 +3474,21 @@ void arm_rfft_fast_f32(
   uint32_t blockSize,
   float32_t * result);
 
+  /**
+   * @brief Dot product of double-precision floating-point vectors.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
+   */
+
+  void arm_dot_prod_f64(
+  float64_t * pSrcA,
+  float64_t * pSrcB,
+  uint32_t blockSize,
+  float64_t * result);
+
   /**
    * @brief Dot product of Q7 vectors.
    * @param[in]       *pSrcA points to the first input vector
@@ -2944,6 +3802,24 @@ void arm_rfft_fast_f32(
   uint32_t srcBLen,
   float32_t * pDst);
 
+  /**
+   * @brief Convolution of floating-point sequences, in direct or FFT form.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.
+   * @param[in] *pScratch points to a scratch buffer of 3*fftLen words, fftLen being the power of 2 from 32 to 8192 (4096 without ARM_MATH_RFFT_8192) not less than srcALen+srcBLen-1.
+   * @return none.
+   */
+  void arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch);
+
 
   /**
    * @brief Convolution of Q15 sequences.
@@ -2985,6 +3861,24 @@ void arm_rfft_fast_f32(
   uint32_t srcBLen,
   q15_t * pDst);
 
+  /**
+   * @brief Convolution of Q15 sequences, in direct or FFT form.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.
+   * @param[in] *pScratch points to a scratch buffer of 3*fftLen words, fftLen being the power of 2 from 32 to 8192 (4096 without ARM_MATH_RFFT_8192) not less than srcALen+srcBLen-1.
+   * @return none.
+   */
+  void arm_conv_fft_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  float32_t * pScratch);
+
   /**
    * @brief Convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
    * @param[in] *pSrcA points to the first input sequence.
@@ -3636,54 +4530,249 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   * @brief Instance structure for the Q15 FIR rational resampler.
    */
 
   typedef struct
   {
-    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
-
-  } arm_biquad_cas_df1_32x64_ins_q31;
-
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q15;
 
   /**
-   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
+   * @brief Processing function for the Q15 FIR rational resampler.
+   * @param[in] *S points to an instance of the Q15 FIR resampler structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data, of length blockSize*L/M.
+   * @param[in] blockSize number of input samples to process, a multiple of M.
    * @return none.
    */
-
-  void arm_biquad_cas_df1_32x64_q31(
-  const arm_biquad_cas_df1_32x64_ins_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
+  void arm_fir_resample_q15(
+  const arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
+  /**
+   * @brief  Initialization function for the Q15 FIR rational resampler.
+   * @param[in,out] *S points to an instance of the Q15 FIR resampler structure.
+   * @param[in] L upsample factor.
+   * @param[in] M downsample factor.
+   * @param[in] numTaps number of filter coefficients in the filter, a multiple of L.
+   * @param[in] *pCoeffs points to the filter coefficient buffer.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call, a multiple of M.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_LENGTH_ERROR if
+   * <code>numTaps</code> is not a multiple of <code>L</code> or <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
 
   /**
-   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
-   * @return        none
+   * @brief Instance structure for the Q31 FIR rational resampler.
    */
 
-  void arm_biquad_cas_df1_32x64_init_q31(
-  arm_biquad_cas_df1_32x64_ins_q31 * S,
-  uint8_t numStages,
-  q31_t * pCoeffs,
-  q63_t * pState,
-  uint8_t postShift);
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q31;
 
+  /**
+   * @brief Processing function for the Q31 FIR rational resampler.
+   * @param[in] *S points to an instance of the Q31 FIR resampler structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data, of length blockSize*L/M.
+   * @param[in] blockSize number of input samples to process, a multiple of M.
+   * @return none.
+   */
+  void arm_fir_resample_q31(
+  const arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
+  /**
+   * @brief  Initialization function for the Q31 FIR rational resampler.
+   * @param[in,out] *S points to an instance of the Q31 FIR resampler structure.
+   * @param[in] L upsample factor.
+   * @param[in] M downsample factor.
+   * @param[in] numTaps number of filter coefficients in the filter, a multiple of L.
+   * @param[in] *pCoeffs points to the filter coefficient buffer.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call, a multiple of M.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_LENGTH_ERROR if
+   * <code>numTaps</code> is not a multiple of <code>L</code> or <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+  arm_status arm_fir_resample_init_q31(
+  arm_fir_resample_instance_q31 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Instance structure for the floating-point FIR rational resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point FIR rational resampler.
+   * @param[in] *S points to an instance of the floating-point FIR resampler structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data, of length blockSize*L/M.
+   * @param[in] blockSize number of input samples to process, a multiple of M.
+   * @return none.
+   */
+  void arm_fir_resample_f32(
+  const arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR rational resampler.
+   * @param[in,out] *S points to an instance of the floating-point FIR resampler structure.
+   * @param[in] L upsample factor.
+   * @param[in] M downsample factor.
+   * @param[in] numTaps number of filter coefficients in the filter, a multiple of L.
+   * @param[in] *pCoeffs points to the filter coefficient buffer.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call, a multiple of M.
+   * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_LENGTH_ERROR if
+   * <code>numTaps</code> is not a multiple of <code>L</code> or <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point Farrow fractional resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t stepInt;               /**< integer part of the step, in input samples per output sample. */
+    uint32_t stepFrac;              /**< fractional part of the step, in units of 2^-32. */
+    uint32_t frac;                  /**< fractional position of the next output sample, in units of 2^-32. */
+    uint32_t index;                 /**< index in the state buffer of the sample before the next output sample. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+3. */
+  } arm_farrow_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point Farrow fractional resampler.
+   * @param[in,out] *S points to an instance of the floating-point Farrow resampler structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of input samples to process.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_farrow_f32(
+  arm_farrow_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Sets the step of the floating-point Farrow fractional resampler.
+   * @param[in,out] *S points to an instance of the floating-point Farrow resampler structure.
+   * @param[in] step number of input samples per output sample.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>step</code> is out of range.
+   */
+  arm_status arm_farrow_set_step_f32(
+  arm_farrow_instance_f32 * S,
+  float32_t step);
+
+  /**
+   * @brief  Initialization function for the floating-point Farrow fractional resampler.
+   * @param[in,out] *S points to an instance of the floating-point Farrow resampler structure.
+   * @param[in] step number of input samples per output sample.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize largest number of input samples processed per call.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>step</code> is out of range.
+   */
+  arm_status arm_farrow_init_f32(
+  arm_farrow_instance_f32 * S,
+  float32_t step,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+
+  } arm_biquad_cas_df1_32x64_ins_q31;
+
+
+  /**
+   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_biquad_cas_df1_32x64_q31(
+  const arm_biquad_cas_df1_32x64_ins_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cas_df1_32x64_init_q31(
+  arm_biquad_cas_df1_32x64_ins_q31 * S,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  q63_t * pState,
+  uint8_t postShift);
+
+
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
    */
 
   typedef struct
@@ -3693,6 +4782,17 @@ void arm_rfft_fast_f32(
     float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
   } arm_biquad_cascade_df2T_instance_f32;
 
+  /**
+   * @brief Instance structure for the double-precision floating-point transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float64_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float64_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_instance_f64;
+
 
   /**
    * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
@@ -3725,6 +4825,80 @@ void arm_rfft_fast_f32(
   float32_t * pCoeffs,
   float32_t * pState);
 
+  /**
+   * @brief Processing function for the double-precision floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df2T_f64(
+  const arm_biquad_cascade_df2T_instance_f64 * S,
+  float64_t * pSrc,
+  float64_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the double-precision floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df2T_init_f64(
+  arm_biquad_cascade_df2T_instance_f64 * S,
+  uint8_t numStages,
+  float64_t * pCoeffs,
+  float64_t * pState);
+
+  /**
+   * @brief Instance structure for the floating-point interleaved multichannel transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;    /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChans;    /**< number of interleaved channels. */
+    float32_t *pState;    /**< points to the array of state coefficients.  The array is of length 2*numStages*numChans. */
+    float32_t *pCoeffs;   /**< points to the array of coefficients, shared by the channels.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_interleaved_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point interleaved multichannel transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input frames.
+   * @param[out] *pDst     points to the block of output frames.
+   * @param[in]  blockSize number of frames to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df2T_interleaved_f32(
+  const arm_biquad_cascade_df2T_interleaved_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point interleaved multichannel transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChans     number of interleaved channels.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df2T_interleaved_init_f32(
+  arm_biquad_cascade_df2T_interleaved_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChans,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
 
 
   /**
@@ -4331,6 +5505,24 @@ void arm_rfft_fast_f32(
   uint32_t srcBLen,
   float32_t * pDst);
 
+  /**
+   * @brief Correlation of floating-point sequences, in direct or FFT form.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in] *pScratch points to a scratch buffer of 3*fftLen words, fftLen being the power of 2 from 32 to 8192 (4096 without ARM_MATH_RFFT_8192) not less than srcALen+srcBLen-1.
+   * @return none.
+   */
+  void arm_correlate_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch);
+
 
    /**
    * @brief Correlation of Q15 sequences
@@ -4423,6 +5615,24 @@ void arm_rfft_fast_f32(
   uint32_t srcBLen,
   q31_t * pDst);
 
+  /**
+   * @brief Correlation of Q31 sequences, in direct or FFT form.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in] *pScratch points to a scratch buffer of 3*fftLen words, fftLen being the power of 2 from 32 to 8192 (4096 without ARM_MATH_RFFT_8192) not less than srcALen+srcBLen-1.
+   * @return none.
+   */
+  void arm_correlate_fft_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  float32_t * pScratch);
+
   /**
    * @brief Correlation of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
    * @param[in] *pSrcA points to the first input sequence.
@@ -5022,6 +6232,188 @@ void arm_rfft_fast_f32(
   const arm_matrix_instance_f32 * src,
   arm_matrix_instance_f32 * dst);
 
+  /**
+   * @brief Double-precision floating-point matrix inverse.
+   * @param[in]  *src points to the instance of the input double-precision floating-point matrix structure.
+   * @param[out] *dst points to the instance of the output double-precision floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+
+  arm_status arm_mat_inverse_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  *src points to the instance of the input symmetric positive definite matrix.
+   * @param[out] *dst points to the instance of the output lower triangular matrix, which may be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+  /**
+   * @brief Floating-point LDL^T decomposition with symmetric pivoting, P * A * P^T = L * D * L^T.
+   * @param[in]  *src points to the instance of the input symmetric positive semidefinite matrix.
+   * @param[out] *l points to the instance of the output unit lower triangular matrix, which may be src.
+   * @param[out] *d points to the instance of the output diagonal matrix.
+   * @param[out] *perm points to the output permutation: row i of P * A is row perm[i] of A.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive semidefinite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * l,
+  arm_matrix_instance_f32 * d,
+  uint16_t * perm);
+
+  /**
+   * @brief Floating-point QR decomposition.
+   * @param[in]  *src points to the instance of the input M x N matrix, M >= N.
+   * @param[out] *r points to the instance of the output M x N upper triangular matrix, which may be src.
+   * @param[out] *q points to the instance of the output M x M orthogonal matrix.
+   * @param[out] *tau points to a buffer of N scale factors of the Householder reflections.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+
+  arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * r,
+  arm_matrix_instance_f32 * q,
+  float32_t * tau);
+
+  /**
+   * @brief Floating-point solution of the lower triangular system T * X = B.
+   * @param[in]  *t points to the instance of the lower triangular matrix.
+   * @param[in]  *b points to the instance of the right-hand side matrix.
+   * @param[out] *x points to the instance of the solution matrix, which may be b.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of t is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * t,
+  const arm_matrix_instance_f32 * b,
+  arm_matrix_instance_f32 * x);
+
+  /**
+   * @brief Floating-point solution of the upper triangular system T * X = B.
+   * @param[in]  *t points to the instance of the upper triangular matrix.
+   * @param[in]  *b points to the instance of the right-hand side matrix.
+   * @param[out] *x points to the instance of the solution matrix, which may be b.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of t is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * t,
+  const arm_matrix_instance_f32 * b,
+  arm_matrix_instance_f32 * x);
+
+  /**
+   * @brief Floating-point solution of L * L^T * X = B with the Cholesky factor L.
+   * @param[in]  *t points to the instance of the Cholesky factor.
+   * @param[in]  *b points to the instance of the right-hand side matrix.
+   * @param[out] *x points to the instance of the solution matrix, which may be b.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of t is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+
+  arm_status arm_mat_solve_cholesky_f32(
+  const arm_matrix_instance_f32 * t,
+  const arm_matrix_instance_f32 * b,
+  arm_matrix_instance_f32 * x);
+
+  /**
+   * @brief Double-precision floating-point Cholesky decomposition.
+   * @param[in]  *src points to the instance of the input symmetric positive definite matrix.
+   * @param[out] *dst points to the instance of the output lower triangular matrix, which may be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+  /**
+   * @brief Double-precision floating-point LDL^T decomposition with symmetric pivoting, P * A * P^T = L * D * L^T.
+   * @param[in]  *src points to the instance of the input symmetric positive semidefinite matrix.
+   * @param[out] *l points to the instance of the output unit lower triangular matrix, which may be src.
+   * @param[out] *d points to the instance of the output diagonal matrix.
+   * @param[out] *perm points to the output permutation: row i of P * A is row perm[i] of A.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive semidefinite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+
+  arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * l,
+  arm_matrix_instance_f64 * d,
+  uint16_t * perm);
+
+  /**
+   * @brief Double-precision floating-point QR decomposition.
+   * @param[in]  *src points to the instance of the input M x N matrix, M >= N.
+   * @param[out] *r points to the instance of the output M x N upper triangular matrix, which may be src.
+   * @param[out] *q points to the instance of the output M x M orthogonal matrix.
+   * @param[out] *tau points to a buffer of N scale factors of the Householder reflections.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+
+  arm_status arm_mat_qr_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * r,
+  arm_matrix_instance_f64 * q,
+  float64_t * tau);
+
+  /**
+   * @brief Double-precision floating-point solution of the lower triangular system T * X = B.
+   * @param[in]  *t points to the instance of the lower triangular matrix.
+   * @param[in]  *b points to the instance of the right-hand side matrix.
+   * @param[out] *x points to the instance of the solution matrix, which may be b.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of t is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+
+  arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * t,
+  const arm_matrix_instance_f64 * b,
+  arm_matrix_instance_f64 * x);
+
+  /**
+   * @brief Double-precision floating-point solution of the upper triangular system T * X = B.
+   * @param[in]  *t points to the instance of the upper triangular matrix.
+   * @param[in]  *b points to the instance of the right-hand side matrix.
+   * @param[out] *x points to the instance of the solution matrix, which may be b.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of t is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+
+  arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * t,
+  const arm_matrix_instance_f64 * b,
+  arm_matrix_instance_f64 * x);
+
+  /**
+   * @brief Double-precision floating-point solution of L * L^T * X = B with the Cholesky factor L.
+   * @param[in]  *t points to the instance of the Cholesky factor.
+   * @param[in]  *b points to the instance of the right-hand side matrix.
+   * @param[out] *x points to the instance of the solution matrix, which may be b.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of t is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+
+  arm_status arm_mat_solve_cholesky_f64(
+  const arm_matrix_instance_f64 * t,
+  const arm_matrix_instance_f64 * b,
+  arm_matrix_instance_f64 * x);
+
 
 
   /**
@@ -5916,16 +7308,343 @@ void arm_rfft_fast_f32(
    * @} end of SQRT group
    */
 
-
-
-
-
-
   /**
-   * @brief floating-point Circular write function.
+   * @brief  Sine of the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector, in radians
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
    */
+  void arm_vsin_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
-  static __INLINE void arm_circularWrite_f32(
+  /**
+   * @brief  Sine of the elements of a Q31 vector.
+   * @param[in]  *pSrc points to the input vector, [0 +0.9999] mapping to [0 2*pi)
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+  void arm_vsin_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Sine of the elements of a Q15 vector.
+   * @param[in]  *pSrc points to the input vector, [0 +0.9999] mapping to [0 2*pi)
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+  void arm_vsin_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Cosine of the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector, in radians
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+  void arm_vcos_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Cosine of the elements of a Q31 vector.
+   * @param[in]  *pSrc points to the input vector, [0 +0.9999] mapping to [0 2*pi)
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+  void arm_vcos_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Cosine of the elements of a Q15 vector.
+   * @param[in]  *pSrc points to the input vector, [0 +0.9999] mapping to [0 2*pi)
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+  void arm_vcos_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Four-quadrant arctangent of the elements of floating-point vectors.
+   * @param[in]  *pSrcY points to the vector of ordinates (imaginary parts)
+   * @param[in]  *pSrcX points to the vector of abscissas (real parts)
+   * @param[out] *pDst points to the output vector, in radians
+   * @param[in]  blockSize number of samples in the vectors
+   * @return none.
+   */
+  void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Four-quadrant arctangent of the elements of Q31 vectors.
+   * @param[in]  *pSrcY points to the vector of ordinates (imaginary parts)
+   * @param[in]  *pSrcX points to the vector of abscissas (real parts)
+   * @param[out] *pDst points to the output vector, [-1 +1) mapping to [-pi pi)
+   * @param[in]  blockSize number of samples in the vectors
+   * @return none.
+   */
+  void arm_vatan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Four-quadrant arctangent of the elements of Q15 vectors.
+   * @param[in]  *pSrcY points to the vector of ordinates (imaginary parts)
+   * @param[in]  *pSrcX points to the vector of abscissas (real parts)
+   * @param[out] *pDst points to the output vector, [-1 +1) mapping to [-pi pi)
+   * @param[in]  blockSize number of samples in the vectors
+   * @return none.
+   */
+  void arm_vatan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Exponential of the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+  void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Natural logarithm of the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+  void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Square root of the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out] *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is negative or NaN, with a zero output.
+   */
+  arm_status arm_vsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point NCO.
+   */
+  typedef struct
+  {
+    uint32_t phase;             /**< phase accumulator, with 2^32 steps per turn. */
+    uint32_t phaseInc;          /**< phase increment per sample, frequency / sampling frequency * 2^32. */
+    uint32_t ditherMask;        /**< mask of the dither bits added to the phase, 0 without dither. */
+    uint32_t ditherState;       /**< state of the dither generator. */
+  } arm_nco_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point NCO.
+   * @param[out] *S points to an instance of the floating-point NCO structure.
+   * @param[in]  phaseInc phase increment per sample, frequency / sampling frequency * 2^32.
+   * @param[in]  phase initial phase, with 2^32 steps per turn.
+   * @param[in]  ditherBits number of dither bits added to the phase, 0 to 23; 0 disables the dither.
+   * @return none.
+   */
+  void arm_nco_init_f32(
+  arm_nco_instance_f32 * S,
+  uint32_t phaseInc,
+  uint32_t phase,
+  uint8_t ditherBits);
+
+  /**
+   * @brief  Floating-point NCO.
+   * @param[in,out] *S points to an instance of the floating-point NCO structure.
+   * @param[in]     *pFreqMod points to the frequency modulation, added to the phase increment, or NULL.
+   * @param[in]     *pPhaseMod points to the phase modulation, added to the phase of each sample, or NULL.
+   * @param[out]    *pSin points to the block of sine samples, or NULL.
+   * @param[out]    *pCos points to the block of cosine samples, or NULL.
+   * @param[in]     blockSize number of samples to generate.
+   * @return none.
+   */
+  void arm_nco_f32(
+  arm_nco_instance_f32 * S,
+  q31_t * pFreqMod,
+  q31_t * pPhaseMod,
+  float32_t * pSin,
+  float32_t * pCos,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point NCO with a complex output.
+   * @param[in,out] *S points to an instance of the floating-point NCO structure.
+   * @param[in]     *pFreqMod points to the frequency modulation, added to the phase increment, or NULL.
+   * @param[in]     *pPhaseMod points to the phase modulation, added to the phase of each sample, or NULL.
+   * @param[out]    *pDst points to the block of complex samples cos(theta) + j*sin(theta), of 2*blockSize values.
+   * @param[in]     blockSize number of complex samples to generate.
+   * @return none.
+   */
+  void arm_nco_cmplx_f32(
+  arm_nco_instance_f32 * S,
+  q31_t * pFreqMod,
+  q31_t * pPhaseMod,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 NCO.
+   */
+  typedef struct
+  {
+    uint32_t phase;             /**< phase accumulator, with 2^32 steps per turn. */
+    uint32_t phaseInc;          /**< phase increment per sample, frequency / sampling frequency * 2^32. */
+    uint32_t ditherMask;        /**< mask of the dither bits added to the phase, 0 without dither. */
+    uint32_t ditherState;       /**< state of the dither generator. */
+  } arm_nco_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 NCO.
+   * @param[out] *S points to an instance of the Q31 NCO structure.
+   * @param[in]  phaseInc phase increment per sample, frequency / sampling frequency * 2^32.
+   * @param[in]  phase initial phase, with 2^32 steps per turn.
+   * @param[in]  ditherBits number of dither bits added to the phase, 0 to 23; 0 disables the dither.
+   * @return none.
+   */
+  void arm_nco_init_q31(
+  arm_nco_instance_q31 * S,
+  uint32_t phaseInc,
+  uint32_t phase,
+  uint8_t ditherBits);
+
+  /**
+   * @brief  Q31 NCO.
+   * @param[in,out] *S points to an instance of the Q31 NCO structure.
+   * @param[in]     *pFreqMod points to the frequency modulation, added to the phase increment, or NULL.
+   * @param[in]     *pPhaseMod points to the phase modulation, added to the phase of each sample, or NULL.
+   * @param[out]    *pSin points to the block of sine samples, or NULL.
+   * @param[out]    *pCos points to the block of cosine samples, or NULL.
+   * @param[in]     blockSize number of samples to generate.
+   * @return none.
+   */
+  void arm_nco_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pFreqMod,
+  q31_t * pPhaseMod,
+  q31_t * pSin,
+  q31_t * pCos,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q31 NCO with a complex output.
+   * @param[in,out] *S points to an instance of the Q31 NCO structure.
+   * @param[in]     *pFreqMod points to the frequency modulation, added to the phase increment, or NULL.
+   * @param[in]     *pPhaseMod points to the phase modulation, added to the phase of each sample, or NULL.
+   * @param[out]    *pDst points to the block of complex samples cos(theta) + j*sin(theta), of 2*blockSize values.
+   * @param[in]     blockSize number of complex samples to generate.
+   * @return none.
+   */
+  void arm_nco_cmplx_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pFreqMod,
+  q31_t * pPhaseMod,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 NCO.
+   */
+  typedef struct
+  {
+    uint32_t phase;             /**< phase accumulator, with 2^32 steps per turn. */
+    uint32_t phaseInc;          /**< phase increment per sample, frequency / sampling frequency * 2^32. */
+    uint32_t ditherMask;        /**< mask of the dither bits added to the phase, 0 without dither. */
+    uint32_t ditherState;       /**< state of the dither generator. */
+  } arm_nco_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 NCO.
+   * @param[out] *S points to an instance of the Q15 NCO structure.
+   * @param[in]  phaseInc phase increment per sample, frequency / sampling frequency * 2^32.
+   * @param[in]  phase initial phase, with 2^32 steps per turn.
+   * @param[in]  ditherBits number of dither bits added to the phase, 0 to 23; 0 disables the dither.
+   * @return none.
+   */
+  void arm_nco_init_q15(
+  arm_nco_instance_q15 * S,
+  uint32_t phaseInc,
+  uint32_t phase,
+  uint8_t ditherBits);
+
+  /**
+   * @brief  Q15 NCO.
+   * @param[in,out] *S points to an instance of the Q15 NCO structure.
+   * @param[in]     *pFreqMod points to the frequency modulation, added to the phase increment, or NULL.
+   * @param[in]     *pPhaseMod points to the phase modulation, added to the phase of each sample, or NULL.
+   * @param[out]    *pSin points to the block of sine samples, or NULL.
+   * @param[out]    *pCos points to the block of cosine samples, or NULL.
+   * @param[in]     blockSize number of samples to generate.
+   * @return none.
+   */
+  void arm_nco_q15(
+  arm_nco_instance_q15 * S,
+  q31_t * pFreqMod,
+  q31_t * pPhaseMod,
+  q15_t * pSin,
+  q15_t * pCos,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q15 NCO with a complex output.
+   * @param[in,out] *S points to an instance of the Q15 NCO structure.
+   * @param[in]     *pFreqMod points to the frequency modulation, added to the phase increment, or NULL.
+   * @param[in]     *pPhaseMod points to the phase modulation, added to the phase of each sample, or NULL.
+   * @param[out]    *pDst points to the block of complex samples cos(theta) + j*sin(theta), of 2*blockSize values.
+   * @param[in]     blockSize number of complex samples to generate.
+   * @return none.
+   */
+  void arm_nco_cmplx_q15(
+  arm_nco_instance_q15 * S,
+  q31_t * pFreqMod,
+  q31_t * pPhaseMod,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+
+
+
+
+  /**
+   * @brief floating-point Circular write function.
+   */
+
+  static __INLINE void arm_circularWrite_f32(
   int32_t * circBuffer,
   int32_t L,
   uint16_t * writeOffset,
@@ -5982,12 +7701,13 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0u;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6000,7 +7720,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (int32_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6082,13 +7802,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6101,7 +7822,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q15_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6184,13 +7905,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6203,7 +7925,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q7_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6251,6 +7973,19 @@ void arm_rfft_fast_f32(
   uint32_t blockSize,
   float32_t * pResult);
 
+  /**
+   * @brief  Sum of the squares of the elements of a double-precision floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_power_f64(
+  float64_t * pSrc,
+  uint32_t blockSize,
+  float64_t * pResult);
+
   /**
    * @brief  Sum of the squares of the elements of a Q15 vector.
    * @param[in]  *pSrc is input pointer
@@ -6326,6 +8061,18 @@ void arm_rfft_fast_f32(
   uint32_t blockSize,
   float32_t * pResult);
 
+  /**
+   * @brief  Mean value of a double-precision floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+  void arm_mean_f64(
+  float64_t * pSrc,
+  uint32_t blockSize,
+  float64_t * pResult);
+
   /**
    * @brief  Variance of the elements of a floating-point vector.
    * @param[in]  *pSrc is input pointer
@@ -6339,6 +8086,19 @@ void arm_rfft_fast_f32(
   uint32_t blockSize,
   float32_t * pResult);
 
+  /**
+   * @brief  Variance of the elements of a double-precision floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_var_f64(
+  float64_t * pSrc,
+  uint32_t blockSize,
+  float64_t * pResult);
+
   /**
    * @brief  Variance of the elements of a Q31 vector.
    * @param[in]  *pSrc is input pointer
@@ -6378,6 +8138,19 @@ void arm_rfft_fast_f32(
   uint32_t blockSize,
   float32_t * pResult);
 
+  /**
+   * @brief  Root Mean Square of the elements of a double-precision floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_rms_f64(
+  float64_t * pSrc,
+  uint32_t blockSize,
+  float64_t * pResult);
+
   /**
    * @brief  Root Mean Square of the elements of a Q31 vector.
    * @param[in]  *pSrc is input pointer
@@ -6417,6 +8190,19 @@ void arm_rfft_fast_f32(
   uint32_t blockSize,
   float32_t * pResult);
 
+  /**
+   * @brief  Standard deviation of the elements of a double-precision floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_std_f64(
+  float64_t * pSrc,
+  uint32_t blockSize,
+  float64_t * pResult);
+
   /**
    * @brief  Standard deviation of the elements of a Q31 vector.
    * @param[in]  *pSrc is input pointer
@@ -6697,6 +8483,192 @@ void arm_rfft_fast_f32(
   float32_t * pResult,
   uint32_t * pIndex);
 
+  /**
+   * @brief Instance structure for the floating-point streaming statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;             /**< number of samples accumulated. */
+    float32_t mean;             /**< mean of the samples. */
+    float32_t m2;               /**< sum of the squared deviations from the mean. */
+    float32_t min;              /**< minimum value. */
+    float32_t max;              /**< maximum value. */
+    uint32_t minIndex;          /**< index of the first occurrence of the minimum value. */
+    uint32_t maxIndex;          /**< index of the first occurrence of the maximum value. */
+  } arm_stats_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point streaming statistics.
+   * @param[out] *S points to an instance of the floating-point streaming statistics structure.
+   * @return none.
+   */
+  void arm_stats_init_f32(
+  arm_stats_instance_f32 * S);
+
+  /**
+   * @brief  Accumulates a block of floating-point samples into the streaming statistics.
+   * @param[in,out] *S points to an instance of the floating-point streaming statistics structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+  void arm_stats_update_f32(
+  arm_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Merges two floating-point streaming statistics.
+   * @param[in,out] *S points to the statistics of the first samples, which receives the merged statistics.
+   * @param[in]     *pSrc points to the statistics of the samples that follow.
+   * @return none.
+   */
+  void arm_stats_merge_f32(
+  arm_stats_instance_f32 * S,
+  const arm_stats_instance_f32 * pSrc);
+
+  /**
+   * @brief  Computes the floating-point statistics of the accumulated samples.
+   * @param[in]  *S points to an instance of the floating-point streaming statistics structure.
+   * @param[out] *pMean mean value returned here, or NULL.
+   * @param[out] *pVar variance returned here, or NULL.
+   * @param[out] *pStd standard deviation returned here, or NULL.
+   * @param[out] *pRms RMS value returned here, or NULL.
+   * @param[out] *pPower sum of the squares of the samples returned here, or NULL.
+   * @return none.
+   */
+  void arm_stats_get_f32(
+  const arm_stats_instance_f32 * S,
+  float32_t * pMean,
+  float32_t * pVar,
+  float32_t * pStd,
+  float32_t * pRms,
+  float32_t * pPower);
+
+  /**
+   * @brief Instance structure for the Q31 streaming statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;             /**< number of samples accumulated. */
+    q63_t sum;                  /**< sum of the samples, in 33.31 format. */
+    q63_t sumSquare;            /**< sum of the squares of the samples, in 34.30 format. */
+    q31_t min;                  /**< minimum value. */
+    q31_t max;                  /**< maximum value. */
+    uint32_t minIndex;          /**< index of the first occurrence of the minimum value. */
+    uint32_t maxIndex;          /**< index of the first occurrence of the maximum value. */
+  } arm_stats_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 streaming statistics.
+   * @param[out] *S points to an instance of the Q31 streaming statistics structure.
+   * @return none.
+   */
+  void arm_stats_init_q31(
+  arm_stats_instance_q31 * S);
+
+  /**
+   * @brief  Accumulates a block of Q31 samples into the streaming statistics.
+   * @param[in,out] *S points to an instance of the Q31 streaming statistics structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+  void arm_stats_update_q31(
+  arm_stats_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Merges two Q31 streaming statistics.
+   * @param[in,out] *S points to the statistics of the first samples, which receives the merged statistics.
+   * @param[in]     *pSrc points to the statistics of the samples that follow.
+   * @return none.
+   */
+  void arm_stats_merge_q31(
+  arm_stats_instance_q31 * S,
+  const arm_stats_instance_q31 * pSrc);
+
+  /**
+   * @brief  Computes the Q31 statistics of the accumulated samples.
+   * @param[in]  *S points to an instance of the Q31 streaming statistics structure.
+   * @param[out] *pMean mean value returned here, or NULL.
+   * @param[out] *pVar variance returned here, or NULL.
+   * @param[out] *pStd standard deviation returned here, or NULL.
+   * @param[out] *pRms RMS value returned here, or NULL.
+   * @param[out] *pPower sum of the squares of the samples returned here, or NULL.
+   * @return none.
+   */
+  void arm_stats_get_q31(
+  const arm_stats_instance_q31 * S,
+  q31_t * pMean,
+  q31_t * pVar,
+  q31_t * pStd,
+  q31_t * pRms,
+  q63_t * pPower);
+
+  /**
+   * @brief Instance structure for the Q15 streaming statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;             /**< number of samples accumulated. */
+    q63_t sum;                  /**< sum of the samples, in 49.15 format. */
+    q63_t sumSquare;            /**< sum of the squares of the samples, in 34.30 format. */
+    q15_t min;                  /**< minimum value. */
+    q15_t max;                  /**< maximum value. */
+    uint32_t minIndex;          /**< index of the first occurrence of the minimum value. */
+    uint32_t maxIndex;          /**< index of the first occurrence of the maximum value. */
+  } arm_stats_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 streaming statistics.
+   * @param[out] *S points to an instance of the Q15 streaming statistics structure.
+   * @return none.
+   */
+  void arm_stats_init_q15(
+  arm_stats_instance_q15 * S);
+
+  /**
+   * @brief  Accumulates a block of Q15 samples into the streaming statistics.
+   * @param[in,out] *S points to an instance of the Q15 streaming statistics structure.
+   * @param[in]     *pSrc points to the block of input samples.
+   * @param[in]     blockSize number of samples in the block.
+   * @return none.
+   */
+  void arm_stats_update_q15(
+  arm_stats_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Merges two Q15 streaming statistics.
+   * @param[in,out] *S points to the statistics of the first samples, which receives the merged statistics.
+   * @param[in]     *pSrc points to the statistics of the samples that follow.
+   * @return none.
+   */
+  void arm_stats_merge_q15(
+  arm_stats_instance_q15 * S,
+  const arm_stats_instance_q15 * pSrc);
+
+  /**
+   * @brief  Computes the Q15 statistics of the accumulated samples.
+   * @param[in]  *S points to an instance of the Q15 streaming statistics structure.
+   * @param[out] *pMean mean value returned here, or NULL.
+   * @param[out] *pVar variance returned here, or NULL.
+   * @param[out] *pStd standard deviation returned here, or NULL.
+   * @param[out] *pRms RMS value returned here, or NULL.
+   * @param[out] *pPower sum of the squares of the samples returned here, or NULL.
+   * @return none.
+   */
+  void arm_stats_get_q15(
+  const arm_stats_instance_q15 * S,
+  q15_t * pMean,
+  q15_t * pVar,
+  q15_t * pStd,
+  q15_t * pRms,
+  q63_t * pPower);
+
   /**
    * @brief  Q15 complex-by-complex multiplication
    * @param[in]  *pSrcA points to the first input vector
@@ -7209,6 +9181,126 @@ void arm_rfft_fast_f32(
    * @} end of BilinearInterpolate group
    */
 
+#if defined (ARM_MATH_HOST)
+
+  /**
+   * @brief Job function of a batch: called with the context of the batch and the index of the job.
+   */
+  typedef void (*arm_batch_job) (void *pCtx, uint32_t job);
+
+  /**
+   * @brief Instance structure of the batch thread pool.
+   */
+  typedef struct
+  {
+    uint16_t numThreads;  /**< number of threads that run the jobs, including the calling thread. */
+    void *pPool;          /**< points to the thread pool, NULL for a single thread. */
+  } arm_batch_instance;
+
+  /**
+   * @brief  Initialization function for the batch thread pool.
+   * @param[out] *S points to an instance of the batch structure.
+   * @param[in]  numThreads number of threads, including the calling thread. 0 uses one thread per online CPU.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the threads could not be created.
+   */
+  arm_status arm_batch_init(
+  arm_batch_instance * S,
+  uint16_t numThreads);
+
+  /**
+   * @brief  Stops the threads of the batch thread pool and frees it.
+   * @param[in,out] *S points to an instance of the batch structure.
+   * @return none.
+   */
+  void arm_batch_deinit(
+  arm_batch_instance * S);
+
+  /**
+   * @brief  Runs a batch of independent jobs on the thread pool.
+   * @param[in] *S points to an instance of the batch structure.
+   * @param[in] pJob job function.
+   * @param[in] *pCtx context passed to the job function.
+   * @param[in] numJobs number of jobs.
+   * @return none.
+   */
+  void arm_batch_run(
+  const arm_batch_instance * S,
+  arm_batch_job pJob,
+  void *pCtx,
+  uint32_t numJobs);
+
+  /**
+   * @brief Processes a block of each of several channels with the floating-point FIR filter.
+   * @param[in] *B points to an instance of the batch structure.
+   * @param[in] *S points to an array of numChans FIR filter instances.
+   * @param[in] **ppSrc points to an array of numChans pointers to the input blocks.
+   * @param[out] **ppDst points to an array of numChans pointers to the output blocks.
+   * @param[in] numChans number of channels.
+   * @param[in] blockSize number of samples to process per channel.
+   * @return none.
+   */
+  void arm_fir_batch_f32(
+  const arm_batch_instance * B,
+  const arm_fir_instance_f32 * S,
+  float32_t ** ppSrc,
+  float32_t ** ppDst,
+  uint32_t numChans,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processes a block of each of several channels with the Q31 Biquad cascade filter.
+   * @param[in] *B points to an instance of the batch structure.
+   * @param[in] *S points to an array of numChans Biquad cascade instances.
+   * @param[in] **ppSrc points to an array of numChans pointers to the input blocks.
+   * @param[out] **ppDst points to an array of numChans pointers to the output blocks.
+   * @param[in] numChans number of channels.
+   * @param[in] blockSize number of samples to process per channel.
+   * @return none.
+   */
+  void arm_biquad_cascade_df1_batch_q31(
+  const arm_batch_instance * B,
+  const arm_biquad_casd_df1_inst_q31 * S,
+  q31_t ** ppSrc,
+  q31_t ** ppDst,
+  uint32_t numChans,
+  uint32_t blockSize);
+
+  /**
+   * @brief Computes the real FFT or inverse real FFT of each of several channels.
+   * @param[in] *B points to an instance of the batch structure.
+   * @param[in] *S points to an array of numChans real FFT instances.
+   * @param[in,out] **ppIn points to an array of numChans pointers to the input buffers.
+   * @param[out] **ppOut points to an array of numChans pointers to the output buffers.
+   * @param[in] ifftFlag 0 for the forward transforms, 1 for the inverse transforms.
+   * @param[in] numChans number of channels.
+   * @return none.
+   */
+  void arm_rfft_fast_batch_f32(
+  const arm_batch_instance * B,
+  arm_rfft_fast_instance_f32 * S,
+  float32_t ** ppIn,
+  float32_t ** ppOut,
+  uint8_t ifftFlag,
+  uint32_t numChans);
+
+  /**
+   * @brief Processes a block of frames with the floating-point interleaved FIR filter on the thread pool.
+   * @param[in] *B points to an instance of the batch structure.
+   * @param[in] *S points to an instance of the floating-point interleaved FIR structure.
+   * @param[in] *pSrc points to the block of input frames.
+   * @param[out] *pDst points to the block of output frames.
+   * @param[in] blockSize number of frames to process.
+   * @return none.
+   */
+  void arm_fir_interleaved_batch_f32(
+  const arm_batch_instance * B,
+  const arm_fir_interleaved_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+#endif /* #if defined (ARM_MATH_HOST) */
+
 
 #if   defined ( __CC_ARM ) //Keil
 //SMMLAR
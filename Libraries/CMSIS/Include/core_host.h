@@ -0,0 +1,533 @@
+/**************************************************************************//**
+ * @file     core_host.h
+ * @brief    CMSIS Cortex-M4 core and SIMD intrinsics in portable C, for a
+ *           host (PC) build of the CMSIS DSP Library
+ * @version  V3.20
+ * @date     25. February 2013
+ *
+ * @note
+ * Included by arm_math.h when ARM_MATH_HOST is defined.  The DSP library then
+ * builds with the Cortex-M4 code paths on a little endian PC (x86-64 Linux,
+ * GCC or Clang), so a kernel can be run, measured and compared with a
+ * reference off-target.  Every intrinsic of core_cmInstr.h used by the
+ * library and every intrinsic of core_cm4_simd.h gives the same result as
+ * the Cortex-M4 instruction.  The Q (saturation) flag is not modelled; the
+ * GE flags set by the parallel add/subtract intrinsics are kept for __SEL.
+ *
+ ******************************************************************************/
+/* Copyright (c) 2009 - 2013 ARM LIMITED
+
+   All rights reserved.
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+   - Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   - Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in the
+     documentation and/or other materials provided with the distribution.
+   - Neither the name of ARM nor the names of its contributors may be used
+     to endorse or promote products derived from this software without
+     specific prior written permission.
+   *
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS AND CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+   ---------------------------------------------------------------------------*/
+
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#ifndef __CORE_HOST_H
+#define __CORE_HOST_H
+
+#include <stdint.h>
+
+#if !defined ( __GNUC__ )
+  #error "ARM_MATH_HOST needs GCC or Clang"
+#endif
+
+#define __ASM            __asm                                      /*!< asm keyword for GNU Compiler          */
+#define __INLINE         inline                                     /*!< inline keyword for GNU Compiler       */
+#define __STATIC_INLINE  static inline
+
+#define __CORTEX_M       (0x04)                                     /*!< Code paths of the Cortex-M4           */
+#define __FPU_USED       0                                          /*!< Host floating point, not the M4 FPU   */
+
+
+/* ###################  Core Instructions  ########################### */
+/** \defgroup CMSIS_host_instr CMSIS host core instructions
+  Portable C versions of the core_cmInstr.h intrinsics
+  @{
+*/
+
+#define __NOP()                           do { } while (0)
+#define __ISB()                           __sync_synchronize()
+#define __DSB()                           __sync_synchronize()
+#define __DMB()                           __sync_synchronize()
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __REV(uint32_t value)
+{
+  return ((value >> 24) | ((value >> 8) & 0x0000FF00UL) | ((value << 8) & 0x00FF0000UL) | (value << 24));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __REV16(uint32_t value)
+{
+  return (((value >> 8) & 0x00FF00FFUL) | ((value << 8) & 0xFF00FF00UL));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE int32_t __REVSH(int32_t value)
+{
+  return ((int32_t)(int16_t)((((uint32_t)value & 0xFFUL) << 8) | (((uint32_t)value >> 8) & 0xFFUL)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  op2 &= 31U;
+  return ((op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2))));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __RBIT(uint32_t value)
+{
+  uint32_t result = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < 32U; i++)
+  {
+    result = (result << 1) | (value & 1U);
+    value >>= 1;
+  }
+  return(result);
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint8_t __CLZ(uint32_t value)
+{
+  return ((value == 0U) ? 32U : (uint8_t)__builtin_clz(value));
+}
+
+/** \brief  Signed saturation of a value to 'sat' bits (1..32) */
+__attribute__( ( always_inline ) ) __STATIC_INLINE int32_t __host_ssat(int64_t val, uint32_t sat)
+{
+  int64_t max = ((int64_t)1 << (sat - 1U)) - 1;
+
+  return ((int32_t)((val > max) ? max : ((val < -max - 1) ? (-max - 1) : val)));
+}
+
+/** \brief  Unsigned saturation of a value to 'sat' bits (0..31) */
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __host_usat(int64_t val, uint32_t sat)
+{
+  int64_t max = ((int64_t)1 << sat) - 1;
+
+  return ((uint32_t)((val > max) ? max : ((val < 0) ? 0 : val)));
+}
+
+#define __SSAT(ARG1,ARG2)                 __host_ssat((int32_t)(ARG1), (ARG2))
+#define __USAT(ARG1,ARG2)                 __host_usat((int32_t)(ARG1), (ARG2))
+
+/*@}*/ /* end of group CMSIS_host_instr */
+
+
+/* ###################  SIMD Intrinsics  ########################### */
+/** \defgroup CMSIS_host_SIMD CMSIS host SIMD intrinsics
+  Portable C versions of the core_cm4_simd.h intrinsics
+  @{
+*/
+
+/* Lane access: signed/unsigned byte 'n' (0..3) and halfword 'n' (0..1) of a word */
+#define __HOST_SB(X,N)                    ((int32_t)(int8_t)((uint32_t)(X) >> (8U * (N))))
+#define __HOST_UB(X,N)                    ((int32_t)(uint8_t)((uint32_t)(X) >> (8U * (N))))
+#define __HOST_SH(X,N)                    ((int32_t)(int16_t)((uint32_t)(X) >> (16U * (N))))
+#define __HOST_UH(X,N)                    ((int32_t)(uint16_t)((uint32_t)(X) >> (16U * (N))))
+
+/* Pack 4 bytes or 2 halfwords (only the low bits of each lane are kept) */
+#define __HOST_B4(B0,B1,B2,B3)            (  ((uint32_t)(B0) & 0xFFUL)        | (((uint32_t)(B1) & 0xFFUL) <<  8) | \
+                                           (((uint32_t)(B2) & 0xFFUL) << 16) | (((uint32_t)(B3) & 0xFFUL) << 24)  )
+#define __HOST_H2(H0,H1)                  (  ((uint32_t)(H0) & 0xFFFFUL)      | (((uint32_t)(H1) & 0xFFFFUL) << 16)  )
+
+/* APSR.GE flags of the last parallel add/subtract, read by __SEL() (one per translation unit).
+   A lane sets its flags when its result is >= 0: signed lanes and unsigned subtractions (no borrow)
+   test the difference, unsigned additions test for a carry out of the lane. */
+static uint32_t __host_ge __attribute__( ( unused ) );
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE void __host_ge8(int32_t r0, int32_t r1, int32_t r2, int32_t r3)
+{
+  __host_ge = ((r0 >= 0) ? 1U : 0U) | ((r1 >= 0) ? 2U : 0U) | ((r2 >= 0) ? 4U : 0U) | ((r3 >= 0) ? 8U : 0U);
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE void __host_ge16(int32_t r0, int32_t r1)
+{
+  __host_ge = ((r0 >= 0) ? 3U : 0U) | ((r1 >= 0) ? 12U : 0U);
+}
+
+/*------ 8 bit lanes -------------------------------------------------------------*/
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SADD8(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_SB(op1, 0) + __HOST_SB(op2, 0), r1 = __HOST_SB(op1, 1) + __HOST_SB(op2, 1);
+  int32_t r2 = __HOST_SB(op1, 2) + __HOST_SB(op2, 2), r3 = __HOST_SB(op1, 3) + __HOST_SB(op2, 3);
+
+  __host_ge8(r0, r1, r2, r3);
+  return(__HOST_B4(r0, r1, r2, r3));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __QADD8(uint32_t op1, uint32_t op2)
+{
+  return(__HOST_B4(__host_ssat(__HOST_SB(op1, 0) + __HOST_SB(op2, 0), 8U), __host_ssat(__HOST_SB(op1, 1) + __HOST_SB(op2, 1), 8U),
+                   __host_ssat(__HOST_SB(op1, 2) + __HOST_SB(op2, 2), 8U), __host_ssat(__HOST_SB(op1, 3) + __HOST_SB(op2, 3), 8U)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SHADD8(uint32_t op1, uint32_t op2)
+{
+  return(__HOST_B4((__HOST_SB(op1, 0) + __HOST_SB(op2, 0)) >> 1, (__HOST_SB(op1, 1) + __HOST_SB(op2, 1)) >> 1,
+                   (__HOST_SB(op1, 2) + __HOST_SB(op2, 2)) >> 1, (__HOST_SB(op1, 3) + __HOST_SB(op2, 3)) >> 1));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __UADD8(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_UB(op1, 0) + __HOST_UB(op2, 0), r1 = __HOST_UB(op1, 1) + __HOST_UB(op2, 1);
+  int32_t r2 = __HOST_UB(op1, 2) + __HOST_UB(op2, 2), r3 = __HOST_UB(op1, 3) + __HOST_UB(op2, 3);
+
+  __host_ge8((r0 >= 0x100) ? 0 : -1, (r1 >= 0x100) ? 0 : -1, (r2 >= 0x100) ? 0 : -1, (r3 >= 0x100) ? 0 : -1);
+  return(__HOST_B4(r0, r1, r2, r3));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __UQADD8(uint32_t op1, uint32_t op2)
+{
+  return(__HOST_B4(__host_usat(__HOST_UB(op1, 0) + __HOST_UB(op2, 0), 8U), __host_usat(__HOST_UB(op1, 1) + __HOST_UB(op2, 1), 8U),
+                   __host_usat(__HOST_UB(op1, 2) + __HOST_UB(op2, 2), 8U), __host_usat(__HOST_UB(op1, 3) + __HOST_UB(op2, 3), 8U)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __UHADD8(uint32_t op1, uint32_t op2)
+{
+  return(__HOST_B4((__HOST_UB(op1, 0) + __HOST_UB(op2, 0)) >> 1, (__HOST_UB(op1, 1) + __HOST_UB(op2, 1)) >> 1,
+                   (__HOST_UB(op1, 2) + __HOST_UB(op2, 2)) >> 1, (__HOST_UB(op1, 3) + __HOST_UB(op2, 3)) >> 1));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SSUB8(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_SB(op1, 0) - __HOST_SB(op2, 0), r1 = __HOST_SB(op1, 1) - __HOST_SB(op2, 1);
+  int32_t r2 = __HOST_SB(op1, 2) - __HOST_SB(op2, 2), r3 = __HOST_SB(op1, 3) - __HOST_SB(op2, 3);
+
+  __host_ge8(r0, r1, r2, r3);
+  return(__HOST_B4(r0, r1, r2, r3));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __QSUB8(uint32_t op1, uint32_t op2)
+{
+  return(__HOST_B4(__host_ssat(__HOST_SB(op1, 0) - __HOST_SB(op2, 0), 8U), __host_ssat(__HOST_SB(op1, 1) - __HOST_SB(op2, 1), 8U),
+                   __host_ssat(__HOST_SB(op1, 2) - __HOST_SB(op2, 2), 8U), __host_ssat(__HOST_SB(op1, 3) - __HOST_SB(op2, 3), 8U)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SHSUB8(uint32_t op1, uint32_t op2)
+{
+  return(__HOST_B4((__HOST_SB(op1, 0) - __HOST_SB(op2, 0)) >> 1, (__HOST_SB(op1, 1) - __HOST_SB(op2, 1)) >> 1,
+                   (__HOST_SB(op1, 2) - __HOST_SB(op2, 2)) >> 1, (__HOST_SB(op1, 3) - __HOST_SB(op2, 3)) >> 1));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __USUB8(uint32_t op1, uint32_t op2)
+{
+  int32_t r0 = __HOST_UB(op1, 0) - __HOST_UB(op2, 0), r1 = __HOST_UB(op1, 1) - __HOST_UB(op2, 1);
+  int32_t r2 = __HOST_UB(op1, 2) - __HOST_UB(op2, 2), r3 = __HOST_UB(op1, 3) - __HOST_UB(op2, 3);
+
+  __host_ge8(r0, r1, r2, r3);
+  return(__HOST_B4(r0, r1, r2, r3));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __UQSUB8(uint32_t op1, uint32_t op2)
+{
+  return(__HOST_B4(__host_usat(__HOST_UB(op1, 0) - __HOST_UB(op2, 0), 8U), __host_usat(__HOST_UB(op1, 1) - __HOST_UB(op2, 1), 8U),
+                   __host_usat(__HOST_UB(op1, 2) - __HOST_UB(op2, 2), 8U), __host_usat(__HOST_UB(op1, 3) - __HOST_UB(op2, 3), 8U)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __UHSUB8(uint32_t op1, uint32_t op2)
+{
+  return(__HOST_B4((__HOST_UB(op1, 0) - __HOST_UB(op2, 0)) >> 1, (__HOST_UB(op1, 1) - __HOST_UB(op2, 1)) >> 1,
+                   (__HOST_UB(op1, 2) - __HOST_UB(op2, 2)) >> 1, (__HOST_UB(op1, 3) - __HOST_UB(op2, 3)) >> 1));
+}
+
+/*------ 16 bit lanes ------------------------------------------------------------*/
+/* The exchange forms use the top halfword of op2 in the low lane and its bottom halfword in the top lane:
+   ASX: low = op1.lo - op2.hi, high = op1.hi + op2.lo.  SAX: low = op1.lo + op2.hi, high = op1.hi - op2.lo. */
+#define __HOST_PAR16(NAME, LO, HI, PACK, GE)                                          \
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t NAME(uint32_t op1, uint32_t op2) \
+{                                                                                     \
+  int32_t r0 = (LO), r1 = (HI);                                                       \
+                                                                                      \
+  GE;                                                                                 \
+  return(PACK);                                                                       \
+}
+
+#define __HOST_S(N)   __HOST_SH(op1, N)
+#define __HOST_T(N)   __HOST_SH(op2, N)
+#define __HOST_U(N)   __HOST_UH(op1, N)
+#define __HOST_V(N)   __HOST_UH(op2, N)
+
+__HOST_PAR16(__SADD16,  __HOST_S(0) + __HOST_T(0), __HOST_S(1) + __HOST_T(1), __HOST_H2(r0, r1),                                 __host_ge16(r0, r1))
+__HOST_PAR16(__QADD16,  __HOST_S(0) + __HOST_T(0), __HOST_S(1) + __HOST_T(1), __HOST_H2(__host_ssat(r0, 16U), __host_ssat(r1, 16U)), (void)0)
+__HOST_PAR16(__SHADD16, __HOST_S(0) + __HOST_T(0), __HOST_S(1) + __HOST_T(1), __HOST_H2(r0 >> 1, r1 >> 1),                       (void)0)
+__HOST_PAR16(__UADD16,  __HOST_U(0) + __HOST_V(0), __HOST_U(1) + __HOST_V(1), __HOST_H2(r0, r1),                                 __host_ge16((r0 >= 0x10000) ? 0 : -1, (r1 >= 0x10000) ? 0 : -1))
+__HOST_PAR16(__UQADD16, __HOST_U(0) + __HOST_V(0), __HOST_U(1) + __HOST_V(1), __HOST_H2(__host_usat(r0, 16U), __host_usat(r1, 16U)), (void)0)
+__HOST_PAR16(__UHADD16, __HOST_U(0) + __HOST_V(0), __HOST_U(1) + __HOST_V(1), __HOST_H2(r0 >> 1, r1 >> 1),                       (void)0)
+__HOST_PAR16(__SSUB16,  __HOST_S(0) - __HOST_T(0), __HOST_S(1) - __HOST_T(1), __HOST_H2(r0, r1),                                 __host_ge16(r0, r1))
+__HOST_PAR16(__QSUB16,  __HOST_S(0) - __HOST_T(0), __HOST_S(1) - __HOST_T(1), __HOST_H2(__host_ssat(r0, 16U), __host_ssat(r1, 16U)), (void)0)
+__HOST_PAR16(__SHSUB16, __HOST_S(0) - __HOST_T(0), __HOST_S(1) - __HOST_T(1), __HOST_H2(r0 >> 1, r1 >> 1),                       (void)0)
+__HOST_PAR16(__USUB16,  __HOST_U(0) - __HOST_V(0), __HOST_U(1) - __HOST_V(1), __HOST_H2(r0, r1),                                 __host_ge16(r0, r1))
+__HOST_PAR16(__UQSUB16, __HOST_U(0) - __HOST_V(0), __HOST_U(1) - __HOST_V(1), __HOST_H2(__host_usat(r0, 16U), __host_usat(r1, 16U)), (void)0)
+__HOST_PAR16(__UHSUB16, __HOST_U(0) - __HOST_V(0), __HOST_U(1) - __HOST_V(1), __HOST_H2(r0 >> 1, r1 >> 1),                       (void)0)
+__HOST_PAR16(__SASX,    __HOST_S(0) - __HOST_T(1), __HOST_S(1) + __HOST_T(0), __HOST_H2(r0, r1),                                 __host_ge16(r0, r1))
+__HOST_PAR16(__QASX,    __HOST_S(0) - __HOST_T(1), __HOST_S(1) + __HOST_T(0), __HOST_H2(__host_ssat(r0, 16U), __host_ssat(r1, 16U)), (void)0)
+__HOST_PAR16(__SHASX,   __HOST_S(0) - __HOST_T(1), __HOST_S(1) + __HOST_T(0), __HOST_H2(r0 >> 1, r1 >> 1),                       (void)0)
+__HOST_PAR16(__UASX,    __HOST_U(0) - __HOST_V(1), __HOST_U(1) + __HOST_V(0), __HOST_H2(r0, r1),                                 __host_ge16(r0, (r1 >= 0x10000) ? 0 : -1))
+__HOST_PAR16(__UQASX,   __HOST_U(0) - __HOST_V(1), __HOST_U(1) + __HOST_V(0), __HOST_H2(__host_usat(r0, 16U), __host_usat(r1, 16U)), (void)0)
+__HOST_PAR16(__UHASX,   __HOST_U(0) - __HOST_V(1), __HOST_U(1) + __HOST_V(0), __HOST_H2(r0 >> 1, r1 >> 1),                       (void)0)
+__HOST_PAR16(__SSAX,    __HOST_S(0) + __HOST_T(1), __HOST_S(1) - __HOST_T(0), __HOST_H2(r0, r1),                                 __host_ge16(r0, r1))
+__HOST_PAR16(__QSAX,    __HOST_S(0) + __HOST_T(1), __HOST_S(1) - __HOST_T(0), __HOST_H2(__host_ssat(r0, 16U), __host_ssat(r1, 16U)), (void)0)
+__HOST_PAR16(__SHSAX,   __HOST_S(0) + __HOST_T(1), __HOST_S(1) - __HOST_T(0), __HOST_H2(r0 >> 1, r1 >> 1),                       (void)0)
+__HOST_PAR16(__USAX,    __HOST_U(0) + __HOST_V(1), __HOST_U(1) - __HOST_V(0), __HOST_H2(r0, r1),                                 __host_ge16((r0 >= 0x10000) ? 0 : -1, r1))
+__HOST_PAR16(__UQSAX,   __HOST_U(0) + __HOST_V(1), __HOST_U(1) - __HOST_V(0), __HOST_H2(__host_usat(r0, 16U), __host_usat(r1, 16U)), (void)0)
+__HOST_PAR16(__UHSAX,   __HOST_U(0) + __HOST_V(1), __HOST_U(1) - __HOST_V(0), __HOST_H2(r0 >> 1, r1 >> 1),                       (void)0)
+
+#undef __HOST_PAR16
+#undef __HOST_S
+#undef __HOST_T
+#undef __HOST_U
+#undef __HOST_V
+
+/*------ Sum of absolute differences, saturation, extension ---------------------*/
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __USADA8(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  uint32_t i;
+  int32_t  d;
+
+  for (i = 0U; i < 4U; i++)
+  {
+    d    = __HOST_UB(op1, i) - __HOST_UB(op2, i);
+    op3 += (uint32_t)((d < 0) ? -d : d);
+  }
+  return(op3);
+}
+
+#define __USAD8(ARG1,ARG2)                __USADA8((ARG1), (ARG2), 0U)
+
+#define __SSAT16(ARG1,ARG2)               __HOST_H2(__host_ssat(__HOST_SH((ARG1), 0), (ARG2)), __host_ssat(__HOST_SH((ARG1), 1), (ARG2)))
+#define __USAT16(ARG1,ARG2)               __HOST_H2(__host_usat(__HOST_SH((ARG1), 0), (ARG2)), __host_usat(__HOST_SH((ARG1), 1), (ARG2)))
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __UXTB16(uint32_t op1)
+{
+  return(op1 & 0x00FF00FFUL);
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __UXTAB16(uint32_t op1, uint32_t op2)
+{
+  return(__HOST_H2(__HOST_UH(op1, 0) + __HOST_UB(op2, 0), __HOST_UH(op1, 1) + __HOST_UB(op2, 2)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SXTB16(uint32_t op1)
+{
+  return(__HOST_H2(__HOST_SB(op1, 0), __HOST_SB(op1, 2)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SXTAB16(uint32_t op1, uint32_t op2)
+{
+  return(__HOST_H2(__HOST_UH(op1, 0) + __HOST_SB(op2, 0), __HOST_UH(op1, 1) + __HOST_SB(op2, 2)));
+}
+
+/*------ Dual 16 x 16 multiplies -------------------------------------------------*/
+/* Products are exact in 32 bits except -32768 * -32768 twice, where the sum wraps as on the Cortex-M4 */
+#define __HOST_MUL2(A,B,X)                ((int64_t)__HOST_SH((A), 0) * __HOST_SH((B), (X)))
+#define __HOST_MUL2H(A,B,X)               ((int64_t)__HOST_SH((A), 1) * __HOST_SH((B), 1U - (X)))
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SMUAD(uint32_t op1, uint32_t op2)
+{
+  return((uint32_t)(__HOST_MUL2(op1, op2, 0U) + __HOST_MUL2H(op1, op2, 0U)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SMUADX(uint32_t op1, uint32_t op2)
+{
+  return((uint32_t)(__HOST_MUL2(op1, op2, 1U) + __HOST_MUL2H(op1, op2, 1U)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SMLAD(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return((uint32_t)(__HOST_MUL2(op1, op2, 0U) + __HOST_MUL2H(op1, op2, 0U) + (int32_t)op3));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SMLADX(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return((uint32_t)(__HOST_MUL2(op1, op2, 1U) + __HOST_MUL2H(op1, op2, 1U) + (int32_t)op3));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint64_t __SMLALD(uint32_t op1, uint32_t op2, uint64_t op3)
+{
+  return(op3 + (uint64_t)(__HOST_MUL2(op1, op2, 0U) + __HOST_MUL2H(op1, op2, 0U)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint64_t __SMLALDX(uint32_t op1, uint32_t op2, uint64_t op3)
+{
+  return(op3 + (uint64_t)(__HOST_MUL2(op1, op2, 1U) + __HOST_MUL2H(op1, op2, 1U)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SMUSD(uint32_t op1, uint32_t op2)
+{
+  return((uint32_t)(__HOST_MUL2(op1, op2, 0U) - __HOST_MUL2H(op1, op2, 0U)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SMUSDX(uint32_t op1, uint32_t op2)
+{
+  return((uint32_t)(__HOST_MUL2(op1, op2, 1U) - __HOST_MUL2H(op1, op2, 1U)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SMLSD(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return((uint32_t)(__HOST_MUL2(op1, op2, 0U) - __HOST_MUL2H(op1, op2, 0U) + (int32_t)op3));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SMLSDX(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return((uint32_t)(__HOST_MUL2(op1, op2, 1U) - __HOST_MUL2H(op1, op2, 1U) + (int32_t)op3));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint64_t __SMLSLD(uint32_t op1, uint32_t op2, uint64_t op3)
+{
+  return(op3 + (uint64_t)(__HOST_MUL2(op1, op2, 0U) - __HOST_MUL2H(op1, op2, 0U)));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint64_t __SMLSLDX(uint32_t op1, uint32_t op2, uint64_t op3)
+{
+  return(op3 + (uint64_t)(__HOST_MUL2(op1, op2, 1U) - __HOST_MUL2H(op1, op2, 1U)));
+}
+
+/*------ Select, 32 bit saturating add/subtract, packing ------------------------*/
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __SEL(uint32_t op1, uint32_t op2)
+{
+  uint32_t mask = ((__host_ge & 1U) ? 0x000000FFUL : 0U) | ((__host_ge & 2U) ? 0x0000FF00UL : 0U) |
+                  ((__host_ge & 4U) ? 0x00FF0000UL : 0U) | ((__host_ge & 8U) ? 0xFF000000UL : 0U);
+
+  return((op1 & mask) | (op2 & ~mask));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __QADD(uint32_t op1, uint32_t op2)
+{
+  return((uint32_t)__host_ssat((int64_t)(int32_t)op1 + (int32_t)op2, 32U));
+}
+
+__attribute__( ( always_inline ) ) __STATIC_INLINE uint32_t __QSUB(uint32_t op1, uint32_t op2)
+{
+  return((uint32_t)__host_ssat((int64_t)(int32_t)op1 - (int32_t)op2, 32U));
+}
+
+#define __PKHBT(ARG1,ARG2,ARG3)          ( ((((uint32_t)(ARG1))          ) & 0x0000FFFFUL) |  \
+                                           ((((uint32_t)(ARG2)) << (ARG3)) & 0xFFFF0000UL)  )
+
+#define __PKHTB(ARG1,ARG2,ARG3)          ( ((((uint32_t)(ARG1))          ) & 0xFFFF0000UL) |  \
+                                           (((uint32_t)(((int32_t)(ARG2)) >> (ARG3))) & 0x0000FFFFUL)  )
+
+#define __SMMLA(ARG1,ARG2,ARG3)          ( (int32_t)((((int64_t)(ARG1) * (ARG2)) + \
+                                                      ((int64_t)(ARG3) << 32)      ) >> 32))
+
+/*@}*/ /* end of group CMSIS_host_SIMD */
+
+
+/* ###################  Host Vector Extensions  ########################### */
+/** \defgroup CMSIS_host_vector CMSIS host vector extensions
+  Vector types of the host SIMD unit, used by the vectorised float32 and float64 kernels of a host build:
+  - x86-64: 8 lanes (AVX2).  The kernels check the CPU at run time and take the C code paths on a
+    CPU without AVX2, unless the build already targets AVX2 (-mavx2, -march=native, ...).
+    Define ARM_MATH_HOST_SSE2 to build 4-lane SSE2 kernels instead, for such CPUs.
+  - AArch64: 4 lanes (NEON).
+  Define ARM_MATH_HOST_NO_SIMD to build the C code paths only, e.g. to produce reference results.
+  @{
+*/
+
+#if !defined (ARM_MATH_HOST_NO_SIMD)
+
+#if defined ( __x86_64__ ) && !defined ( ARM_MATH_HOST_SSE2 )
+  #define __HOST_VLEN                     8
+  #if defined ( __AVX2__ )
+    #define __HOST_SIMD_TARGET
+    #define __HOST_SIMD_READY()           (1)
+  #else
+    #define __HOST_SIMD_TARGET            __attribute__( ( target("avx2") ) )
+    #define __HOST_SIMD_READY()           (__builtin_cpu_supports("avx2"))
+  #endif
+#elif defined ( __SSE2__ ) || defined ( __ARM_NEON )
+  #define __HOST_VLEN                     4
+  #define __HOST_SIMD_TARGET
+  #define __HOST_SIMD_READY()             (1)
+#endif
+
+#endif /* !defined (ARM_MATH_HOST_NO_SIMD) */
+
+#if defined ( __HOST_VLEN )
+
+#define __HOST_SIMD      1
+
+/* 4 lanes (all targets) and __HOST_VLEN lanes of float32, with unaligned, aliasing access to float32 buffers.
+   A kernel that makes the operations of the C code in the same order gives the same results: the x86-64
+   kernels do not use FMA.  On AArch64, where a * b + c is contracted by default, build with
+   -ffp-contract=off for that. */
+typedef float   __host_v4f  __attribute__( ( vector_size(16), aligned(4), __may_alias__ ) );
+typedef int32_t __host_v4i  __attribute__( ( vector_size(16), aligned(4), __may_alias__ ) );
+typedef float   __host_vf   __attribute__( ( vector_size(4 * __HOST_VLEN), aligned(4), __may_alias__ ) );
+typedef int32_t __host_vi   __attribute__( ( vector_size(4 * __HOST_VLEN), aligned(4), __may_alias__ ) );
+
+/* __HOST_VDLEN lanes of float64, the same register width as __host_vf */
+#define __HOST_VDLEN                      (__HOST_VLEN / 2)
+typedef double  __host_vd   __attribute__( ( vector_size(4 * __HOST_VLEN), aligned(8), __may_alias__ ) );
+
+#define __HOST_LD4(P)                     (*(const __host_v4f *)(const void *)(P))
+#define __HOST_ST4(P,V)                   (*(__host_v4f *)(void *)(P) = (V))
+#define __HOST_LD(P)                      (*(const __host_vf *)(const void *)(P))
+#define __HOST_ST(P,V)                    (*(__host_vf *)(void *)(P) = (V))
+#define __HOST_LDD(P)                     (*(const __host_vd *)(const void *)(P))
+#define __HOST_STD(P,V)                   (*(__host_vd *)(void *)(P) = (V))
+
+/* Lane 'i' of the result is lane INDEX[i] of the concatenation {A, B} */
+#if defined ( __clang__ )
+#define __HOST_SHUF4(A,B,I0,I1,I2,I3)     __builtin_shufflevector((A), (B), I0, I1, I2, I3)
+#define __HOST_SHUF8(A,B,I0,I1,I2,I3,I4,I5,I6,I7) \
+                                          __builtin_shufflevector((A), (B), I0, I1, I2, I3, I4, I5, I6, I7)
+#else
+#define __HOST_SHUF4(A,B,I0,I1,I2,I3)     __builtin_shuffle((A), (B), (__host_v4i){I0, I1, I2, I3})
+#define __HOST_SHUF8(A,B,I0,I1,I2,I3,I4,I5,I6,I7) \
+                                          __builtin_shuffle((A), (B), (__host_vi){I0, I1, I2, I3, I4, I5, I6, I7})
+#endif
+
+/* Swap the lanes of each pair (real and imaginary parts of interleaved complex data) */
+#if (__HOST_VLEN == 8)
+#define __HOST_SWAP2(V)                   __HOST_SHUF8((V), (V), 1, 0, 3, 2, 5, 4, 7, 6)
+#else
+#define __HOST_SWAP2(V)                   __HOST_SHUF4((V), (V), 1, 0, 3, 2)
+#endif
+
+/* Lanes of A where MASK is all ones, lanes of B where it is zero */
+#define __HOST_SEL4(MASK,A,B)             ((__host_v4f)(((MASK) & (__host_v4i)(A)) | (~(MASK) & (__host_v4i)(B))))
+#define __HOST_SEL(MASK,A,B)              ((__host_vf)(((MASK) & (__host_vi)(A)) | (~(MASK) & (__host_vi)(B))))
+
+/* Correctly rounded square root of each lane, as sqrtf() */
+#if defined ( __x86_64__ ) && (__HOST_VLEN == 8)
+#define __HOST_SQRT(V)                    ((__host_vf)__builtin_ia32_sqrtps256((V)))
+#elif defined ( __x86_64__ )
+#define __HOST_SQRT(V)                    ((__host_vf)__builtin_ia32_sqrtps((V)))
+#else
+#include <arm_neon.h>
+#define __HOST_SQRT(V)                    ((__host_vf)vsqrtq_f32((float32x4_t)(V)))
+#endif
+
+#endif /* defined ( __HOST_VLEN ) */
+
+/*@}*/ /* end of group CMSIS_host_vector */
+
+#endif /* __CORE_HOST_H */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,446 @@
+/**
+  ******************************************************************************
+  * @file    trace_dec.c
+  * @brief   Host side decoder of the uC/OS-II trace stream sent by
+  *          UserApp/app_trace.c over the USB virtual COM port.
+  *
+  *          Reads a recorded stream (or a tty), prints a per-task and per-ISR
+  *          summary and can dump the event timeline as text or as a VCD file
+  *          for a waveform viewer (e.g. GTKWave).  See readme.txt.
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* Frame layout, must match UserApp/app_trace.h ------------------------------*/
+#define TRACE_SYNC            0xA5
+#define TRACE_FRAME_HELLO     0x01
+#define TRACE_FRAME_EVENTS    0x02
+#define TRACE_FRAME_TASK      0x03
+#define TRACE_FRAME_LOST      0x04
+
+#define TRACE_EV_TASK_SW      1
+#define TRACE_EV_ISR_ENTER    2
+#define TRACE_EV_ISR_EXIT     3
+
+#define NBR_PRIO              256
+#define NBR_EXC               256
+#define ISR_NEST_MAX          32
+#define NO_TASK               0xFF
+
+typedef struct
+{
+  int      seen;                /* A TASK frame was received for this priority */
+  char     name[33];
+  uint16_t cpu;                 /* 0.01 % */
+  uint32_t lat_max;             /* cycles */
+  uint32_t stk_used;
+  uint32_t stk_size;
+  uint32_t ctx_sw;
+  uint64_t run_cycles;          /* Measured from the event stream */
+  uint64_t switches;
+} task_t;
+
+typedef struct
+{
+  uint64_t count;
+  uint64_t cycles;              /* Enter to exit, nested ISRs included */
+  uint64_t max_cycles;
+} isr_t;
+
+static task_t   Tasks[NBR_PRIO];
+static isr_t    Isrs[NBR_EXC];
+
+static uint32_t CpuHz;
+static uint32_t TickHz;
+static uint32_t Lost;
+static uint64_t BadFrames;
+static uint64_t Events;
+
+static int      TsValid;
+static uint32_t TsLast;
+static uint64_t TsNow;          /* 64-bit unwrapped time stamp */
+static uint64_t TsFirst;
+
+static int      CurTask = -1;
+static uint64_t CurTaskStart;
+static int      IsrDepth;
+static uint8_t  IsrNbr[ISR_NEST_MAX];
+static uint64_t IsrStart[ISR_NEST_MAX];
+
+static int      PrintEvents;
+static FILE    *Vcd;
+static int      VcdTask = -1;
+static int      VcdIsr = -1;
+
+static uint32_t get16(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+  return get16(p) | (get16(p + 2) << 16);
+}
+
+static double cycles_to_us(uint64_t cycles)
+{
+  if (CpuHz == 0)
+  {
+    return 0.0;
+  }
+  return (double)cycles * 1e6 / (double)CpuHz;
+}
+
+static void vcd_bits(int val, char id)
+{
+  int i;
+
+  fputc('b', Vcd);
+  for (i = 7; i >= 0; i--)
+  {
+    fputc(((val >> i) & 1) ? '1' : '0', Vcd);
+  }
+  fprintf(Vcd, " %c\n", id);
+}
+
+static void vcd_update(void)
+{
+  int task;
+  int isr;
+
+  if (Vcd == NULL)
+  {
+    return;
+  }
+  task = (CurTask < 0) ? NO_TASK : CurTask;
+  isr  = (IsrDepth > 0) ? IsrNbr[IsrDepth - 1] : 0;
+  if ((task == VcdTask) && (isr == VcdIsr))
+  {
+    return;
+  }
+  fprintf(Vcd, "#%llu\n",
+          (unsigned long long)(CpuHz ? (TsNow - TsFirst) * 1000000000ull / CpuHz : TsNow - TsFirst));
+  if (task != VcdTask)
+  {
+    vcd_bits(task, 't');
+    VcdTask = task;
+  }
+  if (isr != VcdIsr)
+  {
+    vcd_bits(isr, 'i');
+    VcdIsr = isr;
+  }
+}
+
+static void on_event(uint8_t type, uint8_t arg, uint32_t ts)
+{
+  if (!TsValid)
+  {
+    TsValid = 1;
+    TsNow   = ts;
+    TsFirst = ts;
+  }
+  else
+  {
+    TsNow += (uint32_t)(ts - TsLast);   /* Counter wraps every 2^32 cycles */
+  }
+  TsLast = ts;
+  Events++;
+
+  if (PrintEvents)
+  {
+    static const char *names[] = { "?", "TASK_SW", "ISR_ENTER", "ISR_EXIT" };
+    printf("%14.3f us  %-9s %3u\n", cycles_to_us(TsNow - TsFirst),
+           names[(type <= TRACE_EV_ISR_EXIT) ? type : 0], arg);
+  }
+
+  switch (type)
+  {
+  case TRACE_EV_TASK_SW:
+    if (CurTask >= 0)
+    {
+      Tasks[CurTask].run_cycles += TsNow - CurTaskStart;
+    }
+    CurTask      = arg;
+    CurTaskStart = TsNow;
+    Tasks[arg].switches++;
+    break;
+
+  case TRACE_EV_ISR_ENTER:
+    if (IsrDepth < ISR_NEST_MAX)
+    {
+      IsrNbr[IsrDepth]   = arg;
+      IsrStart[IsrDepth] = TsNow;
+    }
+    IsrDepth++;
+    break;
+
+  case TRACE_EV_ISR_EXIT:
+    if (IsrDepth > 0)
+    {
+      IsrDepth--;
+      if (IsrDepth < ISR_NEST_MAX)
+      {
+        uint64_t d = TsNow - IsrStart[IsrDepth];
+        isr_t   *p = &Isrs[IsrNbr[IsrDepth]];
+
+        p->count++;
+        p->cycles += d;
+        if (d > p->max_cycles)
+        {
+          p->max_cycles = d;
+        }
+      }
+    }
+    break;
+
+  default:
+    break;
+  }
+  vcd_update();
+}
+
+static void on_frame(uint8_t type, const uint8_t *p, uint32_t len)
+{
+  uint32_t i;
+  task_t  *t;
+
+  switch (type)
+  {
+  case TRACE_FRAME_HELLO:
+    if (len >= 7)
+    {
+      CpuHz  = get32(p + 1);
+      TickHz = get16(p + 5);
+    }
+    break;
+
+  case TRACE_FRAME_EVENTS:
+    for (i = 0; i + 6 <= len; i += 6)
+    {
+      on_event(p[i], p[i + 1], get32(p + i + 2));
+    }
+    break;
+
+  case TRACE_FRAME_TASK:
+    if (len >= 19)
+    {
+      t = &Tasks[p[0]];
+      t->seen     = 1;
+      t->cpu      = (uint16_t)get16(p + 1);
+      t->lat_max  = get32(p + 3);
+      t->stk_used = get32(p + 7);
+      t->stk_size = get32(p + 11);
+      t->ctx_sw   = get32(p + 15);
+      len -= 19;
+      if (len > sizeof(t->name) - 1)
+      {
+        len = sizeof(t->name) - 1;
+      }
+      memcpy(t->name, p + 19, len);
+      t->name[len] = '\0';
+    }
+    break;
+
+  case TRACE_FRAME_LOST:
+    if (len >= 4)
+    {
+      Lost = get32(p);
+    }
+    break;
+
+  default:
+    break;
+  }
+}
+
+static uint8_t  Frame[3 + 255 + 1];
+static uint32_t FrameLen;
+
+static void on_byte(uint8_t c);
+
+/* Drop the sync byte of the frame being received and feed the rest back */
+static void resync(void)
+{
+  uint8_t  tmp[sizeof(Frame)];
+  uint32_t cnt;
+  uint32_t i;
+
+  cnt = FrameLen - 1;
+  memcpy(tmp, Frame + 1, cnt);
+  FrameLen = 0;
+  for (i = 0; i < cnt; i++)
+  {
+    on_byte(tmp[i]);
+  }
+}
+
+/* Feed the decoder one byte at a time */
+static void on_byte(uint8_t c)
+{
+  uint32_t i;
+  uint8_t  sum;
+
+  if ((FrameLen == 0) && (c != TRACE_SYNC))
+  {
+    return;
+  }
+  Frame[FrameLen++] = c;
+  if ((FrameLen == 2) && ((c < TRACE_FRAME_HELLO) || (c > TRACE_FRAME_LOST)))
+  {
+    BadFrames++;
+    resync();
+    return;
+  }
+  if ((FrameLen < 3) || (FrameLen < 3u + Frame[2] + 1u))
+  {
+    return;
+  }
+  sum = 0;
+  for (i = 1; i < FrameLen; i++)
+  {
+    sum += Frame[i];
+  }
+  if (sum != 0)
+  {
+    BadFrames++;
+    resync();
+    return;
+  }
+  on_frame(Frame[1], Frame + 3, Frame[2]);
+  FrameLen = 0;
+}
+
+static void print_summary(void)
+{
+  uint64_t total;
+  int      i;
+
+  total = TsValid ? TsNow - TsFirst : 0;
+  printf("\nCPU clock %lu Hz, tick %lu Hz, %llu events over %.3f ms, %lu lost, %llu bad frames\n",
+         (unsigned long)CpuHz, (unsigned long)TickHz, (unsigned long long)Events,
+         cycles_to_us(total) / 1000.0, (unsigned long)Lost, (unsigned long long)BadFrames);
+
+  printf("\n%4s %-20s %8s %8s %12s %15s %10s\n",
+         "Prio", "Task", "CPU %", "Trace %", "Lat max us", "Stack used", "Ctx sw");
+  for (i = 0; i < NBR_PRIO; i++)
+  {
+    task_t *t = &Tasks[i];
+
+    if (!t->seen && (t->switches == 0))
+    {
+      continue;
+    }
+    printf("%4d %-20s %8.2f %8.2f %12.2f %7lu/%-7lu %10lu\n",
+           i, t->seen ? t->name : "?", t->cpu / 100.0,
+           total ? 100.0 * (double)t->run_cycles / (double)total : 0.0,
+           cycles_to_us(t->lat_max), (unsigned long)t->stk_used, (unsigned long)t->stk_size,
+           (unsigned long)t->ctx_sw);
+  }
+
+  printf("\n%6s %10s %12s %12s\n", "Exc", "Count", "Avg us", "Max us");
+  for (i = 0; i < NBR_EXC; i++)
+  {
+    isr_t *p = &Isrs[i];
+
+    if (p->count == 0)
+    {
+      continue;
+    }
+    printf("%6d %10llu %12.3f %12.3f\n", i, (unsigned long long)p->count,
+           cycles_to_us(p->cycles) / (double)p->count, cycles_to_us(p->max_cycles));
+  }
+}
+
+static void usage(const char *prog)
+{
+  fprintf(stderr, "usage: %s [-e] [-v out.vcd] <trace file | tty | ->\n"
+                  "  -e          print every event\n"
+                  "  -v out.vcd  write the task/ISR timeline as a VCD file\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+  const char *in_name  = NULL;
+  const char *vcd_name = NULL;
+  FILE       *in;
+  int         c;
+  int         i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-e") == 0)
+    {
+      PrintEvents = 1;
+    }
+    else if ((strcmp(argv[i], "-v") == 0) && (i + 1 < argc))
+    {
+      vcd_name = argv[++i];
+    }
+    else if (in_name == NULL)
+    {
+      in_name = argv[i];
+    }
+    else
+    {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (in_name == NULL)
+  {
+    usage(argv[0]);
+    return 2;
+  }
+
+  in = (strcmp(in_name, "-") == 0) ? stdin : fopen(in_name, "rb");
+  if (in == NULL)
+  {
+    perror(in_name);
+    return 1;
+  }
+  if (vcd_name != NULL)
+  {
+    Vcd = fopen(vcd_name, "w");
+    if (Vcd == NULL)
+    {
+      perror(vcd_name);
+      return 1;
+    }
+    fprintf(Vcd, "$timescale 1ns $end\n"
+                 "$scope module os $end\n"
+                 "$var wire 8 t task_prio $end\n"
+                 "$var wire 8 i isr_exc $end\n"
+                 "$upscope $end\n"
+                 "$enddefinitions $end\n");
+  }
+
+  while ((c = fgetc(in)) != EOF)
+  {
+    on_byte((uint8_t)c);
+  }
+  while (FrameLen > 0)                  /* Truncated or false frame at the end */
+  {
+    BadFrames++;
+    resync();
+  }
+  if (CurTask >= 0)
+  {
+    Tasks[CurTask].run_cycles += TsNow - CurTaskStart;
+  }
+  print_summary();
+
+  if (Vcd != NULL)
+  {
+    fclose(Vcd);
+  }
+  if (in != stdin)
+  {
+    fclose(in);
+  }
+  return 0;
+}
@@ -0,0 +1,228 @@
+/**
+  ******************************************************************************
+  * @file    app_trace.c
+  * @brief   Export of the uC/OS-II event trace and task profile over the USB
+  *          CDC virtual COM port.
+  *
+  *          The trace task drains the kernel trace ring (see OS_TRACE.C) every
+  *          APP_TRACE_PERIOD_MS and, once per second, sends the profile of
+  *          every task.  The frame layout is described in app_trace.h; the
+  *          host side decoder is in ..\Host\trace_dec.c.
+  *
+  *          Only built when OS_TRACE_EN is set in os_cfg.h.  It is off by
+  *          default: the kernel trace ring costs OS_TRACE_BUF_SIZE records of
+  *          RAM and this task runs at APP_TRACE_TASK_PRIO.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "app_trace.h"
+#include "stm32f4xx.h"
+#include "usbd_cdc_vcp.h"
+
+#if OS_TRACE_EN > 0u
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define APP_TRACE_FRAME_SIZE_MAX         (3 + 255 + 1)
+#define APP_TRACE_TASK_NAME_LEN_MAX      32
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint8_t      AppTraceFrame[APP_TRACE_FRAME_SIZE_MAX];
+static uint8_t      AppTraceLen;
+static OS_TRACE_REC AppTraceRec[APP_TRACE_EVENTS_PER_FRAME];
+
+/* Private function prototypes -----------------------------------------------*/
+static void App_TraceBegin(uint8_t type);
+static void App_TracePut8(uint8_t val);
+static void App_TracePut16(uint16_t val);
+static void App_TracePut32(uint32_t val);
+static void App_TraceSend(void);
+static void App_TraceSendHello(void);
+static void App_TraceSendTasks(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Trace export task.
+  * @param  p_arg: not used
+  * @retval None
+  */
+void App_TraceTask(void *p_arg)
+{
+  uint16_t nbr;
+  uint16_t i;
+  uint32_t periods;
+
+  (void)p_arg;
+
+  periods = 0;
+  App_TraceSendHello();
+  while (1)
+  {
+    nbr = OSTraceRead(AppTraceRec, APP_TRACE_EVENTS_PER_FRAME);
+    if (nbr > 0)
+    {
+      App_TraceBegin(APP_TRACE_FRAME_EVENTS);
+      for (i = 0; i < nbr; i++)
+      {
+        App_TracePut8(AppTraceRec[i].OSTraceType);
+        App_TracePut8((uint8_t)AppTraceRec[i].OSTraceArg);
+        App_TracePut32(AppTraceRec[i].OSTraceTS);
+      }
+      App_TraceSend();
+    }
+
+    periods++;
+    if (periods >= APP_TRACE_STAT_PERIODS)
+    {
+      periods = 0;
+      App_TraceSendHello();                 /* Lets the host attach at any time */
+      App_TraceSendTasks();
+      App_TraceBegin(APP_TRACE_FRAME_LOST);
+      App_TracePut32(OSTraceLostCtr);
+      App_TraceSend();
+    }
+
+    if (nbr < APP_TRACE_EVENTS_PER_FRAME)   /* Ring drained, wait for more */
+    {
+      OSTimeDly(APP_TRACE_PERIOD_MS * OS_TICKS_PER_SEC / 1000);
+    }
+  }
+}
+
+/**
+  * @brief  Send the HELLO frame: protocol version and time base.
+  * @param  None
+  * @retval None
+  */
+static void App_TraceSendHello(void)
+{
+  RCC_ClocksTypeDef rcc_clocks;
+
+  RCC_GetClocksFreq(&rcc_clocks);           /* DWT counts HCLK cycles */
+  App_TraceBegin(APP_TRACE_FRAME_HELLO);
+  App_TracePut8(APP_TRACE_VERSION);
+  App_TracePut32(rcc_clocks.HCLK_Frequency);
+  App_TracePut16(OS_TICKS_PER_SEC);
+  App_TraceSend();
+}
+
+/**
+  * @brief  Update the CPU usage of the tasks and send one TASK frame per task.
+  * @param  None
+  * @retval None
+  */
+static void App_TraceSendTasks(void)
+{
+  OS_TRACE_TASK_DATA task_data;
+  OS_STK_DATA        stk_data;
+  INT8U             *pname;
+  INT8U              len;
+  INT8U              err;
+  INT8U              prio;
+  INT8U              i;
+
+  OSTraceStatUpdate();
+  for (prio = 0; prio <= OS_LOWEST_PRIO; prio++)
+  {
+    if (OSTraceTaskQuery(prio, &task_data) != OS_ERR_NONE)
+    {
+      continue;                             /* No task at this priority */
+    }
+    if (OSTaskStkChk(prio, &stk_data) != OS_ERR_NONE)
+    {
+      stk_data.OSUsed = 0;                  /* Not created with OS_TASK_OPT_STK_CHK */
+      stk_data.OSFree = 0;
+    }
+    len = OSTaskNameGet(prio, &pname, &err);
+    if (err != OS_ERR_NONE)
+    {
+      len = 0;
+    }
+    if (len > APP_TRACE_TASK_NAME_LEN_MAX)
+    {
+      len = APP_TRACE_TASK_NAME_LEN_MAX;
+    }
+
+    App_TraceBegin(APP_TRACE_FRAME_TASK);
+    App_TracePut8(prio);
+    App_TracePut16(task_data.OSCPUUsage);
+    App_TracePut32(task_data.OSLatMax);
+    App_TracePut32(stk_data.OSUsed);
+    App_TracePut32(stk_data.OSUsed + stk_data.OSFree);
+    App_TracePut32(task_data.OSCtxSwCtr);
+    for (i = 0; i < len; i++)
+    {
+      App_TracePut8(pname[i]);
+    }
+    App_TraceSend();
+  }
+}
+
+/**
+  * @brief  Start a new frame.
+  * @param  type: APP_TRACE_FRAME_xxx
+  * @retval None
+  */
+static void App_TraceBegin(uint8_t type)
+{
+  AppTraceFrame[0] = APP_TRACE_SYNC;
+  AppTraceFrame[1] = type;
+  AppTraceLen      = 0;
+}
+
+/**
+  * @brief  Append 1, 2 or 4 bytes (little-endian) to the payload of the frame.
+  * @param  val: value to append
+  * @retval None
+  */
+static void App_TracePut8(uint8_t val)
+{
+  AppTraceFrame[3 + AppTraceLen] = val;
+  AppTraceLen++;
+}
+
+static void App_TracePut16(uint16_t val)
+{
+  App_TracePut8((uint8_t)(val));
+  App_TracePut8((uint8_t)(val >> 8));
+}
+
+static void App_TracePut32(uint32_t val)
+{
+  App_TracePut16((uint16_t)(val));
+  App_TracePut16((uint16_t)(val >> 16));
+}
+
+/**
+  * @brief  Close the frame and queue it on the virtual COM port, waiting for
+  *         room in the USB IN buffer if needed.
+  * @param  None
+  * @retval None
+  */
+static void App_TraceSend(void)
+{
+  uint8_t  sum;
+  uint32_t i;
+  uint32_t len;
+
+  AppTraceFrame[2] = AppTraceLen;
+  sum = 0;
+  for (i = 1; i < 3 + (uint32_t)AppTraceLen; i++)
+  {
+    sum += AppTraceFrame[i];
+  }
+  AppTraceFrame[3 + AppTraceLen] = (uint8_t)(0 - sum);
+  len = 3 + (uint32_t)AppTraceLen + 1;
+
+  while (VCP_Write(AppTraceFrame, len) != USBD_OK)
+  {
+    OSTimeDly(1);                           /* USB IN buffer full, let it drain */
+  }
+}
+
+#endif /* OS_TRACE_EN */
+
+/*********************************END OF FILE**********************************/
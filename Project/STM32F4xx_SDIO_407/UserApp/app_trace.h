@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * @file    app_trace.h
+  * @brief   Header for app_trace.c module: export of the uC/OS-II event trace
+  *          and task profile over the USB CDC virtual COM port.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __APP_TRACE_H
+#define __APP_TRACE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ucos_ii.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Every frame sent to the host is laid out as follows (multi-byte fields are
+   little-endian):
+
+     SYNC (0xA5) | TYPE | LEN | PAYLOAD (LEN bytes) | CHECKSUM
+
+   CHECKSUM is chosen so that TYPE + LEN + PAYLOAD + CHECKSUM == 0 (mod 256).
+
+   TYPE                       PAYLOAD
+   APP_TRACE_FRAME_HELLO      version (1), CPU clock in Hz (4), tick rate in Hz (2)
+   APP_TRACE_FRAME_EVENTS     N x { event type (1), argument (1), time stamp (4) }
+   APP_TRACE_FRAME_TASK       priority (1), CPU usage in 0.01 % (2), worst ISR to
+                              task latency in cycles (4), stack used in bytes (4),
+                              stack size in bytes (4), context switches (4),
+                              task name (LEN - 19 bytes, not NUL terminated)
+   APP_TRACE_FRAME_LOST       number of records dropped by the kernel (4)          */
+#define APP_TRACE_SYNC                   0xA5
+#define APP_TRACE_VERSION                1
+
+#define APP_TRACE_FRAME_HELLO            0x01
+#define APP_TRACE_FRAME_EVENTS           0x02
+#define APP_TRACE_FRAME_TASK             0x03
+#define APP_TRACE_FRAME_LOST             0x04
+
+#define APP_TRACE_TASK_PRIO              12
+#define APP_TRACE_TASK_STK_SIZE          256
+
+#define APP_TRACE_EVENTS_PER_FRAME       40     /* 6 bytes per event, LEN <= 255 */
+#define APP_TRACE_PERIOD_MS              10     /* Trace ring polling period     */
+#define APP_TRACE_STAT_PERIODS           100    /* Task profiles every second    */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void App_TraceTask(void *p_arg);
+
+#endif /* __APP_TRACE_H */
@@ -42,6 +42,7 @@
 #include "usbd_usr.h"
 #include "usb_conf.h"
 #include "usbd_desc.h"
+#include "app_trace.h"
 /** @addtogroup STM32F4xx_StdPeriph_Examples
   * @{
   */
@@ -75,6 +76,9 @@ __ALIGN_BEGIN USB_OTG_CORE_HANDLE    USB_OTG_dev __ALIGN_END ;
 static OS_STK		App_Task0Stack[APP_TASK0_STK_SIZE];
 static OS_STK		Fatfs_TestTaskStack[APP_TASK0_STK_SIZE];
 static OS_STK		LCD_TestTaskStack[APP_TASK0_STK_SIZE];
+#if OS_TRACE_EN > 0u
+static OS_STK		App_TraceTaskStack[APP_TRACE_TASK_STK_SIZE];
+#endif
 
 const uint32_t SD_SPEED_UNIT[8] = {100,1000,10000,100000,0,0,0,0};//λKb/s
 const uint8_t SD_SPEED_VALUEX10[16] = {0, 10, 12, 13, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 70, 80};//ֵΪ˱淽㣬10ˣڼʱҪ10
@@ -219,6 +223,22 @@ static void App_Task0(void *p_arg)
             &USBD_CDC_cb, 
             &USR_cb);
 
+#if OS_TRACE_EN > 0u
+	os_err = OSTaskCreateExt((void (*)(void *)) App_TraceTask, /* Export the kernel trace over the VCP */
+                             (void          * ) 0,
+                             (OS_STK        * )&App_TraceTaskStack[APP_TRACE_TASK_STK_SIZE - 1],
+                             (uint8_t         ) APP_TRACE_TASK_PRIO,
+                             (uint16_t        ) APP_TRACE_TASK_PRIO,
+                             (OS_STK        * )&App_TraceTaskStack[0],
+                             (INT32U          ) APP_TRACE_TASK_STK_SIZE,
+                             (void          * )0,
+                             (uint16_t        )(OS_TASK_OPT_STK_CLR | OS_TASK_OPT_STK_CHK));
+	if(os_err == OS_ERR_NONE)
+	{
+		OSTaskNameSet(APP_TRACE_TASK_PRIO, (uint8_t *)"Trace Task", &os_err);
+	}
+#endif
+
 	while(1)
 	{
 		OSTimeDly(1000);
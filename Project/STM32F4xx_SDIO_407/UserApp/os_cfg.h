@@ -53,6 +53,7 @@
 
                                        /* --------------------- TASK STACK SIZE ---------------------- */
 #define OS_TASK_TMR_STK_SIZE    128u   /* Timer      task stack size (# of OS_STK wide entries)        */
+#define OS_TASK_HTMR_STK_SIZE   128u   /* HR Timer   task stack size (# of OS_STK wide entries)        */
 #define OS_TASK_STAT_STK_SIZE   128u   /* Statistics task stack size (# of OS_STK wide entries)        */
 #define OS_TASK_IDLE_STK_SIZE   128u   /* Idle       task stack size (# of OS_STK wide entries)        */
 
@@ -68,6 +69,9 @@
 #define OS_TASK_REG_TBL_SIZE      1u   /*     Size of task variables array (#of INT32U entries)        */
 #define OS_TASK_STAT_EN           1u   /*     Enable (1) or Disable(0) the statistics task             */
 #define OS_TASK_STAT_STK_CHK_EN   1u   /*     Check task stacks from statistic task                    */
+#define OS_TASK_STK_GUARD_EN      0u   /*     Catch task stack overflows with an MPU guard region      */
+#define OS_TASK_STK_GUARD_SIZE   32u   /*     Size (in bytes) of the guard, a power of 2 >= 32         */
+#define OS_TASK_STK_WM_EN         0u   /*     Binary search of the stack high-water mark               */
 #define OS_TASK_SUSPEND_EN        1u   /*     Include code for OSTaskSuspend() and OSTaskResume()      */
 #define OS_TASK_SW_HOOK_EN        1u   /*     Include code for OSTaskSwHook()                          */
 
@@ -79,7 +83,9 @@
 #define OS_FLAG_NAME_EN           1u   /*     Enable names for event flag group                        */
 #define OS_FLAG_QUERY_EN          1u   /*     Include code for OSFlagQuery()                           */
 #define OS_FLAG_WAIT_CLR_EN       1u   /* Include code for Wait on Clear EVENT FLAGS                   */
-#define OS_FLAGS_NBITS           16u   /* Size in #bits of OS_FLAGS data type (8, 16 or 32)            */
+#define OS_FLAGS_NBITS           16u   /* Size in #bits of OS_FLAGS data type (8, 16, 32 or 64)        */
+#define OS_FLAG_POST_DEFER_EN     0u   /* Defer wait list check of OSFlagPost() from ISRs to PendSV    */
+                                       /*     If 1, also define it to the assembler (see OS_CPU_A.ASM) */
 
 
                                        /* -------------------- MESSAGE MAILBOXES --------------------- */
@@ -98,6 +104,16 @@
 #define OS_MEM_QUERY_EN           1u   /*     Include code for OSMemQuery()                            */
 
 
+                                       /* ----------------- SIZE-CLASS MEMORY POOLS ------------------ */
+#define OS_POOL_EN                0u   /* Enable (1) or Disable (0) code generation for MEMORY POOLS   */
+#define OS_POOL_MIN_BLK_SIZE     32u   /*     Size (in bytes) of the smallest class, a power of 2      */
+#define OS_POOL_NBR_CLASSES       8u   /*     Number of classes (32, 64, ... 4096 bytes)               */
+#define OS_POOL_ALIGN            32u   /*     Alignment (4 or 32 bytes) of the storage of each class   */
+#define OS_POOL_TASK_CACHE_EN     1u   /*     Enable (1) or Disable (0) per-task block caches          */
+#define OS_POOL_TASK_CACHE_DEPTH  2u   /*     Max. number of blocks cached per task and per class      */
+#define OS_POOL_QUERY_EN          1u   /*     Include code for OSPoolQuery()                           */
+
+
                                        /* ---------------- MUTUAL EXCLUSION SEMAPHORES --------------- */
 #define OS_MUTEX_EN               1u   /* Enable (1) or Disable (0) code generation for MUTEX          */
 #define OS_MUTEX_ACCEPT_EN        1u   /*     Include code for OSMutexAccept()                         */
@@ -105,6 +121,13 @@
 #define OS_MUTEX_QUERY_EN         1u   /*     Include code for OSMutexQuery()                          */
 
 
+                                       /* ---------------- PRIORITY INHERITANCE MUTEXES -------------- */
+#define OS_PIMUTEX_EN             0u   /* Enable (1) or Disable (0) code generation for PI MUTEXES     */
+#define OS_MAX_PIMUTEXES          4u   /*     Max. number of PI mutex control blocks                   */
+#define OS_PIMUTEX_DEL_EN         1u   /*     Include code for OSPIMutexDel()                          */
+#define OS_PIMUTEX_QUERY_EN       1u   /*     Include code for OSPIMutexQuery()                        */
+
+
                                        /* ---------------------- MESSAGE QUEUES ---------------------- */
 #define OS_Q_EN                   1u   /* Enable (1) or Disable (0) code generation for QUEUES         */
 #define OS_Q_ACCEPT_EN            1u   /*     Include code for OSQAccept()                             */
@@ -117,6 +140,13 @@
 #define OS_Q_QUERY_EN             1u   /*     Include code for OSQQuery()                              */
 
 
+                                       /* ------------------- RING BUFFERS (SPSC) -------------------- */
+#define OS_RING_EN                0u   /* Enable (1) or Disable (0) code generation for RING BUFFERS   */
+#define OS_MAX_RINGS              4u   /*     Max. number of ring buffer control blocks                */
+#define OS_RING_DEL_EN            1u   /*     Include code for OSRingDel()                             */
+#define OS_RING_QUERY_EN          1u   /*     Include code for OSRingQuery()                           */
+
+
                                        /* ------------------------ SEMAPHORES ------------------------ */
 #define OS_SEM_EN                 1u   /* Enable (1) or Disable (0) code generation for SEMAPHORES     */
 #define OS_SEM_ACCEPT_EN          1u   /*    Include code for OSSemAccept()                            */
@@ -133,6 +163,11 @@
 #define OS_TIME_TICK_HOOK_EN      1u   /*     Include code for OSTimeTickHook()                        */
 
 
+                                       /* --------------------- TRACE MANAGEMENT --------------------- */
+#define OS_TRACE_EN               0u   /* Enable (1) or Disable (0) the event trace and task profiler  */
+#define OS_TRACE_BUF_SIZE       512u   /*     Number of records in the trace ring (power of 2)         */
+
+
                                        /* --------------------- TIMER MANAGEMENT --------------------- */
 #define OS_TMR_EN                 0u   /* Enable (1) or Disable (0) code generation for TIMERS         */
 #define OS_TMR_CFG_MAX           16u   /*     Maximum number of timers                                 */
@@ -144,5 +179,13 @@
 #define OS_TASK_TMR_PRIO		OS_LOWEST_PRIO-2
 #endif
 
+
+                                       /* ---------------- HIGH RESOLUTION TIMERS ------------------ */
+#define OS_HTMR_EN                0u   /* Enable (1) or Disable (0) code generation for HR TIMERS      */
+#define OS_HTMR_CFG_MAX          64u   /*     Maximum number of high resolution timers                 */
+#define OS_HTMR_CFG_CLK_HZ  1000000u   /*     Frequency of the hardware counter (Hz), i.e. resolution  */
+#define OS_HTMR_DEL_EN            1u   /*     Include code for OSHTmrDel()                             */
+#define OS_TASK_HTMR_PRIO         5u   /*     Priority of the task running task level callbacks        */
+
 #endif
 	 	   	  		 			 	    		   		 		 	 	 			 	    		   	 			 	  	 		 				 		  			 		 					 	  	  		      		  	   		      		  	 		 	      		   		 		  	 		 	      		  		  		  
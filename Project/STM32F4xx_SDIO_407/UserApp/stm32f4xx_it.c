@@ -64,6 +64,10 @@
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+#if OS_TASK_STK_GUARD_EN > 0
+static volatile INT8U StkOvfPrio = OS_PRIO_SELF;  /* Task that overflowed its stack */
+#endif
+
 /* Private function prototypes -----------------------------------------------*/
 extern USB_OTG_CORE_HANDLE           USB_OTG_dev;
 extern uint32_t USBD_OTG_ISR_Handler (USB_OTG_CORE_HANDLE *pdev);
@@ -125,6 +129,11 @@ void HardFault_Handler(void)
   */
 void MemManage_Handler(void)
 {
+#if OS_TASK_STK_GUARD_EN > 0
+  /* Priority of the task that hit its stack guard region, for the debugger */
+  StkOvfPrio = OS_CPU_StkGuardFault();
+#endif
+
   /* Go to infinite loop when Memory Manage exception occurs */
   while (1)
   {}
@@ -195,7 +204,7 @@ void SysTick_Handler(void)
 #endif
 	
 	OS_ENTER_CRITICAL();  /* Tell uC/OS-II that we are starting an ISR */
-	OSIntNesting++;
+	OSIntEnter();
 	OS_EXIT_CRITICAL();
 	
 	OSTimeTick();  /* Call uC/OS-II's OSTimeTick() */
@@ -268,6 +277,33 @@ void USART1_IRQHandler(void)
 	}
 }
 
+/**
+  * @brief  This function handles TIM5 global interrupt request: compare
+  *         channel 1 of the uC/OS-II high resolution timers (OS_HTMR.C).
+  * @param  None
+  * @retval None
+  */
+#if OS_HTMR_EN > 0u
+void TIM5_IRQHandler(void)
+{
+#if OS_CRITICAL_METHOD == 3 /* Allocate storage for CPU status register */
+	OS_CPU_SR  cpu_sr = 0;
+#endif
+
+	OS_ENTER_CRITICAL();  /* Tell uC/OS-II that we are starting an ISR */
+	OSIntEnter();
+	OS_EXIT_CRITICAL();
+
+	if(TIM_GetITStatus(TIM5, TIM_IT_CC1) == SET)
+	{
+		TIM_ClearITPendingBit(TIM5, TIM_IT_CC1);
+		OSHTmrSignal();  /* Process the expired timers and program the next compare */
+	}
+
+	OSIntExit();  /* Tell uC/OS-II that we are leaving the ISR */
+}
+#endif
+
 
 
 
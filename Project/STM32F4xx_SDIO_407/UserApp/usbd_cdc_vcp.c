@@ -251,6 +251,43 @@ static uint16_t VCP_DataTx (uint8_t* Buf, uint32_t Len)
   return USBD_OK;
 }
 
+/**
+  * @brief  VCP_Write
+  *         Queue data to be sent over the USB IN endpoint without waiting.
+  * @param  Buf: Buffer of data to be sent
+  * @param  Len: Number of data to be sent (in bytes)
+  * @retval USBD_OK if the whole buffer was queued, USBD_FAIL if there is not
+  *         enough room left in APP_Rx_Buffer (nothing is queued in that case)
+  */
+uint16_t VCP_Write (uint8_t* Buf, uint32_t Len)
+{
+  uint32_t used;
+  uint32_t i;
+#if OS_CRITICAL_METHOD == 3 /* Allocate storage for CPU status register */
+  OS_CPU_SR  cpu_sr = 0;
+#endif
+
+  OS_ENTER_CRITICAL();
+  used = (APP_Rx_ptr_in + APP_RX_DATA_SIZE - APP_Rx_ptr_out) % APP_RX_DATA_SIZE;
+  if (Len >= (APP_RX_DATA_SIZE - used))   /* Keep one byte free: in == out means empty */
+  {
+    OS_EXIT_CRITICAL();
+    return USBD_FAIL;
+  }
+  for (i = 0; i < Len; i++)
+  {
+    APP_Rx_Buffer[APP_Rx_ptr_in] = Buf[i];
+    APP_Rx_ptr_in++;
+    if (APP_Rx_ptr_in == APP_RX_DATA_SIZE)
+    {
+      APP_Rx_ptr_in = 0;
+    }
+  }
+  OS_EXIT_CRITICAL();
+
+  return USBD_OK;
+}
+
 /**
   * @brief  VCP_DataRx
   *         Data received over USB OUT endpoint are sent over CDC interface 
@@ -68,6 +68,7 @@ typedef struct
 
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
+uint16_t VCP_Write (uint8_t* Buf, uint32_t Len);
 
 #endif /* __USBD_CDC_VCP_H */
 
@@ -34,6 +34,9 @@ int ff_cre_syncobj (	/* TRUE:Function succeeded, FALSE:Could not create due to a
 //	*sobj = OSMutexCreate(0, &err);			/* uC/OS-II */
 //	ret = (err == OS_NO_ERR);
 
+//	*sobj = OSPIMutexCreate(&err);			/* uC/OS-II, priority inheritance (_SYNC_t is OS_PIMUTEX*) */
+//	ret = (err == OS_ERR_NONE);
+
 //	*sobj = xSemaphoreCreateMutex();		/* FreeRTOS */
 //	ret = (*sobj != NULL);
 
@@ -63,6 +66,9 @@ int ff_del_syncobj (	/* TRUE:Function succeeded, FALSE:Could not delete due to a
 //	OSMutexDel(sobj, OS_DEL_ALWAYS, &err);	/* uC/OS-II */
 //	ret = (err == OS_NO_ERR);
 
+//	OSPIMutexDel(sobj, OS_DEL_ALWAYS, &err);	/* uC/OS-II, priority inheritance */
+//	ret = (err == OS_ERR_NONE);
+
 //	ret = 1;					/* FreeRTOS (nothing to do) */
 
 	return ret;
@@ -90,6 +96,9 @@ int ff_req_grant (	/* TRUE:Got a grant to access the volume, FALSE:Could not get
 //	OSMutexPend(sobj, _FS_TIMEOUT, &err));			/* uC/OS-II */
 //	ret = (err == OS_NO_ERR);
 
+//	OSPIMutexPend(sobj, _FS_TIMEOUT, &err);	/* uC/OS-II, priority inheritance */
+//	ret = (err == OS_ERR_NONE);
+
 //	ret = (xSemaphoreTake(sobj, _FS_TIMEOUT) == pdTRUE);	/* FreeRTOS */
 
 	return ret;
@@ -113,6 +122,8 @@ void ff_rel_grant (
 
 //	OSMutexPost(sobj);		/* uC/OS-II */
 
+//	OSPIMutexPost(sobj);	/* uC/OS-II, priority inheritance */
+
 //	xSemaphoreGive(sobj);	/* FreeRTOS */
 
 }
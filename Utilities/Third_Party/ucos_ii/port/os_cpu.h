@@ -46,11 +46,13 @@ typedef unsigned short INT16U;                   /* Unsigned 16 bit quantity
 typedef signed   short INT16S;                   /* Signed   16 bit quantity                           */
 typedef unsigned int   INT32U;                   /* Unsigned 32 bit quantity                           */
 typedef signed   int   INT32S;                   /* Signed   32 bit quantity                           */
+typedef unsigned long long INT64U;               /* Unsigned 64 bit quantity                           */
 typedef float          FP32;                     /* Single precision floating point                    */
 typedef double         FP64;                     /* Double precision floating point                    */
 
 typedef unsigned int   OS_STK;                   /* Each stack entry is 32-bit wide                    */
 typedef unsigned int   OS_CPU_SR;                /* Define size of CPU status register (PSR = 32 bits) */
+typedef unsigned int   OS_CPU_ADDR;              /* Integer wide enough to hold a pointer (32 bits)    */
 
 /*
 *********************************************************************************************************
@@ -91,6 +93,9 @@ typedef unsigned int   OS_CPU_SR;                /* Define size of CPU status re
 
 #define  OS_TASK_SW()         OSCtxSw()
 
+#define  OS_CPU_DWT_CYCCNT    (*(volatile INT32U *)0xE0001004uL)  /* DWT cycle counter                    */
+#define  OS_TS_GET()          OS_CPU_DWT_CYCCNT   /* Time stamp, in CPU clock cycles (see OS_CPU_TS_Init())   */
+
 /*
 *********************************************************************************************************
 *                                              PROTOTYPES
@@ -105,6 +110,26 @@ void       OS_CPU_SR_Restore(OS_CPU_SR cpu_sr);
 void       OSCtxSw(void);
 void       OSIntCtxSw(void);
 void       OSStartHighRdy(void);
+
+void       OS_CPU_MemBarrier(void);               /* See OS_CPU_A.ASM                                  */
+INT32U     OS_CPU_IntNbrGet(void);
+
+void       OS_CPU_TS_Init(void);                  /* See OS_CPU_C.C                                    */
+
+#if OS_HTMR_EN > 0                                /* Hardware timer of the HR timers, see OS_CPU_C.C   */
+void       OS_CPU_HTmrInit(void);
+INT32U     OS_CPU_HTmrGet(void);
+void       OS_CPU_HTmrSet(INT32U match);
+void       OS_CPU_HTmrDis(void);
+void       OS_CPU_HTmrPend(void);
+#endif
+
+#if OS_TASK_STK_GUARD_EN > 0                      /* MPU guard of the task stacks, see OS_CPU_C.C      */
+#define  OS_CPU_STK_GUARD_RGN 7u                  /* MPU region used for the guard (highest priority)  */
+
+void       OS_CPU_StkGuardInit(void);
+INT8U      OS_CPU_StkGuardFault(void);
+#endif
                                                                                       
 void       OS_CPU_SysTickInit(void); /* See OS_CPU_C.C	*/
                                                                                           
@@ -31,12 +31,17 @@
     EXTERN  OSIntNesting
     EXTERN  OSIntExit
     EXTERN  OSTaskSwHook
+    IF      :DEF:OS_FLAG_POST_DEFER_EN
+    EXTERN  OS_SchedDeferred
+    ENDIF
 
     EXPORT  OS_CPU_SR_Save                                      ; Functions declared in this file
     EXPORT  OS_CPU_SR_Restore
     EXPORT  OSStartHighRdy
     EXPORT  OSCtxSw
     EXPORT  OSIntCtxSw
+    EXPORT  OS_CPU_MemBarrier
+    EXPORT  OS_CPU_IntNbrGet
     EXPORT  PendSV_Handler
 
 ;********************************************************************************************************
@@ -98,6 +103,32 @@ OS_CPU_SR_Restore
     MSR     PRIMASK, R0
     BX      LR
 
+;********************************************************************************************************
+;                                            MEMORY BARRIER
+;                                       void OS_CPU_MemBarrier(void)
+;
+; Note(s) : 1) Used by the lock-free services (see OS_RING.C) to order the accesses to shared data and to
+;              the indices that publish it without disabling interrupts.
+;
+;           2) Being an out-of-line function it is also a compiler barrier: no load or store is moved
+;              across the call.
+;********************************************************************************************************
+
+OS_CPU_MemBarrier
+    DMB
+    BX      LR
+
+;********************************************************************************************************
+;                                     GET THE ACTIVE EXCEPTION NUMBER
+;                                      INT32U OS_CPU_IntNbrGet(void)
+;
+; Note(s) : 1) Returns the IPSR: 0 in Thread mode, 15 for SysTick, 16 + n for IRQn (see OS_TRACE.C).
+;********************************************************************************************************
+
+OS_CPU_IntNbrGet
+    MRS     R0, IPSR
+    BX      LR
+
 ;********************************************************************************************************
 ;                                          START MULTITASKING
 ;                                       void OSStartHighRdy(void)
@@ -197,9 +228,22 @@ OSIntCtxSw
 ;           4) Since PendSV is set to lowest priority in the system (by OSStartHighRdy() above), we
 ;              know that it will only be run when no other exception or interrupt is active, and
 ;              therefore safe to assume that context being switched out was using the process stack (PSP).
+;
+;           5) OS_SchedDeferred() is called first, with interrupts enabled, to complete the posts deferred
+;              by ISRs.  It may change OSTCBHighRdy.  It preserves R4-R11 (AAPCS) which are not saved yet.
+;              The call is only assembled when OS_FLAG_POST_DEFER_EN is defined in the assembler options
+;              (--pd "OS_FLAG_POST_DEFER_EN SETA 1"), which must be done when OS_FLAG_POST_DEFER_EN > 0u
+;              in OS_CFG.H.  Otherwise a context switch does not pay for the call.
 ;********************************************************************************************************
 
 PendSV_Handler
+    IF      :DEF:OS_FLAG_POST_DEFER_EN
+    PUSH    {R4, R14}                                           ; Save LR exc_return value (R4 keeps SP 8-byte aligned)
+    LDR     R0, =OS_SchedDeferred                               ; OS_SchedDeferred();
+    BLX     R0
+    POP     {R4, R14}
+    ENDIF
+
     CPSID   I                                                   ; Prevent interruption during context switch
 	AND		LR, LR, #0xFFFFFFE0 								; Use FPU, MSP.
 	ORR		LR, LR, #0x9
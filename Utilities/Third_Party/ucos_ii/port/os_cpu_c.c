@@ -35,6 +35,10 @@
 static  INT16U  OSTmrCtr;
 #endif
 
+#if OS_TASK_STK_GUARD_EN > 0
+static  INT32U  OS_CPU_StkGuardRASR;             /* Attributes and size of the stack guard region      */
+#endif
+
 /*
 *********************************************************************************************************
 *                                       OS INITIALIZATION HOOK
@@ -53,6 +57,14 @@ void  OSInitHookBegin (void)
 #if OS_TMR_EN > 0
     OSTmrCtr = 0;
 #endif
+
+#if (OS_TASK_PROFILE_EN > 0) || (OS_TRACE_EN > 0)
+    OS_CPU_TS_Init();                            /* Start the cycle counter used by OS_TS_GET()        */
+#endif
+
+#if OS_TASK_STK_GUARD_EN > 0
+    OS_CPU_StkGuardInit();                       /* Enable the MPU for the stack guard regions         */
+#endif
 }
 #endif
 
@@ -278,6 +290,29 @@ OS_STK *OSTaskStkInit (void (*task)(void *p_arg), void *p_arg, OS_STK *ptos, INT
 #if (OS_CPU_HOOKS_EN > 0) && (OS_TASK_SW_HOOK_EN > 0)
 void  OSTaskSwHook (void)
 {
+#if OS_TASK_PROFILE_EN > 0
+    INT32U  ts;
+
+
+    ts                             = OS_TS_GET();
+    OSTCBCur->OSTCBCyclesTot      += ts - OSTCBCur->OSTCBCyclesStart;  /* Charge the task switched out */
+    OSTCBHighRdy->OSTCBCyclesStart = ts;
+#endif
+
+#if OS_TRACE_EN > 0
+    OS_TraceTaskSw();
+#endif
+
+#if OS_TASK_STK_GUARD_EN > 0
+    if (OSTCBHighRdy->OSTCBStkGuard != (OS_STK *)0) {  /* Move the guard to the task switched in        */
+        MPU->RBAR = (INT32U)OSTCBHighRdy->OSTCBStkGuard | MPU_RBAR_VALID_Msk | OS_CPU_STK_GUARD_RGN;
+        MPU->RASR = OS_CPU_StkGuardRASR;
+    } else {
+        MPU->RNR  = OS_CPU_STK_GUARD_RGN;              /* Task without a guard (see OS_TCBInit())       */
+        MPU->RASR = 0u;
+    }
+#endif
+
 #if OS_APP_HOOKS_EN > 0
     App_TaskSwHook();
 #endif
@@ -358,6 +393,224 @@ void  OS_CPU_SysTickInit (void)
 	SysTick_Config(cnts);
 }
 
+/*
+*********************************************************************************************************
+*                                          OS_CPU_TS_Init()
+*
+* Description: Enable the DWT cycle counter read by OS_TS_GET().
+*
+* Arguments  : none.
+*
+* Note(s)    : 1) This function is called by OSInitHookBegin().  The counter runs at the CPU clock
+*                 (HCLK) and wraps around every 2^32 cycles.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_TS_Init (void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     /* Enable the DWT unit                           */
+    DWT->CYCCNT       = 0u;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;         /* Start the cycle counter                       */
+}
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_StkGuardInit()
+*
+* Description: Enable the MPU for the guard regions of the task stacks (OS_TASK_STK_GUARD_EN).
+*
+* Arguments  : none.
+*
+* Note(s)    : 1) This function is called by OSInitHookBegin().  Region OS_CPU_STK_GUARD_RGN is moved by
+*                 OSTaskSwHook() to the bottom of the stack of the task switched in (see OS_TCBInit()).
+*                 Any access to it, even privileged, raises a MemManage fault: the task overflowed.
+*              2) The rest of the memory map keeps its default attributes (PRIVDEFENA), so the other
+*                 regions are free for the application.
+*              3) A function whose frame is larger than the guard can jump over it, make the guard at
+*                 least as large as the largest local array of the tasks.
+*********************************************************************************************************
+*/
+
+#if OS_TASK_STK_GUARD_EN > 0
+void  OS_CPU_StkGuardInit (void)
+{
+    INT32U  size;
+
+
+    size = 4u;                                          /* SIZE field: region of 2^(SIZE + 1) bytes      */
+    while ((2uL << size) < OS_TASK_STK_GUARD_SIZE) {
+        size++;
+    }
+    OS_CPU_StkGuardRASR = MPU_RASR_XN_Msk               /* No access (AP = 0), no execution              */
+                        | (size << MPU_RASR_SIZE_Pos)
+                        | MPU_RASR_ENABLE_Msk;
+
+    MPU->CTRL   = 0u;
+    MPU->RNR    = OS_CPU_STK_GUARD_RGN;
+    MPU->RASR   = 0u;                                   /* Off until the first task is switched in       */
+    MPU->CTRL   = MPU_CTRL_PRIVDEFENA_Msk | MPU_CTRL_ENABLE_Msk;
+    SCB->SHCSR |= SCB_SHCSR_MEMFAULTENA_Msk;            /* Report overflows as MemManage faults          */
+    __DSB();
+    __ISB();
+}
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_StkGuardFault()
+*
+* Description: Find out if a MemManage fault is an overflow of the stack of the running task.
+*
+* Arguments  : none.
+*
+* Returns    : The priority of the running task if the fault hit its guard region, OS_PRIO_SELF otherwise.
+*
+* Note(s)    : 1) This function is called by MemManage_Handler().  The task cannot be resumed: its stack
+*                 frame could not be saved.
+*********************************************************************************************************
+*/
+
+INT8U  OS_CPU_StkGuardFault (void)
+{
+    INT32U  mmfsr;
+    INT32U  guard;
+
+
+    if (OSRunning != OS_TRUE) {
+        return (OS_PRIO_SELF);
+    }
+    guard = (INT32U)OSTCBCur->OSTCBStkGuard;
+    if (guard == 0u) {
+        return (OS_PRIO_SELF);
+    }
+    mmfsr = SCB->CFSR & SCB_CFSR_MEMFAULTSR_Msk;
+    if ((mmfsr & 0x10u) != 0u) {                        /* MSTKERR: exception entry stacking on the PSP  */
+        return (OSTCBCur->OSTCBPrio);
+    }
+    if ((mmfsr & 0x80u) != 0u) {                        /* MMARVALID: MMFAR holds the faulting address   */
+        if ((SCB->MMFAR - guard) < OS_TASK_STK_GUARD_SIZE) {
+            return (OSTCBCur->OSTCBPrio);
+        }
+    }
+    return (OS_PRIO_SELF);
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_HTmrInit()
+*
+* Description: Start TIM5 as the free-running 32-bit counter of the high resolution timers (OS_HTMR.C),
+*              counting at OS_HTMR_CFG_CLK_HZ.  Compare channel 1 generates the timer interrupt.
+*
+* Arguments  : none.
+*
+* Note(s)    : 1) This function is called by OSInit().  The interrupt is enabled in the NVIC at the highest
+*                 priority, its handler is TIM5_IRQHandler() which calls OSHTmrSignal().
+*              2) OS_HTMR_CFG_CLK_HZ must divide the TIM5 clock (2 x PCLK1 when APB1 is divided).
+*********************************************************************************************************
+*/
+
+#if OS_HTMR_EN > 0
+void  OS_CPU_HTmrInit (void)
+{
+    RCC_ClocksTypeDef        rcc_clocks;
+    TIM_TimeBaseInitTypeDef  tim_base;
+    NVIC_InitTypeDef         nvic;
+    INT32U                   tim_clk;
+
+
+    RCC_GetClocksFreq(&rcc_clocks);
+    tim_clk = rcc_clocks.PCLK1_Frequency;
+    if (rcc_clocks.HCLK_Frequency != rcc_clocks.PCLK1_Frequency) {
+        tim_clk *= 2u;                                  /* APB1 timers run at twice a divided PCLK1      */
+    }
+
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM5, ENABLE);
+    TIM_TimeBaseStructInit(&tim_base);
+    tim_base.TIM_Prescaler     = (uint16_t)(tim_clk / OS_HTMR_CFG_CLK_HZ - 1u);
+    tim_base.TIM_Period        = 0xFFFFFFFFu;           /* Free-running over the 32 bits                 */
+    tim_base.TIM_CounterMode   = TIM_CounterMode_Up;
+    tim_base.TIM_ClockDivision = TIM_CKD_DIV1;
+    TIM_TimeBaseInit(TIM5, &tim_base);
+    TIM_ClearITPendingBit(TIM5, TIM_IT_CC1);
+
+    nvic.NVIC_IRQChannel                   = TIM5_IRQn;
+    nvic.NVIC_IRQChannelPreemptionPriority = 0;
+    nvic.NVIC_IRQChannelSubPriority        = 0;
+    nvic.NVIC_IRQChannelCmd                = ENABLE;
+    NVIC_Init(&nvic);
+
+    TIM_Cmd(TIM5, ENABLE);
+}
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_HTmrGet()
+*
+* Description: Read the counter of the high resolution timers.
+*
+* Arguments  : none.
+*
+* Returns    : The TIM5 counter.
+*********************************************************************************************************
+*/
+
+INT32U  OS_CPU_HTmrGet (void)
+{
+    return (TIM5->CNT);
+}
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_HTmrSet()
+*
+* Description: Program the next interrupt of the high resolution timers.
+*
+* Arguments  : match    is the counter value at which the interrupt occurs.
+*
+* Note(s)    : 1) Interrupts are disabled when this function is called.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_HTmrSet (INT32U match)
+{
+    TIM_SetCompare1(TIM5, match);
+    TIM_ClearITPendingBit(TIM5, TIM_IT_CC1);            /* Drop a match of the previous compare value    */
+    TIM_ITConfig(TIM5, TIM_IT_CC1, ENABLE);
+}
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_HTmrDis()
+*
+* Description: Disable the interrupt of the high resolution timers, no timer is running.
+*
+* Arguments  : none.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_HTmrDis (void)
+{
+    TIM_ITConfig(TIM5, TIM_IT_CC1, DISABLE);
+}
+
+/*
+*********************************************************************************************************
+*                                          OS_CPU_HTmrPend()
+*
+* Description: Trigger the interrupt of the high resolution timers by software, when the counter passed
+*              the compare value while it was being programmed.
+*
+* Arguments  : none.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_HTmrPend (void)
+{
+    TIM_GenerateEvent(TIM5, TIM_EventSource_CC1);
+}
+#endif
+
 /******************* ӦHOOKS *************************/
 
 #if OS_APP_HOOKS_EN > 0
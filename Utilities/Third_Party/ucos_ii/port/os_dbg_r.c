@@ -60,6 +60,7 @@ INT16U  const  OSFlagWidth         = 0u;
 #endif
 INT16U  const  OSFlagMax           = OS_MAX_FLAGS;
 INT16U  const  OSFlagNameEn        = OS_FLAG_NAME_EN;
+INT16U  const  OSFlagPostDeferEn   = OS_FLAG_POST_DEFER_EN;
 
 INT16U  const  OSLowestPrio        = OS_LOWEST_PRIO;
 
@@ -77,6 +78,14 @@ INT16U  const  OSMemTblSize        = 0u;
 #endif
 INT16U  const  OSMutexEn           = OS_MUTEX_EN;
 
+INT16U  const  OSPIMutexEn         = OS_PIMUTEX_EN;
+INT16U  const  OSPIMutexMax        = OS_MAX_PIMUTEXES;          /* Number of PI mutexes                */
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+INT16U  const  OSPIMutexSize       = sizeof(OS_PIMUTEX);        /* Size in bytes of OS_PIMUTEX struct. */
+#else
+INT16U  const  OSPIMutexSize       = 0u;
+#endif
+
 INT16U  const  OSPtrSize           = sizeof(void *);            /* Size in Bytes of a pointer          */
 
 INT16U  const  OSQEn               = OS_Q_EN;
@@ -87,8 +96,32 @@ INT16U  const  OSQSize             = sizeof(OS_Q);              /* Size in bytes
 INT16U  const  OSQSize             = 0u;
 #endif
 
+INT16U  const  OSPoolEn            = OS_POOL_EN;
+#if (OS_POOL_EN > 0u) && (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
+INT16U  const  OSPoolNbrClasses    = OS_POOL_NBR_CLASSES;       /* Number of pool size classes         */
+INT16U  const  OSPoolSize          = sizeof(OS_POOL);           /* Size in bytes of OS_POOL structure  */
+#else
+INT16U  const  OSPoolNbrClasses    = 0u;
+INT16U  const  OSPoolSize          = 0u;
+#endif
+
 INT16U  const  OSRdyTblSize        = OS_RDY_TBL_SIZE;           /* Number of bytes in the ready table  */
 
+INT16U  const  OSTraceEn           = OS_TRACE_EN;
+#if OS_TRACE_EN > 0u
+INT16U  const  OSTraceBufSize      = OS_TRACE_BUF_SIZE;         /* Number of records in trace ring     */
+#else
+INT16U  const  OSTraceBufSize      = 0u;
+#endif
+
+INT16U  const  OSRingEn            = OS_RING_EN;
+INT16U  const  OSRingMax           = OS_MAX_RINGS;              /* Number of ring buffers              */
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+INT16U  const  OSRingSize          = sizeof(OS_RING);           /* Size in bytes of OS_RING structure  */
+#else
+INT16U  const  OSRingSize          = 0u;
+#endif
+
 INT16U  const  OSSemEn             = OS_SEM_EN;
 
 INT16U  const  OSStkWidth          = sizeof(OS_STK);            /* Size in Bytes of a stack entry      */
@@ -103,6 +136,8 @@ INT16U  const  OSTaskNameEn        = OS_TASK_NAME_EN;
 INT16U  const  OSTaskStatEn        = OS_TASK_STAT_EN;
 INT16U  const  OSTaskStatStkSize   = OS_TASK_STAT_STK_SIZE;
 INT16U  const  OSTaskStatStkChkEn  = OS_TASK_STAT_STK_CHK_EN;
+INT16U  const  OSTaskStkGuardEn    = OS_TASK_STK_GUARD_EN;
+INT16U  const  OSTaskStkWMEn       = OS_TASK_STK_WM_EN;
 INT16U  const  OSTaskSwHookEn      = OS_TASK_SW_HOOK_EN;
 INT16U  const  OSTaskRegTblSize    = OS_TASK_REG_TBL_SIZE;
 
@@ -130,6 +165,14 @@ INT16U  const  OSTmrWheelSize      = 0u;
 INT16U  const  OSTmrWheelTblSize   = 0u;
 #endif
 
+INT16U  const  OSHTmrEn            = OS_HTMR_EN;
+INT16U  const  OSHTmrCfgMax        = OS_HTMR_CFG_MAX;           /* Number of high resolution timers    */
+#if (OS_HTMR_EN > 0u) && (OS_HTMR_CFG_MAX > 0u)
+INT16U  const  OSHTmrSize          = sizeof(OS_HTMR);           /* Size in bytes of OS_HTMR structure  */
+#else
+INT16U  const  OSHTmrSize          = 0u;
+#endif
+
 #endif
 
 /*$PAGE*/
@@ -149,6 +192,9 @@ INT16U  const  OSDataSize = sizeof(OSCtxSwCtr)
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
                           + sizeof(OSFlagTbl)
                           + sizeof(OSFlagFreeList)
+#if OS_FLAG_POST_DEFER_EN > 0u
+                          + sizeof(OSFlagDeferList)
+#endif
 #endif
 #if OS_TASK_STAT_EN > 0u
                           + sizeof(OSCPUUsage)
@@ -164,10 +210,28 @@ INT16U  const  OSDataSize = sizeof(OSCtxSwCtr)
                           + sizeof(OSMemFreeList)
                           + sizeof(OSMemTbl)
 #endif
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+                          + sizeof(OSPIMutexFreeList)
+                          + sizeof(OSPIMutexTbl)
+#endif
 #if (OS_Q_EN > 0u) && (OS_MAX_QS > 0u)
                           + sizeof(OSQFreeList)
                           + sizeof(OSQTbl)
 #endif
+#if (OS_POOL_EN > 0u) && (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
+                          + sizeof(OSPoolTbl)
+                          + sizeof(OSPoolSizeMap)
+#endif
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+                          + sizeof(OSRingFreeList)
+                          + sizeof(OSRingTbl)
+#endif
+#if OS_TRACE_EN > 0u
+                          + sizeof(OSTraceTbl)
+                          + sizeof(OSTraceIn)
+                          + sizeof(OSTraceOut)
+                          + sizeof(OSTraceLostCtr)
+#endif
 #if OS_TIME_GET_SET_EN > 0u   
                           + sizeof(OSTime)
 #endif
@@ -181,6 +245,19 @@ INT16U  const  OSDataSize = sizeof(OSCtxSwCtr)
                           + sizeof(OSTmrFreeList)
                           + sizeof(OSTmrTaskStk)
                           + sizeof(OSTmrWheelTbl)
+#endif
+#if (OS_HTMR_EN > 0u) && (OS_HTMR_CFG_MAX > 0u)
+                          + sizeof(OSHTmrTbl)
+                          + sizeof(OSHTmrFreeList)
+                          + sizeof(OSHTmrWheelTbl)
+                          + sizeof(OSHTmrMapTbl)
+                          + sizeof(OSHTmrTime)
+                          + sizeof(OSHTmrExpList)
+                          + sizeof(OSHTmrDoneList)
+                          + sizeof(OSHTmrDoneTail)
+                          + sizeof(OSHTmrSem)
+                          + sizeof(OSHTmrBusy)
+                          + sizeof(OSHTmrTaskStk)
 #endif
                           + sizeof(OSIntNesting)
                           + sizeof(OSLockNesting)
@@ -245,6 +322,7 @@ void  OSDebugInit (void)
     ptemp = (void const *)&OSFlagWidth;
     ptemp = (void const *)&OSFlagMax;
     ptemp = (void const *)&OSFlagNameEn;
+    ptemp = (void const *)&OSFlagPostDeferEn;
 
     ptemp = (void const *)&OSLowestPrio;
 
@@ -258,14 +336,29 @@ void  OSDebugInit (void)
 
     ptemp = (void const *)&OSMutexEn;
 
+    ptemp = (void const *)&OSPIMutexEn;
+    ptemp = (void const *)&OSPIMutexMax;
+    ptemp = (void const *)&OSPIMutexSize;
+
     ptemp = (void const *)&OSPtrSize;
 
     ptemp = (void const *)&OSQEn;
     ptemp = (void const *)&OSQMax;
     ptemp = (void const *)&OSQSize;
 
+    ptemp = (void const *)&OSPoolEn;
+    ptemp = (void const *)&OSPoolNbrClasses;
+    ptemp = (void const *)&OSPoolSize;
+
     ptemp = (void const *)&OSRdyTblSize;
 
+    ptemp = (void const *)&OSTraceEn;
+    ptemp = (void const *)&OSTraceBufSize;
+
+    ptemp = (void const *)&OSRingEn;
+    ptemp = (void const *)&OSRingMax;
+    ptemp = (void const *)&OSRingSize;
+
     ptemp = (void const *)&OSSemEn;
 
     ptemp = (void const *)&OSStkWidth;
@@ -280,6 +373,8 @@ void  OSDebugInit (void)
     ptemp = (void const *)&OSTaskStatEn;
     ptemp = (void const *)&OSTaskStatStkSize;
     ptemp = (void const *)&OSTaskStatStkChkEn;
+    ptemp = (void const *)&OSTaskStkGuardEn;
+    ptemp = (void const *)&OSTaskStkWMEn;
     ptemp = (void const *)&OSTaskSwHookEn;
 
     ptemp = (void const *)&OSTCBPrioTblMax;
@@ -302,6 +397,10 @@ void  OSDebugInit (void)
 
     ptemp = (void const *)&OSTmrWheelSize;
     ptemp = (void const *)&OSTmrWheelTblSize;
+
+    ptemp = (void const *)&OSHTmrEn;
+    ptemp = (void const *)&OSHTmrCfgMax;
+    ptemp = (void const *)&OSHTmrSize;
 #endif
 
     ptemp = (void const *)&OSVersionNbr;
@@ -0,0 +1,123 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*
+*                                (c) Copyright 2006, Micrium, Weston, FL
+*                                          All Rights Reserved
+*
+*                                         POSIX (Linux) Host Port
+*
+* File      : OS_CPU.H
+* Version   : V2.91
+*
+* For       : x86, x86-64, ARM or any host with a POSIX C library providing <ucontext.h>
+* Mode      : Simulation, a single host thread runs all the tasks
+* Toolchain : GCC, Clang
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_H
+#define  OS_CPU_H
+
+
+#ifdef   OS_CPU_GLOBALS
+#define  OS_CPU_EXT
+#else
+#define  OS_CPU_EXT  extern
+#endif
+
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*                                         (Compiler Specific)
+*********************************************************************************************************
+*/
+
+typedef unsigned char  BOOLEAN;
+typedef unsigned char  INT8U;                    /* Unsigned  8 bit quantity                           */
+typedef signed   char  INT8S;                    /* Signed    8 bit quantity                           */
+typedef unsigned short INT16U;                   /* Unsigned 16 bit quantity                           */
+typedef signed   short INT16S;                   /* Signed   16 bit quantity                           */
+typedef unsigned int   INT32U;                   /* Unsigned 32 bit quantity                           */
+typedef signed   int   INT32S;                   /* Signed   32 bit quantity                           */
+typedef unsigned long long INT64U;               /* Unsigned 64 bit quantity                           */
+typedef float          FP32;                     /* Single precision floating point                    */
+typedef double         FP64;                     /* Double precision floating point                    */
+
+typedef unsigned int   OS_STK;                   /* Each stack entry is 32-bit wide                    */
+typedef unsigned int   OS_CPU_SR;                /* Simulated interrupt disable flag                   */
+typedef unsigned long  OS_CPU_ADDR;              /* Integer wide enough to hold a pointer (LP64 host)  */
+
+/*
+*********************************************************************************************************
+*                                                 POSIX
+*                                      Critical Section Management
+*
+* The tasks and the simulated tick all run on the same host thread, one at a time.  Nothing can preempt
+* the running code except a call into uC/OS-II, so 'disabling interrupts' only has to be accounted for:
+* OS_CPU_SR_Save() returns the current state of a simulated interrupt disable flag and sets it,
+* OS_CPU_SR_Restore() puts the saved state back.  OS_CPU_SimInt() must not be called with the flag set.
+*********************************************************************************************************
+*/
+
+#define  OS_CRITICAL_METHOD   3
+
+#if OS_CRITICAL_METHOD == 3
+#define  OS_ENTER_CRITICAL()  {cpu_sr = OS_CPU_SR_Save();}
+#define  OS_EXIT_CRITICAL()   {OS_CPU_SR_Restore(cpu_sr);}
+#endif
+
+/*
+*********************************************************************************************************
+*                                          POSIX Miscellaneous
+*********************************************************************************************************
+*/
+
+#define  OS_STK_GROWTH        1                   /* uC/OS-II task stacks are filled from HIGH to LOW  */
+
+#define  OS_TASK_SW()         OSCtxSw()
+
+#define  OS_TS_GET()          OS_CPU_TS_Get()     /* Time stamp, in nanoseconds (see OS_CPU_TS_Init())  */
+
+#ifndef  OS_CPU_HOST_STK_SIZE
+#define  OS_CPU_HOST_STK_SIZE (64u * 1024u)       /* Size of the host stack each task really runs on   */
+#endif
+
+/*
+*********************************************************************************************************
+*                                              PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if OS_CRITICAL_METHOD == 3                       /* See OS_CPU_C.C                                    */
+OS_CPU_SR  OS_CPU_SR_Save(void);
+void       OS_CPU_SR_Restore(OS_CPU_SR cpu_sr);
+#endif
+
+void       OSCtxSw(void);
+void       OSIntCtxSw(void);
+void       OSStartHighRdy(void);
+
+void       OS_CPU_MemBarrier(void);
+INT32U     OS_CPU_IntNbrGet(void);
+
+void       OS_CPU_TS_Init(void);
+INT32U     OS_CPU_TS_Get(void);
+
+void       OS_CPU_SysTickInit(void);
+
+#if OS_HTMR_EN > 0                                /* Simulated hardware timer of the HR timers         */
+void       OS_CPU_HTmrInit(void);
+INT32U     OS_CPU_HTmrGet(void);
+void       OS_CPU_HTmrSet(INT32U match);
+void       OS_CPU_HTmrDis(void);
+void       OS_CPU_HTmrPend(void);
+#endif
+
+void       OS_CPU_SimInt(void (*pisr)(void), INT32U nbr);  /* Run an ISR body on the simulated CPU    */
+void       OS_CPU_SimTick(void);                  /* Simulated SysTick interrupt                       */
+void       OS_CPU_SimStop(void);                  /* Make OSStart() return to its caller               */
+
+#endif
@@ -0,0 +1,765 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*
+*                                (c) Copyright 2006, Micrium, Weston, FL
+*                                          All Rights Reserved
+*
+*                                         POSIX (Linux) Host Port
+*
+* File      : OS_CPU_C.C
+* Version   : V2.91
+*
+* For       : x86, x86-64, ARM or any host with a POSIX C library providing <ucontext.h>
+* Mode      : Simulation, a single host thread runs all the tasks
+* Toolchain : GCC, Clang
+*
+* Note(s)   : 1) Every task runs on its own host stack (OS_CPU_HOST_STK_SIZE bytes) through a ucontext_t;
+*                the stack given to OSTaskCreate() only holds the task entry point so that the kernel
+*                sources can be built unchanged.  OSTCBStkPtr points to the task's host context.
+*             2) Only one context runs at a time and a switch only happens inside a uC/OS-II service,
+*                so the schedule is entirely deterministic.
+*             3) Time is simulated: the idle task calls OS_CPU_SimTick() on each pass, i.e. one tick
+*                elapses every time all the tasks are blocked.  A task that never blocks stops time.
+*             4) OS_CPU_SimStop() makes OSStart() return to its caller; calling OSStart() again resumes
+*                the simulation where it was stopped.
+*             5) The counter of the high resolution timers advances by OS_HTMR_CFG_CLK_HZ / OS_TICKS_PER_SEC
+*                per simulated tick.  Before the tick, it stops at every programmed compare value on the
+*                way and runs the timer interrupt there, so the timers expire in order at their exact
+*                counter values.
+*********************************************************************************************************
+*/
+
+#define  _XOPEN_SOURCE  600                      /* ucontext and clock_gettime()                       */
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+#include  <time.h>
+#include  <ucontext.h>
+
+#define  OS_CPU_GLOBALS
+#include "ucos_ii.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_SIM_TICK_EXC_NBR        15u      /* Reported by OS_CPU_IntNbrGet() in the tick, as SysTick */
+#define  OS_CPU_SIM_HTMR_EXC_NBR        66u      /* ... in the high resolution timer ISR, as TIM5          */
+
+#if OS_HTMR_EN > 0
+#define  OS_CPU_SIM_HTMR_STEP     (OS_HTMR_CFG_CLK_HZ / OS_TICKS_PER_SEC)  /* Counts per simulated tick    */
+#endif
+
+/*
+*********************************************************************************************************
+*                                           LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  os_cpu_frame {                  /* Placed on the uC/OS-II task stack by OSTaskStkInit()    */
+    void                (*OSCPUFrameTask)(void *p_arg);
+    void                 *OSCPUFrameArg;
+} OS_CPU_FRAME;
+
+typedef  struct  os_cpu_ctx {                    /* Host context of a task                                  */
+    ucontext_t            OSCPUCtx;
+    struct  os_cpu_ctx   *OSCPUCtxNext;          /* Link in the list of free contexts                       */
+    void                (*OSCPUCtxTask)(void *p_arg);
+    void                 *OSCPUCtxArg;
+    INT8U                 OSCPUCtxStk[OS_CPU_HOST_STK_SIZE];
+} OS_CPU_CTX;
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+#if OS_TMR_EN > 0
+static  INT16U           OSTmrCtr;
+#endif
+
+static  OS_CPU_SR        OSCPUIntDis;            /* Simulated interrupt disable flag                        */
+static  INT32U           OSCPUIntNbr;            /* Exception number of the simulated ISR, 0 in a task      */
+static  BOOLEAN          OSCPUIntCtxSwPend;      /* OSIntCtxSw() called, switch when the ISR returns        */
+
+static  ucontext_t       OSCPUMainCtx;           /* Context of the caller of OSStart()                      */
+static  OS_CPU_CTX      *OSCPUCtxFreeList;       /* Contexts of deleted tasks, ready to be reused           */
+
+static  struct timespec  OSCPUTSBase;
+
+#if OS_HTMR_EN > 0
+static  INT32U           OSCPUHTmrCnt;           /* Simulated counter of the high resolution timers         */
+static  INT32U           OSCPUHTmrMatch;         /* Compare value                                           */
+static  BOOLEAN          OSCPUHTmrIntEn;         /* Compare interrupt enabled                               */
+static  BOOLEAN          OSCPUHTmrIntPend;       /* Interrupt triggered by OS_CPU_HTmrPend()                */
+#endif
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_CtxSwitch(void);
+static  void  OS_CPU_TaskStart(void);
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*                                            (BEGINNING)
+*
+* Description: This function is called by OSInit() at the beginning of OSInit().
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts should be disabled during this call.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0 && OS_VERSION > 203
+void  OSInitHookBegin (void)
+{
+#if OS_TMR_EN > 0
+    OSTmrCtr = 0;
+#endif
+
+#if (OS_TASK_PROFILE_EN > 0) || (OS_TRACE_EN > 0)
+    OS_CPU_TS_Init();                            /* Start the clock used by OS_TS_GET()                */
+#endif
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*                                               (END)
+*
+* Description: This function is called by OSInit() at the end of OSInit().
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts should be disabled during this call.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0 && OS_VERSION > 203
+void  OSInitHookEnd (void)
+{
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          TASK CREATION HOOK
+*
+* Description: This function is called when a task is created.  It gives the task a host context that
+*              starts in OS_CPU_TaskStart().
+*
+* Arguments  : ptcb   is a pointer to the task control block of the task being created.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) The process is aborted if no memory is left for the host context.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0
+void  OSTaskCreateHook (OS_TCB *ptcb)
+{
+    OS_CPU_FRAME  frame;
+    OS_CPU_CTX   *pctx;
+
+
+    memcpy(&frame, ptcb->OSTCBStkPtr, sizeof(frame));      /* Entry point saved by OSTaskStkInit()     */
+    pctx = OSCPUCtxFreeList;
+    if (pctx != (OS_CPU_CTX *)0) {
+        OSCPUCtxFreeList = pctx->OSCPUCtxNext;
+    } else {
+        pctx = (OS_CPU_CTX *)malloc(sizeof(OS_CPU_CTX));
+        if (pctx == (OS_CPU_CTX *)0) {
+            fprintf(stderr, "os_cpu_c: out of memory for the context of task %u\n",
+                    (unsigned)ptcb->OSTCBPrio);
+            abort();
+        }
+    }
+    pctx->OSCPUCtxNext = (OS_CPU_CTX *)0;
+    pctx->OSCPUCtxTask = frame.OSCPUFrameTask;
+    pctx->OSCPUCtxArg  = frame.OSCPUFrameArg;
+    (void)getcontext(&pctx->OSCPUCtx);
+    pctx->OSCPUCtx.uc_stack.ss_sp   = pctx->OSCPUCtxStk;
+    pctx->OSCPUCtx.uc_stack.ss_size = sizeof(pctx->OSCPUCtxStk);
+    pctx->OSCPUCtx.uc_link          = (ucontext_t *)0;
+    makecontext(&pctx->OSCPUCtx, OS_CPU_TaskStart, 0);
+    ptcb->OSTCBStkPtr  = (OS_STK *)(void *)pctx;
+
+#if OS_APP_HOOKS_EN > 0
+    App_TaskCreateHook(ptcb);
+#endif
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                           TASK DELETION HOOK
+*
+* Description: This function is called when a task is deleted.  The host context of the task is kept
+*              for the next task created.
+*
+* Arguments  : ptcb   is a pointer to the task control block of the task being deleted.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) A task deleting itself still runs on its host stack until OSTaskDel() switches to the
+*                 next task.  This is safe since no task can be created in between.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0
+void  OSTaskDelHook (OS_TCB *ptcb)
+{
+    OS_CPU_CTX  *pctx;
+
+
+#if OS_APP_HOOKS_EN > 0
+    App_TaskDelHook(ptcb);
+#endif
+    pctx               = (OS_CPU_CTX *)(void *)ptcb->OSTCBStkPtr;
+    pctx->OSCPUCtxNext = OSCPUCtxFreeList;
+    OSCPUCtxFreeList   = pctx;
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             IDLE TASK HOOK
+*
+* Description: This function is called by the idle task.  All the tasks are blocked: advance the
+*              simulated time by one tick.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts are enabled during this call.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0 && OS_VERSION >= 251
+void  OSTaskIdleHook (void)
+{
+#if OS_APP_HOOKS_EN > 0
+    App_TaskIdleHook();
+#endif
+    OS_CPU_SimTick();
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                            TASK RETURN HOOK
+*
+* Description: This function is called if a task accidentally returns, just before it is deleted.
+*
+* Arguments  : ptcb   is a pointer to the task control block of the task that returned.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0
+void  OSTaskReturnHook (OS_TCB *ptcb)
+{
+    (void)ptcb;
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                           STATISTIC TASK HOOK
+*
+* Description: This function is called every second by uC/OS-II's statistics task.  This allows your
+*              application to add functionality to the statistics task.
+*
+* Arguments  : none
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0
+void  OSTaskStatHook (void)
+{
+#if OS_APP_HOOKS_EN > 0
+    App_TaskStatHook();
+#endif
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        INITIALIZE A TASK'S STACK
+*
+* Description: This function is called by either OSTaskCreate() or OSTaskCreateExt() to initialize the
+*              stack frame of the task being created.  The task runs on a host stack (see
+*              OSTaskCreateHook()), only its entry point and argument are stored here.
+*
+* Arguments  : task          is a pointer to the task code
+*
+*              p_arg         is a pointer to a user supplied data area that will be passed to the task
+*                            when the task first executes.
+*
+*              ptos          is a pointer to the top of stack, i.e. the HIGHEST valid address of the
+*                            stack since OS_STK_GROWTH is set to 1.
+*
+*              opt           specifies options that can be used to alter the behavior of OSTaskStkInit().
+*                            (see uCOS_II.H for OS_TASK_OPT_xxx).
+*
+* Returns    : The location of the entry point on the stack, read back by OSTaskCreateHook().
+*********************************************************************************************************
+*/
+OS_STK *OSTaskStkInit (void (*task)(void *p_arg), void *p_arg, OS_STK *ptos, INT16U opt)
+{
+    OS_CPU_FRAME  frame;
+    OS_STK       *stk;
+
+
+    (void)opt;                                   /* 'opt' is not used, prevent warning                 */
+    frame.OSCPUFrameTask = task;
+    frame.OSCPUFrameArg  = p_arg;
+    stk = ptos - (sizeof(frame) + sizeof(OS_STK) - 1u) / sizeof(OS_STK) + 1u;
+    memcpy(stk, &frame, sizeof(frame));          /* The stack may not be aligned for a pointer         */
+    return (stk);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.  This allows you to perform other
+*              operations during a context switch.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) It is assumed that the global pointer 'OSTCBHighRdy' points to the TCB of the task that
+*                 will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCur' points to the
+*                 task being switched out (i.e. the preempted task).
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0) && (OS_TASK_SW_HOOK_EN > 0)
+void  OSTaskSwHook (void)
+{
+#if OS_TASK_PROFILE_EN > 0
+    INT32U  ts;
+
+
+    ts                             = OS_TS_GET();
+    OSTCBCur->OSTCBCyclesTot      += ts - OSTCBCur->OSTCBCyclesStart;  /* Charge the task switched out */
+    OSTCBHighRdy->OSTCBCyclesStart = ts;
+#endif
+#if OS_TRACE_EN > 0
+    OS_TraceTaskSw();
+#endif
+#if OS_APP_HOOKS_EN > 0
+    App_TaskSwHook();
+#endif
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                           OS_TCBInit() HOOK
+*
+* Description: This function is called by OS_TCBInit() after setting up most of the TCB.
+*
+* Arguments  : ptcb    is a pointer to the TCB of the task being created.
+*
+* Note(s)    : 1) Interrupts may or may not be ENABLED during this call.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0 && OS_VERSION > 203
+void  OSTCBInitHook (OS_TCB *ptcb)
+{
+#if OS_APP_HOOKS_EN > 0
+    App_TCBInitHook(ptcb);
+#else
+    (void)ptcb;                                  /* Prevent compiler warning                           */
+#endif
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                               TICK HOOK
+*
+* Description: This function is called every tick.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts may or may not be ENABLED during this call.
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0) && (OS_TIME_TICK_HOOK_EN > 0)
+void  OSTimeTickHook (void)
+{
+#if OS_APP_HOOKS_EN > 0
+    App_TimeTickHook();
+#endif
+#if OS_TMR_EN > 0
+    OSTmrCtr++;
+    if (OSTmrCtr >= (OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC)) {
+        OSTmrCtr = 0;
+        OSTmrSignal();
+    }
+#endif
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       CRITICAL SECTION MANAGEMENT
+*
+* Description: Save the simulated interrupt disable flag and set it / restore it.
+*
+* Arguments  : cpu_sr    is the value returned by OS_CPU_SR_Save().
+*
+* Returns    : OS_CPU_SR_Save() returns the previous state of the flag.
+*********************************************************************************************************
+*/
+
+OS_CPU_SR  OS_CPU_SR_Save (void)
+{
+    OS_CPU_SR  cpu_sr;
+
+
+    cpu_sr      = OSCPUIntDis;
+    OSCPUIntDis = 1u;
+    return (cpu_sr);
+}
+
+void  OS_CPU_SR_Restore (OS_CPU_SR cpu_sr)
+{
+    OSCPUIntDis = cpu_sr;
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         START MULTITASKING
+*
+* Description: Called by OSStart() to run the highest priority task.  Also resumes the simulation after
+*              OS_CPU_SimStop().
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Returns only once a task calls OS_CPU_SimStop().
+*********************************************************************************************************
+*/
+
+void  OSStartHighRdy (void)
+{
+    OS_CPU_CTX  *pctx;
+
+
+#if (OS_CPU_HOOKS_EN > 0) && (OS_TASK_SW_HOOK_EN > 0)
+    OSTaskSwHook();
+#endif
+    OSRunning = OS_TRUE;
+    pctx      = (OS_CPU_CTX *)(void *)OSTCBHighRdy->OSTCBStkPtr;
+    (void)swapcontext(&OSCPUMainCtx, &pctx->OSCPUCtx);
+}
+
+/*
+*********************************************************************************************************
+*                                    PERFORM A CONTEXT SWITCH
+*
+* Description: OSCtxSw() is called by OS_Sched() to switch to 'OSTCBHighRdy' at task level.
+*              OSIntCtxSw() is called by OSIntExit(); as PendSV does on the target, the switch is
+*              deferred until the simulated ISR returns (see OS_CPU_SimInt()).
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts are disabled during these calls.
+*********************************************************************************************************
+*/
+
+void  OSCtxSw (void)
+{
+    OS_CPU_CtxSwitch();
+}
+
+void  OSIntCtxSw (void)
+{
+    OSCPUIntCtxSwPend = OS_TRUE;
+}
+
+static  void  OS_CPU_CtxSwitch (void)
+{
+    OS_CPU_CTX  *pfrom;
+    OS_CPU_CTX  *pto;
+
+
+#if OS_FLAG_POST_DEFER_EN > 0u
+    OS_SchedDeferred();                          /* Complete the posts deferred by ISRs, as PendSV    */
+#endif
+#if (OS_CPU_HOOKS_EN > 0) && (OS_TASK_SW_HOOK_EN > 0)
+    OSTaskSwHook();
+#endif
+    pfrom     = (OS_CPU_CTX *)(void *)OSTCBCur->OSTCBStkPtr;
+    pto       = (OS_CPU_CTX *)(void *)OSTCBHighRdy->OSTCBStkPtr;
+    OSTCBCur  = OSTCBHighRdy;
+    OSPrioCur = OSPrioHighRdy;
+    (void)swapcontext(&pfrom->OSCPUCtx, &pto->OSCPUCtx);
+}
+
+/*
+*********************************************************************************************************
+*                                            TASK ENTRY
+*
+* Description: First code run in the host context of every task.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts are enabled when your task starts executing.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_TaskStart (void)
+{
+    OS_CPU_CTX  *pctx;
+
+
+    pctx        = (OS_CPU_CTX *)(void *)OSTCBCur->OSTCBStkPtr;
+    OSCPUIntDis = 0u;
+    pctx->OSCPUCtxTask(pctx->OSCPUCtxArg);
+    OS_TaskReturn();                             /* Deletes the task, never returns                    */
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         SIMULATED INTERRUPTS
+*
+* Description: OS_CPU_SimInt() runs 'pisr' as an interrupt service routine: between OSIntEnter() and
+*              OSIntExit(), then switches to a task made ready by the ISR, if any.
+*              OS_CPU_SimTick() simulates the SysTick interrupt by running OSTimeTick() this way, after
+*              the interrupts of the high resolution timers falling within the tick.
+*
+* Arguments  : pisr      is the ISR body, it may post to the kernel objects as a real ISR would.
+*
+*              nbr       is the exception number returned by OS_CPU_IntNbrGet() while 'pisr' runs.
+*
+* Note(s)    : 1) Must be called from a task (or from an ISR for a nested interrupt) with interrupts
+*                 enabled.  Time stays frozen unless OS_CPU_SimTick() is called.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SimInt (void (*pisr)(void), INT32U nbr)
+{
+    INT32U     nbr_prev;
+#if OS_CRITICAL_METHOD == 3
+    OS_CPU_SR  cpu_sr = 0;
+#endif
+
+
+    nbr_prev    = OSCPUIntNbr;
+    OSCPUIntNbr = nbr;
+    OSIntEnter();
+    pisr();
+    OSIntExit();
+    OSCPUIntNbr = nbr_prev;
+    OS_ENTER_CRITICAL();
+    if ((OSCPUIntCtxSwPend == OS_TRUE) && (OSIntNesting == 0u)) {
+        OSCPUIntCtxSwPend = OS_FALSE;            /* Return from the ISR to the new task                */
+        OS_CPU_CtxSwitch();
+    }
+    OS_EXIT_CRITICAL();
+}
+
+void  OS_CPU_SimTick (void)
+{
+#if OS_HTMR_EN > 0
+    INT32U  end;
+
+
+    end = OSCPUHTmrCnt + OS_CPU_SIM_HTMR_STEP;
+    for (;;) {
+        if ((OSCPUHTmrIntEn == OS_TRUE) && (OSCPUHTmrIntPend == OS_TRUE)) {
+            OSCPUHTmrIntPend = OS_FALSE;
+        } else if ((OSCPUHTmrIntEn == OS_TRUE) &&                   /* Compare value within the tick ...  */
+                   ((INT32U)(OSCPUHTmrMatch - OSCPUHTmrCnt - 1u) < (INT32U)(end - OSCPUHTmrCnt))) {
+            OSCPUHTmrCnt = OSCPUHTmrMatch;                          /* ... run the interrupt at the match */
+        } else {
+            break;
+        }
+        OS_CPU_SimInt(OSHTmrSignal, OS_CPU_SIM_HTMR_EXC_NBR);
+    }
+    OSCPUHTmrCnt = end;
+#endif
+    OS_CPU_SimInt(OSTimeTick, OS_CPU_SIM_TICK_EXC_NBR);
+}
+
+/*
+*********************************************************************************************************
+*                                          STOP THE SIMULATION
+*
+* Description: Called by a task to make OSStart() return to its caller, e.g. at the end of a test.
+*              Calling OSStart() again resumes the simulation.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Nothing but query services should be used outside OSStart().
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SimStop (void)
+{
+    OS_CPU_CTX  *pctx;
+    OS_CPU_SR    int_dis;
+
+
+    int_dis   = OSCPUIntDis;
+    OSRunning = OS_FALSE;
+    pctx      = (OS_CPU_CTX *)(void *)OSTCBCur->OSTCBStkPtr;
+    (void)swapcontext(&pctx->OSCPUCtx, &OSCPUMainCtx);
+    OSCPUIntDis = int_dis;
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         MISCELLANEOUS SERVICES
+*
+* Description: OS_CPU_MemBarrier()  orders memory accesses, as DMB does on the target.  All the code runs
+*                                   on one host thread and a simulated ISR is a function call, so only
+*                                   the compiler has to be kept from reordering: a hardware fence would
+*                                   cost the host far more than DMB costs the target.
+*              OS_CPU_IntNbrGet()   returns the exception number of the simulated ISR, 0 in a task.
+*              OS_CPU_SysTickInit() nothing to do, the tick is simulated by the idle task.
+*              OS_CPU_TS_Init()     starts the clock read by OS_TS_GET().
+*              OS_CPU_TS_Get()      returns the nanoseconds elapsed since OS_CPU_TS_Init(), wrapping
+*                                   around every 2^32 ns.
+*
+* Arguments  : none
+*********************************************************************************************************
+*/
+
+void  OS_CPU_MemBarrier (void)
+{
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+INT32U  OS_CPU_IntNbrGet (void)
+{
+    return (OSCPUIntNbr);
+}
+
+void  OS_CPU_SysTickInit (void)
+{
+}
+
+void  OS_CPU_TS_Init (void)
+{
+    (void)clock_gettime(CLOCK_MONOTONIC, &OSCPUTSBase);
+}
+
+INT32U  OS_CPU_TS_Get (void)
+{
+    struct timespec  now;
+
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((INT32U)((now.tv_sec - OSCPUTSBase.tv_sec) * 1000000000LL + (now.tv_nsec - OSCPUTSBase.tv_nsec)));
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  HIGH RESOLUTION TIMER HARDWARE
+*
+* Description: Simulated counter and compare register of the high resolution timers (OS_HTMR.C), see
+*              OS_CPU_SimTick().
+*
+*              OS_CPU_HTmrInit()    resets the counter.
+*              OS_CPU_HTmrGet()     returns the counter.
+*              OS_CPU_HTmrSet()     programs the compare value and enables the interrupt.
+*              OS_CPU_HTmrDis()     disables the interrupt.
+*              OS_CPU_HTmrPend()    triggers the interrupt, it runs at the next simulated tick.
+*********************************************************************************************************
+*/
+
+#if OS_HTMR_EN > 0
+void  OS_CPU_HTmrInit (void)
+{
+    OSCPUHTmrCnt     = 0u;
+    OSCPUHTmrMatch   = 0u;
+    OSCPUHTmrIntEn   = OS_FALSE;
+    OSCPUHTmrIntPend = OS_FALSE;
+}
+
+INT32U  OS_CPU_HTmrGet (void)
+{
+    return (OSCPUHTmrCnt);
+}
+
+void  OS_CPU_HTmrSet (INT32U match)
+{
+    OSCPUHTmrMatch   = match;
+    OSCPUHTmrIntPend = OS_FALSE;
+    OSCPUHTmrIntEn   = OS_TRUE;
+}
+
+void  OS_CPU_HTmrDis (void)
+{
+    OSCPUHTmrIntEn   = OS_FALSE;
+}
+
+void  OS_CPU_HTmrPend (void)
+{
+    OSCPUHTmrIntPend = OS_TRUE;
+}
+#endif
+
+/*$PAGE*/
+/******************* Application hooks *************************/
+
+#if OS_APP_HOOKS_EN > 0
+void App_TaskCreateHook(OS_TCB *ptcb)
+{
+	(void) ptcb;
+}
+
+void App_TaskDelHook(OS_TCB *ptcb)
+{
+	(void) ptcb;
+}
+
+void App_TaskIdleHook(void)
+{
+
+}
+
+void App_TaskStatHook(void)
+{
+
+}
+
+#if OS_TASK_SW_HOOK_EN > 0
+void App_TaskSwHook(void)
+{
+
+}
+#endif
+
+void App_TCBInitHook(OS_TCB *ptcb)
+{
+	(void)ptcb;
+}
+
+#if OS_TIME_TICK_HOOK_EN > 0
+void App_TimeTickHook(void)
+{
+
+}
+#endif
+
+
+#endif /* OS_APP_HOOKS_EN */
@@ -0,0 +1,203 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                                           Kernel Benchmarks
+*
+* File      : BENCH_CORE.C
+* Version   : V2.91
+*
+* Note(s)   : 1) Measures the context switch rate, the latency of a semaphore post from a task and from an
+*                ISR to the task it readies, and the cost of OSTimeTick() as the number of tasks grows.
+*             2) A context switch of the host port is a swapcontext(), which saves and restores the signal
+*                mask with a system call: the switch times are those of the host, not of the target.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_TASK_PRIO             10u
+#define  BENCH_PEER_TASK_PRIO         5u
+#define  BENCH_DLY_TASK_PRIO         12u         /* First priority of the delayed tasks                */
+
+#define  BENCH_SW_NBR            100000u         /* Round trips of the context switch benchmark        */
+#define  BENCH_LAT_NBR            20000u         /* Samples of the latency benchmarks                  */
+#define  BENCH_TICK_NBR          100000u         /* Ticks per task count, after as many to warm up     */
+
+#define  BENCH_INT_NBR               40u         /* Exception number of the posting ISR                */
+#define  BENCH_TICK_INT_NBR          15u         /* ... and of the tick, as SysTick                    */
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_EVENT  *BenchSem;                     /* Posted to the peer task                            */
+static  INT64U     BenchPostTime;                /* Time of the post                                   */
+static  INT64U     BenchWakeTime;                /* Time the peer task returned from OSSemPend()       */
+
+static  const  INT8U  BenchTaskNbrTbl[] = {0u, 8u, 16u, 32u, 48u};
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TASKS
+*********************************************************************************************************
+*/
+
+static  void  BenchPeerTask (void *p_arg)
+{
+    INT8U  err;
+
+
+    (void)p_arg;
+    for (;;) {
+        OSSemPend(BenchSem, 0u, &err);
+        BenchWakeTime = OS_TestTimeGet();
+    }
+}
+
+static  void  BenchDlyTask (void *p_arg)
+{
+    (void)p_arg;
+    for (;;) {
+        OSTimeDly(0x7FFFFFFFu);                  /* Never expires during the benchmark                 */
+    }
+}
+
+static  void  BenchPostISR (void)
+{
+    BenchPostTime = OS_TestTimeGet();
+    (void)OSSemPost(BenchSem);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCHMARKS
+*********************************************************************************************************
+*/
+
+static  void  BenchCtxSw (void)
+{
+    INT64U  start;
+    INT32U  i;
+
+
+    start = OS_TestTimeGet();
+    for (i = 0u; i < BENCH_SW_NBR; i++) {        /* The peer runs and pends again: two switches        */
+        (void)OSSemPost(BenchSem);
+    }
+    OS_TestRatePrint("context switch", 2u * BENCH_SW_NBR, OS_TestTimeGet() - start);
+}
+
+static  void  BenchPostPend (void)
+{
+    OS_TEST_STAT  stat;
+    OS_EVENT     *psem;
+    INT64U        start;
+    INT8U         err;
+    INT32U        i;
+
+
+    psem = OSSemCreate(0u);                      /* No task waits on this one                          */
+    OS_TestStatInit(&stat);                      /* Post then pend, the semaphore is available         */
+    for (i = 0u; i < BENCH_LAT_NBR; i++) {
+        start = OS_TestTimeGet();
+        (void)OSSemPost(psem);
+        OSSemPend(psem, 0u, &err);
+        OS_TestStatAdd(&stat, OS_TestTimeGet() - start);
+    }
+    OS_TestStatPrint("OSSemPost() + OSSemPend(), no wait", &stat);
+}
+
+static  void  BenchPostLatency (void)
+{
+    OS_TEST_STAT  stat;
+    INT32U        i;
+
+
+    OS_TestStatInit(&stat);                      /* Post from a task to a higher priority task         */
+    for (i = 0u; i < BENCH_LAT_NBR; i++) {
+        BenchPostTime = OS_TestTimeGet();
+        (void)OSSemPost(BenchSem);
+        OS_TestStatAdd(&stat, BenchWakeTime - BenchPostTime);
+    }
+    OS_TestStatPrint("task post to pending HPT, until it runs", &stat);
+
+    OS_TestStatInit(&stat);                      /* Post from an ISR, switch on the ISR exit           */
+    for (i = 0u; i < BENCH_LAT_NBR; i++) {
+        OS_CPU_SimInt(BenchPostISR, BENCH_INT_NBR);
+        OS_TestStatAdd(&stat, BenchWakeTime - BenchPostTime);
+    }
+    OS_TestStatPrint("ISR  post to pending task, until it runs", &stat);
+}
+
+static  void  BenchTick (void)
+{
+    INT64U  start;
+    INT32U  i;
+    INT8U   nbr;
+    INT8U   ix;
+    char    name[48];
+
+
+    nbr = 0u;
+    for (ix = 0u; ix < sizeof(BenchTaskNbrTbl); ix++) {
+        while (nbr < BenchTaskNbrTbl[ix]) {      /* Add delayed tasks up to the count                  */
+            OS_TestTaskCreate(BenchDlyTask, (void *)0, (INT8U)(BENCH_DLY_TASK_PRIO + nbr));
+            nbr++;
+        }
+        for (i = 0u; i < BENCH_TICK_NBR; i++) {
+            OS_CPU_SimInt(OSTimeTick, BENCH_TICK_INT_NBR);
+        }
+        start = OS_TestTimeGet();
+        for (i = 0u; i < BENCH_TICK_NBR; i++) {
+            OS_CPU_SimInt(OSTimeTick, BENCH_TICK_INT_NBR);
+        }
+        (void)snprintf(name, sizeof(name), "OSTimeTick(), %2u delayed tasks", (unsigned)nbr);
+        OS_TestRatePrint(name, BENCH_TICK_NBR, OS_TestTimeGet() - start);
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCH TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchTask (void *p_arg)
+{
+    (void)p_arg;
+    BenchSem = OSSemCreate(0u);
+    OS_TestTaskCreate(BenchPeerTask, (void *)0, BENCH_PEER_TASK_PRIO);
+
+    printf("bench_core:\n");
+    BenchCtxSw();
+    BenchPostLatency();
+    BenchPostPend();
+    BenchTick();
+    OS_CPU_SimStop();
+}
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    return (OS_TestRun("bench_core", BenchTask, BENCH_TASK_PRIO));
+}
@@ -0,0 +1,241 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                                   Benchmark of the Event Flag Groups
+*
+* File      : BENCH_FLAG.C
+* Version   : V2.91
+*
+* Note(s)   : 1) Measures the latency of OSFlagPost() from a task and from an ISR to the task it readies,
+*                until that task runs.  From an ISR the wait list is checked at the context switch when
+*                OS_FLAG_POST_DEFER_EN is set (see the notes of OS_FLAG.C).
+*             2) Measures the cost of a post against the number of buckets that it does not satisfy, and
+*                against the number of tasks of the one bucket that it readies.
+*********************************************************************************************************
+*/
+
+#include  <stdint.h>
+#include  <stdio.h>
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_TASK_PRIO             10u
+#define  BENCH_PEER_TASK_PRIO         5u
+#define  BENCH_WAIT_TASK_PRIO        20u         /* First priority of the tasks of the scaling benches */
+
+#define  BENCH_LAT_NBR            20000u         /* Samples of the latency benchmarks                  */
+#define  BENCH_POST_NBR          100000u         /* Posts of the scaling benchmarks                    */
+#define  BENCH_WAKE_NBR            2000u         /* Rounds of the bucket wake-up benchmark             */
+
+#define  BENCH_INT_NBR               40u         /* Exception number of the posting ISR                */
+
+#define  BENCH_FLAG_PEER     ((OS_FLAGS)0x80000000uL)
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_FLAG_GRP  *BenchGrp;                  /* Pended on by the peer task                         */
+static  OS_FLAG_GRP  *BenchWaitGrp;              /* Pended on by the tasks of the scaling benchmarks   */
+static  INT64U        BenchPostTime;             /* Time of the post                                   */
+static  INT64U        BenchWakeTime;             /* Time the peer task returned from OSFlagPend()      */
+
+static  const  INT8U  BenchTaskNbrTbl[] = {1u, 8u, 16u, 32u};
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TASKS
+*********************************************************************************************************
+*/
+
+static  void  BenchPeerTask (void *p_arg)
+{
+    INT8U  err;
+
+
+    (void)p_arg;
+    for (;;) {
+        (void)OSFlagPend(BenchGrp, BENCH_FLAG_PEER, OS_FLAG_WAIT_SET_ANY + OS_FLAG_CONSUME, 0u, &err);
+        BenchWakeTime = OS_TestTimeGet();
+    }
+}
+
+static  void  BenchWaitTask (void *p_arg)        /* Waits for the flags passed in 'p_arg'              */
+{
+    INT8U  err;
+
+
+    for (;;) {
+        (void)OSFlagPend(BenchWaitGrp, (OS_FLAGS)(uintptr_t)p_arg, OS_FLAG_WAIT_SET_ALL, 0u, &err);
+    }
+}
+
+static  void  BenchPostISR (void)
+{
+    INT8U  err;
+
+
+    BenchPostTime = OS_TestTimeGet();
+    (void)OSFlagPost(BenchGrp, BENCH_FLAG_PEER, OS_FLAG_SET, &err);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchWaitCreate (INT8U    nbr,     /* 'nbr' tasks in as many buckets, or all on bit 0    */
+                               BOOLEAN  distinct)
+{
+    INT8U  i;
+    INT8U  err;
+
+
+    BenchWaitGrp = OSFlagCreate((OS_FLAGS)0, &err);
+    for (i = 0u; i < nbr; i++) {
+        OS_TestTaskCreate(BenchWaitTask,
+                          (void *)(uintptr_t)((distinct == OS_TRUE) ? ((i + 1uL) << 1) : 1uL),
+                          (INT8U)(BENCH_WAIT_TASK_PRIO + i));
+    }
+    OSTimeDly(1u);                               /* Let the tasks pend, below our priority             */
+}
+
+static  void  BenchWaitDel (INT8U  nbr)
+{
+    INT8U  i;
+    INT8U  err;
+
+
+    for (i = 0u; i < nbr; i++) {
+        (void)OSTaskDel((INT8U)(BENCH_WAIT_TASK_PRIO + i));
+    }
+    (void)OSFlagDel(BenchWaitGrp, OS_DEL_ALWAYS, &err);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCHMARKS
+*********************************************************************************************************
+*/
+
+static  void  BenchPostLatency (void)
+{
+    OS_TEST_STAT  stat;
+    INT32U        i;
+    INT8U         err;
+
+
+    OS_TestStatInit(&stat);                      /* Post from a task to a higher priority task         */
+    for (i = 0u; i < BENCH_LAT_NBR; i++) {
+        BenchPostTime = OS_TestTimeGet();
+        (void)OSFlagPost(BenchGrp, BENCH_FLAG_PEER, OS_FLAG_SET, &err);
+        OS_TestStatAdd(&stat, BenchWakeTime - BenchPostTime);
+    }
+    OS_TestStatPrint("task post to pending HPT, until it runs", &stat);
+
+    OS_TestStatInit(&stat);                      /* Post from an ISR, switch on the ISR exit           */
+    for (i = 0u; i < BENCH_LAT_NBR; i++) {
+        OS_CPU_SimInt(BenchPostISR, BENCH_INT_NBR);
+        OS_TestStatAdd(&stat, BenchWakeTime - BenchPostTime);
+    }
+    OS_TestStatPrint("ISR  post to pending task, until it runs", &stat);
+}
+
+static  void  BenchPostBuckets (void)            /* Buckets checked, none satisfied                    */
+{
+    INT64U  start;
+    INT32U  i;
+    INT8U   ix;
+    INT8U   nbr;
+    INT8U   err;
+    char    name[48];
+
+
+    for (ix = 0u; ix < sizeof(BenchTaskNbrTbl) / sizeof(BenchTaskNbrTbl[0]); ix++) {
+        nbr = BenchTaskNbrTbl[ix];
+        BenchWaitCreate(nbr, OS_TRUE);
+        start = OS_TestTimeGet();
+        for (i = 0u; i < BENCH_POST_NBR; i++) {
+            (void)OSFlagPost(BenchWaitGrp, 0x1u, OS_FLAG_SET, &err);
+        }
+        (void)snprintf(name, sizeof(name), "post, %2u buckets not satisfied", (unsigned)nbr);
+        OS_TestRatePrint(name, BENCH_POST_NBR, OS_TestTimeGet() - start);
+        BenchWaitDel(nbr);
+    }
+}
+
+static  void  BenchPostWake (void)               /* One bucket of 'nbr' tasks readied by each post     */
+{
+    OS_TEST_STAT  stat;
+    INT64U        start;
+    INT32U        i;
+    INT8U         ix;
+    INT8U         nbr;
+    INT8U         err;
+    char          name[48];
+
+
+    for (ix = 0u; ix < sizeof(BenchTaskNbrTbl) / sizeof(BenchTaskNbrTbl[0]); ix++) {
+        nbr = BenchTaskNbrTbl[ix];
+        BenchWaitCreate(nbr, OS_FALSE);
+        OS_TestStatInit(&stat);
+        for (i = 0u; i < BENCH_WAKE_NBR; i++) {
+            start = OS_TestTimeGet();
+            (void)OSFlagPost(BenchWaitGrp, 0x1u, OS_FLAG_SET, &err);
+            OS_TestStatAdd(&stat, OS_TestTimeGet() - start);
+            (void)OSFlagPost(BenchWaitGrp, 0x1u, OS_FLAG_CLR, &err);
+            OSTimeDly(1u);                       /* The tasks run and pend again, not measured         */
+        }
+        (void)snprintf(name, sizeof(name), "post readying a bucket of %2u tasks", (unsigned)nbr);
+        OS_TestStatPrint(name, &stat);
+        BenchWaitDel(nbr);
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCH TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchTask (void *p_arg)
+{
+    INT8U  err;
+
+
+    (void)p_arg;
+    BenchGrp = OSFlagCreate((OS_FLAGS)0, &err);
+    OS_TestTaskCreate(BenchPeerTask, (void *)0, BENCH_PEER_TASK_PRIO);
+
+    printf("bench_flag:\n");
+    BenchPostLatency();
+    BenchPostBuckets();
+    BenchPostWake();
+    OS_CPU_SimStop();
+}
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    return (OS_TestRun("bench_flag", BenchTask, BENCH_TASK_PRIO));
+}
@@ -0,0 +1,204 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                                Benchmark of the High Resolution Timers
+*
+* File      : BENCH_HTMR.C
+* Version   : V2.91
+*
+* Note(s)   : 1) Measures OSHTmrStart() + OSHTmrStop() for delays landing on different levels of the timing
+*                wheel, with and without other running timers, and the restart of a running timer.
+*             2) Measures the cost of an expiry: BENCH_TMR_NBR periodic timers run for BENCH_TICK_NBR
+*                simulated ticks, and the time of the ticks without timers is subtracted.  The periods go
+*                up to several wheel levels, so the cost includes the cascades and the simulated timer
+*                interrupts; a task level callback adds a switch to the timer task and back.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_TASK_PRIO             10u
+
+#define  BENCH_NBR               100000u         /* Start/stop pairs per measure                       */
+#define  BENCH_TMR_NBR               60u         /* Other running timers, or timers of the expiry bench*/
+#define  BENCH_TICK_NBR           10000u         /* Simulated ticks of the expiry benchmark            */
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_HTMR  *BenchTmr;                      /* Timer started and stopped                          */
+static  OS_HTMR  *BenchTmrTbl[BENCH_TMR_NBR];    /* Other timers                                       */
+static  INT32U    BenchCallbackCtr;              /* Number of callbacks                                */
+
+static  const  INT32U  BenchDlyTbl[] = {10u, 1000u, 100000u, 10000000u};
+
+/*
+*********************************************************************************************************
+*                                          LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchCallback (void *ptmr,
+                             void *parg)
+{
+    (void)ptmr;
+    (void)parg;
+    BenchCallbackCtr++;
+}
+
+static  void  BenchTmrCreate (INT8U  opt)        /* Timers of periods spread over the wheel levels     */
+{
+    INT32U  i;
+    INT8U   err;
+
+
+    for (i = 0u; i < BENCH_TMR_NBR; i++) {
+        BenchTmrTbl[i] = OSHTmrCreate(100u + (i * i * 40u), opt, BenchCallback, (void *)0, &err);
+        OS_TEST_CHECK(err == OS_ERR_NONE);
+    }
+}
+
+static  void  BenchTmrDel (void)
+{
+    INT32U  i;
+    INT8U   err;
+
+
+    for (i = 0u; i < BENCH_TMR_NBR; i++) {
+        (void)OSHTmrDel(BenchTmrTbl[i], &err);
+    }
+}
+
+static  void  BenchTmrStart (void)
+{
+    INT32U  i;
+    INT8U   err;
+
+
+    for (i = 0u; i < BENCH_TMR_NBR; i++) {
+        (void)OSHTmrStart(BenchTmrTbl[i], 1u + i, &err);
+    }
+}
+
+static  INT64U  BenchTicks (void)                /* Runs the ticks, returns their duration             */
+{
+    INT64U  start;
+    INT32U  i;
+
+
+    start = OS_TestTimeGet();
+    for (i = 0u; i < BENCH_TICK_NBR; i++) {
+        OS_CPU_SimTick();
+    }
+    return (OS_TestTimeGet() - start);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCHMARKS
+*********************************************************************************************************
+*/
+
+static  void  BenchStartStop (const char  *bg)
+{
+    INT64U  start;
+    INT32U  i;
+    INT8U   ix;
+    INT8U   err;
+    char    name[48];
+
+
+    for (ix = 0u; ix < sizeof(BenchDlyTbl) / sizeof(BenchDlyTbl[0]); ix++) {
+        start = OS_TestTimeGet();
+        for (i = 0u; i < BENCH_NBR; i++) {
+            (void)OSHTmrStart(BenchTmr, BenchDlyTbl[ix], &err);
+            (void)OSHTmrStop(BenchTmr, &err);
+        }
+        (void)snprintf(name, sizeof(name), "start + stop, dly %8u, %s", (unsigned)BenchDlyTbl[ix], bg);
+        OS_TestRatePrint(name, BENCH_NBR, OS_TestTimeGet() - start);
+    }
+    start = OS_TestTimeGet();
+    for (i = 0u; i < BENCH_NBR; i++) {           /* Restart, alternating between two levels            */
+        (void)OSHTmrStart(BenchTmr, BenchDlyTbl[i & 1u], &err);
+    }
+    (void)OSHTmrStop(BenchTmr, &err);
+    (void)snprintf(name, sizeof(name), "restart of a running timer, %s", bg);
+    OS_TestRatePrint(name, BENCH_NBR, OS_TestTimeGet() - start);
+}
+
+static  void  BenchExpire (INT8U        opt,
+                           const char  *name)
+{
+    INT64U  ns;
+    INT64U  ns_idle;
+
+
+    BenchTmrCreate(opt);
+    ns_idle          = BenchTicks();             /* Timers stopped                                     */
+    BenchTmrStart();
+    BenchCallbackCtr = 0u;
+    ns               = BenchTicks();
+    BenchTmrDel();
+    OS_TEST_CHECK(BenchCallbackCtr > 0u);
+    if (ns < ns_idle) {                          /* Host noise                                         */
+        ns = ns_idle;
+    }
+    OS_TestRatePrint(name, BenchCallbackCtr, ns - ns_idle);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCH TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchTask (void *p_arg)
+{
+    INT32U  i;
+    INT8U   err;
+
+
+    (void)p_arg;
+    BenchTmr = OSHTmrCreate(0u, OS_HTMR_OPT_ISR, BenchCallback, (void *)0, &err);
+    OS_TEST_CHECK(err == OS_ERR_NONE);
+
+    printf("bench_htmr:\n");
+    BenchStartStop("alone");
+    BenchTmrCreate(OS_HTMR_OPT_ISR);             /* Never expire, no tick is simulated                 */
+    for (i = 0u; i < BENCH_TMR_NBR; i++) {
+        (void)OSHTmrStart(BenchTmrTbl[i], 5000u + (i << 14), &err);
+    }
+    BenchStartStop("others running");
+    BenchTmrDel();
+
+    BenchExpire(OS_HTMR_OPT_ISR,  "expiry, ISR  callback");
+    BenchExpire(OS_HTMR_OPT_TASK, "expiry, task callback");
+    OS_CPU_SimStop();
+}
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    return (OS_TestRun("bench_htmr", BenchTask, BENCH_TASK_PRIO));
+}
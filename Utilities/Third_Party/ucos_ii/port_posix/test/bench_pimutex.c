@@ -0,0 +1,248 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                            Benchmark of the Priority Inheritance Mutexes
+*
+* File      : BENCH_PIMUTEX.C
+* Version   : V2.91
+*
+* Note(s)   : 1) Measures how long a high priority task is blocked on a lock held by a low priority task
+*                while a medium priority task becomes ready, for a PI mutex (OS_PIMUTEX.C), a mutex with a
+*                priority ceiling (OS_MUTEX.C) and a binary semaphore.  The low priority task holds the lock
+*                for BENCH_CS_NS, the medium priority task computes for BENCH_MID_NS: with inheritance or a
+*                ceiling the high priority task only waits for the critical section, with a semaphore it
+*                also waits for the medium priority task (priority inversion).
+*             2) Also measures the cost of taking and releasing each lock when it is free.
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_PIP                    4u         /* Ceiling of the OS_MUTEX.C mutex                    */
+#define  BENCH_HI_TASK_PRIO           5u
+#define  BENCH_MID_TASK_PRIO         20u
+#define  BENCH_LO_TASK_PRIO          30u
+#define  BENCH_TASK_PRIO             40u         /* Below the three tasks, which run to completion     */
+
+#define  BENCH_NBR                 2000u         /* Rounds of the blocking time benchmarks             */
+#define  BENCH_LOCK_NBR          100000u         /* Lock/unlock pairs when the lock is free            */
+#define  BENCH_CS_NS               5000u         /* Critical section of the low priority task (ns)     */
+#define  BENCH_MID_NS             50000u         /* Computation of the medium priority task (ns)       */
+
+#define  BENCH_LOCK_PIMUTEX           0u
+#define  BENCH_LOCK_MUTEX             1u
+#define  BENCH_LOCK_SEM               2u
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_PIMUTEX    *BenchPIMutex;
+static  OS_EVENT      *BenchMutex;
+static  OS_EVENT      *BenchLockSem;             /* Binary semaphore used as a lock                    */
+static  INT8U          BenchLock;                /* Lock in use (BENCH_LOCK_???)                       */
+
+static  OS_EVENT      *BenchHiSem;               /* Start of a round for each task                     */
+static  OS_EVENT      *BenchMidSem;
+static  OS_EVENT      *BenchLoSem;
+
+static  OS_TEST_STAT   BenchStat;                /* Time the high priority task was blocked            */
+
+/*
+*********************************************************************************************************
+*                                          LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  BenchLockPend (void)
+{
+    INT8U  err;
+
+
+    switch (BenchLock) {
+        case BENCH_LOCK_PIMUTEX:
+             OSPIMutexPend(BenchPIMutex, 0u, &err);
+             break;
+
+        case BENCH_LOCK_MUTEX:
+             OSMutexPend(BenchMutex, 0u, &err);
+             break;
+
+        default:
+             OSSemPend(BenchLockSem, 0u, &err);
+             break;
+    }
+}
+
+static  void  BenchLockPost (void)
+{
+    switch (BenchLock) {
+        case BENCH_LOCK_PIMUTEX:
+             (void)OSPIMutexPost(BenchPIMutex);
+             break;
+
+        case BENCH_LOCK_MUTEX:
+             (void)OSMutexPost(BenchMutex);
+             break;
+
+        default:
+             (void)OSSemPost(BenchLockSem);
+             break;
+    }
+}
+
+static  void  BenchSpin (INT64U  ns)             /* Computes for 'ns' without blocking                 */
+{
+    INT64U  end;
+
+
+    end = OS_TestTimeGet() + ns;
+    while (OS_TestTimeGet() < end) {
+        ;
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            LOCAL TASKS
+*********************************************************************************************************
+*/
+
+static  void  BenchHiTask (void *p_arg)
+{
+    INT64U  start;
+    INT8U   err;
+
+
+    (void)p_arg;
+    for (;;) {
+        OSSemPend(BenchHiSem, 0u, &err);
+        start = OS_TestTimeGet();
+        BenchLockPend();                         /* Held by the low priority task                      */
+        OS_TestStatAdd(&BenchStat, OS_TestTimeGet() - start);
+        BenchLockPost();
+    }
+}
+
+static  void  BenchMidTask (void *p_arg)
+{
+    INT8U  err;
+
+
+    (void)p_arg;
+    for (;;) {
+        OSSemPend(BenchMidSem, 0u, &err);
+        BenchSpin(BENCH_MID_NS);
+    }
+}
+
+static  void  BenchLoTask (void *p_arg)
+{
+    INT8U  err;
+
+
+    (void)p_arg;
+    for (;;) {
+        OSSemPend(BenchLoSem, 0u, &err);
+        BenchLockPend();
+        (void)OSSemPost(BenchHiSem);             /* The high priority task blocks on the lock ...      */
+        (void)OSSemPost(BenchMidSem);            /* ... and the medium priority one is ready           */
+        BenchSpin(BENCH_CS_NS);
+        BenchLockPost();
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCHMARKS
+*********************************************************************************************************
+*/
+
+static  void  BenchBlocking (INT8U        lock,
+                             const char  *name)
+{
+    INT32U  i;
+
+
+    BenchLock = lock;
+    OS_TestStatInit(&BenchStat);
+    for (i = 0u; i < BENCH_NBR; i++) {           /* The three tasks run to completion above us         */
+        (void)OSSemPost(BenchLoSem);
+    }
+    OS_TestStatPrint(name, &BenchStat);
+}
+
+static  void  BenchFree (INT8U        lock,
+                         const char  *name)
+{
+    INT64U  start;
+    INT32U  i;
+
+
+    BenchLock = lock;
+    start     = OS_TestTimeGet();
+    for (i = 0u; i < BENCH_LOCK_NBR; i++) {
+        BenchLockPend();
+        BenchLockPost();
+    }
+    OS_TestRatePrint(name, BENCH_LOCK_NBR, OS_TestTimeGet() - start);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCH TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchTask (void *p_arg)
+{
+    INT8U  err;
+
+
+    (void)p_arg;
+    BenchPIMutex = OSPIMutexCreate(&err);
+    BenchMutex   = OSMutexCreate(BENCH_PIP, &err);
+    BenchLockSem = OSSemCreate(1u);
+    BenchHiSem   = OSSemCreate(0u);
+    BenchMidSem  = OSSemCreate(0u);
+    BenchLoSem   = OSSemCreate(0u);
+    OS_TestTaskCreate(BenchHiTask,  (void *)0, BENCH_HI_TASK_PRIO);
+    OS_TestTaskCreate(BenchMidTask, (void *)0, BENCH_MID_TASK_PRIO);
+    OS_TestTaskCreate(BenchLoTask,  (void *)0, BENCH_LO_TASK_PRIO);
+
+    printf("bench_pimutex:\n");
+    BenchFree(BENCH_LOCK_PIMUTEX, "OSPIMutexPend() + OSPIMutexPost(), free");
+    BenchFree(BENCH_LOCK_MUTEX,   "OSMutexPend()   + OSMutexPost(),   free");
+    BenchFree(BENCH_LOCK_SEM,     "OSSemPend()     + OSSemPost(),     free");
+    BenchBlocking(BENCH_LOCK_PIMUTEX, "HPT blocked, PI mutex");
+    BenchBlocking(BENCH_LOCK_MUTEX,   "HPT blocked, priority ceiling mutex");
+    BenchBlocking(BENCH_LOCK_SEM,     "HPT blocked, semaphore (inversion)");
+    OS_CPU_SimStop();
+}
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    return (OS_TestRun("bench_pimutex", BenchTask, BENCH_TASK_PRIO));
+}
@@ -0,0 +1,315 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                              Benchmark of the Size-Class Memory Pool Against malloc()
+*
+* File      : BENCH_POOL.C
+* Version   : V2.91
+*
+* Note(s)   : 1) Measures OSPoolGet() + OSPoolPut() from a task (served by the task cache) and from an ISR
+*                (served by the partition), against malloc() + free() of the host C library.
+*             2) Runs the same random workload on the pool and on malloc(): BENCH_SLOTS slots, each step
+*                frees an occupied slot or fills an empty one with a request of log-uniform size in
+*                [BENCH_MIN_SIZE, BENCH_MAX_SIZE].  The pool wastes the rounding of a request up to its
+*                class (internal fragmentation) and fails when the class is empty; malloc() wastes its
+*                headers and the free chunks it cannot return (read with mallinfo2()).  The time of each
+*                step includes reading the host clock around the call.
+*********************************************************************************************************
+*/
+
+#include  <malloc.h>
+#include  <stdio.h>
+#include  <stdlib.h>
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_TASK_PRIO             10u
+
+#define  BENCH_LAT_NBR           100000u         /* Get/put pairs of the latency benchmarks            */
+#define  BENCH_LAT_SIZE              48u         /* Request size, served by the 64 byte class          */
+
+#define  BENCH_SLOTS                256u         /* Slots of the fragmentation workload                */
+#define  BENCH_STEPS             200000u         /* ... and number of steps                            */
+#define  BENCH_MIN_SIZE               8u
+#define  BENCH_MAX_SIZE            2048u
+#define  BENCH_CLASSES                7u         /* Classes 32 .. 2048 bytes                           */
+#define  BENCH_NBLKS                 64u         /* Blocks per class                                   */
+
+#define  BENCH_INT_NBR               40u
+
+/*
+*********************************************************************************************************
+*                                           LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  bench_slot {
+    void    *Blk;                                /* Block, NULL if the slot is empty                   */
+    INT32U   Size;                               /* Size requested                                     */
+} BENCH_SLOT;
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  INT8U       BenchStorage[BENCH_NBLKS * (OS_POOL_MIN_BLK_SIZE << BENCH_CLASSES)]
+                                                 __attribute__((aligned(64)));
+static  BENCH_SLOT  BenchSlot[BENCH_SLOTS];
+static  INT32U      BenchSeed;                   /* State of the random generator                      */
+static  INT64U      BenchISRTime;                /* Time measured by the ISR                           */
+static  void       *volatile  BenchSink;         /* Keeps the compiler from removing malloc()/free()   */
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  INT32U  BenchRand (void)                 /* Linear congruential generator, same run each time  */
+{
+    BenchSeed = BenchSeed * 1664525u + 1013904223u;
+    return (BenchSeed >> 8);
+}
+
+static  INT32U  BenchSizeGet (void)              /* Log-uniform in [BENCH_MIN_SIZE, BENCH_MAX_SIZE]    */
+{
+    INT32U  lo;
+
+
+    lo = BENCH_MIN_SIZE << (BenchRand() % 8u);   /* Octave, then a size within it                      */
+    return (lo + BenchRand() % lo);
+}
+
+static  INT32U  BenchClassSize (INT32U  size)
+{
+    INT32U  blksize;
+
+
+    blksize = OS_POOL_MIN_BLK_SIZE;
+    while (blksize < size) {
+        blksize <<= 1u;
+    }
+    return (blksize);
+}
+
+static  void  BenchLatISR (void)                 /* The pool without the task cache                    */
+{
+    INT64U  start;
+    void   *pblk;
+    INT32U  i;
+    INT8U   err;
+
+
+    start = OS_TestTimeGet();
+    for (i = 0u; i < BENCH_LAT_NBR; i++) {
+        pblk = OSPoolGet(BENCH_LAT_SIZE, &err);
+        (void)OSPoolPut(pblk);
+    }
+    BenchISRTime = OS_TestTimeGet() - start;
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCHMARKS
+*********************************************************************************************************
+*/
+
+static  void  BenchLatency (void)
+{
+    INT64U  start;
+    void   *pblk;
+    INT32U  i;
+    INT8U   err;
+
+
+    start = OS_TestTimeGet();
+    for (i = 0u; i < BENCH_LAT_NBR; i++) {
+        pblk = OSPoolGet(BENCH_LAT_SIZE, &err);
+        (void)OSPoolPut(pblk);
+    }
+    OS_TestRatePrint("OSPoolGet() + OSPoolPut(), task cache", BENCH_LAT_NBR, OS_TestTimeGet() - start);
+
+    OS_CPU_SimInt(BenchLatISR, BENCH_INT_NBR);
+    OS_TestRatePrint("OSPoolGet() + OSPoolPut(), ISR", BENCH_LAT_NBR, BenchISRTime);
+
+    start = OS_TestTimeGet();
+    for (i = 0u; i < BENCH_LAT_NBR; i++) {
+        BenchSink = malloc(BENCH_LAT_SIZE);
+        free(BenchSink);
+    }
+    OS_TestRatePrint("malloc() + free()", BENCH_LAT_NBR, OS_TestTimeGet() - start);
+}
+
+static  void  BenchFragPool (void)
+{
+    BENCH_SLOT  *pslot;
+    INT64U       start;
+    INT64U       ns;
+    double       frag;                           /* Sum over the steps of the wasted fraction          */
+    INT32U       live;                           /* Bytes requested by the occupied slots              */
+    INT32U       held;                           /* Bytes of the blocks holding them                   */
+    INT32U       peak;
+    INT32U       fails;
+    INT32U       step;
+    INT8U        err;
+
+
+    BenchSeed = 1u;
+    frag      = 0.0;
+    live      = 0u;
+    held      = 0u;
+    peak      = 0u;
+    fails     = 0u;
+    ns        = 0u;
+    for (step = 0u; step < BENCH_STEPS; step++) {
+        pslot = &BenchSlot[BenchRand() % BENCH_SLOTS];
+        if (pslot->Blk != (void *)0) {
+            start = OS_TestTimeGet();
+            (void)OSPoolPut(pslot->Blk);
+            ns += OS_TestTimeGet() - start;
+            live      -= pslot->Size;
+            held      -= BenchClassSize(pslot->Size);
+            pslot->Blk = (void *)0;
+        } else {
+            pslot->Size = BenchSizeGet();
+            start       = OS_TestTimeGet();
+            pslot->Blk  = OSPoolGet(pslot->Size, &err);
+            ns += OS_TestTimeGet() - start;
+            if (pslot->Blk == (void *)0) {
+                fails++;
+            } else {
+                live += pslot->Size;
+                held += BenchClassSize(pslot->Size);
+            }
+        }
+        if (peak < held) {
+            peak = held;
+        }
+        if (held > 0u) {
+            frag += (double)(held - live) / (double)held;
+        }
+    }
+    for (pslot = &BenchSlot[0]; pslot < &BenchSlot[BENCH_SLOTS]; pslot++) {
+        if (pslot->Blk != (void *)0) {
+            (void)OSPoolPut(pslot->Blk);
+            pslot->Blk = (void *)0;
+        }
+    }
+    OSPoolCacheFlush();
+    OS_TestRatePrint("workload, OSPoolGet()/OSPoolPut()", BENCH_STEPS, ns);
+    printf("  %-48s %8.1f %% internal, %u of %u requests failed\n",
+           "  pool fragmentation", 100.0 * frag / (double)BENCH_STEPS, (unsigned)fails, (unsigned)BENCH_STEPS);
+    printf("  %-48s %8u bytes storage, %u peak held\n",
+           "  pool footprint", (unsigned)sizeof(BenchStorage), (unsigned)peak);
+}
+
+static  void  BenchFragMalloc (void)
+{
+    BENCH_SLOT        *pslot;
+    struct mallinfo2   base;
+    struct mallinfo2   info;
+    INT64U             start;
+    INT64U             ns;
+    double             frag;                     /* Sum over the steps of the wasted fraction          */
+    size_t             live;
+    size_t             peak;
+    INT32U             step;
+
+
+    BenchSeed = 1u;
+    frag      = 0.0;
+    live      = 0u;
+    peak      = 0u;
+    ns        = 0u;
+    base      = mallinfo2();
+    for (step = 0u; step < BENCH_STEPS; step++) {
+        pslot = &BenchSlot[BenchRand() % BENCH_SLOTS];
+        if (pslot->Blk != (void *)0) {
+            start = OS_TestTimeGet();
+            free(pslot->Blk);
+            ns += OS_TestTimeGet() - start;
+            live      -= pslot->Size;
+            pslot->Blk = (void *)0;
+        } else {
+            pslot->Size = BenchSizeGet();
+            start       = OS_TestTimeGet();
+            pslot->Blk  = malloc(pslot->Size);
+            ns += OS_TestTimeGet() - start;
+            live += pslot->Size;
+        }
+        info = mallinfo2();                      /* Arena bytes not holding requested data             */
+        if (peak < info.arena) {
+            peak = info.arena;
+        }
+        if (info.arena > base.arena) {
+            frag += (double)(info.arena - base.arena - live) / (double)(info.arena - base.arena);
+        }
+    }
+    info = mallinfo2();
+    OS_TestRatePrint("workload, malloc()/free()", BENCH_STEPS, ns);
+    printf("  %-48s %8.1f %% of the arena, %zu used %zu free at the end\n",
+           "  malloc overhead", 100.0 * frag / (double)BENCH_STEPS,
+           info.uordblks - base.uordblks, info.fordblks);
+    printf("  %-48s %8zu bytes peak arena\n",
+           "  malloc footprint", peak);
+    for (pslot = &BenchSlot[0]; pslot < &BenchSlot[BENCH_SLOTS]; pslot++) {
+        free(pslot->Blk);
+        pslot->Blk = (void *)0;
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCH TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchTask (void *p_arg)
+{
+    INT8U  *pstorage;
+    INT32U  blksize;
+    INT8U   ix;
+    INT8U   err;
+
+
+    (void)p_arg;
+    pstorage = &BenchStorage[0];
+    blksize  = OS_POOL_MIN_BLK_SIZE;
+    for (ix = 0u; ix < BENCH_CLASSES; ix++) {
+        OSPoolCreate(pstorage, BENCH_NBLKS, blksize, &err);
+        OS_TEST_CHECK(err == OS_ERR_NONE);
+        pstorage += BENCH_NBLKS * blksize;
+        blksize <<= 1u;
+    }
+
+    printf("bench_pool:\n");
+    BenchLatency();
+    BenchFragPool();
+    BenchFragMalloc();
+    OS_CPU_SimStop();
+}
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    return (OS_TestRun("bench_pool", BenchTask, BENCH_TASK_PRIO));
+}
@@ -0,0 +1,243 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                                 Benchmark of the Ring Buffers Against Queues
+*
+* File      : BENCH_RING.C
+* Version   : V2.91
+*
+* Note(s)   : 1) Passes 32-bit values through a ring (OSRingPost()/OSRingPend()) and a message queue
+*                (OSQPost()/OSQPend()), without waiting, from a task and from an ISR to a waiting consumer.
+*                A ring consumer is woken once per 'watermark' elements, a queue consumer once per message.
+*********************************************************************************************************
+*/
+
+#include  <stdint.h>
+#include  <stdio.h>
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  BENCH_TASK_PRIO             10u
+#define  BENCH_Q_TASK_PRIO            5u         /* Consumers, of higher priority than the producer    */
+#define  BENCH_RING_TASK_PRIO         6u
+#define  BENCH_BATCH_TASK_PRIO        7u
+
+#define  BENCH_NBR               100000u         /* Elements per benchmark, a multiple of the batch    */
+#define  BENCH_SIZE                  64u         /* Entries of the rings and of the queue              */
+#define  BENCH_BATCH                 16u         /* Watermark of the batch ring                        */
+
+#define  BENCH_INT_NBR               40u
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_EVENT  *BenchQ;                       /* Queue                                              */
+static  void      *BenchQTbl[BENCH_SIZE];
+static  OS_RING   *BenchRing;                    /* Ring woken at every element                        */
+static  INT32U     BenchRingStorage[BENCH_SIZE];
+static  OS_RING   *BenchBatch;                   /* Ring woken every BENCH_BATCH elements              */
+static  INT32U     BenchBatchStorage[BENCH_SIZE];
+
+static  INT32U     BenchVal;                     /* Value posted by the ISRs                           */
+static  INT32U     BenchRxCtr;                   /* Elements received by the consumers                 */
+static  INT32U     BenchRxSum;                   /* Sum of the elements received                       */
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TASKS
+*********************************************************************************************************
+*/
+
+static  void  BenchQTask (void *p_arg)
+{
+    void   *pmsg;
+    INT8U   err;
+
+
+    (void)p_arg;
+    for (;;) {
+        pmsg        = OSQPend(BenchQ, 0u, &err);
+        BenchRxSum += (INT32U)(uintptr_t)pmsg;
+        BenchRxCtr++;
+    }
+}
+
+static  void  BenchRingTask (void *p_arg)
+{
+    OS_RING  *pring;
+    INT32U    buf[BENCH_SIZE];
+    INT16U    nbr;
+    INT16U    i;
+    INT8U     err;
+
+
+    pring = (OS_RING *)p_arg;
+    for (;;) {
+        nbr = OSRingPend(pring, buf, BENCH_SIZE, 0u, &err);
+        for (i = 0u; i < nbr; i++) {
+            BenchRxSum += buf[i];
+        }
+        BenchRxCtr += nbr;
+    }
+}
+
+static  void  BenchQPostISR (void)
+{
+    (void)OSQPost(BenchQ, (void *)(uintptr_t)BenchVal);
+}
+
+static  void  BenchBatchPostISR (void)
+{
+    (void)OSRingPost(BenchBatch, &BenchVal);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCHMARKS
+*********************************************************************************************************
+*/
+
+static  void  BenchNoWait (void)
+{
+    OS_EVENT  *pq;
+    OS_RING   *pring;
+    void      *qtbl[BENCH_SIZE];
+    INT32U     storage[BENCH_SIZE];
+    INT32U     buf[BENCH_BATCH];
+    INT64U     start;
+    INT32U     val;
+    INT32U     i;
+    INT8U      err;
+
+
+    pq    = OSQCreate(qtbl, BENCH_SIZE);         /* No consumer waits on these ones                    */
+    pring = OSRingCreate(storage, BENCH_SIZE, sizeof(INT32U), 0u, &err);
+
+    start = OS_TestTimeGet();
+    for (val = 0u; val < BENCH_NBR; val++) {
+        (void)OSQPost(pq, (void *)(uintptr_t)val);
+        (void)OSQAccept(pq, &err);
+    }
+    OS_TestRatePrint("OSQPost()    + OSQAccept()", BENCH_NBR, OS_TestTimeGet() - start);
+
+    start = OS_TestTimeGet();
+    for (val = 0u; val < BENCH_NBR; val++) {
+        (void)OSRingPost(pring, &val);
+        (void)OSRingAccept(pring, buf, 1u, &err);
+    }
+    OS_TestRatePrint("OSRingPost() + OSRingAccept()", BENCH_NBR, OS_TestTimeGet() - start);
+
+    start = OS_TestTimeGet();
+    for (val = 0u; val < BENCH_NBR; val += BENCH_BATCH) {
+        for (i = 0u; i < BENCH_BATCH; i++) {
+            (void)OSRingPost(pring, &val);
+        }
+        (void)OSRingAccept(pring, buf, BENCH_BATCH, &err);
+    }
+    OS_TestRatePrint("OSRingPost() + OSRingAccept(), batch of 16", BENCH_NBR, OS_TestTimeGet() - start);
+}
+
+static  void  BenchTaskToTask (void)
+{
+    INT64U  start;
+    INT32U  val;
+
+
+    BenchRxCtr = 0u;
+    BenchRxSum = 0u;
+    start      = OS_TestTimeGet();
+    for (val = 0u; val < BENCH_NBR; val++) {     /* The consumer runs at each post                     */
+        (void)OSQPost(BenchQ, (void *)(uintptr_t)val);
+    }
+    OS_TestRatePrint("task -> task, OSQPost()/OSQPend()", BENCH_NBR, OS_TestTimeGet() - start);
+    OS_TEST_CHECK(BenchRxCtr == BENCH_NBR);
+
+    BenchRxCtr = 0u;
+    start      = OS_TestTimeGet();
+    for (val = 0u; val < BENCH_NBR; val++) {     /* ... also with a watermark of 1                     */
+        (void)OSRingPost(BenchRing, &val);
+    }
+    OS_TestRatePrint("task -> task, OSRingPost()/OSRingPend(), wm 1", BENCH_NBR, OS_TestTimeGet() - start);
+    OS_TEST_CHECK(BenchRxCtr == BENCH_NBR);
+
+    BenchRxCtr = 0u;
+    start      = OS_TestTimeGet();
+    for (val = 0u; val < BENCH_NBR; val++) {     /* ... once per batch                                 */
+        (void)OSRingPost(BenchBatch, &val);
+    }
+    OS_TestRatePrint("task -> task, OSRingPost()/OSRingPend(), wm 16", BENCH_NBR, OS_TestTimeGet() - start);
+    OS_TEST_CHECK(BenchRxCtr == BENCH_NBR);
+}
+
+static  void  BenchISRToTask (void)
+{
+    INT64U  start;
+
+
+    BenchRxCtr = 0u;
+    start      = OS_TestTimeGet();
+    for (BenchVal = 0u; BenchVal < BENCH_NBR; BenchVal++) {
+        OS_CPU_SimInt(BenchQPostISR, BENCH_INT_NBR);
+    }
+    OS_TestRatePrint("ISR  -> task, OSQPost()/OSQPend()", BENCH_NBR, OS_TestTimeGet() - start);
+    OS_TEST_CHECK(BenchRxCtr == BENCH_NBR);
+
+    BenchRxCtr = 0u;
+    start      = OS_TestTimeGet();
+    for (BenchVal = 0u; BenchVal < BENCH_NBR; BenchVal++) {
+        OS_CPU_SimInt(BenchBatchPostISR, BENCH_INT_NBR);
+    }
+    OS_TestRatePrint("ISR  -> task, OSRingPost()/OSRingPend(), wm 16", BENCH_NBR, OS_TestTimeGet() - start);
+    OS_TEST_CHECK(BenchRxCtr == BENCH_NBR);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              BENCH TASK
+*********************************************************************************************************
+*/
+
+static  void  BenchTask (void *p_arg)
+{
+    INT8U  err;
+
+
+    (void)p_arg;
+    BenchQ     = OSQCreate(BenchQTbl, BENCH_SIZE);
+    BenchRing  = OSRingCreate(BenchRingStorage,  BENCH_SIZE, sizeof(INT32U), 1u,          &err);
+    BenchBatch = OSRingCreate(BenchBatchStorage, BENCH_SIZE, sizeof(INT32U), BENCH_BATCH, &err);
+    OS_TestTaskCreate(BenchQTask,    (void *)0,          BENCH_Q_TASK_PRIO);
+    OS_TestTaskCreate(BenchRingTask, (void *)BenchRing,  BENCH_RING_TASK_PRIO);
+    OS_TestTaskCreate(BenchRingTask, (void *)BenchBatch, BENCH_BATCH_TASK_PRIO);
+
+    printf("bench_ring:\n");
+    BenchNoWait();
+    BenchTaskToTask();
+    BenchISRToTask();
+    OS_CPU_SimStop();
+}
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    return (OS_TestRun("bench_ring", BenchTask, BENCH_TASK_PRIO));
+}
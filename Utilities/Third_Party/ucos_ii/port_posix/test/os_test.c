@@ -0,0 +1,210 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                                       Tests and Benchmarks Support
+*
+* File      : OS_TEST.C
+* Version   : V2.91
+*********************************************************************************************************
+*/
+
+#define  _XOPEN_SOURCE  600                      /* clock_gettime()                                    */
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <time.h>
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_STK   OSTestStk[OS_LOWEST_PRIO + 1u][OS_TEST_STK_SIZE];   /* One stack per priority         */
+static  INT32U   OSTestCheckCtr;                 /* Number of checks done                              */
+static  INT32U   OSTestFailCtr;                  /* Number of checks failed                            */
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          RUN A TEST PROGRAM
+*
+* Description: Initializes uC/OS-II, creates 'task' and starts multitasking.  Returns once 'task' calls
+*              OS_CPU_SimStop().
+*
+* Arguments  : name      is the name of the program, printed with the result.
+*
+*              task      is the test task.
+*
+*              prio      is the priority of the test task.
+*
+* Returns    : 0 if all the checks passed, 1 otherwise (the exit status of the program).
+*********************************************************************************************************
+*/
+
+int  OS_TestRun (const char  *name,
+                 void       (*task)(void *p_arg),
+                 INT8U        prio)
+{
+    OSInit();
+    OS_TestTaskCreate(task, (void *)0, prio);
+    OSStart();
+    if (OSTestFailCtr != 0u) {
+        printf("%s: FAILED, %u of %u checks\n", name, (unsigned)OSTestFailCtr, (unsigned)OSTestCheckCtr);
+        return (1);
+    }
+    printf("%s: passed, %u checks\n", name, (unsigned)OSTestCheckCtr);
+    return (0);
+}
+
+/*
+*********************************************************************************************************
+*                                            CREATE A TASK
+*
+* Description: Creates a task on the stack reserved for its priority.  The program is aborted if the task
+*              cannot be created.
+*
+* Arguments  : task      is the task code.
+*
+*              p_arg     is the argument of the task.
+*
+*              prio      is the priority of the task.
+*********************************************************************************************************
+*/
+
+void  OS_TestTaskCreate (void   (*task)(void *p_arg),
+                         void    *p_arg,
+                         INT8U    prio)
+{
+    OS_STK  *pstk;
+    INT8U    err;
+
+
+    pstk = &OSTestStk[prio][0];
+    err  = OSTaskCreateExt(task,
+                           p_arg,
+                           &pstk[OS_TEST_STK_SIZE - 1u],
+                           prio,
+                           prio,
+                           pstk,
+                           OS_TEST_STK_SIZE,
+                           (void *)0,
+                           OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR);
+    if (err != OS_ERR_NONE) {
+        fprintf(stderr, "os_test: cannot create the task of priority %u, error %u\n",
+                (unsigned)prio, (unsigned)err);
+        exit(2);
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            CHECK A RESULT
+*
+* Description: Called by OS_TEST_CHECK() to count a check and report it if it failed.
+*
+* Arguments  : ok        is OS_TRUE if the check passed.
+*
+*              expr      is the text of the expression checked.
+*
+*              file      is the file and 'line' the line of the check.
+*********************************************************************************************************
+*/
+
+void  OS_TestCheck (BOOLEAN      ok,
+                    const char  *expr,
+                    const char  *file,
+                    int          line)
+{
+    OSTestCheckCtr++;
+    if (ok == OS_FALSE) {
+        OSTestFailCtr++;
+        printf("%s:%d: check failed: %s\n", file, line, expr);
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                          READ THE HOST CLOCK
+*
+* Description: Returns the time of the host monotonic clock, in nanoseconds.
+*
+* Arguments  : none
+*********************************************************************************************************
+*/
+
+INT64U  OS_TestTimeGet (void)
+{
+    struct timespec  now;
+
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((INT64U)now.tv_sec * 1000000000uLL + (INT64U)now.tv_nsec);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       STATISTICS OF A MEASURED TIME
+*
+* Description: OS_TestStatInit()   clears the statistics.
+*              OS_TestStatAdd()    adds a sample, in nanoseconds.
+*              OS_TestStatPrint()  prints the mean, the minimum and the maximum of the samples.
+*              OS_TestRatePrint()  prints the number of operations per second of 'nbr' operations done
+*                                  in 'ns' nanoseconds, and the mean time of one.
+*
+* Note(s)    : 1) The maximum includes the host scheduler and interrupts, only the mean and the minimum
+*                 are repeatable.
+*********************************************************************************************************
+*/
+
+void  OS_TestStatInit (OS_TEST_STAT  *pstat)
+{
+    pstat->OSTestStatTot = 0u;
+    pstat->OSTestStatMin = ~(INT64U)0;
+    pstat->OSTestStatMax = 0u;
+    pstat->OSTestStatNbr = 0u;
+}
+
+void  OS_TestStatAdd (OS_TEST_STAT  *pstat,
+                      INT64U         ns)
+{
+    pstat->OSTestStatTot += ns;
+    if (ns < pstat->OSTestStatMin) {
+        pstat->OSTestStatMin = ns;
+    }
+    if (ns > pstat->OSTestStatMax) {
+        pstat->OSTestStatMax = ns;
+    }
+    pstat->OSTestStatNbr++;
+}
+
+void  OS_TestStatPrint (const char    *name,
+                        OS_TEST_STAT  *pstat)
+{
+    if (pstat->OSTestStatNbr == 0u) {
+        printf("  %-48s no sample\n", name);
+        return;
+    }
+    printf("  %-48s %9.1f ns mean %7llu min %9llu max\n",
+           name,
+           (double)pstat->OSTestStatTot / (double)pstat->OSTestStatNbr,
+           (unsigned long long)pstat->OSTestStatMin,
+           (unsigned long long)pstat->OSTestStatMax);
+}
+
+void  OS_TestRatePrint (const char  *name,
+                        INT32U       nbr,
+                        INT64U       ns)
+{
+    printf("  %-48s %9.0f /s  %9.1f ns each\n",
+           name,
+           (double)nbr * 1.0e9 / (double)ns,
+           (double)ns / (double)nbr);
+}
@@ -0,0 +1,86 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                                       Tests and Benchmarks Support
+*
+* File      : OS_TEST.H
+* Version   : V2.91
+*
+* Note(s)   : 1) Each test or benchmark program runs one task, created by OS_TestRun(), which creates the
+*                other tasks it needs with OS_TestTaskCreate() and calls OS_CPU_SimStop() when done.
+*             2) The times are read from the host clock, in nanoseconds.  They measure the host, they only
+*                compare the services with each other and show how they scale.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TEST_H
+#define  OS_TEST_H
+
+#include "ucos_ii.h"
+
+/*
+*********************************************************************************************************
+*                                               CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  OS_TEST_STK_SIZE           256u         /* Size of the uC/OS-II stack of each task (OS_STK)   */
+
+/*
+*********************************************************************************************************
+*                                                MACROS
+*********************************************************************************************************
+*/
+
+#define  OS_TEST_CHECK(expr)        OS_TestCheck((BOOLEAN)((expr) ? OS_TRUE : OS_FALSE), #expr, __FILE__, __LINE__)
+
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  os_test_stat {                  /* Statistics of a measured time                      */
+    INT64U   OSTestStatTot;                      /* Sum of the samples (ns)                            */
+    INT64U   OSTestStatMin;                      /* Smallest sample (ns)                               */
+    INT64U   OSTestStatMax;                      /* Largest  sample (ns)                               */
+    INT32U   OSTestStatNbr;                      /* Number of samples                                  */
+} OS_TEST_STAT;
+
+/*
+*********************************************************************************************************
+*                                              PROTOTYPES
+*********************************************************************************************************
+*/
+
+int      OS_TestRun        (const char    *name,
+                            void         (*task)(void *p_arg),
+                            INT8U          prio);
+
+void     OS_TestTaskCreate (void         (*task)(void *p_arg),
+                            void          *p_arg,
+                            INT8U          prio);
+
+void     OS_TestCheck      (BOOLEAN        ok,
+                            const char    *expr,
+                            const char    *file,
+                            int            line);
+
+INT64U   OS_TestTimeGet    (void);
+
+void     OS_TestStatInit   (OS_TEST_STAT  *pstat);
+
+void     OS_TestStatAdd    (OS_TEST_STAT  *pstat,
+                            INT64U         ns);
+
+void     OS_TestStatPrint  (const char    *name,
+                            OS_TEST_STAT  *pstat);
+
+void     OS_TestRatePrint  (const char    *name,
+                            INT32U         nbr,
+                            INT64U         ns);
+
+#endif
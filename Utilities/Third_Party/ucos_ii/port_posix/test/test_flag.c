@@ -0,0 +1,233 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                                      Test of the Event Flag Groups
+*
+* File      : TEST_FLAG.C
+* Version   : V2.91
+*
+* Note(s)   : 1) A post readies every bucket it satisfies, even when a consuming bucket checked before
+*                them takes the flags: the waiters are checked against the posted value, then the flags
+*                are consumed.  The buckets are created newest first, so the consuming waiters pend last.
+*             2) A group deleted while an ISR post is still deferred leaves the list of groups to check.
+*********************************************************************************************************
+*/
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  TEST_TASK_PRIO              10u
+#define  TEST_WAITER_PRIO_MAX         8u         /* Waiters run at the priorities below this one       */
+
+#define  TEST_INT_NBR                40u         /* Exception number of the posting ISR                */
+
+/*
+*********************************************************************************************************
+*                                           LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  test_waiter {
+    OS_FLAG_GRP  *Grp;                           /* Wait of the next OSFlagPend()                      */
+    OS_FLAGS      Flags;
+    INT8U         WaitType;
+    OS_FLAGS      FlagsRdy;                      /* Result of the last OSFlagPend()                    */
+    INT8U         Err;
+    INT32U        Runs;                          /* Number of calls that returned                      */
+    BOOLEAN       Created;
+} TEST_WAITER;
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  TEST_WAITER   TestWaiter[TEST_WAITER_PRIO_MAX];  /* Indexed by priority                        */
+static  OS_FLAG_GRP  *TestISRGrp;                /* Posted by TestPostISR()                            */
+static  OS_FLAGS      TestISRFlags;
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TASKS
+*********************************************************************************************************
+*/
+
+static  void  TestWaiterTask (void *p_arg)       /* One wait per resume                                */
+{
+    TEST_WAITER  *pw;
+
+
+    pw = (TEST_WAITER *)p_arg;
+    for (;;) {
+        pw->FlagsRdy = OSFlagPend(pw->Grp, pw->Flags, pw->WaitType, 0u, &pw->Err);
+        pw->Runs++;
+        (void)OSTaskSuspend(OS_PRIO_SELF);
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  TestWait (INT8U         prio,      /* The waiter, above the test task, pends at once     */
+                        OS_FLAG_GRP  *pgrp,
+                        OS_FLAGS      flags,
+                        INT8U         wait_type)
+{
+    TEST_WAITER  *pw;
+
+
+    pw           = &TestWaiter[prio];
+    pw->Grp      = pgrp;
+    pw->Flags    = flags;
+    pw->WaitType = wait_type;
+    pw->FlagsRdy = (OS_FLAGS)0;
+    pw->Err      = OS_ERR_NONE;
+    pw->Runs     = 0u;
+    if (pw->Created == OS_FALSE) {
+        pw->Created = OS_TRUE;
+        OS_TestTaskCreate(TestWaiterTask, pw, prio);
+    } else {
+        (void)OSTaskResume(prio);
+    }
+}
+
+static  BOOLEAN  TestWoken (INT8U     prio,
+                            OS_FLAGS  flags_rdy)
+{
+    return ((BOOLEAN)((TestWaiter[prio].Runs     == 1u)          &&
+                      (TestWaiter[prio].Err      == OS_ERR_NONE) &&
+                      (TestWaiter[prio].FlagsRdy == flags_rdy)));
+}
+
+static  void  TestPostISR (void)
+{
+    INT8U  err;
+
+
+    (void)OSFlagPost(TestISRGrp, TestISRFlags, OS_FLAG_SET, &err);
+}
+
+static  void  TestPostDeferred (OS_FLAG_GRP  *pgrp,  /* Posts as an ISR whose PendSV has not run yet  */
+                                OS_FLAGS      flags)
+{
+    INT8U      err;
+#if OS_CRITICAL_METHOD == 3u
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    OSIntEnter();
+    (void)OSFlagPost(pgrp, flags, OS_FLAG_SET, &err);
+    OS_ENTER_CRITICAL();
+    OSIntNesting--;                              /* Leave without OSIntExit()                          */
+    OS_EXIT_CRITICAL();
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              TEST TASK
+*********************************************************************************************************
+*/
+
+static  void  TestTask (void *p_arg)
+{
+    OS_FLAG_GRP  *pgrp;
+    INT8U         prio;
+    INT8U         err;
+
+
+    (void)p_arg;
+                                                 /* ------ CONSUMING BUCKET FIRST, POST FROM ISR ------ */
+    pgrp = OSFlagCreate((OS_FLAGS)0, &err);
+    OS_TEST_CHECK(err == OS_ERR_NONE);
+    for (prio = 3u; prio <= 5u; prio++) {
+        TestWait(prio, pgrp, 0x1u, OS_FLAG_WAIT_SET_ALL);
+    }
+    TestWait(6u, pgrp, 0x3u, OS_FLAG_WAIT_SET_ALL + OS_FLAG_CONSUME);
+    TestWait(7u, pgrp, 0x3u, OS_FLAG_WAIT_SET_ALL + OS_FLAG_CONSUME);
+    TestISRGrp   = pgrp;
+    TestISRFlags = (OS_FLAGS)0x80000003uL;
+    OS_CPU_SimInt(TestPostISR, TEST_INT_NBR);
+    for (prio = 3u; prio <= 5u; prio++) {
+        OS_TEST_CHECK(TestWoken(prio, 0x1u));
+    }
+    OS_TEST_CHECK(TestWoken(6u, 0x3u));          /* Highest priority consumer only                     */
+    OS_TEST_CHECK(TestWaiter[7].Runs == 0u);
+    OS_TEST_CHECK(OSFlagQuery(pgrp, &err) == (OS_FLAGS)0x80000000uL);
+    (void)OSFlagPost(pgrp, 0x3u, OS_FLAG_SET, &err);
+    OS_TEST_CHECK(TestWoken(7u, 0x3u));
+    OS_TEST_CHECK(OSFlagQuery(pgrp, &err) == (OS_FLAGS)0x80000000uL);
+    OS_TEST_CHECK(OSFlagDel(pgrp, OS_DEL_NO_PEND, &err) == (OS_FLAG_GRP *)0);
+
+                                                 /* ----- CONSUMING BUCKET FIRST, POST FROM TASK ----- */
+    pgrp = OSFlagCreate((OS_FLAGS)0, &err);
+    for (prio = 3u; prio <= 5u; prio++) {
+        TestWait(prio, pgrp, 0x1u, OS_FLAG_WAIT_SET_ALL);
+    }
+    TestWait(6u, pgrp, 0x3u, OS_FLAG_WAIT_SET_ALL + OS_FLAG_CONSUME);
+    TestWait(7u, pgrp, 0x3u, OS_FLAG_WAIT_SET_ALL + OS_FLAG_CONSUME);
+    OS_TEST_CHECK(OSFlagPost(pgrp, 0x3u, OS_FLAG_SET, &err) == (OS_FLAGS)0);
+    for (prio = 3u; prio <= 5u; prio++) {
+        OS_TEST_CHECK(TestWoken(prio, 0x1u));
+    }
+    OS_TEST_CHECK(TestWoken(6u, 0x3u));
+    OS_TEST_CHECK(TestWaiter[7].Runs == 0u);
+    OS_TEST_CHECK(OSFlagDel(pgrp, OS_DEL_ALWAYS, &err) == (OS_FLAG_GRP *)0);
+    OS_TEST_CHECK(TestWoken(7u, 0x0u));          /* Readied by the deletion                            */
+
+                                                 /* ---- CONSUMING BUCKET FIRST, WAIT FOR CLEARED ---- */
+    pgrp = OSFlagCreate((OS_FLAGS)0x3u, &err);
+    TestWait(3u, pgrp, 0x1u, OS_FLAG_WAIT_CLR_ALL);
+    TestWait(6u, pgrp, 0x3u, OS_FLAG_WAIT_CLR_ALL + OS_FLAG_CONSUME);
+    OS_TEST_CHECK(OSFlagPost(pgrp, 0x3u, OS_FLAG_CLR, &err) == (OS_FLAGS)0x3u);
+    OS_TEST_CHECK(TestWoken(3u, 0x1u));
+    OS_TEST_CHECK(TestWoken(6u, 0x3u));
+    OS_TEST_CHECK(OSFlagDel(pgrp, OS_DEL_NO_PEND, &err) == (OS_FLAG_GRP *)0);
+
+                                                 /* ------- DELETE WHILE AN ISR POST IS DEFERRED ----- */
+    pgrp = OSFlagCreate((OS_FLAGS)0, &err);
+    TestWait(3u, pgrp, 0x1u, OS_FLAG_WAIT_SET_ANY);
+    TestPostDeferred(pgrp, 0x1u);
+    OS_TEST_CHECK(TestWaiter[3].Runs == 0u);     /* Wait list not checked yet                          */
+    OS_TEST_CHECK(OSFlagDeferList == pgrp);
+    OS_TEST_CHECK(OSFlagDel(pgrp, OS_DEL_ALWAYS, &err) == (OS_FLAG_GRP *)0);
+    OS_TEST_CHECK(TestWaiter[3].Runs == 1u);
+    OS_TEST_CHECK(OSFlagDeferList == (OS_FLAG_GRP *)0);
+    OS_TEST_CHECK(pgrp->OSFlagDeferPend == OS_FALSE);
+
+    pgrp = OSFlagCreate((OS_FLAGS)0, &err);      /* Same group reused, ISR posts are checked again     */
+    TestWait(3u, pgrp, 0x1u, OS_FLAG_WAIT_SET_ANY);
+    TestISRGrp   = pgrp;
+    TestISRFlags = 0x1u;
+    OS_CPU_SimInt(TestPostISR, TEST_INT_NBR);
+    OS_TEST_CHECK(TestWoken(3u, 0x1u));
+    OS_TEST_CHECK(OSFlagDeferList == (OS_FLAG_GRP *)0);
+    OS_TEST_CHECK(OSFlagDel(pgrp, OS_DEL_NO_PEND, &err) == (OS_FLAG_GRP *)0);
+
+    OS_CPU_SimStop();
+}
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    return (OS_TestRun("test_flag", TestTask, TEST_TASK_PRIO));
+}
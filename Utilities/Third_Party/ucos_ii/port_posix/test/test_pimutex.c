@@ -0,0 +1,297 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                                Test of the Priority Inheritance Mutexes
+*
+* File      : TEST_PIMUTEX.C
+* Version   : V2.91
+*
+* Note(s)   : 1) Checks the boost of an owner, the boost of the top of a chain of owners and the end of the
+*                boost when a waiter times out.  The services naming a task by its priority must reach the
+*                task created at that priority while a boost swaps it with another one.
+*********************************************************************************************************
+*/
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  TEST_TASK_PRIO              10u
+#define  TEST_HI_TASK_PRIO            5u
+#define  TEST_MID_TASK_PRIO          20u
+#define  TEST_LO_TASK_PRIO           30u
+
+#define  TEST_TIMEOUT                 5u
+
+/*
+*********************************************************************************************************
+*                                           LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  test_worker {                   /* A task taking 'Own', then 'Want', then waiting ... */
+    OS_PIMUTEX  *Own;                            /* ... for 'Sem' before it releases them (NULL: none) */
+    OS_PIMUTEX  *Want;
+    INT32U       Timeout;                        /* Timeout of the wait for 'Want'                     */
+    OS_EVENT    *Sem;
+    INT8U        Err;                            /* Result of the wait for 'Want'                      */
+    INT8U        Prio;                           /* Priority the task ran at after waiting for 'Sem'   */
+} TEST_WORKER;
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  TEST_WORKER  TestHi;
+static  TEST_WORKER  TestMid;
+static  TEST_WORKER  TestLo;
+
+static  INT8U        TestDone[3];                /* Base priorities of the workers, in end order       */
+static  INT8U        TestDoneNbr;
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TASKS
+*********************************************************************************************************
+*/
+
+static  void  TestWorkerTask (void *p_arg)
+{
+    TEST_WORKER  *pw;
+    INT8U         err;
+
+
+    pw = (TEST_WORKER *)p_arg;
+    if (pw->Own != (OS_PIMUTEX *)0) {
+        OSPIMutexPend(pw->Own, 0u, &err);
+    }
+    if (pw->Want != (OS_PIMUTEX *)0) {
+        OSPIMutexPend(pw->Want, pw->Timeout, &pw->Err);
+    }
+    if (pw->Sem != (OS_EVENT *)0) {
+        OSSemPend(pw->Sem, 0u, &err);
+    }
+    pw->Prio = OSTCBCur->OSTCBPrio;
+    if ((pw->Want != (OS_PIMUTEX *)0) && (pw->Err == OS_ERR_NONE)) {
+        (void)OSPIMutexPost(pw->Want);
+    }
+    if (pw->Own != (OS_PIMUTEX *)0) {
+        (void)OSPIMutexPost(pw->Own);
+    }
+    TestDone[TestDoneNbr++] = OSTCBCur->OSTCBBasePrio;
+    (void)OSTaskDel(OS_PRIO_SELF);
+}
+
+/*
+*********************************************************************************************************
+*                                          LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  TestWorkerStart (TEST_WORKER  *pw,
+                               INT8U         prio)
+{
+    pw->Err  = 0xFFu;
+    pw->Prio = 0xFFu;
+    OS_TestTaskCreate(TestWorkerTask, pw, prio);
+    if (prio > TEST_TASK_PRIO) {                 /* Let a lower priority worker reach its wait         */
+        OSTimeDly(1u);
+    }
+}
+
+static  INT8U  TestPrioGet (INT8U  prio)         /* Priority the task created at 'prio' runs at        */
+{
+    OS_TCB  tcb;
+
+
+    if (OSTaskQuery(prio, &tcb) != OS_ERR_NONE) {
+        return (0xFFu);
+    }
+    OS_TEST_CHECK(tcb.OSTCBBasePrio == prio);
+    return (tcb.OSTCBPrio);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                                TESTS
+*********************************************************************************************************
+*/
+
+static  void  TestBoost (OS_PIMUTEX  *pmutex,
+                         OS_EVENT    *psem)
+{
+    OS_PIMUTEX_DATA  data;
+    OS_STK_DATA      stk;
+    OS_TCB           tcb;
+
+
+    TestDoneNbr = 0u;
+    TestLo.Own  = pmutex;                        /* The low priority task owns the mutex ...           */
+    TestLo.Want = (OS_PIMUTEX *)0;
+    TestLo.Sem  = psem;
+    TestWorkerStart(&TestLo, TEST_LO_TASK_PRIO);
+    OS_TEST_CHECK(TestPrioGet(TEST_LO_TASK_PRIO) == TEST_LO_TASK_PRIO);
+
+    TestHi.Own     = (OS_PIMUTEX *)0;            /* ... and inherits the priority of a waiter          */
+    TestHi.Want    = pmutex;
+    TestHi.Timeout = 0u;
+    TestHi.Sem     = (OS_EVENT *)0;
+    TestWorkerStart(&TestHi, TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(OSPIMutexQuery(pmutex, &data) == OS_ERR_NONE);
+    OS_TEST_CHECK(data.OSOwnerPrio   == TEST_LO_TASK_PRIO);
+    OS_TEST_CHECK(data.OSOwnerPIPrio == TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(data.OSNbrWait     == 1u);
+    OS_TEST_CHECK(TestPrioGet(TEST_LO_TASK_PRIO) == TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(TestPrioGet(TEST_HI_TASK_PRIO) == TEST_LO_TASK_PRIO);
+
+                                                 /* The priority names the task created at it ...      */
+    OS_TEST_CHECK(OSTaskStkChk(TEST_LO_TASK_PRIO, &stk) == OS_ERR_NONE);
+    OS_TEST_CHECK(OSTaskSuspend(TEST_LO_TASK_PRIO) == OS_ERR_NONE);
+    (void)OSTaskQuery(TEST_LO_TASK_PRIO, &tcb);
+    OS_TEST_CHECK((tcb.OSTCBStat & OS_STAT_SUSPEND) != 0u);
+    (void)OSTaskQuery(TEST_HI_TASK_PRIO, &tcb);
+    OS_TEST_CHECK(tcb.OSTCBStat == OS_STAT_MUTEX);
+    OS_TEST_CHECK(OSTaskResume(TEST_LO_TASK_PRIO) == OS_ERR_NONE);
+
+    (void)OSSemPost(psem);                       /* The owner runs above us, then the waiter           */
+    OS_TEST_CHECK(TestLo.Prio == TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(TestHi.Err  == OS_ERR_NONE);
+    OS_TEST_CHECK(TestDoneNbr == 1u);
+    OS_TEST_CHECK(TestDone[0] == TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(TestPrioGet(TEST_LO_TASK_PRIO) == TEST_LO_TASK_PRIO);
+    OSTimeDly(1u);
+    OS_TEST_CHECK(TestDoneNbr == 2u);
+    OS_TEST_CHECK(TestDone[1] == TEST_LO_TASK_PRIO);
+}
+
+static  void  TestChain (OS_PIMUTEX  *pmutex1,
+                         OS_PIMUTEX  *pmutex2,
+                         OS_EVENT    *psem)
+{
+    OS_PIMUTEX_DATA  data;
+
+
+    TestDoneNbr = 0u;
+    TestLo.Own  = pmutex2;                       /* Low owns 2 ...                                     */
+    TestLo.Want = (OS_PIMUTEX *)0;
+    TestLo.Sem  = psem;
+    TestWorkerStart(&TestLo, TEST_LO_TASK_PRIO);
+
+    TestMid.Own     = pmutex1;                   /* ... mid owns 1 and waits for 2 ...                 */
+    TestMid.Want    = pmutex2;
+    TestMid.Timeout = 0u;
+    TestMid.Sem     = (OS_EVENT *)0;
+    TestWorkerStart(&TestMid, TEST_MID_TASK_PRIO);
+    OS_TEST_CHECK(TestPrioGet(TEST_LO_TASK_PRIO) == TEST_MID_TASK_PRIO);
+
+    TestHi.Own     = (OS_PIMUTEX *)0;            /* ... high waits for 1: low runs at its priority     */
+    TestHi.Want    = pmutex1;
+    TestHi.Timeout = 0u;
+    TestHi.Sem     = (OS_EVENT *)0;
+    TestWorkerStart(&TestHi, TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(TestPrioGet(TEST_LO_TASK_PRIO)  == TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(TestPrioGet(TEST_MID_TASK_PRIO) == TEST_MID_TASK_PRIO);
+    OS_TEST_CHECK(OSPIMutexQuery(pmutex1, &data) == OS_ERR_NONE);
+    OS_TEST_CHECK(data.OSOwnerPIPrio == TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(OSPIMutexQuery(pmutex2, &data) == OS_ERR_NONE);
+    OS_TEST_CHECK(data.OSOwnerPIPrio == TEST_HI_TASK_PRIO);
+
+    (void)OSSemPost(psem);                       /* Low, then mid, then high run above us              */
+    OS_TEST_CHECK(TestLo.Prio == TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(TestMid.Err == OS_ERR_NONE);
+    OS_TEST_CHECK(TestHi.Err  == OS_ERR_NONE);
+    OS_TEST_CHECK(TestDoneNbr == 1u);
+    OS_TEST_CHECK(TestDone[0] == TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(TestPrioGet(TEST_LO_TASK_PRIO)  == TEST_LO_TASK_PRIO);
+    OS_TEST_CHECK(TestPrioGet(TEST_MID_TASK_PRIO) == TEST_MID_TASK_PRIO);
+    OSTimeDly(1u);
+    OS_TEST_CHECK(TestDoneNbr == 3u);
+    OS_TEST_CHECK((TestDone[1] == TEST_MID_TASK_PRIO) && (TestDone[2] == TEST_LO_TASK_PRIO));
+}
+
+static  void  TestTimeout (OS_PIMUTEX  *pmutex,
+                           OS_EVENT    *psem)
+{
+    OS_PIMUTEX_DATA  data;
+
+
+    TestDoneNbr = 0u;
+    TestLo.Own  = pmutex;
+    TestLo.Want = (OS_PIMUTEX *)0;
+    TestLo.Sem  = psem;
+    TestWorkerStart(&TestLo, TEST_LO_TASK_PRIO);
+
+    TestHi.Own     = (OS_PIMUTEX *)0;            /* The waiter gives up ...                            */
+    TestHi.Want    = pmutex;
+    TestHi.Timeout = TEST_TIMEOUT;
+    TestHi.Sem     = (OS_EVENT *)0;
+    TestWorkerStart(&TestHi, TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(TestPrioGet(TEST_LO_TASK_PRIO) == TEST_HI_TASK_PRIO);
+    OSTimeDly(TEST_TIMEOUT - 1u);
+    OS_TEST_CHECK(TestHi.Err == 0xFFu);
+    OSTimeDly(1u);
+    OS_TEST_CHECK(TestHi.Err == OS_ERR_TIMEOUT);
+    OS_TEST_CHECK(TestDoneNbr == 1u);
+
+    OS_TEST_CHECK(TestPrioGet(TEST_LO_TASK_PRIO) == TEST_LO_TASK_PRIO);   /* ... the boost ends       */
+    OS_TEST_CHECK(OSPIMutexQuery(pmutex, &data) == OS_ERR_NONE);
+    OS_TEST_CHECK(data.OSOwnerPIPrio == TEST_LO_TASK_PRIO);
+    OS_TEST_CHECK(data.OSNbrWait     == 0u);
+
+    (void)OSSemPost(psem);
+    OSTimeDly(1u);
+    OS_TEST_CHECK(TestLo.Prio  == TEST_LO_TASK_PRIO);
+    OS_TEST_CHECK(TestDoneNbr  == 2u);
+    OS_TEST_CHECK(OSPIMutexQuery(pmutex, &data) == OS_ERR_NONE);
+    OS_TEST_CHECK(data.OSValue == OS_TRUE);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              TEST TASK
+*********************************************************************************************************
+*/
+
+static  void  TestTask (void *p_arg)
+{
+    OS_PIMUTEX  *pmutex1;
+    OS_PIMUTEX  *pmutex2;
+    OS_EVENT    *psem;
+    INT8U        err;
+
+
+    (void)p_arg;
+    pmutex1 = OSPIMutexCreate(&err);
+    OS_TEST_CHECK(err == OS_ERR_NONE);
+    pmutex2 = OSPIMutexCreate(&err);
+    OS_TEST_CHECK(err == OS_ERR_NONE);
+    psem    = OSSemCreate(0u);
+
+    TestBoost(pmutex1, psem);
+    TestChain(pmutex1, pmutex2, psem);
+    TestTimeout(pmutex1, psem);
+
+    OS_CPU_SimStop();
+}
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    return (OS_TestRun("test_pimutex", TestTask, TEST_TASK_PRIO));
+}
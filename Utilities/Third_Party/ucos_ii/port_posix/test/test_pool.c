@@ -0,0 +1,162 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                                     Test of the Size-Class Memory Pool
+*
+* File      : TEST_POOL.C
+* Version   : V2.91
+*
+* Note(s)   : 1) Checks that OSPoolQuery() accounts for every block (OSNFree + OSNUsed + OSNCached ==
+*                OSNBlks) as blocks move between the partition, the application and the task caches.
+*********************************************************************************************************
+*/
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  TEST_TASK_PRIO              10u
+#define  TEST_LO_TASK_PRIO           20u         /* Task releasing blocks into its cache, then deleted */
+
+#define  TEST_INT_NBR                40u
+
+#define  TEST_NBLKS                   8u
+#define  TEST_BLK_SIZE    OS_POOL_MIN_BLK_SIZE   /* Class 0                                            */
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  INT8U   TestStorage[TEST_NBLKS][TEST_BLK_SIZE] __attribute__((aligned(OS_POOL_ALIGN)));
+static  void   *TestBlk[TEST_NBLKS];
+static  void   *TestISRBlk;                      /* Block released by the ISR                          */
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TASKS
+*********************************************************************************************************
+*/
+
+static  void  TestLoTask (void *p_arg)
+{
+    void   *pblk;
+    INT8U   err;
+
+
+    (void)p_arg;
+    pblk = OSPoolGet(TEST_BLK_SIZE, &err);       /* Leave one block in the cache ...                   */
+    (void)OSPoolPut(pblk);
+    for (;;) {                                   /* ... until the task is deleted                      */
+        (void)OSTaskSuspend(OS_PRIO_SELF);
+    }
+}
+
+static  void  TestPutISR (void)
+{
+    (void)OSPoolPut(TestISRBlk);
+}
+
+/*
+*********************************************************************************************************
+*                                         CHECK THE BLOCK COUNTS
+*********************************************************************************************************
+*/
+
+static  void  TestCounts (INT32U  nfree,
+                          INT32U  nused,
+                          INT32U  ncached)
+{
+    OS_POOL_DATA  data;
+
+
+    OS_TEST_CHECK(OSPoolQuery(0u, &data) == OS_ERR_NONE);
+    OS_TEST_CHECK(data.OSNFree   == nfree);
+    OS_TEST_CHECK(data.OSNUsed   == nused);
+    OS_TEST_CHECK(data.OSNCached == ncached);
+    OS_TEST_CHECK(data.OSNFree + data.OSNUsed + data.OSNCached == data.OSNBlks);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              TEST TASK
+*********************************************************************************************************
+*/
+
+static  void  TestTask (void *p_arg)
+{
+    void   *pblk;
+    INT32U  i;
+    INT8U   err;
+
+
+    (void)p_arg;
+    OSPoolCreate(TestStorage, TEST_NBLKS, TEST_BLK_SIZE, &err);
+    OS_TEST_CHECK(err == OS_ERR_NONE);
+    TestCounts(TEST_NBLKS, 0u, 0u);
+                                                 /* ---------------- GET AND RELEASE ----------------- */
+    for (i = 0u; i < 4u; i++) {
+        TestBlk[i] = OSPoolGet(1u, &err);
+        OS_TEST_CHECK(err == OS_ERR_NONE);
+    }
+    TestCounts(TEST_NBLKS - 4u, 4u, 0u);
+    for (i = 0u; i < 4u; i++) {                  /* The cache keeps the first DEPTH blocks released    */
+        OS_TEST_CHECK(OSPoolPut(TestBlk[i]) == OS_ERR_NONE);
+    }
+    TestCounts(TEST_NBLKS - OS_POOL_TASK_CACHE_DEPTH, 0u, OS_POOL_TASK_CACHE_DEPTH);
+
+                                                 /* -------------- REUSE OF THE CACHE ---------------- */
+    pblk = OSPoolGet(TEST_BLK_SIZE, &err);       /* Most recently cached block                         */
+    OS_TEST_CHECK(pblk == TestBlk[OS_POOL_TASK_CACHE_DEPTH - 1u]);
+    TestCounts(TEST_NBLKS - OS_POOL_TASK_CACHE_DEPTH, 1u, OS_POOL_TASK_CACHE_DEPTH - 1u);
+    (void)OSPoolPut(pblk);
+    TestCounts(TEST_NBLKS - OS_POOL_TASK_CACHE_DEPTH, 0u, OS_POOL_TASK_CACHE_DEPTH);
+
+                                                 /* ------------------- FLUSH ------------------------ */
+    OSPoolCacheFlush();
+    TestCounts(TEST_NBLKS, 0u, 0u);
+
+                                                 /* ---------- AN ISR RELEASES TO THE PARTITION ------ */
+    TestISRBlk = OSPoolGet(TEST_BLK_SIZE, &err);
+    OS_CPU_SimInt(TestPutISR, TEST_INT_NBR);
+    TestCounts(TEST_NBLKS, 0u, 0u);
+
+                                                 /* ------- EXHAUSTION, CACHED BLOCKS ARE NOT FREE --- */
+    OS_TestTaskCreate(TestLoTask, (void *)0, TEST_LO_TASK_PRIO);
+    OSTimeDly(1u);                               /* Let the task cache its block                       */
+    TestCounts(TEST_NBLKS - 1u, 0u, 1u);
+    for (i = 0u; i < TEST_NBLKS - 1u; i++) {
+        TestBlk[i] = OSPoolGet(TEST_BLK_SIZE, &err);
+        OS_TEST_CHECK(err == OS_ERR_NONE);
+    }
+    OS_TEST_CHECK(OSPoolGet(TEST_BLK_SIZE, &err) == (void *)0);
+    OS_TEST_CHECK(err == OS_ERR_POOL_NO_FREE_BLKS);
+    TestCounts(0u, TEST_NBLKS - 1u, 1u);
+
+                                                 /* ----------- TASK DELETION FLUSHES ---------------- */
+    OS_TEST_CHECK(OSTaskDel(TEST_LO_TASK_PRIO) == OS_ERR_NONE);
+    TestCounts(1u, TEST_NBLKS - 1u, 0u);
+    OS_TEST_CHECK(OSPoolGet(TEST_BLK_SIZE, &err) != (void *)0);
+
+    OS_CPU_SimStop();
+}
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    return (OS_TestRun("test_pool", TestTask, TEST_TASK_PRIO));
+}
@@ -0,0 +1,127 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                                           Test of the Port
+*
+* File      : TEST_PORT.C
+* Version   : V2.91
+*
+* Note(s)   : 1) Checks the scheduling, the simulated interrupts and the simulated time the other tests
+*                rely on.
+*********************************************************************************************************
+*/
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  TEST_TASK_PRIO              10u
+#define  TEST_HI_TASK_PRIO            5u
+#define  TEST_LO_TASK_PRIO           20u
+
+#define  TEST_INT_NBR                40u
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_EVENT  *TestSem;
+static  INT32U     TestHiCtr;                    /* Number of times the high priority task ran         */
+static  INT32U     TestLoCtr;                    /* Number of times the low  priority task ran         */
+static  INT32U     TestIntNbr;                   /* Exception number seen by the ISR                   */
+static  INT8U      TestIntNesting;               /* Nesting level seen by the ISR                      */
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TASKS
+*********************************************************************************************************
+*/
+
+static  void  TestHiTask (void *p_arg)
+{
+    INT8U  err;
+
+
+    (void)p_arg;
+    for (;;) {
+        OSSemPend(TestSem, 0u, &err);
+        TestHiCtr++;
+    }
+}
+
+static  void  TestLoTask (void *p_arg)
+{
+    (void)p_arg;
+    for (;;) {
+        TestLoCtr++;
+        OSTimeDly(1u);
+    }
+}
+
+static  void  TestISR (void)
+{
+    TestIntNbr     = OS_CPU_IntNbrGet();
+    TestIntNesting = OSIntNesting;
+    (void)OSSemPost(TestSem);
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              TEST TASK
+*********************************************************************************************************
+*/
+
+static  void  TestTask (void *p_arg)
+{
+    INT32U  time;
+
+
+    (void)p_arg;
+    TestSem = OSSemCreate(0u);
+    OS_TEST_CHECK(TestSem != (OS_EVENT *)0);
+
+    OS_TestTaskCreate(TestHiTask, (void *)0, TEST_HI_TASK_PRIO);   /* Runs at once and pends          */
+    OS_TEST_CHECK(TestHiCtr == 0u);
+    OS_TestTaskCreate(TestLoTask, (void *)0, TEST_LO_TASK_PRIO);   /* Does not run before we block    */
+    OS_TEST_CHECK(TestLoCtr == 0u);
+
+    (void)OSSemPost(TestSem);                    /* A task post switches to the HPT at once            */
+    OS_TEST_CHECK(TestHiCtr == 1u);
+
+    OS_CPU_SimInt(TestISR, TEST_INT_NBR);        /* So does an ISR post, when the ISR returns          */
+    OS_TEST_CHECK(TestHiCtr == 2u);
+    OS_TEST_CHECK(TestIntNbr == TEST_INT_NBR);
+    OS_TEST_CHECK(TestIntNesting == 1u);
+    OS_TEST_CHECK(OS_CPU_IntNbrGet() == 0u);
+    OS_TEST_CHECK(OSIntNesting == 0u);
+
+    time = OSTimeGet();                          /* Time only elapses when all the tasks are blocked   */
+    OS_TEST_CHECK(OSTimeGet() == time);
+    OS_TEST_CHECK(TestLoCtr == 0u);
+    OSTimeDly(10u);
+    OS_TEST_CHECK(OSTimeGet() == time + 10u);
+    OS_TEST_CHECK(TestLoCtr == 10u);             /* The low priority task ran once per tick            */
+
+    OS_CPU_SimStop();
+}
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    return (OS_TestRun("test_port", TestTask, TEST_TASK_PRIO));
+}
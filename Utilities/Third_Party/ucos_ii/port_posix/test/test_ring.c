@@ -0,0 +1,147 @@
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*                                         POSIX (Linux) Host Port
+*                                        Test of the Ring Buffers
+*
+* File      : TEST_RING.C
+* Version   : V2.91
+*********************************************************************************************************
+*/
+
+#include "os_test.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  TEST_TASK_PRIO              10u
+#define  TEST_HI_TASK_PRIO            5u         /* Consumer of higher priority than the test task     */
+#define  TEST_LO_TASK_PRIO           20u         /* ... and of lower priority                          */
+
+#define  TEST_RING_SIZE               8u
+#define  TEST_RING_WATERMARK          4u
+
+/*
+*********************************************************************************************************
+*                                           LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  test_consumer {
+    OS_RING  *Ring;
+    INT32U    Buf[TEST_RING_SIZE];
+    INT16U    Nbr;                               /* Result of the last OSRingPend()                    */
+    INT8U     Err;
+    INT32U    Runs;                              /* Number of calls that returned                      */
+} TEST_CONSUMER;
+
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  INT32U         TestStorage[2][TEST_RING_SIZE];
+static  TEST_CONSUMER  TestHi;
+static  TEST_CONSUMER  TestLo;
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TASKS
+*********************************************************************************************************
+*/
+
+static  void  TestConsumerTask (void *p_arg)
+{
+    TEST_CONSUMER  *pcons;
+
+
+    pcons = (TEST_CONSUMER *)p_arg;
+    for (;;) {
+        pcons->Nbr = OSRingPend(pcons->Ring, pcons->Buf, TEST_RING_SIZE, 0u, &pcons->Err);
+        pcons->Runs++;
+        if (pcons->Err == OS_ERR_RING_EMPTY) {   /* Ring deleted                                       */
+            (void)OSTaskSuspend(OS_PRIO_SELF);
+        }
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                              TEST TASK
+*********************************************************************************************************
+*/
+
+static  void  TestTask (void *p_arg)
+{
+    INT32U  val;
+    INT32U  buf[TEST_RING_SIZE];
+    INT8U   err;
+
+
+    (void)p_arg;
+                                                 /* ---------------- POST AND ACCEPT ----------------- */
+    TestHi.Ring = OSRingCreate(TestStorage[0], TEST_RING_SIZE, sizeof(INT32U), TEST_RING_WATERMARK, &err);
+    OS_TEST_CHECK(err == OS_ERR_NONE);
+    for (val = 0u; val < TEST_RING_SIZE; val++) {
+        OS_TEST_CHECK(OSRingPost(TestHi.Ring, &val) == OS_ERR_NONE);
+    }
+    OS_TEST_CHECK(OSRingPost(TestHi.Ring, &val) == OS_ERR_RING_FULL);
+    OS_TEST_CHECK(OSRingAccept(TestHi.Ring, buf, TEST_RING_SIZE, &err) == TEST_RING_SIZE);
+    OS_TEST_CHECK((buf[0] == 0u) && (buf[TEST_RING_SIZE - 1u] == TEST_RING_SIZE - 1u));
+    OS_TEST_CHECK(OSRingAccept(TestHi.Ring, buf, TEST_RING_SIZE, &err) == 0u);
+    OS_TEST_CHECK(err == OS_ERR_RING_EMPTY);
+
+                                                 /* ------------- WAKE-UP AT THE WATERMARK ----------- */
+    OS_TestTaskCreate(TestConsumerTask, &TestHi, TEST_HI_TASK_PRIO);
+    OS_TEST_CHECK(TestHi.Runs == 0u);
+    for (val = 1u; val < TEST_RING_WATERMARK; val++) {
+        (void)OSRingPost(TestHi.Ring, &val);
+    }
+    OS_TEST_CHECK(TestHi.Runs == 0u);
+    (void)OSRingPost(TestHi.Ring, &val);         /* Watermark reached, the consumer runs at once       */
+    OS_TEST_CHECK(TestHi.Runs == 1u);
+    OS_TEST_CHECK(TestHi.Nbr == TEST_RING_WATERMARK);
+    OS_TEST_CHECK(TestHi.Err == OS_ERR_NONE);
+
+                                                 /* ------- DELETE, HIGHER PRIORITY CONSUMER --------- */
+    (void)OSRingPost(TestHi.Ring, &val);         /* Below the watermark, the consumer keeps waiting    */
+    OS_TEST_CHECK(TestHi.Runs == 1u);
+    OS_TEST_CHECK(OSRingDel(TestHi.Ring, &err) == (OS_RING *)0);
+    OS_TEST_CHECK(err == OS_ERR_NONE);
+    OS_TEST_CHECK(TestHi.Runs == 2u);            /* Ran inside OSRingDel()                             */
+    OS_TEST_CHECK(TestHi.Nbr == 0u);
+    OS_TEST_CHECK(TestHi.Err == OS_ERR_RING_EMPTY);
+
+                                                 /* -------- DELETE, LOWER PRIORITY CONSUMER --------- */
+    TestLo.Ring = OSRingCreate(TestStorage[1], TEST_RING_SIZE, sizeof(INT32U), TEST_RING_WATERMARK, &err);
+    OS_TEST_CHECK(err == OS_ERR_NONE);
+    OS_TestTaskCreate(TestConsumerTask, &TestLo, TEST_LO_TASK_PRIO);
+    OSTimeDly(1u);                               /* Let the consumer wait on the ring                  */
+    (void)OSRingPost(TestLo.Ring, &val);
+    OS_TEST_CHECK(OSRingDel(TestLo.Ring, &err) == (OS_RING *)0);
+    OS_TEST_CHECK(TestLo.Runs == 0u);
+    OSTimeDly(1u);                               /* The consumer runs after the ring is gone           */
+    OS_TEST_CHECK(TestLo.Runs == 1u);
+    OS_TEST_CHECK(TestLo.Nbr == 0u);
+    OS_TEST_CHECK(TestLo.Err == OS_ERR_RING_EMPTY);
+
+    OS_CPU_SimStop();
+}
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    return (OS_TestRun("test_ring", TestTask, TEST_TASK_PRIO));
+}
@@ -587,10 +587,26 @@ void  OSInit (void)
     OS_MemInit();                                                /* Initialize the memory manager            */
 #endif
 
+#if (OS_POOL_EN > 0u) && (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
+    OS_PoolInit();                                               /* Initialize the size-class memory pools   */
+#endif
+
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+    OS_PIMutexInit();                                            /* Initialize the PI mutex structures       */
+#endif
+
 #if (OS_Q_EN > 0u) && (OS_MAX_QS > 0u)
     OS_QInit();                                                  /* Initialize the message queue structures  */
 #endif
 
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+    OS_RingInit();                                               /* Initialize the ring buffer structures    */
+#endif
+
+#if OS_TRACE_EN > 0u
+    OS_TraceInit();                                              /* Initialize the event trace               */
+#endif
+
     OS_InitTaskIdle();                                           /* Create the Idle Task                     */
 #if OS_TASK_STAT_EN > 0u
     OS_InitTaskStat();                                           /* Create the Statistic Task                */
@@ -600,6 +616,10 @@ void  OSInit (void)
     OSTmr_Init();                                                /* Initialize the Timer Manager             */
 #endif
 
+#if (OS_HTMR_EN > 0u) && (OS_HTMR_CFG_MAX > 0u)
+    OS_HTmrInit();                                               /* Initialize the High Resolution Timers    */
+#endif
+
     OSInitHookEnd();                                             /* Call port specific init. code            */
 
 #if OS_DEBUG_EN > 0u
@@ -637,6 +657,9 @@ void  OSIntEnter (void)
     if (OSRunning == OS_TRUE) {
         if (OSIntNesting < 255u) {
             OSIntNesting++;                      /* Increment ISR nesting level                        */
+#if OS_TRACE_EN > 0u
+            OS_TraceIntEnter();                  /* Time stamp the ISR entry                           */
+#endif
         }
     }
 }
@@ -686,6 +709,9 @@ void  OSIntExit (void)
                 }
             }
         }
+#if OS_TRACE_EN > 0u
+        OS_TraceIntExit();                                 /* Time stamp the ISR exit                  */
+#endif
         OS_EXIT_CRITICAL();
     }
 }
@@ -939,6 +965,11 @@ void  OSTimeTick (void)
                 if (ptcb->OSTCBDly == 0u) {                /* Check for timeout                            */
 
                     if ((ptcb->OSTCBStat & OS_STAT_PEND_ANY) != OS_STAT_RDY) {
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+                        if (ptcb->OSTCBPIMutexPend != (OS_PIMUTEX *)0) {
+                            OS_PIMutexWaitRemove(ptcb);                        /* Take back inherited prio */
+                        }
+#endif
                         ptcb->OSTCBStat  &= (INT8U)~(INT8U)OS_STAT_PEND_ANY;          /* Yes, Clear status flag   */
                         ptcb->OSTCBStatPend = OS_STAT_PEND_TO;                 /* Indicate PEND timeout    */
                     } else {
@@ -1652,6 +1683,55 @@ void  OS_Sched (void)
     OS_EXIT_CRITICAL();
 }
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  COMPLETE THE POSTS DEFERRED BY ISRs
+*
+* Description: This function is called by the port when it performs a context switch (at the start of the
+*              PendSV handler on Cortex-M), i.e. at the lowest interrupt priority once all the ISRs are
+*              done.  It completes the posts that ISRs deferred (see OSFlagPost()) and, if tasks were made
+*              ready, selects again the task to switch to.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Notes      : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are enabled when this function is called.
+*              3) A context switch must be in progress: the port switches from 'OSTCBCur' to 'OSTCBHighRdy',
+*                 which may be the same task.
+*********************************************************************************************************
+*/
+
+void  OS_SchedDeferred (void)
+{
+#if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u) && (OS_FLAG_POST_DEFER_EN > 0u)
+    BOOLEAN    sched;
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    if (OSFlagDeferList == (OS_FLAG_GRP *)0) {         /* Nothing deferred, the usual case             */
+        return;
+    }
+    sched = OS_FlagDeferRun();
+    if (sched == OS_TRUE) {
+        OS_ENTER_CRITICAL();
+        if (OSLockNesting == 0u) {                     /* Keep the current task if scheduler locked    */
+            OS_SchedNew();
+            if ((OSPrioHighRdy != OSPrioCur) && (OSTCBHighRdy == OSTCBCur)) {
+                OSCtxSwCtr++;                          /* Switch not already counted by OSIntExit()    */
+            }
+            OSTCBHighRdy = OSTCBPrioTbl[OSPrioHighRdy];
+        }
+        OS_EXIT_CRITICAL();
+    }
+#endif
+}
+
 
 /*
 *********************************************************************************************************
@@ -1853,7 +1933,7 @@ void  OS_TaskStatStkChk (void)
     for (prio = 0u; prio <= OS_TASK_IDLE_PRIO; prio++) {
         err = OSTaskStkChk(prio, &stk_data);
         if (err == OS_ERR_NONE) {
-            ptcb = OSTCBPrioTbl[prio];
+            ptcb = OS_TCB_PRIO_GET(prio);
             if (ptcb != (OS_TCB *)0) {                               /* Make sure task 'ptcb' is ...   */
                 if (ptcb != OS_TCB_RESERVED) {                       /* ... still valid.               */
 #if OS_TASK_PROFILE_EN > 0u
@@ -1926,9 +2006,12 @@ INT8U  OS_TCBInit (INT8U    prio,
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
-#if OS_TASK_REG_TBL_SIZE > 0u
+#if (OS_TASK_REG_TBL_SIZE > 0u) || ((OS_POOL_EN > 0u) && (OS_POOL_TASK_CACHE_EN > 0u))
     INT8U      i;
 #endif
+#if OS_TASK_STK_GUARD_EN > 0u
+    INT32U     adj;
+#endif
 
 
     OS_ENTER_CRITICAL();
@@ -1948,6 +2031,25 @@ INT8U  OS_TCBInit (INT8U    prio,
         ptcb->OSTCBStkBottom     = pbos;                   /* Store pointer to bottom of stack         */
         ptcb->OSTCBOpt           = opt;                    /* Store task options                       */
         ptcb->OSTCBId            = id;                     /* Store task ID                            */
+#if OS_TASK_STK_GUARD_EN > 0u
+        ptcb->OSTCBStkGuard      = (OS_STK *)0;            /* Guard the bottom of the stack with a ... */
+        if (pbos != (OS_STK *)0) {                         /* ... region aligned on its size           */
+#if OS_STK_GROWTH == 1u
+            adj = (INT32U)((0u - (OS_CPU_ADDR)pbos) & (OS_TASK_STK_GUARD_SIZE - 1u));
+            if ((stk_size * sizeof(OS_STK)) >= (adj + 2u * OS_TASK_STK_GUARD_SIZE)) {
+                ptcb->OSTCBStkGuard = (OS_STK *)((INT8U *)pbos + adj);
+            }
+#else
+            adj = (INT32U)((OS_CPU_ADDR)(pbos + 1) & (OS_TASK_STK_GUARD_SIZE - 1u));
+            if ((stk_size * sizeof(OS_STK)) >= (adj + 2u * OS_TASK_STK_GUARD_SIZE)) {
+                ptcb->OSTCBStkGuard = (OS_STK *)((INT8U *)(pbos + 1) - adj - OS_TASK_STK_GUARD_SIZE);
+            }
+#endif
+        }
+#endif
+#if OS_TASK_STK_WM_EN > 0u
+        ptcb->OSTCBStkWM         = 0u;                     /* No stack entry known to be used yet      */
+#endif
 #else
         pext                     = pext;                   /* Prevent compiler warning if not used     */
         stk_size                 = stk_size;
@@ -1986,6 +2088,21 @@ INT8U  OS_TCBInit (INT8U    prio,
         ptcb->OSTCBMsg       = (void *)0;                  /* No message received                      */
 #endif
 
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+        ptcb->OSTCBBasePrio    = prio;                     /* Task owns and waits for no PI mutex      */
+        ptcb->OSTCBPIPrio      = prio;
+        ptcb->OSTCBPIMutexHeld = (OS_PIMUTEX *)0;
+        ptcb->OSTCBPIMutexPend = (OS_PIMUTEX *)0;
+        ptcb->OSTCBPIWaitNext  = (OS_TCB *)0;
+#endif
+
+#if (OS_POOL_EN > 0u) && (OS_POOL_TASK_CACHE_EN > 0u)
+        for (i = 0u; i < OS_POOL_NBR_CLASSES; i++) {       /* Task has no cached pool block            */
+            ptcb->OSTCBPoolCache[i]    = (void *)0;
+            ptcb->OSTCBPoolCacheCtr[i] = 0u;
+        }
+#endif
+
 #if OS_TASK_PROFILE_EN > 0u
         ptcb->OSTCBCtxSwCtr    = 0uL;                      /* Initialize profiling variables           */
         ptcb->OSTCBCyclesStart = 0uL;
@@ -1994,6 +2111,12 @@ INT8U  OS_TCBInit (INT8U    prio,
         ptcb->OSTCBStkUsed     = 0uL;
 #endif
 
+#if OS_TRACE_EN > 0u
+        ptcb->OSTCBCyclesPrev  = 0uL;                      /* Initialize trace statistics              */
+        ptcb->OSTCBLatMax      = 0uL;
+        ptcb->OSTCBCPUUsage    = 0u;
+#endif
+
 #if OS_TASK_NAME_EN > 0u
         ptcb->OSTCBTaskName    = (INT8U *)(void *)"?";
 #endif
@@ -26,13 +26,41 @@
 #endif
 
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
+/*
+*********************************************************************************************************
+*                                                 NOTES
+*
+* 1) The tasks waiting on a group are kept in buckets: all the tasks waiting for the same flags with the
+*    same wait type (and OS_FLAG_CONSUME option) share a bucket, in priority order.  The group's wait list
+*    links the first node (head) of every bucket.  OSFlagPost() evaluates each bucket once, however many
+*    tasks wait in it, then readies its tasks in O(1) each.
+*
+* 2) With OS_FLAG_CONSUME, the flags are consumed when the task is readied by OSFlagPost(), not when it
+*    resumes.  Every bucket is checked against the value of the flags when the wait list is scanned, then
+*    the flags of the satisfied consuming buckets are consumed at once: a post readies all the buckets it
+*    satisfies, whatever their order in the wait list.  Only the highest priority task of a consuming
+*    bucket gets the flags.
+*
+* 3) When OS_FLAG_POST_DEFER_EN is enabled, OSFlagPost() called from an ISR only updates the flags and
+*    marks the group, in constant time.  The wait list is checked by OS_FlagDeferRun() when the port
+*    performs the context switch (PendSV on Cortex-M, at the lowest interrupt priority), once per group
+*    for all the posts of nested or back to back ISRs.  Waiters see the last value of the flags.  A group
+*    deleted before that is removed from the list of groups to check.
+*********************************************************************************************************
+*/
+
 /*
 *********************************************************************************************************
 *                                            LOCAL PROTOTYPES
 *********************************************************************************************************
 */
 
-static  void     OS_FlagBlock(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode, OS_FLAGS flags, INT8U wait_type, INT32U timeout);
+static  void     OS_FlagBlock(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode, OS_FLAGS flags, INT8U wait_type, BOOLEAN consume, INT32U timeout);
+static  void     OS_FlagBucketMove(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pfrom, OS_FLAG_NODE *pto);
+#if (OS_FLAG_DEL_EN > 0u) && (OS_FLAG_POST_DEFER_EN > 0u)
+static  void     OS_FlagDeferUnlink(OS_FLAG_GRP *pgrp);
+#endif
+static  BOOLEAN  OS_FlagPostRdy(OS_FLAG_GRP *pgrp);
 static  BOOLEAN  OS_FlagTaskRdy(OS_FLAG_NODE *pnode, OS_FLAGS flags_rdy);
 
 /*$PAGE*/
@@ -291,6 +319,8 @@ OS_FLAG_GRP  *OSFlagCreate (OS_FLAGS  flags,
 *                 the event flag group MUST check the return code of OSFlagAccept() and OSFlagPend().
 *              2) This call can potentially disable interrupts for a long time.  The interrupt disable
 *                 time is directly proportional to the number of tasks waiting on the event flag group.
+*              3) A group posted by an ISR and not yet checked by OS_FlagDeferRun() is removed from the
+*                 list of groups to check, so that the group can be reused.
 *********************************************************************************************************
 */
 
@@ -337,6 +367,9 @@ OS_FLAG_GRP  *OSFlagDel (OS_FLAG_GRP  *pgrp,
     switch (opt) {
         case OS_DEL_NO_PEND:                               /* Delete group if no task waiting          */
              if (tasks_waiting == OS_FALSE) {
+#if OS_FLAG_POST_DEFER_EN > 0u
+                 OS_FlagDeferUnlink(pgrp);                 /* Waiters may have timed out since an ISR post */
+#endif
 #if OS_FLAG_NAME_EN > 0u
                  pgrp->OSFlagName     = (INT8U *)(void *)"?";
 #endif
@@ -357,9 +390,12 @@ OS_FLAG_GRP  *OSFlagDel (OS_FLAG_GRP  *pgrp,
         case OS_DEL_ALWAYS:                                /* Always delete the event flag group       */
              pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
              while (pnode != (OS_FLAG_NODE *)0) {          /* Ready ALL tasks waiting for flags        */
-                 (void)OS_FlagTaskRdy(pnode, (OS_FLAGS)0);
-                 pnode = (OS_FLAG_NODE *)pnode->OSFlagNodeNext;
+                 (void)OS_FlagTaskRdy(pnode, (OS_FLAGS)0); /* Next peer, if any, becomes bucket head   */
+                 pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
              }
+#if OS_FLAG_POST_DEFER_EN > 0u
+             OS_FlagDeferUnlink(pgrp);                     /* Not to be checked after an ISR post      */
+#endif
 #if OS_FLAG_NAME_EN > 0u
              pgrp->OSFlagName     = (INT8U *)(void *)"?";
 #endif
@@ -639,7 +675,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
                  *perr                   = OS_ERR_NONE;
                  return (flags_rdy);
              } else {                                      /* Block task until events occur or timeout */
-                 OS_FlagBlock(pgrp, &node, flags, wait_type, timeout);
+                 OS_FlagBlock(pgrp, &node, flags, wait_type, consume, timeout);
                  OS_EXIT_CRITICAL();
              }
              break;
@@ -655,7 +691,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
                  *perr                   = OS_ERR_NONE;
                  return (flags_rdy);
              } else {                                      /* Block task until events occur or timeout */
-                 OS_FlagBlock(pgrp, &node, flags, wait_type, timeout);
+                 OS_FlagBlock(pgrp, &node, flags, wait_type, consume, timeout);
                  OS_EXIT_CRITICAL();
              }
              break;
@@ -672,7 +708,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
                  *perr                   = OS_ERR_NONE;
                  return (flags_rdy);
              } else {                                      /* Block task until events occur or timeout */
-                 OS_FlagBlock(pgrp, &node, flags, wait_type, timeout);
+                 OS_FlagBlock(pgrp, &node, flags, wait_type, consume, timeout);
                  OS_EXIT_CRITICAL();
              }
              break;
@@ -688,7 +724,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
                  *perr                   = OS_ERR_NONE;
                  return (flags_rdy);
              } else {                                      /* Block task until events occur or timeout */
-                 OS_FlagBlock(pgrp, &node, flags, wait_type, timeout);
+                 OS_FlagBlock(pgrp, &node, flags, wait_type, consume, timeout);
                  OS_EXIT_CRITICAL();
              }
              break;
@@ -722,26 +758,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
         }
         return (flags_rdy);
     }
-    flags_rdy = OSTCBCur->OSTCBFlagsRdy;
-    if (consume == OS_TRUE) {                              /* See if we need to consume the flags      */
-        switch (wait_type) {
-            case OS_FLAG_WAIT_SET_ALL:
-            case OS_FLAG_WAIT_SET_ANY:                     /* Clear ONLY the flags we got              */
-                 pgrp->OSFlagFlags &= (OS_FLAGS)~flags_rdy;
-                 break;
-
-#if OS_FLAG_WAIT_CLR_EN > 0u
-            case OS_FLAG_WAIT_CLR_ALL:
-            case OS_FLAG_WAIT_CLR_ANY:                     /* Set   ONLY the flags we got              */
-                 pgrp->OSFlagFlags |=  flags_rdy;
-                 break;
-#endif
-            default:
-                 OS_EXIT_CRITICAL();
-                 *perr = OS_ERR_FLAG_WAIT_TYPE;
-                 return ((OS_FLAGS)0);
-        }
-    }
+    flags_rdy = OSTCBCur->OSTCBFlagsRdy;                   /* Already consumed by OS_FlagPostRdy()     */
     OS_EXIT_CRITICAL();
     *perr = OS_ERR_NONE;                                   /* Event(s) must have occurred              */
     return (flags_rdy);
@@ -813,10 +830,13 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (void)
 *
 * Called From: Task or ISR
 *
-* WARNING(s) : 1) The execution time of this function depends on the number of tasks waiting on the event
-*                 flag group.
-*              2) The amount of time interrupts are DISABLED depends on the number of tasks waiting on
-*                 the event flag group.
+* WARNING(s) : 1) The execution time of this function depends on the number of different waits (flags
+*                 and wait type) pending on the event flag group.
+*              2) The amount of time interrupts are DISABLED depends on the number of different waits
+*                 pending on the event flag group.
+*              3) From an ISR, with OS_FLAG_POST_DEFER_EN, the wait list is checked later (see the notes
+*                 at the top of this file) and the value returned does not reflect the flags consumed by
+*                 the waiting tasks.
 *********************************************************************************************************
 */
 OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
@@ -824,11 +844,8 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
                       INT8U         opt,
                       INT8U        *perr)
 {
-    OS_FLAG_NODE *pnode;
     BOOLEAN       sched;
     OS_FLAGS      flags_cur;
-    OS_FLAGS      flags_rdy;
-    BOOLEAN       rdy;
 #if OS_CRITICAL_METHOD == 3u                         /* Allocate storage for CPU status register       */
     OS_CPU_SR     cpu_sr = 0u;
 #endif
@@ -867,58 +884,21 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
              *perr = OS_ERR_FLAG_INVALID_OPT;
              return ((OS_FLAGS)0);
     }
-    sched = OS_FALSE;                                /* Indicate that we don't need rescheduling       */
-    pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
-    while (pnode != (OS_FLAG_NODE *)0) {             /* Go through all tasks waiting on event flag(s)  */
-        switch (pnode->OSFlagNodeWaitType) {
-            case OS_FLAG_WAIT_SET_ALL:               /* See if all req. flags are set for current node */
-                 flags_rdy = (OS_FLAGS)(pgrp->OSFlagFlags & pnode->OSFlagNodeFlags);
-                 if (flags_rdy == pnode->OSFlagNodeFlags) {
-                     rdy = OS_FlagTaskRdy(pnode, flags_rdy);  /* Make task RTR, event(s) Rx'd          */
-                     if (rdy == OS_TRUE) {
-                         sched = OS_TRUE;                     /* When done we will reschedule          */
-                     }
-                 }
-                 break;
-
-            case OS_FLAG_WAIT_SET_ANY:               /* See if any flag set                            */
-                 flags_rdy = (OS_FLAGS)(pgrp->OSFlagFlags & pnode->OSFlagNodeFlags);
-                 if (flags_rdy != (OS_FLAGS)0) {
-                     rdy = OS_FlagTaskRdy(pnode, flags_rdy);  /* Make task RTR, event(s) Rx'd          */
-                     if (rdy == OS_TRUE) {
-                         sched = OS_TRUE;                     /* When done we will reschedule          */
-                     }
-                 }
-                 break;
-
-#if OS_FLAG_WAIT_CLR_EN > 0u
-            case OS_FLAG_WAIT_CLR_ALL:               /* See if all req. flags are set for current node */
-                 flags_rdy = (OS_FLAGS)~pgrp->OSFlagFlags & pnode->OSFlagNodeFlags;
-                 if (flags_rdy == pnode->OSFlagNodeFlags) {
-                     rdy = OS_FlagTaskRdy(pnode, flags_rdy);  /* Make task RTR, event(s) Rx'd          */
-                     if (rdy == OS_TRUE) {
-                         sched = OS_TRUE;                     /* When done we will reschedule          */
-                     }
-                 }
-                 break;
-
-            case OS_FLAG_WAIT_CLR_ANY:               /* See if any flag set                            */
-                 flags_rdy = (OS_FLAGS)~pgrp->OSFlagFlags & pnode->OSFlagNodeFlags;
-                 if (flags_rdy != (OS_FLAGS)0) {
-                     rdy = OS_FlagTaskRdy(pnode, flags_rdy);  /* Make task RTR, event(s) Rx'd          */
-                     if (rdy == OS_TRUE) {
-                         sched = OS_TRUE;                     /* When done we will reschedule          */
-                     }
-                 }
-                 break;
-#endif
-            default:
-                 OS_EXIT_CRITICAL();
-                 *perr = OS_ERR_FLAG_WAIT_TYPE;
-                 return ((OS_FLAGS)0);
+#if OS_FLAG_POST_DEFER_EN > 0u
+    if ((OSIntNesting > 0u) && (OSRunning == OS_TRUE)) {   /* From an ISR, defer the wait list check   */
+        if ((pgrp->OSFlagWaitList != (void *)0) && (pgrp->OSFlagDeferPend == OS_FALSE)) {
+            pgrp->OSFlagDeferPend = OS_TRUE;
+            pgrp->OSFlagDeferNext = OSFlagDeferList;
+            OSFlagDeferList       = pgrp;
+            OSIntCtxSw();                            /* Request the context switch (PendSV)            */
         }
-        pnode = (OS_FLAG_NODE *)pnode->OSFlagNodeNext; /* Point to next task waiting for event flag(s) */
+        flags_cur = pgrp->OSFlagFlags;
+        OS_EXIT_CRITICAL();
+        *perr     = OS_ERR_NONE;
+        return (flags_cur);
     }
+#endif
+    sched = OS_FlagPostRdy(pgrp);                    /* Ready the tasks whose wait is satisfied        */
     OS_EXIT_CRITICAL();
     if (sched == OS_TRUE) {
         OS_Sched();
@@ -1011,6 +991,8 @@ OS_FLAGS  OSFlagQuery (OS_FLAG_GRP  *pgrp,
 *                            OS_FLAG_WAIT_SET_ALL   You will check ALL bits in 'mask' to be set   (1)
 *                            OS_FLAG_WAIT_SET_ANY   You will check ANY bit  in 'mask' to be set   (1)
 *
+*              consume       is OS_TRUE if the flags are consumed when the task is readied.
+*
 *              timeout       is the desired amount of time that the task will wait for the event flag
 *                            bit(s) to be set.
 *
@@ -1018,7 +1000,9 @@ OS_FLAGS  OSFlagQuery (OS_FLAG_GRP  *pgrp,
 *
 * Called by  : OSFlagPend()  OS_FLAG.C
 *
-* Note(s)    : This function is INTERNAL to uC/OS-II and your application should not call it.
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) The node joins the bucket of the same wait, in priority order, or starts a new bucket at
+*                 the beginning of the wait list.
 *********************************************************************************************************
 */
 
@@ -1026,9 +1010,13 @@ static  void  OS_FlagBlock (OS_FLAG_GRP  *pgrp,
                             OS_FLAG_NODE *pnode,
                             OS_FLAGS      flags,
                             INT8U         wait_type,
+                            BOOLEAN       consume,
                             INT32U        timeout)
 {
+    OS_FLAG_NODE  *phead;
+    OS_FLAG_NODE  *ppeer;
     OS_FLAG_NODE  *pnode_next;
+    INT8U          prio;
     INT8U          y;
 
 
@@ -1038,17 +1026,50 @@ static  void  OS_FlagBlock (OS_FLAG_GRP  *pgrp,
 #if OS_TASK_DEL_EN > 0u
     OSTCBCur->OSTCBFlagNode   = pnode;                /* TCB to link to node                           */
 #endif
+    if (consume == OS_TRUE) {
+        wait_type |= OS_FLAG_CONSUME;                 /* Consuming waits have their own buckets        */
+    }
     pnode->OSFlagNodeFlags    = flags;                /* Save the flags that we need to wait for       */
     pnode->OSFlagNodeWaitType = wait_type;            /* Save the type of wait we are doing            */
     pnode->OSFlagNodeTCB      = (void *)OSTCBCur;     /* Link to task's TCB                            */
-    pnode->OSFlagNodeNext     = pgrp->OSFlagWaitList; /* Add node at beginning of event flag wait list */
-    pnode->OSFlagNodePrev     = (void *)0;
     pnode->OSFlagNodeFlagGrp  = (void *)pgrp;         /* Link to Event Flag Group                      */
-    pnode_next                = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
-    if (pnode_next != (void *)0) {                    /* Is this the first NODE to insert?             */
-        pnode_next->OSFlagNodePrev = pnode;           /* No, link in doubly linked list                */
+    pnode->OSFlagNodeNext     = (void *)0;
+    pnode->OSFlagNodePrev     = (void *)0;
+    pnode->OSFlagNodePeerNext = (void *)0;
+    pnode->OSFlagNodePeerPrev = (void *)0;
+
+    phead = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;     /* Find the bucket of the same wait              */
+    while ((phead != (OS_FLAG_NODE *)0) &&
+           ((phead->OSFlagNodeFlags != flags) || (phead->OSFlagNodeWaitType != wait_type))) {
+        phead = (OS_FLAG_NODE *)phead->OSFlagNodeNext;
+    }
+    prio = OSTCBCur->OSTCBPrio;
+    if (phead == (OS_FLAG_NODE *)0) {                 /* New bucket at beginning of wait list          */
+        pnode_next            = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
+        pnode->OSFlagNodeNext = (void *)pnode_next;
+        if (pnode_next != (OS_FLAG_NODE *)0) {
+            pnode_next->OSFlagNodePrev = pnode;
+        }
+        pgrp->OSFlagWaitList  = (void *)pnode;
+    } else if (prio < ((OS_TCB *)phead->OSFlagNodeTCB)->OSTCBPrio) {
+        OS_FlagBucketMove(pgrp, phead, pnode);        /* Higher priority than the head, replace it     */
+        pnode->OSFlagNodePeerNext = (void *)phead;
+        phead->OSFlagNodePeerPrev = (void *)pnode;
+    } else {                                          /* Insert among the peers, in priority order     */
+        ppeer      = phead;
+        pnode_next = (OS_FLAG_NODE *)ppeer->OSFlagNodePeerNext;
+        while ((pnode_next != (OS_FLAG_NODE *)0) &&
+               (((OS_TCB *)pnode_next->OSFlagNodeTCB)->OSTCBPrio < prio)) {
+            ppeer      = pnode_next;
+            pnode_next = (OS_FLAG_NODE *)ppeer->OSFlagNodePeerNext;
+        }
+        pnode->OSFlagNodePeerNext = (void *)pnode_next;
+        pnode->OSFlagNodePeerPrev = (void *)ppeer;
+        if (pnode_next != (OS_FLAG_NODE *)0) {
+            pnode_next->OSFlagNodePeerPrev = (void *)pnode;
+        }
+        ppeer->OSFlagNodePeerNext = (void *)pnode;
     }
-    pgrp->OSFlagWaitList = (void *)pnode;
 
     y            =  OSTCBCur->OSTCBY;                 /* Suspend current task until flag(s) received   */
     OSRdyTbl[y] &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
@@ -1057,6 +1078,143 @@ static  void  OS_FlagBlock (OS_FLAG_GRP  *pgrp,
     }
 }
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  MOVE A BUCKET TO ANOTHER HEAD NODE
+*
+* Description: This function is internal to uC/OS-II and is used to put a new node at the head of a
+*              bucket, in place of the current head in the wait list of the event flag group.
+*
+* Arguments  : pgrp          is a pointer to the event flag group.
+*
+*              pfrom         is a pointer to the current head of the bucket.
+*
+*              pto           is a pointer to the new head of the bucket.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function assumes that interrupts are disabled.
+*              2) The peer links are NOT changed, the caller links 'pto' to the other nodes of the bucket.
+*********************************************************************************************************
+*/
+
+static  void  OS_FlagBucketMove (OS_FLAG_GRP  *pgrp,
+                                 OS_FLAG_NODE *pfrom,
+                                 OS_FLAG_NODE *pto)
+{
+    OS_FLAG_NODE  *pnode_prev;
+    OS_FLAG_NODE  *pnode_next;
+
+
+    pnode_prev          = (OS_FLAG_NODE *)pfrom->OSFlagNodePrev;
+    pnode_next          = (OS_FLAG_NODE *)pfrom->OSFlagNodeNext;
+    pto->OSFlagNodePrev = (void *)pnode_prev;
+    pto->OSFlagNodeNext = (void *)pnode_next;
+    if (pnode_prev == (OS_FLAG_NODE *)0) {            /* Was 'pfrom' the first bucket?                 */
+        pgrp->OSFlagWaitList       = (void *)pto;
+    } else {
+        pnode_prev->OSFlagNodeNext = (void *)pto;
+    }
+    if (pnode_next != (OS_FLAG_NODE *)0) {
+        pnode_next->OSFlagNodePrev = (void *)pto;
+    }
+    pfrom->OSFlagNodePrev = (void *)0;
+    pfrom->OSFlagNodeNext = (void *)0;
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                             CHECK THE WAIT LISTS OF THE GROUPS POSTED BY ISRs
+*
+* Description: This function is internal to uC/OS-II and is called by OS_SchedDeferred(), when the port
+*              performs a context switch, to ready the tasks waiting on the groups posted by ISRs since the
+*              last call.
+*
+* Arguments  : none
+*
+* Returns    : OS_TRUE       If at least one task has been placed in the ready list
+*              OS_FALSE      Otherwise
+*
+* Note(s)    : 1) Interrupts are enabled when this function is called.  They are disabled for one group at
+*                 a time.
+*              2) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_POST_DEFER_EN > 0u
+BOOLEAN  OS_FlagDeferRun (void)
+{
+    OS_FLAG_GRP  *pgrp;
+    BOOLEAN       sched;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR     cpu_sr = 0u;
+#endif
+
+
+
+    sched = OS_FALSE;
+    for (;;) {
+        OS_ENTER_CRITICAL();
+        pgrp = OSFlagDeferList;
+        if (pgrp == (OS_FLAG_GRP *)0) {
+            OS_EXIT_CRITICAL();
+            break;
+        }
+        OSFlagDeferList       = pgrp->OSFlagDeferNext;
+        pgrp->OSFlagDeferNext = (OS_FLAG_GRP *)0;
+        pgrp->OSFlagDeferPend = OS_FALSE;
+        if (OS_FlagPostRdy(pgrp) == OS_TRUE) {
+            sched = OS_TRUE;
+        }
+        OS_EXIT_CRITICAL();
+    }
+    return (sched);
+}
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                           REMOVE A GROUP FROM THE LIST OF GROUPS POSTED BY ISRs
+*
+* Description: This function is internal to uC/OS-II and is called by OSFlagDel() to remove a group from
+*              the list of groups checked by OS_FlagDeferRun(), if an ISR posted it since the last check.
+*
+* Arguments  : pgrp          is a pointer to the event flag group.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function assumes that interrupts are disabled.
+*              2) The list is only as long as the number of groups posted by ISRs since the last context
+*                 switch.
+*********************************************************************************************************
+*/
+
+#if (OS_FLAG_DEL_EN > 0u) && (OS_FLAG_POST_DEFER_EN > 0u)
+static  void  OS_FlagDeferUnlink (OS_FLAG_GRP  *pgrp)
+{
+    OS_FLAG_GRP  *pprev;
+
+
+    if (pgrp->OSFlagDeferPend == OS_FALSE) {          /* Not in the list                               */
+        return;
+    }
+    if (OSFlagDeferList == pgrp) {                    /* First group of the list?                      */
+        OSFlagDeferList = pgrp->OSFlagDeferNext;
+    } else {
+        pprev = OSFlagDeferList;
+        while (pprev->OSFlagDeferNext != pgrp) {
+            pprev = pprev->OSFlagDeferNext;
+        }
+        pprev->OSFlagDeferNext = pgrp->OSFlagDeferNext;
+    }
+    pgrp->OSFlagDeferNext = (OS_FLAG_GRP *)0;
+    pgrp->OSFlagDeferPend = OS_FALSE;
+}
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -1083,6 +1241,9 @@ void  OS_FlagInit (void)
 #if OS_FLAG_NAME_EN > 0u
     OSFlagFreeList->OSFlagName     = (INT8U *)"?";
 #endif
+#if OS_FLAG_POST_DEFER_EN > 0u
+    OSFlagFreeList->OSFlagDeferPend = OS_FALSE;
+#endif
 #endif
 
 #if OS_MAX_FLAGS >= 2u
@@ -1111,6 +1272,112 @@ void  OS_FlagInit (void)
 #endif
     OSFlagFreeList        = &OSFlagTbl[0];
 #endif
+
+#if OS_FLAG_POST_DEFER_EN > 0u
+    OSFlagDeferList       = (OS_FLAG_GRP *)0;
+#endif
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                              READY THE TASKS WHOSE WAIT IS SATISFIED
+*
+* Description: This function is internal to uC/OS-II and is used to check the wait list of an event flag
+*              group against the current value of its flags, and ready the tasks whose wait is satisfied.
+*
+* Arguments  : pgrp          is a pointer to the event flag group.
+*
+* Returns    : OS_TRUE       If at least one task has been placed in the ready list
+*              OS_FALSE      Otherwise
+*
+* Called by  : OSFlagPost()      OS_FLAG.C
+*              OS_FlagDeferRun() OS_FLAG.C
+*
+* Note(s)    : 1) This function assumes that interrupts are disabled.
+*              2) Each bucket is checked once, against the flags as they were on entry.  All the tasks of a
+*                 satisfied bucket are readied, except for a consuming bucket where only its highest
+*                 priority task gets the flags.  The flags are consumed after the whole wait list has been
+*                 checked, so a consuming bucket does not hide the flags from the buckets checked after it.
+*********************************************************************************************************
+*/
+
+static  BOOLEAN  OS_FlagPostRdy (OS_FLAG_GRP *pgrp)
+{
+    OS_FLAG_NODE *phead;
+    OS_FLAG_NODE *pnode;
+    OS_FLAG_NODE *pnode_next;
+    OS_FLAGS      flags;
+    OS_FLAGS      flags_rdy;
+    OS_FLAGS      flags_set;
+    OS_FLAGS      flags_clr;
+    INT8U         wait_type;
+    BOOLEAN       rdy;
+    BOOLEAN       sched;
+
+
+    sched     = OS_FALSE;                            /* Indicate that we don't need rescheduling       */
+    flags     = pgrp->OSFlagFlags;                   /* All the buckets see the same flags             */
+    flags_set = (OS_FLAGS)0;                         /* Flags consumed by the buckets waiting for ...  */
+    flags_clr = (OS_FLAGS)0;                         /* ... set flags and for cleared flags            */
+    phead     = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
+    while (phead != (OS_FLAG_NODE *)0) {             /* Go through all buckets of waiting tasks        */
+        pnode_next = (OS_FLAG_NODE *)phead->OSFlagNodeNext; /* Bucket may be emptied below             */
+        wait_type  = (INT8U)(phead->OSFlagNodeWaitType & (INT8U)~(INT8U)OS_FLAG_CONSUME);
+        switch (wait_type) {
+            case OS_FLAG_WAIT_SET_ALL:               /* See if all req. flags are set for the bucket   */
+                 flags_rdy = (OS_FLAGS)(flags & phead->OSFlagNodeFlags);
+                 rdy       = (BOOLEAN)(flags_rdy == phead->OSFlagNodeFlags);
+                 break;
+
+            case OS_FLAG_WAIT_SET_ANY:               /* See if any flag set                            */
+                 flags_rdy = (OS_FLAGS)(flags & phead->OSFlagNodeFlags);
+                 rdy       = (BOOLEAN)(flags_rdy != (OS_FLAGS)0);
+                 break;
+
+#if OS_FLAG_WAIT_CLR_EN > 0u
+            case OS_FLAG_WAIT_CLR_ALL:               /* See if all req. flags are clr for the bucket   */
+                 flags_rdy = (OS_FLAGS)~flags & phead->OSFlagNodeFlags;
+                 rdy       = (BOOLEAN)(flags_rdy == phead->OSFlagNodeFlags);
+                 break;
+
+            case OS_FLAG_WAIT_CLR_ANY:               /* See if any flag clr                            */
+                 flags_rdy = (OS_FLAGS)~flags & phead->OSFlagNodeFlags;
+                 rdy       = (BOOLEAN)(flags_rdy != (OS_FLAGS)0);
+                 break;
+#endif
+
+            default:
+                 flags_rdy = (OS_FLAGS)0;
+                 rdy       = OS_FALSE;
+                 break;
+        }
+        if (rdy == OS_TRUE) {
+            if ((phead->OSFlagNodeWaitType & OS_FLAG_CONSUME) != 0u) {
+                if ((wait_type == OS_FLAG_WAIT_SET_ALL) || (wait_type == OS_FLAG_WAIT_SET_ANY)) {
+                    flags_set |= flags_rdy;          /* Consume: clear ONLY the flags we got, below    */
+                } else {
+                    flags_clr |= flags_rdy;          /* Consume: set   ONLY the flags we got, below    */
+                }
+                if (OS_FlagTaskRdy(phead, flags_rdy) == OS_TRUE) {  /* Highest priority task only      */
+                    sched = OS_TRUE;
+                }
+            } else {
+                pnode = phead;
+                while (pnode != (OS_FLAG_NODE *)0) { /* Ready all the tasks of the bucket              */
+                    phead = (OS_FLAG_NODE *)pnode->OSFlagNodePeerNext;
+                    if (OS_FlagTaskRdy(pnode, flags_rdy) == OS_TRUE) {
+                        sched = OS_TRUE;             /* When done we will reschedule                   */
+                    }
+                    pnode = phead;
+                }
+            }
+        }
+        phead = pnode_next;                          /* Point to next bucket                           */
+    }
+    pgrp->OSFlagFlags &= (OS_FLAGS)~flags_set;       /* Consume the flags of all the satisfied buckets */
+    pgrp->OSFlagFlags |= flags_clr;
+    return (sched);
 }
 
 /*$PAGE*/
@@ -1190,22 +1457,38 @@ void  OS_FlagUnlink (OS_FLAG_NODE *pnode)
     OS_FLAG_GRP  *pgrp;
     OS_FLAG_NODE *pnode_prev;
     OS_FLAG_NODE *pnode_next;
+    OS_FLAG_NODE *ppeer_prev;
+    OS_FLAG_NODE *ppeer_next;
 
 
-    pnode_prev = (OS_FLAG_NODE *)pnode->OSFlagNodePrev;
-    pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeNext;
-    if (pnode_prev == (OS_FLAG_NODE *)0) {                      /* Is it first node in wait list?      */
-        pgrp                 = (OS_FLAG_GRP *)pnode->OSFlagNodeFlagGrp;
-        pgrp->OSFlagWaitList = (void *)pnode_next;              /*      Update list for new 1st node   */
-        if (pnode_next != (OS_FLAG_NODE *)0) {
-            pnode_next->OSFlagNodePrev = (OS_FLAG_NODE *)0;     /*      Link new 1st node PREV to NULL */
+    pgrp       = (OS_FLAG_GRP  *)pnode->OSFlagNodeFlagGrp;
+    ppeer_prev = (OS_FLAG_NODE *)pnode->OSFlagNodePeerPrev;
+    ppeer_next = (OS_FLAG_NODE *)pnode->OSFlagNodePeerNext;
+    if (ppeer_prev != (OS_FLAG_NODE *)0) {                      /* Is it a peer behind the bucket head?*/
+        ppeer_prev->OSFlagNodePeerNext = (void *)ppeer_next;    /* Yes, link around the node           */
+        if (ppeer_next != (OS_FLAG_NODE *)0) {
+            ppeer_next->OSFlagNodePeerPrev = (void *)ppeer_prev;
         }
-    } else {                                                    /* No,  A node somewhere in the list   */
-        pnode_prev->OSFlagNodeNext = pnode_next;                /*      Link around the node to unlink */
-        if (pnode_next != (OS_FLAG_NODE *)0) {                  /*      Was this the LAST node?        */
-            pnode_next->OSFlagNodePrev = pnode_prev;            /*      No, Link around current node   */
+    } else if (ppeer_next != (OS_FLAG_NODE *)0) {               /* Head, next peer becomes the head    */
+        ppeer_next->OSFlagNodePeerPrev = (void *)0;
+        OS_FlagBucketMove(pgrp, pnode, ppeer_next);
+    } else {                                                    /* Only node, remove the bucket        */
+        pnode_prev = (OS_FLAG_NODE *)pnode->OSFlagNodePrev;
+        pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeNext;
+        if (pnode_prev == (OS_FLAG_NODE *)0) {                  /* Is it first bucket in wait list?    */
+            pgrp->OSFlagWaitList = (void *)pnode_next;          /*      Update list for new 1st bucket */
+            if (pnode_next != (OS_FLAG_NODE *)0) {
+                pnode_next->OSFlagNodePrev = (OS_FLAG_NODE *)0; /*      Link new 1st node PREV to NULL */
+            }
+        } else {                                                /* No,  A bucket somewhere in the list */
+            pnode_prev->OSFlagNodeNext = pnode_next;            /*      Link around the node to unlink */
+            if (pnode_next != (OS_FLAG_NODE *)0) {              /*      Was this the LAST bucket?      */
+                pnode_next->OSFlagNodePrev = pnode_prev;        /*      No, Link around current node   */
+            }
         }
     }
+    pnode->OSFlagNodePeerPrev = (void *)0;
+    pnode->OSFlagNodePeerNext = (void *)0;
 #if OS_TASK_DEL_EN > 0u
     ptcb                = (OS_TCB *)pnode->OSFlagNodeTCB;
     ptcb->OSTCBFlagNode = (OS_FLAG_NODE *)0;
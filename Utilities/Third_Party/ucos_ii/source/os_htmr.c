@@ -0,0 +1,1074 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                   HIERARCHICAL TIMING WHEEL TIMERS
+*
+*                              (c) Copyright 1992-2009, Micrium, Weston, FL
+*                                           All Rights Reserved
+*
+* File    : OS_HTMR.C
+* By      : Jean J. Labrosse
+* Version : V2.91
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrim to properly license
+* its use in your product. We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*
+* Note(s) : 1) Time is counted by a free-running 32-bit hardware counter provided by the port
+*              (OS_CPU_HTmrGet()) at OS_HTMR_CFG_CLK_HZ, independently of the tick.  One count is the
+*              resolution of the timers.
+*
+*           2) Running timers are kept in a hierarchical timing wheel of OS_HTMR_LEVELS levels of
+*              OS_HTMR_SLOTS slots.  A timer is on level 'n' when the highest 4-bit digit in which its
+*              expiry time differs from the wheel time 'OSHTmrTime' is digit 'n', in the slot given by
+*              that digit.  When the wheel time reaches the start of a slot of level 'n' > 0, the timers
+*              of the slot are moved down to a lower level (cascaded): a timer is moved at most
+*              OS_HTMR_LEVELS - 1 times.  Starting and stopping a timer are O(1): doubly linked slot
+*              lists and a bitmap of the non-empty slots of each level ('OSHTmrMapTbl[]').
+*
+*           3) The wheel does not advance one count at a time: the compare register of the hardware
+*              timer is programmed for the next non-empty slot, and the wheel time jumps there in
+*              OSHTmrSignal().  No interrupt occurs while no timer is due or has to be cascaded.
+*
+*           4) A callback runs either in the timer ISR (OS_HTMR_OPT_ISR), with the restrictions of an ISR,
+*              or in the timer task (OS_HTMR_OPT_TASK) at OS_TASK_HTMR_PRIO.  A task level callback that
+*              has not run yet when the timer expires again is only called once.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+#if (OS_HTMR_EN > 0u) && (OS_HTMR_CFG_MAX > 0u)
+/*
+*********************************************************************************************************
+*                                            LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  OS_HTMR_LIST_EXP              OS_HTMR_LEVELS   /* 'OSHTmrLevel' of a timer in 'OSHTmrExpList' */
+#define  OS_HTMR_LIST_NONE                       0xFFu  /* 'OSHTmrLevel' of a timer in no list         */
+
+/*
+*********************************************************************************************************
+*                                          LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void     OS_HTmrArm        (void);
+
+static  void     OS_HTmrCascade    (void);
+
+static  void     OS_HTmrDoneUnlink (OS_HTMR  *ptmr);
+
+static  void     OS_HTmrInitTask   (void);
+
+static  void     OS_HTmrLink       (OS_HTMR  *ptmr);
+
+static  INT32U   OS_HTmrNextGet    (void);
+
+static  void     OS_HTmrTask       (void     *p_arg);
+
+static  void     OS_HTmrUnlink     (OS_HTMR  *ptmr);
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           CREATE A TIMER
+*
+* Description: This function creates a timer.  The timer is stopped, see OSHTmrStart().
+*
+* Arguments  : period        is the period of the timer, in counts of the hardware timer
+*                            (OS_HTMR_CFG_CLK_HZ), or 0 for a one-shot timer.  A periodic timer is
+*                            restarted from its previous expiry time so it does not drift.
+*
+*              opt           specifies where the callback runs:
+*
+*                            OS_HTMR_OPT_TASK    in the timer task
+*                            OS_HTMR_OPT_ISR     in the timer ISR
+*
+*              callback      is the function called when the timer expires, or NULL.
+*
+*              callback_arg  is the second argument passed to 'callback'.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The timer was created
+*                            OS_ERR_TMR_INVALID_PERIOD   If 'period' is above OS_HTMR_DLY_MAX
+*                            OS_ERR_TMR_INVALID_OPT      If 'opt' is invalid
+*                            OS_ERR_TMR_ISR              If you attempted to create a timer from an ISR
+*                            OS_ERR_TMR_NON_AVAIL        If no more timers are available
+*
+* Returns    : != (OS_HTMR *)0  is a pointer to the created timer
+*              == (OS_HTMR *)0  if the timer could not be created
+*********************************************************************************************************
+*/
+
+OS_HTMR  *OSHTmrCreate (INT32U            period,
+                        INT8U             opt,
+                        OS_HTMR_CALLBACK  callback,
+                        void             *callback_arg,
+                        INT8U            *perr)
+{
+    OS_HTMR   *ptmr;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (period > OS_HTMR_DLY_MAX) {
+        *perr = OS_ERR_TMR_INVALID_PERIOD;
+        return ((OS_HTMR *)0);
+    }
+    if ((opt != OS_HTMR_OPT_TASK) && (opt != OS_HTMR_OPT_ISR)) {
+        *perr = OS_ERR_TMR_INVALID_OPT;
+        return ((OS_HTMR *)0);
+    }
+#endif
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_TMR_ISR;                       /* ... can't CREATE from an ISR                  */
+        return ((OS_HTMR *)0);
+    }
+    OS_ENTER_CRITICAL();
+    ptmr = OSHTmrFreeList;                            /* Get a free timer                              */
+    if (ptmr != (OS_HTMR *)0) {
+        OSHTmrFreeList = ptmr->OSHTmrNext;
+    }
+    OS_EXIT_CRITICAL();
+    if (ptmr == (OS_HTMR *)0) {
+        *perr = OS_ERR_TMR_NON_AVAIL;
+        return ((OS_HTMR *)0);
+    }
+    ptmr->OSHTmrNext        = (OS_HTMR *)0;
+    ptmr->OSHTmrPrev        = (OS_HTMR *)0;
+    ptmr->OSHTmrDoneNext    = (OS_HTMR *)0;
+    ptmr->OSHTmrExpire      = 0u;
+    ptmr->OSHTmrPeriod      = period;
+    ptmr->OSHTmrCallback    = callback;
+    ptmr->OSHTmrCallbackArg = callback_arg;
+    ptmr->OSHTmrLevel       = OS_HTMR_LIST_NONE;
+    ptmr->OSHTmrSlot        = 0u;
+    ptmr->OSHTmrOpt         = opt;
+    ptmr->OSHTmrDonePend    = OS_FALSE;
+    ptmr->OSHTmrState       = OS_TMR_STATE_STOPPED;
+    ptmr->OSHTmrType        = OS_HTMR_TYPE;
+    *perr                   = OS_ERR_NONE;
+    return (ptmr);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            DELETE A TIMER
+*
+* Description: This function stops and deletes a timer.  A pending task level callback is cancelled.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The timer was deleted
+*                            OS_ERR_TMR_INVALID          If 'ptmr' is a NULL pointer
+*                            OS_ERR_TMR_INVALID_TYPE     If 'ptmr' is not pointing to a timer
+*                            OS_ERR_TMR_ISR              If you attempted to delete a timer from an ISR
+*                            OS_ERR_TMR_INACTIVE         If the timer was already deleted
+*
+* Returns    : OS_TRUE       if the timer was deleted
+*              OS_FALSE      if not or upon an error
+*********************************************************************************************************
+*/
+
+#if OS_HTMR_DEL_EN > 0u
+BOOLEAN  OSHTmrDel (OS_HTMR  *ptmr,
+                    INT8U    *perr)
+{
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (ptmr == (OS_HTMR *)0) {
+        *perr = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+#endif
+    if (ptmr->OSHTmrType != OS_HTMR_TYPE) {           /* Validate timer structure                      */
+        *perr = OS_ERR_TMR_INVALID_TYPE;
+        return (OS_FALSE);
+    }
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_TMR_ISR;                       /* ... can't DELETE from an ISR                  */
+        return (OS_FALSE);
+    }
+    OS_ENTER_CRITICAL();
+    if (ptmr->OSHTmrState == OS_TMR_STATE_UNUSED) {
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_TMR_INACTIVE;
+        return (OS_FALSE);
+    }
+    OS_HTmrUnlink(ptmr);                              /* Remove from the wheel and ...                 */
+    OS_HTmrDoneUnlink(ptmr);                          /* ... from the list of pending callbacks        */
+    ptmr->OSHTmrType        = OS_EVENT_TYPE_UNUSED;
+    ptmr->OSHTmrState       = OS_TMR_STATE_UNUSED;
+    ptmr->OSHTmrCallback    = (OS_HTMR_CALLBACK)0;
+    ptmr->OSHTmrCallbackArg = (void *)0;
+    ptmr->OSHTmrNext        = OSHTmrFreeList;         /* Return timer to free list                     */
+    OSHTmrFreeList          = ptmr;
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (OS_TRUE);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 GET THE TIME LEFT BEFORE A TIMER EXPIRES
+*
+* Description: This function returns the number of counts of the hardware timer left before a running
+*              timer expires.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The call was successful
+*                            OS_ERR_TMR_INVALID          If 'ptmr' is a NULL pointer
+*                            OS_ERR_TMR_INVALID_TYPE     If 'ptmr' is not pointing to a timer
+*                            OS_ERR_TMR_INACTIVE         If the timer was deleted
+*
+* Returns    : The time left, 0 if the timer is stopped, completed or due
+*********************************************************************************************************
+*/
+
+INT32U  OSHTmrRemainGet (OS_HTMR  *ptmr,
+                         INT8U    *perr)
+{
+    INT32U     remain;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (ptmr == (OS_HTMR *)0) {
+        *perr = OS_ERR_TMR_INVALID;
+        return (0u);
+    }
+#endif
+    if (ptmr->OSHTmrType != OS_HTMR_TYPE) {           /* Validate timer structure                      */
+        *perr = OS_ERR_TMR_INVALID_TYPE;
+        return (0u);
+    }
+    OS_ENTER_CRITICAL();
+    switch (ptmr->OSHTmrState) {
+        case OS_TMR_STATE_RUNNING:
+             remain = ptmr->OSHTmrExpire - OS_CPU_HTmrGet();
+             if ((INT32S)remain < 0) {                /* Due, the timer ISR has not run yet            */
+                 remain = 0u;
+             }
+             *perr  = OS_ERR_NONE;
+             break;
+
+        case OS_TMR_STATE_STOPPED:
+        case OS_TMR_STATE_COMPLETED:
+             remain = 0u;
+             *perr  = OS_ERR_NONE;
+             break;
+
+        default:
+             remain = 0u;
+             *perr  = OS_ERR_TMR_INACTIVE;
+             break;
+    }
+    OS_EXIT_CRITICAL();
+    return (remain);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    FIND OUT WHAT STATE A TIMER IS IN
+*
+* Description: This function returns the state of a timer.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The call was successful
+*                            OS_ERR_TMR_INVALID          If 'ptmr' is a NULL pointer
+*                            OS_ERR_TMR_INVALID_TYPE     If 'ptmr' is not pointing to a timer
+*                            OS_ERR_TMR_INACTIVE         If the timer was deleted
+*
+* Returns    : OS_TMR_STATE_UNUSED, OS_TMR_STATE_STOPPED, OS_TMR_STATE_COMPLETED or OS_TMR_STATE_RUNNING
+*********************************************************************************************************
+*/
+
+INT8U  OSHTmrStateGet (OS_HTMR  *ptmr,
+                       INT8U    *perr)
+{
+    INT8U  state;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (ptmr == (OS_HTMR *)0) {
+        *perr = OS_ERR_TMR_INVALID;
+        return (OS_TMR_STATE_UNUSED);
+    }
+#endif
+    if (ptmr->OSHTmrType != OS_HTMR_TYPE) {           /* Validate timer structure                      */
+        *perr = OS_ERR_TMR_INVALID_TYPE;
+        return (OS_TMR_STATE_UNUSED);
+    }
+    state = ptmr->OSHTmrState;
+    if (state == OS_TMR_STATE_UNUSED) {
+        *perr = OS_ERR_TMR_INACTIVE;
+    } else {
+        *perr = OS_ERR_NONE;
+    }
+    return (state);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            START A TIMER
+*
+* Description: This function starts a timer, or restarts it if it is running.  A pending task level
+*              callback is cancelled.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+*              dly           is the time before the timer expires, in counts of the hardware timer
+*                            (1 .. OS_HTMR_DLY_MAX).  It is followed by the period given to OSHTmrCreate().
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The timer was started
+*                            OS_ERR_TMR_INVALID          If 'ptmr' is a NULL pointer
+*                            OS_ERR_TMR_INVALID_DLY      If 'dly' is 0 or above OS_HTMR_DLY_MAX
+*                            OS_ERR_TMR_INVALID_TYPE     If 'ptmr' is not pointing to a timer
+*                            OS_ERR_TMR_INACTIVE         If the timer was deleted
+*
+* Returns    : OS_TRUE       if the timer was started
+*              OS_FALSE      if an error was detected
+*
+* Note(s)    : 1) This function can be called from an ISR, including from a timer callback.
+*********************************************************************************************************
+*/
+
+BOOLEAN  OSHTmrStart (OS_HTMR  *ptmr,
+                      INT32U    dly,
+                      INT8U    *perr)
+{
+    INT32U     now;
+    INT32U     next;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (ptmr == (OS_HTMR *)0) {
+        *perr = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+    if ((dly == 0u) || (dly > OS_HTMR_DLY_MAX)) {
+        *perr = OS_ERR_TMR_INVALID_DLY;
+        return (OS_FALSE);
+    }
+#endif
+    if (ptmr->OSHTmrType != OS_HTMR_TYPE) {           /* Validate timer structure                      */
+        *perr = OS_ERR_TMR_INVALID_TYPE;
+        return (OS_FALSE);
+    }
+    OS_ENTER_CRITICAL();
+    if (ptmr->OSHTmrState == OS_TMR_STATE_UNUSED) {
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_TMR_INACTIVE;
+        return (OS_FALSE);
+    }
+    OS_HTmrUnlink(ptmr);
+    OS_HTmrDoneUnlink(ptmr);
+    now = OS_CPU_HTmrGet();
+    if (OSHTmrBusy == OS_FALSE) {
+        next = OS_HTmrNextGet();
+        if ((next == 0u) || ((now - OSHTmrTime) < next)) {
+            OSHTmrTime = now;                         /* No slot to process until now, catch up        */
+        }
+    }
+    ptmr->OSHTmrExpire = now + dly;
+    ptmr->OSHTmrState  = OS_TMR_STATE_RUNNING;
+    OS_HTmrLink(ptmr);
+    if (OSHTmrBusy == OS_FALSE) {                     /* OSHTmrSignal() re-arms when it is done        */
+        OS_HTmrArm();
+    }
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (OS_TRUE);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                             STOP A TIMER
+*
+* Description: This function stops a timer.  A pending task level callback is cancelled.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The timer was stopped
+*                            OS_ERR_TMR_INVALID          If 'ptmr' is a NULL pointer
+*                            OS_ERR_TMR_INVALID_TYPE     If 'ptmr' is not pointing to a timer
+*                            OS_ERR_TMR_STOPPED          If the timer was already stopped or completed
+*                            OS_ERR_TMR_INACTIVE         If the timer was deleted
+*
+* Returns    : OS_TRUE       if the timer is stopped
+*              OS_FALSE      if an error was detected
+*
+* Note(s)    : 1) This function can be called from an ISR, including from a timer callback.
+*              2) The hardware timer is not re-armed: an interrupt may still occur when the timer would
+*                 have expired, it finds nothing to do.
+*********************************************************************************************************
+*/
+
+BOOLEAN  OSHTmrStop (OS_HTMR  *ptmr,
+                     INT8U    *perr)
+{
+    BOOLEAN    stopped;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (ptmr == (OS_HTMR *)0) {
+        *perr = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+#endif
+    if (ptmr->OSHTmrType != OS_HTMR_TYPE) {           /* Validate timer structure                      */
+        *perr = OS_ERR_TMR_INVALID_TYPE;
+        return (OS_FALSE);
+    }
+    OS_ENTER_CRITICAL();
+    switch (ptmr->OSHTmrState) {
+        case OS_TMR_STATE_RUNNING:
+             OS_HTmrUnlink(ptmr);
+             OS_HTmrDoneUnlink(ptmr);
+             ptmr->OSHTmrState = OS_TMR_STATE_STOPPED;
+             *perr             = OS_ERR_NONE;
+             stopped           = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_COMPLETED:                  /* One-shot expired, its callback may be pending */
+             if (ptmr->OSHTmrDonePend == OS_TRUE) {
+                 OS_HTmrDoneUnlink(ptmr);
+                 ptmr->OSHTmrState = OS_TMR_STATE_STOPPED;
+                 *perr             = OS_ERR_NONE;
+             } else {
+                 *perr             = OS_ERR_TMR_STOPPED;
+             }
+             stopped = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_STOPPED:
+             *perr   = OS_ERR_TMR_STOPPED;
+             stopped = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:
+             *perr   = OS_ERR_TMR_INACTIVE;
+             stopped = OS_FALSE;
+             break;
+
+        default:
+             *perr   = OS_ERR_TMR_INVALID_STATE;
+             stopped = OS_FALSE;
+             break;
+    }
+    OS_EXIT_CRITICAL();
+    return (stopped);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    READ THE TIME OF THE TIMERS
+*
+* Description: This function returns the free-running counter of the hardware timer, e.g. to time stamp
+*              events with the resolution of the timers.
+*
+* Arguments  : none
+*
+* Returns    : The counter, in counts of OS_HTMR_CFG_CLK_HZ.  It wraps around every 2^32 counts.
+*********************************************************************************************************
+*/
+
+INT32U  OSHTmrTimeGet (void)
+{
+    return (OS_CPU_HTmrGet());
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      PROCESS THE EXPIRED TIMERS
+*
+* Description: This function is called by the ISR of the hardware timer (compare match, or software
+*              trigger from OS_CPU_HTmrPend()).  It advances the wheel up to the current time, calls the
+*              ISR level callbacks, hands the task level ones to the timer task and re-arms the hardware
+*              timer.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function MUST be called between OSIntEnter() and OSIntExit().
+*              2) ISR level callbacks are called with interrupts enabled.
+*********************************************************************************************************
+*/
+
+void  OSHTmrSignal (void)
+{
+    OS_HTMR           *ptmr;
+    OS_HTMR_CALLBACK   pfnct;
+    void              *parg;
+    INT32U             next;
+    BOOLEAN            post;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR          cpu_sr = 0u;
+#endif
+
+
+
+    post = OS_FALSE;
+    OS_ENTER_CRITICAL();
+    OSHTmrBusy = OS_TRUE;
+    next       = OS_HTmrNextGet();
+    while ((next != 0u) && ((OS_CPU_HTmrGet() - OSHTmrTime) >= next)) {
+        OSHTmrTime += next;                           /* Jump to the next slot to process              */
+        OS_HTmrCascade();                             /* Timers expiring now go to 'OSHTmrExpList'     */
+        while (OSHTmrExpList != (OS_HTMR *)0) {
+            ptmr = OSHTmrExpList;
+            OS_HTmrUnlink(ptmr);
+            if (ptmr->OSHTmrPeriod > 0u) {            /* Restart periodic timer, without drift         */
+                ptmr->OSHTmrExpire += ptmr->OSHTmrPeriod;
+                OS_HTmrLink(ptmr);
+            } else {
+                ptmr->OSHTmrState   = OS_TMR_STATE_COMPLETED;
+            }
+            if (ptmr->OSHTmrOpt == OS_HTMR_OPT_ISR) {
+                pfnct = ptmr->OSHTmrCallback;
+                parg  = ptmr->OSHTmrCallbackArg;
+                if (pfnct != (OS_HTMR_CALLBACK)0) {
+                    OS_EXIT_CRITICAL();
+                    (*pfnct)((void *)ptmr, parg);
+                    OS_ENTER_CRITICAL();
+                }
+            } else if (ptmr->OSHTmrDonePend == OS_FALSE) {
+                ptmr->OSHTmrDonePend = OS_TRUE;       /* Queue the callback for the timer task         */
+                ptmr->OSHTmrDoneNext = (OS_HTMR *)0;
+                if (OSHTmrDoneTail == (OS_HTMR *)0) {
+                    OSHTmrDoneList = ptmr;
+                    post           = OS_TRUE;
+                } else {
+                    OSHTmrDoneTail->OSHTmrDoneNext = ptmr;
+                }
+                OSHTmrDoneTail = ptmr;
+            }
+        }
+        next = OS_HTmrNextGet();
+    }
+    OSHTmrBusy = OS_FALSE;
+    OS_HTmrArm();
+    OS_EXIT_CRITICAL();
+    if (post == OS_TRUE) {
+        (void)OSSemPost(OSHTmrSem);                   /* Wake up the timer task                        */
+    }
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    PROGRAM THE NEXT TIMER INTERRUPT
+*
+* Description: This function programs the compare register of the hardware timer for the next slot of the
+*              wheel to process, or disables the interrupt if no timer is running.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) Interrupts are disabled when this function is called.
+*              2) If the counter reached the compare value while it was being programmed, the interrupt is
+*                 triggered by software.
+*********************************************************************************************************
+*/
+
+static  void  OS_HTmrArm (void)
+{
+    INT32U  next;
+
+
+    next = OS_HTmrNextGet();
+    if (next == 0u) {
+        OS_CPU_HTmrDis();
+        return;
+    }
+    OS_CPU_HTmrSet(OSHTmrTime + next);
+    if ((OS_CPU_HTmrGet() - OSHTmrTime) >= next) {
+        OS_CPU_HTmrPend();
+    }
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   CASCADE THE SLOTS STARTING NOW
+*
+* Description: This function moves the timers of every slot starting at 'OSHTmrTime' to the level below,
+*              or to the expiry list when they expire now.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) Interrupts are disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static  void  OS_HTmrCascade (void)
+{
+    OS_HTMR  *ptmr;
+    OS_HTMR  *pnext;
+    INT32U    time;
+    INT8U     level;
+    INT8U     slot;
+
+
+    time  = OSHTmrTime;
+    level = OS_HTMR_LEVELS;
+    while (level > 0u) {
+        level--;
+        if ((level > 0u) &&                           /* A slot of a level > 0 starts when the ...     */
+            ((time & ((1uL << (level * OS_HTMR_SLOT_BITS)) - 1uL)) != 0uL)) {
+            continue;                                 /* ... lower digits of the time are all zero     */
+        }
+        slot = (INT8U)((time >> (level * OS_HTMR_SLOT_BITS)) & (OS_HTMR_SLOTS - 1u));
+        ptmr = OSHTmrWheelTbl[level][slot];
+        if (ptmr != (OS_HTMR *)0) {
+            OSHTmrWheelTbl[level][slot] = (OS_HTMR *)0;
+            OSHTmrMapTbl[level]        &= (INT16U)~(1u << slot);
+            while (ptmr != (OS_HTMR *)0) {
+                pnext = ptmr->OSHTmrNext;
+                OS_HTmrLink(ptmr);                    /* Lower level, or 'OSHTmrExpList'               */
+                ptmr  = pnext;
+            }
+        }
+    }
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  CANCEL A PENDING TASK LEVEL CALLBACK
+*
+* Description: This function removes a timer from the list of callbacks to be called by the timer task.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+* Returns    : none
+*
+* Note(s)    : 1) Interrupts are disabled when this function is called.
+*              2) The list is searched, it only holds the callbacks not run yet by the timer task.
+*********************************************************************************************************
+*/
+
+static  void  OS_HTmrDoneUnlink (OS_HTMR *ptmr)
+{
+    OS_HTMR  *pprev;
+    OS_HTMR  *pcur;
+
+
+    if (ptmr->OSHTmrDonePend == OS_FALSE) {
+        return;
+    }
+    pprev = (OS_HTMR *)0;
+    pcur  = OSHTmrDoneList;
+    while (pcur != ptmr) {
+        pprev = pcur;
+        pcur  = pcur->OSHTmrDoneNext;
+    }
+    if (pprev == (OS_HTMR *)0) {
+        OSHTmrDoneList        = ptmr->OSHTmrDoneNext;
+    } else {
+        pprev->OSHTmrDoneNext = ptmr->OSHTmrDoneNext;
+    }
+    if (OSHTmrDoneTail == ptmr) {
+        OSHTmrDoneTail        = pprev;
+    }
+    ptmr->OSHTmrDoneNext = (OS_HTMR *)0;
+    ptmr->OSHTmrDonePend = OS_FALSE;
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    INSERT A TIMER IN THE WHEEL
+*
+* Description: This function links a timer in the slot matching its expiry time, or in the expiry list if
+*              it expires at 'OSHTmrTime'.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+* Returns    : none
+*
+* Note(s)    : 1) Interrupts are disabled when this function is called.
+*              2) The expiry time of the timer MUST NOT be before 'OSHTmrTime'.
+*********************************************************************************************************
+*/
+
+static  void  OS_HTmrLink (OS_HTMR *ptmr)
+{
+    OS_HTMR  **plist;
+    INT32U     diff;
+    INT8U      level;
+    INT8U      slot;
+
+
+    diff = ptmr->OSHTmrExpire ^ OSHTmrTime;
+    if (diff == 0u) {
+        level = OS_HTMR_LIST_EXP;
+        slot  = 0u;
+        plist = &OSHTmrExpList;
+    } else {
+        level = 0u;                                   /* Find the highest digit that differs           */
+        while (diff >= OS_HTMR_SLOTS) {
+            diff >>= OS_HTMR_SLOT_BITS;
+            level++;
+        }
+        slot                 = (INT8U)((ptmr->OSHTmrExpire >> (level * OS_HTMR_SLOT_BITS)) & (OS_HTMR_SLOTS - 1u));
+        plist                = &OSHTmrWheelTbl[level][slot];
+        OSHTmrMapTbl[level] |= (INT16U)(1u << slot);
+    }
+    ptmr->OSHTmrLevel = level;
+    ptmr->OSHTmrSlot  = slot;
+    ptmr->OSHTmrPrev  = (OS_HTMR *)0;
+    ptmr->OSHTmrNext  = *plist;
+    if (*plist != (OS_HTMR *)0) {
+        (*plist)->OSHTmrPrev = ptmr;
+    }
+    *plist            = ptmr;
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  TIME UNTIL THE NEXT SLOT TO PROCESS
+*
+* Description: This function returns the number of counts from 'OSHTmrTime' to the start of the next
+*              non-empty slot of the wheel, at any level.
+*
+* Arguments  : none
+*
+* Returns    : The number of counts (>= 1), or 0 if no timer is running.
+*
+* Note(s)    : 1) Interrupts are disabled when this function is called.
+*              2) The current slot of a level is never used: its timers were cascaded when it started.
+*********************************************************************************************************
+*/
+
+static  INT32U  OS_HTmrNextGet (void)
+{
+    INT32U  next;
+    INT32U  dly;
+    INT32U  time;
+    INT16U  map;
+    INT8U   level;
+    INT8U   shift;
+    INT8U   ix;
+
+
+    next = 0u;
+    for (level = 0u; level < OS_HTMR_LEVELS; level++) {
+        map = OSHTmrMapTbl[level];
+        if (map != 0u) {
+            shift = (INT8U)(level * OS_HTMR_SLOT_BITS);
+            time  = OSHTmrTime >> shift;
+            ix    = (INT8U)((time & (OS_HTMR_SLOTS - 1u)) + 1u);  /* Rotate: bit 0 is the slot after  */
+            map   = (INT16U)((map >> ix) | (map << (OS_HTMR_SLOTS - ix)));  /* ... the current one   */
+            if ((map & 0xFFu) != 0u) {
+                ix = OSUnMapTbl[map & 0xFFu];
+            } else {
+                ix = (INT8U)(OSUnMapTbl[map >> 8u] + 8u);
+            }
+            dly = ((time + ix + 1u) << shift) - OSHTmrTime;
+            if ((next == 0u) || (dly < next)) {
+                next = dly;
+            }
+        }
+    }
+    return (next);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                REMOVE A TIMER FROM THE WHEEL
+*
+* Description: This function unlinks a timer from its slot or from the expiry list.
+*
+* Arguments  : ptmr          is a pointer to the timer
+*
+* Returns    : none
+*
+* Note(s)    : 1) Interrupts are disabled when this function is called.
+*********************************************************************************************************
+*/
+
+static  void  OS_HTmrUnlink (OS_HTMR *ptmr)
+{
+    OS_HTMR  **plist;
+
+
+    if (ptmr->OSHTmrLevel == OS_HTMR_LIST_NONE) {
+        return;
+    }
+    if (ptmr->OSHTmrLevel == OS_HTMR_LIST_EXP) {
+        plist = &OSHTmrExpList;
+    } else {
+        plist = &OSHTmrWheelTbl[ptmr->OSHTmrLevel][ptmr->OSHTmrSlot];
+    }
+    if (ptmr->OSHTmrPrev == (OS_HTMR *)0) {
+        *plist                           = ptmr->OSHTmrNext;
+    } else {
+        ptmr->OSHTmrPrev->OSHTmrNext     = ptmr->OSHTmrNext;
+    }
+    if (ptmr->OSHTmrNext != (OS_HTMR *)0) {
+        ptmr->OSHTmrNext->OSHTmrPrev     = ptmr->OSHTmrPrev;
+    }
+    if ((*plist == (OS_HTMR *)0) && (ptmr->OSHTmrLevel != OS_HTMR_LIST_EXP)) {
+        OSHTmrMapTbl[ptmr->OSHTmrLevel] &= (INT16U)~(1u << ptmr->OSHTmrSlot);
+    }
+    ptmr->OSHTmrLevel = OS_HTMR_LIST_NONE;
+    ptmr->OSHTmrNext  = (OS_HTMR *)0;
+    ptmr->OSHTmrPrev  = (OS_HTMR *)0;
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           TIMER TASK
+*
+* Description: This task calls the task level callbacks of the expired timers, in expiry order.
+*
+* Arguments  : p_arg         is not used
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+static  void  OS_HTmrTask (void *p_arg)
+{
+    OS_HTMR           *ptmr;
+    OS_HTMR_CALLBACK   pfnct;
+    void              *parg;
+    INT8U              err;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR          cpu_sr = 0u;
+#endif
+
+
+
+    p_arg = p_arg;                                    /* Prevent compiler warning for not using 'p_arg'*/
+    for (;;) {
+        OSSemPend(OSHTmrSem, 0u, &err);               /* Wait for OSHTmrSignal()                       */
+        for (;;) {
+            OS_ENTER_CRITICAL();
+            ptmr = OSHTmrDoneList;
+            if (ptmr == (OS_HTMR *)0) {
+                OS_EXIT_CRITICAL();
+                break;
+            }
+            OSHTmrDoneList = ptmr->OSHTmrDoneNext;
+            if (OSHTmrDoneList == (OS_HTMR *)0) {
+                OSHTmrDoneTail = (OS_HTMR *)0;
+            }
+            ptmr->OSHTmrDoneNext = (OS_HTMR *)0;
+            ptmr->OSHTmrDonePend = OS_FALSE;
+            pfnct                = ptmr->OSHTmrCallback;
+            parg                 = ptmr->OSHTmrCallbackArg;
+            OS_EXIT_CRITICAL();
+            if (pfnct != (OS_HTMR_CALLBACK)0) {
+                (*pfnct)((void *)ptmr, parg);
+            }
+        }
+    }
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         INITIALIZATION
+*
+* Description: This function is called by OSInit() to initialize the free list of timers, the wheel, the
+*              hardware timer and to create the timer task.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+void  OS_HTmrInit (void)
+{
+#if OS_EVENT_NAME_EN > 0u
+    INT8U     err;
+#endif
+    INT16U    ix;
+    OS_HTMR  *ptmr;
+
+
+
+    OS_MemClr((INT8U *)&OSHTmrTbl[0],      sizeof(OSHTmrTbl));      /* Clear the timer table           */
+    OS_MemClr((INT8U *)&OSHTmrWheelTbl[0], sizeof(OSHTmrWheelTbl)); /* Clear the wheel                 */
+    OS_MemClr((INT8U *)&OSHTmrMapTbl[0],   sizeof(OSHTmrMapTbl));
+    for (ix = 0u; ix < OS_HTMR_CFG_MAX; ix++) {                     /* Init. list of free timers       */
+        ptmr              = &OSHTmrTbl[ix];
+        ptmr->OSHTmrState = OS_TMR_STATE_UNUSED;
+        ptmr->OSHTmrLevel = OS_HTMR_LIST_NONE;
+        if (ix < (OS_HTMR_CFG_MAX - 1u)) {
+            ptmr->OSHTmrNext = &OSHTmrTbl[ix + 1u];
+        } else {
+            ptmr->OSHTmrNext = (OS_HTMR *)0;
+        }
+    }
+    OSHTmrFreeList = &OSHTmrTbl[0];
+    OSHTmrExpList  = (OS_HTMR *)0;
+    OSHTmrDoneList = (OS_HTMR *)0;
+    OSHTmrDoneTail = (OS_HTMR *)0;
+    OSHTmrBusy     = OS_FALSE;
+    OSHTmrSem      = OSSemCreate(0u);
+#if OS_EVENT_NAME_EN > 0u
+    OSEventNameSet(OSHTmrSem, (INT8U *)(void *)"uC/OS-II HTmrSignal", &err);
+#endif
+
+    OS_CPU_HTmrInit();                                              /* Start the free-running counter  */
+    OSHTmrTime     = OS_CPU_HTmrGet();
+
+    OS_HTmrInitTask();
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                     CREATE THE TIMER TASK
+*
+* Description: This function is called by OS_HTmrInit() to create the timer task.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+static  void  OS_HTmrInitTask (void)
+{
+#if OS_TASK_NAME_EN > 0u
+    INT8U  err;
+#endif
+
+
+#if OS_TASK_CREATE_EXT_EN > 0u
+    #if OS_STK_GROWTH == 1u
+    (void)OSTaskCreateExt(OS_HTmrTask,
+                          (void *)0,                                /* No arguments passed to the task */
+                          &OSHTmrTaskStk[OS_TASK_HTMR_STK_SIZE - 1u], /* Set Top-Of-Stack              */
+                          OS_TASK_HTMR_PRIO,
+                          OS_TASK_HTMR_ID,
+                          &OSHTmrTaskStk[0],                        /* Set Bottom-Of-Stack             */
+                          OS_TASK_HTMR_STK_SIZE,
+                          (void *)0,                                /* No TCB extension                */
+                          OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR); /* Enable stack checking + clear */
+    #else
+    (void)OSTaskCreateExt(OS_HTmrTask,
+                          (void *)0,                                /* No arguments passed to the task */
+                          &OSHTmrTaskStk[0],                        /* Set Top-Of-Stack                */
+                          OS_TASK_HTMR_PRIO,
+                          OS_TASK_HTMR_ID,
+                          &OSHTmrTaskStk[OS_TASK_HTMR_STK_SIZE - 1u], /* Set Bottom-Of-Stack           */
+                          OS_TASK_HTMR_STK_SIZE,
+                          (void *)0,                                /* No TCB extension                */
+                          OS_TASK_OPT_STK_CHK | OS_TASK_OPT_STK_CLR); /* Enable stack checking + clear */
+    #endif
+#else
+    #if OS_STK_GROWTH == 1u
+    (void)OSTaskCreate(OS_HTmrTask,
+                       (void *)0,
+                       &OSHTmrTaskStk[OS_TASK_HTMR_STK_SIZE - 1u],
+                       OS_TASK_HTMR_PRIO);
+    #else
+    (void)OSTaskCreate(OS_HTmrTask,
+                       (void *)0,
+                       &OSHTmrTaskStk[0],
+                       OS_TASK_HTMR_PRIO);
+    #endif
+#endif
+
+#if OS_TASK_NAME_EN > 0u
+    OSTaskNameSet(OS_TASK_HTMR_PRIO, (INT8U *)(void *)"uC/OS-II HTmr", &err);
+#endif
+}
+#endif                                                /* OS_HTMR_EN                                    */
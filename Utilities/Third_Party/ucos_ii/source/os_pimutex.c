@@ -0,0 +1,1055 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                             PRIORITY INHERITANCE MUTUAL EXCLUSION MANAGEMENT
+*
+*                              (c) Copyright 1992-2009, Micrium, Weston, FL
+*                                           All Rights Reserved
+*
+* File    : OS_PIMUTEX.C
+* By      : Jean J. Labrosse
+* Version : V2.91
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrim to properly license
+* its use in your product. We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*
+* Note(s) : 1) Unlike the mutexes of OS_MUTEX.C, a PI mutex does NOT reserve a priority level.  The owner
+*              of a PI mutex inherits the priority of the highest priority task waiting for it, directly or
+*              through a chain of PI mutexes (A waits for a mutex owned by B, which waits for a mutex owned
+*              by C: C runs at the priority of A).  The 'effective' priority of each task is kept in
+*              'OSTCBPIPrio' while 'OSTCBBasePrio' holds the priority the task was created with.
+*
+*           2) uC/OS-II only allows one task per priority.  The task at the top of a chain (the 'root',
+*              which is not waiting for a PI mutex) is therefore boosted by SWAPPING its priority with the
+*              task whose base priority it inherits.  That task is waiting for a PI mutex and is not ready,
+*              so it can run at any priority until it stops waiting.  All the other tasks of the chain stay
+*              at their base priority.  Boosting the owner of a mutex is a single swap.
+*
+*           3) The waiters of a PI mutex are kept in a list of their own, ordered by effective priority
+*              when the mutex is released (FIFO for equal priorities), rather than in an event wait list.
+*
+*           4) A PI mutex may be acquired several times by its owner; it is released when OSPIMutexPost()
+*              has been called as many times as OSPIMutexPend()/OSPIMutexAccept() succeeded.
+*
+*           5) The priority of a task that owns or waits for a PI mutex cannot be changed and a task that
+*              owns a PI mutex cannot be deleted.  A task MUST NOT own a PI mutex and a mutex of OS_MUTEX.C
+*              at the same time.
+*
+*           6) Because of the swap of Note 2, 'OSTCBPrioTbl[prio]' may hold another task than the one created
+*              at 'prio'.  The services naming a task by its priority (OSTaskQuery(), OSTaskSuspend(),
+*              OSTaskStkChk(), OSTimeDlyResume(), ...) look it up with OS_PIMutexTCBGet(), so 'prio' always
+*              names the task created at (or moved to by OSTaskChangePrio()) that priority, and OS_PRIO_SELF
+*              stands for the base priority of the calling task.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+/*
+*********************************************************************************************************
+*                                          LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void     OS_PIMutexHeldRemove  (OS_TCB      *ptcb,
+                                        OS_PIMUTEX  *pmutex);
+
+static  INT8U    OS_PIMutexPrioCalc    (OS_TCB      *ptcb);
+
+static  void     OS_PIMutexPrioUpdate  (OS_TCB      *ptcb);
+
+static  void     OS_PIMutexSlotBoost   (OS_TCB      *ptcb);
+
+static  void     OS_PIMutexSlotRestore (OS_TCB      *ptcb);
+
+static  void     OS_PIMutexSlotSwap    (OS_TCB      *pa,
+                                        OS_TCB      *pb);
+
+static  BOOLEAN  OS_PIMutexSlotUnlink  (OS_TCB      *ptcb);
+
+static  void     OS_PIMutexSlotLink    (OS_TCB      *ptcb,
+                                        INT8U        prio,
+                                        BOOLEAN      rdy);
+
+static  void     OS_PIMutexTaskRdy     (OS_TCB      *ptcb,
+                                        INT8U        pend_stat);
+
+static  void     OS_PIMutexWaitUnlink  (OS_PIMUTEX  *pmutex,
+                                        OS_TCB      *ptcb);
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  ACCEPT A PRIORITY INHERITANCE MUTEX
+*
+* Description: This function checks the PI mutex to see if it is available or already owned by the calling
+*              task.  Unlike OSPIMutexPend(), OSPIMutexAccept() does not suspend the calling task.
+*
+* Arguments  : pmutex        is a pointer to the PI mutex
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The call was successful.
+*                            OS_ERR_PIMUTEX_INVALID_P    If 'pmutex' is a NULL pointer
+*                            OS_ERR_PIMUTEX_OVF          If the nesting counter of the mutex would overflow
+*                            OS_ERR_PEND_ISR             If you called this function from an ISR
+*
+* Returns    : == OS_TRUE    if the mutex was available (or already owned by the calling task) and it now
+*                            belongs to the calling task.
+*              == OS_FALSE   a) if the mutex is owned by another task.
+*                            b) if you called this function from an ISR.
+*********************************************************************************************************
+*/
+
+BOOLEAN  OSPIMutexAccept (OS_PIMUTEX  *pmutex,
+                          INT8U       *perr)
+{
+    BOOLEAN    avail;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pmutex == (OS_PIMUTEX *)0) {                  /* Validate 'pmutex'                             */
+        *perr = OS_ERR_PIMUTEX_INVALID_P;
+        return (OS_FALSE);
+    }
+#endif
+    if (OSIntNesting > 0u) {                          /* Make sure it's not called from an ISR         */
+        *perr = OS_ERR_PEND_ISR;
+        return (OS_FALSE);
+    }
+    avail = OS_TRUE;
+    *perr = OS_ERR_NONE;
+    OS_ENTER_CRITICAL();
+    if (pmutex->OSPIMutexOwner == (OS_TCB *)0) {      /* Is the mutex available?                       */
+        pmutex->OSPIMutexOwner   = OSTCBCur;          /* Yes, acquire it                               */
+        pmutex->OSPIMutexNesting = 1u;
+        pmutex->OSPIMutexPtr     = OSTCBCur->OSTCBPIMutexHeld;
+        OSTCBCur->OSTCBPIMutexHeld = pmutex;
+    } else if (pmutex->OSPIMutexOwner == OSTCBCur) {  /* Do we already own it?                         */
+        if (pmutex->OSPIMutexNesting < 65535u) {
+            pmutex->OSPIMutexNesting++;
+        } else {
+            avail = OS_FALSE;
+            *perr = OS_ERR_PIMUTEX_OVF;
+        }
+    } else {
+        avail = OS_FALSE;                             /* No, it belongs to another task                */
+    }
+    OS_EXIT_CRITICAL();
+    return (avail);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  CREATE A PRIORITY INHERITANCE MUTEX
+*
+* Description: This function creates a PI mutex.
+*
+* Arguments  : perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The call was successful.
+*                            OS_ERR_CREATE_ISR           If you attempted to create a mutex from an ISR
+*                            OS_ERR_PIMUTEX_DEPLETED     No more PI mutex control blocks available
+*
+* Returns    : != (OS_PIMUTEX *)0  is a pointer to the PI mutex created
+*              == (OS_PIMUTEX *)0  if an error was detected
+*********************************************************************************************************
+*/
+
+OS_PIMUTEX  *OSPIMutexCreate (INT8U  *perr)
+{
+    OS_PIMUTEX  *pmutex;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR    cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_CREATE_ISR;                    /* ... can't CREATE from an ISR                  */
+        return ((OS_PIMUTEX *)0);
+    }
+    OS_ENTER_CRITICAL();
+    pmutex = OSPIMutexFreeList;                       /* Get a free PI mutex control block             */
+    if (pmutex == (OS_PIMUTEX *)0) {
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_PIMUTEX_DEPLETED;
+        return ((OS_PIMUTEX *)0);
+    }
+    OSPIMutexFreeList          = pmutex->OSPIMutexPtr;
+    pmutex->OSPIMutexPtr       = (OS_PIMUTEX *)0;
+    pmutex->OSPIMutexOwner     = (OS_TCB *)0;
+    pmutex->OSPIMutexWaitList  = (OS_TCB *)0;
+    pmutex->OSPIMutexNesting   = 0u;
+    OS_EXIT_CRITICAL();
+    *perr                      = OS_ERR_NONE;
+    return (pmutex);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  DELETE A PRIORITY INHERITANCE MUTEX
+*
+* Description: This function deletes a PI mutex and readies all tasks pending on it.
+*
+* Arguments  : pmutex        is a pointer to the PI mutex
+*
+*              opt           determines delete options as follows:
+*                            opt == OS_DEL_NO_PEND   Delete the mutex ONLY if no task pending
+*                            opt == OS_DEL_ALWAYS    Deletes the mutex even if tasks are waiting.
+*                                                    In this case, all the tasks pending will be readied.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The call was successful and the mutex was deleted
+*                            OS_ERR_DEL_ISR              If you attempted to delete the mutex from an ISR
+*                            OS_ERR_INVALID_OPT          An invalid option was specified
+*                            OS_ERR_TASK_WAITING         One or more tasks were waiting on the mutex
+*                            OS_ERR_PIMUTEX_INVALID_P    If 'pmutex' is a NULL pointer
+*
+* Returns    : (OS_PIMUTEX *)0  if the mutex was successfully deleted.
+*              pmutex           if the mutex was not deleted.
+*
+* Note(s)    : 1) The tasks that were waiting for the mutex return from OSPIMutexPend() with
+*                 OS_ERR_PEND_ABORT.  The owner loses the priority it inherited through the mutex.
+*********************************************************************************************************
+*/
+
+#if OS_PIMUTEX_DEL_EN > 0u
+OS_PIMUTEX  *OSPIMutexDel (OS_PIMUTEX  *pmutex,
+                           INT8U        opt,
+                           INT8U       *perr)
+{
+    OS_TCB     *powner;
+    OS_TCB     *proot;
+    OS_TCB     *ptcb;
+    BOOLEAN     tasks_waiting;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pmutex == (OS_PIMUTEX *)0) {                  /* Validate 'pmutex'                             */
+        *perr = OS_ERR_PIMUTEX_INVALID_P;
+        return (pmutex);
+    }
+#endif
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_DEL_ISR;                       /* ... can't DELETE from an ISR                  */
+        return (pmutex);
+    }
+    if ((opt != OS_DEL_NO_PEND) && (opt != OS_DEL_ALWAYS)) {
+        *perr = OS_ERR_INVALID_OPT;
+        return (pmutex);
+    }
+    OS_ENTER_CRITICAL();
+    if (pmutex->OSPIMutexWaitList != (OS_TCB *)0) {   /* See if any tasks waiting on mutex             */
+        tasks_waiting = OS_TRUE;
+    } else {
+        tasks_waiting = OS_FALSE;
+    }
+    if ((tasks_waiting == OS_TRUE) && (opt == OS_DEL_NO_PEND)) {
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_TASK_WAITING;
+        return (pmutex);
+    }
+    powner = pmutex->OSPIMutexOwner;
+    if (powner != (OS_TCB *)0) {
+        proot = powner;                               /* Find the top of the owner's chain             */
+        while (proot->OSTCBPIMutexPend != (OS_PIMUTEX *)0) {
+            proot = proot->OSTCBPIMutexPend->OSPIMutexOwner;
+        }
+        OS_PIMutexSlotRestore(proot);
+        OS_PIMutexHeldRemove(powner, pmutex);
+        while (pmutex->OSPIMutexWaitList != (OS_TCB *)0) {    /* Ready ALL tasks waiting for mutex     */
+            ptcb = pmutex->OSPIMutexWaitList;
+            OS_PIMutexWaitUnlink(pmutex, ptcb);
+            OS_PIMutexSlotBoost(ptcb);                /* Waiter is now at the top of its own chain     */
+            OS_PIMutexTaskRdy(ptcb, OS_STAT_PEND_ABORT);
+        }
+        OS_PIMutexPrioUpdate(powner);                 /* Owner no longer inherits through this mutex   */
+        OS_PIMutexSlotBoost(proot);
+    }
+    pmutex->OSPIMutexOwner   = (OS_TCB *)0;
+    pmutex->OSPIMutexNesting = 0u;
+    pmutex->OSPIMutexPtr     = OSPIMutexFreeList;     /* Return control block to free list             */
+    OSPIMutexFreeList        = pmutex;
+    OS_EXIT_CRITICAL();
+    if (tasks_waiting == OS_TRUE) {                   /* Reschedule only if task(s) were waiting       */
+        OS_Sched();
+    }
+    *perr = OS_ERR_NONE;
+    return ((OS_PIMUTEX *)0);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  PEND ON A PRIORITY INHERITANCE MUTEX
+*
+* Description: This function waits for a PI mutex.  If the mutex is owned by another task, the owner (and
+*              the owner of any PI mutex it is itself waiting for) inherits the priority of the calling
+*              task until it releases the mutex.
+*
+* Arguments  : pmutex        is a pointer to the PI mutex
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for the mutex up to the amount of time specified by this argument.  If
+*                            you specify 0, however, your task will wait forever for the mutex.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The call was successful and your task owns the mutex
+*                            OS_ERR_TIMEOUT              The mutex was not available within 'timeout'
+*                            OS_ERR_PEND_ABORT           The mutex was deleted while the task was waiting
+*                            OS_ERR_PEND_ISR             If you called this function from an ISR
+*                            OS_ERR_PEND_LOCKED          If the mutex is owned by another task and the
+*                                                        scheduler is locked
+*                            OS_ERR_PIMUTEX_INVALID_P    If 'pmutex' is a NULL pointer
+*                            OS_ERR_PIMUTEX_DEADLOCK     If waiting would deadlock (the owner is, directly
+*                                                        or through other PI mutexes, waiting for a mutex
+*                                                        owned by the calling task)
+*                            OS_ERR_PIMUTEX_OVF          If the nesting counter of the mutex would overflow
+*
+* Returns    : none
+*
+* Note(s)    : 1) A task that already owns the mutex does not block; the mutex is released when
+*                 OSPIMutexPost() has been called once for every successful OSPIMutexPend().
+*********************************************************************************************************
+*/
+
+void  OSPIMutexPend (OS_PIMUTEX  *pmutex,
+                     INT32U       timeout,
+                     INT8U       *perr)
+{
+    OS_TCB     *powner;
+    OS_TCB     *proot;
+    OS_TCB     *ptcb;
+    OS_TCB    **pwait;
+    INT8U       prio;
+    INT8U       y;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pmutex == (OS_PIMUTEX *)0) {                  /* Validate 'pmutex'                             */
+        *perr = OS_ERR_PIMUTEX_INVALID_P;
+        return;
+    }
+#endif
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_PEND_ISR;                      /* ... can't PEND from an ISR                    */
+        return;
+    }
+    OS_ENTER_CRITICAL();
+    powner = pmutex->OSPIMutexOwner;
+    if (powner == (OS_TCB *)0) {                      /* Is the mutex available?                       */
+        pmutex->OSPIMutexOwner     = OSTCBCur;        /* Yes, acquire it                               */
+        pmutex->OSPIMutexNesting   = 1u;
+        pmutex->OSPIMutexPtr       = OSTCBCur->OSTCBPIMutexHeld;
+        OSTCBCur->OSTCBPIMutexHeld = pmutex;
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_NONE;
+        return;
+    }
+    if (powner == OSTCBCur) {                         /* Do we already own it?                         */
+        if (pmutex->OSPIMutexNesting < 65535u) {
+            pmutex->OSPIMutexNesting++;
+            *perr = OS_ERR_NONE;
+        } else {
+            *perr = OS_ERR_PIMUTEX_OVF;
+        }
+        OS_EXIT_CRITICAL();
+        return;
+    }
+    if (OSLockNesting > 0u) {                         /* See if called with scheduler locked ...       */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_PEND_LOCKED;                   /* ... can't PEND when locked                    */
+        return;
+    }
+    proot = powner;                                   /* Find the top of the owner's chain             */
+    while (proot->OSTCBPIMutexPend != (OS_PIMUTEX *)0) {
+        proot = proot->OSTCBPIMutexPend->OSPIMutexOwner;
+        if (proot == OSTCBCur) {                      /* The chain leads back to us: deadlock          */
+            OS_EXIT_CRITICAL();
+            *perr = OS_ERR_PIMUTEX_DEADLOCK;
+            return;
+        }
+    }
+/*$PAGE*/
+    OS_PIMutexSlotRestore(OSTCBCur);                  /* We are no longer at the top of our own chain  */
+    OS_PIMutexSlotRestore(proot);
+    y            =  OSTCBCur->OSTCBY;                 /* Remove current task from ready list           */
+    OSRdyTbl[y] &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
+    if (OSRdyTbl[y] == 0u) {
+        OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
+    }
+    OSTCBCur->OSTCBStat        |= OS_STAT_MUTEX;      /* Mutex not available, pend current task        */
+    OSTCBCur->OSTCBStatPend     = OS_STAT_PEND_OK;
+    OSTCBCur->OSTCBDly          = timeout;            /* Store timeout in current task's TCB           */
+    OSTCBCur->OSTCBPIMutexPend  = pmutex;
+    OSTCBCur->OSTCBPIWaitNext   = (OS_TCB *)0;
+    pwait = &pmutex->OSPIMutexWaitList;               /* Append to the wait list (FIFO among equals)   */
+    while (*pwait != (OS_TCB *)0) {
+        pwait = &(*pwait)->OSTCBPIWaitNext;
+    }
+    *pwait = OSTCBCur;
+    prio   = OSTCBCur->OSTCBPIPrio;                   /* Propagate our priority up the chain           */
+    ptcb   = powner;
+    while (ptcb->OSTCBPIPrio > prio) {
+        ptcb->OSTCBPIPrio = prio;
+        if (ptcb->OSTCBPIMutexPend == (OS_PIMUTEX *)0) {
+            break;
+        }
+        ptcb = ptcb->OSTCBPIMutexPend->OSPIMutexOwner;
+    }
+    OS_PIMutexSlotBoost(proot);                       /* Top of chain runs at the inherited priority   */
+    OS_EXIT_CRITICAL();
+    OS_Sched();                                       /* Find next highest priority task ready         */
+    OS_ENTER_CRITICAL();
+    switch (OSTCBCur->OSTCBStatPend) {                /* See if we timed-out or aborted                */
+        case OS_STAT_PEND_OK:                         /* Ownership was handed over by OSPIMutexPost()  */
+             *perr = OS_ERR_NONE;
+             break;
+
+        case OS_STAT_PEND_ABORT:
+             *perr = OS_ERR_PEND_ABORT;               /* Indicate that the mutex was deleted           */
+             break;
+
+        case OS_STAT_PEND_TO:                         /* Already removed from the wait list (see       */
+        default:                                      /* ... OS_PIMutexWaitRemove())                   */
+             *perr = OS_ERR_TIMEOUT;
+             break;
+    }
+    OSTCBCur->OSTCBStat     = OS_STAT_RDY;            /* Set   task  status to ready                   */
+    OSTCBCur->OSTCBStatPend = OS_STAT_PEND_OK;        /* Clear pend  status                            */
+    OS_EXIT_CRITICAL();
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  POST TO A PRIORITY INHERITANCE MUTEX
+*
+* Description: This function releases a PI mutex.  When the nesting counter reaches 0 the calling task
+*              gives up the priority it inherited through the mutex and the mutex is handed over to the
+*              highest priority task waiting for it.
+*
+* Arguments  : pmutex        is a pointer to the PI mutex
+*
+* Returns    : OS_ERR_NONE               The call was successful
+*              OS_ERR_POST_ISR           Attempted to post from an ISR (not valid for mutexes)
+*              OS_ERR_NOT_MUTEX_OWNER    The task that did the post is NOT the owner of the mutex
+*              OS_ERR_PIMUTEX_INVALID_P  If 'pmutex' is a NULL pointer
+*********************************************************************************************************
+*/
+
+INT8U  OSPIMutexPost (OS_PIMUTEX  *pmutex)
+{
+    OS_TCB     *ptcb;
+    OS_TCB     *pnext;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        return (OS_ERR_POST_ISR);                     /* ... can't POST mutex from an ISR              */
+    }
+#if OS_ARG_CHK_EN > 0u
+    if (pmutex == (OS_PIMUTEX *)0) {                  /* Validate 'pmutex'                             */
+        return (OS_ERR_PIMUTEX_INVALID_P);
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    if (pmutex->OSPIMutexOwner != OSTCBCur) {         /* See if posting task owns the mutex            */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_NOT_MUTEX_OWNER);
+    }
+    pmutex->OSPIMutexNesting--;
+    if (pmutex->OSPIMutexNesting > 0u) {              /* Still owned by a nested acquisition           */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_NONE);
+    }
+    OS_PIMutexSlotRestore(OSTCBCur);                  /* Back to our own priority ...                  */
+    OS_PIMutexHeldRemove(OSTCBCur, pmutex);
+    pnext = pmutex->OSPIMutexWaitList;
+    if (pnext == (OS_TCB *)0) {                       /* Any task waiting for the mutex?               */
+        pmutex->OSPIMutexOwner = (OS_TCB *)0;         /* No,  mutex is now available                   */
+        OSTCBCur->OSTCBPIPrio  = OS_PIMutexPrioCalc(OSTCBCur);
+        OS_PIMutexSlotBoost(OSTCBCur);                /* ... unless other mutexes keep us boosted      */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_NONE);
+    }
+    ptcb = pnext->OSTCBPIWaitNext;                    /* Yes, find highest priority waiter             */
+    while (ptcb != (OS_TCB *)0) {
+        if (ptcb->OSTCBPIPrio < pnext->OSTCBPIPrio) {
+            pnext = ptcb;
+        }
+        ptcb = ptcb->OSTCBPIWaitNext;
+    }
+    OS_PIMutexWaitUnlink(pmutex, pnext);              /*      ... and hand it the mutex                */
+    pmutex->OSPIMutexOwner   = pnext;
+    pmutex->OSPIMutexNesting = 1u;
+    pmutex->OSPIMutexPtr     = pnext->OSTCBPIMutexHeld;
+    pnext->OSTCBPIMutexHeld  = pmutex;
+    OSTCBCur->OSTCBPIPrio    = OS_PIMutexPrioCalc(OSTCBCur);
+    pnext->OSTCBPIPrio       = OS_PIMutexPrioCalc(pnext);  /* Inherits from the remaining waiters      */
+    OS_PIMutexSlotBoost(OSTCBCur);
+    OS_PIMutexSlotBoost(pnext);
+    OS_PIMutexTaskRdy(pnext, OS_STAT_PEND_OK);
+    OS_EXIT_CRITICAL();
+    OS_Sched();                                       /* Find highest priority task ready to run       */
+    return (OS_ERR_NONE);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  QUERY A PRIORITY INHERITANCE MUTEX
+*
+* Description: This function obtains information about a PI mutex.
+*
+* Arguments  : pmutex          is a pointer to the PI mutex
+*
+*              p_mutex_data    is a pointer to a structure that will contain information about the mutex
+*
+* Returns    : OS_ERR_NONE               The call was successful
+*              OS_ERR_QUERY_ISR          If you called this function from an ISR
+*              OS_ERR_PIMUTEX_INVALID_P  If 'pmutex' is a NULL pointer
+*              OS_ERR_PDATA_NULL         If 'p_mutex_data' is a NULL pointer
+*********************************************************************************************************
+*/
+
+#if OS_PIMUTEX_QUERY_EN > 0u
+INT8U  OSPIMutexQuery (OS_PIMUTEX       *pmutex,
+                       OS_PIMUTEX_DATA  *p_mutex_data)
+{
+    OS_TCB     *ptcb;
+    INT8U       nbr;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        return (OS_ERR_QUERY_ISR);                    /* ... can't QUERY mutex from an ISR             */
+    }
+#if OS_ARG_CHK_EN > 0u
+    if (pmutex == (OS_PIMUTEX *)0) {                  /* Validate 'pmutex'                             */
+        return (OS_ERR_PIMUTEX_INVALID_P);
+    }
+    if (p_mutex_data == (OS_PIMUTEX_DATA *)0) {       /* Validate 'p_mutex_data'                       */
+        return (OS_ERR_PDATA_NULL);
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    ptcb = pmutex->OSPIMutexOwner;
+    if (ptcb == (OS_TCB *)0) {
+        p_mutex_data->OSValue       = OS_TRUE;
+        p_mutex_data->OSOwnerPrio   = 0xFFu;
+        p_mutex_data->OSOwnerPIPrio = 0xFFu;
+    } else {
+        p_mutex_data->OSValue       = OS_FALSE;
+        p_mutex_data->OSOwnerPrio   = ptcb->OSTCBBasePrio;
+        p_mutex_data->OSOwnerPIPrio = ptcb->OSTCBPIPrio;
+    }
+    p_mutex_data->OSNesting = pmutex->OSPIMutexNesting;
+    nbr  = 0u;
+    ptcb = pmutex->OSPIMutexWaitList;
+    while (ptcb != (OS_TCB *)0) {
+        nbr++;
+        ptcb = ptcb->OSTCBPIWaitNext;
+    }
+    p_mutex_data->OSNbrWait = nbr;
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   PI MUTEX MODULE INITIALIZATION
+*
+* Description : This function is called by uC/OS-II to initialize the PI mutex module.  Your application
+*               MUST NOT call this function.
+*
+* Arguments   : none
+*
+* Returns     : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+void  OS_PIMutexInit (void)
+{
+#if OS_MAX_PIMUTEXES == 1u
+    OS_MemClr((INT8U *)&OSPIMutexTbl[0], sizeof(OSPIMutexTbl));  /* Clear the PI mutex table           */
+    OSPIMutexFreeList               = &OSPIMutexTbl[0];          /* Only ONE PI mutex!                 */
+    OSPIMutexFreeList->OSPIMutexPtr = (OS_PIMUTEX *)0;
+#endif
+
+#if OS_MAX_PIMUTEXES >= 2u
+    INT16U       ix;
+    OS_PIMUTEX  *pmutex;
+
+
+
+    OS_MemClr((INT8U *)&OSPIMutexTbl[0], sizeof(OSPIMutexTbl));  /* Clear the PI mutex table           */
+    for (ix = 0u; ix < (OS_MAX_PIMUTEXES - 1u); ix++) {          /* Init. list of free control blocks  */
+        pmutex               = &OSPIMutexTbl[ix];
+        pmutex->OSPIMutexPtr = &OSPIMutexTbl[ix + 1u];
+    }
+    pmutex               = &OSPIMutexTbl[ix];
+    pmutex->OSPIMutexPtr = (OS_PIMUTEX *)0;
+    OSPIMutexFreeList    = &OSPIMutexTbl[0];
+#endif
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  FIND THE TASK OF A BASE PRIORITY
+*
+* Description: This function returns the TCB of the task whose base priority is 'prio', whether or not it
+*              was swapped with another task by a boost (see Note 6).
+*
+* Arguments  : prio          is the priority of the task
+*
+* Returns    : The entry of 'OSTCBPrioTbl[]' for the task: a pointer to its TCB, a NULL pointer if no task has
+*              this priority or OS_TCB_RESERVED.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) A boost swaps two tasks, each taking the base priority of the other: the task at 'prio'
+*                 whose base priority is not 'prio' has its partner at its own base priority.  A task raised
+*                 by a mutex of OS_MUTEX.C is at both priorities and is returned for both.
+*********************************************************************************************************
+*/
+
+OS_TCB  *OS_PIMutexTCBGet (INT8U  prio)
+{
+    OS_TCB  *ptcb;
+
+
+    ptcb = OSTCBPrioTbl[prio];
+    if ((ptcb != (OS_TCB *)0) && (ptcb != OS_TCB_RESERVED)) {
+        if (ptcb->OSTCBBasePrio != prio) {            /* Swapped by a boost, take its partner          */
+            ptcb = OSTCBPrioTbl[ptcb->OSTCBBasePrio];
+        }
+    }
+    return (ptcb);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                 STOP WAITING FOR A PRIORITY INHERITANCE MUTEX
+*
+* Description: This function removes a task from the wait list of the PI mutex it is waiting for and takes
+*              back the priority the task lent to the owner(s).  It is called when the wait ends for any
+*              reason other than OSPIMutexPost() or OSPIMutexDel(): timeout, OSTimeDlyResume() or
+*              OSTaskDel().
+*
+* Arguments  : ptcb          is a pointer to the TCB of the task waiting for a PI mutex
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) Interrupts are assumed to be disabled when this function is called.
+*              3) The task is NOT made ready; it is left at the top of its own chain, at the priority it
+*                 should be made ready at.
+*********************************************************************************************************
+*/
+
+void  OS_PIMutexWaitRemove (OS_TCB  *ptcb)
+{
+    OS_PIMUTEX  *pmutex;
+    OS_TCB      *powner;
+    OS_TCB      *proot;
+
+
+    pmutex = ptcb->OSTCBPIMutexPend;
+    powner = pmutex->OSPIMutexOwner;
+    proot  = powner;                                  /* Find the top of the owner's chain             */
+    while (proot->OSTCBPIMutexPend != (OS_PIMUTEX *)0) {
+        proot = proot->OSTCBPIMutexPend->OSPIMutexOwner;
+    }
+    OS_PIMutexSlotRestore(proot);
+    OS_PIMutexWaitUnlink(pmutex, ptcb);
+    OS_PIMutexPrioUpdate(powner);                     /* Owners no longer inherit our priority         */
+    OS_PIMutexSlotBoost(proot);
+    OS_PIMutexSlotBoost(ptcb);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                              REMOVE A PI MUTEX FROM THE LIST OF MUTEXES HELD
+*
+* Description: This function removes a PI mutex from the list of mutexes owned by a task.
+*
+* Arguments  : ptcb          is a pointer to the TCB of the owner
+*
+*              pmutex        is a pointer to the PI mutex
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+static  void  OS_PIMutexHeldRemove (OS_TCB      *ptcb,
+                                    OS_PIMUTEX  *pmutex)
+{
+    OS_PIMUTEX  **pheld;
+
+
+    pheld = &ptcb->OSTCBPIMutexHeld;
+    while (*pheld != (OS_PIMUTEX *)0) {
+        if (*pheld == pmutex) {
+            *pheld = pmutex->OSPIMutexPtr;
+            break;
+        }
+        pheld = &(*pheld)->OSPIMutexPtr;
+    }
+    pmutex->OSPIMutexPtr = (OS_PIMUTEX *)0;
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   COMPUTE THE EFFECTIVE PRIORITY OF A TASK
+*
+* Description: This function computes the priority a task inherits from the tasks waiting for the PI
+*              mutexes it owns.
+*
+* Arguments  : ptcb          is a pointer to the TCB of the task
+*
+* Returns    : The highest (i.e. lowest number) of the task's base priority and the effective priorities of
+*              the waiters.
+*********************************************************************************************************
+*/
+
+static  INT8U  OS_PIMutexPrioCalc (OS_TCB  *ptcb)
+{
+    OS_PIMUTEX  *pmutex;
+    OS_TCB      *pwait;
+    INT8U        prio;
+
+
+    prio   = ptcb->OSTCBBasePrio;
+    pmutex = ptcb->OSTCBPIMutexHeld;
+    while (pmutex != (OS_PIMUTEX *)0) {
+        pwait = pmutex->OSPIMutexWaitList;
+        while (pwait != (OS_TCB *)0) {
+            if (pwait->OSTCBPIPrio < prio) {
+                prio = pwait->OSTCBPIPrio;
+            }
+            pwait = pwait->OSTCBPIWaitNext;
+        }
+        pmutex = pmutex->OSPIMutexPtr;
+    }
+    return (prio);
+}
+
+/*
+*********************************************************************************************************
+*                              RECOMPUTE THE EFFECTIVE PRIORITIES OF A CHAIN
+*
+* Description: This function recomputes the effective priority of a task and of the owners of the PI
+*              mutexes it is waiting for, stopping at the first task whose priority does not change.
+*
+* Arguments  : ptcb          is a pointer to the TCB of the first task of the chain
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+static  void  OS_PIMutexPrioUpdate (OS_TCB  *ptcb)
+{
+    INT8U  prio;
+
+
+    while (ptcb != (OS_TCB *)0) {
+        prio = OS_PIMutexPrioCalc(ptcb);
+        if (prio == ptcb->OSTCBPIPrio) {              /* Tasks further up are not affected             */
+            break;
+        }
+        ptcb->OSTCBPIPrio = prio;
+        if (ptcb->OSTCBPIMutexPend == (OS_PIMUTEX *)0) {
+            break;
+        }
+        ptcb = ptcb->OSTCBPIMutexPend->OSPIMutexOwner;
+    }
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  MOVE THE TOP OF A CHAIN TO/FROM ITS BOOST
+*
+* Description: OS_PIMutexSlotBoost() moves a task that is at its base priority to its effective priority
+*              by swapping with the task that owns this priority (a task of its chain which is waiting for
+*              a PI mutex).  OS_PIMutexSlotRestore() undoes the swap.
+*
+* Arguments  : ptcb          is a pointer to the TCB of the task at the top of a chain
+*
+* Returns    : none
+*
+* Note(s)    : 1) All the other tasks of the chain MUST be at their base priority.
+*********************************************************************************************************
+*/
+
+static  void  OS_PIMutexSlotBoost (OS_TCB  *ptcb)
+{
+    if (ptcb->OSTCBPIPrio != ptcb->OSTCBPrio) {
+        OS_PIMutexSlotSwap(ptcb, OSTCBPrioTbl[ptcb->OSTCBPIPrio]);
+    }
+}
+
+
+static  void  OS_PIMutexSlotRestore (OS_TCB  *ptcb)
+{
+    if (ptcb->OSTCBBasePrio != ptcb->OSTCBPrio) {
+        OS_PIMutexSlotSwap(ptcb, OSTCBPrioTbl[ptcb->OSTCBBasePrio]);
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                     SWAP THE PRIORITIES OF TWO TASKS
+*
+* Description: This function exchanges the priorities of two tasks, keeping each task in the ready list or
+*              in the event wait list(s) it was in.
+*
+* Arguments  : pa, pb        are pointers to the TCBs of the two tasks
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+static  void  OS_PIMutexSlotSwap (OS_TCB  *pa,
+                                  OS_TCB  *pb)
+{
+    BOOLEAN  rdy_a;
+    BOOLEAN  rdy_b;
+    INT8U    prio_a;
+
+
+    rdy_a  = OS_PIMutexSlotUnlink(pa);                /* Remove both before adding any, they may share */
+    rdy_b  = OS_PIMutexSlotUnlink(pb);                /* ... an event wait list                        */
+    prio_a = pa->OSTCBPrio;
+    OS_PIMutexSlotLink(pa, pb->OSTCBPrio, rdy_a);
+    OS_PIMutexSlotLink(pb, prio_a,        rdy_b);
+}
+
+
+static  BOOLEAN  OS_PIMutexSlotUnlink (OS_TCB  *ptcb)
+{
+#if (OS_EVENT_EN)
+    OS_EVENT   *pevent;
+#if (OS_EVENT_MULTI_EN > 0u)
+    OS_EVENT  **pevents;
+#endif
+#endif
+    INT8U       y;
+
+
+    y = ptcb->OSTCBY;
+    if ((OSRdyTbl[y] & ptcb->OSTCBBitX) != 0u) {      /* See if task is ready                          */
+        OSRdyTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;
+        if (OSRdyTbl[y] == 0u) {
+            OSRdyGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
+        }
+        return (OS_TRUE);
+    }
+#if (OS_EVENT_EN)
+    pevent = ptcb->OSTCBEventPtr;
+    if (pevent != (OS_EVENT *)0) {                    /* Remove from event wait list                   */
+        pevent->OSEventTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;
+        if (pevent->OSEventTbl[y] == 0u) {
+            pevent->OSEventGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
+        }
+    }
+#if (OS_EVENT_MULTI_EN > 0u)
+    pevents = ptcb->OSTCBEventMultiPtr;
+    if (pevents != (OS_EVENT **)0) {                  /* Remove from multiple events wait lists        */
+        pevent = *pevents;
+        while (pevent != (OS_EVENT *)0) {
+            pevent->OSEventTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;
+            if (pevent->OSEventTbl[y] == 0u) {
+                pevent->OSEventGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
+            }
+            pevents++;
+            pevent = *pevents;
+        }
+    }
+#endif
+#endif
+    return (OS_FALSE);
+}
+
+
+static  void  OS_PIMutexSlotLink (OS_TCB   *ptcb,
+                                  INT8U     prio,
+                                  BOOLEAN   rdy)
+{
+#if (OS_EVENT_EN)
+    OS_EVENT   *pevent;
+#if (OS_EVENT_MULTI_EN > 0u)
+    OS_EVENT  **pevents;
+#endif
+#endif
+
+
+    ptcb->OSTCBPrio    = prio;
+#if OS_LOWEST_PRIO <= 63u
+    ptcb->OSTCBY       = (INT8U)(prio >> 3u);
+    ptcb->OSTCBX       = (INT8U)(prio & 0x07u);
+#else
+    ptcb->OSTCBY       = (INT8U)((INT8U)(prio >> 4u) & 0x0Fu);
+    ptcb->OSTCBX       = (INT8U)(prio & 0x0Fu);
+#endif
+    ptcb->OSTCBBitY    = (OS_PRIO)(1uL << ptcb->OSTCBY);
+    ptcb->OSTCBBitX    = (OS_PRIO)(1uL << ptcb->OSTCBX);
+    OSTCBPrioTbl[prio] = ptcb;
+    if (ptcb == OSTCBCur) {                           /* The current task is now at this priority      */
+        OSPrioCur = prio;
+    }
+    if (rdy == OS_TRUE) {                             /* Make ready at new priority ...                */
+        OSRdyGrp               |= ptcb->OSTCBBitY;
+        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+        return;
+    }
+#if (OS_EVENT_EN)
+    pevent = ptcb->OSTCBEventPtr;                     /* ... or wait at new priority                   */
+    if (pevent != (OS_EVENT *)0) {
+        pevent->OSEventGrp               |= ptcb->OSTCBBitY;
+        pevent->OSEventTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+    }
+#if (OS_EVENT_MULTI_EN > 0u)
+    pevents = ptcb->OSTCBEventMultiPtr;
+    if (pevents != (OS_EVENT **)0) {
+        pevent = *pevents;
+        while (pevent != (OS_EVENT *)0) {
+            pevent->OSEventGrp               |= ptcb->OSTCBBitY;
+            pevent->OSEventTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+            pevents++;
+            pevent = *pevents;
+        }
+    }
+#endif
+#endif
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  MAKE A TASK WAITING FOR A PI MUTEX READY
+*
+* Description: This function ends the wait of a task that was removed from the wait list of a PI mutex.
+*
+* Arguments  : ptcb          is a pointer to the TCB of the task
+*
+*              pend_stat     is the pend status to return (OS_STAT_PEND_OK or OS_STAT_PEND_ABORT)
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+static  void  OS_PIMutexTaskRdy (OS_TCB  *ptcb,
+                                 INT8U    pend_stat)
+{
+    ptcb->OSTCBDly       =  0u;                       /* Prevent OSTimeTick() from timing out          */
+    ptcb->OSTCBStat     &= (INT8U)~OS_STAT_MUTEX;
+    ptcb->OSTCBStatPend  =  pend_stat;
+    if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) == OS_STAT_RDY) {
+        OSRdyGrp               |= ptcb->OSTCBBitY;    /* Put task in the ready list                    */
+        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                  REMOVE A TASK FROM A PI MUTEX WAIT LIST
+*
+* Description: This function unlinks a task from the wait list of a PI mutex.
+*
+* Arguments  : pmutex        is a pointer to the PI mutex
+*
+*              ptcb          is a pointer to the TCB of the waiting task
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+static  void  OS_PIMutexWaitUnlink (OS_PIMUTEX  *pmutex,
+                                    OS_TCB      *ptcb)
+{
+    OS_TCB  **pwait;
+
+
+    pwait = &pmutex->OSPIMutexWaitList;
+    while (*pwait != (OS_TCB *)0) {
+        if (*pwait == ptcb) {
+            *pwait = ptcb->OSTCBPIWaitNext;
+            break;
+        }
+        pwait = &(*pwait)->OSTCBPIWaitNext;
+    }
+    ptcb->OSTCBPIWaitNext  = (OS_TCB *)0;
+    ptcb->OSTCBPIMutexPend = (OS_PIMUTEX *)0;
+}
+#endif                                                /* OS_PIMUTEX_EN                                 */
@@ -0,0 +1,521 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                     SIZE-CLASS MEMORY POOL MANAGEMENT
+*
+*                              (c) Copyright 1992-2009, Micrium, Weston, FL
+*                                           All Rights Reserved
+*
+* File    : OS_POOL.C
+* By      : Jean J. Labrosse
+* Version : V2.91
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrim to properly license
+* its use in your product. We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*
+* Note(s) : 1) The pool is a front end to OS_MEM.  Each size class (OS_POOL_MIN_BLK_SIZE, twice that, ...
+*              up to OS_POOL_MAX_BLK_SIZE) is backed by ONE memory partition created with OSMemCreate().
+*              A request for 'size' bytes is served from the smallest created class that can hold it.
+*
+*           2) OSPoolGet() finds the class with a single look-up in 'OSPoolSizeMap[]' (rebuilt each time a
+*              class is created) and OSPoolPut() finds it by comparing the block address against the
+*              OS_POOL_NBR_CLASSES partition ranges.  Both run in bounded time and never search a free
+*              list, so the pool is suitable for use in ISRs.
+*
+*           3) When OS_POOL_TASK_CACHE_EN is enabled each task keeps up to OS_POOL_TASK_CACHE_DEPTH blocks
+*              of each class it has released.  The next OSPoolGet() of that class by the same task reuses
+*              the most recently released (and most likely still cache-warm) block.  Cached blocks are
+*              returned to their partitions by OSPoolCacheFlush() and when the task is deleted.  Until
+*              then they are neither free nor used, and are counted apart (see OSPoolQuery()).
+*
+*           4) The storage given to OSPoolCreate() MUST be aligned on an OS_POOL_ALIGN boundary.  Since
+*              every block size is a multiple of OS_POOL_ALIGN, every block handed out is also aligned
+*              (use 32 to keep DMA buffers on their own cache lines).
+*********************************************************************************************************
+*/
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+#if (OS_POOL_EN > 0u) && (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
+/*
+*********************************************************************************************************
+*                                           LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  OS_PoolMapUpdate(void);
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       CREATE A MEMORY POOL CLASS
+*
+* Description : Create the size class holding blocks of 'blksize' bytes.  The blocks are carved out of a
+*               memory partition managed by OSMemCreate().
+*
+* Arguments   : addr     is the starting address of the storage for the blocks.  It MUST be aligned on an
+*                        OS_POOL_ALIGN boundary.
+*
+*               nblks    is the number of blocks in the class (must be >= 2)
+*
+*               blksize  is the size (in bytes) of each block.  It MUST be one of the class sizes, i.e.
+*                        OS_POOL_MIN_BLK_SIZE multiplied by a power of 2 and no larger than
+*                        OS_POOL_MAX_BLK_SIZE.
+*
+*               perr     is a pointer to a variable containing an error message which will be set by
+*                        this function to either:
+*
+*                        OS_ERR_NONE                if the class has been created
+*                        OS_ERR_POOL_INVALID_SIZE   if 'blksize' is not one of the class sizes
+*                        OS_ERR_POOL_INVALID_ADDR   if 'addr' is NULL or not aligned on OS_POOL_ALIGN
+*                        OS_ERR_POOL_EXIST          if the class for 'blksize' was already created
+*                        OS_ERR_MEM_INVALID_PART    if no free memory partition is available
+*                        OS_ERR_MEM_INVALID_BLKS    if 'nblks' is less than 2
+*
+* Returns     : none
+*
+* Note(s)     : 1) Each class uses one of the OS_MAX_MEM_PART memory partitions.
+*********************************************************************************************************
+*/
+
+void  OSPoolCreate (void   *addr,
+                    INT32U  nblks,
+                    INT32U  blksize,
+                    INT8U  *perr)
+{
+    OS_POOL   *ppool;
+    OS_MEM    *pmem;
+    INT32U     size;
+    INT8U      ix;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (addr == (void *)0) {                          /* Must pass a valid address for the storage     */
+        *perr = OS_ERR_POOL_INVALID_ADDR;
+        return;
+    }
+    if (((OS_CPU_ADDR)addr & (OS_POOL_ALIGN - 1u)) != 0u) {/* Storage must be aligned on OS_POOL_ALIGN */
+        *perr = OS_ERR_POOL_INVALID_ADDR;
+        return;
+    }
+#endif
+    size = OS_POOL_MIN_BLK_SIZE;                      /* Find the class matching 'blksize'             */
+    for (ix = 0u; ix < OS_POOL_NBR_CLASSES; ix++) {
+        if (size == blksize) {
+            break;
+        }
+        size <<= 1u;
+    }
+    if (ix >= OS_POOL_NBR_CLASSES) {                  /* 'blksize' must be one of the class sizes      */
+        *perr = OS_ERR_POOL_INVALID_SIZE;
+        return;
+    }
+    ppool = &OSPoolTbl[ix];
+    if (ppool->OSPoolMem != (OS_MEM *)0) {            /* Class can only be created once                */
+        *perr = OS_ERR_POOL_EXIST;
+        return;
+    }
+    pmem = OSMemCreate(addr, nblks, blksize, perr);   /* Carve the blocks out of a memory partition    */
+    if (*perr != OS_ERR_NONE) {
+        return;
+    }
+    OS_ENTER_CRITICAL();
+    ppool->OSPoolStart   = (INT8U *)addr;
+    ppool->OSPoolEnd     = (INT8U *)addr + (nblks * blksize);
+    ppool->OSPoolNUsed   = 0u;
+    ppool->OSPoolNCached = 0u;
+    ppool->OSPoolMaxUsed = 0u;
+    ppool->OSPoolGetCtr  = 0u;
+    ppool->OSPoolFailCtr = 0u;
+    ppool->OSPoolMem     = pmem;                      /* Class is now available                        */
+    OS_PoolMapUpdate();                               /* Route request sizes to the new class          */
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         GET A BLOCK FROM THE POOL
+*
+* Description : Get a block of at least 'size' bytes from the smallest class able to hold it.
+*
+* Arguments   : size    is the number of bytes needed (1 .. OS_POOL_MAX_BLK_SIZE)
+*
+*               perr    is a pointer to a variable containing an error message which will be set by this
+*                       function to either:
+*
+*                       OS_ERR_NONE                if a block was allocated
+*                       OS_ERR_POOL_INVALID_SIZE   if 'size' is 0 or larger than OS_POOL_MAX_BLK_SIZE
+*                       OS_ERR_POOL_NO_CLASS       if no class large enough for 'size' was created
+*                       OS_ERR_POOL_NO_FREE_BLKS   if the class serving 'size' has no free block left
+*
+* Returns     : A pointer to the block if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) The request is NOT served from a larger class when the class serving 'size' is empty.
+*                  Such a failure is counted in the class statistics (see OSPoolQuery()).
+*********************************************************************************************************
+*/
+
+void  *OSPoolGet (INT32U  size,
+                  INT8U  *perr)
+{
+    OS_POOL   *ppool;
+    OS_MEM    *pmem;
+    void      *pblk;
+    INT8U      ix;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+    if ((size == 0u) || (size > OS_POOL_MAX_BLK_SIZE)) {
+        *perr = OS_ERR_POOL_INVALID_SIZE;
+        return ((void *)0);
+    }
+    ix = OSPoolSizeMap[(size - 1u) / OS_POOL_MIN_BLK_SIZE];
+    if (ix >= OS_POOL_NBR_CLASSES) {                  /* See if a class can hold 'size' bytes          */
+        *perr = OS_ERR_POOL_NO_CLASS;
+        return ((void *)0);
+    }
+    ppool = &OSPoolTbl[ix];
+    pblk  = (void *)0;
+    OS_ENTER_CRITICAL();
+#if OS_POOL_TASK_CACHE_EN > 0u
+    if (OSIntNesting == 0u) {                         /* ISRs don't have a cache                       */
+        pblk = OSTCBCur->OSTCBPoolCache[ix];          /* Reuse the block the task released last        */
+        if (pblk != (void *)0) {
+            OSTCBCur->OSTCBPoolCache[ix] = *(void **)pblk;
+            OSTCBCur->OSTCBPoolCacheCtr[ix]--;
+            ppool->OSPoolNCached--;
+        }
+    }
+#endif
+    if (pblk == (void *)0) {                          /* Take a block from the class partition         */
+        pmem = ppool->OSPoolMem;
+        if (pmem->OSMemNFree > 0u) {
+            pblk                = pmem->OSMemFreeList;
+            pmem->OSMemFreeList = *(void **)pblk;
+            pmem->OSMemNFree--;
+        }
+    }
+    if (pblk == (void *)0) {
+        ppool->OSPoolFailCtr++;                       /* Class is exhausted                            */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_POOL_NO_FREE_BLKS;
+        return ((void *)0);
+    }
+    ppool->OSPoolGetCtr++;
+    ppool->OSPoolNUsed++;
+    if (ppool->OSPoolMaxUsed < ppool->OSPoolNUsed) {  /* Update the high-water mark                    */
+        ppool->OSPoolMaxUsed = ppool->OSPoolNUsed;
+    }
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (pblk);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      RELEASE A BLOCK TO THE POOL
+*
+* Description : Returns a block obtained from OSPoolGet() to its class.
+*
+* Arguments   : pblk    is a pointer to the block being released.
+*
+* Returns     : OS_ERR_NONE                if the block was released
+*               OS_ERR_POOL_INVALID_PBLK   if 'pblk' is NULL or was not obtained from OSPoolGet()
+*               OS_ERR_POOL_FULL           if all the blocks of the class were already released
+*                                          (You freed more blocks than you allocated!)
+*********************************************************************************************************
+*/
+
+INT8U  OSPoolPut (void  *pblk)
+{
+    OS_POOL   *ppool;
+    OS_MEM    *pmem;
+    INT8U      ix;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pblk == (void *)0) {                     /* Must release a valid block                         */
+        return (OS_ERR_POOL_INVALID_PBLK);
+    }
+#endif
+    ppool = &OSPoolTbl[0];                       /* Find the class the block belongs to                */
+    for (ix = 0u; ix < OS_POOL_NBR_CLASSES; ix++) {
+        if (((INT8U *)pblk >= ppool->OSPoolStart) &&
+            ((INT8U *)pblk <  ppool->OSPoolEnd)) {
+            break;
+        }
+        ppool++;
+    }
+    if (ix >= OS_POOL_NBR_CLASSES) {             /* Block must come from one of the classes            */
+        return (OS_ERR_POOL_INVALID_PBLK);
+    }
+    pmem = ppool->OSPoolMem;
+#if OS_ARG_CHK_EN > 0u                           /* Block must start on a block boundary               */
+    if ((((OS_CPU_ADDR)pblk - (OS_CPU_ADDR)ppool->OSPoolStart) & (pmem->OSMemBlkSize - 1u)) != 0u) {
+        return (OS_ERR_POOL_INVALID_PBLK);
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    if (ppool->OSPoolNUsed == 0u) {              /* Make sure all blocks not already returned          */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_POOL_FULL);
+    }
+    ppool->OSPoolNUsed--;
+#if OS_POOL_TASK_CACHE_EN > 0u
+    if (OSIntNesting == 0u) {                    /* Keep the block in the task's cache if room         */
+        if (OSTCBCur->OSTCBPoolCacheCtr[ix] < OS_POOL_TASK_CACHE_DEPTH) {
+            *(void **)pblk                  = OSTCBCur->OSTCBPoolCache[ix];
+            OSTCBCur->OSTCBPoolCache[ix]    = pblk;
+            OSTCBCur->OSTCBPoolCacheCtr[ix]++;
+            ppool->OSPoolNCached++;
+            OS_EXIT_CRITICAL();
+            return (OS_ERR_NONE);
+        }
+    }
+#endif
+    *(void **)pblk      = pmem->OSMemFreeList;   /* Insert released block into the partition free list */
+    pmem->OSMemFreeList = pblk;
+    pmem->OSMemNFree++;
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   FLUSH THE CALLING TASK'S BLOCK CACHE
+*
+* Description : Returns all the blocks cached by the calling task to their partitions, making them
+*               available to other tasks and ISRs.  A task would call this after releasing a large
+*               number of blocks it doesn't expect to need again soon.
+*
+* Arguments   : none
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function MUST NOT be called from an ISR.
+*********************************************************************************************************
+*/
+
+#if OS_POOL_TASK_CACHE_EN > 0u
+void  OSPoolCacheFlush (void)
+{
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    if (OSIntNesting > 0u) {                     /* ISRs don't have a cache                            */
+        return;
+    }
+    OS_ENTER_CRITICAL();
+    OS_PoolCacheFlush(OSTCBCur);
+    OS_EXIT_CRITICAL();
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          QUERY A MEMORY POOL CLASS
+*
+* Description : This function is used to obtain the usage statistics of a size class.
+*
+*               A block released by a task that keeps it in its cache (OS_POOL_TASK_CACHE_EN) is neither
+*               free nor used: it is counted in OSNCached, and only that task can get it back until the
+*               cache is flushed.  OSNFree + OSNUsed + OSNCached is always OSNBlks.
+*
+* Arguments   : ix           is the class index (0 for OS_POOL_MIN_BLK_SIZE bytes, 1 for twice that, ...)
+*
+*               p_pool_data  is a pointer to a structure that will contain information about the class.
+*
+* Returns     : OS_ERR_NONE                 if no errors were found.
+*               OS_ERR_POOL_INVALID_CLASS   if 'ix' is out of range or the class was not created
+*               OS_ERR_POOL_INVALID_PDATA   if you passed a NULL pointer to the data recipient.
+*********************************************************************************************************
+*/
+
+#if OS_POOL_QUERY_EN > 0u
+INT8U  OSPoolQuery (INT8U          ix,
+                    OS_POOL_DATA  *p_pool_data)
+{
+    OS_POOL   *ppool;
+    OS_MEM    *pmem;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (ix >= OS_POOL_NBR_CLASSES) {             /* Must be a valid class index                        */
+        return (OS_ERR_POOL_INVALID_CLASS);
+    }
+    if (p_pool_data == (OS_POOL_DATA *)0) {      /* Must release a valid storage area for the data     */
+        return (OS_ERR_POOL_INVALID_PDATA);
+    }
+#endif
+    ppool = &OSPoolTbl[ix];
+    OS_ENTER_CRITICAL();
+    pmem  = ppool->OSPoolMem;
+    if (pmem == (OS_MEM *)0) {                   /* Class must have been created                       */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_POOL_INVALID_CLASS);
+    }
+    p_pool_data->OSBlkSize = pmem->OSMemBlkSize;
+    p_pool_data->OSNBlks   = pmem->OSMemNBlks;
+    p_pool_data->OSNFree   = pmem->OSMemNFree;
+    p_pool_data->OSNUsed   = ppool->OSPoolNUsed;
+    p_pool_data->OSNCached = ppool->OSPoolNCached;
+    p_pool_data->OSMaxUsed = ppool->OSPoolMaxUsed;
+    p_pool_data->OSGetCtr  = ppool->OSPoolGetCtr;
+    p_pool_data->OSFailCtr = ppool->OSPoolFailCtr;
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif                                           /* OS_POOL_QUERY_EN                                   */
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    RETURN A TASK'S CACHED BLOCKS TO THE POOL
+*
+* Description : This function returns all the blocks cached by the task 'ptcb' to their partitions.  It is
+*               called by OSPoolCacheFlush() and by OSTaskDel() before the TCB is freed.
+*
+* Arguments   : ptcb    is a pointer to the TCB of the task owning the cache
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*
+*               2) Interrupts are assumed to be DISABLED when this function is called.
+*********************************************************************************************************
+*/
+
+#if OS_POOL_TASK_CACHE_EN > 0u
+void  OS_PoolCacheFlush (OS_TCB  *ptcb)
+{
+    OS_POOL *ppool;
+    OS_MEM  *pmem;
+    void    *pblk;
+    void    *pnext;
+    INT8U    ix;
+
+
+    for (ix = 0u; ix < OS_POOL_NBR_CLASSES; ix++) {
+        ppool = &OSPoolTbl[ix];
+        pmem  = ppool->OSPoolMem;
+        pblk  = ptcb->OSTCBPoolCache[ix];
+        while (pblk != (void *)0) {              /* Move every cached block back to its partition      */
+            pnext               = *(void **)pblk;
+           *(void **)pblk       = pmem->OSMemFreeList;
+            pmem->OSMemFreeList = pblk;
+            pmem->OSMemNFree++;
+            pblk                = pnext;
+        }
+        ppool->OSPoolNCached       -= ptcb->OSTCBPoolCacheCtr[ix];
+        ptcb->OSTCBPoolCache[ix]    = (void *)0;
+        ptcb->OSTCBPoolCacheCtr[ix] = 0u;
+    }
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                     INITIALIZE MEMORY POOL MANAGER
+*
+* Description : This function is called by uC/OS-II to initialize the size-class memory pool manager.  Your
+*               application MUST NOT call this function.
+*
+* Arguments   : none
+*
+* Returns     : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+void  OS_PoolInit (void)
+{
+    OS_MemClr((INT8U *)&OSPoolTbl[0], sizeof(OSPoolTbl));   /* No class created yet                    */
+    OS_PoolMapUpdate();
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                      UPDATE THE SIZE TO CLASS MAP
+*
+* Description : This function rebuilds 'OSPoolSizeMap[]' so that entry 'i' holds the index of the smallest
+*               created class whose blocks can hold (i + 1) * OS_POOL_MIN_BLK_SIZE bytes, or
+*               OS_POOL_NBR_CLASSES if there is none.
+*
+* Arguments   : none
+*
+* Returns     : none
+*
+* Note(s)     : 1) Interrupts are assumed to be DISABLED (or the kernel not yet running) when this function
+*                  is called.
+*********************************************************************************************************
+*/
+
+static  void  OS_PoolMapUpdate (void)
+{
+    INT32U  i;
+    INT32U  limit;
+    INT8U   ix;
+
+
+    i = 0u;
+    for (ix = 0u; ix < OS_POOL_NBR_CLASSES; ix++) {
+        limit = 1uL << ix;                       /* Class 'ix' holds up to 'limit' minimum size blocks */
+        if (OSPoolTbl[ix].OSPoolMem != (OS_MEM *)0) {
+            while (i < limit) {                  /* Route all smaller, unserved sizes to this class    */
+                OSPoolSizeMap[i] = ix;
+                i++;
+            }
+        }
+    }
+    while (i < OS_POOL_MAP_SIZE) {               /* Sizes no created class can hold                    */
+        OSPoolSizeMap[i] = OS_POOL_NBR_CLASSES;
+        i++;
+    }
+}
+#endif                                           /* OS_POOL_EN                                         */
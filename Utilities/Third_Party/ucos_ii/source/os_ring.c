@@ -0,0 +1,555 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                 LOCK-FREE RING BUFFER (SPSC) MANAGEMENT
+*
+*                              (c) Copyright 1992-2009, Micrium, Weston, FL
+*                                           All Rights Reserved
+*
+* File    : OS_RING.C
+* By      : Jean J. Labrosse
+* Version : V2.91
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrim to properly license
+* its use in your product. We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*
+* Note(s) : 1) A ring carries fixed-size elements BY VALUE between exactly ONE producer and exactly ONE
+*              consumer.  The producer only ever writes 'OSRingIn' and the consumer only ever writes
+*              'OSRingOut', so neither side needs to disable interrupts to move data.  This makes
+*              OSRingPost() suitable for ISRs (USART RX, ADC DMA half-transfer, CAN RX ...) that must not
+*              add interrupt latency.
+*
+*           2) A ring created with a non-zero 'watermark' owns a semaphore used to wake the consumer
+*              once 'watermark' elements are available.  The producer only touches the semaphore when
+*              the consumer is actually waiting, so tasks are woken once per batch instead of once per
+*              element.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+/*
+*********************************************************************************************************
+*                                    ACCEPT ELEMENTS FROM A RING BUFFER
+*
+* Description: This function copies up to 'max' elements out of the ring.  Unlike OSRingPend(),
+*              OSRingAccept() does not suspend the calling task if the ring is empty.
+*
+* Arguments  : pring         is a pointer to the ring control block
+*
+*              pdest         is a pointer to where the elements will be copied.  The area MUST be able to
+*                            hold 'max' elements of the size given to OSRingCreate().
+*
+*              max           is the maximum number of elements to extract
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 At least one element was extracted
+*                            OS_ERR_RING_EMPTY           The ring did not contain any element
+*                            OS_ERR_RING_INVALID_PRING   If 'pring' is a NULL pointer
+*                            OS_ERR_PDATA_NULL           If 'pdest' is a NULL pointer
+*
+* Returns    : The number of elements copied to 'pdest'
+*
+* Note(s)    : 1) This function MUST only be called by the consumer of the ring.
+*********************************************************************************************************
+*/
+
+INT16U  OSRingAccept (OS_RING  *pring,
+                      void     *pdest,
+                      INT16U    max,
+                      INT8U    *perr)
+{
+    INT8U   *pdata;
+    INT16U   out;
+    INT16U   nbr;
+    INT16U   i;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pring == (OS_RING *)0) {                      /* Validate 'pring'                              */
+        *perr = OS_ERR_RING_INVALID_PRING;
+        return (0u);
+    }
+    if (pdest == (void *)0) {                         /* Validate 'pdest'                              */
+        *perr = OS_ERR_PDATA_NULL;
+        return (0u);
+    }
+#endif
+    out = pring->OSRingOut;                           /* Only the consumer writes 'OSRingOut'          */
+    nbr = (INT16U)(pring->OSRingIn - out);            /* Snapshot of the number of entries             */
+    if (nbr > max) {
+        nbr = max;
+    }
+    if (nbr == 0u) {
+        *perr = OS_ERR_RING_EMPTY;
+        return (0u);
+    }
+    OS_CPU_MemBarrier();                              /* Read 'OSRingIn' before reading the elements   */
+    pdata = (INT8U *)pdest;
+    for (i = 0u; i < nbr; i++) {
+        OS_MemCopy(pdata,
+                   &pring->OSRingStart[(INT32U)((INT16U)(out + i) & pring->OSRingMask) * pring->OSRingElemSize],
+                   pring->OSRingElemSize);
+        pdata += pring->OSRingElemSize;
+    }
+    OS_CPU_MemBarrier();                              /* Elements read before the slots are released   */
+    pring->OSRingOut = (INT16U)(out + nbr);
+    *perr            = OS_ERR_NONE;
+    return (nbr);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          CREATE A RING BUFFER
+*
+* Description: This function creates a single-producer/single-consumer ring buffer of fixed-size
+*              elements.
+*
+* Arguments  : pstorage      is a pointer to the base address of the element storage area.  The area MUST
+*                            hold 'size' * 'elem_size' bytes.
+*
+*              size          is the number of elements in the storage area.  It MUST be a power of 2 between
+*                            2 and 32768.
+*
+*              elem_size     is the size (in bytes) of each element.
+*
+*              watermark     is the number of entries at which a consumer waiting in OSRingPend() is woken.
+*                            Specify 0 if the ring is only ever polled with OSRingAccept(); no semaphore is
+*                            allocated in this case.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The ring was created
+*                            OS_ERR_CREATE_ISR           If you attempted to create a ring from an ISR
+*                            OS_ERR_PDATA_NULL           If 'pstorage' is a NULL pointer
+*                            OS_ERR_RING_INVALID_SIZE    If 'size', 'elem_size' or 'watermark' is invalid
+*                            OS_ERR_RING_DEPLETED        If no more ring control blocks or event control
+*                                                        blocks are available
+*
+* Returns    : != (OS_RING *)0  is a pointer to the ring control block of the created ring
+*              == (OS_RING *)0  if the ring could not be created
+*********************************************************************************************************
+*/
+
+OS_RING  *OSRingCreate (void    *pstorage,
+                        INT16U   size,
+                        INT16U   elem_size,
+                        INT16U   watermark,
+                        INT8U   *perr)
+{
+    OS_RING   *pring;
+    OS_EVENT  *psem;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pstorage == (void *)0) {                      /* Must pass a valid storage area                */
+        *perr = OS_ERR_PDATA_NULL;
+        return ((OS_RING *)0);
+    }
+    if ((size < 2u) || (size > 32768u)) {             /* Indices are 16-bit free-running counters      */
+        *perr = OS_ERR_RING_INVALID_SIZE;
+        return ((OS_RING *)0);
+    }
+    if ((size & (size - 1u)) != 0u) {                 /* Size must be a power of 2                     */
+        *perr = OS_ERR_RING_INVALID_SIZE;
+        return ((OS_RING *)0);
+    }
+    if (elem_size == 0u) {
+        *perr = OS_ERR_RING_INVALID_SIZE;
+        return ((OS_RING *)0);
+    }
+    if (watermark > size) {                           /* Watermark could never be reached              */
+        *perr = OS_ERR_RING_INVALID_SIZE;
+        return ((OS_RING *)0);
+    }
+#endif
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_CREATE_ISR;                    /* ... can't CREATE from an ISR                  */
+        return ((OS_RING *)0);
+    }
+    psem = (OS_EVENT *)0;
+    if (watermark > 0u) {                             /* Allocate the wake-up semaphore if needed      */
+        psem = OSSemCreate(0u);
+        if (psem == (OS_EVENT *)0) {
+            *perr = OS_ERR_RING_DEPLETED;
+            return ((OS_RING *)0);
+        }
+    }
+    OS_ENTER_CRITICAL();
+    pring = OSRingFreeList;                           /* Get a free ring control block                 */
+    if (pring != (OS_RING *)0) {
+        OSRingFreeList = pring->OSRingPtr;
+    }
+    OS_EXIT_CRITICAL();
+    if (pring == (OS_RING *)0) {
+#if (OS_SEM_DEL_EN > 0u)
+        if (psem != (OS_EVENT *)0) {                  /* Give back the semaphore we just allocated     */
+            (void)OSSemDel(psem, OS_DEL_ALWAYS, perr);
+        }
+#endif
+        *perr = OS_ERR_RING_DEPLETED;
+        return ((OS_RING *)0);
+    }
+    pring->OSRingPtr       = (OS_RING *)0;
+    pring->OSRingStart     = (INT8U *)pstorage;
+    pring->OSRingSem       = psem;
+    pring->OSRingIn        = 0u;
+    pring->OSRingOut       = 0u;
+    pring->OSRingMask      = (INT16U)(size - 1u);
+    pring->OSRingElemSize  = elem_size;
+    pring->OSRingWatermark = watermark;
+    pring->OSRingPendFlag  = OS_FALSE;
+    pring->OSRingOvfCtr    = 0uL;
+    *perr                  = OS_ERR_NONE;
+    return (pring);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          DELETE A RING BUFFER
+*
+* Description: This function deletes a ring buffer and its wake-up semaphore.  A consumer waiting on the
+*              ring is readied and its call to OSRingPend() returns 0 with OS_ERR_RING_EMPTY.
+*
+* Arguments  : pring         is a pointer to the ring control block
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 The ring was deleted
+*                            OS_ERR_DEL_ISR              If you attempted to delete the ring from an ISR
+*                            OS_ERR_RING_INVALID_PRING   If 'pring' is a NULL pointer
+*
+* Returns    : (OS_RING *)0  if the ring was deleted
+*              pring         if the ring was NOT deleted
+*
+* Note(s)    : 1) The producer MUST have stopped posting to the ring before it is deleted.
+*              2) The ring is emptied and detached from its semaphore before the semaphore is deleted, so
+*                 the consumer finds it deleted whether it runs before or after this function returns.
+*                 It MUST NOT use the ring after that.
+*********************************************************************************************************
+*/
+
+#if OS_RING_DEL_EN > 0u
+OS_RING  *OSRingDel (OS_RING  *pring,
+                     INT8U    *perr)
+{
+    OS_EVENT  *psem;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pring == (OS_RING *)0) {                      /* Validate 'pring'                              */
+        *perr = OS_ERR_RING_INVALID_PRING;
+        return (pring);
+    }
+#endif
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_DEL_ISR;                       /* ... can't DELETE from an ISR                  */
+        return (pring);
+    }
+    OS_ENTER_CRITICAL();
+    psem                   = pring->OSRingSem;
+    pring->OSRingSem       = (OS_EVENT *)0;           /* Marks the ring deleted for the consumer       */
+    pring->OSRingStart     = (INT8U *)0;
+    pring->OSRingIn        = 0u;
+    pring->OSRingOut       = 0u;
+    pring->OSRingPtr       = OSRingFreeList;          /* Return ring control block to free list        */
+    OSRingFreeList         = pring;
+    OS_EXIT_CRITICAL();
+    if (psem != (OS_EVENT *)0) {                      /* Readies the consumer if it is waiting         */
+        (void)OSSemDel(psem, OS_DEL_ALWAYS, perr);
+    }
+    *perr                  = OS_ERR_NONE;
+    return ((OS_RING *)0);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  PEND ON A RING BUFFER FOR A BATCH OF ELEMENTS
+*
+* Description: This function waits until at least 'watermark' elements are available in the ring (or the
+*              timeout expires) and then copies up to 'max' elements out of the ring.
+*
+* Arguments  : pring         is a pointer to the ring control block
+*
+*              pdest         is a pointer to where the elements will be copied.  The area MUST be able to
+*                            hold 'max' elements of the size given to OSRingCreate().
+*
+*              max           is the maximum number of elements to extract
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for the watermark to be reached up to the amount of time specified by
+*                            this argument and then return whatever is in the ring.  If you specify 0,
+*                            your task will wait until the watermark is reached.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE                 At least one element was extracted
+*                            OS_ERR_TIMEOUT              The ring was still empty when the timeout expired
+*                            OS_ERR_RING_EMPTY           The ring was deleted while the task was waiting
+*                            OS_ERR_PEND_ISR             If you called this function from an ISR
+*                            OS_ERR_PEND_LOCKED          If you called this function with the scheduler
+*                                                        locked
+*                            OS_ERR_RING_NO_WAKE         If the ring was created without a watermark
+*                            OS_ERR_RING_INVALID_PRING   If 'pring' is a NULL pointer
+*                            OS_ERR_PDATA_NULL           If 'pdest' is a NULL pointer
+*
+* Returns    : The number of elements copied to 'pdest'
+*
+* Note(s)    : 1) This function MUST only be called by the consumer of the ring.
+*              2) A wake-up that raced with a consumer finding the watermark already reached leaves one
+*                 stale count on the semaphore.  It is discarded before the next wait, so the worst case is
+*                 a single early return with fewer than 'watermark' elements.
+*********************************************************************************************************
+*/
+
+INT16U  OSRingPend (OS_RING  *pring,
+                    void     *pdest,
+                    INT16U    max,
+                    INT32U    timeout,
+                    INT8U    *perr)
+{
+    INT16U  nbr;
+    INT8U   err;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pring == (OS_RING *)0) {                      /* Validate 'pring'                              */
+        *perr = OS_ERR_RING_INVALID_PRING;
+        return (0u);
+    }
+    if (pdest == (void *)0) {                         /* Validate 'pdest'                              */
+        *perr = OS_ERR_PDATA_NULL;
+        return (0u);
+    }
+#endif
+    if (pring->OSRingSem == (OS_EVENT *)0) {          /* Ring must have been created with a watermark  */
+        *perr = OS_ERR_RING_NO_WAKE;
+        return (0u);
+    }
+    if (OSIntNesting > 0u) {                          /* See if called from ISR ...                    */
+        *perr = OS_ERR_PEND_ISR;                      /* ... can't PEND from an ISR                    */
+        return (0u);
+    }
+    if (OSLockNesting > 0u) {                         /* See if called with scheduler locked ...       */
+        *perr = OS_ERR_PEND_LOCKED;                   /* ... can't PEND when locked                    */
+        return (0u);
+    }
+    err = OS_ERR_NONE;
+    nbr = (INT16U)(pring->OSRingIn - pring->OSRingOut);
+    if (nbr < pring->OSRingWatermark) {               /* Not enough entries yet, must wait             */
+        (void)OSSemAccept(pring->OSRingSem);          /* Discard a stale wake-up (see Note #2)         */
+        pring->OSRingPendFlag = OS_TRUE;              /* Tell producer that we are about to wait       */
+        OS_CPU_MemBarrier();                          /* Flag visible before re-reading 'OSRingIn'     */
+        nbr = (INT16U)(pring->OSRingIn - pring->OSRingOut);
+        if (nbr < pring->OSRingWatermark) {           /* Producer may have filled ring in the meantime */
+            OSSemPend(pring->OSRingSem, timeout, &err);
+            if (pring->OSRingSem == (OS_EVENT *)0) {  /* Ring deleted while we waited, see OSRingDel() */
+                *perr = OS_ERR_RING_EMPTY;
+                return (0u);
+            }
+        }
+        pring->OSRingPendFlag = OS_FALSE;
+    }
+    nbr = OSRingAccept(pring, pdest, max, perr);
+    if ((nbr == 0u) && (err != OS_ERR_NONE)) {        /* Report why we came back empty handed          */
+        *perr = err;
+    }
+    return (nbr);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                     POST AN ELEMENT TO A RING BUFFER
+*
+* Description: This function copies one element into the ring.  Interrupts are NOT disabled; the element
+*              is published to the consumer by a single store of 'OSRingIn'.
+*
+* Arguments  : pring         is a pointer to the ring control block
+*
+*              pdata         is a pointer to the element to copy into the ring
+*
+* Returns    : OS_ERR_NONE                 The element was copied into the ring
+*              OS_ERR_RING_FULL            The ring is full, the element was dropped (see OSRingOvfCtr)
+*              OS_ERR_RING_INVALID_PRING   If 'pring' is a NULL pointer
+*              OS_ERR_PDATA_NULL           If 'pdata' is a NULL pointer
+*
+* Note(s)    : 1) This function MUST only be called by the producer of the ring.  It can be called from an
+*                 ISR.
+*              2) If the ring has a watermark, the ISR MUST be bracketed by OSIntEnter()/OSIntExit() since the
+*                 consumer may be readied by this call.
+*********************************************************************************************************
+*/
+
+INT8U  OSRingPost (OS_RING  *pring,
+                   void     *pdata)
+{
+    INT16U  in;
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pring == (OS_RING *)0) {                      /* Validate 'pring'                              */
+        return (OS_ERR_RING_INVALID_PRING);
+    }
+    if (pdata == (void *)0) {                         /* Validate 'pdata'                              */
+        return (OS_ERR_PDATA_NULL);
+    }
+#endif
+    in = pring->OSRingIn;                             /* Only the producer writes 'OSRingIn'           */
+    if ((INT16U)(in - pring->OSRingOut) > pring->OSRingMask) {
+        pring->OSRingOvfCtr++;                        /* Ring is full, drop the element                */
+        return (OS_ERR_RING_FULL);
+    }
+    OS_MemCopy(&pring->OSRingStart[(INT32U)(in & pring->OSRingMask) * pring->OSRingElemSize],
+               (INT8U *)pdata,
+               pring->OSRingElemSize);
+    OS_CPU_MemBarrier();                              /* Element written before it is published        */
+    in++;
+    pring->OSRingIn = in;
+    if (pring->OSRingPendFlag == OS_TRUE) {           /* Is the consumer waiting for a batch?          */
+        if ((INT16U)(in - pring->OSRingOut) >= pring->OSRingWatermark) {
+            pring->OSRingPendFlag = OS_FALSE;         /* Yes, wake it up exactly once                  */
+            (void)OSSemPost(pring->OSRingSem);
+        }
+    }
+    return (OS_ERR_NONE);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          QUERY A RING BUFFER
+*
+* Description: This function obtains information about a ring buffer.
+*
+* Arguments  : pring         is a pointer to the ring control block
+*
+*              p_ring_data   is a pointer to a structure that will contain information about the ring.
+*
+* Returns    : OS_ERR_NONE                 The call was successful and the data was copied
+*              OS_ERR_RING_INVALID_PRING   If 'pring' is a NULL pointer
+*              OS_ERR_PDATA_NULL           If 'p_ring_data' is a NULL pointer
+*********************************************************************************************************
+*/
+
+#if OS_RING_QUERY_EN > 0u
+INT8U  OSRingQuery (OS_RING       *pring,
+                    OS_RING_DATA  *p_ring_data)
+{
+#if OS_ARG_CHK_EN > 0u
+    if (pring == (OS_RING *)0) {                      /* Validate 'pring'                              */
+        return (OS_ERR_RING_INVALID_PRING);
+    }
+    if (p_ring_data == (OS_RING_DATA *)0) {           /* Validate 'p_ring_data'                        */
+        return (OS_ERR_PDATA_NULL);
+    }
+#endif
+    p_ring_data->OSNEntries   = (INT16U)(pring->OSRingIn - pring->OSRingOut);
+    p_ring_data->OSRingSize   = (INT16U)(pring->OSRingMask + 1u);
+    p_ring_data->OSElemSize   = pring->OSRingElemSize;
+    p_ring_data->OSWatermark  = pring->OSRingWatermark;
+    p_ring_data->OSOvfCtr     = pring->OSRingOvfCtr;
+    return (OS_ERR_NONE);
+}
+#endif                                                /* OS_RING_QUERY_EN                              */
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                    RING BUFFER MODULE INITIALIZATION
+*
+* Description : This function is called by uC/OS-II to initialize the ring buffer module.  Your
+*               application MUST NOT call this function.
+*
+* Arguments   : none
+*
+* Returns     : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+void  OS_RingInit (void)
+{
+#if OS_MAX_RINGS == 1u
+    OS_MemClr((INT8U *)&OSRingTbl[0], sizeof(OSRingTbl));  /* Clear the ring table                     */
+    OSRingFreeList            = &OSRingTbl[0];             /* Only ONE ring!                           */
+    OSRingFreeList->OSRingPtr = (OS_RING *)0;
+#endif
+
+#if OS_MAX_RINGS >= 2u
+    INT16U    ix;
+    OS_RING  *pring;
+
+
+
+    OS_MemClr((INT8U *)&OSRingTbl[0], sizeof(OSRingTbl));  /* Clear the ring table                     */
+    for (ix = 0u; ix < (OS_MAX_RINGS - 1u); ix++) {        /* Init. list of free RING control blocks   */
+        pring            = &OSRingTbl[ix];
+        pring->OSRingPtr = &OSRingTbl[ix + 1u];
+    }
+    pring            = &OSRingTbl[ix];
+    pring->OSRingPtr = (OS_RING *)0;
+    OSRingFreeList   = &OSRingTbl[0];
+#endif
+}
+#endif                                                /* OS_RING_EN                                    */
@@ -44,6 +44,7 @@
 *              OS_ERR_PRIO            there is no task with the specified OLD priority (i.e. the OLD task does
 *                                     not exist.
 *              OS_ERR_TASK_NOT_EXIST  if the task is assigned to a Mutex PIP.
+*              OS_ERR_PIMUTEX_TASK    if the task owns or waits for a PI mutex.
 *********************************************************************************************************
 */
 
@@ -98,6 +99,15 @@ INT8U  OSTaskChangePrio (INT8U  oldprio,
         OS_EXIT_CRITICAL();                                 /* No, can't change its priority!          */
         return (OS_ERR_TASK_NOT_EXIST);
     }
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+    if ((ptcb->OSTCBPIMutexHeld != (OS_PIMUTEX *)0) ||      /* Does task own or wait for a PI mutex?   */
+        (ptcb->OSTCBPIMutexPend != (OS_PIMUTEX *)0)) {
+        OS_EXIT_CRITICAL();                                 /* Yes, can't change its priority!         */
+        return (OS_ERR_PIMUTEX_TASK);
+    }
+    ptcb->OSTCBBasePrio   = newprio;
+    ptcb->OSTCBPIPrio     = newprio;
+#endif
 #if OS_LOWEST_PRIO <= 63u
     y_new                 = (INT8U)(newprio >> 3u);         /* Yes, compute new TCB fields             */
     x_new                 = (INT8U)(newprio & 0x07u);
@@ -404,6 +414,7 @@ INT8U  OSTaskCreateExt (void   (*task)(void *p_arg),
 *              OS_ERR_PRIO_INVALID     if the priority you specify is higher that the maximum allowed
 *                                      (i.e. >= OS_LOWEST_PRIO) or, you have not specified OS_PRIO_SELF.
 *              OS_ERR_TASK_DEL         if the task is assigned to a Mutex PIP.
+*              OS_ERR_PIMUTEX_TASK     if the task owns a PI mutex.
 *              OS_ERR_TASK_NOT_EXIST   if the task you want to delete does not exist.
 *              OS_ERR_TASK_DEL_ISR     if you tried to delete a task from an ISR
 *
@@ -453,9 +464,9 @@ INT8U  OSTaskDel (INT8U prio)
 /*$PAGE*/
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                         /* See if requesting to delete self            */
-        prio = OSTCBCur->OSTCBPrio;                     /* Set priority to delete to current           */
+        prio = OS_PRIO_CUR;                             /* Set priority to delete to current           */
     }
-    ptcb = OSTCBPrioTbl[prio];
+    ptcb = OS_TCB_PRIO_GET(prio);
     if (ptcb == (OS_TCB *)0) {                          /* Task to delete must exist                   */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);
@@ -464,6 +475,16 @@ INT8U  OSTaskDel (INT8U prio)
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_DEL);
     }
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+    if (ptcb->OSTCBPIMutexHeld != (OS_PIMUTEX *)0) {    /* Must not own a PI mutex                     */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_PIMUTEX_TASK);
+    }
+    if (ptcb->OSTCBPIMutexPend != (OS_PIMUTEX *)0) {    /* Remove from PI mutex wait list, the task    */
+        OS_PIMutexWaitRemove(ptcb);                     /* ... goes back to its own priority           */
+        prio = ptcb->OSTCBPrio;
+    }
+#endif
 
     OSRdyTbl[ptcb->OSTCBY] &= (OS_PRIO)~ptcb->OSTCBBitX;
     if (OSRdyTbl[ptcb->OSTCBY] == 0u) {                 /* Make task not ready                         */
@@ -501,6 +522,9 @@ INT8U  OSTaskDel (INT8U prio)
         OSLockNesting--;
     }
     OSTaskDelHook(ptcb);                                /* Call user defined hook                      */
+#if (OS_POOL_EN > 0u) && (OS_POOL_TASK_CACHE_EN > 0u)
+    OS_PoolCacheFlush(ptcb);                            /* Return blocks cached by the task to pool    */
+#endif
     OSTaskCtr--;                                        /* One less task being managed                 */
     OSTCBPrioTbl[prio] = (OS_TCB *)0;                   /* Clear old priority entry                    */
     if (ptcb->OSTCBPrev == (OS_TCB *)0) {               /* Remove from TCB chain                       */
@@ -597,7 +621,7 @@ INT8U  OSTaskDelReq (INT8U prio)
         return (stat);
     }
     OS_ENTER_CRITICAL();
-    ptcb = OSTCBPrioTbl[prio];
+    ptcb = OS_TCB_PRIO_GET(prio);
     if (ptcb == (OS_TCB *)0) {                                  /* Task to delete must exist           */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);                         /* Task must already be deleted        */
@@ -673,9 +697,9 @@ INT8U  OSTaskNameGet (INT8U    prio,
     }
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                          /* See if caller desires it's own name        */
-        prio = OSTCBCur->OSTCBPrio;
+        prio = OS_PRIO_CUR;
     }
-    ptcb = OSTCBPrioTbl[prio];
+    ptcb = OS_TCB_PRIO_GET(prio);
     if (ptcb == (OS_TCB *)0) {                           /* Does task exist?                           */
         OS_EXIT_CRITICAL();                              /* No                                         */
         *perr = OS_ERR_TASK_NOT_EXIST;
@@ -753,9 +777,9 @@ void  OSTaskNameSet (INT8U   prio,
     }
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                      /* See if caller desires to set it's own name     */
-        prio = OSTCBCur->OSTCBPrio;
+        prio = OS_PRIO_CUR;
     }
-    ptcb = OSTCBPrioTbl[prio];
+    ptcb = OS_TCB_PRIO_GET(prio);
     if (ptcb == (OS_TCB *)0) {                       /* Does task exist?                               */
         OS_EXIT_CRITICAL();                          /* No                                             */
         *perr = OS_ERR_TASK_NOT_EXIST;
@@ -807,7 +831,7 @@ INT8U  OSTaskResume (INT8U prio)
     }
 #endif
     OS_ENTER_CRITICAL();
-    ptcb = OSTCBPrioTbl[prio];
+    ptcb = OS_TCB_PRIO_GET(prio);
     if (ptcb == (OS_TCB *)0) {                                /* Task to suspend must exist            */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_RESUME_PRIO);
@@ -856,6 +880,15 @@ INT8U  OSTaskResume (INT8U prio)
 *              OS_ERR_TASK_NOT_EXIST  if the desired task has not been created or is assigned to a Mutex PIP
 *              OS_ERR_TASK_OPT        if you did NOT specified OS_TASK_OPT_STK_CHK when the task was created
 *              OS_ERR_PDATA_NULL      if 'p_stk_data' is a NULL pointer
+*
+* Notes      : 1) The stack guard region (OS_TASK_STK_GUARD_EN) is neither counted as free nor as used.
+*
+*              2) With OS_TASK_STK_WM_EN, the stack is not scanned entry by entry.  The boundary between the
+*                 cleared and the used part of the stack is found by a binary search, between the bottom of
+*                 the stack and the high-water mark found by the previous call (a stack never 'un-grows').
+*                 This takes O(log n) reads, so it is done with interrupts disabled.  A zero entry left in the
+*                 used part (e.g. a local array that was never written) can make the result lower than the
+*                 real usage; an overflow is caught by the guard region in any case.
 *********************************************************************************************************
 */
 #if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
@@ -866,6 +899,11 @@ INT8U  OSTaskStkChk (INT8U         prio,
     OS_STK    *pchk;
     INT32U     nfree;
     INT32U     size;
+#if OS_TASK_STK_WM_EN > 0u
+    INT32U     lo;
+    INT32U     hi;
+    INT32U     mid;
+#endif
 #if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
     OS_CPU_SR  cpu_sr = 0u;
 #endif
@@ -886,9 +924,9 @@ INT8U  OSTaskStkChk (INT8U         prio,
     p_stk_data->OSUsed = 0u;
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                        /* See if check for SELF                        */
-        prio = OSTCBCur->OSTCBPrio;
+        prio = OS_PRIO_CUR;
     }
-    ptcb = OSTCBPrioTbl[prio];
+    ptcb = OS_TCB_PRIO_GET(prio);
     if (ptcb == (OS_TCB *)0) {                         /* Make sure task exist                         */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);
@@ -904,6 +942,36 @@ INT8U  OSTaskStkChk (INT8U         prio,
     nfree = 0u;
     size  = ptcb->OSTCBStkSize;
     pchk  = ptcb->OSTCBStkBottom;
+#if OS_TASK_STK_GUARD_EN > 0u
+    if (ptcb->OSTCBStkGuard != (OS_STK *)0) {          /* Skip the guard region, see Note #1           */
+#if OS_STK_GROWTH == 1u
+        pchk  = ptcb->OSTCBStkGuard + OS_TASK_STK_GUARD_SIZE / sizeof(OS_STK);
+        size -= (INT32U)(pchk - ptcb->OSTCBStkBottom);
+#else
+        pchk  = ptcb->OSTCBStkGuard - 1;
+        size -= (INT32U)(ptcb->OSTCBStkBottom - pchk);
+#endif
+    }
+#endif
+#if OS_TASK_STK_WM_EN > 0u
+    lo = 0u;                                           /* Binary search of the first used entry ...    */
+    hi = size - ptcb->OSTCBStkWM;                      /* ... below the previous mark, see Note #2     */
+    while (lo < hi) {
+        mid = (lo + hi) / 2u;
+#if OS_STK_GROWTH == 1u
+        if (*(pchk + mid) != (OS_STK)0) {
+#else
+        if (*(pchk - mid) != (OS_STK)0) {
+#endif
+            hi = mid;
+        } else {
+            lo = mid + 1u;
+        }
+    }
+    nfree            = lo;
+    ptcb->OSTCBStkWM = size - nfree;                   /* New high-water mark                          */
+    OS_EXIT_CRITICAL();
+#else
     OS_EXIT_CRITICAL();
 #if OS_STK_GROWTH == 1u
     while (*pchk++ == (OS_STK)0) {                    /* Compute the number of zero entries on the stk */
@@ -913,6 +981,7 @@ INT8U  OSTaskStkChk (INT8U         prio,
     while (*pchk-- == (OS_STK)0) {
         nfree++;
     }
+#endif
 #endif
     p_stk_data->OSFree = nfree * sizeof(OS_STK);          /* Compute number of free bytes on the stack */
     p_stk_data->OSUsed = (size - nfree) * sizeof(OS_STK); /* Compute number of bytes used on the stack */
@@ -967,14 +1036,14 @@ INT8U  OSTaskSuspend (INT8U prio)
 #endif
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                                 /* See if suspend SELF                 */
-        prio = OSTCBCur->OSTCBPrio;
-        self = OS_TRUE;
-    } else if (prio == OSTCBCur->OSTCBPrio) {                   /* See if suspending self              */
+        prio = OS_PRIO_CUR;
+    }
+    ptcb = OS_TCB_PRIO_GET(prio);
+    if (ptcb == OSTCBCur) {                                     /* See if suspending self              */
         self = OS_TRUE;
     } else {
         self = OS_FALSE;                                        /* No suspending another task          */
     }
-    ptcb = OSTCBPrioTbl[prio];
     if (ptcb == (OS_TCB *)0) {                                  /* Task to suspend must exist          */
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_SUSPEND_PRIO);
@@ -1013,6 +1082,9 @@ INT8U  OSTaskSuspend (INT8U prio)
 *              OS_ERR_PRIO            if the desired task has not been created
 *              OS_ERR_TASK_NOT_EXIST  if the task is assigned to a Mutex PIP
 *              OS_ERR_PDATA_NULL      if 'p_task_data' is a NULL pointer
+*
+* Note(s)    : 1) While the task inherits a priority through a PI mutex, 'OSTCBPrio' in the copy is the
+*                 priority it runs at and 'OSTCBBasePrio' is 'prio' (see OS_PIMUTEX.C).
 *********************************************************************************************************
 */
 
@@ -1039,9 +1111,9 @@ INT8U  OSTaskQuery (INT8U    prio,
 #endif
     OS_ENTER_CRITICAL();
     if (prio == OS_PRIO_SELF) {                  /* See if suspend SELF                                */
-        prio = OSTCBCur->OSTCBPrio;
+        prio = OS_PRIO_CUR;
     }
-    ptcb = OSTCBPrioTbl[prio];
+    ptcb = OS_TCB_PRIO_GET(prio);
     if (ptcb == (OS_TCB *)0) {                   /* Task to query must exist                           */
         OS_EXIT_CRITICAL();
         return (OS_ERR_PRIO);
@@ -1111,7 +1183,7 @@ INT32U  OSTaskRegGet (INT8U   prio,
     if (prio == OS_PRIO_SELF) {                  /* See if need to get register from current task      */
         ptcb = OSTCBCur;
     } else {
-        ptcb = OSTCBPrioTbl[prio];
+        ptcb = OS_TCB_PRIO_GET(prio);
     }
     value = ptcb->OSTCBRegTbl[id];
     OS_EXIT_CRITICAL();
@@ -1177,7 +1249,7 @@ void  OSTaskRegSet (INT8U    prio,
     if (prio == OS_PRIO_SELF) {                  /* See if need to get register from current task      */
         ptcb = OSTCBCur;
     } else {
-        ptcb = OSTCBPrioTbl[prio];
+        ptcb = OS_TCB_PRIO_GET(prio);
     }
     ptcb->OSTCBRegTbl[id] = value;
     OS_EXIT_CRITICAL();
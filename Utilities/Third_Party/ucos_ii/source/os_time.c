@@ -172,7 +172,7 @@ INT8U  OSTimeDlyResume (INT8U prio)
         return (OS_ERR_PRIO_INVALID);
     }
     OS_ENTER_CRITICAL();
-    ptcb = OSTCBPrioTbl[prio];                                 /* Make sure that task exist            */
+    ptcb = OS_TCB_PRIO_GET(prio);                              /* Make sure that task exist            */
     if (ptcb == (OS_TCB *)0) {
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_NOT_EXIST);                        /* The task does not exist              */
@@ -188,6 +188,11 @@ INT8U  OSTimeDlyResume (INT8U prio)
 
     ptcb->OSTCBDly = 0u;                                       /* Clear the time delay                 */
     if ((ptcb->OSTCBStat & OS_STAT_PEND_ANY) != OS_STAT_RDY) {
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+        if (ptcb->OSTCBPIMutexPend != (OS_PIMUTEX *)0) {
+            OS_PIMutexWaitRemove(ptcb);                        /* Take back prio lent to mutex owner   */
+        }
+#endif
         ptcb->OSTCBStat     &= ~OS_STAT_PEND_ANY;              /* Yes, Clear status flag               */
         ptcb->OSTCBStatPend  =  OS_STAT_PEND_TO;               /* Indicate PEND timeout                */
     } else {
@@ -0,0 +1,368 @@
+/*
+*********************************************************************************************************
+*                                                uC/OS-II
+*                                          The Real-Time Kernel
+*                                      EVENT TRACE AND TASK PROFILING
+*
+*                              (c) Copyright 1992-2009, Micrium, Weston, FL
+*                                           All Rights Reserved
+*
+* File    : OS_TRACE.C
+* By      : Jean J. Labrosse
+* Version : V2.91
+*
+* LICENSING TERMS:
+* ---------------
+*   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrim to properly license
+* its use in your product. We provide ALL the source code for your convenience and to help you experience
+* uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
+* licensing fee.
+*
+* Note(s) : 1) Every context switch and every ISR bracketed by OSIntEnter()/OSIntExit() is time stamped with
+*              OS_TS_GET() (a free running CPU cycle counter provided by the port) into 'OSTraceTbl[]'.
+*
+*           2) Records are only ever written from places where the kernel has ALREADY disabled interrupts
+*              (OSIntEnter(), OSIntExit() and OSTaskSwHook()), so tracing adds no critical section of its
+*              own.  The single reader (OSTraceRead()) never disables interrupts: it only ever writes
+*              'OSTraceOut' while the writers only ever write 'OSTraceIn'.  When the ring is full new
+*              records are dropped and counted in 'OSTraceLostCtr'.
+*
+*           3) The 'ISR to task' latency of a task is the time between the entry of the outermost ISR and
+*              the moment the task is switched in, when that ISR made the task ready to run.  The largest
+*              value seen is kept in the task's OS_TCB.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_MASTER_FILE
+#include <ucos_ii.h>
+#endif
+
+#if OS_TRACE_EN > 0u
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  INT32U   OSTraceIntEnterTS;              /* Time stamp of the entry in the outermost ISR       */
+static  BOOLEAN  OSTraceIntSwPend;               /* The outermost ISR requested a context switch       */
+static  INT32U   OSTraceStatTS;                  /* Time stamp of the previous OSTraceStatUpdate()     */
+
+/*
+*********************************************************************************************************
+*                                           LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  OS_TraceRec(INT8U   type,
+                          INT16U  arg,
+                          INT32U  ts);
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         READ TRACE RECORDS
+*
+* Description: This function moves up to 'max' records out of the trace ring, oldest first.
+*
+* Arguments  : pdest         is a pointer to where the records will be copied.
+*
+*              max           is the maximum number of records to copy
+*
+* Returns    : The number of records copied (0 if the ring is empty or 'pdest' is a NULL pointer)
+*
+* Note(s)    : 1) Only ONE task may read the trace.
+*********************************************************************************************************
+*/
+
+INT16U  OSTraceRead (OS_TRACE_REC  *pdest,
+                     INT16U         max)
+{
+    INT16U  out;
+    INT16U  nbr;
+    INT16U  i;
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pdest == (OS_TRACE_REC *)0) {            /* Validate 'pdest'                                   */
+        return (0u);
+    }
+#endif
+    out = OSTraceOut;
+    nbr = (INT16U)(OSTraceIn - out);             /* Number of records available                        */
+    if (nbr > max) {
+        nbr = max;
+    }
+    OS_CPU_MemBarrier();                         /* Read the records only after 'OSTraceIn'            */
+    for (i = 0u; i < nbr; i++) {
+        *pdest++ = OSTraceTbl[out & (OS_TRACE_BUF_SIZE - 1u)];
+        out++;
+    }
+    OS_CPU_MemBarrier();                         /* Release the slots only once they have been copied  */
+    OSTraceOut = out;
+    return (nbr);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                     UPDATE TASK CPU USAGE STATISTICS
+*
+* Description: This function computes, for every task, the share of the CPU cycles it used since the
+*              previous call.  The result is returned by OSTraceTaskQuery().  It is typically called
+*              periodically by the task exporting the trace.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) Time spent in ISRs is charged to the task that was interrupted.
+*********************************************************************************************************
+*/
+
+void  OSTraceStatUpdate (void)
+{
+    OS_TCB    *ptcb;
+    INT32U     ts;
+    INT32U     total;
+    INT32U     delta;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    OS_ENTER_CRITICAL();
+    ts                         = OS_TS_GET();
+    total                      = (ts - OSTraceStatTS) / 10000u;  /* Cycles per 0.01% of the period     */
+    OSTraceStatTS              = ts;
+    OSTCBCur->OSTCBCyclesTot  += ts - OSTCBCur->OSTCBCyclesStart;/* Charge the running task up to now */
+    OSTCBCur->OSTCBCyclesStart = ts;
+    ptcb                       = OSTCBList;
+    while (ptcb != (OS_TCB *)0) {                /* Go through all the TCBs in the TCB list            */
+        delta                 = ptcb->OSTCBCyclesTot - ptcb->OSTCBCyclesPrev;
+        ptcb->OSTCBCyclesPrev = ptcb->OSTCBCyclesTot;
+        if (total > 0u) {
+            delta /= total;
+            if (delta > 10000u) {
+                delta = 10000u;
+            }
+            ptcb->OSTCBCPUUsage = (INT16U)delta;
+        }
+        ptcb = ptcb->OSTCBNext;
+    }
+    OS_EXIT_CRITICAL();
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                        QUERY A TASK'S PROFILE
+*
+* Description: This function is used to obtain the profiling data of a task.
+*
+* Arguments  : prio          is the priority of the task to query or OS_PRIO_SELF
+*
+*              p_task_data   is a pointer to a structure that will contain the profiling data
+*
+* Returns    : OS_ERR_NONE            if no errors were found.
+*              OS_ERR_PRIO_INVALID    if the priority is invalid
+*              OS_ERR_TASK_NOT_EXIST  if the task does not exist
+*              OS_ERR_PDATA_NULL      if 'p_task_data' is a NULL pointer
+*********************************************************************************************************
+*/
+
+INT8U  OSTraceTaskQuery (INT8U                prio,
+                         OS_TRACE_TASK_DATA  *p_task_data)
+{
+    OS_TCB    *ptcb;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (prio > OS_LOWEST_PRIO) {                 /* Task priority valid ?                              */
+        if (prio != OS_PRIO_SELF) {
+            return (OS_ERR_PRIO_INVALID);
+        }
+    }
+    if (p_task_data == (OS_TRACE_TASK_DATA *)0) {
+        return (OS_ERR_PDATA_NULL);
+    }
+#endif
+    OS_ENTER_CRITICAL();
+    if (prio == OS_PRIO_SELF) {                  /* See if we need to query the current task           */
+        prio = OS_PRIO_CUR;
+    }
+    ptcb = OS_TCB_PRIO_GET(prio);
+    if (ptcb == (OS_TCB *)0) {                   /* Task to query must exist                           */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_NOT_EXIST);
+    }
+    if (ptcb == OS_TCB_RESERVED) {               /* Task to query must not be assigned to a Mutex      */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_TASK_NOT_EXIST);
+    }
+    p_task_data->OSCtxSwCtr  = ptcb->OSTCBCtxSwCtr;
+    p_task_data->OSCyclesTot = ptcb->OSTCBCyclesTot;
+    p_task_data->OSLatMax    = ptcb->OSTCBLatMax;
+    p_task_data->OSCPUUsage  = ptcb->OSTCBCPUUsage;
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         INITIALIZE THE TRACE
+*
+* Description: This function is called by OSInit() to initialize the trace ring.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+void  OS_TraceInit (void)
+{
+    OSTraceIn         = 0u;
+    OSTraceOut        = 0u;
+    OSTraceLostCtr    = 0u;
+    OSTraceIntEnterTS = 0u;
+    OSTraceIntSwPend  = OS_FALSE;
+    OSTraceStatTS     = OS_TS_GET();
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          TRACE ISR ENTRY
+*
+* Description: This function is called by OSIntEnter() once 'OSIntNesting' has been incremented.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*
+*              2) Interrupts are assumed to be DISABLED when this function is called.
+*********************************************************************************************************
+*/
+
+void  OS_TraceIntEnter (void)
+{
+    INT32U  ts;
+
+
+    ts = OS_TS_GET();
+    if (OSIntNesting == 1u) {                    /* Remember when the outermost ISR started            */
+        OSTraceIntEnterTS = ts;
+    }
+    OS_TraceRec(OS_TRACE_EV_ISR_ENTER, (INT16U)OS_CPU_IntNbrGet(), ts);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                           TRACE ISR EXIT
+*
+* Description: This function is called by OSIntExit() once the scheduler has determined whether a
+*              context switch is needed.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*
+*              2) Interrupts are assumed to be DISABLED when this function is called.
+*********************************************************************************************************
+*/
+
+void  OS_TraceIntExit (void)
+{
+    if (OSIntNesting == 0u) {                    /* Leaving the outermost ISR ...                      */
+        if (OSLockNesting == 0u) {
+            if (OSTCBHighRdy != OSTCBCur) {      /* ... after having readied a higher priority task    */
+                OSTraceIntSwPend = OS_TRUE;
+            }
+        }
+    }
+    OS_TraceRec(OS_TRACE_EV_ISR_EXIT, (INT16U)OS_CPU_IntNbrGet(), OS_TS_GET());
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         TRACE A CONTEXT SWITCH
+*
+* Description: This function is called by OSTaskSwHook() just before 'OSTCBHighRdy' is switched in.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*
+*              2) Interrupts are assumed to be DISABLED when this function is called.
+*********************************************************************************************************
+*/
+
+void  OS_TraceTaskSw (void)
+{
+    INT32U  ts;
+    INT32U  lat;
+
+
+    ts = OS_TS_GET();
+    if (OSTraceIntSwPend == OS_TRUE) {           /* Switch requested by an ISR?                        */
+        OSTraceIntSwPend = OS_FALSE;
+        lat              = ts - OSTraceIntEnterTS;
+        if (OSTCBHighRdy->OSTCBLatMax < lat) {   /* Keep the worst ISR to task latency                 */
+            OSTCBHighRdy->OSTCBLatMax = lat;
+        }
+    }
+    OS_TraceRec(OS_TRACE_EV_TASK_SW, (INT16U)OSTCBHighRdy->OSTCBPrio, ts);
+}
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          WRITE A TRACE RECORD
+*
+* Description: This function appends a record to the trace ring.
+*
+* Arguments  : type     is the type of event (see OS_TRACE_EV_???)
+*
+*              arg      is the argument of the event (priority of the task or exception number)
+*
+*              ts       is the time stamp of the event
+*
+* Returns    : none
+*
+* Note(s)    : 1) Interrupts are assumed to be DISABLED when this function is called.
+*********************************************************************************************************
+*/
+
+static  void  OS_TraceRec (INT8U   type,
+                           INT16U  arg,
+                           INT32U  ts)
+{
+    OS_TRACE_REC  *prec;
+    INT16U         in;
+
+
+    in = OSTraceIn;
+    if ((INT16U)(in - OSTraceOut) >= OS_TRACE_BUF_SIZE) {
+        OSTraceLostCtr++;                        /* Ring is full, drop the record                      */
+        return;
+    }
+    prec                 = &OSTraceTbl[in & (OS_TRACE_BUF_SIZE - 1u)];
+    prec->OSTraceTS      = ts;
+    prec->OSTraceArg     = arg;
+    prec->OSTraceType    = type;
+    prec->OSTraceNesting = OSIntNesting;
+    OS_CPU_MemBarrier();                         /* Record must be complete before it is published     */
+    OSTraceIn            = in + 1u;
+}
+#endif                                           /* OS_TRACE_EN                                        */
@@ -87,11 +87,20 @@ extern "C" {
 #define  OS_TASK_IDLE_ID            65535u              /* ID numbers for Idle, Stat and Timer tasks   */
 #define  OS_TASK_STAT_ID            65534u
 #define  OS_TASK_TMR_ID             65533u
+#define  OS_TASK_HTMR_ID            65532u
 
 #define  OS_EVENT_EN           (((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u) || (OS_SEM_EN > 0u) || (OS_MUTEX_EN > 0u))
 
 #define  OS_TCB_RESERVED        ((OS_TCB *)1)
 
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)     /* Services taking a priority name the task by ... */
+#define  OS_TCB_PRIO_GET(prio)  OS_PIMutexTCBGet(prio)  /* ... its base priority (see OS_PIMUTEX.C)        */
+#define  OS_PRIO_CUR            (OSTCBCur->OSTCBBasePrio)
+#else
+#define  OS_TCB_PRIO_GET(prio)  OSTCBPrioTbl[prio]
+#define  OS_PRIO_CUR            (OSTCBCur->OSTCBPrio)
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -132,6 +141,7 @@ extern "C" {
 
 #define  OS_TMR_TYPE                  100u  /* Used to identify Timers ...                             */
                                             /* ... (Must be different value than OS_EVENT_TYPE_xxx)    */
+#define  OS_HTMR_TYPE                 101u  /* Used to identify High resolution timers                 */
 
 /*
 *********************************************************************************************************
@@ -234,6 +244,21 @@ extern "C" {
 #define  OS_TMR_STATE_COMPLETED         2u
 #define  OS_TMR_STATE_RUNNING           3u
 
+/*
+*********************************************************************************************************
+*                                 HIGH RESOLUTION TIMERS (see OS_HTMR.C)
+*********************************************************************************************************
+*/
+
+#define  OS_HTMR_OPT_TASK               0u  /* Callback runs in the timer task                         */
+#define  OS_HTMR_OPT_ISR                1u  /* Callback runs in the timer ISR                          */
+
+#define  OS_HTMR_LEVELS                 8u  /* Number of levels of the timing wheel                    */
+#define  OS_HTMR_SLOTS                 16u  /* Number of slots per level                               */
+#define  OS_HTMR_SLOT_BITS              4u  /* Number of bits of the time per level                    */
+
+#define  OS_HTMR_DLY_MAX      0x3FFFFFFFuL  /* Max. delay or period, in counts of the hardware timer   */
+
 /*
 *********************************************************************************************************
 *                                             ERROR CODES
@@ -333,6 +358,29 @@ extern "C" {
 #define OS_ERR_TMR_STOPPED            142u
 #define OS_ERR_TMR_NO_CALLBACK        143u
 
+#define OS_ERR_RING_FULL              150u
+#define OS_ERR_RING_EMPTY             151u
+#define OS_ERR_RING_INVALID_SIZE      152u
+#define OS_ERR_RING_INVALID_PRING     153u
+#define OS_ERR_RING_DEPLETED          154u
+#define OS_ERR_RING_NO_WAKE           155u
+
+#define OS_ERR_POOL_INVALID_SIZE      160u
+#define OS_ERR_POOL_INVALID_ADDR      161u
+#define OS_ERR_POOL_EXIST             162u
+#define OS_ERR_POOL_NO_CLASS          163u
+#define OS_ERR_POOL_NO_FREE_BLKS      164u
+#define OS_ERR_POOL_INVALID_PBLK      165u
+#define OS_ERR_POOL_FULL              166u
+#define OS_ERR_POOL_INVALID_CLASS     167u
+#define OS_ERR_POOL_INVALID_PDATA     168u
+
+#define OS_ERR_PIMUTEX_INVALID_P      170u
+#define OS_ERR_PIMUTEX_DEPLETED       171u
+#define OS_ERR_PIMUTEX_DEADLOCK       172u
+#define OS_ERR_PIMUTEX_OVF            173u
+#define OS_ERR_PIMUTEX_TASK           174u
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -369,7 +417,7 @@ typedef struct os_event {
 
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
 
-#if OS_FLAGS_NBITS == 8u                    /* Determine the size of OS_FLAGS (8, 16 or 32 bits)       */
+#if OS_FLAGS_NBITS == 8u                    /* Determine the size of OS_FLAGS (8, 16, 32 or 64 bits)   */
 typedef  INT8U    OS_FLAGS;
 #endif
 
@@ -381,21 +429,31 @@ typedef  INT16U   OS_FLAGS;
 typedef  INT32U   OS_FLAGS;
 #endif
 
+#if OS_FLAGS_NBITS == 64u
+typedef  INT64U   OS_FLAGS;
+#endif
+
 
 typedef struct os_flag_grp {                /* Event Flag Group                                        */
     INT8U         OSFlagType;               /* Should be set to OS_EVENT_TYPE_FLAG                     */
-    void         *OSFlagWaitList;           /* Pointer to first NODE of task waiting on event flag     */
-    OS_FLAGS      OSFlagFlags;              /* 8, 16 or 32 bit flags                                   */
+    void         *OSFlagWaitList;           /* Pointer to first bucket of tasks waiting on event flag  */
+    OS_FLAGS      OSFlagFlags;              /* 8, 16, 32 or 64 bit flags                               */
 #if OS_FLAG_NAME_EN > 0u
     INT8U        *OSFlagName;
 #endif
+#if OS_FLAG_POST_DEFER_EN > 0u
+    struct os_flag_grp *OSFlagDeferNext;    /* Next group posted by an ISR, see OS_FlagDeferRun()      */
+    BOOLEAN       OSFlagDeferPend;          /* Group is in the list of groups posted by ISRs           */
+#endif
 } OS_FLAG_GRP;
 
 
 
 typedef struct os_flag_node {               /* Event Flag Wait List Node                               */
-    void         *OSFlagNodeNext;           /* Pointer to next     NODE in wait list                   */
-    void         *OSFlagNodePrev;           /* Pointer to previous NODE in wait list                   */
+    void         *OSFlagNodeNext;           /* Pointer to next     bucket in wait list (heads only)    */
+    void         *OSFlagNodePrev;           /* Pointer to previous bucket in wait list (heads only)    */
+    void         *OSFlagNodePeerNext;       /* Pointer to next     NODE in the same bucket             */
+    void         *OSFlagNodePeerPrev;       /* Pointer to previous NODE in the same bucket (0 for head)*/
     void         *OSFlagNodeTCB;            /* Pointer to TCB of waiting task                          */
     void         *OSFlagNodeFlagGrp;        /* Pointer to Event Flag Group                             */
     OS_FLAGS      OSFlagNodeFlags;          /* Event flag to wait on                                   */
@@ -404,6 +462,7 @@ typedef struct os_flag_node {               /* Event Flag Wait List Node
                                             /*      OS_FLAG_WAIT_ALL                                   */
                                             /*      OS_FLAG_WAIT_OR                                    */
                                             /*      OS_FLAG_WAIT_ANY                                   */
+                                            /*      ... + OS_FLAG_CONSUME                              */
 } OS_FLAG_NODE;
 #endif
 
@@ -451,6 +510,41 @@ typedef struct os_mem_data {
 } OS_MEM_DATA;
 #endif
 
+/*
+*********************************************************************************************************
+*                                   SIZE-CLASS MEMORY POOL DATA STRUCTURES
+*********************************************************************************************************
+*/
+
+#if (OS_POOL_EN > 0u) && (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
+#define  OS_POOL_MAX_BLK_SIZE  ((INT32U)OS_POOL_MIN_BLK_SIZE << (OS_POOL_NBR_CLASSES - 1u))
+#define  OS_POOL_MAP_SIZE      (1u << (OS_POOL_NBR_CLASSES - 1u))   /* Nbr of entries in OSPoolSizeMap[] */
+
+
+typedef struct os_pool {                  /* SIZE CLASS CONTROL BLOCK                                  */
+    OS_MEM *OSPoolMem;                    /* Partition holding the blocks (NULL if class not created)  */
+    INT8U  *OSPoolStart;                  /* Address of the first block of the class                   */
+    INT8U  *OSPoolEnd;                    /* Address just past the last block of the class             */
+    INT32U  OSPoolNUsed;                  /* Number of blocks currently held by the application        */
+    INT32U  OSPoolNCached;                /* Number of blocks held in task caches, neither free nor used */
+    INT32U  OSPoolMaxUsed;                /* Highest value reached by OSPoolNUsed (high-water mark)    */
+    INT32U  OSPoolGetCtr;                 /* Number of successful calls to OSPoolGet()                 */
+    INT32U  OSPoolFailCtr;                /* Number of calls to OSPoolGet() that found no free block   */
+} OS_POOL;
+
+
+typedef struct os_pool_data {
+    INT32U  OSBlkSize;                 /* Size (in bytes) of each block of the class                   */
+    INT32U  OSNBlks;                   /* Total number of blocks in the class                          */
+    INT32U  OSNFree;                   /* Number of blocks free in the partition (not in task caches)  */
+    INT32U  OSNUsed;                   /* Number of blocks held by the application                     */
+    INT32U  OSNCached;                 /* Number of blocks held in task caches                         */
+    INT32U  OSMaxUsed;                 /* High-water mark of OSNUsed                                   */
+    INT32U  OSGetCtr;                  /* Number of successful allocations                             */
+    INT32U  OSFailCtr;                 /* Number of failed allocations                                 */
+} OS_POOL_DATA;
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -468,6 +562,30 @@ typedef struct os_mutex_data {
 } OS_MUTEX_DATA;
 #endif
 
+/*
+*********************************************************************************************************
+*                                 PRIORITY INHERITANCE MUTEX DATA
+*********************************************************************************************************
+*/
+
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+typedef struct os_pimutex {             /* PRIORITY INHERITANCE MUTEX CONTROL BLOCK                    */
+    struct os_pimutex *OSPIMutexPtr;    /* Next mutex owned by the same task, or next free block       */
+    struct os_tcb     *OSPIMutexOwner;  /* Pointer to the TCB of the owner (NULL if available)         */
+    struct os_tcb     *OSPIMutexWaitList;  /* List of tasks waiting for the mutex                      */
+    INT16U             OSPIMutexNesting;   /* Number of times the owner acquired the mutex             */
+} OS_PIMUTEX;
+
+
+typedef struct os_pimutex_data {
+    BOOLEAN  OSValue;                   /* Mutex value (OS_FALSE = used, OS_TRUE = available)          */
+    INT8U    OSOwnerPrio;               /* Owner's base priority or 0xFF if no owner                   */
+    INT8U    OSOwnerPIPrio;             /* Priority the owner inherited or 0xFF if no owner            */
+    INT8U    OSNbrWait;                 /* Number of tasks waiting for the mutex                       */
+    INT16U   OSNesting;                 /* Number of times the owner acquired the mutex                */
+} OS_PIMUTEX_DATA;
+#endif
+
 /*
 *********************************************************************************************************
 *                                          MESSAGE QUEUE DATA
@@ -495,6 +613,36 @@ typedef struct os_q_data {
 } OS_Q_DATA;
 #endif
 
+/*
+*********************************************************************************************************
+*                                       RING BUFFER (SPSC) DATA
+*********************************************************************************************************
+*/
+
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+typedef struct os_ring {                /* RING BUFFER CONTROL BLOCK                                   */
+    struct os_ring   *OSRingPtr;        /* Link to next ring control block in list of free blocks      */
+    INT8U            *OSRingStart;      /* Pointer to start of element storage                         */
+    OS_EVENT         *OSRingSem;        /* Semaphore used to wake the consumer (NULL if no watermark)  */
+    volatile INT16U   OSRingIn;         /* Free-running index of next element to write (producer only) */
+    volatile INT16U   OSRingOut;        /* Free-running index of next element to read  (consumer only) */
+    INT16U            OSRingMask;       /* Number of elements - 1 (number of elements is a power of 2) */
+    INT16U            OSRingElemSize;   /* Size (in bytes) of each element                             */
+    INT16U            OSRingWatermark;  /* Nbr of entries needed to wake the consumer (0 = no wake)    */
+    volatile BOOLEAN  OSRingPendFlag;   /* Consumer is waiting on 'OSRingSem'                          */
+    INT32U            OSRingOvfCtr;     /* Number of elements dropped because the ring was full        */
+} OS_RING;
+
+
+typedef struct os_ring_data {
+    INT16U         OSNEntries;          /* Number of elements in the ring                              */
+    INT16U         OSRingSize;          /* Size of the ring (maximum number of elements)               */
+    INT16U         OSElemSize;          /* Size (in bytes) of each element                             */
+    INT16U         OSWatermark;         /* Nbr of entries needed to wake the consumer                  */
+    INT32U         OSOvfCtr;            /* Number of elements dropped because the ring was full        */
+} OS_RING_DATA;
+#endif
+
 /*
 *********************************************************************************************************
 *                                           SEMAPHORE DATA
@@ -522,6 +670,34 @@ typedef struct os_stk_data {
 } OS_STK_DATA;
 #endif
 
+/*
+*********************************************************************************************************
+*                                              TRACE DATA
+*********************************************************************************************************
+*/
+
+#if OS_TRACE_EN > 0u
+#define  OS_TRACE_EV_TASK_SW          1u   /* Task switched in,   'OSTraceArg' is its priority           */
+#define  OS_TRACE_EV_ISR_ENTER        2u   /* ISR entered,        'OSTraceArg' is the exception number   */
+#define  OS_TRACE_EV_ISR_EXIT         3u   /* ISR exited,         'OSTraceArg' is the exception number   */
+
+
+typedef struct os_trace_rec {
+    INT32U  OSTraceTS;                 /* Time stamp of the event (see OS_TS_GET())                    */
+    INT16U  OSTraceArg;                /* Argument of the event                                        */
+    INT8U   OSTraceType;               /* Type of event (see OS_TRACE_EV_???)                          */
+    INT8U   OSTraceNesting;            /* Value of OSIntNesting when the event was recorded            */
+} OS_TRACE_REC;
+
+
+typedef struct os_trace_task_data {
+    INT32U  OSCtxSwCtr;                /* Number of times the task was switched in                     */
+    INT32U  OSCyclesTot;               /* Total number of cycles the task has been running             */
+    INT32U  OSLatMax;                  /* Worst ISR to task latency (in cycles)                        */
+    INT16U  OSCPUUsage;                /* CPU usage over the last statistics period (0.01 %)           */
+} OS_TRACE_TASK_DATA;
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -538,6 +714,12 @@ typedef struct os_tcb {
     INT32U           OSTCBStkSize;          /* Size of task stack (in number of stack elements)        */
     INT16U           OSTCBOpt;              /* Task options as passed by OSTaskCreateExt()             */
     INT16U           OSTCBId;               /* Task ID (0..65535)                                      */
+#if OS_TASK_STK_GUARD_EN > 0u
+    OS_STK          *OSTCBStkGuard;         /* Base of the guard region of the stack (0 if none)       */
+#endif
+#if OS_TASK_STK_WM_EN > 0u
+    INT32U           OSTCBStkWM;            /* Nbr of stack entries known to be used (high-water mark) */
+#endif
 #endif
 
     struct os_tcb   *OSTCBNext;             /* Pointer to next     TCB in the TCB list                 */
@@ -576,6 +758,19 @@ typedef struct os_tcb {
     INT8U            OSTCBDelReq;           /* Indicates whether a task needs to delete itself         */
 #endif
 
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+    INT8U            OSTCBBasePrio;         /* Priority of the task without inheritance                */
+    INT8U            OSTCBPIPrio;           /* Priority inherited through the PI mutexes it owns       */
+    OS_PIMUTEX      *OSTCBPIMutexHeld;      /* List of PI mutexes owned by the task                    */
+    OS_PIMUTEX      *OSTCBPIMutexPend;      /* PI mutex the task is waiting for                        */
+    struct os_tcb   *OSTCBPIWaitNext;       /* Next task waiting for the same PI mutex                 */
+#endif
+
+#if (OS_POOL_EN > 0u) && (OS_POOL_TASK_CACHE_EN > 0u)
+    void            *OSTCBPoolCache[OS_POOL_NBR_CLASSES];     /* Blocks released by the task, per class  */
+    INT8U            OSTCBPoolCacheCtr[OS_POOL_NBR_CLASSES];  /* Number of blocks in each cache list     */
+#endif
+
 #if OS_TASK_PROFILE_EN > 0u
     INT32U           OSTCBCtxSwCtr;         /* Number of time the task was switched in                 */
     INT32U           OSTCBCyclesTot;        /* Total number of clock cycles the task has been running  */
@@ -584,6 +779,12 @@ typedef struct os_tcb {
     INT32U           OSTCBStkUsed;          /* Number of bytes used from the stack                     */
 #endif
 
+#if OS_TRACE_EN > 0u
+    INT32U           OSTCBCyclesPrev;       /* Value of OSTCBCyclesTot at the previous stat. update    */
+    INT32U           OSTCBLatMax;           /* Worst ISR to task latency (in cycles)                   */
+    INT16U           OSTCBCPUUsage;         /* CPU usage over the last statistics period (0.01 %)      */
+#endif
+
 #if OS_TASK_NAME_EN > 0u
     INT8U           *OSTCBTaskName;
 #endif
@@ -632,6 +833,32 @@ typedef  struct  os_tmr_wheel {
 } OS_TMR_WHEEL;
 #endif
 
+/*
+*********************************************************************************************************
+*                                    HIGH RESOLUTION TIMER DATA TYPES
+*********************************************************************************************************
+*/
+
+#if (OS_HTMR_EN > 0u) && (OS_HTMR_CFG_MAX > 0u)
+typedef  void (*OS_HTMR_CALLBACK)(void *ptmr, void *parg);
+
+typedef  struct  os_htmr {
+    INT8U             OSHTmrType;           /* Should be set to OS_HTMR_TYPE                           */
+    INT8U             OSHTmrOpt;            /* OS_HTMR_OPT_TASK or OS_HTMR_OPT_ISR                     */
+    INT8U             OSHTmrState;          /* OS_TMR_STATE_xxx                                        */
+    INT8U             OSHTmrLevel;          /* Level of the wheel the timer is linked in               */
+    INT8U             OSHTmrSlot;           /* Slot of that level                                      */
+    BOOLEAN           OSHTmrDonePend;       /* Task level callback waiting for the timer task          */
+    struct os_htmr   *OSHTmrNext;           /* Double link list of the slot (or free list)             */
+    struct os_htmr   *OSHTmrPrev;
+    struct os_htmr   *OSHTmrDoneNext;       /* List of callbacks waiting for the timer task            */
+    INT32U            OSHTmrExpire;         /* Counter value at which the timer expires                */
+    INT32U            OSHTmrPeriod;         /* Period (0 for a one-shot timer)                         */
+    OS_HTMR_CALLBACK  OSHTmrCallback;       /* Function to call when the timer expires                 */
+    void             *OSHTmrCallbackArg;    /* Argument to pass to the function                        */
+} OS_HTMR;
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -649,6 +876,9 @@ OS_EXT  OS_EVENT          OSEventTbl[OS_MAX_EVENTS];/* Table of EVENT control bl
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
 OS_EXT  OS_FLAG_GRP       OSFlagTbl[OS_MAX_FLAGS];  /* Table containing event flag groups              */
 OS_EXT  OS_FLAG_GRP      *OSFlagFreeList;           /* Pointer to free list of event flag groups       */
+#if OS_FLAG_POST_DEFER_EN > 0u
+OS_EXT  OS_FLAG_GRP      *OSFlagDeferList;          /* Groups posted by ISRs, waiters not checked yet  */
+#endif
 #endif
 
 #if OS_TASK_STAT_EN > 0u
@@ -698,11 +928,33 @@ OS_EXT  OS_MEM           *OSMemFreeList;            /* Pointer to free list of m
 OS_EXT  OS_MEM            OSMemTbl[OS_MAX_MEM_PART];/* Storage for memory partition manager            */
 #endif
 
+#if (OS_POOL_EN > 0u) && (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
+OS_EXT  OS_POOL           OSPoolTbl[OS_POOL_NBR_CLASSES];   /* Size classes of the memory pool         */
+OS_EXT  INT8U             OSPoolSizeMap[OS_POOL_MAP_SIZE];  /* Request size to class index map         */
+#endif
+
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+OS_EXT  OS_PIMUTEX       *OSPIMutexFreeList;        /* Pointer to list of free PI mutex control blocks */
+OS_EXT  OS_PIMUTEX        OSPIMutexTbl[OS_MAX_PIMUTEXES];   /* Table of PI mutex control blocks        */
+#endif
+
 #if (OS_Q_EN > 0u) && (OS_MAX_QS > 0u)
 OS_EXT  OS_Q             *OSQFreeList;              /* Pointer to list of free QUEUE control blocks    */
 OS_EXT  OS_Q              OSQTbl[OS_MAX_QS];        /* Table of QUEUE control blocks                   */
 #endif
 
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+OS_EXT  OS_RING          *OSRingFreeList;           /* Pointer to list of free RING control blocks     */
+OS_EXT  OS_RING           OSRingTbl[OS_MAX_RINGS];  /* Table of RING control blocks                    */
+#endif
+
+#if OS_TRACE_EN > 0u
+OS_EXT  OS_TRACE_REC      OSTraceTbl[OS_TRACE_BUF_SIZE];    /* Trace ring                              */
+OS_EXT  volatile  INT16U  OSTraceIn;                /* Free-running index of next record to write      */
+OS_EXT  volatile  INT16U  OSTraceOut;               /* Free-running index of next record to read       */
+OS_EXT  INT32U            OSTraceLostCtr;           /* Number of records dropped (trace ring full)     */
+#endif
+
 #if OS_TIME_GET_SET_EN > 0u
 OS_EXT  volatile  INT32U  OSTime;                   /* Current value of system time (in ticks)         */
 #endif
@@ -722,6 +974,20 @@ OS_EXT  OS_STK            OSTmrTaskStk[OS_TASK_TMR_STK_SIZE];
 OS_EXT  OS_TMR_WHEEL      OSTmrWheelTbl[OS_TMR_CFG_WHEEL_SIZE];
 #endif
 
+#if (OS_HTMR_EN > 0u) && (OS_HTMR_CFG_MAX > 0u)
+OS_EXT  OS_HTMR           OSHTmrTbl[OS_HTMR_CFG_MAX];   /* Table of high resolution timers             */
+OS_EXT  OS_HTMR          *OSHTmrFreeList;               /* Pointer to free list of timers              */
+OS_EXT  OS_HTMR          *OSHTmrWheelTbl[OS_HTMR_LEVELS][OS_HTMR_SLOTS];  /* Slots of the timing wheel */
+OS_EXT  INT16U            OSHTmrMapTbl[OS_HTMR_LEVELS]; /* Non-empty slots of each level               */
+OS_EXT  INT32U            OSHTmrTime;                   /* Time the wheel has been processed up to     */
+OS_EXT  OS_HTMR          *OSHTmrExpList;                /* Timers expiring at 'OSHTmrTime'             */
+OS_EXT  OS_HTMR          *OSHTmrDoneList;               /* Callbacks waiting for the timer task ...    */
+OS_EXT  OS_HTMR          *OSHTmrDoneTail;               /* ... in expiry order                         */
+OS_EXT  OS_EVENT         *OSHTmrSem;                    /* Sem. used to wake up the timer task         */
+OS_EXT  BOOLEAN           OSHTmrBusy;                   /* OSHTmrSignal() is processing the wheel      */
+OS_EXT  OS_STK            OSHTmrTaskStk[OS_TASK_HTMR_STK_SIZE];
+#endif
+
 extern  INT8U   const     OSUnMapTbl[256];          /* Priority->Index    lookup table                 */
 
 /*$PAGE*/
@@ -893,6 +1159,35 @@ INT8U         OSMemQuery              (OS_MEM          *pmem,
 
 #endif
 
+/*
+*********************************************************************************************************
+*                                     SIZE-CLASS MEMORY POOL MANAGEMENT
+*********************************************************************************************************
+*/
+
+#if (OS_POOL_EN > 0u) && (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
+
+#if OS_POOL_TASK_CACHE_EN > 0u
+void          OSPoolCacheFlush        (void);
+#endif
+
+void          OSPoolCreate            (void            *addr,
+                                       INT32U           nblks,
+                                       INT32U           blksize,
+                                       INT8U           *perr);
+
+void         *OSPoolGet               (INT32U           size,
+                                       INT8U           *perr);
+
+INT8U         OSPoolPut               (void            *pblk);
+
+#if OS_POOL_QUERY_EN > 0u
+INT8U         OSPoolQuery             (INT8U            ix,
+                                       OS_POOL_DATA    *p_pool_data);
+#endif
+
+#endif
+
 /*
 *********************************************************************************************************
 *                                MUTUAL EXCLUSION SEMAPHORE MANAGEMENT
@@ -928,6 +1223,39 @@ INT8U         OSMutexQuery            (OS_EVENT        *pevent,
 
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                PRIORITY INHERITANCE MUTEX MANAGEMENT
+*********************************************************************************************************
+*/
+
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+
+BOOLEAN       OSPIMutexAccept         (OS_PIMUTEX      *pmutex,
+                                       INT8U           *perr);
+
+OS_PIMUTEX   *OSPIMutexCreate         (INT8U           *perr);
+
+#if OS_PIMUTEX_DEL_EN > 0u
+OS_PIMUTEX   *OSPIMutexDel            (OS_PIMUTEX      *pmutex,
+                                       INT8U            opt,
+                                       INT8U           *perr);
+#endif
+
+void          OSPIMutexPend           (OS_PIMUTEX      *pmutex,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+INT8U         OSPIMutexPost           (OS_PIMUTEX      *pmutex);
+
+#if OS_PIMUTEX_QUERY_EN > 0u
+INT8U         OSPIMutexQuery          (OS_PIMUTEX      *pmutex,
+                                       OS_PIMUTEX_DATA *p_mutex_data);
+#endif
+
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -988,6 +1316,47 @@ INT8U         OSQQuery                (OS_EVENT        *pevent,
 
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                       RING BUFFER (SPSC) MANAGEMENT
+*********************************************************************************************************
+*/
+
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+
+INT16U        OSRingAccept            (OS_RING         *pring,
+                                       void            *pdest,
+                                       INT16U           max,
+                                       INT8U           *perr);
+
+OS_RING      *OSRingCreate            (void            *pstorage,
+                                       INT16U           size,
+                                       INT16U           elem_size,
+                                       INT16U           watermark,
+                                       INT8U           *perr);
+
+#if OS_RING_DEL_EN > 0u
+OS_RING      *OSRingDel               (OS_RING         *pring,
+                                       INT8U           *perr);
+#endif
+
+INT16U        OSRingPend              (OS_RING         *pring,
+                                       void            *pdest,
+                                       INT16U           max,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+INT8U         OSRingPost              (OS_RING         *pring,
+                                       void            *pdata);
+
+#if OS_RING_QUERY_EN > 0u
+INT8U         OSRingQuery             (OS_RING         *pring,
+                                       OS_RING_DATA    *p_ring_data);
+#endif
+
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -1173,6 +1542,58 @@ BOOLEAN      OSTmrStop                (OS_TMR          *ptmr,
 INT8U        OSTmrSignal              (void);
 #endif
 
+/*
+*********************************************************************************************************
+*                                         HIGH RESOLUTION TIMERS
+*********************************************************************************************************
+*/
+
+#if (OS_HTMR_EN > 0u) && (OS_HTMR_CFG_MAX > 0u)
+OS_HTMR      *OSHTmrCreate            (INT32U            period,
+                                       INT8U             opt,
+                                       OS_HTMR_CALLBACK  callback,
+                                       void             *callback_arg,
+                                       INT8U            *perr);
+
+#if OS_HTMR_DEL_EN > 0u
+BOOLEAN       OSHTmrDel               (OS_HTMR          *ptmr,
+                                       INT8U            *perr);
+#endif
+
+INT32U        OSHTmrRemainGet         (OS_HTMR          *ptmr,
+                                       INT8U            *perr);
+
+void          OSHTmrSignal            (void);
+
+BOOLEAN       OSHTmrStart             (OS_HTMR          *ptmr,
+                                       INT32U            dly,
+                                       INT8U            *perr);
+
+INT8U         OSHTmrStateGet          (OS_HTMR          *ptmr,
+                                       INT8U            *perr);
+
+BOOLEAN       OSHTmrStop              (OS_HTMR          *ptmr,
+                                       INT8U            *perr);
+
+INT32U        OSHTmrTimeGet           (void);
+#endif
+
+/*
+*********************************************************************************************************
+*                                     EVENT TRACE AND TASK PROFILING
+*********************************************************************************************************
+*/
+
+#if OS_TRACE_EN > 0u
+INT16U        OSTraceRead             (OS_TRACE_REC    *pdest,
+                                       INT16U           max);
+
+void          OSTraceStatUpdate       (void);
+
+INT8U         OSTraceTaskQuery        (INT8U                prio,
+                                       OS_TRACE_TASK_DATA  *p_task_data);
+#endif
+
 /*
 *********************************************************************************************************
 *                                             MISCELLANEOUS
@@ -1233,6 +1654,9 @@ void          OS_EventWaitListInit    (OS_EVENT        *pevent);
 #endif
 
 #if (OS_FLAG_EN > 0u) && (OS_MAX_FLAGS > 0u)
+#if OS_FLAG_POST_DEFER_EN > 0u
+BOOLEAN       OS_FlagDeferRun         (void);
+#endif
 void          OS_FlagInit             (void);
 void          OS_FlagUnlink           (OS_FLAG_NODE    *pnode);
 #endif
@@ -1248,12 +1672,32 @@ void          OS_MemCopy              (INT8U           *pdest,
 void          OS_MemInit              (void);
 #endif
 
+#if (OS_POOL_EN > 0u) && (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
+void          OS_PoolInit             (void);
+
+#if OS_POOL_TASK_CACHE_EN > 0u
+void          OS_PoolCacheFlush       (OS_TCB          *ptcb);
+#endif
+#endif
+
+#if (OS_PIMUTEX_EN > 0u) && (OS_MAX_PIMUTEXES > 0u)
+void          OS_PIMutexInit          (void);
+void          OS_PIMutexWaitRemove    (OS_TCB          *ptcb);
+OS_TCB       *OS_PIMutexTCBGet        (INT8U            prio);
+#endif
+
 #if OS_Q_EN > 0u
 void          OS_QInit                (void);
 #endif
 
+#if (OS_RING_EN > 0u) && (OS_MAX_RINGS > 0u)
+void          OS_RingInit             (void);
+#endif
+
 void          OS_Sched                (void);
 
+void          OS_SchedDeferred        (void);
+
 #if (OS_EVENT_NAME_EN > 0u) || (OS_FLAG_NAME_EN > 0u) || (OS_MEM_NAME_EN > 0u) || (OS_TASK_NAME_EN > 0u)
 INT8U         OS_StrLen               (INT8U           *psrc);
 #endif
@@ -1288,6 +1732,17 @@ INT8U         OS_TCBInit              (INT8U            prio,
 void          OSTmr_Init              (void);
 #endif
 
+#if (OS_HTMR_EN > 0u) && (OS_HTMR_CFG_MAX > 0u)
+void          OS_HTmrInit             (void);
+#endif
+
+#if OS_TRACE_EN > 0u
+void          OS_TraceInit            (void);
+void          OS_TraceIntEnter        (void);
+void          OS_TraceIntExit         (void);
+void          OS_TraceTaskSw          (void);
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -1399,7 +1854,13 @@ void          OSCtxSw                 (void);
     #endif
 
     #ifndef OS_FLAGS_NBITS
-    #error  "OS_CFG.H, Missing OS_FLAGS_NBITS: Determine #bits used for event flags, MUST be either 8, 16 or 32"
+    #error  "OS_CFG.H, Missing OS_FLAGS_NBITS: Determine #bits used for event flags, MUST be either 8, 16, 32 or 64"
+    #elif   (OS_FLAGS_NBITS != 8u) && (OS_FLAGS_NBITS != 16u) && (OS_FLAGS_NBITS != 32u) && (OS_FLAGS_NBITS != 64u)
+    #error  "OS_CFG.H, OS_FLAGS_NBITS MUST be either 8, 16, 32 or 64"
+    #endif
+
+    #ifndef OS_FLAG_POST_DEFER_EN
+    #error  "OS_CFG.H, Missing OS_FLAG_POST_DEFER_EN: Defer the wait list check of OSFlagPost() from ISRs to the context switch"
     #endif
 
     #ifndef OS_FLAG_WAIT_CLR_EN
@@ -1483,6 +1944,54 @@ void          OSCtxSw                 (void);
     #endif
 #endif
 
+/*
+*********************************************************************************************************
+*                                        SIZE-CLASS MEMORY POOLS
+*********************************************************************************************************
+*/
+
+#ifndef OS_POOL_EN
+#error  "OS_CFG.H, Missing OS_POOL_EN: Enable (1) or Disable (0) code generation for SIZE-CLASS POOLS"
+#elif   OS_POOL_EN > 0u
+    #if     (OS_MEM_EN == 0u) || (OS_MAX_MEM_PART == 0u)
+    #error  "OS_CFG.H, The memory manager is required (set OS_MEM_EN to 1) when enabling Size-Class Pools"
+    #endif
+
+    #ifndef OS_POOL_MIN_BLK_SIZE
+    #error  "OS_CFG.H, Missing OS_POOL_MIN_BLK_SIZE: Size (in bytes) of the smallest class"
+    #elif   (OS_POOL_MIN_BLK_SIZE & (OS_POOL_MIN_BLK_SIZE - 1u)) != 0u
+    #error  "OS_CFG.H, OS_POOL_MIN_BLK_SIZE must be a power of 2"
+    #endif
+
+    #ifndef OS_POOL_NBR_CLASSES
+    #error  "OS_CFG.H, Missing OS_POOL_NBR_CLASSES: Number of size classes"
+    #elif   (OS_POOL_NBR_CLASSES == 0u) || (OS_POOL_NBR_CLASSES > 12u)
+    #error  "OS_CFG.H, OS_POOL_NBR_CLASSES must be between 1 and 12"
+    #endif
+
+    #ifndef OS_POOL_ALIGN
+    #error  "OS_CFG.H, Missing OS_POOL_ALIGN: Alignment (in bytes) of the pool storage"
+    #elif   (OS_POOL_ALIGN != 4u) && (OS_POOL_ALIGN != 32u)
+    #error  "OS_CFG.H, OS_POOL_ALIGN must be 4 or 32"
+    #elif   OS_POOL_MIN_BLK_SIZE < OS_POOL_ALIGN
+    #error  "OS_CFG.H, OS_POOL_MIN_BLK_SIZE must be >= OS_POOL_ALIGN"
+    #endif
+
+    #ifndef OS_POOL_TASK_CACHE_EN
+    #error  "OS_CFG.H, Missing OS_POOL_TASK_CACHE_EN: Enable (1) or Disable (0) per-task block caches"
+    #elif   OS_POOL_TASK_CACHE_EN > 0u
+        #ifndef OS_POOL_TASK_CACHE_DEPTH
+        #error  "OS_CFG.H, Missing OS_POOL_TASK_CACHE_DEPTH: Max. number of blocks cached per task and class"
+        #elif   (OS_POOL_TASK_CACHE_DEPTH == 0u) || (OS_POOL_TASK_CACHE_DEPTH > 255u)
+        #error  "OS_CFG.H, OS_POOL_TASK_CACHE_DEPTH must be between 1 and 255"
+        #endif
+    #endif
+
+    #ifndef OS_POOL_QUERY_EN
+    #error  "OS_CFG.H, Missing OS_POOL_QUERY_EN: Include code for OSPoolQuery()"
+    #endif
+#endif
+
 /*
 *********************************************************************************************************
 *                                       MUTUAL EXCLUSION SEMAPHORES
@@ -1505,6 +2014,32 @@ void          OSCtxSw                 (void);
     #endif
 #endif
 
+/*
+*********************************************************************************************************
+*                                     PRIORITY INHERITANCE MUTEXES
+*********************************************************************************************************
+*/
+
+#ifndef OS_PIMUTEX_EN
+#error  "OS_CFG.H, Missing OS_PIMUTEX_EN: Enable (1) or Disable (0) code generation for PI MUTEXES"
+#elif   OS_PIMUTEX_EN > 0u
+    #ifndef OS_MAX_PIMUTEXES
+    #error  "OS_CFG.H, Missing OS_MAX_PIMUTEXES: Max. number of PI mutex control blocks"
+    #else
+        #if     OS_MAX_PIMUTEXES > 65500u
+        #error  "OS_CFG.H, OS_MAX_PIMUTEXES must be <= 65500"
+        #endif
+    #endif
+
+    #ifndef OS_PIMUTEX_DEL_EN
+    #error  "OS_CFG.H, Missing OS_PIMUTEX_DEL_EN: Include code for OSPIMutexDel()"
+    #endif
+
+    #ifndef OS_PIMUTEX_QUERY_EN
+    #error  "OS_CFG.H, Missing OS_PIMUTEX_QUERY_EN: Include code for OSPIMutexQuery()"
+    #endif
+#endif
+
 /*
 *********************************************************************************************************
 *                                              MESSAGE QUEUES
@@ -1555,6 +2090,39 @@ void          OSCtxSw                 (void);
     #endif
 #endif
 
+/*
+*********************************************************************************************************
+*                                         RING BUFFERS (SPSC)
+*********************************************************************************************************
+*/
+
+#ifndef OS_RING_EN
+#error  "OS_CFG.H, Missing OS_RING_EN: Enable (1) or Disable (0) code generation for RING BUFFERS"
+#elif   OS_RING_EN > 0u
+    #ifndef OS_MAX_RINGS
+    #error  "OS_CFG.H, Missing OS_MAX_RINGS: Max. number of ring buffer control blocks"
+    #else
+        #if     OS_MAX_RINGS > 65500u
+        #error  "OS_CFG.H, OS_MAX_RINGS must be <= 65500"
+        #endif
+    #endif
+
+    #if     (OS_SEM_EN == 0u) || (OS_SEM_ACCEPT_EN == 0u)
+    #error  "OS_CFG.H, Semaphores and OSSemAccept() are required (set OS_SEM_EN and OS_SEM_ACCEPT_EN to 1)"
+    #error  "          when enabling Ring Buffers.  The consumer is woken by a semaphore."
+    #endif
+
+    #ifndef OS_RING_DEL_EN
+    #error  "OS_CFG.H, Missing OS_RING_DEL_EN: Include code for OSRingDel()"
+    #elif   (OS_RING_DEL_EN > 0u) && (OS_SEM_DEL_EN == 0u)
+    #error  "OS_CFG.H, OSSemDel() is required (set OS_SEM_DEL_EN to 1) when enabling OSRingDel()"
+    #endif
+
+    #ifndef OS_RING_QUERY_EN
+    #error  "OS_CFG.H, Missing OS_RING_QUERY_EN: Include code for OSRingQuery()"
+    #endif
+#endif
+
 /*
 *********************************************************************************************************
 *                                              SEMAPHORES
@@ -1624,6 +2192,30 @@ void          OSCtxSw                 (void);
 #error  "OS_CFG.H, Missing OS_TASK_STAT_STK_CHK_EN: Check task stacks from statistics task"
 #endif
 
+#ifndef OS_TASK_STK_GUARD_EN
+#error  "OS_CFG.H, Missing OS_TASK_STK_GUARD_EN: Catch task stack overflows with an MPU guard region"
+#else
+    #if     OS_TASK_STK_GUARD_EN > 0u
+        #if     OS_TASK_CREATE_EXT_EN == 0u
+        #error  "OS_CFG.H, OS_TASK_STK_GUARD_EN requires OS_TASK_CREATE_EXT_EN"
+        #endif
+
+        #ifndef OS_TASK_STK_GUARD_SIZE
+        #error  "OS_CFG.H, Missing OS_TASK_STK_GUARD_SIZE: Size (in bytes) of the stack guard"
+        #elif   (OS_TASK_STK_GUARD_SIZE < 32u) || ((OS_TASK_STK_GUARD_SIZE & (OS_TASK_STK_GUARD_SIZE - 1u)) != 0u)
+        #error  "OS_CFG.H, OS_TASK_STK_GUARD_SIZE must be a power of 2 >= 32"
+        #endif
+    #endif
+#endif
+
+#ifndef OS_TASK_STK_WM_EN
+#error  "OS_CFG.H, Missing OS_TASK_STK_WM_EN: Binary search of the stack high-water mark"
+#else
+    #if     (OS_TASK_STK_WM_EN > 0u) && ((OS_TASK_STAT_STK_CHK_EN == 0u) || (OS_TASK_CREATE_EXT_EN == 0u))
+    #error  "OS_CFG.H, OS_TASK_STK_WM_EN requires OS_TASK_STAT_STK_CHK_EN and OS_TASK_CREATE_EXT_EN"
+    #endif
+#endif
+
 #ifndef OS_TASK_CHANGE_PRIO_EN
 #error  "OS_CFG.H, Missing OS_TASK_CHANGE_PRIO_EN: Include code for OSTaskChangePrio()"
 #endif
@@ -1734,6 +2326,43 @@ void          OSCtxSw                 (void);
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                       HIGH RESOLUTION TIMERS
+*********************************************************************************************************
+*/
+
+#ifndef OS_HTMR_EN
+#error  "OS_CFG.H, Missing OS_HTMR_EN: Enable (1) or Disable (0) code generation for HIGH RESOLUTION TIMERS"
+#elif   OS_HTMR_EN > 0u
+    #if     OS_SEM_EN == 0u
+    #error  "OS_CFG.H, Semaphore management is required (set OS_SEM_EN to 1) when enabling High Resolution Timers"
+    #endif
+
+    #ifndef OS_HTMR_CFG_MAX
+    #error  "OS_CFG.H, Missing OS_HTMR_CFG_MAX: Max. number of high resolution timers"
+    #elif   OS_HTMR_CFG_MAX > 65500u
+    #error  "OS_CFG.H, OS_HTMR_CFG_MAX must be <= 65500"
+    #endif
+
+    #ifndef OS_HTMR_CFG_CLK_HZ
+    #error  "OS_CFG.H, Missing OS_HTMR_CFG_CLK_HZ: Frequency of the hardware timer counter (Hz)"
+    #endif
+
+    #ifndef OS_HTMR_DEL_EN
+    #error  "OS_CFG.H, Missing OS_HTMR_DEL_EN: Include code for OSHTmrDel()"
+    #endif
+
+    #ifndef OS_TASK_HTMR_PRIO
+    #error  "OS_CFG.H, Missing OS_TASK_HTMR_PRIO: Priority of the High Resolution Timer task"
+    #endif
+
+    #ifndef OS_TASK_HTMR_STK_SIZE
+    #error  "OS_CFG.H, Missing OS_TASK_HTMR_STK_SIZE: Determines the size of the High Resolution Timer Task's stack"
+    #endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                            MISCELLANEOUS
@@ -1803,6 +2432,21 @@ void          OSCtxSw                 (void);
 #error  "OS_CFG.H, Missing OS_TIME_TICK_HOOK_EN: Allows you to include the code for OSTimeTickHook() or not"
 #endif
 
+
+#ifndef OS_TRACE_EN
+#error  "OS_CFG.H, Missing OS_TRACE_EN: Enable (1) or Disable (0) the event trace and task profiler"
+#elif   OS_TRACE_EN > 0u
+    #ifndef OS_TRACE_BUF_SIZE
+    #error  "OS_CFG.H, Missing OS_TRACE_BUF_SIZE: Number of records in the trace ring"
+    #elif   (OS_TRACE_BUF_SIZE < 2u) || (OS_TRACE_BUF_SIZE > 32768u) || ((OS_TRACE_BUF_SIZE & (OS_TRACE_BUF_SIZE - 1u)) != 0u)
+    #error  "OS_CFG.H, OS_TRACE_BUF_SIZE must be a power of 2 between 2 and 32768"
+    #endif
+
+    #if     (OS_TASK_PROFILE_EN == 0u) || (OS_TASK_SW_HOOK_EN == 0u)
+    #error  "OS_CFG.H, OS_TASK_PROFILE_EN and OS_TASK_SW_HOOK_EN must be set to 1 when enabling the trace"
+    #endif
+#endif
+
 /*
 *********************************************************************************************************
 *                                         SAFETY CRITICAL USE
@@ -1861,6 +2505,12 @@ void          OSCtxSw                 (void);
     #endif
 #endif
 
+#if    OS_PIMUTEX_EN > 0u
+    #if    OS_PIMUTEX_DEL_EN > 0u
+    #error "OS_CFG.H, OS_PIMUTEX_DEL_EN must be disabled for safety-critical release code"
+    #endif
+#endif
+
 #if    OS_Q_EN > 0u
     #if    OS_Q_DEL_EN > 0u
     #error "OS_CFG.H, OS_Q_DEL_EN must be disabled for safety-critical release code"
@@ -1873,6 +2523,18 @@ void          OSCtxSw                 (void);
     #endif
 #endif
 
+#if    OS_RING_EN > 0u
+    #if    OS_RING_DEL_EN > 0u
+    #error "OS_CFG.H, OS_RING_DEL_EN must be disabled for safety-critical release code"
+    #endif
+#endif
+
+#if    OS_HTMR_EN > 0u
+    #if    OS_HTMR_DEL_EN > 0u
+    #error "OS_CFG.H, OS_HTMR_DEL_EN must be disabled for safety-critical release code"
+    #endif
+#endif
+
 #if    OS_TASK_EN > 0u
     #if    OS_TASK_DEL_EN > 0u
     #error "OS_CFG.H, OS_TASK_DEL_EN must be disabled for safety-critical release code"